@@ -263,7 +263,10 @@ D2CfgMgr::parseElement(const std::string& element_id,
             (element_id == "ncr-protocol") ||
             (element_id == "ncr-format") ||
             (element_id == "port")  ||
-            (element_id == "dns-server-timeout"))  {
+            (element_id == "dns-server-timeout") ||
+            (element_id == "dns-update-threads") ||
+            (element_id == "dns-update-batch-size") ||
+            (element_id == "dns-protocol"))  {
             // global scalar params require nothing extra be done
         } else if (element_id == "tsig-keys") {
             TSIGKeyInfoListParser parser;
@@ -311,6 +314,9 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
     uint32_t dns_server_timeout = 0;
     dhcp_ddns::NameChangeProtocol ncr_protocol = dhcp_ddns::NCR_UDP;
     dhcp_ddns::NameChangeFormat ncr_format = dhcp_ddns::FMT_JSON;
+    uint32_t dns_update_threads = 0;
+    uint32_t dns_update_batch_size = 1;
+    dhcp_ddns::NameChangeProtocol dns_protocol = dhcp_ddns::NCR_UDP;
 
     // Assumes that params_config has had defaults added
     BOOST_FOREACH(isc::dhcp::ConfigPair param, params_config->mapValue()) {
@@ -339,12 +345,12 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
                 }
             } else if (entry == "ncr-format") {
                 ncr_format = getFormat(entry, value);
-                if (ncr_format != dhcp_ddns::FMT_JSON) {
-                    isc_throw(D2CfgError, "NCR Format:"
-                              << dhcp_ddns::ncrFormatToString(ncr_format)
-                              << " is not yet supported"
-                              << " (" << value->getPosition() << ")");
-                }
+            } else if (entry == "dns-update-threads") {
+                dns_update_threads = getInt<uint32_t>(entry, value);
+            } else if (entry == "dns-update-batch-size") {
+                dns_update_batch_size = getInt<uint32_t>(entry, value);
+            } else if (entry == "dns-protocol") {
+                dns_protocol = getProtocol(entry, value);
             } else {
                 isc_throw(D2CfgError,
                           "unsupported parameter '" << entry
@@ -361,7 +367,10 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
     // Attempt to create the new client config. This ought to fly as
     // we already validated everything.
     D2ParamsPtr params(new D2Params(ip_address, port, dns_server_timeout,
-                                    ncr_protocol, ncr_format));
+                                    ncr_protocol, ncr_format,
+                                    dns_update_threads,
+                                    dns_update_batch_size,
+                                    dns_protocol));
 
     getD2CfgContext()->getD2Params() = params;
 }
@@ -298,7 +298,7 @@ protected:
     /// -# port is 0
     /// -# dns_server_timeout is < 1
     /// -# ncr_protocol is invalid, currently only NCR_UDP is supported
-    /// -# ncr_format is invalid, currently only FMT_JSON is supported
+    /// -# ncr_format is invalid
     virtual void buildParams(isc::data::ConstElementPtr params_config);
 
     /// @brief Creates an new, blank D2CfgContext context
@@ -15,7 +15,9 @@
 #include <boost/foreach.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/unordered_map.hpp>
 
+#include <cctype>
 #include <sstream>
 #include <string>
 
@@ -30,11 +32,17 @@ D2Params::D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format)
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const size_t dns_update_threads,
+                   const size_t dns_update_batch_size,
+                   const dhcp_ddns::NameChangeProtocol& dns_protocol)
     : ip_address_(ip_address),
     port_(port),
     dns_server_timeout_(dns_server_timeout),
     ncr_protocol_(ncr_protocol),
+    dns_update_threads_(dns_update_threads),
+    dns_update_batch_size_(dns_update_batch_size),
+    dns_protocol_(dns_protocol),
     ncr_format_(ncr_format) {
     validateContents();
 }
@@ -42,7 +50,8 @@ D2Params::D2Params(const isc::asiolink::IOAddress& ip_address,
 D2Params::D2Params()
     : ip_address_(isc::asiolink::IOAddress("127.0.0.1")),
      port_(53001), dns_server_timeout_(100),
-     ncr_protocol_(dhcp_ddns::NCR_UDP),
+     ncr_protocol_(dhcp_ddns::NCR_UDP), dns_update_threads_(0),
+     dns_update_batch_size_(1), dns_protocol_(dhcp_ddns::NCR_UDP),
      ncr_format_(dhcp_ddns::FMT_JSON) {
     validateContents();
 }
@@ -65,17 +74,16 @@ D2Params::validateContents() {
                   "D2Params: DNS server timeout must be larger than 0");
     }
 
-    if (ncr_format_ != dhcp_ddns::FMT_JSON) {
-        isc_throw(D2CfgError, "D2Params: NCR Format:"
-                  << dhcp_ddns::ncrFormatToString(ncr_format_)
-                  << " is not yet supported");
-    }
-
     if (ncr_protocol_ != dhcp_ddns::NCR_UDP) {
         isc_throw(D2CfgError, "D2Params: NCR Protocol:"
                   << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
                   << " is not yet supported");
     }
+
+    if (dns_update_batch_size_ < 1) {
+        isc_throw(D2CfgError,
+                  "D2Params: DNS update batch size must be larger than 0");
+    }
 }
 
 std::string
@@ -92,7 +100,10 @@ D2Params::operator == (const D2Params& other) const {
             (port_ == other.port_) &&
             (dns_server_timeout_ == other.dns_server_timeout_) &&
             (ncr_protocol_ == other.ncr_protocol_) &&
-            (ncr_format_ == other.ncr_format_));
+            (ncr_format_ == other.ncr_format_) &&
+            (dns_update_threads_ == other.dns_update_threads_) &&
+            (dns_update_batch_size_ == other.dns_update_batch_size_) &&
+            (dns_protocol_ == other.dns_protocol_));
 }
 
 bool
@@ -110,7 +121,11 @@ D2Params::toText() const {
            << ", ncr-protocol: "
            << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
            << ", ncr-format: " << ncr_format_
-           << dhcp_ddns::ncrFormatToString(ncr_format_);
+           << dhcp_ddns::ncrFormatToString(ncr_format_)
+           << ", dns-update-threads: " << dns_update_threads_
+           << ", dns-update-batch-size: " << dns_update_batch_size_
+           << ", dns-protocol: "
+           << dhcp_ddns::ncrProtocolToString(dns_protocol_);
 
     return (stream.str());
 }
@@ -230,8 +245,42 @@ DdnsDomain::getKeyName() const {
 
 const char* DdnsDomainListMgr::wildcard_domain_name_ = "*";
 
+namespace {
+
+/// @brief Extracts the label of a domain name preceding a position.
+///
+/// The labels are separated by dots. A name ending with a dot has an
+/// empty last label, so "example.com." and "example.com" are different.
+///
+/// @param name is the domain name.
+/// @param end is the position following the label.
+/// @param label receives the label, in lower case.
+///
+/// @return the position of the dot preceding the label or npos if the
+/// label is the first one.
+size_t
+previousLabel(const std::string& name, const size_t end, std::string& label) {
+    size_t dot = (end == 0 ? std::string::npos : name.rfind('.', end - 1));
+    size_t begin = (dot == std::string::npos ? 0 : dot + 1);
+    label.assign(name, begin, end - begin);
+    for (std::string::iterator c = label.begin(); c != label.end(); ++c) {
+        *c = tolower(static_cast<unsigned char>(*c));
+    }
+    return (dot);
+}
+
+} // end of anonymous namespace
+
+struct DdnsDomainListMgr::DomainTrieNode {
+    /// @brief The domain whose name ends at this node, if any.
+    DdnsDomainPtr domain_;
+
+    /// @brief Child nodes, keyed by label.
+    boost::unordered_map<std::string, DomainTrieNodePtr> children_;
+};
+
 DdnsDomainListMgr::DdnsDomainListMgr(const std::string& name) : name_(name),
-    domains_(new DdnsDomainMap()) {
+    domains_(new DdnsDomainMap()), trie_(new DomainTrieNode()) {
 }
 
 
@@ -254,6 +303,44 @@ DdnsDomainListMgr::setDomains(DdnsDomainMapPtr domains) {
     if (gotit != domains_->end()) {
             wildcard_domain_ = gotit->second;
     }
+
+    // Build the trie used for matching.
+    trie_.reset(new DomainTrieNode());
+    DdnsDomainMapPair map_pair;
+    BOOST_FOREACH (map_pair, *domains_) {
+        addToTrie(map_pair.first, map_pair.second);
+    }
+}
+
+void
+DdnsDomainListMgr::addToTrie(const std::string& name,
+                             const DdnsDomainPtr& domain) {
+    // An empty name never matches.
+    if (name.empty()) {
+        return;
+    }
+
+    DomainTrieNode* node = trie_.get();
+    std::string label;
+    size_t end = name.size();
+    for (;;) {
+        size_t dot = previousLabel(name, end, label);
+        DomainTrieNodePtr& child = node->children_[label];
+        if (!child) {
+            child.reset(new DomainTrieNode());
+        }
+        node = child.get();
+        if (dot == std::string::npos) {
+            break;
+        }
+        end = dot;
+    }
+
+    // Names differing only by case are the same domain: the first one
+    // (in the map order) wins.
+    if (!node->domain_) {
+        node->domain_ = domain;
+    }
 }
 
 bool
@@ -264,45 +351,28 @@ DdnsDomainListMgr::matchDomain(const std::string& fqdn, DdnsDomainPtr& domain) {
         return (true);
     }
 
-    // Iterate over the domain map looking for the domain which matches
-    // the longest portion of the given fqdn.
-
-    size_t req_len = fqdn.size();
-    size_t match_len = 0;
-    DdnsDomainMapPair map_pair;
+    // Walk down the trie from the last label of the fqdn. The deepest
+    // node holding a domain is the domain which matches the longest
+    // portion of the fqdn.
     DdnsDomainPtr best_match;
-    BOOST_FOREACH (map_pair, *domains_) {
-        std::string domain_name = map_pair.first;
-        size_t dom_len = domain_name.size();
-
-        // If the domain name is longer than the fqdn, then it cant be match.
-        if (req_len < dom_len) {
-            continue;
+    const DomainTrieNode* node = trie_.get();
+    std::string label;
+    size_t end = fqdn.size();
+    for (;;) {
+        size_t dot = previousLabel(fqdn, end, label);
+        boost::unordered_map<std::string, DomainTrieNodePtr>::const_iterator
+            child = node->children_.find(label);
+        if (child == node->children_.end()) {
+            break;
         }
-
-        // If the lengths are identical and the names match we're done.
-        if (req_len == dom_len) {
-            if (boost::iequals(fqdn, domain_name)) {
-                // exact match, done
-                domain = map_pair.second;
-                return (true);
-            }
-        } else {
-            // The fqdn is longer than the domain name.  Adjust the start
-            // point of comparison by the excess in length.  Only do the
-            // comparison if the adjustment lands on a boundary. This
-            // prevents "onetwo.net" from matching "two.net".
-            size_t offset = req_len - dom_len;
-            if ((fqdn[offset - 1] == '.')  &&
-               (boost::iequals(fqdn.substr(offset), domain_name))) {
-                // Fqdn contains domain name, keep it if its better than
-                // any we have matched so far.
-                if (dom_len > match_len) {
-                    match_len = dom_len;
-                    best_match = map_pair.second;
-                }
-            }
+        node = child->second.get();
+        if (node->domain_) {
+            best_match = node->domain_;
+        }
+        if (dot == std::string::npos) {
+            break;
         }
+        end = dot;
     }
 
     if (!best_match) {
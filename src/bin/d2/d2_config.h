@@ -142,18 +142,29 @@ public:
     /// wait for a response to a single DNS update request.
     /// @param ncr_protocol socket protocol D2 should use to receive NCRS
     /// @param ncr_format packet format of the inbound NCRs
+    /// @param dns_update_threads number of threads carrying out the DNS
+    /// updates, zero to carry them out on the main thread
+    /// @param dns_update_batch_size maximum number of Add requests combined
+    /// in a single DNS update, one to disable batching
+    /// @param dns_protocol socket protocol D2 should use to send the DNS
+    /// updates
     ///
     /// @throw D2CfgError if:
     /// -# ip_address is 0.0.0.0 or ::
     /// -# port is 0
     /// -# dns_server_timeout is < 1
     /// -# ncr_protocol is invalid, currently only NCR_UDP is supported
-    /// -# ncr_format is invalid, currently only FMT_JSON is supported
+    /// -# ncr_format is invalid
+    /// -# dns_update_batch_size is < 1
     D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format);
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const size_t dns_update_threads = 0,
+                   const size_t dns_update_batch_size = 1,
+                   const dhcp_ddns::NameChangeProtocol& dns_protocol =
+                   dhcp_ddns::NCR_UDP);
 
     /// @brief Default constructor
     /// The default constructor creates an instance that has updates disabled.
@@ -187,6 +198,22 @@ public:
         return(ncr_format_);
     }
 
+    /// @brief Return the number of threads carrying out the DNS updates.
+    size_t getDnsUpdateThreads() const {
+        return(dns_update_threads_);
+    }
+
+    /// @brief Return the maximum number of requests combined in a DNS
+    /// update.
+    size_t getDnsUpdateBatchSize() const {
+        return(dns_update_batch_size_);
+    }
+
+    /// @brief Return the socket protocol used to send the DNS updates.
+    const dhcp_ddns::NameChangeProtocol& getDnsProtocol() const {
+        return(dns_protocol_);
+    }
+
     /// @brief Return summary of the configuration used by D2.
     ///
     /// The returned summary of the configuration is meant to be appended to
@@ -214,7 +241,7 @@ protected:
     /// -# port is not 0
     /// -# dns_server_timeout is 0
     /// -# ncr_protocol is UDP
-    /// -# ncr_format is JSON
+    /// -# dns_update_batch_size is not 0
     ///
     /// @throw D2CfgError if contents are invalid
     virtual void validateContents();
@@ -233,6 +260,17 @@ private:
     /// Currently only UDP is supported.
     dhcp_ddns::NameChangeProtocol ncr_protocol_;
 
+    /// @brief Number of threads carrying out the DNS updates.
+    /// Zero means the updates are carried out by the main thread.
+    size_t dns_update_threads_;
+
+    /// @brief Maximum number of Add requests combined in a DNS update.
+    /// One means that the requests are not batched.
+    size_t dns_update_batch_size_;
+
+    /// @brief The socket protocol used to send the DNS updates.
+    dhcp_ddns::NameChangeProtocol dns_protocol_;
+
     /// @brief Format of the inbound requests (NCRs).
     /// Currently only JSON format is supported.
     dhcp_ddns::NameChangeFormat ncr_format_;
@@ -610,6 +648,10 @@ public:
     /// match.  If the wild card domain is the only domain in the list, then
     /// it will be returned immediately for any FQDN.
     ///
+    /// The search walks the domain trie built by setDomains() from the last
+    /// label of the FQDN, so its cost depends on the number of labels of the
+    /// FQDN, not on the number of domains.
+    ///
     /// @param fqdn is the name for which to look.
     /// @param domain receives the matching domain. If no match is found its
     /// contents will be unchanged.
@@ -652,10 +694,27 @@ public:
 
     /// @brief Sets the manger's domain list to the given list of domains.
     /// This method will scan the inbound list for the wild card domain and
-    /// set the internal wild card domain pointer accordingly.
+    /// set the internal wild card domain pointer accordingly. It also builds
+    /// the trie used for matching, so the list must not be modified
+    /// afterwards.
     void setDomains(DdnsDomainMapPtr domains);
 
 private:
+    /// @brief Node of the domain trie.
+    ///
+    /// The trie holds the domain names split into labels, the root being
+    /// the last label. Labels are in lower case.
+    struct DomainTrieNode;
+
+    /// @brief Defines a pointer to a node of the domain trie.
+    typedef boost::shared_ptr<DomainTrieNode> DomainTrieNodePtr;
+
+    /// @brief Adds a domain to the domain trie.
+    ///
+    /// @param name is the name of the domain.
+    /// @param domain is the domain.
+    void addToTrie(const std::string& name, const DdnsDomainPtr& domain);
+
     /// @brief An arbitrary label assigned to this manager.
     std::string name_;
 
@@ -664,6 +723,9 @@ private:
 
     /// @brief Pointer to the wild card domain.
     DdnsDomainPtr wildcard_domain_;
+
+    /// @brief Root of the domain trie.
+    DomainTrieNodePtr trie_;
 };
 
 /// @brief Defines a pointer for DdnsDomain instances.
@@ -55,6 +55,27 @@ D2Controller::D2Controller()
     }
 }
 
+isc::data::ConstElementPtr
+D2Controller::configFromFile() {
+    D2ProcessPtr process = boost::dynamic_pointer_cast<D2Process>(getProcess());
+    if (!process) {
+        return (DControllerBase::configFromFile());
+    }
+
+    const D2UpdateMgrPtr& update_mgr = process->getD2UpdateMgr();
+    update_mgr->pauseUpdates();
+    isc::data::ConstElementPtr answer;
+    try {
+        answer = DControllerBase::configFromFile();
+    } catch (...) {
+        update_mgr->resumeUpdates();
+        throw;
+    }
+
+    update_mgr->resumeUpdates();
+    return (answer);
+}
+
 isc::data::ConstElementPtr 
 D2Controller::parseFile(const std::string& file_name) {
     isc::data::ConstElementPtr elements;
@@ -34,6 +34,14 @@ public:
     /// @brief Destructor.
     virtual ~D2Controller();
 
+    /// @brief Reads, parses and applies the configuration file.
+    ///
+    /// Pauses the DNS update threads while the base class reconfigures the
+    /// logging and the process: the threads log and use the configuration.
+    ///
+    /// @return the answer of @c DControllerBase::configFromFile.
+    virtual isc::data::ConstElementPtr configFromFile();
+
     /// @brief Defines the application name, this is passed into base class
     /// and appears in log statements.
     static const char* d2_app_name_;
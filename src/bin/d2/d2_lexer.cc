@@ -524,8 +524,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to d2_parser_text[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 58
-#define YY_END_OF_BUFFER 59
+#define YY_NUM_RULES 62
+#define YY_END_OF_BUFFER 63
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -533,45 +533,49 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[336] =
+static const flex_int16_t yy_accept[378] =
     {   0,
-       51,   51,    0,    0,    0,    0,    0,    0,    0,    0,
-       59,   57,   10,   11,   57,    1,   51,   48,   51,   51,
-       57,   50,   49,   57,   57,   57,   57,   57,   44,   45,
-       57,   57,   57,   46,   47,    5,    5,    5,   57,   57,
-       57,   10,   11,    0,    0,   40,    0,    0,    0,    0,
+       55,   55,    0,    0,    0,    0,    0,    0,    0,    0,
+       63,   61,   10,   11,   61,    1,   55,   52,   55,   55,
+       61,   54,   53,   61,   61,   61,   61,   61,   48,   49,
+       61,   61,   61,   50,   51,    5,    5,    5,   61,   61,
+       61,   10,   11,    0,    0,   44,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    1,   51,   51,    0,   50,
-       51,    3,    2,    6,    0,   51,    0,    0,    0,    0,
-        0,    0,    4,    0,    0,    9,    0,   41,    0,    0,
-        0,    0,    0,    0,    0,   43,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    1,   55,   55,    0,
+       54,   55,    3,    2,    6,    0,   55,    0,    0,    0,
+        0,    0,    0,    4,    0,    0,    9,    0,   45,    0,
+        0,    0,    0,    0,    0,    0,    0,   47,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
-       42,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    2,    0,    0,    0,
+        0,    0,    0,    0,    8,    0,    0,    0,    0,    0,
+        0,    0,    0,   46,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   56,   54,    0,   53,   52,    0,    0,    0,    0,
-        0,   19,   18,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   55,   52,    0,    0,    0,    0,    0,   20,
+        0,    0,    0,    0,   60,   58,    0,   57,   56,    0,
+        0,    0,    0,    0,    0,   22,   21,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   59,   56,    0,    0,
+        0,    0,    0,    0,   23,    0,    0,    0,    0,    0,
 
-        0,    0,   35,    0,    0,    0,   14,    0,    0,    0,
-        0,    0,    0,   38,   39,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   39,
+        0,    0,    0,   14,    0,    0,    0,    0,    0,    0,
+        0,   42,   43,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    7,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   34,
-        0,    0,   30,    0,    0,    0,   31,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   32,    0,    0,    0,
-        0,    0,    0,   12,    0,    0,    0,    0,    0,    0,
-       26,    0,   24,    0,    0,    0,    0,   37,    0,   28,
+        0,    0,    0,    0,    7,   24,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-       27,    0,   36,    0,    0,    0,    0,   13,   17,    0,
-        0,    0,    0,   29,    0,   25,    0,    0,    0,    0,
-       23,    0,   21,   16,    0,   22,    0,    0,    0,   33,
-        0,    0,    0,   15,    0
+        0,    0,   38,    0,    0,   34,    0,    0,    0,   35,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   36,    0,    0,    0,    0,    0,    0,   12,    0,
+        0,    0,    0,    0,    0,    0,    0,   30,    0,   28,
+
+        0,    0,    0,    0,   41,    0,   32,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+        0,   40,    0,    0,    0,    0,    0,    0,   13,   20,
+        0,    0,    0,    0,   33,    0,    0,   29,    0,    0,
+        0,    0,    0,    0,   27,   18,    0,    0,    0,   25,
+       19,    0,   26,    0,    0,    0,    0,    0,    0,    0,
+       37,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       15,    0,   16,    0,    0,   17,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -583,13 +587,13 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,    5,    5,   27,    5,   28,    5,   29,   30,   31,
-        5,   32,   33,   34,   35,    5,    5,    5,    5,    5,
-       36,   37,   38,    5,   39,    5,   40,   41,   42,   43,
+        5,    5,   27,   28,    5,   29,    5,   30,   31,   32,
+        5,   33,   34,   35,   36,    5,    5,    5,   37,    5,
+       38,   39,   40,    5,   41,    5,   42,   43,   44,   45,
 
-       44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,    5,   56,   57,   58,   59,   60,   61,    5,
-       62,    5,   63,    5,   64,    5,    5,    5,    5,    5,
+       46,   47,   48,   49,   50,   51,   52,   53,   54,   55,
+       56,   57,    5,   58,   59,   60,   61,   62,   63,    5,
+       64,   65,   66,    5,   67,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -606,362 +610,199 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[65] =
+static const YY_CHAR yy_meta[68] =
     {   0,
         1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
         3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
         5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
-        5,    5,    5,    5,    5,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3
+        3,    5,    5,    5,    5,    5,    5,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3
     } ;
 
-static const flex_int16_t yy_base[348] =
+static const flex_int16_t yy_base[389] =
     {   0,
-        0,    0,   63,   66,   69,    0,   67,   71,   52,   68,
-      296, 2262,   87,  289,  133,    0,   96, 2262,  130,  133,
-       84,  150, 2262,  268,  109,   69,   67,   72, 2262, 2262,
-      110,   71,   97, 2262, 2262, 2262,   97,  271,  229,    0,
-      235,  139,  247,  132,  194, 2262,  200,  206,  212,  218,
-      224,  227,  250,  256,  268,  275,  288,  305,  313,  329,
-      335,  345,  351,  359,  374,    0,  375,  390,  312,  398,
-      393, 2262,    0, 2262,  220,  230,  128,  165,  163,  177,
-      214,  164, 2262,  196,  226, 2262,  148, 2262,  380,  426,
-      442,  448,  455,  464,  211,  472,  506,  487,  481,  501,
-
-      534,  551,  557,  563,  572,  584,  590,  596,  604,  613,
-      622,  628,  637,  650,    0,  240,  247,  127,  246,  267,
-      185,  160, 2262,    0,  666,  679,  688,  698,  704,  198,
-     2262,  728,  711,  721,  727,  754,  773,  760,  779,  786,
-      793,  799,  805,  811,  826,  832,  838,  849,  855,  864,
-      295, 2262, 2262,  315, 2262, 2262,  113,    0,  882,  870,
-      910, 2262, 2262,  945,  919,  925,  936,  942,  975,  990,
-      999, 1005, 1012, 1018, 1032, 1038, 1044, 1055, 1065, 1071,
-     1083, 1093, 2262, 2262,  120,    0, 1104, 1110, 1116, 2262,
-     1123, 1163, 1132, 1155, 1162, 1194, 1209, 1217, 1223, 1231,
-
-     1238, 1255, 2262, 1263, 1278, 1284, 2262, 1292, 1300, 1306,
-     1322,  115,    0, 2262, 2262, 1329, 1338, 1344, 1350, 1359,
-     1368, 1387, 1405, 1412, 1419, 1425, 1431, 1444, 1452, 1464,
-     1470, 1481, 1489, 1496, 2262, 1507, 1514, 1521, 1528, 1535,
-     1547, 1553, 1560, 1572, 1580, 1590, 1598, 1604, 1617, 2262,
-     1627, 1636, 2262, 1642, 1649, 1656, 2262, 1664, 1681, 1688,
-     1694, 1704, 1721, 1732, 1743, 1749, 2262, 1759, 1765, 1771,
-     1781, 1788, 1803, 2262, 1809, 1826, 1832, 1841, 1847, 1853,
-     2262, 1864, 2262, 1870, 1885, 1879, 1892, 2262, 1903, 2262,
-     1909, 1917, 1930, 1941, 1947, 1954, 1962, 1968, 1979, 1987,
-
-     2262, 2000, 2262, 2006, 2012, 2027, 2044, 2262, 2262, 2052,
-     2059, 2065, 2071, 2262, 2077, 2262, 2084, 2091, 2103, 2109,
-     2262, 2117, 2262, 2262, 2128, 2262, 2135, 2141, 2147, 2262,
-     2156, 2165, 2174, 2262, 2262, 2223, 2228, 2233, 2238, 2243,
-     2248, 2253, 2256,  146,  132,   91,   88
+        0,    0,   66,   69,   72,    0,   70,   74,   55,   71,
+      703,  704,   90,  699,  139,    0,  195,  704,  200,  203,
+       87,  215,  704,  681,  100,   75,   65,   70,  704,  704,
+       83,   70,   75,  704,  704,  704,  132,  687,  644,    0,
+      679,  133,  694,  215,  240,  704,  186,  647,  174,  639,
+      199,  199,  264,  641,  192,  637,  636,  634,  644,  633,
+      182,  627,  631,  640,  639,  212,    0,  290,  298,  244,
+      314,  302,  704,    0,  704,  236,  251,   70,  210,  196,
+      219,  249,  248,  704,  640,  677,  704,  282,  704,  325,
+      278,  638,  289,  633,  300,  302,  674,    0,  373,  631,
+
+      623,  634,  628,  616,  616,  614,  661,  607,  622,  615,
+      610,  607,  608,  603,  291,  614,    0,  303,  312,  248,
+      308,  317,  315,  610,  704,    0,  329,  605,  319,  613,
+      654,  653,  652,  704,  407,  601,  597,  594,  608,  642,
+      589,  591,  608,  638,  600,  601,  635,  588,  584,  597,
+      584,  595,  592,  327,  704,  704,  329,  704,  704,  578,
+        0,  318,  366,  632,  587,  704,  704,  441,  578,  624,
+      586,  574,  343,  590,  576,  585,  574,  582,  621,  309,
+      565,  619,  566,  577,  564,  610,  704,  704,  575,    0,
+      341,  613,  612,  572,  704,  561,  475,  565,  569,  560,
+
+      552,  553,  564,  552,  550,  565,  561,  563,  546,  704,
+      547,  544,  541,  704,  541,  539,  548,  545,  550,    0,
+      589,  704,  704,  539,  545,  532,  535,  544,  578,  532,
+      529,  541,  540,  530,  525,  528,  522,  522,  523,  239,
+      532,  571,  516,  529,  704,  704,  515,  567,  523,  517,
+      508,  526,  508,  505,  524,  554,  518,  517,  516,  555,
+      506,  499,  704,  502,  546,  704,  492,  485,  530,  704,
+      480,  487,  470,  465,  458,  467,  452,  466,  504,  450,
+      502,  704,  465,  450,  448,  459,  497,  443,  704,  489,
+      444,  440,  432,  438,  423,  434,  434,  704,  419,  704,
+
+      417,  432,  415,  429,  704,  467,  704,  417,  465,  411,
+      413,  332,  457,  406,  454,  453,  402,  398,  392,  704,
+      387,  704,  439,  391,  383,  436,   70,  382,  704,  704,
+      387,  383,  379,  431,  704,  430,  385,  704,  392,  378,
+      420,  419,  369,  408,  704,  704,  359,  352,  353,  704,
+      704,  351,  704,  363,  364,  361,  400,  347,  352,  351,
+      704,  331,  373,  334,  317,  310,  304,  352,  305,  341,
+      704,  221,  704,  235,  273,  704,  704,  522,  527,  532,
+      537,  542,  547,  550,  269,  229,  124,   88
     } ;
 
-static const flex_int16_t yy_def[348] =
+static const flex_int16_t yy_def[389] =
     {   0,
-      335,    1,  336,  336,    1,    5,    5,    5,    5,    5,
-      335,  335,  335,  335,  337,  338,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  339,
-      335,  335,  335,  340,  337,  335,  337,  337,  337,  337,
-      337,  341,  337,  337,  337,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,  338,  335,  335,  335,  335,
-      335,  335,  342,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  339,  335,  340,  335,  335,  337,
-      337,  337,  337,  337,  343,  337,  341,  337,  337,  337,
-
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  342,  335,  335,  335,  335,  335,
-      335,  335,  335,  344,  337,  337,  337,  337,  337,  343,
-      335,  341,  337,  337,  337,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
-      335,  335,  335,  335,  335,  335,  335,  345,  337,  337,
-      337,  335,  335,  341,  337,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
-      337,  337,  335,  335,  335,  346,  337,  337,  337,  335,
-      337,  341,  337,  337,  337,  337,  337,  337,  337,  337,
-
-      337,  337,  335,  337,  337,  337,  335,  337,  337,  337,
-      337,  335,  347,  335,  335,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  335,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  335,
-      337,  337,  335,  337,  337,  337,  335,  337,  337,  337,
-      337,  337,  337,  337,  337,  337,  335,  337,  337,  337,
-      337,  337,  337,  335,  337,  337,  337,  337,  337,  337,
-      335,  337,  335,  337,  337,  337,  337,  335,  337,  335,
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
-
-      335,  337,  335,  337,  337,  337,  337,  335,  335,  337,
-      337,  337,  337,  335,  337,  335,  337,  337,  337,  337,
-      335,  337,  335,  335,  337,  335,  337,  337,  337,  335,
-      337,  337,  337,  335,    0,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335
+      377,    1,  378,  378,    1,    5,    5,    5,    5,    5,
+      377,  377,  377,  377,  377,  379,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  380,
+      377,  377,  377,  381,   15,  377,   45,   45,   45,   45,
+       45,   45,  382,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  379,  377,  377,  377,
+      377,  377,  377,  383,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  380,  377,  381,  377,  377,
+       45,   45,   45,   45,   45,   45,  384,   45,  382,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  383,  377,  377,  377,
+      377,  377,  377,  377,  377,  385,   45,   45,   45,   45,
+       45,   45,  384,  377,  382,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,  377,  377,  377,  377,  377,  377,  377,
+      386,   45,   45,   45,   45,  377,  377,  382,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  377,  377,  377,  387,
+       45,   45,   45,   45,  377,   45,  382,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  377,
+       45,   45,   45,  377,   45,   45,   45,   45,  377,  388,
+       45,  377,  377,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,  377,  377,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  377,   45,   45,  377,   45,   45,   45,  377,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,  377,   45,   45,   45,   45,   45,   45,  377,   45,
+       45,   45,   45,   45,   45,   45,   45,  377,   45,  377,
+
+       45,   45,   45,   45,  377,   45,  377,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  377,
+       45,  377,   45,   45,   45,   45,   45,   45,  377,  377,
+       45,   45,   45,   45,  377,   45,   45,  377,   45,   45,
+       45,   45,   45,   45,  377,  377,   45,   45,   45,  377,
+      377,   45,  377,   45,   45,   45,   45,   45,   45,   45,
+      377,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+      377,   45,  377,   45,   45,  377,    0,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377
     } ;
 
-static const flex_int16_t yy_nxt[2327] =
+static const flex_int16_t yy_nxt[772] =
     {   0,
        12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
        19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
-       12,   12,   12,   12,   25,   26,   12,   12,   27,   12,
-       12,   12,   12,   28,   12,   29,   12,   30,   12,   12,
-       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
-       12,   12,   32,   12,   12,   12,   12,   33,   12,   12,
-       12,   12,   34,   35,   37,   14,   37,   37,   14,   37,
-       38,   41,   40,   38,   12,   12,   40,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   12,   41,   42,   77,
-       42,   72,   87,   12,   12,  213,   73,   12,   42,   12,
-
-       42,   78,   12,   79,   12,   78,   12,   67,   77,   68,
-       68,   68,   12,   12,   12,   12,   39,   75,   12,   75,
-       69,   12,   76,   76,   76,   78,   12,   79,   79,   81,
-       77,   12,   12,   44,   44,   44,  186,   88,   46,   69,
-       42,   67,   42,   70,   70,   70,   71,   71,   71,   80,
-      158,  153,   82,   88,   69,  116,   47,   69,  235,   48,
-       49,   67,  212,   70,   70,   70,   50,   51,   89,   52,
-      153,  185,   53,   69,   69,   54,   69,   55,  116,   56,
-       57,   48,   58,   59,   89,   60,   61,   62,   63,   64,
-       65,   51,  117,   69,   44,   44,   44,  118,  118,   46,
-
-       44,   44,   44,  131,  116,   46,   44,   44,   44,  153,
-      157,   46,   44,   44,   44,  117,  131,   46,   44,   44,
-       44,  118,  121,   46,   44,   44,   44,  119,  156,   46,
-       52,  123,   96,   76,   76,   76,   52,  122,   91,   45,
-       93,  117,   52,   76,   76,   76,   90,   94,   52,   43,
-       44,   44,   44,   86,   52,   46,   44,   44,   44,   93,
-       52,   46,   91,   45,  120,   92,   94,   45,   44,   44,
-       44,   45,  151,   46,  152,   44,   44,   44,  151,   45,
-       46,   84,   45,   83,   45,   97,   52,   74,   44,   44,
-       44,   43,   52,   46,  152,  335,  151,  152,   99,  100,
-
-       98,  335,  154,  101,   52,   44,   44,   44,  102,  335,
-       46,   52,  335,   44,   44,   44,  335,  155,   46,  183,
-       75,  103,   75,  335,   52,   76,   76,   76,  104,   44,
-       44,   44,  335,  335,   46,   44,   44,   44,  183,  183,
-       46,   52,  105,  335,  335,   44,   44,   44,  106,   52,
-       46,   44,   44,   44,  335,  335,   46,  335,  184,   44,
-       44,   44,  335,  335,   46,   52,  107,  335,  108,  335,
-      109,   52,  335,  335,   44,   44,   44,  335,  335,   46,
-      335,   52,  335,  335,  335,   87,  335,   52,   71,   71,
-       71,  335,   87,  110,  112,   52,   93,  335,  111,   69,
-
-      335,   67,  113,   68,   68,   68,   71,   71,   71,   67,
-       52,   70,   70,   70,   69,   93,   87,   69,   69,  335,
-       87,  335,   69,  335,   87,  335,   44,   44,   44,  335,
-      114,   46,   87,   69,  335,   87,   69,   87,  124,  335,
-      335,   69,   44,   44,   44,  335,  335,   46,   44,   44,
-       44,  335,  335,   46,  335,   44,   44,   44,  335,  335,
-       46,  335,   52,  335,   44,   44,   44,  125,  335,   46,
-      335,  126,   44,   44,   44,  335,  335,   46,   52,  335,
-      335,   44,   44,   44,   52,  128,   46,   44,   44,   44,
-      335,   52,   46,  127,  129,  126,  335,  335,  335,  335,
-
-       52,   44,   44,   44,  335,  335,   46,  335,   52,  128,
-      335,  335,  335,  335,  335,  335,  335,   52,  129,  132,
-      132,  132,  335,   52,  335,  335,  132,  132,  132,  132,
-      132,  132,  133,  134,   44,   44,   44,   52,  335,   46,
-      335,  135,  335,  335,  335,  132,  132,  132,  132,  132,
-      132,   44,   44,   44,  335,  335,   46,   44,   44,   44,
-      335,  335,   46,   44,   44,   44,  335,  335,   46,  335,
-       52,  335,   44,   44,   44,  335,  335,   46,  335,  136,
-      335,  335,  140,  335,   44,   44,   44,   52,  335,   46,
-       44,   44,   44,   52,  335,   46,   44,   44,   44,   52,
-
-      335,   46,  335,  335,   44,   44,   44,  137,   52,   46,
-      335,  335,  138,   44,   44,   44,  335,  335,   46,  139,
-       52,  335,   44,   44,   44,  335,   52,   46,   44,   44,
-       44,  335,   52,   46,  335,  142,  335,   44,   44,   44,
-       52,  335,   46,  335,  335,  141,  335,  143,  335,   52,
-       44,   44,   44,  335,  335,   46,  335,  335,   52,  144,
-      335,  335,  335,  335,   52,  335,   44,   44,   44,  335,
-      145,   46,  335,   52,  335,  335,  335,  146,  148,   44,
-       44,   44,  335,  335,   46,  335,   52,  147,   44,   44,
-       44,  335,  335,   46,  335,  335,  149,  150,   44,   44,
-
-       44,  335,   52,  162,   44,   44,   44,  160,  335,  163,
-      335,   44,   44,   44,  335,   52,   46,  335,  335,  335,
-      159,   44,   44,   44,   52,  335,   46,   44,   44,   44,
-      335,  160,   46,  161,   52,  335,  335,  335,  335,  335,
-       52,  164,  164,  164,  335,  335,  335,   52,  164,  164,
-      164,  164,  164,  164,   44,   44,   44,   52,  335,   46,
-       44,   44,   44,   52,  165,   46,  335,  164,  164,  164,
-      164,  164,  164,   44,   44,   44,  335,  166,   46,   44,
-       44,   44,  335,  169,   46,  167,   44,   44,   44,  335,
-       52,   46,  335,   44,   44,   44,   52,  168,   46,   44,
-
-       44,   44,  335,  173,   46,   44,   44,   44,  335,   52,
-       46,   44,   44,   44,  335,   52,   46,  335,  335,  335,
-      170,  176,   52,  335,  335,  172,   44,   44,   44,   52,
-      335,   46,   44,   44,   44,   52,  171,   46,   44,   44,
-       44,   52,  335,   46,  174,  335,  335,   52,  175,   44,
-       44,   44,  335,  335,   46,   44,   44,   44,  335,  335,
-       46,  335,   52,  335,   44,   44,   44,  335,   52,   46,
-       44,   44,   44,  335,   52,  190,  335,  335,  335,  335,
-      177,  179,   44,   44,   44,   52,  335,   46,  335,  178,
-      335,   52,  335,  335,  335,  335,  187,  188,  181,  335,
-
-       52,  335,  335,  335,  180,  189,   52,  335,  335,  182,
-       44,   44,   44,  335,  335,   46,  335,  335,   52,   44,
-       44,   44,  335,  335,   46,   44,   44,   44,  335,  335,
-       46,  335,  335,  335,  335,  194,   44,   44,   44,  335,
-      335,   46,   44,   44,   44,  335,   52,   46,  335,  335,
-      335,  335,  335,  335,  335,   52,  335,  191,  192,  192,
-      192,   52,  335,  335,  335,  192,  192,  192,  192,  192,
-      192,  335,   52,  335,  193,   44,   44,   44,   52,  335,
-       46,  195,  335,  335,  192,  192,  192,  192,  192,  192,
-       44,   44,   44,  335,  335,   46,  335,  335,  196,   44,
-
-       44,   44,  335,  335,   46,   44,   44,   44,  335,  335,
-       46,   52,   44,   44,   44,  335,  335,   46,   44,   44,
-       44,  335,  335,   46,  335,  335,   52,  335,  335,  198,
-      335,  197,   44,   44,   44,   52,  335,  203,   44,   44,
-       44,   52,  335,   46,   44,   44,   44,  200,   52,   46,
-      335,  199,  335,  335,   52,   44,   44,   44,  335,  335,
-      207,  202,  335,  335,  201,   44,   44,   44,   52,  335,
-       46,   44,   44,   44,   52,  335,   46,  335,  335,  335,
-       52,  335,  204,   44,   44,   44,  335,  335,   46,  335,
-      335,   52,  205,   44,   44,   44,  335,  335,   46,  335,
-
-      335,   52,  206,  211,   44,   44,   44,   52,  335,  214,
-       44,   44,   44,  335,  209,  215,   44,   44,   44,   52,
-      208,   46,  335,   44,   44,   44,  335,  335,   46,   52,
-      335,  335,   44,   44,   44,  335,  335,   46,  210,  335,
-       52,  335,  335,  335,  335,  335,   52,  335,  335,  335,
-      335,  335,   52,  335,  335,   44,   44,   44,  216,   52,
-       46,  335,   44,   44,   44,  335,  335,   46,   52,  335,
-      335,  335,  335,  335,  335,  217,   45,   45,   45,  218,
-      335,  335,  335,   45,   45,   45,   45,   45,   45,  335,
-      335,   52,  335,  335,   44,   44,   44,  219,   52,   46,
-
-      335,  335,   45,   45,   45,   45,   45,   45,  335,   44,
-       44,   44,  220,  335,   46,  335,  335,   44,   44,   44,
-      335,  335,   46,   44,   44,   44,  335,  335,   46,  335,
-       52,   44,   44,   44,  335,  335,   46,  335,   44,   44,
-       44,  335,  335,   46,  335,   52,  335,  335,  335,  335,
-      335,  221,  222,   52,  335,   44,   44,   44,  335,   52,
-       46,  335,  224,   44,   44,   44,  335,   52,   46,  335,
-      335,  335,  223,  225,   52,  335,  335,  226,   44,   44,
-       44,  335,  335,   46,   44,   44,   44,  335,  335,   46,
-      335,   52,   44,   44,   44,  335,  335,   46,  335,   52,
-
-       44,   44,   44,  335,  335,   46,   44,   44,   44,  335,
-      227,   46,  335,  335,   52,  335,  228,  335,  335,  335,
-       52,  335,   44,   44,   44,  335,  335,   46,   52,   44,
-       44,   44,  335,  229,   46,  335,   52,  335,   44,   44,
-       44,  230,   52,   46,   44,   44,   44,  335,  231,   46,
-       44,   44,   44,  233,  335,   46,  335,  232,   52,   44,
-       44,   44,  335,  335,   46,   52,  335,  335,   44,   44,
-       44,  234,  335,   46,   52,  335,  335,  335,  241,  335,
-       52,  236,  335,  237,  335,  335,   52,   44,   44,   44,
-      335,  335,   46,  335,  335,   52,  335,  335,  335,  335,
-
-      335,  238,  240,  239,   52,   44,   44,   44,  335,  335,
-       46,  335,   44,   44,   44,  335,  335,   46,  335,   44,
-       44,   44,  335,   52,   46,   44,   44,   44,  335,  335,
-       46,   44,   44,   44,  335,  335,   46,  335,  335,  335,
-      335,   52,  242,  335,   44,   44,   44,  243,   52,   46,
-      335,  335,   44,   44,   44,   52,  335,   46,  335,  335,
-      335,   52,  335,  244,   44,   44,   44,   52,  335,  250,
-       44,   44,   44,  335,  245,   46,  246,  335,  335,  335,
-       52,   44,   44,   44,  335,  335,  253,  247,   52,   44,
-       44,   44,  335,  335,   46,  335,   44,   44,   44,  248,
-
-       52,   46,  251,  335,  335,  249,   52,   44,   44,   44,
-      335,  335,   46,  252,   44,   44,   44,   52,  335,  257,
-      335,   44,   44,   44,  335,   52,   46,  335,   44,   44,
-       44,  335,   52,   46,  335,   44,   44,   44,  335,  255,
-       46,  335,  335,   52,  335,  335,  254,   44,   44,   44,
-       52,  335,   46,   44,   44,   44,  335,   52,   46,  335,
-       44,   44,   44,  256,   52,   46,  335,  258,  335,  335,
-      263,   52,   44,   44,   44,  335,  335,   46,  335,  259,
-       44,   44,   44,   52,  335,   46,  335,  261,  335,   52,
-       44,   44,   44,  335,  260,   46,   52,  335,   44,   44,
-
-       44,  335,  335,  267,   44,   44,   44,  335,   52,   46,
-      335,  335,  262,  335,  335,  264,   52,   44,   44,   44,
-      335,  335,   46,  265,  335,  335,   52,   44,   44,   44,
-      335,  335,   46,  266,   52,  335,   44,   44,   44,  335,
-       52,   46,   44,   44,   44,  335,  271,   46,  335,   44,
-       44,   44,  335,   52,   46,  268,   44,   44,   44,  335,
-      335,  274,  335,   52,   44,   44,   44,  335,  335,   46,
-      335,  335,   52,  335,  269,  335,  335,  335,   52,  335,
-      270,   44,   44,   44,  335,   52,   46,  335,   44,   44,
-       44,  335,   52,   46,   44,   44,   44,  335,  335,   46,
-
-       52,  335,  335,  272,   44,   44,   44,  335,  335,   46,
-      273,  335,  335,  335,  335,  275,  335,   52,  335,  335,
-      276,   44,   44,   44,   52,  335,   46,  335,  335,  335,
-       52,  277,   44,   44,   44,  335,  335,  281,  335,  335,
-       52,  278,  335,   44,   44,   44,  335,  279,   46,   44,
-       44,   44,  335,  335,  283,  335,  335,   52,  335,   44,
-       44,   44,  335,  280,   46,   44,   44,   44,   52,  335,
-       46,   44,   44,   44,  335,  335,   46,  335,  335,   52,
-      335,   44,   44,   44,  335,   52,   46,  335,   44,   44,
-       44,  335,  335,  288,  335,   52,  335,  335,  284,  282,
-
-      335,   52,  335,   44,   44,   44,  335,   52,   46,   44,
-       44,   44,  335,  335,  290,  335,  335,   52,  285,  335,
-      335,  335,  335,  287,   52,  286,   44,   44,   44,  335,
-      335,   46,   44,   44,   44,  335,  335,   46,  335,   52,
-      335,   44,   44,   44,  335,   52,   46,   44,   44,   44,
-      335,  335,   46,   44,   44,   44,  335,  335,   46,  289,
-      335,  335,   52,  335,   44,   44,   44,  335,   52,   46,
-       44,   44,   44,  291,  335,   46,  335,   52,  335,   44,
-       44,   44,  292,   52,   46,   44,   44,   44,  335,   52,
-       46,  335,   44,   44,   44,  295,  335,   46,  293,  335,
-
-       52,  335,  294,   44,   44,   44,   52,  335,  301,   44,
-       44,   44,  335,  335,   46,   52,  335,   44,   44,   44,
-      296,   52,  303,  335,  335,  335,  298,  297,   52,  335,
-       44,   44,   44,  335,  300,   46,  299,  335,  335,   52,
-      335,   44,   44,   44,  335,   52,   46,   44,   44,   44,
-      335,  305,   46,   52,   44,   44,   44,  335,  335,  308,
-      335,  302,   44,   44,   44,  335,   52,  309,   44,   44,
-       44,  335,  335,   46,  335,  335,  335,   52,  335,   44,
-       44,   44,  335,   52,   46,  335,  304,   44,   44,   44,
-       52,  335,   46,  335,  335,  335,  335,  306,   52,  307,
-
-       44,   44,   44,  335,   52,   46,   44,   44,   44,  335,
-      335,  314,   44,   44,   44,   52,  335,   46,  335,  335,
-      335,  310,  335,   52,  335,  335,  311,   44,   44,   44,
-      335,  335,  316,  335,  335,  335,   52,  335,  335,  312,
-      335,  335,   52,  335,   44,   44,   44,  335,   52,   46,
-      335,  335,   44,   44,   44,  335,  313,   46,  335,   44,
-       44,   44,  335,   52,   46,   44,   44,   44,  335,  315,
-       46,   44,   44,   44,  335,  335,  321,   44,   44,   44,
-       52,  335,   46,  335,   44,   44,   44,  335,   52,  323,
-      335,   44,   44,   44,  335,   52,  324,  335,  335,  335,
-
-      317,   52,  318,   44,   44,   44,  335,   52,   46,   44,
-       44,   44,  319,   52,  326,  335,  335,   44,   44,   44,
-       52,  320,   46,  335,  322,  335,  335,   52,   44,   44,
-       44,  335,  335,   46,  335,   44,   44,   44,  335,   52,
-       46,   44,   44,   44,  335,   52,  330,   44,   44,   44,
-      335,  335,   46,   52,  335,  325,   44,   44,   44,  335,
-      335,   46,  335,  335,   52,   44,   44,   44,  327,  335,
-       46,   52,  335,  335,   44,   44,   44,   52,  329,  334,
-      335,  335,  335,   52,  328,  335,  335,  335,  335,  335,
-      335,  335,   52,  335,  335,  335,  335,  335,  335,  335,
-
-      331,   52,  335,  335,  335,  335,  335,  335,  335,  335,
-       52,  335,  335,  335,  332,  335,  335,  335,  335,  335,
-      335,  335,  333,   36,   36,   36,   36,   36,   45,   45,
-       45,   45,   45,   66,  335,   66,   66,   66,   85,  335,
-       85,  335,   85,   87,   87,   87,   87,   87,   95,   95,
-       95,   95,   95,  115,  335,  115,  115,  115,  130,  130,
-      130,   11,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335
+       12,   12,   12,   12,   25,   26,   12,   12,   12,   27,
+       12,   12,   12,   12,   28,   12,   12,   29,   12,   30,
+       12,   12,   12,   12,   12,   25,   31,   12,   12,   12,
+       12,   12,   12,   12,   32,   12,   12,   12,   12,   33,
+       12,   12,   12,   12,   12,   34,   35,   37,   14,   37,
+       37,   14,   37,   38,   41,   40,   38,   12,   12,   40,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       41,   42,   88,   42,   73,   78,   12,   12,  118,   74,
+
+       79,   12,   80,   78,   12,   79,   12,   80,   76,   12,
+       76,   12,  339,   77,   77,   77,   78,   12,   12,   12,
+       12,   39,  118,   12,   81,   79,   12,   80,  220,  340,
+       82,   12,   83,   42,   42,   42,   42,   12,   12,   44,
+       44,   44,   45,   45,   46,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       47,   45,   48,   45,   45,   45,   49,   50,   45,   45,
+       45,   45,   45,   51,   52,   45,   45,   53,   45,   45,
+       54,   47,   45,   55,   45,   56,   45,   57,   58,   49,
+       59,   60,   45,   61,   62,   63,   64,   65,   66,   52,
+
+       45,   45,   45,   45,   45,   45,   68,   93,   69,   69,
+       69,   68,   91,   71,   71,   71,   72,   72,   72,   70,
+       89,   95,   96,  110,   70,  111,   68,   70,   71,   71,
+       71,  120,   93,  190,   95,   91,  101,  102,  119,   70,
+       70,  103,   95,   96,  263,   70,  104,  118,   70,   77,
+       77,   77,   76,   90,   76,   95,  120,   77,   77,   77,
+       70,   45,  119,   45,   77,   77,   77,   45,   45,   98,
+      116,  121,  156,  161,   45,   45,   45,  119,  376,  264,
+      375,   45,   45,  120,   45,  374,   45,   89,   45,   45,
+       45,   45,   45,  156,   45,   45,   45,   45,   45,   45,
+
+       45,  122,   45,   72,   72,   72,   45,  127,  123,   68,
+       45,   69,   69,   69,   70,   72,   72,   72,   45,  129,
+       90,   45,   70,   45,   99,   68,   70,   71,   71,   71,
+       88,  131,  127,  132,  151,   70,  154,   88,   70,  156,
+      155,  154,  325,   70,  129,  155,  373,   70,  164,  162,
+      191,  187,  152,  187,  372,  211,  131,  371,  132,   70,
+      159,  154,  370,   88,  155,  212,  157,   88,  369,  158,
+      162,   88,  187,  164,  188,  191,  368,  221,  367,   88,
+      192,  193,   88,  366,   88,  126,  135,  135,  135,  194,
+      326,  365,  364,  135,  135,  135,  135,  135,  135,  202,
+
+      363,  203,  362,  204,  221,  361,  360,  359,  358,  357,
+      356,  355,  354,  353,  135,  135,  135,  135,  135,  135,
+      168,  168,  168,  352,  351,  350,  349,  168,  168,  168,
+      168,  168,  168,  348,  347,  346,  345,  344,  343,  342,
+      341,  338,  337,  336,  335,  334,  333,  332,  168,  168,
+      168,  168,  168,  168,  197,  197,  197,  331,  330,  329,
+      328,  197,  197,  197,  197,  197,  197,  327,  324,  323,
+      322,  321,  320,  319,  318,  317,  316,  315,  314,  313,
+      312,  311,  197,  197,  197,  197,  197,  197,   45,   45,
+       45,  310,  309,  308,  307,   45,   45,   45,   45,   45,
+
+       45,  306,  305,  304,  303,  302,  301,  300,  299,  298,
+      297,  296,  295,  294,  293,  292,   45,   45,   45,   45,
+       45,   45,   36,   36,   36,   36,   36,   67,  291,   67,
+       67,   67,   86,  290,   86,  289,   86,   88,   88,   88,
+       88,   88,   97,   97,   97,   97,   97,  117,  288,  117,
+      117,  117,  133,  133,  133,  287,  286,  285,  284,  283,
+      282,  281,  280,  279,  278,  277,  276,  275,  274,  273,
+      272,  271,  270,  269,  268,  267,  266,  265,  262,  261,
+      260,  259,  258,  257,  256,  255,  254,  253,  252,  251,
+      250,  249,  248,  247,  246,  245,  244,  243,  242,  241,
+
+      240,  239,  238,  237,  236,  235,  234,  233,  232,  231,
+      230,  229,  228,  227,  226,  225,  224,  223,  222,  219,
+      218,  217,  216,  215,  214,  213,  210,  209,  208,  207,
+      206,  205,  201,  200,  199,  198,  196,  195,  189,  186,
+      185,  184,  183,  182,  181,  180,  179,  178,  177,  176,
+      175,  174,  173,  172,  171,  170,  169,  134,  167,  166,
+      165,  163,  160,  153,  150,  149,  148,  147,  146,  145,
+      144,  143,  142,  141,  140,  139,  138,  137,  136,  134,
+      130,  128,  125,  124,  115,  114,  113,  112,  109,  108,
+      107,  106,  105,  100,   94,   92,   43,   87,   85,   84,
+
+       75,   43,  377,   11,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377
     } ;
 
-static const flex_int16_t yy_chk[2327] =
+static const flex_int16_t yy_chk[772] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -969,256 +810,85 @@ static const flex_int16_t yy_chk[2327] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    3,    3,    3,    4,    4,    4,
-        3,    9,    7,    4,    5,    5,    8,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,   10,   13,   26,
-       13,   21,  347,    5,    5,  346,   21,    5,   37,    9,
-
-       37,   27,    5,   28,    5,   32,    5,   17,   26,   17,
-       17,   17,    5,    5,    7,   10,    5,   25,    8,   25,
-       17,    5,   25,   25,   25,   27,    5,   28,   33,   32,
-       31,    5,    5,   15,   15,   15,  345,   44,   15,   17,
-       42,   19,   42,   19,   19,   19,   20,   20,   20,   31,
-      344,  118,   33,   87,   19,   77,   15,   20,  212,   15,
-       15,   22,  185,   22,   22,   22,   15,   15,   44,   15,
-      118,  157,   15,   19,   22,   15,   20,   15,   77,   15,
-       15,   15,   15,   15,   87,   15,   15,   15,   15,   15,
-       15,   15,   78,   22,   45,   45,   45,   79,   82,   45,
-
-       47,   47,   47,  130,   80,   47,   48,   48,   48,  121,
-      122,   48,   49,   49,   49,   78,   95,   49,   50,   50,
-       50,   79,   82,   50,   51,   51,   51,   80,  121,   51,
-       45,   85,   52,   75,   75,   75,   47,   84,   48,   52,
-       50,   81,   48,   76,   76,   76,   47,   51,   49,   43,
-       53,   53,   53,   41,   50,   53,   54,   54,   54,   50,
-       51,   54,   48,   52,   81,   49,   51,   52,   55,   55,
-       55,   52,  116,   55,  117,   56,   56,   56,  119,   52,
-       56,   39,   52,   38,   52,   52,   53,   24,   57,   57,
-       57,   14,   54,   57,  120,   11,  116,  117,   54,   54,
-
-       53,    0,  119,   54,   55,   58,   58,   58,   54,    0,
-       58,   56,    0,   59,   59,   59,    0,  120,   59,  151,
-       69,   55,   69,    0,   57,   69,   69,   69,   56,   60,
-       60,   60,    0,    0,   60,   61,   61,   61,  151,  154,
-       61,   58,   57,    0,    0,   62,   62,   62,   58,   59,
-       62,   63,   63,   63,    0,    0,   63,    0,  154,   64,
-       64,   64,    0,    0,   64,   60,   59,    0,   60,    0,
-       60,   61,    0,    0,   65,   65,   65,    0,    0,   65,
-        0,   62,    0,    0,    0,   89,    0,   63,   67,   67,
-       67,    0,   89,   61,   63,   64,   65,    0,   62,   67,
-
-        0,   68,   64,   68,   68,   68,   71,   71,   71,   70,
-       65,   70,   70,   70,   68,   65,   89,   71,   67,    0,
-       89,    0,   70,    0,   89,    0,   90,   90,   90,    0,
-       65,   90,   89,   68,    0,   89,   71,   89,   89,    0,
-        0,   70,   91,   91,   91,    0,    0,   91,   92,   92,
-       92,    0,    0,   92,    0,   93,   93,   93,    0,    0,
-       93,    0,   90,    0,   94,   94,   94,   90,    0,   94,
-        0,   91,   96,   96,   96,    0,    0,   96,   91,    0,
-        0,   99,   99,   99,   92,   93,   99,   98,   98,   98,
-        0,   93,   98,   92,   94,   91,    0,    0,    0,    0,
-
-       94,  100,  100,  100,    0,    0,  100,    0,   96,   93,
-        0,    0,    0,    0,    0,    0,    0,   99,   94,   97,
-       97,   97,    0,   98,    0,    0,   97,   97,   97,   97,
-       97,   97,   98,   99,  101,  101,  101,  100,    0,  101,
-        0,  100,    0,    0,    0,   97,   97,   97,   97,   97,
-       97,  102,  102,  102,    0,    0,  102,  103,  103,  103,
-        0,    0,  103,  104,  104,  104,    0,    0,  104,    0,
-      101,    0,  105,  105,  105,    0,    0,  105,    0,  101,
-        0,    0,  105,    0,  106,  106,  106,  102,    0,  106,
-      107,  107,  107,  103,    0,  107,  108,  108,  108,  104,
-
-        0,  108,    0,    0,  109,  109,  109,  102,  105,  109,
-        0,    0,  103,  110,  110,  110,    0,    0,  110,  104,
-      106,    0,  111,  111,  111,    0,  107,  111,  112,  112,
-      112,    0,  108,  112,    0,  107,    0,  113,  113,  113,
-      109,    0,  113,    0,    0,  106,    0,  108,    0,  110,
-      114,  114,  114,    0,    0,  114,    0,    0,  111,  109,
-        0,    0,    0,    0,  112,    0,  125,  125,  125,    0,
-      110,  125,    0,  113,    0,    0,    0,  111,  113,  126,
-      126,  126,    0,    0,  126,    0,  114,  112,  127,  127,
-      127,    0,    0,  127,    0,    0,  113,  114,  128,  128,
-
-      128,    0,  125,  128,  129,  129,  129,  126,    0,  129,
-        0,  133,  133,  133,    0,  126,  133,    0,    0,    0,
-      125,  134,  134,  134,  127,    0,  134,  135,  135,  135,
-        0,  126,  135,  127,  128,    0,    0,    0,    0,    0,
-      129,  132,  132,  132,    0,    0,    0,  133,  132,  132,
-      132,  132,  132,  132,  136,  136,  136,  134,    0,  136,
-      138,  138,  138,  135,  133,  138,    0,  132,  132,  132,
-      132,  132,  132,  137,  137,  137,    0,  134,  137,  139,
-      139,  139,    0,  137,  139,  135,  140,  140,  140,    0,
-      136,  140,    0,  141,  141,  141,  138,  136,  141,  142,
-
-      142,  142,    0,  141,  142,  143,  143,  143,    0,  137,
-      143,  144,  144,  144,    0,  139,  144,    0,    0,    0,
-      138,  144,  140,    0,    0,  140,  145,  145,  145,  141,
-        0,  145,  146,  146,  146,  142,  139,  146,  147,  147,
-      147,  143,    0,  147,  142,    0,    0,  144,  143,  148,
-      148,  148,    0,    0,  148,  149,  149,  149,    0,    0,
-      149,    0,  145,    0,  150,  150,  150,    0,  146,  150,
-      160,  160,  160,    0,  147,  160,    0,    0,    0,    0,
-      145,  147,  159,  159,  159,  148,    0,  159,    0,  146,
-        0,  149,    0,    0,    0,    0,  159,  159,  149,    0,
-
-      150,    0,    0,    0,  148,  159,  160,    0,    0,  150,
-      161,  161,  161,    0,    0,  161,    0,    0,  159,  165,
-      165,  165,    0,    0,  165,  166,  166,  166,    0,    0,
-      166,    0,    0,    0,    0,  166,  167,  167,  167,    0,
-        0,  167,  168,  168,  168,    0,  161,  168,    0,    0,
-        0,    0,    0,    0,    0,  165,    0,  161,  164,  164,
-      164,  166,    0,    0,    0,  164,  164,  164,  164,  164,
-      164,    0,  167,    0,  165,  169,  169,  169,  168,    0,
-      169,  167,    0,    0,  164,  164,  164,  164,  164,  164,
-      170,  170,  170,    0,    0,  170,    0,    0,  168,  171,
-
-      171,  171,    0,    0,  171,  172,  172,  172,    0,    0,
-      172,  169,  173,  173,  173,    0,    0,  173,  174,  174,
-      174,    0,    0,  174,    0,    0,  170,    0,    0,  170,
-        0,  169,  175,  175,  175,  171,    0,  175,  176,  176,
-      176,  172,    0,  176,  177,  177,  177,  172,  173,  177,
-        0,  171,    0,    0,  174,  178,  178,  178,    0,    0,
-      178,  174,    0,    0,  173,  179,  179,  179,  175,    0,
-      179,  180,  180,  180,  176,    0,  180,    0,    0,    0,
-      177,    0,  176,  181,  181,  181,    0,    0,  181,    0,
-        0,  178,  176,  182,  182,  182,    0,    0,  182,    0,
-
-        0,  179,  177,  182,  187,  187,  187,  180,    0,  187,
-      188,  188,  188,    0,  180,  188,  189,  189,  189,  181,
-      179,  189,    0,  191,  191,  191,    0,    0,  191,  182,
-        0,    0,  193,  193,  193,    0,    0,  193,  181,    0,
-      187,    0,    0,    0,    0,    0,  188,    0,    0,    0,
-        0,    0,  189,    0,    0,  194,  194,  194,  189,  191,
-      194,    0,  195,  195,  195,    0,    0,  195,  193,    0,
-        0,    0,    0,    0,    0,  191,  192,  192,  192,  193,
-        0,    0,    0,  192,  192,  192,  192,  192,  192,    0,
-        0,  194,    0,    0,  196,  196,  196,  194,  195,  196,
-
-        0,    0,  192,  192,  192,  192,  192,  192,    0,  197,
-      197,  197,  195,    0,  197,    0,    0,  198,  198,  198,
-        0,    0,  198,  199,  199,  199,    0,    0,  199,    0,
-      196,  200,  200,  200,    0,    0,  200,    0,  201,  201,
-      201,    0,    0,  201,    0,  197,    0,    0,    0,    0,
-        0,  196,  197,  198,    0,  202,  202,  202,    0,  199,
-      202,    0,  199,  204,  204,  204,    0,  200,  204,    0,
-        0,    0,  198,  200,  201,    0,    0,  201,  205,  205,
-      205,    0,    0,  205,  206,  206,  206,    0,    0,  206,
-        0,  202,  208,  208,  208,    0,    0,  208,    0,  204,
-
-      209,  209,  209,    0,    0,  209,  210,  210,  210,    0,
-      202,  210,    0,    0,  205,    0,  204,    0,    0,    0,
-      206,    0,  211,  211,  211,    0,    0,  211,  208,  216,
-      216,  216,    0,  205,  216,    0,  209,    0,  217,  217,
-      217,  206,  210,  217,  218,  218,  218,    0,  208,  218,
-      219,  219,  219,  210,    0,  219,    0,  209,  211,  220,
-      220,  220,    0,    0,  220,  216,    0,    0,  221,  221,
-      221,  211,    0,  221,  217,    0,    0,    0,  221,    0,
-      218,  216,    0,  217,    0,    0,  219,  222,  222,  222,
-        0,    0,  222,    0,    0,  220,    0,    0,    0,    0,
-
-        0,  218,  220,  219,  221,  223,  223,  223,    0,    0,
-      223,    0,  224,  224,  224,    0,    0,  224,    0,  225,
-      225,  225,    0,  222,  225,  226,  226,  226,    0,    0,
-      226,  227,  227,  227,    0,    0,  227,    0,    0,    0,
-        0,  223,  222,    0,  228,  228,  228,  223,  224,  228,
-        0,    0,  229,  229,  229,  225,    0,  229,    0,    0,
-        0,  226,    0,  224,  230,  230,  230,  227,    0,  230,
-      231,  231,  231,    0,  225,  231,  226,    0,    0,    0,
-      228,  232,  232,  232,    0,    0,  232,  227,  229,  233,
-      233,  233,    0,    0,  233,    0,  234,  234,  234,  228,
-
-      230,  234,  230,    0,    0,  229,  231,  236,  236,  236,
-        0,    0,  236,  231,  237,  237,  237,  232,    0,  237,
-        0,  238,  238,  238,    0,  233,  238,    0,  239,  239,
-      239,    0,  234,  239,    0,  240,  240,  240,    0,  234,
-      240,    0,    0,  236,    0,    0,  233,  241,  241,  241,
-      237,    0,  241,  242,  242,  242,    0,  238,  242,    0,
-      243,  243,  243,  236,  239,  243,    0,  238,    0,    0,
-      243,  240,  244,  244,  244,    0,    0,  244,    0,  239,
-      245,  245,  245,  241,    0,  245,    0,  241,    0,  242,
-      246,  246,  246,    0,  240,  246,  243,    0,  247,  247,
-
-      247,    0,    0,  247,  248,  248,  248,    0,  244,  248,
-        0,    0,  242,    0,    0,  244,  245,  249,  249,  249,
-        0,    0,  249,  245,    0,    0,  246,  251,  251,  251,
-        0,    0,  251,  246,  247,    0,  252,  252,  252,    0,
-      248,  252,  254,  254,  254,    0,  252,  254,    0,  255,
-      255,  255,    0,  249,  255,  248,  256,  256,  256,    0,
-        0,  256,    0,  251,  258,  258,  258,    0,    0,  258,
-        0,    0,  252,    0,  249,    0,    0,    0,  254,    0,
-      251,  259,  259,  259,    0,  255,  259,    0,  260,  260,
-      260,    0,  256,  260,  261,  261,  261,    0,    0,  261,
-
-      258,    0,    0,  254,  262,  262,  262,    0,    0,  262,
-      255,    0,    0,    0,    0,  258,    0,  259,    0,    0,
-      259,  263,  263,  263,  260,    0,  263,    0,    0,    0,
-      261,  260,  264,  264,  264,    0,    0,  264,    0,    0,
-      262,  261,    0,  265,  265,  265,    0,  262,  265,  266,
-      266,  266,    0,    0,  266,    0,    0,  263,    0,  268,
-      268,  268,    0,  263,  268,  269,  269,  269,  264,    0,
-      269,  270,  270,  270,    0,    0,  270,    0,    0,  265,
-        0,  271,  271,  271,    0,  266,  271,    0,  272,  272,
-      272,    0,    0,  272,    0,  268,    0,    0,  268,  265,
-
-        0,  269,    0,  273,  273,  273,    0,  270,  273,  275,
-      275,  275,    0,    0,  275,    0,    0,  271,  269,    0,
-        0,    0,    0,  271,  272,  270,  276,  276,  276,    0,
-        0,  276,  277,  277,  277,    0,    0,  277,    0,  273,
-        0,  278,  278,  278,    0,  275,  278,  279,  279,  279,
-        0,    0,  279,  280,  280,  280,    0,    0,  280,  273,
-        0,    0,  276,    0,  282,  282,  282,    0,  277,  282,
-      284,  284,  284,  276,    0,  284,    0,  278,    0,  286,
-      286,  286,  277,  279,  286,  285,  285,  285,    0,  280,
-      285,    0,  287,  287,  287,  280,    0,  287,  278,    0,
-
-      282,    0,  279,  289,  289,  289,  284,    0,  289,  291,
-      291,  291,    0,    0,  291,  286,    0,  292,  292,  292,
-      282,  285,  292,    0,    0,    0,  285,  284,  287,    0,
-      293,  293,  293,    0,  287,  293,  286,    0,    0,  289,
-        0,  294,  294,  294,    0,  291,  294,  295,  295,  295,
-        0,  294,  295,  292,  296,  296,  296,    0,    0,  296,
-        0,  291,  297,  297,  297,    0,  293,  297,  298,  298,
-      298,    0,    0,  298,    0,    0,    0,  294,    0,  299,
-      299,  299,    0,  295,  299,    0,  293,  300,  300,  300,
-      296,    0,  300,    0,    0,    0,    0,  294,  297,  295,
-
-      302,  302,  302,    0,  298,  302,  304,  304,  304,    0,
-        0,  304,  305,  305,  305,  299,    0,  305,    0,    0,
-        0,  298,    0,  300,    0,    0,  299,  306,  306,  306,
-        0,    0,  306,    0,    0,    0,  302,    0,    0,  300,
-        0,    0,  304,    0,  307,  307,  307,    0,  305,  307,
-        0,    0,  310,  310,  310,    0,  302,  310,    0,  311,
-      311,  311,    0,  306,  311,  312,  312,  312,    0,  305,
-      312,  313,  313,  313,    0,    0,  313,  315,  315,  315,
-      307,    0,  315,    0,  317,  317,  317,    0,  310,  317,
-        0,  318,  318,  318,    0,  311,  318,    0,    0,    0,
-
-      307,  312,  310,  319,  319,  319,    0,  313,  319,  320,
-      320,  320,  311,  315,  320,    0,    0,  322,  322,  322,
-      317,  312,  322,    0,  315,    0,    0,  318,  325,  325,
-      325,    0,    0,  325,    0,  327,  327,  327,    0,  319,
-      327,  328,  328,  328,    0,  320,  328,  329,  329,  329,
-        0,    0,  329,  322,    0,  319,  331,  331,  331,    0,
-        0,  331,    0,    0,  325,  332,  332,  332,  322,    0,
-      332,  327,    0,    0,  333,  333,  333,  328,  327,  333,
-        0,    0,    0,  329,  325,    0,    0,    0,    0,    0,
-        0,    0,  331,    0,    0,    0,    0,    0,    0,    0,
-
-      329,  332,    0,    0,    0,    0,    0,    0,    0,    0,
-      333,    0,    0,    0,  331,    0,    0,    0,    0,    0,
-        0,    0,  332,  336,  336,  336,  336,  336,  337,  337,
-      337,  337,  337,  338,    0,  338,  338,  338,  339,    0,
-      339,    0,  339,  340,  340,  340,  340,  340,  341,  341,
-      341,  341,  341,  342,    0,  342,  342,  342,  343,  343,
-      343,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  335,  335
+        1,    1,    1,    1,    1,    1,    1,    3,    3,    3,
+        4,    4,    4,    3,    9,    7,    4,    5,    5,    8,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       10,   13,  388,   13,   21,   26,    5,    5,   78,   21,
+
+       27,    5,   28,   31,    9,   32,    5,   33,   25,    5,
+       25,    5,  327,   25,   25,   25,   26,    5,    5,    7,
+       10,    5,   78,    8,   31,   27,    5,   28,  387,  327,
+       32,    5,   33,   37,   42,   37,   42,    5,    5,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   17,   49,   17,   17,
+       17,   19,   47,   19,   19,   19,   20,   20,   20,   17,
+       44,   51,   52,   61,   19,   61,   22,   20,   22,   22,
+       22,   80,   49,  386,   66,   47,   55,   55,   79,   22,
+       17,   55,   51,   52,  240,   19,   55,   81,   20,   76,
+       76,   76,   70,   44,   70,   66,   80,   70,   70,   70,
+       22,   45,   79,   45,   77,   77,   77,   45,   45,   53,
+       66,   81,  120,  385,   45,   45,   53,   82,  375,  240,
+      374,   45,   45,   83,   45,  372,   45,   88,   45,   45,
+       45,   45,   45,  120,   45,   45,   45,   45,   45,   45,
+
+       45,   82,   53,   68,   68,   68,   53,   91,   83,   69,
+       53,   69,   69,   69,   68,   72,   72,   72,   53,   93,
+       88,   53,   69,   53,   53,   71,   72,   71,   71,   71,
+       90,   95,   91,   96,  115,   68,  118,   90,   71,  123,
+      119,  121,  312,   69,   93,  122,  370,   72,  129,  127,
+      162,  154,  115,  157,  369,  180,   95,  368,   96,   71,
+      123,  118,  367,   90,  119,  180,  121,   90,  366,  122,
+      127,   90,  154,  129,  157,  162,  365,  191,  364,   90,
+      163,  163,   90,  363,   90,   90,   99,   99,   99,  163,
+      312,  362,  360,   99,   99,   99,   99,   99,   99,  173,
+
+      359,  173,  358,  173,  191,  357,  356,  355,  354,  352,
+      349,  348,  347,  344,   99,   99,   99,   99,   99,   99,
+      135,  135,  135,  343,  342,  341,  340,  135,  135,  135,
+      135,  135,  135,  339,  337,  336,  334,  333,  332,  331,
+      328,  326,  325,  324,  323,  321,  319,  318,  135,  135,
+      135,  135,  135,  135,  168,  168,  168,  317,  316,  315,
+      314,  168,  168,  168,  168,  168,  168,  313,  311,  310,
+      309,  308,  306,  304,  303,  302,  301,  299,  297,  296,
+      295,  294,  168,  168,  168,  168,  168,  168,  197,  197,
+      197,  293,  292,  291,  290,  197,  197,  197,  197,  197,
+
+      197,  288,  287,  286,  285,  284,  283,  281,  280,  279,
+      278,  277,  276,  275,  274,  273,  197,  197,  197,  197,
+      197,  197,  378,  378,  378,  378,  378,  379,  272,  379,
+      379,  379,  380,  271,  380,  269,  380,  381,  381,  381,
+      381,  381,  382,  382,  382,  382,  382,  383,  268,  383,
+      383,  383,  384,  384,  384,  267,  265,  264,  262,  261,
+      260,  259,  258,  257,  256,  255,  254,  253,  252,  251,
+      250,  249,  248,  247,  244,  243,  242,  241,  239,  238,
+      237,  236,  235,  234,  233,  232,  231,  230,  229,  228,
+      227,  226,  225,  224,  221,  219,  218,  217,  216,  215,
+
+      213,  212,  211,  209,  208,  207,  206,  205,  204,  203,
+      202,  201,  200,  199,  198,  196,  194,  193,  192,  189,
+      186,  185,  184,  183,  182,  181,  179,  178,  177,  176,
+      175,  174,  172,  171,  170,  169,  165,  164,  160,  153,
+      152,  151,  150,  149,  148,  147,  146,  145,  144,  143,
+      142,  141,  140,  139,  138,  137,  136,  133,  132,  131,
+      130,  128,  124,  116,  114,  113,  112,  111,  110,  109,
+      108,  107,  106,  105,  104,  103,  102,  101,  100,   97,
+       94,   92,   86,   85,   65,   64,   63,   62,   60,   59,
+       58,   57,   56,   54,   50,   48,   43,   41,   39,   38,
+
+       24,   14,   11,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
+      377
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1227,14 +897,15 @@ static char *yy_last_accepting_cpos;
 extern int d2_parser__flex_debug;
 int d2_parser__flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[58] =
+static const flex_int16_t yy_rule_linenum[62] =
     {   0,
       127,  129,  131,  136,  137,  142,  143,  144,  156,  159,
-      164,  170,  179,  190,  201,  210,  219,  228,  238,  248,
-      258,  267,  276,  286,  296,  306,  317,  326,  336,  346,
-      357,  366,  375,  384,  393,  406,  415,  424,  433,  443,
-      541,  546,  551,  556,  557,  558,  559,  560,  561,  563,
-      581,  594,  599,  603,  605,  607,  609
+      164,  170,  179,  190,  201,  210,  219,  228,  237,  246,
+      255,  266,  277,  287,  297,  306,  315,  325,  335,  345,
+      356,  365,  375,  385,  396,  405,  414,  423,  432,  445,
+      454,  463,  472,  482,  580,  585,  590,  595,  596,  597,
+      598,  599,  600,  602,  620,  633,  638,  642,  644,  646,
+      648
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1279,7 +950,7 @@ unsigned int comment_start_line = 0;
 
 // To avoid the call to exit... oops!
 #define YY_FATAL_ERROR(msg) isc::d2::D2ParserContext::fatal(msg)
-#line 1282 "d2_lexer.cc"
+#line 953 "d2_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1305,8 +976,8 @@ unsigned int comment_start_line = 0;
 // by moving it ahead by yyleng bytes. yyleng specifies the length of the
 // currently matched token.
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1308 "d2_lexer.cc"
-#line 1309 "d2_lexer.cc"
+#line 979 "d2_lexer.cc"
+#line 980 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1624,7 +1295,7 @@ YY_DECL
     }
 
 
-#line 1627 "d2_lexer.cc"
+#line 1298 "d2_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1653,13 +1324,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 336 )
+				if ( yy_current_state >= 378 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 335 );
+		while ( yy_current_state != 377 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1678,13 +1349,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 58 )
+			else if ( yy_act < 62 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], d2_parser_text );
-			else if ( yy_act == 58 )
+			else if ( yy_act == 62 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         d2_parser_text );
-			else if ( yy_act == 59 )
+			else if ( yy_act == 63 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1846,9 +1517,9 @@ YY_RULE_SETUP
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
-        return isc::d2::D2Parser::make_NCR_PROTOCOL(driver.loc_);
+        return isc::d2::D2Parser::make_DNS_UPDATE_THREADS(driver.loc_);
     default:
-        return isc::d2::D2Parser::make_STRING("ncr-protocol", driver.loc_);
+        return isc::d2::D2Parser::make_STRING("dns-update-threads", driver.loc_);
     }
 }
 	YY_BREAK
@@ -1858,18 +1529,55 @@ YY_RULE_SETUP
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
-        return isc::d2::D2Parser::make_NCR_FORMAT(driver.loc_);
+        return isc::d2::D2Parser::make_DNS_UPDATE_BATCH_SIZE(driver.loc_);
     default:
-        return isc::d2::D2Parser::make_STRING("ncr-format", driver.loc_);
+        return isc::d2::D2Parser::make_STRING("dns-update-batch-size", driver.loc_);
     }
 }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 228 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_DNS_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("dns-protocol", driver.loc_);
+    }
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+#line 237 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_NCR_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("ncr-protocol", driver.loc_);
+    }
+}
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+#line 246 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_NCR_FORMAT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("ncr-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+#line 255 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
+    if ((driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) ||
+        (driver.ctx_ == isc::d2::D2ParserContext::DNS_PROTOCOL)) {
         return isc::d2::D2Parser::make_UDP(driver.loc_);
     }
     std::string tmp(yytext+1);
@@ -1877,12 +1585,13 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 19:
+case 22:
 YY_RULE_SETUP
-#line 238 "d2_lexer.ll"
+#line 266 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
+    if ((driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) ||
+        (driver.ctx_ == isc::d2::D2ParserContext::DNS_PROTOCOL)) {
         return isc::d2::D2Parser::make_TCP(driver.loc_);
     }
     std::string tmp(yytext+1);
@@ -1890,9 +1599,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 20:
+case 23:
 YY_RULE_SETUP
-#line 248 "d2_lexer.ll"
+#line 277 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
@@ -1903,9 +1612,22 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 21:
+case 24:
 YY_RULE_SETUP
-#line 258 "d2_lexer.ll"
+#line 287 "d2_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+#line 297 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1915,9 +1637,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 22:
+case 26:
 YY_RULE_SETUP
-#line 267 "d2_lexer.ll"
+#line 306 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1927,9 +1649,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 23:
+case 27:
 YY_RULE_SETUP
-#line 276 "d2_lexer.ll"
+#line 315 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::FORWARD_DDNS:
@@ -1940,9 +1662,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 24:
+case 28:
 YY_RULE_SETUP
-#line 286 "d2_lexer.ll"
+#line 325 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1953,9 +1675,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 25:
+case 29:
 YY_RULE_SETUP
-#line 296 "d2_lexer.ll"
+#line 335 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1966,9 +1688,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 26:
+case 30:
 YY_RULE_SETUP
-#line 306 "d2_lexer.ll"
+#line 345 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DNS_SERVER:
@@ -1979,9 +1701,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 27:
+case 31:
 YY_RULE_SETUP
-#line 317 "d2_lexer.ll"
+#line 356 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1991,9 +1713,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 32:
 YY_RULE_SETUP
-#line 326 "d2_lexer.ll"
+#line 365 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -2004,9 +1726,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 33:
 YY_RULE_SETUP
-#line 336 "d2_lexer.ll"
+#line 375 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -2017,9 +1739,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 34:
 YY_RULE_SETUP
-#line 346 "d2_lexer.ll"
+#line 385 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -2030,9 +1752,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 35:
 YY_RULE_SETUP
-#line 357 "d2_lexer.ll"
+#line 396 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2042,9 +1764,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 36:
 YY_RULE_SETUP
-#line 366 "d2_lexer.ll"
+#line 405 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGING:
@@ -2054,9 +1776,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 37:
 YY_RULE_SETUP
-#line 375 "d2_lexer.ll"
+#line 414 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2066,9 +1788,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 38:
 YY_RULE_SETUP
-#line 384 "d2_lexer.ll"
+#line 423 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2078,9 +1800,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 39:
 YY_RULE_SETUP
-#line 393 "d2_lexer.ll"
+#line 432 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2094,9 +1816,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 40:
 YY_RULE_SETUP
-#line 406 "d2_lexer.ll"
+#line 445 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2106,9 +1828,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 41:
 YY_RULE_SETUP
-#line 415 "d2_lexer.ll"
+#line 454 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2118,9 +1840,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 42:
 YY_RULE_SETUP
-#line 424 "d2_lexer.ll"
+#line 463 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2130,9 +1852,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 43:
 YY_RULE_SETUP
-#line 433 "d2_lexer.ll"
+#line 472 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2142,9 +1864,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 44:
 YY_RULE_SETUP
-#line 443 "d2_lexer.ll"
+#line 482 "d2_lexer.ll"
 {
     // A string has been matched. It contains the actual string and single quotes.
     // We need to get those quotes out of the way and just use its content, e.g.
@@ -2243,65 +1965,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 41:
-/* rule 41 can match eol */
+case 45:
+/* rule 45 can match eol */
 YY_RULE_SETUP
-#line 541 "d2_lexer.ll"
+#line 580 "d2_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 42:
-/* rule 42 can match eol */
+case 46:
+/* rule 46 can match eol */
 YY_RULE_SETUP
-#line 546 "d2_lexer.ll"
+#line 585 "d2_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 43:
+case 47:
 YY_RULE_SETUP
-#line 551 "d2_lexer.ll"
+#line 590 "d2_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 44:
+case 48:
 YY_RULE_SETUP
-#line 556 "d2_lexer.ll"
+#line 595 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 45:
+case 49:
 YY_RULE_SETUP
-#line 557 "d2_lexer.ll"
+#line 596 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 46:
+case 50:
 YY_RULE_SETUP
-#line 558 "d2_lexer.ll"
+#line 597 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 47:
+case 51:
 YY_RULE_SETUP
-#line 559 "d2_lexer.ll"
+#line 598 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 48:
+case 52:
 YY_RULE_SETUP
-#line 560 "d2_lexer.ll"
+#line 599 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 49:
+case 53:
 YY_RULE_SETUP
-#line 561 "d2_lexer.ll"
+#line 600 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 50:
+case 54:
 YY_RULE_SETUP
-#line 563 "d2_lexer.ll"
+#line 602 "d2_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -2320,9 +2042,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 51:
+case 55:
 YY_RULE_SETUP
-#line 581 "d2_lexer.ll"
+#line 620 "d2_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -2336,43 +2058,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 594 "d2_lexer.ll"
+#line 633 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 599 "d2_lexer.ll"
+#line 638 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 603 "d2_lexer.ll"
+#line 642 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 605 "d2_lexer.ll"
+#line 644 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 607 "d2_lexer.ll"
+#line 646 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 609 "d2_lexer.ll"
+#line 648 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 611 "d2_lexer.ll"
+#line 650 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2396,12 +2118,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 634 "d2_lexer.ll"
+#line 673 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2404 "d2_lexer.cc"
+#line 2126 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2716,7 +2438,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 336 )
+			if ( yy_current_state >= 378 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2749,11 +2471,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 336 )
+		if ( yy_current_state >= 378 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 335);
+	yy_is_jam = (yy_current_state == 377);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3502,7 +3224,7 @@ void d2_parser_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 634 "d2_lexer.ll"
+#line 673 "d2_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -206,6 +206,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"dns-update-threads\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_DNS_UPDATE_THREADS(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("dns-update-threads", driver.loc_);
+    }
+}
+
+\"dns-update-batch-size\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_DNS_UPDATE_BATCH_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("dns-update-batch-size", driver.loc_);
+    }
+}
+
+\"dns-protocol\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_DNS_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("dns-protocol", driver.loc_);
+    }
+}
+
 \"ncr-protocol\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -226,7 +253,8 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
 
 (?i:\"UDP\") {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
+    if ((driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) ||
+        (driver.ctx_ == isc::d2::D2ParserContext::DNS_PROTOCOL)) {
         return isc::d2::D2Parser::make_UDP(driver.loc_);
     }
     std::string tmp(yytext+1);
@@ -236,7 +264,8 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
 
 (?i:\"TCP\") {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
+    if ((driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) ||
+        (driver.ctx_ == isc::d2::D2ParserContext::DNS_PROTOCOL)) {
         return isc::d2::D2Parser::make_TCP(driver.loc_);
     }
     std::string tmp(yytext+1);
@@ -254,6 +283,16 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 
+(?i:\"BINARY\") {
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+
 \"forward-ddns\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
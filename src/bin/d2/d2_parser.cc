@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   d2_parser_lex
 
-// First part of user declarations.
-
-#line 39 "d2_parser.cc" // lalr1.cc:404
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "d2_parser.h"
 
-// User implementation prologue.
 
-#line 53 "d2_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "d2_parser.yy" // lalr1.cc:413
+#line 34 "d2_parser.yy"
 
 #include <d2/parser_context.h>
 
-#line 59 "d2_parser.cc" // lalr1.cc:413
+#line 52 "d2_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if D2_PARSER_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !D2_PARSER_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !D2_PARSER_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "d2_parser.yy" // lalr1.cc:479
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 145 "d2_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  D2Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "d2_parser.cc"
 
   /// Build a parser object.
   D2Parser::D2Parser (isc::d2::D2ParserContext& ctx_yyarg)
-    :
 #if D2_PARSER_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace d2 {
   D2Parser::~D2Parser ()
   {}
 
+  D2Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  D2Parser::by_state::by_state ()
+  D2Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  D2Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  D2Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  D2Parser::by_state::clear ()
+  D2Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   D2Parser::by_state::move (by_state& that)
   {
@@ -227,51 +188,84 @@ namespace isc { namespace d2 {
     that.clear ();
   }
 
-  inline
-  D2Parser::by_state::by_state (state_type s)
+  D2Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  D2Parser::symbol_number_type
-  D2Parser::by_state::type_get () const
+  D2Parser::symbol_kind_type
+  D2Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   D2Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  D2Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  D2Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  D2Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 62: // value
-      case 89: // ncr_protocol_value
-        value.move< ElementPtr > (that.value);
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 50: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 49: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 48: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 47: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -279,34 +273,35 @@ namespace isc { namespace d2 {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   D2Parser::stack_symbol_type&
   D2Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 62: // value
-      case 89: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 50: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 49: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 48: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 47: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -318,9 +313,46 @@ namespace isc { namespace d2 {
     return *this;
   }
 
+  D2Parser::stack_symbol_type&
+  D2Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   D2Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -331,91 +363,91 @@ namespace isc { namespace d2 {
 #if D2_PARSER_DEBUG
   template <typename Base>
   void
-  D2Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  D2Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 47: // "constant string"
-
-#line 104 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 354 "d2_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "d2_parser.cc"
         break;
 
-      case 48: // "integer"
-
-#line 104 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 361 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "d2_parser.cc"
         break;
 
-      case 49: // "floating point"
-
-#line 104 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 368 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "d2_parser.cc"
         break;
 
-      case 50: // "boolean"
-
-#line 104 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 375 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "d2_parser.cc"
         break;
 
-      case 62: // value
-
-#line 104 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 382 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "d2_parser.cc"
         break;
 
-      case 89: // ncr_protocol_value
-
-#line 104 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 389 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "d2_parser.cc"
         break;
 
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 109 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "d2_parser.cc"
+        break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  D2Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  D2Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  D2Parser::yypush_ (const char* m, stack_symbol_type& s)
+  D2Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  D2Parser::yypop_ (unsigned int n)
+  D2Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -447,32 +479,37 @@ namespace isc { namespace d2 {
   }
 #endif // D2_PARSER_DEBUG
 
-  inline D2Parser::state_type
+  D2Parser::state_type
   D2Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  D2Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  D2Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  D2Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  D2Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  D2Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   D2Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -490,11 +527,11 @@ namespace isc { namespace d2 {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -502,48 +539,70 @@ namespace isc { namespace d2 {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -560,50 +619,53 @@ namespace isc { namespace d2 {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
+      switch (yyr1_[yyn])
     {
-      case 62: // value
-      case 89: // ncr_protocol_value
-        yylhs.value.build< ElementPtr > ();
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 50: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 49: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 48: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 47: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -611,998 +673,1059 @@ namespace isc { namespace d2 {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 113 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 630 "d2_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 118 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 695 "d2_parser.cc"
     break;
 
-  case 4:
-#line 114 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 636 "d2_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 119 "d2_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "d2_parser.cc"
     break;
 
-  case 6:
-#line 115 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCPDDNS; }
-#line 642 "d2_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 120 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.DHCPDDNS; }
+#line 707 "d2_parser.cc"
     break;
 
-  case 8:
-#line 116 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.TSIG_KEY; }
-#line 648 "d2_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 121 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.TSIG_KEY; }
+#line 713 "d2_parser.cc"
     break;
 
-  case 10:
-#line 117 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.TSIG_KEYS; }
-#line 654 "d2_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 122 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.TSIG_KEYS; }
+#line 719 "d2_parser.cc"
     break;
 
-  case 12:
-#line 118 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DDNS_DOMAIN; }
-#line 660 "d2_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 123 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DDNS_DOMAIN; }
+#line 725 "d2_parser.cc"
     break;
 
-  case 14:
-#line 119 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DDNS_DOMAINS; }
-#line 666 "d2_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 124 "d2_parser.yy"
+                        { ctx.ctx_ = ctx.DDNS_DOMAINS; }
+#line 731 "d2_parser.cc"
     break;
 
-  case 16:
-#line 120 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 672 "d2_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 125 "d2_parser.yy"
+                      { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 737 "d2_parser.cc"
     break;
 
-  case 18:
-#line 121 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 678 "d2_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 126 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 743 "d2_parser.cc"
     break;
 
-  case 20:
-#line 129 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 684 "d2_parser.cc" // lalr1.cc:859
+  case 20: // value: "integer"
+#line 134 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 749 "d2_parser.cc"
     break;
 
-  case 21:
-#line 130 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 690 "d2_parser.cc" // lalr1.cc:859
+  case 21: // value: "floating point"
+#line 135 "d2_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 755 "d2_parser.cc"
     break;
 
-  case 22:
-#line 131 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 696 "d2_parser.cc" // lalr1.cc:859
+  case 22: // value: "boolean"
+#line 136 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 761 "d2_parser.cc"
     break;
 
-  case 23:
-#line 132 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 702 "d2_parser.cc" // lalr1.cc:859
+  case 23: // value: "constant string"
+#line 137 "d2_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 767 "d2_parser.cc"
     break;
 
-  case 24:
-#line 133 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 708 "d2_parser.cc" // lalr1.cc:859
+  case 24: // value: "null"
+#line 138 "d2_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 773 "d2_parser.cc"
     break;
 
-  case 25:
-#line 134 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 714 "d2_parser.cc" // lalr1.cc:859
+  case 25: // value: map2
+#line 139 "d2_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 779 "d2_parser.cc"
     break;
 
-  case 26:
-#line 135 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 720 "d2_parser.cc" // lalr1.cc:859
+  case 26: // value: list_generic
+#line 140 "d2_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 785 "d2_parser.cc"
     break;
 
-  case 27:
-#line 138 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 27: // sub_json: value
+#line 143 "d2_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 729 "d2_parser.cc" // lalr1.cc:859
+#line 794 "d2_parser.cc"
     break;
 
-  case 28:
-#line 143 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 28: // $@10: %empty
+#line 148 "d2_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 740 "d2_parser.cc" // lalr1.cc:859
+#line 805 "d2_parser.cc"
     break;
 
-  case 29:
-#line 148 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 29: // map2: "{" $@10 map_content "}"
+#line 153 "d2_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 750 "d2_parser.cc" // lalr1.cc:859
+#line 815 "d2_parser.cc"
     break;
 
-  case 32:
-#line 159 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 32: // not_empty_map: "constant string" ":" value
+#line 164 "d2_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 759 "d2_parser.cc" // lalr1.cc:859
+#line 824 "d2_parser.cc"
     break;
 
-  case 33:
-#line 163 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 33: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 168 "d2_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 769 "d2_parser.cc" // lalr1.cc:859
+#line 834 "d2_parser.cc"
     break;
 
-  case 34:
-#line 170 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 34: // $@11: %empty
+#line 175 "d2_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 778 "d2_parser.cc" // lalr1.cc:859
+#line 843 "d2_parser.cc"
     break;
 
-  case 35:
-#line 173 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 35: // list_generic: "[" $@11 list_content "]"
+#line 178 "d2_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 786 "d2_parser.cc" // lalr1.cc:859
+#line 851 "d2_parser.cc"
     break;
 
-  case 38:
-#line 181 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 38: // not_empty_list: value
+#line 186 "d2_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 795 "d2_parser.cc" // lalr1.cc:859
+#line 860 "d2_parser.cc"
     break;
 
-  case 39:
-#line 185 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 39: // not_empty_list: not_empty_list "," value
+#line 190 "d2_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 804 "d2_parser.cc" // lalr1.cc:859
+#line 869 "d2_parser.cc"
     break;
 
-  case 40:
-#line 196 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 40: // unknown_map_entry: "constant string" ":"
+#line 201 "d2_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 815 "d2_parser.cc" // lalr1.cc:859
+#line 880 "d2_parser.cc"
     break;
 
-  case 41:
-#line 206 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 41: // $@12: %empty
+#line 211 "d2_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 826 "d2_parser.cc" // lalr1.cc:859
+#line 891 "d2_parser.cc"
     break;
 
-  case 42:
-#line 211 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 42: // syntax_map: "{" $@12 global_objects "}"
+#line 216 "d2_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 836 "d2_parser.cc" // lalr1.cc:859
+#line 901 "d2_parser.cc"
     break;
 
-  case 50:
-#line 232 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 50: // $@13: %empty
+#line 237 "d2_parser.yy"
+                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCPDDNS);
 }
-#line 847 "d2_parser.cc" // lalr1.cc:859
+#line 912 "d2_parser.cc"
     break;
 
-  case 51:
-#line 237 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 51: // dhcpddns_object: "DhcpDdns" $@13 ":" "{" dhcpddns_params "}"
+#line 242 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 856 "d2_parser.cc" // lalr1.cc:859
+#line 921 "d2_parser.cc"
     break;
 
-  case 52:
-#line 242 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 52: // $@14: %empty
+#line 247 "d2_parser.yy"
+                             {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 866 "d2_parser.cc" // lalr1.cc:859
+#line 931 "d2_parser.cc"
     break;
 
-  case 53:
-#line 246 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 53: // sub_dhcpddns: "{" $@14 dhcpddns_params "}"
+#line 251 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 874 "d2_parser.cc" // lalr1.cc:859
+#line 939 "d2_parser.cc"
     break;
 
-  case 65:
-#line 266 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 68: // $@15: %empty
+#line 274 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 882 "d2_parser.cc" // lalr1.cc:859
+#line 947 "d2_parser.cc"
     break;
 
-  case 66:
-#line 268 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 69: // ip_address: "ip-address" $@15 ":" "constant string"
+#line 276 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 892 "d2_parser.cc" // lalr1.cc:859
+#line 957 "d2_parser.cc"
     break;
 
-  case 67:
-#line 274 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 70: // port: "port" ":" "integer"
+#line 282 "d2_parser.yy"
+                         {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 904 "d2_parser.cc" // lalr1.cc:859
+#line 969 "d2_parser.cc"
     break;
 
-  case 68:
-#line 282 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0) {
+  case 71: // dns_server_timeout: "dns-server-timeout" ":" "integer"
+#line 290 "d2_parser.yy"
+                                                     {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
     } else {
-        ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("dns-server-timeout", i);
     }
 }
-#line 917 "d2_parser.cc" // lalr1.cc:859
+#line 982 "d2_parser.cc"
     break;
 
-  case 69:
-#line 291 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 72: // dns_update_threads: "dns-update-threads" ":" "integer"
+#line 299 "d2_parser.yy"
+                                                     {
+    if (yystack_[0].value.as < int64_t > () < 0) {
+        error(yystack_[0].location, "dns-update-threads must not be negative");
+    } else {
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ctx.stack_.back()->set("dns-update-threads", i);
+    }
+}
+#line 995 "d2_parser.cc"
+    break;
+
+  case 73: // dns_update_batch_size: "dns-update-batch-size" ":" "integer"
+#line 308 "d2_parser.yy"
+                                                           {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
+        error(yystack_[0].location, "dns-update-batch-size must be greater than zero");
+    } else {
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ctx.stack_.back()->set("dns-update-batch-size", i);
+    }
+}
+#line 1008 "d2_parser.cc"
+    break;
+
+  case 74: // $@16: %empty
+#line 317 "d2_parser.yy"
+                           {
+    ctx.enter(ctx.DNS_PROTOCOL);
+}
+#line 1016 "d2_parser.cc"
+    break;
+
+  case 75: // dns_protocol: "dns-protocol" $@16 ":" ncr_protocol_value
+#line 319 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("dns-protocol", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1025 "d2_parser.cc"
+    break;
+
+  case 76: // $@17: %empty
+#line 324 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 925 "d2_parser.cc" // lalr1.cc:859
+#line 1033 "d2_parser.cc"
     break;
 
-  case 70:
-#line 293 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 77: // ncr_protocol: "ncr-protocol" $@17 ":" ncr_protocol_value
+#line 326 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 934 "d2_parser.cc" // lalr1.cc:859
+#line 1042 "d2_parser.cc"
     break;
 
-  case 71:
-#line 299 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 940 "d2_parser.cc" // lalr1.cc:859
+  case 78: // ncr_protocol_value: "UDP"
+#line 332 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 1048 "d2_parser.cc"
     break;
 
-  case 72:
-#line 300 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 946 "d2_parser.cc" // lalr1.cc:859
+  case 79: // ncr_protocol_value: "TCP"
+#line 333 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 1054 "d2_parser.cc"
     break;
 
-  case 73:
-#line 303 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 80: // $@18: %empty
+#line 336 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 954 "d2_parser.cc" // lalr1.cc:859
+#line 1062 "d2_parser.cc"
     break;
 
-  case 74:
-#line 305 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 81: // ncr_format: "ncr-format" $@18 ":" ncr_format_value
+#line 338 "d2_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 964 "d2_parser.cc" // lalr1.cc:859
+#line 1071 "d2_parser.cc"
     break;
 
-  case 75:
-#line 311 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 82: // ncr_format_value: "JSON"
+#line 344 "d2_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 1077 "d2_parser.cc"
+    break;
+
+  case 83: // ncr_format_value: "BINARY"
+#line 345 "d2_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 1083 "d2_parser.cc"
+    break;
+
+  case 84: // $@19: %empty
+#line 348 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.FORWARD_DDNS);
 }
-#line 975 "d2_parser.cc" // lalr1.cc:859
+#line 1094 "d2_parser.cc"
     break;
 
-  case 76:
-#line 316 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 85: // forward_ddns: "forward-ddns" $@19 ":" "{" ddns_mgr_params "}"
+#line 353 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 984 "d2_parser.cc" // lalr1.cc:859
+#line 1103 "d2_parser.cc"
     break;
 
-  case 77:
-#line 321 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 86: // $@20: %empty
+#line 358 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.REVERSE_DDNS);
 }
-#line 995 "d2_parser.cc" // lalr1.cc:859
+#line 1114 "d2_parser.cc"
     break;
 
-  case 78:
-#line 326 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 87: // reverse_ddns: "reverse-ddns" $@20 ":" "{" ddns_mgr_params "}"
+#line 363 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1004 "d2_parser.cc" // lalr1.cc:859
+#line 1123 "d2_parser.cc"
     break;
 
-  case 85:
-#line 345 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 94: // $@21: %empty
+#line 382 "d2_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DDNS_DOMAINS);
 }
-#line 1015 "d2_parser.cc" // lalr1.cc:859
+#line 1134 "d2_parser.cc"
     break;
 
-  case 86:
-#line 350 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 95: // ddns_domains: "ddns-domains" $@21 ":" "[" ddns_domain_list "]"
+#line 387 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1024 "d2_parser.cc" // lalr1.cc:859
+#line 1143 "d2_parser.cc"
     break;
 
-  case 87:
-#line 355 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 96: // $@22: %empty
+#line 392 "d2_parser.yy"
+                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1033 "d2_parser.cc" // lalr1.cc:859
+#line 1152 "d2_parser.cc"
     break;
 
-  case 88:
-#line 358 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 97: // sub_ddns_domains: "[" $@22 ddns_domain_list "]"
+#line 395 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1041 "d2_parser.cc" // lalr1.cc:859
+#line 1160 "d2_parser.cc"
     break;
 
-  case 93:
-#line 370 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 102: // $@23: %empty
+#line 407 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1051 "d2_parser.cc" // lalr1.cc:859
+#line 1170 "d2_parser.cc"
     break;
 
-  case 94:
-#line 374 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 103: // ddns_domain: "{" $@23 ddns_domain_params "}"
+#line 411 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1059 "d2_parser.cc" // lalr1.cc:859
+#line 1178 "d2_parser.cc"
     break;
 
-  case 95:
-#line 378 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 104: // $@24: %empty
+#line 415 "d2_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1068 "d2_parser.cc" // lalr1.cc:859
+#line 1187 "d2_parser.cc"
     break;
 
-  case 96:
-#line 381 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 105: // sub_ddns_domain: "{" $@24 ddns_domain_params "}"
+#line 418 "d2_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1076 "d2_parser.cc" // lalr1.cc:859
+#line 1195 "d2_parser.cc"
     break;
 
-  case 103:
-#line 396 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 112: // $@25: %empty
+#line 433 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1084 "d2_parser.cc" // lalr1.cc:859
+#line 1203 "d2_parser.cc"
     break;
 
-  case 104:
-#line 398 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 113: // ddns_domain_name: "name" $@25 ":" "constant string"
+#line 435 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1098 "d2_parser.cc" // lalr1.cc:859
+#line 1217 "d2_parser.cc"
     break;
 
-  case 105:
-#line 408 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 114: // $@26: %empty
+#line 445 "d2_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1106 "d2_parser.cc" // lalr1.cc:859
+#line 1225 "d2_parser.cc"
     break;
 
-  case 106:
-#line 410 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 115: // ddns_domain_key_name: "key-name" $@26 ":" "constant string"
+#line 447 "d2_parser.yy"
+               {
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("key-name", name);
     ctx.leave();
 }
-#line 1117 "d2_parser.cc" // lalr1.cc:859
+#line 1236 "d2_parser.cc"
     break;
 
-  case 107:
-#line 420 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 116: // $@27: %empty
+#line 457 "d2_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DNS_SERVERS);
 }
-#line 1128 "d2_parser.cc" // lalr1.cc:859
+#line 1247 "d2_parser.cc"
     break;
 
-  case 108:
-#line 425 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 117: // dns_servers: "dns-servers" $@27 ":" "[" dns_server_list "]"
+#line 462 "d2_parser.yy"
+                                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1137 "d2_parser.cc" // lalr1.cc:859
+#line 1256 "d2_parser.cc"
     break;
 
-  case 109:
-#line 430 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 118: // $@28: %empty
+#line 467 "d2_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1146 "d2_parser.cc" // lalr1.cc:859
+#line 1265 "d2_parser.cc"
     break;
 
-  case 110:
-#line 433 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 119: // sub_dns_servers: "[" $@28 dns_server_list "]"
+#line 470 "d2_parser.yy"
+                                  {
     // parsing completed
 }
-#line 1154 "d2_parser.cc" // lalr1.cc:859
+#line 1273 "d2_parser.cc"
     break;
 
-  case 113:
-#line 441 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 122: // $@29: %empty
+#line 478 "d2_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1164 "d2_parser.cc" // lalr1.cc:859
+#line 1283 "d2_parser.cc"
     break;
 
-  case 114:
-#line 445 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 123: // dns_server: "{" $@29 dns_server_params "}"
+#line 482 "d2_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1172 "d2_parser.cc" // lalr1.cc:859
+#line 1291 "d2_parser.cc"
     break;
 
-  case 115:
-#line 449 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 124: // $@30: %empty
+#line 486 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1181 "d2_parser.cc" // lalr1.cc:859
+#line 1300 "d2_parser.cc"
     break;
 
-  case 116:
-#line 452 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 125: // sub_dns_server: "{" $@30 dns_server_params "}"
+#line 489 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1189 "d2_parser.cc" // lalr1.cc:859
+#line 1308 "d2_parser.cc"
     break;
 
-  case 123:
-#line 466 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 132: // $@31: %empty
+#line 503 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1197 "d2_parser.cc" // lalr1.cc:859
+#line 1316 "d2_parser.cc"
     break;
 
-  case 124:
-#line 468 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () != "") {
+  case 133: // dns_server_hostname: "hostname" $@31 ":" "constant string"
+#line 505 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", name);
     ctx.leave();
 }
-#line 1211 "d2_parser.cc" // lalr1.cc:859
+#line 1330 "d2_parser.cc"
     break;
 
-  case 125:
-#line 478 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 134: // $@32: %empty
+#line 515 "d2_parser.yy"
+                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1219 "d2_parser.cc" // lalr1.cc:859
+#line 1338 "d2_parser.cc"
     break;
 
-  case 126:
-#line 480 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 135: // dns_server_ip_address: "ip-address" $@32 ":" "constant string"
+#line 517 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 1229 "d2_parser.cc" // lalr1.cc:859
+#line 1348 "d2_parser.cc"
     break;
 
-  case 127:
-#line 486 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 136: // dns_server_port: "port" ":" "integer"
+#line 523 "d2_parser.yy"
+                                    {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 1241 "d2_parser.cc" // lalr1.cc:859
+#line 1360 "d2_parser.cc"
     break;
 
-  case 128:
-#line 500 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 137: // $@33: %empty
+#line 537 "d2_parser.yy"
+                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1252 "d2_parser.cc" // lalr1.cc:859
+#line 1371 "d2_parser.cc"
     break;
 
-  case 129:
-#line 505 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 138: // tsig_keys: "tsig-keys" $@33 ":" "[" tsig_keys_list "]"
+#line 542 "d2_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1261 "d2_parser.cc" // lalr1.cc:859
+#line 1380 "d2_parser.cc"
     break;
 
-  case 130:
-#line 510 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 139: // $@34: %empty
+#line 547 "d2_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1270 "d2_parser.cc" // lalr1.cc:859
+#line 1389 "d2_parser.cc"
     break;
 
-  case 131:
-#line 513 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 140: // sub_tsig_keys: "[" $@34 tsig_keys_list "]"
+#line 550 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1278 "d2_parser.cc" // lalr1.cc:859
+#line 1397 "d2_parser.cc"
     break;
 
-  case 136:
-#line 525 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 145: // $@35: %empty
+#line 562 "d2_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1288 "d2_parser.cc" // lalr1.cc:859
+#line 1407 "d2_parser.cc"
     break;
 
-  case 137:
-#line 529 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 146: // tsig_key: "{" $@35 tsig_key_params "}"
+#line 566 "d2_parser.yy"
+                                 {
     ctx.stack_.pop_back();
 }
-#line 1296 "d2_parser.cc" // lalr1.cc:859
+#line 1415 "d2_parser.cc"
     break;
 
-  case 138:
-#line 533 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 147: // $@36: %empty
+#line 570 "d2_parser.yy"
+                             {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1306 "d2_parser.cc" // lalr1.cc:859
+#line 1425 "d2_parser.cc"
     break;
 
-  case 139:
-#line 537 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 148: // sub_tsig_key: "{" $@36 tsig_key_params "}"
+#line 574 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1314 "d2_parser.cc" // lalr1.cc:859
+#line 1433 "d2_parser.cc"
     break;
 
-  case 147:
-#line 553 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 156: // $@37: %empty
+#line 590 "d2_parser.yy"
+                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1322 "d2_parser.cc" // lalr1.cc:859
+#line 1441 "d2_parser.cc"
     break;
 
-  case 148:
-#line 555 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 157: // tsig_key_name: "name" $@37 ":" "constant string"
+#line 592 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1336 "d2_parser.cc" // lalr1.cc:859
+#line 1455 "d2_parser.cc"
     break;
 
-  case 149:
-#line 565 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 158: // $@38: %empty
+#line 602 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1344 "d2_parser.cc" // lalr1.cc:859
+#line 1463 "d2_parser.cc"
     break;
 
-  case 150:
-#line 567 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 159: // tsig_key_algorithm: "algorithm" $@38 ":" "constant string"
+#line 604 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1357 "d2_parser.cc" // lalr1.cc:859
+#line 1476 "d2_parser.cc"
     break;
 
-  case 151:
-#line 576 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () < 0 || (yystack_[0].value.as< int64_t > () > 0  && (yystack_[0].value.as< int64_t > () % 8 != 0))) {
+  case 160: // tsig_key_digest_bits: "digest-bits" ":" "integer"
+#line 613 "d2_parser.yy"
+                                                {
+    if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
     }
-    ElementPtr elem(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1369 "d2_parser.cc" // lalr1.cc:859
+#line 1488 "d2_parser.cc"
     break;
 
-  case 152:
-#line 584 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 161: // $@39: %empty
+#line 621 "d2_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1377 "d2_parser.cc" // lalr1.cc:859
+#line 1496 "d2_parser.cc"
     break;
 
-  case 153:
-#line 586 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 162: // tsig_key_secret: "secret" $@39 ":" "constant string"
+#line 623 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1390 "d2_parser.cc" // lalr1.cc:859
+#line 1509 "d2_parser.cc"
     break;
 
-  case 154:
-#line 599 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 163: // $@40: %empty
+#line 636 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1398 "d2_parser.cc" // lalr1.cc:859
+#line 1517 "d2_parser.cc"
     break;
 
-  case 155:
-#line 601 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 164: // dhcp6_json_object: "Dhcp6" $@40 ":" value
+#line 638 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1407 "d2_parser.cc" // lalr1.cc:859
+#line 1526 "d2_parser.cc"
     break;
 
-  case 156:
-#line 606 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 165: // $@41: %empty
+#line 643 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1415 "d2_parser.cc" // lalr1.cc:859
+#line 1534 "d2_parser.cc"
     break;
 
-  case 157:
-#line 608 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 166: // dhcp4_json_object: "Dhcp4" $@41 ":" value
+#line 645 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1424 "d2_parser.cc" // lalr1.cc:859
+#line 1543 "d2_parser.cc"
     break;
 
-  case 158:
-#line 618 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 167: // $@42: %empty
+#line 655 "d2_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1435 "d2_parser.cc" // lalr1.cc:859
+#line 1554 "d2_parser.cc"
     break;
 
-  case 159:
-#line 623 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 168: // logging_object: "Logging" $@42 ":" "{" logging_params "}"
+#line 660 "d2_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1444 "d2_parser.cc" // lalr1.cc:859
+#line 1563 "d2_parser.cc"
     break;
 
-  case 163:
-#line 640 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 172: // $@43: %empty
+#line 677 "d2_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1455 "d2_parser.cc" // lalr1.cc:859
+#line 1574 "d2_parser.cc"
     break;
 
-  case 164:
-#line 645 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 173: // loggers: "loggers" $@43 ":" "[" loggers_entries "]"
+#line 682 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1464 "d2_parser.cc" // lalr1.cc:859
+#line 1583 "d2_parser.cc"
     break;
 
-  case 167:
-#line 657 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 176: // $@44: %empty
+#line 694 "d2_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1474 "d2_parser.cc" // lalr1.cc:859
+#line 1593 "d2_parser.cc"
     break;
 
-  case 168:
-#line 661 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 177: // logger_entry: "{" $@44 logger_params "}"
+#line 698 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1482 "d2_parser.cc" // lalr1.cc:859
+#line 1601 "d2_parser.cc"
     break;
 
-  case 176:
-#line 676 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 185: // $@45: %empty
+#line 713 "d2_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1490 "d2_parser.cc" // lalr1.cc:859
+#line 1609 "d2_parser.cc"
     break;
 
-  case 177:
-#line 678 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 186: // name: "name" $@45 ":" "constant string"
+#line 715 "d2_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1500 "d2_parser.cc" // lalr1.cc:859
+#line 1619 "d2_parser.cc"
     break;
 
-  case 178:
-#line 684 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 187: // debuglevel: "debuglevel" ":" "integer"
+#line 721 "d2_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1509 "d2_parser.cc" // lalr1.cc:859
+#line 1628 "d2_parser.cc"
     break;
 
-  case 179:
-#line 688 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 188: // $@46: %empty
+#line 725 "d2_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1517 "d2_parser.cc" // lalr1.cc:859
+#line 1636 "d2_parser.cc"
     break;
 
-  case 180:
-#line 690 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 189: // severity: "severity" $@46 ":" "constant string"
+#line 727 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1527 "d2_parser.cc" // lalr1.cc:859
+#line 1646 "d2_parser.cc"
     break;
 
-  case 181:
-#line 696 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 190: // $@47: %empty
+#line 733 "d2_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1538 "d2_parser.cc" // lalr1.cc:859
+#line 1657 "d2_parser.cc"
     break;
 
-  case 182:
-#line 701 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 191: // output_options_list: "output_options" $@47 ":" "[" output_options_list_content "]"
+#line 738 "d2_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1547 "d2_parser.cc" // lalr1.cc:859
+#line 1666 "d2_parser.cc"
     break;
 
-  case 185:
-#line 710 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 194: // $@48: %empty
+#line 747 "d2_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1557 "d2_parser.cc" // lalr1.cc:859
+#line 1676 "d2_parser.cc"
     break;
 
-  case 186:
-#line 714 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 195: // output_entry: "{" $@48 output_params "}"
+#line 751 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1565 "d2_parser.cc" // lalr1.cc:859
+#line 1684 "d2_parser.cc"
     break;
 
-  case 189:
-#line 722 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 198: // $@49: %empty
+#line 759 "d2_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1573 "d2_parser.cc" // lalr1.cc:859
+#line 1692 "d2_parser.cc"
     break;
 
-  case 190:
-#line 724 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 199: // output_param: "output" $@49 ":" "constant string"
+#line 761 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1583 "d2_parser.cc" // lalr1.cc:859
+#line 1702 "d2_parser.cc"
     break;
 
 
-#line 1587 "d2_parser.cc" // lalr1.cc:859
+#line 1706 "d2_parser.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1611,7 +1734,9 @@ namespace isc { namespace d2 {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1622,7 +1747,7 @@ namespace isc { namespace d2 {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1639,69 +1764,81 @@ namespace isc { namespace d2 {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1709,6 +1846,7 @@ namespace isc { namespace d2 {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1717,12 +1855,12 @@ namespace isc { namespace d2 {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -1733,26 +1871,112 @@ namespace isc { namespace d2 {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   D2Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  D2Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  D2Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  D2Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
 
+
+  // D2Parser::context.
+  D2Parser::context::context (const D2Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  D2Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  D2Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1771,41 +1995,32 @@ namespace isc { namespace d2 {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  D2Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1814,22 +2029,23 @@ namespace isc { namespace d2 {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1838,46 +2054,47 @@ namespace isc { namespace d2 {
   }
 
 
-  const signed char D2Parser::yypact_ninf_ = -104;
+  const signed char D2Parser::yypact_ninf_ = -111;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   D2Parser::yypact_[] =
   {
-      29,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-      11,    -2,    16,    28,    37,    97,    81,    98,    99,   100,
-    -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,    -2,    15,
-       2,     3,    10,   101,     4,   102,    -5,   103,  -104,   106,
-     104,   110,    96,   112,  -104,  -104,  -104,  -104,   113,  -104,
-      12,  -104,  -104,  -104,  -104,  -104,  -104,   114,   116,  -104,
-    -104,  -104,  -104,  -104,  -104,    23,  -104,  -104,  -104,  -104,
-    -104,  -104,  -104,  -104,  -104,  -104,   118,  -104,  -104,  -104,
-      24,  -104,  -104,  -104,  -104,  -104,  -104,   117,   121,  -104,
-    -104,  -104,  -104,  -104,    33,  -104,  -104,  -104,  -104,  -104,
-     119,   123,  -104,  -104,   124,  -104,  -104,    51,  -104,  -104,
-    -104,  -104,  -104,    58,  -104,  -104,    -2,    -2,  -104,    69,
-     126,   127,   128,   129,  -104,     2,  -104,   130,    87,    88,
-     133,   136,   137,   138,   139,     3,  -104,   140,   105,   141,
-     142,    10,  -104,    10,  -104,   101,   143,   144,   145,     4,
-    -104,     4,  -104,   102,   146,   107,   147,    -5,  -104,    -5,
-     103,  -104,  -104,  -104,   148,    -2,    -2,   149,   150,  -104,
-     111,  -104,  -104,    82,   134,   152,   153,   156,  -104,   115,
-    -104,   120,   122,  -104,    55,  -104,   125,   158,   135,  -104,
-      57,  -104,   151,  -104,   154,  -104,    73,  -104,    -2,  -104,
-    -104,     3,   132,  -104,  -104,  -104,  -104,  -104,   -13,   -13,
-     101,  -104,  -104,  -104,  -104,  -104,   103,  -104,  -104,  -104,
-    -104,  -104,  -104,    74,  -104,    75,  -104,  -104,  -104,  -104,
-      76,  -104,  -104,  -104,    77,   159,    90,  -104,   162,   132,
-    -104,   164,   -13,  -104,  -104,  -104,  -104,   165,  -104,   168,
-    -104,   167,   102,  -104,    91,  -104,   169,    19,   167,  -104,
-    -104,  -104,  -104,   172,  -104,  -104,    83,  -104,  -104,  -104,
-    -104,  -104,  -104,   173,   176,   155,   177,    19,  -104,   157,
-     178,  -104,   160,  -104,  -104,   179,  -104,  -104,    95,  -104,
-     161,   179,  -104,  -104,    84,  -104,  -104,   180,   161,  -104,
-     163,  -104,  -104
+      32,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+      11,    -2,     8,    16,    24,    43,    48,    99,   100,   103,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,    -2,    17,
+       2,     3,     6,   104,     7,   105,    -4,   106,  -111,   108,
+     112,   113,   110,   116,  -111,  -111,  -111,  -111,   117,  -111,
+      38,  -111,  -111,  -111,  -111,  -111,  -111,   119,   120,   121,
+     122,  -111,  -111,  -111,  -111,  -111,  -111,  -111,    53,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,   123,  -111,  -111,  -111,    61,  -111,  -111,  -111,
+    -111,  -111,  -111,   125,   126,  -111,  -111,  -111,  -111,  -111,
+      62,  -111,  -111,  -111,  -111,  -111,   127,   129,  -111,  -111,
+     130,  -111,  -111,    63,  -111,  -111,  -111,  -111,  -111,    21,
+    -111,  -111,    -2,    -2,  -111,    65,   131,   133,   135,   136,
+    -111,     2,  -111,   137,    92,    93,    98,   101,   138,   139,
+     142,   145,   147,   148,     3,  -111,   150,   107,   151,   152,
+       6,  -111,     6,  -111,   104,   153,   154,   156,     7,  -111,
+       7,  -111,   105,   157,   111,   158,    -4,  -111,    -4,   106,
+    -111,  -111,  -111,   160,    -2,    -2,   159,   161,  -111,   114,
+    -111,  -111,  -111,  -111,    85,    85,    86,   162,   163,   166,
+    -111,   124,  -111,   128,   134,  -111,    64,  -111,   140,   167,
+     141,  -111,    80,  -111,   144,  -111,   146,  -111,    81,  -111,
+      -2,  -111,  -111,     3,   164,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,   -19,   -19,   104,  -111,  -111,  -111,  -111,
+    -111,   106,  -111,  -111,  -111,  -111,  -111,  -111,    82,  -111,
+      83,  -111,  -111,  -111,  -111,    84,  -111,  -111,  -111,    90,
+     168,    27,  -111,   169,   164,  -111,   172,   -19,  -111,  -111,
+    -111,  -111,   173,  -111,   175,  -111,   170,   105,  -111,    39,
+    -111,   176,    22,   170,  -111,  -111,  -111,  -111,   177,  -111,
+    -111,    91,  -111,  -111,  -111,  -111,  -111,  -111,   180,   182,
+     115,   183,    22,  -111,   155,   184,  -111,   165,  -111,  -111,
+     181,  -111,  -111,    97,  -111,   171,   181,  -111,  -111,    94,
+    -111,  -111,   186,   171,  -111,   174,  -111,  -111
   };
 
   const unsigned char
@@ -1886,198 +2103,206 @@ namespace isc { namespace d2 {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    34,    28,    24,    23,    20,    21,    22,    27,     3,
-      25,    26,    41,     5,    52,     7,   138,     9,   130,    11,
-      95,    13,    87,    15,   115,    17,   109,    19,    36,    30,
-       0,     0,     0,   132,     0,    89,     0,     0,    38,     0,
-      37,     0,     0,    31,   154,   156,    50,   158,     0,    49,
-       0,    43,    48,    45,    47,    46,    65,     0,     0,    69,
-      73,    75,    77,   128,    64,     0,    54,    56,    57,    58,
-      59,    60,    61,    62,    63,   149,     0,   152,   147,   146,
-       0,   140,   142,   143,   144,   145,   136,     0,   133,   134,
-     105,   107,   103,   102,     0,    97,    99,   100,   101,    93,
-       0,    90,    91,   125,     0,   123,   122,     0,   117,   119,
-     120,   121,   113,     0,   111,    35,     0,     0,    29,     0,
-       0,     0,     0,     0,    40,     0,    42,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    53,     0,     0,     0,
-       0,     0,   139,     0,   131,     0,     0,     0,     0,     0,
-      96,     0,    88,     0,     0,     0,     0,     0,   116,     0,
-       0,   110,    39,    32,     0,     0,     0,     0,     0,    44,
-       0,    67,    68,     0,     0,     0,     0,     0,    55,     0,
-     151,     0,     0,   141,     0,   135,     0,     0,     0,    98,
-       0,    92,     0,   127,     0,   118,     0,   112,     0,   155,
-     157,     0,     0,    66,    71,    72,    70,    74,    79,    79,
-     132,   150,   153,   148,   137,   106,     0,   104,    94,   126,
-     124,   114,    33,     0,   163,     0,   160,   162,    85,    84,
-       0,    80,    81,    83,     0,     0,     0,    51,     0,     0,
-     159,     0,     0,    76,    78,   129,   108,     0,   161,     0,
-      82,     0,    89,   167,     0,   165,     0,     0,     0,   164,
-      86,   176,   181,     0,   179,   175,     0,   169,   171,   173,
-     174,   172,   166,     0,     0,     0,     0,     0,   168,     0,
-       0,   178,     0,   170,   177,     0,   180,   185,     0,   183,
-       0,     0,   182,   189,     0,   187,   184,     0,     0,   186,
-       0,   188,   190
+      25,    26,    41,     5,    52,     7,   147,     9,   139,    11,
+     104,    13,    96,    15,   124,    17,   118,    19,    36,    30,
+       0,     0,     0,   141,     0,    98,     0,     0,    38,     0,
+      37,     0,     0,    31,   163,   165,    50,   167,     0,    49,
+       0,    43,    48,    45,    47,    46,    68,     0,     0,     0,
+       0,    74,    76,    80,    84,    86,   137,    67,     0,    54,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,   158,     0,   161,   156,   155,     0,   149,   151,   152,
+     153,   154,   145,     0,   142,   143,   114,   116,   112,   111,
+       0,   106,   108,   109,   110,   102,     0,    99,   100,   134,
+       0,   132,   131,     0,   126,   128,   129,   130,   122,     0,
+     120,    35,     0,     0,    29,     0,     0,     0,     0,     0,
+      40,     0,    42,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    53,     0,     0,     0,     0,
+       0,   148,     0,   140,     0,     0,     0,     0,     0,   105,
+       0,    97,     0,     0,     0,     0,     0,   125,     0,     0,
+     119,    39,    32,     0,     0,     0,     0,     0,    44,     0,
+      70,    71,    72,    73,     0,     0,     0,     0,     0,     0,
+      55,     0,   160,     0,     0,   150,     0,   144,     0,     0,
+       0,   107,     0,   101,     0,   136,     0,   127,     0,   121,
+       0,   164,   166,     0,     0,    69,    78,    79,    75,    77,
+      82,    83,    81,    88,    88,   141,   159,   162,   157,   146,
+     115,     0,   113,   103,   135,   133,   123,    33,     0,   172,
+       0,   169,   171,    94,    93,     0,    89,    90,    92,     0,
+       0,     0,    51,     0,     0,   168,     0,     0,    85,    87,
+     138,   117,     0,   170,     0,    91,     0,    98,   176,     0,
+     174,     0,     0,     0,   173,    95,   185,   190,     0,   188,
+     184,     0,   178,   180,   182,   183,   181,   175,     0,     0,
+       0,     0,     0,   177,     0,     0,   187,     0,   179,   186,
+       0,   189,   194,     0,   192,     0,     0,   191,   198,     0,
+     196,   193,     0,     0,   195,     0,   197,   199
   };
 
   const signed char
   D2Parser::yypgoto_[] =
   {
-    -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,   -47,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,   -50,  -104,  -104,  -104,    40,  -104,  -104,  -104,  -104,
-     -34,    34,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,  -104,  -104,  -104,  -104,   -41,  -104,   -72,  -104,  -104,
-    -104,  -104,   -81,  -104,    20,  -104,  -104,  -104,    21,    25,
-    -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,   -39,    22,
-    -104,  -104,  -104,    26,    18,  -104,  -104,  -104,  -104,  -104,
-    -104,  -104,  -104,  -104,   -31,  -104,    35,  -104,  -104,  -104,
-      43,    47,  -104,  -104,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,  -104,  -104,  -104,  -104,  -104,   -48,  -104,  -104,  -104,
-     -69,  -104,  -104,   -84,  -104,  -104,  -104,  -104,  -104,  -104,
-    -104,  -104,   -97,  -104,  -104,  -103,  -104
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,   -47,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,   -50,  -111,  -111,  -111,    45,  -111,  -111,  -111,  -111,
+     -35,    35,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,    -3,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+     -43,  -111,   -74,  -111,  -111,  -111,  -111,   -83,  -111,    23,
+    -111,  -111,  -111,    28,    29,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,   -42,    25,  -111,  -111,  -111,    30,    26,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,   -34,
+    -111,    41,  -111,  -111,  -111,    47,    50,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,   -61,  -111,  -111,  -111,   -76,  -111,  -111,   -91,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -104,  -111,  -111,
+    -110,  -111
   };
 
-  const short int
+  const short
   D2Parser::yydefgoto_[] =
   {
-      -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,    10,    11,    12,    13,    14,    15,    16,    17,    18,
       19,    28,    29,    30,    49,    62,    63,    31,    48,    59,
-      60,    84,    33,    50,    70,    71,    72,   142,    35,    51,
-      85,    86,    87,   147,    88,    89,    90,   150,   226,    91,
-     151,    92,   152,    93,   153,   250,   251,   252,   253,   261,
-      43,    55,   120,   121,   122,   171,    41,    54,   114,   115,
-     116,   168,   117,   166,   118,   167,    47,    57,   133,   134,
-     179,    45,    56,   127,   128,   129,   176,   130,   174,   131,
-      94,   154,    39,    53,   107,   108,   109,   163,    37,    52,
-     100,   101,   102,   160,   103,   157,   104,   105,   159,    73,
-     140,    74,   141,    75,   143,   245,   246,   247,   258,   274,
-     275,   277,   286,   287,   288,   293,   289,   290,   296,   291,
-     294,   308,   309,   310,   314,   315,   317
+      60,    87,    33,    50,    70,    71,    72,   148,    35,    51,
+      88,    89,    90,   153,    91,    92,    93,    94,    95,   158,
+      96,   159,   238,    97,   160,   242,    98,   161,    99,   162,
+     265,   266,   267,   268,   276,    43,    55,   126,   127,   128,
+     180,    41,    54,   120,   121,   122,   177,   123,   175,   124,
+     176,    47,    57,   139,   140,   188,    45,    56,   133,   134,
+     135,   185,   136,   183,   137,   100,   163,    39,    53,   113,
+     114,   115,   172,    37,    52,   106,   107,   108,   169,   109,
+     166,   110,   111,   168,    73,   146,    74,   147,    75,   149,
+     260,   261,   262,   273,   289,   290,   292,   301,   302,   303,
+     308,   304,   305,   311,   306,   309,   323,   324,   325,   329,
+     330,   332
   };
 
-  const unsigned short int
+  const short
   D2Parser::yytable_[] =
   {
-      69,    58,    99,    21,   113,    22,   126,    23,   123,   124,
-     248,    20,    64,    65,    66,   145,    76,    77,    78,    79,
-     146,   125,    80,    32,    81,    82,   155,   161,   110,   111,
-      83,   156,   162,    67,    68,    34,   169,   112,    95,    96,
-      97,   170,    68,    98,    36,    24,    25,    26,    27,    68,
-      68,    68,   281,   282,   177,   283,   284,    68,   161,   178,
-     169,   180,    61,   234,   181,   238,    68,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,   177,   155,   259,   262,
-     262,   241,   257,   260,   263,   264,   297,   318,    40,   182,
-     183,   298,   319,   180,   278,    69,   266,   279,   311,   224,
-     225,   312,    38,    42,   138,    46,    44,   136,   106,   119,
-     132,    99,   135,    99,   137,   139,   184,   144,   148,   113,
-     149,   113,   158,   164,   165,   172,   173,   126,   175,   126,
-     185,   186,   187,   188,   190,   191,   192,   193,   219,   220,
-     194,   195,   196,   197,   199,   201,   202,   206,   207,   208,
-     212,   214,   218,   200,   227,   213,   221,   222,   223,   228,
-     229,   230,   231,   236,   244,   265,   267,   232,   269,   233,
-     271,   242,   235,   272,   273,   280,   295,   299,   249,   249,
-     300,   302,   237,   305,   320,   189,   307,   243,   254,   198,
-     270,   276,   210,   211,   209,   215,   313,   256,   239,   255,
-     205,   240,   217,   301,   304,   216,   204,   306,   203,   292,
-     322,   268,   249,   303,   316,   321,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   285,     0,     0,
+      69,    58,   105,    21,   119,    22,   132,    23,   263,   129,
+     130,    20,    64,    65,    66,    32,    76,    77,    78,    79,
+      80,    81,    82,    34,   189,    83,   131,   190,    84,    85,
+     189,    36,    68,   281,    86,   116,   117,    67,   101,   102,
+     103,   151,   293,   104,   118,   294,   152,    68,    38,    24,
+      25,    26,    27,    68,    68,    40,   164,    68,    68,   296,
+     297,   165,   298,   299,   170,   178,   186,   170,    61,   171,
+     179,   187,   249,    68,     1,     2,     3,     4,     5,     6,
+       7,     8,     9,   178,   186,   164,   274,   277,   253,   256,
+     272,   275,   278,   277,   312,   191,   192,   333,   279,   313,
+     326,    69,   334,   327,    42,   236,   237,    44,    46,   240,
+     241,   112,   125,   138,   141,   142,   193,   143,   144,   145,
+     105,   150,   105,   154,   155,   156,   157,   167,   119,   174,
+     119,   173,   182,   181,   184,   194,   132,   195,   132,   196,
+     197,   199,   204,   205,   200,   201,   206,   231,   232,   207,
+     202,   208,   209,   203,   211,   213,   214,   218,   219,   212,
+     220,   224,   226,   225,   230,   235,   233,   316,   234,   243,
+     244,   245,   251,   282,   280,   246,   284,   288,   286,   247,
+     287,   310,   295,   257,   314,   248,   315,   317,   322,   320,
+     335,   250,   252,   264,   264,   254,   198,   255,   258,   210,
+     259,   269,   239,   285,   291,   223,   319,   221,   222,   271,
+     328,   270,   227,   283,   229,   217,   321,   307,   228,   216,
+     215,   318,   331,   336,     0,   337,     0,   264,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   300,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   285
+       0,     0,   300
   };
 
-  const short int
+  const short
   D2Parser::yycheck_[] =
   {
-      50,    48,    52,     5,    54,     7,    56,     9,    13,    14,
-      23,     0,    10,    11,    12,     3,    13,    14,    15,    16,
-       8,    26,    19,     7,    21,    22,     3,     3,    24,    25,
-      27,     8,     8,    31,    47,     7,     3,    33,    28,    29,
-      30,     8,    47,    33,     7,    47,    48,    49,    50,    47,
-      47,    47,    33,    34,     3,    36,    37,    47,     3,     8,
-       3,     3,    47,     8,     6,     8,    47,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,     3,     3,     3,     3,
-       3,     8,     8,     8,     8,     8,     3,     3,     7,   136,
-     137,     8,     8,     3,     3,   145,     6,     6,     3,    17,
-      18,     6,     5,     5,     8,     5,     7,     3,     7,     7,
-       7,   161,     6,   163,     4,     3,    47,     4,     4,   169,
-       4,   171,     4,     6,     3,     6,     3,   177,     4,   179,
-       4,     4,     4,     4,     4,    48,    48,     4,   185,   186,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,    48,    20,    48,     7,     7,    47,     7,
-       7,     5,    47,     5,    32,     6,     4,    47,     4,    47,
-       5,   218,    47,     5,     7,     6,     4,     4,   228,   229,
-       4,     4,    47,     5,     4,   145,     7,   221,   229,   155,
-     262,   272,   171,   173,   169,   177,    35,   236,    47,   230,
-     165,    47,   180,    48,    47,   179,   163,    47,   161,   278,
-      47,   259,   262,   297,   311,   318,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   277,    -1,    -1,
+      50,    48,    52,     5,    54,     7,    56,     9,    27,    13,
+      14,     0,    10,    11,    12,     7,    13,    14,    15,    16,
+      17,    18,    19,     7,     3,    22,    30,     6,    25,    26,
+       3,     7,    51,     6,    31,    28,    29,    35,    32,    33,
+      34,     3,     3,    37,    37,     6,     8,    51,     5,    51,
+      52,    53,    54,    51,    51,     7,     3,    51,    51,    37,
+      38,     8,    40,    41,     3,     3,     3,     3,    51,     8,
+       8,     8,     8,    51,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,     3,     3,     3,     3,     3,     8,     8,
+       8,     8,     8,     3,     3,   142,   143,     3,     8,     8,
+       3,   151,     8,     6,     5,    20,    21,     7,     5,    23,
+      24,     7,     7,     7,     6,     3,    51,     4,     8,     3,
+     170,     4,   172,     4,     4,     4,     4,     4,   178,     3,
+     180,     6,     3,     6,     4,     4,   186,     4,   188,     4,
+       4,     4,     4,     4,    52,    52,     4,   194,   195,     4,
+      52,     4,     4,    52,     4,     4,     4,     4,     4,    52,
+       4,     4,     4,    52,     4,    51,     7,    52,     7,     7,
+       7,     5,     5,     4,     6,    51,     4,     7,     5,    51,
+       5,     4,     6,   230,     4,    51,     4,     4,     7,     5,
+       4,    51,    51,   243,   244,    51,   151,    51,   233,   164,
+      36,   244,   205,   277,   287,   182,    51,   178,   180,   251,
+      39,   245,   186,   274,   189,   174,    51,   293,   188,   172,
+     170,   312,   326,   333,    -1,    51,    -1,   277,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   292,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   297
+      -1,    -1,   312
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-       0,     5,     7,     9,    47,    48,    49,    50,    62,    63,
-      64,    68,     7,    73,     7,    79,     7,   139,     5,   133,
-       7,   107,     5,   101,     7,   122,     5,   117,    69,    65,
-      74,    80,   140,   134,   108,   102,   123,   118,    62,    70,
-      71,    47,    66,    67,    10,    11,    12,    31,    47,    72,
-      75,    76,    77,   150,   152,   154,    13,    14,    15,    16,
-      19,    21,    22,    27,    72,    81,    82,    83,    85,    86,
-      87,    90,    92,    94,   131,    28,    29,    30,    33,    72,
-     141,   142,   143,   145,   147,   148,     7,   135,   136,   137,
-      24,    25,    33,    72,   109,   110,   111,   113,   115,     7,
-     103,   104,   105,    13,    14,    26,    72,   124,   125,   126,
-     128,   130,     7,   119,   120,     6,     3,     4,     8,     3,
-     151,   153,    78,   155,     4,     3,     8,    84,     4,     4,
-      88,    91,    93,    95,   132,     3,     8,   146,     4,   149,
-     144,     3,     8,   138,     6,     3,   114,   116,   112,     3,
-       8,   106,     6,     3,   129,     4,   127,     3,     8,   121,
-       3,     6,    62,    62,    47,     4,     4,     4,     4,    76,
-       4,    48,    48,     4,     4,     4,     4,     4,    82,     4,
-      48,     4,     4,   142,   141,   137,     4,     4,     4,   110,
-     109,   105,     4,    48,     4,   125,   124,   120,     4,    62,
-      62,     7,     7,    47,    17,    18,    89,    20,     7,     7,
-       5,    47,    47,    47,     8,    47,     5,    47,     8,    47,
-      47,     8,    62,    81,    32,   156,   157,   158,    23,    72,
-      96,    97,    98,    99,    96,   135,   119,     8,   159,     3,
-       8,   100,     3,     8,     8,     6,     6,     4,   157,     4,
-      98,     5,     5,     7,   160,   161,   103,   162,     3,     6,
-       6,    33,    34,    36,    37,    72,   163,   164,   165,   167,
-     168,   170,   161,   166,   171,     4,   169,     3,     8,     4,
-       4,    48,     4,   164,    47,     5,    47,     7,   172,   173,
-     174,     3,     6,    35,   175,   176,   173,   177,     3,     8,
-       4,   176,    47
+       0,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+       0,     5,     7,     9,    51,    52,    53,    54,    66,    67,
+      68,    72,     7,    77,     7,    83,     7,   148,     5,   142,
+       7,   116,     5,   110,     7,   131,     5,   126,    73,    69,
+      78,    84,   149,   143,   117,   111,   132,   127,    66,    74,
+      75,    51,    70,    71,    10,    11,    12,    35,    51,    76,
+      79,    80,    81,   159,   161,   163,    13,    14,    15,    16,
+      17,    18,    19,    22,    25,    26,    31,    76,    85,    86,
+      87,    89,    90,    91,    92,    93,    95,    98,   101,   103,
+     140,    32,    33,    34,    37,    76,   150,   151,   152,   154,
+     156,   157,     7,   144,   145,   146,    28,    29,    37,    76,
+     118,   119,   120,   122,   124,     7,   112,   113,   114,    13,
+      14,    30,    76,   133,   134,   135,   137,   139,     7,   128,
+     129,     6,     3,     4,     8,     3,   160,   162,    82,   164,
+       4,     3,     8,    88,     4,     4,     4,     4,    94,    96,
+      99,   102,   104,   141,     3,     8,   155,     4,   158,   153,
+       3,     8,   147,     6,     3,   123,   125,   121,     3,     8,
+     115,     6,     3,   138,     4,   136,     3,     8,   130,     3,
+       6,    66,    66,    51,     4,     4,     4,     4,    80,     4,
+      52,    52,    52,    52,     4,     4,     4,     4,     4,     4,
+      86,     4,    52,     4,     4,   151,   150,   146,     4,     4,
+       4,   119,   118,   114,     4,    52,     4,   134,   133,   129,
+       4,    66,    66,     7,     7,    51,    20,    21,    97,    97,
+      23,    24,   100,     7,     7,     5,    51,    51,    51,     8,
+      51,     5,    51,     8,    51,    51,     8,    66,    85,    36,
+     165,   166,   167,    27,    76,   105,   106,   107,   108,   105,
+     144,   128,     8,   168,     3,     8,   109,     3,     8,     8,
+       6,     6,     4,   166,     4,   107,     5,     5,     7,   169,
+     170,   112,   171,     3,     6,     6,    37,    38,    40,    41,
+      76,   172,   173,   174,   176,   177,   179,   170,   175,   180,
+       4,   178,     3,     8,     4,     4,    52,     4,   173,    51,
+       5,    51,     7,   181,   182,   183,     3,     6,    39,   184,
+     185,   182,   186,     3,     8,     4,   185,    51
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    51,    53,    52,    54,    52,    55,    52,    56,    52,
-      57,    52,    58,    52,    59,    52,    60,    52,    61,    52,
-      62,    62,    62,    62,    62,    62,    62,    63,    65,    64,
-      66,    66,    67,    67,    69,    68,    70,    70,    71,    71,
-      72,    74,    73,    75,    75,    76,    76,    76,    76,    76,
-      78,    77,    80,    79,    81,    81,    82,    82,    82,    82,
-      82,    82,    82,    82,    82,    84,    83,    85,    86,    88,
-      87,    89,    89,    91,    90,    93,    92,    95,    94,    96,
-      96,    97,    97,    98,    98,   100,    99,   102,   101,   103,
-     103,   104,   104,   106,   105,   108,   107,   109,   109,   110,
-     110,   110,   110,   112,   111,   114,   113,   116,   115,   118,
-     117,   119,   119,   121,   120,   123,   122,   124,   124,   125,
-     125,   125,   125,   127,   126,   129,   128,   130,   132,   131,
-     134,   133,   135,   135,   136,   136,   138,   137,   140,   139,
-     141,   141,   142,   142,   142,   142,   142,   144,   143,   146,
-     145,   147,   149,   148,   151,   150,   153,   152,   155,   154,
-     156,   156,   157,   159,   158,   160,   160,   162,   161,   163,
-     163,   164,   164,   164,   164,   164,   166,   165,   167,   169,
-     168,   171,   170,   172,   172,   174,   173,   175,   175,   177,
-     176
+       0,    55,    57,    56,    58,    56,    59,    56,    60,    56,
+      61,    56,    62,    56,    63,    56,    64,    56,    65,    56,
+      66,    66,    66,    66,    66,    66,    66,    67,    69,    68,
+      70,    70,    71,    71,    73,    72,    74,    74,    75,    75,
+      76,    78,    77,    79,    79,    80,    80,    80,    80,    80,
+      82,    81,    84,    83,    85,    85,    86,    86,    86,    86,
+      86,    86,    86,    86,    86,    86,    86,    86,    88,    87,
+      89,    90,    91,    92,    94,    93,    96,    95,    97,    97,
+      99,    98,   100,   100,   102,   101,   104,   103,   105,   105,
+     106,   106,   107,   107,   109,   108,   111,   110,   112,   112,
+     113,   113,   115,   114,   117,   116,   118,   118,   119,   119,
+     119,   119,   121,   120,   123,   122,   125,   124,   127,   126,
+     128,   128,   130,   129,   132,   131,   133,   133,   134,   134,
+     134,   134,   136,   135,   138,   137,   139,   141,   140,   143,
+     142,   144,   144,   145,   145,   147,   146,   149,   148,   150,
+     150,   151,   151,   151,   151,   151,   153,   152,   155,   154,
+     156,   158,   157,   160,   159,   162,   161,   164,   163,   165,
+     165,   166,   168,   167,   169,   169,   171,   170,   172,   172,
+     173,   173,   173,   173,   173,   175,   174,   176,   178,   177,
+     180,   179,   181,   181,   183,   182,   184,   184,   186,   185
   };
 
-  const unsigned char
+  const signed char
   D2Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -2086,119 +2311,121 @@ namespace isc { namespace d2 {
        0,     1,     3,     5,     0,     4,     0,     1,     1,     3,
        2,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        0,     6,     0,     4,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     3,     3,     0,
-       4,     1,     1,     0,     4,     0,     6,     0,     6,     0,
-       1,     1,     3,     1,     1,     0,     6,     0,     4,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     6,     0,
-       4,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     0,     4,     3,     0,     6,
-       0,     4,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     3,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     3,     1,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     0,     4,     3,     0,
-       4,     0,     6,     1,     3,     0,     4,     1,     3,     0,
-       4
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       3,     3,     3,     3,     0,     4,     0,     4,     1,     1,
+       0,     4,     1,     1,     0,     6,     0,     6,     0,     1,
+       1,     3,     1,     1,     0,     6,     0,     4,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     6,     0,     4,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     1,     0,     4,     0,     4,     3,     0,     6,     0,
+       4,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       3,     0,     4,     0,     4,     0,     4,     0,     6,     1,
+       3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     0,     4,     3,     0,     4,
+       0,     6,     1,     3,     0,     4,     1,     3,     0,     4
   };
 
 
-
+#if D2_PARSER_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const D2Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
   "\"DhcpDdns\"", "\"ip-address\"", "\"port\"", "\"dns-server-timeout\"",
-  "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"", "\"ncr-format\"", "\"JSON\"",
-  "\"forward-ddns\"", "\"reverse-ddns\"", "\"ddns-domains\"",
-  "\"key-name\"", "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"",
-  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"Logging\"",
-  "\"loggers\"", "\"name\"", "\"output_options\"", "\"output\"",
-  "\"debuglevel\"", "\"severity\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS",
-  "SUB_DHCPDDNS", "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN",
-  "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER", "SUB_DNS_SERVERS",
-  "\"constant string\"", "\"integer\"", "\"floating point\"",
-  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
-  "$@6", "$@7", "$@8", "$@9", "value", "sub_json", "map2", "$@10",
-  "map_content", "not_empty_map", "list_generic", "$@11", "list_content",
-  "not_empty_list", "unknown_map_entry", "syntax_map", "$@12",
-  "global_objects", "global_object", "dhcpddns_object", "$@13",
-  "sub_dhcpddns", "$@14", "dhcpddns_params", "dhcpddns_param",
-  "ip_address", "$@15", "port", "dns_server_timeout", "ncr_protocol",
-  "$@16", "ncr_protocol_value", "ncr_format", "$@17", "forward_ddns",
-  "$@18", "reverse_ddns", "$@19", "ddns_mgr_params",
-  "not_empty_ddns_mgr_params", "ddns_mgr_param", "ddns_domains", "$@20",
-  "sub_ddns_domains", "$@21", "ddns_domain_list",
-  "not_empty_ddns_domain_list", "ddns_domain", "$@22", "sub_ddns_domain",
-  "$@23", "ddns_domain_params", "ddns_domain_param", "ddns_domain_name",
-  "$@24", "ddns_domain_key_name", "$@25", "dns_servers", "$@26",
-  "sub_dns_servers", "$@27", "dns_server_list", "dns_server", "$@28",
-  "sub_dns_server", "$@29", "dns_server_params", "dns_server_param",
-  "dns_server_hostname", "$@30", "dns_server_ip_address", "$@31",
-  "dns_server_port", "tsig_keys", "$@32", "sub_tsig_keys", "$@33",
-  "tsig_keys_list", "not_empty_tsig_keys_list", "tsig_key", "$@34",
-  "sub_tsig_key", "$@35", "tsig_key_params", "tsig_key_param",
-  "tsig_key_name", "$@36", "tsig_key_algorithm", "$@37",
-  "tsig_key_digest_bits", "tsig_key_secret", "$@38", "dhcp6_json_object",
-  "$@39", "dhcp4_json_object", "$@40", "logging_object", "$@41",
-  "logging_params", "logging_param", "loggers", "$@42", "loggers_entries",
-  "logger_entry", "$@43", "logger_params", "logger_param", "name", "$@44",
-  "debuglevel", "severity", "$@45", "output_options_list", "$@46",
-  "output_options_list_content", "output_entry", "$@47", "output_params",
-  "output_param", "$@48", YY_NULLPTR
+  "\"dns-update-threads\"", "\"dns-update-batch-size\"",
+  "\"dns-protocol\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
+  "\"ncr-format\"", "\"JSON\"", "\"BINARY\"", "\"forward-ddns\"",
+  "\"reverse-ddns\"", "\"ddns-domains\"", "\"key-name\"",
+  "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"", "\"algorithm\"",
+  "\"digest-bits\"", "\"secret\"", "\"Logging\"", "\"loggers\"",
+  "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
+  "\"severity\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS",
+  "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS",
+  "SUB_DNS_SERVER", "SUB_DNS_SERVERS", "\"constant string\"",
+  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
+  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value",
+  "sub_json", "map2", "$@10", "map_content", "not_empty_map",
+  "list_generic", "$@11", "list_content", "not_empty_list",
+  "unknown_map_entry", "syntax_map", "$@12", "global_objects",
+  "global_object", "dhcpddns_object", "$@13", "sub_dhcpddns", "$@14",
+  "dhcpddns_params", "dhcpddns_param", "ip_address", "$@15", "port",
+  "dns_server_timeout", "dns_update_threads", "dns_update_batch_size",
+  "dns_protocol", "$@16", "ncr_protocol", "$@17", "ncr_protocol_value",
+  "ncr_format", "$@18", "ncr_format_value", "forward_ddns", "$@19",
+  "reverse_ddns", "$@20", "ddns_mgr_params", "not_empty_ddns_mgr_params",
+  "ddns_mgr_param", "ddns_domains", "$@21", "sub_ddns_domains", "$@22",
+  "ddns_domain_list", "not_empty_ddns_domain_list", "ddns_domain", "$@23",
+  "sub_ddns_domain", "$@24", "ddns_domain_params", "ddns_domain_param",
+  "ddns_domain_name", "$@25", "ddns_domain_key_name", "$@26",
+  "dns_servers", "$@27", "sub_dns_servers", "$@28", "dns_server_list",
+  "dns_server", "$@29", "sub_dns_server", "$@30", "dns_server_params",
+  "dns_server_param", "dns_server_hostname", "$@31",
+  "dns_server_ip_address", "$@32", "dns_server_port", "tsig_keys", "$@33",
+  "sub_tsig_keys", "$@34", "tsig_keys_list", "not_empty_tsig_keys_list",
+  "tsig_key", "$@35", "sub_tsig_key", "$@36", "tsig_key_params",
+  "tsig_key_param", "tsig_key_name", "$@37", "tsig_key_algorithm", "$@38",
+  "tsig_key_digest_bits", "tsig_key_secret", "$@39", "dhcp6_json_object",
+  "$@40", "dhcp4_json_object", "$@41", "logging_object", "$@42",
+  "logging_params", "logging_param", "loggers", "$@43", "loggers_entries",
+  "logger_entry", "$@44", "logger_params", "logger_param", "name", "$@45",
+  "debuglevel", "severity", "$@46", "output_options_list", "$@47",
+  "output_options_list_content", "output_entry", "$@48", "output_params",
+  "output_param", "$@49", YY_NULLPTR
   };
+#endif
+
 
 #if D2_PARSER_DEBUG
-  const unsigned short int
+  const short
   D2Parser::yyrline_[] =
   {
-       0,   113,   113,   113,   114,   114,   115,   115,   116,   116,
-     117,   117,   118,   118,   119,   119,   120,   120,   121,   121,
-     129,   130,   131,   132,   133,   134,   135,   138,   143,   143,
-     155,   156,   159,   163,   170,   170,   177,   178,   181,   185,
-     196,   206,   206,   218,   219,   223,   224,   225,   226,   227,
-     232,   232,   242,   242,   250,   251,   255,   256,   257,   258,
-     259,   260,   261,   262,   263,   266,   266,   274,   282,   291,
-     291,   299,   300,   303,   303,   311,   311,   321,   321,   331,
-     332,   335,   336,   339,   340,   345,   345,   355,   355,   362,
-     363,   366,   367,   370,   370,   378,   378,   385,   386,   389,
-     390,   391,   392,   396,   396,   408,   408,   420,   420,   430,
-     430,   437,   438,   441,   441,   449,   449,   456,   457,   460,
-     461,   462,   463,   466,   466,   478,   478,   486,   500,   500,
-     510,   510,   517,   518,   521,   522,   525,   525,   533,   533,
-     542,   543,   546,   547,   548,   549,   550,   553,   553,   565,
-     565,   576,   584,   584,   599,   599,   606,   606,   618,   618,
-     631,   632,   636,   640,   640,   652,   653,   657,   657,   665,
-     666,   669,   670,   671,   672,   673,   676,   676,   684,   688,
-     688,   696,   696,   706,   707,   710,   710,   718,   719,   722,
-     722
+       0,   118,   118,   118,   119,   119,   120,   120,   121,   121,
+     122,   122,   123,   123,   124,   124,   125,   125,   126,   126,
+     134,   135,   136,   137,   138,   139,   140,   143,   148,   148,
+     160,   161,   164,   168,   175,   175,   182,   183,   186,   190,
+     201,   211,   211,   223,   224,   228,   229,   230,   231,   232,
+     237,   237,   247,   247,   255,   256,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   271,   274,   274,
+     282,   290,   299,   308,   317,   317,   324,   324,   332,   333,
+     336,   336,   344,   345,   348,   348,   358,   358,   368,   369,
+     372,   373,   376,   377,   382,   382,   392,   392,   399,   400,
+     403,   404,   407,   407,   415,   415,   422,   423,   426,   427,
+     428,   429,   433,   433,   445,   445,   457,   457,   467,   467,
+     474,   475,   478,   478,   486,   486,   493,   494,   497,   498,
+     499,   500,   503,   503,   515,   515,   523,   537,   537,   547,
+     547,   554,   555,   558,   559,   562,   562,   570,   570,   579,
+     580,   583,   584,   585,   586,   587,   590,   590,   602,   602,
+     613,   621,   621,   636,   636,   643,   643,   655,   655,   668,
+     669,   673,   677,   677,   689,   690,   694,   694,   702,   703,
+     706,   707,   708,   709,   710,   713,   713,   721,   725,   725,
+     733,   733,   743,   744,   747,   747,   755,   756,   759,   759
   };
 
-  // Print the state stack on the debug stream.
   void
-  D2Parser::yystack_print_ ()
+  D2Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  D2Parser::yy_reduce_print_ (int yyrule)
+  D2Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -2207,10 +2434,11 @@ namespace isc { namespace d2 {
 #endif // D2_PARSER_DEBUG
 
 
-#line 14 "d2_parser.yy" // lalr1.cc:1167
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2213 "d2_parser.cc" // lalr1.cc:1167
-#line 730 "d2_parser.yy" // lalr1.cc:1168
+#line 2440 "d2_parser.cc"
+
+#line 767 "d2_parser.yy"
 
 
 void
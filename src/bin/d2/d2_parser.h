@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +30,7 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+
 /**
  ** \file d2_parser.h
  ** Define the isc::d2::parser class.
@@ -37,10 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
 #ifndef YY_D2_PARSER_D2_PARSER_H_INCLUDED
 # define YY_D2_PARSER_D2_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "d2_parser.yy" // lalr1.cc:377
+// "%code requires" blocks.
+#line 17 "d2_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -52,7 +57,7 @@ using namespace isc::d2;
 using namespace isc::data;
 using namespace std;
 
-#line 56 "d2_parser.h" // lalr1.cc:377
+#line 61 "d2_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -60,56 +65,87 @@ using namespace std;
 # include <stdexcept>
 # include <string>
 # include <vector>
-# include "stack.hh"
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef D2_PARSER__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define D2_PARSER__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -122,6 +158,39 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
 /* Debug traces.  */
 #ifndef D2_PARSER_DEBUG
 # if defined YYDEBUG
@@ -135,120 +204,187 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined D2_PARSER_DEBUG */
 
-#line 14 "d2_parser.yy" // lalr1.cc:377
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 141 "d2_parser.h" // lalr1.cc:377
+#line 210 "d2_parser.h"
+
 
 
 
-  /// A char[S] buffer to store and retrieve objects.
+  /// A Bison parser.
+  class D2Parser
+  {
+  public:
+#ifdef D2_PARSER_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define D2_PARSER_STYPE in C++, use %define api.value.type"
+# endif
+    typedef D2_PARSER_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yytypeid_ (YY_NULLPTR)
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+      , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (const T& t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
-      new (yyas_<T> ()) T (t);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
+      new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
-    build ()
+    emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T;
+      return *new (yyas_<T> ()) T ();
     }
 
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
-    build (const T& t)
+    emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
 
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == typeid (T));
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == typeid (T));
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
-    /// should not be the variant's responsability.
+    /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type&& that)
     {
-      build<T> ();
-      swap<T> (other);
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
+#endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      build<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -261,154 +397,372 @@ namespace isc { namespace d2 {
     }
 
   private:
-    /// Prohibit blind copies.
-    self_type& operator=(const self_type&);
-    variant (const self_type&);
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class D2Parser
-  {
-  public:
-#ifndef D2_PARSER_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
       // value
       // ncr_protocol_value
-      char dummy1[sizeof(ElementPtr)];
+      // ncr_format_value
+      char dummy1[sizeof (ElementPtr)];
 
       // "boolean"
-      char dummy2[sizeof(bool)];
+      char dummy2[sizeof (bool)];
 
       // "floating point"
-      char dummy3[sizeof(double)];
+      char dummy3[sizeof (double)];
 
       // "integer"
-      char dummy4[sizeof(int64_t)];
+      char dummy4[sizeof (int64_t)];
 
       // "constant string"
-      char dummy5[sizeof(std::string)];
-};
+      char dummy5[sizeof (std::string)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof(union_type)> semantic_type;
-#else
-    typedef D2_PARSER_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP6 = 265,
-        TOKEN_DHCP4 = 266,
-        TOKEN_DHCPDDNS = 267,
-        TOKEN_IP_ADDRESS = 268,
-        TOKEN_PORT = 269,
-        TOKEN_DNS_SERVER_TIMEOUT = 270,
-        TOKEN_NCR_PROTOCOL = 271,
-        TOKEN_UDP = 272,
-        TOKEN_TCP = 273,
-        TOKEN_NCR_FORMAT = 274,
-        TOKEN_JSON = 275,
-        TOKEN_FORWARD_DDNS = 276,
-        TOKEN_REVERSE_DDNS = 277,
-        TOKEN_DDNS_DOMAINS = 278,
-        TOKEN_KEY_NAME = 279,
-        TOKEN_DNS_SERVERS = 280,
-        TOKEN_HOSTNAME = 281,
-        TOKEN_TSIG_KEYS = 282,
-        TOKEN_ALGORITHM = 283,
-        TOKEN_DIGEST_BITS = 284,
-        TOKEN_SECRET = 285,
-        TOKEN_LOGGING = 286,
-        TOKEN_LOGGERS = 287,
-        TOKEN_NAME = 288,
-        TOKEN_OUTPUT_OPTIONS = 289,
-        TOKEN_OUTPUT = 290,
-        TOKEN_DEBUGLEVEL = 291,
-        TOKEN_SEVERITY = 292,
-        TOKEN_TOPLEVEL_JSON = 293,
-        TOKEN_TOPLEVEL_DHCPDDNS = 294,
-        TOKEN_SUB_DHCPDDNS = 295,
-        TOKEN_SUB_TSIG_KEY = 296,
-        TOKEN_SUB_TSIG_KEYS = 297,
-        TOKEN_SUB_DDNS_DOMAIN = 298,
-        TOKEN_SUB_DDNS_DOMAINS = 299,
-        TOKEN_SUB_DNS_SERVER = 300,
-        TOKEN_SUB_DNS_SERVERS = 301,
-        TOKEN_STRING = 302,
-        TOKEN_INTEGER = 303,
-        TOKEN_FLOAT = 304,
-        TOKEN_BOOLEAN = 305
+      enum token_kind_type
+      {
+        TOKEN_D2_PARSER_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_D2_PARSER_error = 256,   // error
+    TOKEN_D2_PARSER_UNDEF = 257,   // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP6 = 265,             // "Dhcp6"
+    TOKEN_DHCP4 = 266,             // "Dhcp4"
+    TOKEN_DHCPDDNS = 267,          // "DhcpDdns"
+    TOKEN_IP_ADDRESS = 268,        // "ip-address"
+    TOKEN_PORT = 269,              // "port"
+    TOKEN_DNS_SERVER_TIMEOUT = 270, // "dns-server-timeout"
+    TOKEN_DNS_UPDATE_THREADS = 271, // "dns-update-threads"
+    TOKEN_DNS_UPDATE_BATCH_SIZE = 272, // "dns-update-batch-size"
+    TOKEN_DNS_PROTOCOL = 273,      // "dns-protocol"
+    TOKEN_NCR_PROTOCOL = 274,      // "ncr-protocol"
+    TOKEN_UDP = 275,               // "UDP"
+    TOKEN_TCP = 276,               // "TCP"
+    TOKEN_NCR_FORMAT = 277,        // "ncr-format"
+    TOKEN_JSON = 278,              // "JSON"
+    TOKEN_BINARY = 279,            // "BINARY"
+    TOKEN_FORWARD_DDNS = 280,      // "forward-ddns"
+    TOKEN_REVERSE_DDNS = 281,      // "reverse-ddns"
+    TOKEN_DDNS_DOMAINS = 282,      // "ddns-domains"
+    TOKEN_KEY_NAME = 283,          // "key-name"
+    TOKEN_DNS_SERVERS = 284,       // "dns-servers"
+    TOKEN_HOSTNAME = 285,          // "hostname"
+    TOKEN_TSIG_KEYS = 286,         // "tsig-keys"
+    TOKEN_ALGORITHM = 287,         // "algorithm"
+    TOKEN_DIGEST_BITS = 288,       // "digest-bits"
+    TOKEN_SECRET = 289,            // "secret"
+    TOKEN_LOGGING = 290,           // "Logging"
+    TOKEN_LOGGERS = 291,           // "loggers"
+    TOKEN_NAME = 292,              // "name"
+    TOKEN_OUTPUT_OPTIONS = 293,    // "output_options"
+    TOKEN_OUTPUT = 294,            // "output"
+    TOKEN_DEBUGLEVEL = 295,        // "debuglevel"
+    TOKEN_SEVERITY = 296,          // "severity"
+    TOKEN_TOPLEVEL_JSON = 297,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCPDDNS = 298, // TOPLEVEL_DHCPDDNS
+    TOKEN_SUB_DHCPDDNS = 299,      // SUB_DHCPDDNS
+    TOKEN_SUB_TSIG_KEY = 300,      // SUB_TSIG_KEY
+    TOKEN_SUB_TSIG_KEYS = 301,     // SUB_TSIG_KEYS
+    TOKEN_SUB_DDNS_DOMAIN = 302,   // SUB_DDNS_DOMAIN
+    TOKEN_SUB_DDNS_DOMAINS = 303,  // SUB_DDNS_DOMAINS
+    TOKEN_SUB_DNS_SERVER = 304,    // SUB_DNS_SERVER
+    TOKEN_SUB_DNS_SERVERS = 305,   // SUB_DNS_SERVERS
+    TOKEN_STRING = 306,            // "constant string"
+    TOKEN_INTEGER = 307,           // "integer"
+    TOKEN_FLOAT = 308,             // "floating point"
+    TOKEN_BOOLEAN = 309            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 55, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP6 = 10,                            // "Dhcp6"
+        S_DHCP4 = 11,                            // "Dhcp4"
+        S_DHCPDDNS = 12,                         // "DhcpDdns"
+        S_IP_ADDRESS = 13,                       // "ip-address"
+        S_PORT = 14,                             // "port"
+        S_DNS_SERVER_TIMEOUT = 15,               // "dns-server-timeout"
+        S_DNS_UPDATE_THREADS = 16,               // "dns-update-threads"
+        S_DNS_UPDATE_BATCH_SIZE = 17,            // "dns-update-batch-size"
+        S_DNS_PROTOCOL = 18,                     // "dns-protocol"
+        S_NCR_PROTOCOL = 19,                     // "ncr-protocol"
+        S_UDP = 20,                              // "UDP"
+        S_TCP = 21,                              // "TCP"
+        S_NCR_FORMAT = 22,                       // "ncr-format"
+        S_JSON = 23,                             // "JSON"
+        S_BINARY = 24,                           // "BINARY"
+        S_FORWARD_DDNS = 25,                     // "forward-ddns"
+        S_REVERSE_DDNS = 26,                     // "reverse-ddns"
+        S_DDNS_DOMAINS = 27,                     // "ddns-domains"
+        S_KEY_NAME = 28,                         // "key-name"
+        S_DNS_SERVERS = 29,                      // "dns-servers"
+        S_HOSTNAME = 30,                         // "hostname"
+        S_TSIG_KEYS = 31,                        // "tsig-keys"
+        S_ALGORITHM = 32,                        // "algorithm"
+        S_DIGEST_BITS = 33,                      // "digest-bits"
+        S_SECRET = 34,                           // "secret"
+        S_LOGGING = 35,                          // "Logging"
+        S_LOGGERS = 36,                          // "loggers"
+        S_NAME = 37,                             // "name"
+        S_OUTPUT_OPTIONS = 38,                   // "output_options"
+        S_OUTPUT = 39,                           // "output"
+        S_DEBUGLEVEL = 40,                       // "debuglevel"
+        S_SEVERITY = 41,                         // "severity"
+        S_TOPLEVEL_JSON = 42,                    // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCPDDNS = 43,                // TOPLEVEL_DHCPDDNS
+        S_SUB_DHCPDDNS = 44,                     // SUB_DHCPDDNS
+        S_SUB_TSIG_KEY = 45,                     // SUB_TSIG_KEY
+        S_SUB_TSIG_KEYS = 46,                    // SUB_TSIG_KEYS
+        S_SUB_DDNS_DOMAIN = 47,                  // SUB_DDNS_DOMAIN
+        S_SUB_DDNS_DOMAINS = 48,                 // SUB_DDNS_DOMAINS
+        S_SUB_DNS_SERVER = 49,                   // SUB_DNS_SERVER
+        S_SUB_DNS_SERVERS = 50,                  // SUB_DNS_SERVERS
+        S_STRING = 51,                           // "constant string"
+        S_INTEGER = 52,                          // "integer"
+        S_FLOAT = 53,                            // "floating point"
+        S_BOOLEAN = 54,                          // "boolean"
+        S_YYACCEPT = 55,                         // $accept
+        S_start = 56,                            // start
+        S_57_1 = 57,                             // $@1
+        S_58_2 = 58,                             // $@2
+        S_59_3 = 59,                             // $@3
+        S_60_4 = 60,                             // $@4
+        S_61_5 = 61,                             // $@5
+        S_62_6 = 62,                             // $@6
+        S_63_7 = 63,                             // $@7
+        S_64_8 = 64,                             // $@8
+        S_65_9 = 65,                             // $@9
+        S_value = 66,                            // value
+        S_sub_json = 67,                         // sub_json
+        S_map2 = 68,                             // map2
+        S_69_10 = 69,                            // $@10
+        S_map_content = 70,                      // map_content
+        S_not_empty_map = 71,                    // not_empty_map
+        S_list_generic = 72,                     // list_generic
+        S_73_11 = 73,                            // $@11
+        S_list_content = 74,                     // list_content
+        S_not_empty_list = 75,                   // not_empty_list
+        S_unknown_map_entry = 76,                // unknown_map_entry
+        S_syntax_map = 77,                       // syntax_map
+        S_78_12 = 78,                            // $@12
+        S_global_objects = 79,                   // global_objects
+        S_global_object = 80,                    // global_object
+        S_dhcpddns_object = 81,                  // dhcpddns_object
+        S_82_13 = 82,                            // $@13
+        S_sub_dhcpddns = 83,                     // sub_dhcpddns
+        S_84_14 = 84,                            // $@14
+        S_dhcpddns_params = 85,                  // dhcpddns_params
+        S_dhcpddns_param = 86,                   // dhcpddns_param
+        S_ip_address = 87,                       // ip_address
+        S_88_15 = 88,                            // $@15
+        S_port = 89,                             // port
+        S_dns_server_timeout = 90,               // dns_server_timeout
+        S_dns_update_threads = 91,               // dns_update_threads
+        S_dns_update_batch_size = 92,            // dns_update_batch_size
+        S_dns_protocol = 93,                     // dns_protocol
+        S_94_16 = 94,                            // $@16
+        S_ncr_protocol = 95,                     // ncr_protocol
+        S_96_17 = 96,                            // $@17
+        S_ncr_protocol_value = 97,               // ncr_protocol_value
+        S_ncr_format = 98,                       // ncr_format
+        S_99_18 = 99,                            // $@18
+        S_ncr_format_value = 100,                // ncr_format_value
+        S_forward_ddns = 101,                    // forward_ddns
+        S_102_19 = 102,                          // $@19
+        S_reverse_ddns = 103,                    // reverse_ddns
+        S_104_20 = 104,                          // $@20
+        S_ddns_mgr_params = 105,                 // ddns_mgr_params
+        S_not_empty_ddns_mgr_params = 106,       // not_empty_ddns_mgr_params
+        S_ddns_mgr_param = 107,                  // ddns_mgr_param
+        S_ddns_domains = 108,                    // ddns_domains
+        S_109_21 = 109,                          // $@21
+        S_sub_ddns_domains = 110,                // sub_ddns_domains
+        S_111_22 = 111,                          // $@22
+        S_ddns_domain_list = 112,                // ddns_domain_list
+        S_not_empty_ddns_domain_list = 113,      // not_empty_ddns_domain_list
+        S_ddns_domain = 114,                     // ddns_domain
+        S_115_23 = 115,                          // $@23
+        S_sub_ddns_domain = 116,                 // sub_ddns_domain
+        S_117_24 = 117,                          // $@24
+        S_ddns_domain_params = 118,              // ddns_domain_params
+        S_ddns_domain_param = 119,               // ddns_domain_param
+        S_ddns_domain_name = 120,                // ddns_domain_name
+        S_121_25 = 121,                          // $@25
+        S_ddns_domain_key_name = 122,            // ddns_domain_key_name
+        S_123_26 = 123,                          // $@26
+        S_dns_servers = 124,                     // dns_servers
+        S_125_27 = 125,                          // $@27
+        S_sub_dns_servers = 126,                 // sub_dns_servers
+        S_127_28 = 127,                          // $@28
+        S_dns_server_list = 128,                 // dns_server_list
+        S_dns_server = 129,                      // dns_server
+        S_130_29 = 130,                          // $@29
+        S_sub_dns_server = 131,                  // sub_dns_server
+        S_132_30 = 132,                          // $@30
+        S_dns_server_params = 133,               // dns_server_params
+        S_dns_server_param = 134,                // dns_server_param
+        S_dns_server_hostname = 135,             // dns_server_hostname
+        S_136_31 = 136,                          // $@31
+        S_dns_server_ip_address = 137,           // dns_server_ip_address
+        S_138_32 = 138,                          // $@32
+        S_dns_server_port = 139,                 // dns_server_port
+        S_tsig_keys = 140,                       // tsig_keys
+        S_141_33 = 141,                          // $@33
+        S_sub_tsig_keys = 142,                   // sub_tsig_keys
+        S_143_34 = 143,                          // $@34
+        S_tsig_keys_list = 144,                  // tsig_keys_list
+        S_not_empty_tsig_keys_list = 145,        // not_empty_tsig_keys_list
+        S_tsig_key = 146,                        // tsig_key
+        S_147_35 = 147,                          // $@35
+        S_sub_tsig_key = 148,                    // sub_tsig_key
+        S_149_36 = 149,                          // $@36
+        S_tsig_key_params = 150,                 // tsig_key_params
+        S_tsig_key_param = 151,                  // tsig_key_param
+        S_tsig_key_name = 152,                   // tsig_key_name
+        S_153_37 = 153,                          // $@37
+        S_tsig_key_algorithm = 154,              // tsig_key_algorithm
+        S_155_38 = 155,                          // $@38
+        S_tsig_key_digest_bits = 156,            // tsig_key_digest_bits
+        S_tsig_key_secret = 157,                 // tsig_key_secret
+        S_158_39 = 158,                          // $@39
+        S_dhcp6_json_object = 159,               // dhcp6_json_object
+        S_160_40 = 160,                          // $@40
+        S_dhcp4_json_object = 161,               // dhcp4_json_object
+        S_162_41 = 162,                          // $@41
+        S_logging_object = 163,                  // logging_object
+        S_164_42 = 164,                          // $@42
+        S_logging_params = 165,                  // logging_params
+        S_logging_param = 166,                   // logging_param
+        S_loggers = 167,                         // loggers
+        S_168_43 = 168,                          // $@43
+        S_loggers_entries = 169,                 // loggers_entries
+        S_logger_entry = 170,                    // logger_entry
+        S_171_44 = 171,                          // $@44
+        S_logger_params = 172,                   // logger_params
+        S_logger_param = 173,                    // logger_param
+        S_name = 174,                            // name
+        S_175_45 = 175,                          // $@45
+        S_debuglevel = 176,                      // debuglevel
+        S_severity = 177,                        // severity
+        S_178_46 = 178,                          // $@46
+        S_output_options_list = 179,             // output_options_list
+        S_180_47 = 180,                          // $@47
+        S_output_options_list_content = 181,     // output_options_list_content
+        S_output_entry = 182,                    // output_entry
+        S_183_48 = 183,                          // $@48
+        S_output_params = 184,                   // output_params
+        S_output_param = 185,                    // output_param
+        S_186_49 = 186                           // $@49
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -418,293 +772,347 @@ namespace isc { namespace d2 {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
 
-      /// Copy constructor.
-      basic_symbol (const basic_symbol& other);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const location_type& l);
+      default:
+        break;
+    }
 
-  basic_symbol (typename Base::kind_type t, const ElementPtr v, const location_type& l);
+      }
+#endif
 
-  basic_symbol (typename Base::kind_type t, const bool v, const location_type& l);
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const double v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const int64_t v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Constructor for symbols with semantic value.
-      basic_symbol (typename Base::kind_type t,
-                    const semantic_type& v,
-                    const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return D2Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
 
     private:
+#if YY_CPLUSPLUS < 201103L
       /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
-    /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
-
-    // Symbol constructors declarations.
-    static inline
-    symbol_type
-    make_END (const location_type& l);
-
-    static inline
-    symbol_type
-    make_COMMA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_COLON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LSQUARE_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RSQUARE_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LCURLY_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RCURLY_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NULL_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCPDDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_IP_ADDRESS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DNS_SERVER_TIMEOUT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NCR_PROTOCOL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_UDP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TCP (const location_type& l);
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
 
-    static inline
-    symbol_type
-    make_NCR_FORMAT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_JSON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_FORWARD_DDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_REVERSE_DDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DDNS_DOMAINS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_KEY_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DNS_SERVERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOSTNAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TSIG_KEYS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALGORITHM (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DIGEST_BITS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SECRET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LOGGING (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LOGGERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OUTPUT_OPTIONS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OUTPUT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DEBUGLEVEL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SEVERITY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TOPLEVEL_JSON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TOPLEVEL_DHCPDDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DHCPDDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_TSIG_KEY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_TSIG_KEYS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DDNS_DOMAIN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DDNS_DOMAINS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DNS_SERVER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DNS_SERVERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_STRING (const std::string& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTEGER (const int64_t& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_FLOAT (const double& v, const location_type& l);
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
 
-    static inline
-    symbol_type
-    make_BOOLEAN (const bool& v, const location_type& l);
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
 
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_D2_PARSER_error <= tok && tok <= token::TOKEN_SUB_DNS_SERVERS));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
     /// Build a parser object.
     D2Parser (isc::d2::D2ParserContext& ctx_yyarg);
     virtual ~D2Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    D2Parser (const D2Parser&) = delete;
+    /// Non copyable.
+    D2Parser& operator= (const D2Parser&) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
     /// Parse.
     /// \returns  0 iff parsing succeeded.
     virtual int parse ();
@@ -731,92 +1139,951 @@ namespace isc { namespace d2 {
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-  private:
-    /// This class is not copyable.
-    D2Parser (const D2Parser&);
-    D2Parser& operator= (const D2Parser&);
-
-    /// State numbers.
-    typedef int state_type;
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_D2_PARSER_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_D2_PARSER_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_D2_PARSER_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_D2_PARSER_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_UNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DNS_SERVER_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DNS_SERVER_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DNS_UPDATE_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_UPDATE_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DNS_UPDATE_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_UPDATE_THREADS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DNS_UPDATE_BATCH_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_UPDATE_BATCH_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DNS_UPDATE_BATCH_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_UPDATE_BATCH_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DNS_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DNS_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UDP (location_type l)
+      {
+        return symbol_type (token::TOKEN_UDP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UDP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UDP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FORWARD_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_FORWARD_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FORWARD_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FORWARD_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REVERSE_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_REVERSE_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REVERSE_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REVERSE_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DDNS_DOMAINS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DDNS_DOMAINS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DDNS_DOMAINS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DDNS_DOMAINS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEY_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_KEY_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEY_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_KEY_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DNS_SERVERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DNS_SERVERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TSIG_KEYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_TSIG_KEYS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TSIG_KEYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TSIG_KEYS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALGORITHM (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALGORITHM, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALGORITHM (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALGORITHM, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DIGEST_BITS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DIGEST_BITS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DIGEST_BITS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DIGEST_BITS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SECRET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SECRET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SECRET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SECRET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_TSIG_KEY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_TSIG_KEY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_TSIG_KEYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEYS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_TSIG_KEYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEYS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAIN (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAIN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAINS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAINS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DNS_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DNS_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DNS_SERVERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DNS_SERVERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
+#endif
+
+
+    class context
+    {
+    public:
+      context (const D2Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
 
+    private:
+      const D2Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    D2Parser (const D2Parser&);
+    /// Non copyable.
+    D2Parser& operator= (const D2Parser&);
+#endif
+
+
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const signed char yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short int yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned char yydefact_[];
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const signed char yypgoto_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short int yydefgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short int yytable_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const unsigned char yydefact_[];
 
-  static const short int yycheck_[];
+    // YYPGOTO[NTERM-NUM].
+    static const signed char yypgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned char yystos_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned char yyr1_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    static const short yycheck_[];
 
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const unsigned char yystos_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const unsigned char yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if D2_PARSER_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short int yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
-    // Debugging.
+    /// Debugging level.
     int yydebug_;
+    /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -835,29 +2102,30 @@ namespace isc { namespace d2 {
     struct by_state
     {
       /// Default constructor.
-      by_state ();
+      by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
-      by_state (kind_type s);
+      by_state (kind_type s) YY_NOEXCEPT;
 
       /// Copy constructor.
-      by_state (const by_state& other);
+      by_state (const by_state& that) YY_NOEXCEPT;
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -871,12 +2139,139 @@ namespace isc { namespace d2 {
       typedef basic_symbol<by_state> super_type;
       /// Construct an empty symbol.
       stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
       /// Steal the contents from \a sym to build this.
-      stack_symbol_type (state_type s, symbol_type& sym);
-      /// Assignment, needed by push_back.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
       stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
     };
 
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
+
+
     /// Stack type.
     typedef stack<stack_symbol_type> stack_type;
 
@@ -886,48 +2281,46 @@ namespace isc { namespace d2 {
     /// Push a new state on the stack.
     /// \param m    a debug message to display
     ///             if null, no trace is output.
-    /// \param s    the symbol
+    /// \param sym  the symbol
     /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, stack_symbol_type& s);
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
 
     /// Push a new look ahead token on the state on the stack.
     /// \param m    a debug message to display
     ///             if null, no trace is output.
     /// \param s    the state
     /// \param sym  the symbol (for its value and location).
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, state_type s, symbol_type& sym);
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
-    /// Pop \a n symbols the three stacks.
-    void yypop_ (unsigned int n = 1);
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 247,     ///< Last index in yytable_.
-      yynnts_ = 127,  ///< Number of nonterminal symbols.
-      yyfinal_ = 20, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 51  ///< Number of tokens.
+      yylast_ = 262,     ///< Last index in yytable_.
+      yynnts_ = 132,  ///< Number of nonterminal symbols.
+      yyfinal_ = 20 ///< Termination state number.
     };
 
 
     // User arguments.
     isc::d2::D2ParserContext& ctx;
+
   };
 
-  // Symbol number corresponding to token number t.
   inline
-  D2Parser::token_number_type
-  D2Parser::yytranslate_ (token_type t)
+  D2Parser::symbol_kind_type
+  D2Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const signed char
     translate_table[] =
     {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -957,60 +2350,48 @@ namespace isc { namespace d2 {
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54
     };
-    const unsigned int user_token_number_max_ = 305;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 309;
 
-    if (static_cast<int>(t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned int> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
-  inline
-  D2Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
   // basic_symbol.
   template <typename Base>
-  inline
-  D2Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-  {}
-
-  template <typename Base>
-  inline
-  D2Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& other)
-    : Base (other)
+  D2Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
     , value ()
-    , location (other.location)
+    , location (that.location)
   {
-      switch (other.type_get ())
+    switch (this->kind ())
     {
-      case 62: // value
-      case 89: // ncr_protocol_value
-        value.copy< ElementPtr > (other.value);
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 50: // "boolean"
-        value.copy< bool > (other.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 49: // "floating point"
-        value.copy< double > (other.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 48: // "integer"
-        value.copy< int64_t > (other.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 47: // "constant string"
-        value.copy< std::string > (other.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -1020,541 +2401,120 @@ namespace isc { namespace d2 {
   }
 
 
-  template <typename Base>
-  inline
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const semantic_type& v, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {
-    (void) v;
-      switch (this->type_get ())
-    {
-      case 62: // value
-      case 89: // ncr_protocol_value
-        value.copy< ElementPtr > (v);
-        break;
-
-      case 50: // "boolean"
-        value.copy< bool > (v);
-        break;
-
-      case 49: // "floating point"
-        value.copy< double > (v);
-        break;
-
-      case 48: // "integer"
-        value.copy< int64_t > (v);
-        break;
-
-      case 47: // "constant string"
-        value.copy< std::string > (v);
-        break;
-
-      default:
-        break;
-    }
-}
-
-
-  // Implementation of basic_symbol constructor for each type.
-
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {}
-
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ElementPtr v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const bool v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const double v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
 
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const int64_t v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
 
   template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-
-  template <typename Base>
-  inline
-  D2Parser::basic_symbol<Base>::~basic_symbol ()
+  D2Parser::symbol_kind_type
+  D2Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
-    clear ();
+    return this->kind ();
   }
 
-  template <typename Base>
-  inline
-  void
-  D2Parser::basic_symbol<Base>::clear ()
-  {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-    switch (yytype)
-    {
-      case 62: // value
-      case 89: // ncr_protocol_value
-        value.template destroy< ElementPtr > ();
-        break;
-
-      case 50: // "boolean"
-        value.template destroy< bool > ();
-        break;
-
-      case 49: // "floating point"
-        value.template destroy< double > ();
-        break;
-
-      case 48: // "integer"
-        value.template destroy< int64_t > ();
-        break;
-
-      case 47: // "constant string"
-        value.template destroy< std::string > ();
-        break;
-
-      default:
-        break;
-    }
-
-    Base::clear ();
-  }
 
   template <typename Base>
-  inline
   bool
-  D2Parser::basic_symbol<Base>::empty () const
+  D2Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
-  inline
   void
   D2Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
-    super_type::move(s);
-      switch (this->type_get ())
+    super_type::move (s);
+    switch (this->kind ())
     {
-      case 62: // value
-      case 89: // ncr_protocol_value
-        value.move< ElementPtr > (s.value);
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 50: // "boolean"
-        value.move< bool > (s.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 49: // "floating point"
-        value.move< double > (s.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 48: // "integer"
-        value.move< int64_t > (s.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 47: // "constant string"
-        value.move< std::string > (s.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (s.value));
         break;
 
       default:
         break;
     }
 
-    location = s.location;
+    location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  D2Parser::by_type::by_type ()
-    : type (empty_symbol)
+  D2Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
+#if 201103L <= YY_CPLUSPLUS
   inline
-  D2Parser::by_type::by_type (const by_type& other)
-    : type (other.type)
+  D2Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
+
+  inline
+  D2Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  D2Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  D2Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  D2Parser::by_type::clear ()
+  D2Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  D2Parser::by_type::move (by_type& that)
+  D2Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  D2Parser::by_type::type_get () const
-  {
-    return type;
-  }
-
-  inline
-  D2Parser::token_type
-  D2Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short int
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-  // Implementation of make_symbol for each symbol type.
-  D2Parser::symbol_type
-  D2Parser::make_END (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_END, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_COMMA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COMMA, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_COLON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COLON, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_LSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_RSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_LCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_RCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_NULL_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DHCP6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DHCP4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP4, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCPDDNS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_IP_ADDRESS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PORT, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DNS_SERVER_TIMEOUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_NCR_PROTOCOL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_UDP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_UDP, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_TCP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TCP, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_NCR_FORMAT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_JSON, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_FORWARD_DDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FORWARD_DDNS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_REVERSE_DDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_REVERSE_DDNS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DDNS_DOMAINS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DDNS_DOMAINS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_KEY_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_KEY_NAME, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DNS_SERVERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DNS_SERVERS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_HOSTNAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_TSIG_KEYS (const location_type& l)
+  D2Parser::symbol_kind_type
+  D2Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_TSIG_KEYS, l);
+    return kind_;
   }
 
-  D2Parser::symbol_type
-  D2Parser::make_ALGORITHM (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALGORITHM, l);
-  }
 
-  D2Parser::symbol_type
-  D2Parser::make_DIGEST_BITS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DIGEST_BITS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SECRET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SECRET, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_LOGGING (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_LOGGERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NAME, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_OUTPUT_OPTIONS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_OUTPUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_DEBUGLEVEL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SEVERITY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SEVERITY, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_TOPLEVEL_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_TOPLEVEL_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCPDDNS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_TSIG_KEY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_TSIG_KEY, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_TSIG_KEYS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_TSIG_KEYS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DDNS_DOMAIN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DDNS_DOMAINS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DNS_SERVER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DNS_SERVER, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DNS_SERVERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DNS_SERVERS, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_STRING (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_STRING, v, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_INTEGER (const int64_t& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTEGER, v, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_FLOAT (const double& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, v, l);
-  }
-
-  D2Parser::symbol_type
-  D2Parser::make_BOOLEAN (const bool& v, const location_type& l)
+  inline
+  D2Parser::symbol_kind_type
+  D2Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_BOOLEAN, v, l);
+    return this->kind ();
   }
 
 
-#line 14 "d2_parser.yy" // lalr1.cc:377
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 1558 "d2_parser.h" // lalr1.cc:377
+#line 2518 "d2_parser.h"
 
 
 
@@ -56,11 +56,15 @@ using namespace std;
   IP_ADDRESS "ip-address"
   PORT "port"
   DNS_SERVER_TIMEOUT "dns-server-timeout"
+  DNS_UPDATE_THREADS "dns-update-threads"
+  DNS_UPDATE_BATCH_SIZE "dns-update-batch-size"
+  DNS_PROTOCOL "dns-protocol"
   NCR_PROTOCOL "ncr-protocol"
   UDP "UDP"
   TCP "TCP"
   NCR_FORMAT "ncr-format"
   JSON "JSON"
+  BINARY "BINARY"
   FORWARD_DDNS "forward-ddns"
   REVERSE_DDNS "reverse-ddns"
   DDNS_DOMAINS "ddns-domains"
@@ -100,6 +104,7 @@ using namespace std;
 
 %type <ElementPtr> value
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 
 %printer { yyoutput << $$; } <*>;
 
@@ -255,6 +260,9 @@ dhcpddns_params: dhcpddns_param
 dhcpddns_param: ip_address
               | port
               | dns_server_timeout
+              | dns_update_threads
+              | dns_update_batch_size
+              | dns_protocol
               | ncr_protocol
               | ncr_format
               | forward_ddns
@@ -288,6 +296,31 @@ dns_server_timeout: DNS_SERVER_TIMEOUT COLON INTEGER {
     }
 };
 
+dns_update_threads: DNS_UPDATE_THREADS COLON INTEGER {
+    if ($3 < 0) {
+        error(@3, "dns-update-threads must not be negative");
+    } else {
+        ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+        ctx.stack_.back()->set("dns-update-threads", i);
+    }
+};
+
+dns_update_batch_size: DNS_UPDATE_BATCH_SIZE COLON INTEGER {
+    if ($3 <= 0) {
+        error(@3, "dns-update-batch-size must be greater than zero");
+    } else {
+        ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+        ctx.stack_.back()->set("dns-update-batch-size", i);
+    }
+};
+
+dns_protocol: DNS_PROTOCOL {
+    ctx.enter(ctx.DNS_PROTOCOL);
+} COLON ncr_protocol_value {
+    ctx.stack_.back()->set("dns-protocol", $4);
+    ctx.leave();
+};
+
 ncr_protocol: NCR_PROTOCOL {
     ctx.enter(ctx.NCR_PROTOCOL);
 } COLON ncr_protocol_value {
@@ -302,12 +335,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 forward_ddns : FORWARD_DDNS {
     ElementPtr m(new MapElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("forward-ddns", m);
@@ -195,6 +195,10 @@ D2Process::configure(isc::data::ConstElementPtr config_set) {
     LOG_DEBUG(d2_logger, DBGLVL_TRACE_BASIC,
               DHCP_DDNS_CONFIGURE).arg(config_set->str());
 
+    // The update threads use the configuration: stop them while it is
+    // replaced.
+    update_mgr_->pauseUpdates();
+
     int rcode = 0;
     isc::data::ConstElementPtr comment;
     isc::data::ConstElementPtr answer = getCfgMgr()->parseConfig(config_set);;
@@ -205,6 +209,7 @@ D2Process::configure(isc::data::ConstElementPtr config_set) {
         // action. In integrated mode, this will send a failed response back
         // to the configuration backend.
         reconf_queue_flag_ = false;
+        update_mgr_->resumeUpdates();
         return (answer);
     }
 
@@ -221,6 +226,20 @@ D2Process::configure(isc::data::ConstElementPtr config_set) {
     // did some analysis to decide what if anything we need to do.)
     reconf_queue_flag_ = true;
 
+    // Apply the number of threads carrying out the DNS updates. Moving the
+    // transactions to or from these threads is deferred by the update
+    // manager until the transactions in progress are done.
+    update_mgr_->setUpdateThreads(getD2CfgMgr()->getD2Params()->
+                                  getDnsUpdateThreads());
+    update_mgr_->setMaxBatchSize(getD2CfgMgr()->getD2Params()->
+                                 getDnsUpdateBatchSize());
+    DNSClient::Protocol dns_protocol = DNSClient::UDP;
+    if (getD2CfgMgr()->getD2Params()->getDnsProtocol() == dhcp_ddns::NCR_TCP) {
+        dns_protocol = DNSClient::TCP;
+    }
+    update_mgr_->setDnsProtocol(dns_protocol);
+    update_mgr_->resumeUpdates();
+
     // If we are here, configuration was valid, at least it parsed correctly
     // and therefore contained no invalid values.
     // Return the success answer from above.
@@ -99,6 +99,10 @@ public:
     /// since it was last called, the event loop will block at this step until
     /// an IO event occurs.  At that time we return to the top of the loop.
     ///
+    /// When DNS update threads are configured, the transactions' IO events
+    /// are processed by these threads rather than by this loop, which is
+    /// woken up each time a transaction is done.
+    ///
     /// @throw DProcessBaseError if an error is encountered.  Note that
     /// exceptions thrown at this point are assumed to be FATAL exceptions.
     /// This includes exceptions generated but not caught by IO callbacks.
@@ -8,6 +8,11 @@
 #include <d2/d2_log.h>
 #include <d2/d2_queue_mgr.h>
 #include <dhcp_ddns/ncr_udp.h>
+#include <stats/stats_mgr.h>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
 
 namespace isc {
 namespace d2 {
@@ -17,7 +22,9 @@ const size_t D2QueueMgr::MAX_QUEUE_DEFAULT;
 
 D2QueueMgr::D2QueueMgr(asiolink::IOServicePtr& io_service, const size_t max_queue_size)
     : io_service_(io_service), max_queue_size_(max_queue_size),
-      mgr_state_(NOT_INITTED), target_stop_state_(NOT_INITTED) {
+      ncr_queue_(), ncr_index_(), supersede_requests_(true),
+      superseded_count_(0), mgr_state_(NOT_INITTED),
+      target_stop_state_(NOT_INITTED) {
     if (!io_service_) {
         isc_throw(D2QueueMgrError, "IOServicePtr cannot be null");
     }
@@ -218,6 +225,7 @@ D2QueueMgr::dequeueAt(const size_t index) {
     }
 
     RequestQueue::iterator pos = ncr_queue_.begin() + index;
+    unindex(*pos);
     ncr_queue_.erase(pos);
 }
 
@@ -229,17 +237,91 @@ D2QueueMgr::dequeue() {
                   "D2QueueMgr dequeue attempted on an empty queue");
     }
 
+    unindex(ncr_queue_.front());
     ncr_queue_.pop_front();
 }
 
 void
 D2QueueMgr::enqueue(dhcp_ddns::NameChangeRequestPtr& ncr) {
+    if (supersede_requests_) {
+        supersede(ncr);
+    }
+
     ncr_queue_.push_back(ncr);
+    ncr_index_.insert(RequestIndex::value_type(makeIndexKey(ncr->getDhcid(),
+                                                            ncr->getFqdn()),
+                                               ncr));
 }
 
 void
 D2QueueMgr::clearQueue() {
     ncr_queue_.clear();
+    ncr_index_.clear();
+}
+
+size_t
+D2QueueMgr::getRequestCount(const dhcp_ddns::D2Dhcid& dhcid,
+                            const std::string& fqdn) const {
+    return (ncr_index_.count(makeIndexKey(dhcid, fqdn)));
+}
+
+bool
+D2QueueMgr::supersedes(const dhcp_ddns::NameChangeRequest& ncr,
+                       const dhcp_ddns::NameChangeRequest& other) {
+    return ((makeIndexKey(ncr.getDhcid(), ncr.getFqdn()) ==
+             makeIndexKey(other.getDhcid(), other.getFqdn())) &&
+            (ncr.getIpIoAddress() == other.getIpIoAddress()) &&
+            (ncr.isForwardChange() || !other.isForwardChange()) &&
+            (ncr.isReverseChange() || !other.isReverseChange()));
+}
+
+std::string
+D2QueueMgr::makeIndexKey(const dhcp_ddns::D2Dhcid& dhcid,
+                         const std::string& fqdn) {
+    // DNS names are case insensitive.
+    return (dhcid.toStr() + " " + boost::algorithm::to_lower_copy(fqdn));
+}
+
+void
+D2QueueMgr::unindex(const dhcp_ddns::NameChangeRequestPtr& ncr) {
+    std::pair<RequestIndex::iterator, RequestIndex::iterator> range =
+        ncr_index_.equal_range(makeIndexKey(ncr->getDhcid(), ncr->getFqdn()));
+    for (RequestIndex::iterator it = range.first; it != range.second; ++it) {
+        if (it->second == ncr) {
+            ncr_index_.erase(it);
+            return;
+        }
+    }
+}
+
+void
+D2QueueMgr::supersede(const dhcp_ddns::NameChangeRequestPtr& ncr) {
+    std::pair<RequestIndex::iterator, RequestIndex::iterator> range =
+        ncr_index_.equal_range(makeIndexKey(ncr->getDhcid(), ncr->getFqdn()));
+    RequestIndex::iterator it = range.first;
+    while (it != range.second) {
+        if (!supersedes(*ncr, *(it->second))) {
+            ++it;
+            continue;
+        }
+
+        // Supersession happens only while clients flap, so a linear search
+        // of the queue is acceptable here.
+        RequestQueue::iterator pos = std::find(ncr_queue_.begin(),
+                                               ncr_queue_.end(), it->second);
+        if (pos != ncr_queue_.end()) {
+            ncr_queue_.erase(pos);
+        }
+
+        LOG_DEBUG(dhcp_to_d2_logger, DBGLVL_TRACE_DETAIL_DATA,
+                  DHCP_DDNS_QUEUE_MGR_REQUEST_SUPERSEDED)
+                  .arg(it->second->getRequestId())
+                  .arg(ncr->getRequestId());
+        ncr_index_.erase(it++);
+        ++superseded_count_;
+        stats::StatsMgr::instance().addValue("ncr-superseded",
+                                             static_cast<int64_t>(1));
+    }
 }
 
 void
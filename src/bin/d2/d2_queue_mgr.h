@@ -16,6 +16,8 @@
 
 #include <boost/noncopyable.hpp>
 #include <deque>
+#include <map>
+#include <string>
 
 namespace isc {
 namespace d2 {
@@ -24,6 +26,10 @@ namespace d2 {
 /// @todo This may be replaced with an actual class in the future.
 typedef std::deque<dhcp_ddns::NameChangeRequestPtr> RequestQueue;
 
+/// @brief Defines an index of the queued requests by DHCID and FQDN.
+typedef std::multimap<std::string, dhcp_ddns::NameChangeRequestPtr>
+    RequestIndex;
+
 /// @brief Thrown if the queue manager encounters a general error.
 class D2QueueMgrError : public isc::Exception {
 public:
@@ -126,6 +132,15 @@ public:
 /// until they are removed explicitly via the deque() or implicitly by
 /// via the clearQueue() method.
 ///
+/// The queued requests are indexed by DHCID and FQDN.  Unless disabled with
+/// setSupersedeRequests(), a request added to the queue supersedes the
+/// queued requests for the same DHCID, FQDN and IP address whose forward
+/// and reverse changes it also covers: those requests are removed from the
+/// queue as carrying them out would only be undone by the newer request.
+/// This avoids useless DNS updates when a client's lease flaps between
+/// being granted and released.  Requests for the same client which differ
+/// in address or direction are left in place.
+///
 class D2QueueMgr : public dhcp_ddns::NameChangeListener::RequestReceiveHandler,
                    boost::noncopyable {
 public:
@@ -305,13 +320,72 @@ public:
 
     /// @brief Adds a request to the end of the queue.
     ///
+    /// If superseding is enabled, the queued requests superseded by the
+    /// new request are removed from the queue and counted in the
+    /// "ncr-superseded" statistic.
+    ///
     /// @param ncr pointer to the NameChangeRequest to add to the queue.
     void enqueue(dhcp_ddns::NameChangeRequestPtr& ncr);
 
     /// @brief Removes all entries from the queue.
     void clearQueue();
 
+    /// @brief Indicates whether new requests supersede queued ones.
+    bool getSupersedeRequests() const {
+        return (supersede_requests_);
+    }
+
+    /// @brief Enables or disables superseding of queued requests.
+    ///
+    /// @param supersede_requests true (the default) to have a new request
+    /// supersede the queued requests it makes useless.
+    void setSupersedeRequests(const bool supersede_requests) {
+        supersede_requests_ = supersede_requests;
+    }
+
+    /// @brief Returns the number of requests superseded since construction.
+    size_t getSupersededCount() const {
+        return (superseded_count_);
+    }
+
+    /// @brief Returns the number of queued requests for a DHCID and FQDN.
+    ///
+    /// @param dhcid the DHCID of the client
+    /// @param fqdn the FQDN, in any case
+    size_t getRequestCount(const dhcp_ddns::D2Dhcid& dhcid,
+                           const std::string& fqdn) const;
+
+    /// @brief Determines whether a request makes another one useless.
+    ///
+    /// A request supersedes another one if both have the same DHCID, FQDN
+    /// and IP address and the request updates at least the same directions,
+    /// forward or reverse, as the other one.
+    ///
+    /// @param ncr the newer request
+    /// @param other the older request
+    ///
+    /// @return true if ncr supersedes other.
+    static bool supersedes(const dhcp_ddns::NameChangeRequest& ncr,
+                           const dhcp_ddns::NameChangeRequest& other);
+
   private:
+    /// @brief Returns the index key of a request.
+    ///
+    /// @param dhcid the DHCID of the client
+    /// @param fqdn the FQDN, in any case
+    static std::string makeIndexKey(const dhcp_ddns::D2Dhcid& dhcid,
+                                    const std::string& fqdn);
+
+    /// @brief Removes a request from the index.
+    ///
+    /// @param ncr the request to remove
+    void unindex(const dhcp_ddns::NameChangeRequestPtr& ncr);
+
+    /// @brief Removes from the queue the requests superseded by a request.
+    ///
+    /// @param ncr the new request
+    void supersede(const dhcp_ddns::NameChangeRequestPtr& ncr);
+
     /// @brief Sets the manager state to the target stop state.
     ///
     /// Convenience method which sets the manager state to the target stop
@@ -327,6 +401,15 @@ public:
     /// @brief Queue of received NameChangeRequests.
     RequestQueue ncr_queue_;
 
+    /// @brief Index of the queued requests by DHCID and FQDN.
+    RequestIndex ncr_index_;
+
+    /// @brief Indicates whether new requests supersede queued ones.
+    bool supersede_requests_;
+
+    /// @brief Number of requests superseded since construction.
+    size_t superseded_count_;
+
     /// @brief Listener instance from which requests are received.
     boost::shared_ptr<dhcp_ddns::NameChangeListener> listener_;
 
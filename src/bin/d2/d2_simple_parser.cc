@@ -38,7 +38,10 @@ const SimpleDefaults D2SimpleParser::D2_GLOBAL_DEFAULTS = {
     { "port",               Element::integer, "53001" },
     { "dns-server-timeout", Element::integer, "100" }, // in seconds
     { "ncr-protocol",       Element::string, "UDP" },
-    { "ncr-format",         Element::string, "JSON" }
+    { "ncr-format",         Element::string, "JSON" },
+    { "dns-update-threads", Element::integer, "0" },
+    { "dns-update-batch-size", Element::integer, "1" },
+    { "dns-protocol",       Element::string, "UDP" }
 };
 
 /// Supplies defaults for ddns-domoains list elements (i.e. DdnsDomains)
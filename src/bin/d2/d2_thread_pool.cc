@@ -0,0 +1,92 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/asio_wrapper.h>
+#include <d2/d2_log.h>
+#include <d2/d2_thread_pool.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/bind.hpp>
+
+using namespace isc::util::thread;
+
+namespace isc {
+namespace d2 {
+
+D2ThreadPool::D2ThreadPool(const asiolink::IOServicePtr& io_service)
+    : io_service_(io_service), threads_() {
+    if (!io_service_) {
+        isc_throw(BadValue, "D2ThreadPool IOService cannot be null");
+    }
+}
+
+D2ThreadPool::~D2ThreadPool() {
+    stop();
+}
+
+void
+D2ThreadPool::start(const size_t num_threads) {
+    if (isRunning()) {
+        isc_throw(InvalidOperation, "D2ThreadPool threads are already running");
+    }
+
+    if (num_threads == 0) {
+        isc_throw(BadValue, "D2ThreadPool number of threads must be greater"
+                  " than zero");
+    }
+
+    // Loggers are instantiated upon their first use, which is not thread
+    // safe: make sure the loggers used by the handlers exist beforehand.
+    d2_logger.isDebugEnabled();
+    dhcp_to_d2_logger.isDebugEnabled();
+    d2_to_dns_logger.isDebugEnabled();
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads_.push_back(boost::shared_ptr<Thread>
+                           (new Thread(boost::bind(&D2ThreadPool::run,
+                                                   this))));
+    }
+
+    LOG_INFO(d2_logger, DHCP_DDNS_UPDATE_THREADS_STARTED).arg(num_threads);
+}
+
+void
+D2ThreadPool::stop() {
+    if (!isRunning()) {
+        return;
+    }
+
+    io_service_->stop();
+    for (size_t i = 0; i < threads_.size(); ++i) {
+        threads_[i]->wait();
+    }
+    threads_.clear();
+
+    // A stopped io_service must be reset before it can run again.
+    io_service_->get_io_service().reset();
+
+    LOG_DEBUG(d2_logger, DBGLVL_START_SHUT, DHCP_DDNS_UPDATE_THREADS_STOPPED);
+}
+
+void
+D2ThreadPool::run() {
+    boost::asio::io_service& io_service = io_service_->get_io_service();
+    for (;;) {
+        try {
+            // Returns once the IOService is stopped.
+            io_service.run();
+            return;
+        } catch (const std::exception& ex) {
+            LOG_ERROR(d2_logger, DHCP_DDNS_UPDATE_THREAD_ERROR)
+                .arg(ex.what());
+        }
+    }
+}
+
+} // namespace isc::d2
+} // namespace isc
@@ -0,0 +1,97 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef D2_THREAD_POOL_H
+#define D2_THREAD_POOL_H
+
+/// @file d2_thread_pool.h This file defines the class D2ThreadPool.
+
+#include <asiolink/io_service.h>
+#include <util/threads/thread.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Pool of threads running an IOService.
+///
+/// D2ThreadPool runs the event loop of an IOService on a number of threads,
+/// so that the handlers posted to the IOService, or invoked upon the
+/// completion of its IO, are executed concurrently.  Handlers which must
+/// not run concurrently with each other must be serialized by the caller,
+/// typically by dispatching them through a boost::asio::io_service::strand.
+///
+/// An exception thrown by a handler is logged and the thread which ran the
+/// handler resumes running the IOService.
+class D2ThreadPool : public boost::noncopyable {
+public:
+    /// @brief Constructor
+    ///
+    /// The threads are not started until @c start is called.
+    ///
+    /// @param io_service IOService to run.
+    ///
+    /// @throw isc::BadValue if the IOService is null.
+    explicit D2ThreadPool(const asiolink::IOServicePtr& io_service);
+
+    /// @brief Destructor
+    ///
+    /// Stops the threads.
+    ~D2ThreadPool();
+
+    /// @brief Starts the threads.
+    ///
+    /// @param num_threads number of threads to start.
+    ///
+    /// @throw isc::InvalidOperation if the threads are already running.
+    /// @throw isc::BadValue if the number of threads is zero.
+    void start(const size_t num_threads);
+
+    /// @brief Stops the threads and waits for them to terminate.
+    ///
+    /// The threads return as soon as the handlers they are running are
+    /// complete.  The handlers not yet run are kept by the IOService and
+    /// are run once the threads are started again.  Does nothing if the
+    /// threads are not running.
+    void stop();
+
+    /// @brief Returns the number of threads running the IOService.
+    size_t getThreadCount() const {
+        return (threads_.size());
+    }
+
+    /// @brief Indicates whether the threads are running.
+    bool isRunning() const {
+        return (!threads_.empty());
+    }
+
+    /// @brief Returns the IOService run by the threads.
+    const asiolink::IOServicePtr& getIOService() const {
+        return (io_service_);
+    }
+
+private:
+    /// @brief Main function of a thread.
+    void run();
+
+    /// @brief IOService run by the threads.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief The threads.
+    std::vector<boost::shared_ptr<util::thread::Thread> > threads_;
+};
+
+/// @brief Defines a pointer to a D2ThreadPool.
+typedef boost::shared_ptr<D2ThreadPool> D2ThreadPoolPtr;
+
+} // namespace isc::d2
+} // namespace isc
+
+#endif // D2_THREAD_POOL_H
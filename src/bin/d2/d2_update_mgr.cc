@@ -7,22 +7,79 @@
 #include <config.h>
 
 #include <d2/d2_update_mgr.h>
+#include <d2/dns_tcp_connection.h>
 #include <d2/nc_add.h>
+#include <d2/nc_add_batch.h>
 #include <d2/nc_remove.h>
+#include <stats/stats_mgr.h>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/bind.hpp>
 
 #include <sstream>
 #include <iostream>
+#include <set>
 #include <vector>
 
 namespace isc {
 namespace d2 {
 
 const size_t D2UpdateMgr::MAX_TRANSACTIONS_DEFAULT;
+const size_t D2UpdateMgr::MAX_BATCH_SIZE_DEFAULT;
+const size_t D2UpdateMgr::MAX_BATCH_MESSAGE_SIZE_DEFAULT;
+const size_t D2UpdateMgr::BATCH_SCAN_LIMIT;
+
+namespace {
+
+/// @brief Matches a request to the domains of its change directions.
+///
+/// Unlike D2UpdateMgr::makeTransaction() this has no side effects: a
+/// request asking for changes in a disabled direction does not match.
+///
+/// @param cfg_mgr the configuration manager
+/// @param ncr the request
+/// @param[out] forward_domain matched forward domain, if any
+/// @param[out] reverse_domain matched reverse domain, if any
+///
+/// @return true if the request has changes to carry out and all of them
+/// matched a domain.
+bool
+matchDomains(const D2CfgMgrPtr& cfg_mgr,
+             const dhcp_ddns::NameChangeRequestPtr& ncr,
+             DdnsDomainPtr& forward_domain, DdnsDomainPtr& reverse_domain) {
+    if (ncr->isForwardChange() &&
+        (!cfg_mgr->forwardUpdatesEnabled() ||
+         !cfg_mgr->matchForward(ncr->getFqdn(), forward_domain))) {
+        return (false);
+    }
+
+    if (ncr->isReverseChange() &&
+        (!cfg_mgr->reverseUpdatesEnabled() ||
+         !cfg_mgr->matchReverse(ncr->getIpAddress(), reverse_domain))) {
+        return (false);
+    }
+
+    return (forward_domain || reverse_domain);
+}
+
+/// @brief Handler posted to wake up the thread waiting for IO events.
+void
+wakeUp() {
+}
+
+} // end of anonymous namespace
 
 D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                          asiolink::IOServicePtr& io_service,
-                         const size_t max_transactions)
-    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service) {
+                         const size_t max_transactions,
+                         const size_t max_batch_size)
+    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service),
+     max_batch_message_size_(MAX_BATCH_MESSAGE_SIZE_DEFAULT),
+     batch_entries_(0), dns_protocol_(DNSClient::UDP),
+     tcp_pool_(new DnsTcpConnectionPool()), transaction_list_(),
+     update_threads_(0), thread_pool_(), pause_count_(0), paused_threads_(0),
+     done_mutex_(),
+     done_transactions_() {
     if (!queue_mgr_) {
         isc_throw(D2UpdateMgrError, "D2UpdateMgr queue manager cannot be null");
     }
@@ -36,25 +93,41 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
         isc_throw(D2UpdateMgrError, "IOServicePtr cannot be null");
     }
 
-    // Use setter to do validation.
+    // Use setters to do validation.
     setMaxTransactions(max_transactions);
+    setMaxBatchSize(max_batch_size);
 }
 
 D2UpdateMgr::~D2UpdateMgr() {
+    // Stop the update threads first so that they no longer run the
+    // transactions.
+    if (thread_pool_) {
+        thread_pool_->stop();
+    }
+
     transaction_list_.clear();
+    tcp_pool_->closeAll();
 }
 
 void D2UpdateMgr::sweep() {
     // cleanup finished transactions;
     checkFinishedTransactions();
 
+    stats::StatsMgr::instance().setValue("ncr-queue-depth",
+                                         static_cast<int64_t>(getQueueCount()));
+
+    if (!applyUpdateThreads()) {
+        // Wait for the transactions in progress to be done.
+        return;
+    }
+
     // if the queue isn't empty, find the next suitable job and
     // start a transaction for it.
     // @todo - Do we want to queue max transactions? The logic here will only
     // start one new transaction per invocation.  On the other hand a busy
     // system will generate many IO events and this method will be called
     // frequently.  It will likely achieve max transactions quickly on its own.
-    if (getQueueCount() > 0)  {
+    if ((getQueueCount() > 0) || !fallback_queue_.empty())  {
         if (getTransactionCount() >= max_transactions_) {
             LOG_DEBUG(dhcp_to_d2_logger, DBGLVL_TRACE_DETAIL_DATA,
                       DHCP_DDNS_AT_MAX_TRANSACTIONS).arg(getQueueCount())
@@ -78,12 +151,46 @@ D2UpdateMgr::checkFinishedTransactions() {
     // to erase.  This replaces the old iterator which becomes invalid by the
     // erase with a the next valid iterator.  Prefix incrementing will not
     // work.
+    // The transactions run by the update threads must not be accessed
+    // until they have reported they are done.
+    std::set<NameChangeTransaction*> done;
+    if (thread_pool_) {
+        util::thread::Mutex::Locker lock(done_mutex_);
+        done.swap(done_transactions_);
+    }
+
     TransactionList::iterator it = transaction_list_.begin();
     while (it != transaction_list_.end()) {
         NameChangeTransactionPtr trans = (*it).second;
-        if (trans->isModelDone()) {
+        if (trans->getStrand() ? (done.count(trans.get()) > 0) :
+            trans->isModelDone()) {
             // @todo  Addtional actions based on NCR status could be
             // performed here.
+            if (!((*it).first == trans->getTransactionKey())) {
+                // One of the other requests of a batch.
+                --batch_entries_;
+            } else if (trans->getNcrStatus() == dhcp_ddns::ST_FAILED) {
+                NameAddBatchTransactionPtr batch =
+                    boost::dynamic_pointer_cast<NameAddBatchTransaction>(trans);
+                if (batch && batch->getRejected()) {
+                    // Carry out the requests individually, skipping the
+                    // direction the batch has completed. The requests of
+                    // a batch which failed otherwise have all failed.
+                    const NameChangeRequestList& ncrs = batch->getNcrs();
+                    for (NameChangeRequestList::const_iterator ncr =
+                         ncrs.begin(); ncr != ncrs.end(); ++ncr) {
+                        if (batch->getForwardChangeCompleted()) {
+                            (*ncr)->setForwardChange(false);
+                        }
+                        (*ncr)->setStatus(dhcp_ddns::ST_NEW);
+                        fallback_queue_.push_back(*ncr);
+                    }
+
+                    stats::StatsMgr::instance().addValue("update-batch-fallbacks",
+                                                         static_cast<int64_t>(1));
+                }
+            }
+
             transaction_list_.erase(it++);
         } else {
             ++it;
@@ -98,12 +205,29 @@ void D2UpdateMgr::pickNextJob() {
     // Requests and transactions are associated by DHCID.  If a request has
     // the same DHCID as a transaction, they are presumed to be for the same
     // "end user".
+    // Requests of rejected batches come first, as they were dequeued before
+    // the requests still in the queue.
+    for (std::deque<dhcp_ddns::NameChangeRequestPtr>::iterator it =
+         fallback_queue_.begin(); it != fallback_queue_.end(); ++it) {
+        if (!hasTransaction((*it)->getDhcid())) {
+            dhcp_ddns::NameChangeRequestPtr found_ncr = *it;
+            fallback_queue_.erase(it);
+            makeTransaction(found_ncr);
+            return;
+        }
+    }
+
     size_t queue_count = getQueueCount();
     for (size_t index = 0; index < queue_count; ++index) {
         dhcp_ddns::NameChangeRequestPtr found_ncr = queue_mgr_->peekAt(index);
         if (!hasTransaction(found_ncr->getDhcid())) {
             queue_mgr_->dequeueAt(index);
-            makeTransaction(found_ncr);
+            if ((max_batch_size_ > 1) &&
+                (found_ncr->getChangeType() == dhcp_ddns::CHG_ADD)) {
+                makeBatch(found_ncr, index);
+            } else {
+                makeTransaction(found_ncr);
+            }
             return;
         }
     }
@@ -190,21 +314,21 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     }
 
     // We matched to the required servers, so construct the transaction.
-    // @todo If multi-threading is implemented, one would pass in an
-    // empty IOServicePtr, rather than our instance value.  This would cause
-    // the transaction to instantiate its own, separate IOService to handle
-    // the transaction's IO.
+    asiolink::IOServicePtr io_service = getUpdateIOService();
     NameChangeTransactionPtr trans;
     if (next_ncr->getChangeType() == dhcp_ddns::CHG_ADD) {
-        trans.reset(new NameAddTransaction(io_service_, next_ncr,
+        trans.reset(new NameAddTransaction(io_service, next_ncr,
                                            forward_domain, reverse_domain,
                                            cfg_mgr_));
     } else {
-        trans.reset(new NameRemoveTransaction(io_service_, next_ncr,
+        trans.reset(new NameRemoveTransaction(io_service, next_ncr,
                                               forward_domain, reverse_domain,
                                               cfg_mgr_));
     }
 
+    trans->setDnsTransport(dns_protocol_, tcp_pool_);
+    pinTransaction(trans);
+
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
@@ -212,6 +336,127 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     trans->startTransaction();
 }
 
+void
+D2UpdateMgr::makeBatch(dhcp_ddns::NameChangeRequestPtr& next_ncr,
+                       const size_t index) {
+    DdnsDomainPtr forward_domain;
+    DdnsDomainPtr reverse_domain;
+    if (!matchDomains(cfg_mgr_, next_ncr, forward_domain, reverse_domain)) {
+        // Let makeTransaction deal with disabled directions and mismatches.
+        makeTransaction(next_ncr);
+        return;
+    }
+
+    NameChangeRequestList ncrs(1, next_ncr);
+    size_t message_size =
+        NameAddBatchTransaction::getOverheadSize(forward_domain,
+                                                 reverse_domain) +
+        NameAddBatchTransaction::getRequestSize(*next_ncr);
+
+    // FQDNs (DNS names are case insensitive), addresses and DHCIDs of the
+    // batch, and of the requests left in the queue which the batch must not
+    // overtake.
+    std::set<std::string> batch_keys;
+    batch_keys.insert(boost::algorithm::to_lower_copy(next_ncr->getFqdn()));
+    batch_keys.insert(next_ncr->getIpAddress());
+    batch_keys.insert(next_ncr->getDhcid().toStr());
+    std::set<std::string> skipped_keys;
+
+    const size_t max_message_size = (dns_protocol_ == DNSClient::TCP ?
+                                     DnsTcpConnection::MAX_MESSAGE_SIZE :
+                                     max_batch_message_size_);
+
+    // Positions of the requests to dequeue, in ascending order.
+    std::vector<size_t> positions;
+    const size_t queue_count = getQueueCount();
+    const size_t scan_end = std::min(queue_count, index + BATCH_SCAN_LIMIT);
+    for (size_t pos = index;
+         (pos < scan_end) && (ncrs.size() < max_batch_size_); ++pos) {
+        const dhcp_ddns::NameChangeRequestPtr& ncr = queue_mgr_->peekAt(pos);
+        const std::string keys[] = {
+            boost::algorithm::to_lower_copy(ncr->getFqdn()),
+            ncr->getIpAddress(), ncr->getDhcid().toStr()
+        };
+        bool compatible = ((ncr->getChangeType() == dhcp_ddns::CHG_ADD) &&
+                           (ncr->isForwardChange() ==
+                            next_ncr->isForwardChange()) &&
+                           (ncr->isReverseChange() ==
+                            next_ncr->isReverseChange()) &&
+                           !hasTransaction(ncr->getDhcid()));
+        for (size_t i = 0; compatible && (i < 3); ++i) {
+            compatible = ((batch_keys.count(keys[i]) == 0) &&
+                          (skipped_keys.count(keys[i]) == 0));
+        }
+
+        if (compatible) {
+            DdnsDomainPtr ncr_forward_domain;
+            DdnsDomainPtr ncr_reverse_domain;
+            compatible = (matchDomains(cfg_mgr_, ncr, ncr_forward_domain,
+                                       ncr_reverse_domain) &&
+                          (ncr_forward_domain == forward_domain) &&
+                          (ncr_reverse_domain == reverse_domain));
+        }
+
+        if (compatible) {
+            const size_t ncr_size =
+                NameAddBatchTransaction::getRequestSize(*ncr);
+            if (message_size + ncr_size > max_message_size) {
+                break;
+            }
+
+            message_size += ncr_size;
+            ncrs.push_back(ncr);
+            positions.push_back(pos);
+            batch_keys.insert(keys, keys + 3);
+        } else {
+            skipped_keys.insert(keys, keys + 3);
+        }
+    }
+
+    if (ncrs.size() == 1) {
+        makeTransaction(next_ncr);
+        return;
+    }
+
+    // Dequeue from the back so the positions stay valid.
+    for (std::vector<size_t>::reverse_iterator pos = positions.rbegin();
+         pos != positions.rend(); ++pos) {
+        queue_mgr_->dequeueAt(*pos);
+    }
+
+    asiolink::IOServicePtr io_service = getUpdateIOService();
+    NameChangeTransactionPtr trans(new NameAddBatchTransaction(io_service,
+                                                               ncrs,
+                                                               forward_domain,
+                                                               reverse_domain,
+                                                               cfg_mgr_));
+    trans->setDnsTransport(dns_protocol_, tcp_pool_);
+    pinTransaction(trans);
+
+    // List the transaction under each request's DHCID, so that no other
+    // transaction is started for these clients until it is done.
+    for (NameChangeRequestList::const_iterator ncr = ncrs.begin();
+         ncr != ncrs.end(); ++ncr) {
+        transaction_list_[(*ncr)->getDhcid()] = trans;
+    }
+    batch_entries_ += ncrs.size() - 1;
+
+    LOG_DEBUG(dhcp_to_d2_logger, DBGLVL_TRACE_DETAIL_DATA,
+              DHCP_DDNS_BATCH_CREATED)
+              .arg(next_ncr->getRequestId())
+              .arg(ncrs.size());
+
+    stats::StatsMgr& stats_mgr = stats::StatsMgr::instance();
+    stats_mgr.addValue("update-batches", static_cast<int64_t>(1));
+    stats_mgr.addValue("update-batched-requests",
+                       static_cast<int64_t>(ncrs.size()));
+    stats_mgr.setValue("update-last-batch-size",
+                       static_cast<int64_t>(ncrs.size()));
+
+    // Start it.
+    trans->startTransaction();
+}
+
 TransactionList::iterator
 D2UpdateMgr::findTransaction(const TransactionKey& key) {
     return (transaction_list_.find(key));
@@ -226,7 +471,14 @@ void
 D2UpdateMgr::removeTransaction(const TransactionKey& key) {
     TransactionList::iterator pos = findTransaction(key);
     if (pos != transactionListEnd()) {
+        const size_t num_threads = pauseUpdateThreads();
+        if (!((*pos).first == (*pos).second->getTransactionKey())) {
+            --batch_entries_;
+        } else {
+            releaseTransaction((*pos).second);
+        }
         transaction_list_.erase(pos);
+        resumeUpdateThreads(num_threads);
     }
 }
 
@@ -244,7 +496,14 @@ void
 D2UpdateMgr::clearTransactionList() {
     // @todo for now this just wipes them out. We might need something
     // more elegant, that allows a cancel first.
+    const size_t num_threads = pauseUpdateThreads();
+    for (TransactionList::iterator it = transaction_list_.begin();
+         it != transaction_list_.end(); ++it) {
+        releaseTransaction((*it).second);
+    }
     transaction_list_.clear();
+    batch_entries_ = 0;
+    resumeUpdateThreads(num_threads);
 }
 
 void
@@ -265,6 +524,131 @@ D2UpdateMgr::setMaxTransactions(const size_t new_trans_max) {
     max_transactions_ = new_trans_max;
 }
 
+void
+D2UpdateMgr::setMaxBatchSize(const size_t max_batch_size) {
+    if (max_batch_size < 1) {
+        isc_throw(D2UpdateMgrError, "D2UpdateMgr"
+                  " maximum batch size must be greater than zero");
+    }
+
+    max_batch_size_ = max_batch_size;
+}
+
+void
+D2UpdateMgr::setUpdateThreads(const size_t num_threads) {
+    update_threads_ = num_threads;
+    applyUpdateThreads();
+}
+
+void
+D2UpdateMgr::pauseUpdates() {
+    if (pause_count_++ == 0) {
+        paused_threads_ = pauseUpdateThreads();
+    }
+}
+
+void
+D2UpdateMgr::resumeUpdates() {
+    if ((pause_count_ == 0) || (--pause_count_ > 0)) {
+        return;
+    }
+
+    // Restart the threads as they were, then apply the number of threads
+    // which may have been configured in the meantime.
+    resumeUpdateThreads(paused_threads_);
+    paused_threads_ = 0;
+    applyUpdateThreads();
+}
+
+bool
+D2UpdateMgr::applyUpdateThreads() {
+    if (pause_count_ > 0) {
+        return (false);
+    }
+
+    if (getRunningUpdateThreads() == update_threads_) {
+        return (true);
+    }
+
+    if (thread_pool_ && (update_threads_ > 0)) {
+        // The transactions keep using the same IOService, the handlers
+        // posted in the meantime are run once the threads are restarted.
+        thread_pool_->stop();
+        thread_pool_->start(update_threads_);
+        return (true);
+    }
+
+    // Moving between the IOServices requires the transactions to be done.
+    if (!transaction_list_.empty()) {
+        return (false);
+    }
+
+    // The TCP connections are bound to the IOService they were opened with.
+    tcp_pool_->closeAll();
+    if (update_threads_ == 0) {
+        thread_pool_->stop();
+        thread_pool_.reset();
+    } else {
+        thread_pool_.reset(new D2ThreadPool(asiolink::IOServicePtr
+                                            (new asiolink::IOService())));
+        thread_pool_->start(update_threads_);
+    }
+
+    return (true);
+}
+
+void
+D2UpdateMgr::pinTransaction(const NameChangeTransactionPtr& trans) {
+    if (!thread_pool_) {
+        return;
+    }
+
+    NameChangeTransaction::StrandPtr
+        strand(new boost::asio::io_service::strand(thread_pool_->
+                                                   getIOService()->
+                                                   get_io_service()));
+    trans->setStrand(strand, boost::bind(&D2UpdateMgr::transactionDone,
+                                         this, trans.get()));
+}
+
+size_t
+D2UpdateMgr::pauseUpdateThreads() {
+    if (!thread_pool_ || !thread_pool_->isRunning()) {
+        return (0);
+    }
+
+    const size_t num_threads = thread_pool_->getThreadCount();
+    thread_pool_->stop();
+    return (num_threads);
+}
+
+void
+D2UpdateMgr::resumeUpdateThreads(const size_t num_threads) {
+    if (num_threads > 0) {
+        thread_pool_->start(num_threads);
+    }
+}
+
+void
+D2UpdateMgr::releaseTransaction(const NameChangeTransactionPtr& trans) {
+    if (!trans->getStrand()) {
+        return;
+    }
+
+    trans->setStrand(trans->getStrand(), boost::function<void()>());
+    util::thread::Mutex::Locker lock(done_mutex_);
+    done_transactions_.erase(trans.get());
+}
+
+void
+D2UpdateMgr::transactionDone(NameChangeTransaction* trans) {
+    {
+        util::thread::Mutex::Locker lock(done_mutex_);
+        done_transactions_.insert(trans);
+    }
+    io_service_->post(wakeUp);
+}
+
 size_t
 D2UpdateMgr::getQueueCount() const {
     return (queue_mgr_->getQueueSize());
@@ -272,7 +656,7 @@ D2UpdateMgr::getQueueCount() const {
 
 size_t
 D2UpdateMgr::getTransactionCount() const {
-    return (transaction_list_.size());
+    return (transaction_list_.size() - batch_entries_);
 }
 
 
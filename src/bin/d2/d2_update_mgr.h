@@ -14,11 +14,15 @@
 #include <d2/d2_log.h>
 #include <d2/d2_queue_mgr.h>
 #include <d2/d2_cfg_mgr.h>
+#include <d2/d2_thread_pool.h>
 #include <d2/nc_trans.h>
+#include <util/threads/sync.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
+#include <deque>
 #include <map>
+#include <set>
 
 namespace isc {
 namespace d2 {
@@ -57,11 +61,26 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 /// transactions complete,  D2UpdateMgr removes them from the transaction list,
 /// replacing them with new transactions.
 ///
+/// To keep up with bursts of requests, compatible Add requests may be
+/// combined into a single transaction (a NameAddBatchTransaction) which
+/// carries them out with one DNS update per direction.  Requests of a batch
+/// which fails are then carried out by individual transactions, ahead of
+/// the requests still in the queue.
+///
 /// D2UpdateMgr carries out each of the above steps, with a method called
 /// sweep().  This method is intended to be called as IO events complete.
 /// The upper layer(s) are responsible for calling sweep in a timely and cyclic
 /// manner.
 ///
+/// By default the transactions carry out their IO using the IOService of
+/// the upper layer(s), i.e. on the thread calling sweep().  With update
+/// threads configured, they use a separate IOService run by a pool of
+/// threads instead, each transaction being pinned to a strand so that its
+/// state model never runs concurrently.  The transaction list and the
+/// request queue remain confined to the thread calling sweep(): the update
+/// threads only report the transactions which are done, and wake that
+/// thread up by posting to the upper layer's IOService.
+///
 class D2UpdateMgr : public boost::noncopyable {
 public:
     /// @brief Maximum number of concurrent transactions
@@ -69,6 +88,20 @@ public:
     /// implementation.
     static const size_t MAX_TRANSACTIONS_DEFAULT = 32;
 
+    /// @brief Default maximum number of requests combined in a batch.
+    ///
+    /// Batching is disabled by default, it is enabled with the
+    /// dns-update-batch-size configuration parameter.
+    static const size_t MAX_BATCH_SIZE_DEFAULT = 1;
+
+    /// @brief Default maximum size of a batch update message sent over UDP.
+    ///
+    /// This is the size of a DNS message carried over UDP without EDNS.
+    static const size_t MAX_BATCH_MESSAGE_SIZE_DEFAULT = 512;
+
+    /// @brief Number of queued requests examined to fill a batch.
+    static const size_t BATCH_SCAN_LIMIT = 256;
+
     // @todo This structure is not yet used. It is here in anticipation of
     // enabled statistics capture.
     struct Stats {
@@ -88,12 +121,16 @@ public:
     /// @param io_service IO service used by the upper layer(s) to manage
     /// IO events
     /// @param max_transactions the maximum number of concurrent transactions
+    /// @param max_batch_size the maximum number of requests combined in a
+    /// batch, 1 disables batching
     ///
     /// @throw D2UpdateMgrError if either the queue manager or configuration
-    /// managers are NULL, or max transactions is less than one.
+    /// managers are NULL, or max transactions or max batch size is less
+    /// than one.
     D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                 asiolink::IOServicePtr& io_service,
-                const size_t max_transactions = MAX_TRANSACTIONS_DEFAULT);
+                const size_t max_transactions = MAX_TRANSACTIONS_DEFAULT,
+                const size_t max_batch_size = MAX_BATCH_SIZE_DEFAULT);
 
     /// @brief Destructor
     virtual ~D2UpdateMgr();
@@ -106,12 +143,18 @@ public:
     ///
     /// - Removes all completed transactions from the transaction list.
     ///
+    /// - Updates the "ncr-queue-depth" statistic.
+    ///
     /// - If the request queue is not empty and the number of transactions
     /// in the transaction list has not reached maximum allowed, then select
     /// a request from the queue.
     ///
     /// - If a request was selected, start a new transaction for it and
     /// add the transaction to the list of transactions.
+    ///
+    /// A change of the number of update threads which must wait for the
+    /// transactions in progress is applied first, when possible; until then
+    /// no new transaction is started.
     void sweep();
 
 protected:
@@ -120,17 +163,24 @@ protected:
     /// Iterates through the list of transactions and removes any that have
     /// reached completion.  This method may expand in complexity or even
     /// disappear altogether as the implementation matures.
+    ///
+    /// The requests of a batch transaction rejected by a DNS server are added
+    /// to the fallback list, less the direction the batch completed, if any.
+    /// The requests of a batch which failed otherwise, e.g. because no server
+    /// could be reached, are failed by the batch transaction.
     void checkFinishedTransactions();
 
     /// @brief Starts a transaction for the next eligible request in the queue.
     ///
-    /// This method will scan the request queue for the next request to
-    /// dequeue.  The current implementation starts at the front of the queue
-    /// and looks for the first request for whose DHCID there is no current
-    /// transaction in progress.
+    /// Requests of rejected batches are served first, each with its own
+    /// transaction.  Otherwise this method will scan the request queue for
+    /// the next request to dequeue.  The current implementation starts at
+    /// the front of the queue and looks for the first request for whose
+    /// DHCID there is no current transaction in progress.
     ///
     /// If a request is selected, it is removed from the queue and transaction
-    /// is constructed for it.
+    /// is constructed for it.  Add requests are combined with compatible
+    /// requests further in the queue when batching is enabled.
     ///
     /// It is possible that no such request exists, though this is likely to be
     /// rather rare unless a system is frequently seeing requests for the same
@@ -161,6 +211,29 @@ protected:
     /// exists. Note this would be programmatic error.
     void makeTransaction(isc::dhcp_ddns::NameChangeRequestPtr& ncr);
 
+    /// @brief Create a new transaction for the given request and compatible
+    /// requests in the queue.
+    ///
+    /// Requests are compatible when they are Add requests for the same
+    /// change directions, match the same domains, and have distinct FQDNs,
+    /// addresses and DHCIDs for which no transaction is in progress.  A
+    /// request which conflicts with a request left in the queue ahead of it
+    /// is not combined, so that requests for the same client or FQDN are
+    /// still carried out in order.  The batch is limited both by the maximum
+    /// batch size and by the estimated size of its update messages, and
+    /// only the first BATCH_SCAN_LIMIT queued requests are examined.
+    ///
+    /// The compatible requests are removed from the queue and a
+    /// NameAddBatchTransaction is constructed for all of them, listed in the
+    /// transaction list under each request's DHCID.  If none is found, or
+    /// the request itself cannot be batched, this falls back to
+    /// makeTransaction().
+    ///
+    /// @param ncr the NameChangeRequest, already removed from the queue.
+    /// @param index position in the queue the request was removed from.
+    void makeBatch(isc::dhcp_ddns::NameChangeRequestPtr& ncr,
+                   const size_t index);
+
 public:
     /// @brief Gets the D2UpdateMgr's IOService.
     ///
@@ -183,6 +256,96 @@ public:
     /// queue.
     void setMaxTransactions(const size_t max_transactions);
 
+    /// @brief Returns the maximum number of requests combined in a batch.
+    size_t getMaxBatchSize() const {
+        return (max_batch_size_);
+    }
+
+    /// @brief Sets the maximum number of requests combined in a batch.
+    ///
+    /// @param max_batch_size is the new maximum, 1 disables batching
+    ///
+    /// @throw D2UpdateMgrError if the new value is less than one.
+    void setMaxBatchSize(const size_t max_batch_size);
+
+    /// @brief Returns the maximum size of a batch update message sent
+    /// over UDP.
+    size_t getMaxBatchMessageSize() const {
+        return (max_batch_message_size_);
+    }
+
+    /// @brief Sets the maximum size of a batch update message sent over UDP.
+    ///
+    /// Over TCP the size of a batch update message is only limited by the
+    /// TCP message framing, i.e. DnsTcpConnection::MAX_MESSAGE_SIZE.
+    ///
+    /// @param max_batch_message_size is the new maximum in bytes
+    void setMaxBatchMessageSize(const size_t max_batch_message_size) {
+        max_batch_message_size_ = max_batch_message_size;
+    }
+
+    /// @brief Returns the transport protocol used for DNS updates.
+    DNSClient::Protocol getDnsProtocol() const {
+        return (dns_protocol_);
+    }
+
+    /// @brief Sets the transport protocol used for DNS updates.
+    ///
+    /// The protocol applies to the transactions started afterwards.  Over
+    /// TCP, the transactions share a persistent connection per DNS server.
+    ///
+    /// @param protocol is the new transport protocol, UDP by default
+    void setDnsProtocol(const DNSClient::Protocol& protocol) {
+        dns_protocol_ = protocol;
+    }
+
+    /// @brief Returns the pool of TCP connections to the DNS servers.
+    const DnsTcpConnectionPoolPtr& getTcpConnectionPool() const {
+        return (tcp_pool_);
+    }
+
+    /// @brief Returns the configured number of update threads.
+    size_t getUpdateThreads() const {
+        return (update_threads_);
+    }
+
+    /// @brief Sets the number of threads carrying out the transactions.
+    ///
+    /// With zero threads, the default, the transactions run on the upper
+    /// layer's IOService.  Otherwise they run on an IOService of their own,
+    /// run by the given number of threads.
+    ///
+    /// Resizing the pool of threads takes effect immediately.  Moving the
+    /// transactions to or from the pool is deferred until the transactions
+    /// in progress are done, no new transaction being started in the
+    /// meantime.
+    ///
+    /// @param num_threads is the new number of threads
+    void setUpdateThreads(const size_t num_threads);
+
+    /// @brief Stops the update threads until @c resumeUpdates is called.
+    ///
+    /// The update threads log and use the configuration, so they must not
+    /// run while the logging or the configuration is replaced.  While the
+    /// updates are paused no transaction is started and a new number of
+    /// threads is only applied when they are resumed.  Calls may be nested:
+    /// the threads are restarted by the last matching @c resumeUpdates.
+    void pauseUpdates();
+
+    /// @brief Restarts the update threads stopped by @c pauseUpdates.
+    void resumeUpdates();
+
+    /// @brief Returns the number of threads currently carrying out the
+    /// transactions, zero when they run on the upper layer's IOService.
+    size_t getRunningUpdateThreads() const {
+        return (thread_pool_ ? thread_pool_->getThreadCount() : 0);
+    }
+
+    /// @brief Returns the IOService used by the new transactions.
+    const asiolink::IOServicePtr& getUpdateIOService() const {
+        return (thread_pool_ ? thread_pool_->getIOService() : io_service_);
+    }
+
     /// @brief Search the transaction list for the given key.
     ///
     /// @param key the transaction key value for which to search.
@@ -208,13 +371,16 @@ public:
     /// @brief Removes the entry pointed to by key from the transaction list.
     ///
     /// Removes the entry referred to by key if it exists.  It has no effect
-    /// if the entry is not found.
+    /// if the entry is not found.  The update threads are stopped while the
+    /// entry is removed.
     ///
     /// @param key of the transaction to remove
     void removeTransaction(const TransactionKey& key);
 
     /// @brief Immediately discards all entries in the transaction list.
     ///
+    /// The update threads are stopped while the entries are discarded.
+    ///
     /// @todo For now this just wipes them out. We might need something
     /// more elegant, that allows a cancel first.
     void clearTransactionList();
@@ -223,9 +389,61 @@ public:
     size_t getQueueCount() const;
 
     /// @brief Returns the current number of transactions.
+    ///
+    /// A batch transaction is counted once, although it is listed under
+    /// the DHCID of each of its requests.
     size_t getTransactionCount() const;
 
+    /// @brief Returns the number of requests of rejected batches waiting to
+    /// be carried out individually.
+    size_t getFallbackCount() const {
+        return (fallback_queue_.size());
+    }
+
 private:
+    /// @brief Applies the configured number of update threads.
+    ///
+    /// @return false if the updates are paused or if the change is
+    /// deferred until the transactions in progress are done, true otherwise.
+    bool applyUpdateThreads();
+
+    /// @brief Pins a new transaction to a strand of the update threads.
+    ///
+    /// Does nothing if there are no update threads.
+    ///
+    /// @param trans the transaction
+    void pinTransaction(const NameChangeTransactionPtr& trans);
+
+    /// @brief Stops the update threads, if they are running.
+    ///
+    /// The handlers of the transactions not yet run are kept until the
+    /// threads are resumed.
+    ///
+    /// @return the number of threads to pass to @c resumeUpdateThreads.
+    size_t pauseUpdateThreads();
+
+    /// @brief Restarts the update threads stopped by @c pauseUpdateThreads.
+    ///
+    /// @param num_threads the value returned by @c pauseUpdateThreads.
+    void resumeUpdateThreads(const size_t num_threads);
+
+    /// @brief Detaches a transaction removed from the list.
+    ///
+    /// Must be called while the update threads are paused.  The handlers
+    /// of the transaction which are still pending hold it until they are
+    /// run, but it is no longer reported as done.
+    ///
+    /// @param trans the transaction
+    void releaseTransaction(const NameChangeTransactionPtr& trans);
+
+    /// @brief Records a transaction as done.
+    ///
+    /// Invoked by the update threads, it wakes up the upper layer's
+    /// IOService so that the transaction is checked by the next sweep().
+    ///
+    /// @param trans the transaction
+    void transactionDone(NameChangeTransaction* trans);
+
     /// @brief Pointer to the queue manager.
     D2QueueMgrPtr queue_mgr_;
 
@@ -234,17 +452,54 @@ private:
 
     /// @brief Primary IOService instance.
     /// This is the IOService that the upper layer(s) use for IO events, such
-    /// as shutdown and configuration commands.  It is the IOService that is
-    /// passed into transactions to manager their IO events.
-    /// (For future reference, multi-threaded transactions would each use their
-    /// own IOService instance.)
+    /// as shutdown and configuration commands.  Unless update threads are
+    /// configured, it is the IOService that is passed into transactions to
+    /// manage their IO events.
     asiolink::IOServicePtr io_service_;
 
     /// @brief Maximum number of concurrent transactions.
     size_t max_transactions_;
 
+    /// @brief Maximum number of requests combined in a batch.
+    size_t max_batch_size_;
+
+    /// @brief Maximum size of a batch update message.
+    size_t max_batch_message_size_;
+
+    /// @brief Number of entries of the transaction list which refer to a
+    /// batch transaction under the DHCID of another request than its own.
+    size_t batch_entries_;
+
+    /// @brief Requests of rejected batches, to be carried out individually.
+    std::deque<dhcp_ddns::NameChangeRequestPtr> fallback_queue_;
+
+    /// @brief Transport protocol used for DNS updates.
+    DNSClient::Protocol dns_protocol_;
+
+    /// @brief TCP connections to the DNS servers, shared by the
+    /// transactions.
+    DnsTcpConnectionPoolPtr tcp_pool_;
+
     /// @brief List of transactions.
     TransactionList transaction_list_;
+
+    /// @brief Configured number of update threads.
+    size_t update_threads_;
+
+    /// @brief Threads running the transactions, null without update threads.
+    D2ThreadPoolPtr thread_pool_;
+
+    /// @brief Number of calls to @c pauseUpdates not yet resumed.
+    size_t pause_count_;
+
+    /// @brief Number of update threads stopped by @c pauseUpdates.
+    size_t paused_threads_;
+
+    /// @brief Mutex protecting the list of the transactions done.
+    util::thread::Mutex done_mutex_;
+
+    /// @brief Transactions run by the update threads which are done.
+    std::set<NameChangeTransaction*> done_transactions_;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
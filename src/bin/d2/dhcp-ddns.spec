@@ -34,6 +34,24 @@
         "item_optional": true,
         "item_default": "JSON"
     },
+    {
+        "item_name": "dns-update-threads",
+        "item_type": "integer",
+        "item_optional": true,
+        "item_default": 0
+    },
+    {
+        "item_name": "dns-update-batch-size",
+        "item_type": "integer",
+        "item_optional": true,
+        "item_default": 1
+    },
+    {
+        "item_name": "dns-protocol",
+        "item_type": "string",
+        "item_optional": true,
+        "item_default": "UDP"
+    },
     {
         "item_name": "tsig-keys",
         "item_type": "list",
@@ -6,9 +6,13 @@
 
 #include <config.h>
 #include <d2/dns_client.h>
+#include <d2/dns_tcp_connection.h>
 #include <d2/d2_log.h>
 #include <dns/messagerenderer.h>
+#include <util/threads/sync.h>
+#include <boost/bind.hpp>
 #include <limits>
+#include <list>
 
 namespace isc {
 namespace d2 {
@@ -23,14 +27,15 @@ const size_t DEFAULT_BUFFER_SIZE = 128;
 }
 
 using namespace isc::util;
+using namespace isc::util::thread;
 using namespace isc::asiolink;
 using namespace isc::asiodns;
 using namespace isc::dns;
 
 // This class provides the implementation for the DNSClient. This allows for
 // the separation of the DNSClient interface from the implementation details.
-// Currently, implementation uses IOFetch object to handle asynchronous
-// communication with the DNS. This design may be revisited in the future. If
+// The implementation uses IOFetch objects to handle asynchronous UDP
+// communication with the DNS and DnsTcpConnection objects for TCP. If
 // implementation is changed, the DNSClient API will remain unchanged thanks
 // to this separation.
 class DNSClientImpl : public asiodns::IOFetch::Callback {
@@ -55,11 +60,21 @@ public:
     DNSClient::Protocol proto_;
     // TSIG context used to sign outbound and verify inbound messages.
     dns::TSIGContextPtr tsig_context_;
+    // Pool of the TCP connections used when the protocol is TCP.
+    DnsTcpConnectionPoolPtr tcp_pool_;
+    // TCP exchanges in progress, cancelled on destruction.
+    std::list<std::pair<DnsTcpConnectionPtr, OutputBufferPtr> > tcp_requests_;
+    // TCP exchanges whose completion has been invoked, possibly by another
+    // thread.  The destructor waits for such a completion to return.
+    std::list<std::pair<DnsTcpConnectionPtr, OutputBufferPtr> > tcp_completing_;
+    // Mutex protecting the lists of TCP exchanges.
+    Mutex tcp_mutex_;
 
     // Constructor and Destructor
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                   DNSClient::Callback* callback,
-                  const DNSClient::Protocol proto);
+                  const DNSClient::Protocol proto,
+                  const DnsTcpConnectionPoolPtr& tcp_pool);
     virtual ~DNSClientImpl();
 
     // This internal callback is called when the DNS update message exchange is
@@ -68,6 +83,16 @@ public:
     // type, representing a response from the server is set.
     virtual void operator()(asiodns::IOFetch::Result result);
 
+    // This internal callback is called when a DNS update message exchange
+    // over TCP is complete. The response, if any, is copied to the input
+    // buffer before completing the exchange as above.
+    void tcpCompletion(const OutputBufferPtr& request,
+                       const boost::system::error_code& ec,
+                       const uint8_t* data, size_t length);
+
+    // Parses the response, if any, and invokes the external callback.
+    void completeExchange(DNSClient::Status status);
+
     // Starts asynchronous DNS Update using TSIG.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
@@ -78,13 +103,18 @@ public:
 
     // This function maps the IO error to the DNSClient error.
     DNSClient::Status getStatus(const asiodns::IOFetch::Result);
+
+    // This function maps the TCP connection error to the DNSClient error.
+    DNSClient::Status getStatus(const boost::system::error_code& ec);
 };
 
 DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                              DNSClient::Callback* callback,
-                             const DNSClient::Protocol proto)
+                             const DNSClient::Protocol proto,
+                             const DnsTcpConnectionPoolPtr& tcp_pool)
     : in_buf_(new OutputBuffer(DEFAULT_BUFFER_SIZE)),
-      response_(response_placeholder), callback_(callback), proto_(proto) {
+      response_(response_placeholder), callback_(callback), proto_(proto),
+      tcp_pool_(tcp_pool), tcp_requests_(), tcp_completing_(), tcp_mutex_() {
 
     // Response should be an empty pointer. It gets populated by the
     // operator() method.
@@ -92,17 +122,6 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
         isc_throw(isc::BadValue, "Response buffer pointer should be null");
     }
 
-    // @todo Currently we only support UDP. The support for TCP is planned for
-    // the future release.
-    if (proto_ == DNSClient::TCP) {
-        isc_throw(isc::NotImplemented, "TCP is currently not supported as a"
-                  << " Transport protocol for DNS Updates; please use UDP");
-    }
-
-    // Given that we already eliminated the possibility that TCP is used, it
-    // would be sufficient  to check that (proto != DNSClient::UDP). But, once
-    // support TCP is added the check above will disappear and the extra check
-    // will be needed here anyway.
     // Note that cascaded check is used here instead of:
     //   if (proto_ != DNSClient::TCP && proto_ != DNSClient::UDP)..
     // because some versions of GCC compiler complain that check above would
@@ -114,17 +133,63 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
             isc_throw(isc::NotImplemented, "invalid transport protocol type '"
                       << proto_ << "' specified for DNS Updates");
         }
+    } else if (!tcp_pool_) {
+        tcp_pool_.reset(new DnsTcpConnectionPool());
     }
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    // The connections may outlive this object, make sure they will not
+    // invoke it.  Cancelling an exchange waits for its completion if it is
+    // being invoked by another thread, so the lock is not held meanwhile.
+    std::list<std::pair<DnsTcpConnectionPtr, OutputBufferPtr> > requests;
+    {
+        Mutex::Locker lock(tcp_mutex_);
+        requests.swap(tcp_requests_);
+        requests.splice(requests.end(), tcp_completing_);
+    }
+
+    for (std::list<std::pair<DnsTcpConnectionPtr, OutputBufferPtr> >::iterator
+         it = requests.begin(); it != requests.end(); ++it) {
+        it->first->cancel(it->second);
+    }
 }
 
 void
 DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
-    // Get the status from IO. If no success, we just call user's callback
-    // and pass the status code.
-    DNSClient::Status status = getStatus(result);
+    completeExchange(getStatus(result));
+}
+
+void
+DNSClientImpl::tcpCompletion(const OutputBufferPtr& request,
+                             const boost::system::error_code& ec,
+                             const uint8_t* data, size_t length) {
+    // This object may be destroyed by the callback, so it is not accessed
+    // once completeExchange() returns.
+    {
+        Mutex::Locker lock(tcp_mutex_);
+        for (std::list<std::pair<DnsTcpConnectionPtr, OutputBufferPtr> >::
+             iterator it = tcp_requests_.begin(); it != tcp_requests_.end();
+             ++it) {
+            if (it->second == request) {
+                tcp_completing_.splice(tcp_completing_.end(), tcp_requests_,
+                                       it);
+                break;
+            }
+        }
+    }
+
+    DNSClient::Status status = getStatus(ec);
+    if (status == DNSClient::SUCCESS) {
+        in_buf_->clear();
+        in_buf_->writeData(data, length);
+    }
+    completeExchange(status);
+}
+
+void
+DNSClientImpl::completeExchange(DNSClient::Status status) {
+    // If no success, we just call user's callback and pass the status code.
     if (status == DNSClient::SUCCESS) {
         // Allocate a new response message. (Note that Message::fromWire
         // may only be run once per message, so we need to start fresh
@@ -174,6 +239,24 @@ DNSClientImpl::getStatus(const asiodns::IOFetch::Result result) {
     }
     return (DNSClient::OTHER);
 }
+
+DNSClient::Status
+DNSClientImpl::getStatus(const boost::system::error_code& ec) {
+    if (!ec) {
+        return (DNSClient::SUCCESS);
+    }
+
+    if (ec == boost::asio::error::timed_out) {
+        return (DNSClient::TIMEOUT);
+    }
+
+    if (ec == boost::asio::error::operation_aborted) {
+        return (DNSClient::IO_STOPPED);
+    }
+
+    return (DNSClient::OTHER);
+}
+
 void
 DNSClientImpl::doUpdate(asiolink::IOService& io_service,
                         const IOAddress& ns_addr,
@@ -213,6 +296,32 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // invalid message object is given.
     update.toWire(renderer, tsig_context_.get());
 
+    if (proto_ == DNSClient::TCP) {
+        // The exchange is carried over the pooled connection to the server,
+        // which invokes tcpCompletion() once it is complete.  The exchange
+        // is recorded first as the completion may be invoked by another
+        // thread as soon as the message is sent.
+        DnsTcpConnectionPtr connection =
+            tcp_pool_->getConnection(io_service, ns_addr, ns_port);
+        {
+            // The completions of the previous exchanges have invoked the
+            // callback, which is the last time they access this object.
+            Mutex::Locker lock(tcp_mutex_);
+            tcp_completing_.clear();
+            tcp_requests_.push_back(std::make_pair(connection, msg_buf));
+        }
+        try {
+            connection->send(msg_buf, wait,
+                             boost::bind(&DNSClientImpl::tcpCompletion, this,
+                                         msg_buf, _1, _2, _3));
+        } catch (...) {
+            Mutex::Locker lock(tcp_mutex_);
+            tcp_requests_.pop_back();
+            throw;
+        }
+        return;
+    }
+
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
     // this object as a completion callback for the message exchange. As a
@@ -230,8 +339,10 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
 }
 
 DNSClient::DNSClient(D2UpdateMessagePtr& response_placeholder,
-                     Callback* callback, const DNSClient::Protocol proto)
-    : impl_(new DNSClientImpl(response_placeholder, callback, proto)) {
+                     Callback* callback, const DNSClient::Protocol proto,
+                     const DnsTcpConnectionPoolPtr& tcp_pool)
+    : impl_(new DNSClientImpl(response_placeholder, callback, proto,
+                              tcp_pool)) {
 }
 
 DNSClient::~DNSClient() {
@@ -21,6 +21,9 @@ namespace d2 {
 class DNSClient;
 typedef boost::shared_ptr<DNSClient> DNSClientPtr;
 
+class DnsTcpConnectionPool;
+typedef boost::shared_ptr<DnsTcpConnectionPool> DnsTcpConnectionPoolPtr;
+
 /// DNSClient class implementation.
 class DNSClientImpl;
 
@@ -39,13 +42,14 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
-/// @todo Ultimately, this class will support both TCP and UDP Transport.
-/// Currently only UDP is supported and can be specified as a preferred
-/// protocol. @c DNSClient constructor will throw an exception if TCP is
-/// specified. Once both protocols are supported, the @c DNSClient logic will
-/// try to obey caller's preference. However, it may use the other protocol if
-/// on its own discretion, when there is a legitimate reason to do so. For
-/// example, if communication with the server using preferred protocol fails.
+/// The DNS server can be reached over UDP or TCP.  Each UDP exchange uses
+/// its own socket.  TCP exchanges are carried over a persistent connection
+/// to the server, taken from a @c DnsTcpConnectionPool, which is reused by
+/// the subsequent exchanges and pipelines the exchanges of all of the
+/// clients sharing the pool (@see @c DnsTcpConnection).
+///
+/// @todo The @c DNSClient does not fall back to the other protocol, e.g.
+/// when a UDP response is truncated.
 class DNSClient {
 public:
 
@@ -92,10 +96,19 @@ public:
     /// if an error occurs. NULL value disables callback invocation.
     /// @param proto caller's preference regarding Transport layer protocol to
     /// be used by DNS Client to communicate with a server.
+    /// @param tcp_pool pool of TCP connections to use when the protocol is
+    /// TCP. If it is null, the client uses a pool of its own so that its
+    /// connections are only reused by its own exchanges.
     DNSClient(D2UpdateMessagePtr& response_placeholder, Callback* callback,
-              const Protocol proto = UDP);
+              const Protocol proto = UDP,
+              const DnsTcpConnectionPoolPtr& tcp_pool =
+              DnsTcpConnectionPoolPtr());
 
-    /// @brief Virtual destructor, does nothing.
+    /// @brief Destructor.
+    ///
+    /// Cancels the TCP exchanges in progress, if any.  If the completion
+    /// of an exchange is being invoked by another thread, waits for it to
+    /// return.
     ~DNSClient();
 
     ///
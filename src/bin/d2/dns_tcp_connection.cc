@@ -0,0 +1,554 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_log.h>
+#include <d2/dns_tcp_connection.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/asio/write.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/bind.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace d2 {
+
+DnsTcpConnection::DnsTcpConnection(IOService& io_service,
+                                   const IOAddress& address,
+                                   const uint16_t port)
+    : io_service_(io_service), address_(address), port_(port),
+      socket_(io_service.get_io_service()), state_(CLOSED), generation_(0),
+      open_count_(0), outstanding_(), reserved_count_(0), backlog_(),
+      write_queue_(),
+      writing_(false), read_buffer_(), completions_(), running_(),
+      running_cond_() {
+}
+
+DnsTcpConnection::~DnsTcpConnection() {
+    boost::system::error_code ignored;
+    socket_.close(ignored);
+}
+
+std::string
+DnsTcpConnection::toText() const {
+    std::ostringstream stream;
+    stream << address_.toText() << " port:" << port_;
+    return (stream.str());
+}
+
+void
+DnsTcpConnection::send(const OutputBufferPtr& request,
+                       const unsigned int wait,
+                       const Handler& handler) {
+    if (!request || (request->getLength() < sizeof(uint16_t))) {
+        isc_throw(BadValue, "DNS message sent over TCP is too short");
+    }
+
+    if (request->getLength() > MAX_MESSAGE_SIZE) {
+        isc_throw(BadValue, "DNS message sent over TCP is too large: "
+                  << request->getLength() << " bytes");
+    }
+
+    RequestPtr req(new Request());
+    req->request_ = request;
+    req->id_ = (static_cast<uint16_t>((*request)[0]) << 8) | (*request)[1];
+    req->length_[0] = static_cast<uint8_t>(request->getLength() >> 8);
+    req->length_[1] = static_cast<uint8_t>(request->getLength() & 0xff);
+    req->handler_ = handler;
+    req->done_ = false;
+    req->written_ = false;
+
+    Mutex::Locker lock(mutex_);
+    req->timer_.reset(new boost::asio::deadline_timer(io_service_.
+                                                      get_io_service()));
+    req->timer_->expires_from_now(boost::posix_time::milliseconds(wait));
+    req->timer_->async_wait(boost::bind(&DnsTcpConnection::timeoutHandler,
+                                        shared_from_this(),
+                                        boost::weak_ptr<Request>(req), _1));
+
+    if (outstanding_.count(req->id_)) {
+        // The server could not tell the responses apart, so the message
+        // waits until the ID is released.
+        backlog_.push_back(req);
+    } else {
+        enqueue(req);
+    }
+
+    if (state_ == CLOSED) {
+        connect();
+    }
+}
+
+void
+DnsTcpConnection::cancel(const OutputBufferPtr& request) {
+    // The handler of the message is cleared, so that there is nothing to
+    // invoke for it.
+    Mutex::Locker lock(mutex_);
+    RequestPtr req;
+    for (std::map<uint16_t, RequestPtr>::iterator it = outstanding_.begin();
+         !req && (it != outstanding_.end()); ++it) {
+        if (it->second->request_ == request) {
+            req = it->second;
+        }
+    }
+
+    for (std::list<RequestPtr>::iterator it = backlog_.begin();
+         !req && (it != backlog_.end()); ++it) {
+        if ((*it)->request_ == request) {
+            req = *it;
+        }
+    }
+
+    if (req) {
+        req->handler_.clear();
+        complete(req, boost::system::error_code());
+    }
+
+    // The message may have been completed already, with its handler yet
+    // to be invoked or being invoked.
+    for (std::deque<Completion>::iterator it = completions_.begin();
+         it != completions_.end(); ) {
+        if (it->request_ == request) {
+            it = completions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    while (isRunningElsewhere(request)) {
+        running_cond_.wait(mutex_);
+    }
+}
+
+void
+DnsTcpConnection::close() {
+    {
+        Mutex::Locker lock(mutex_);
+        closeWithError(boost::asio::error::operation_aborted);
+    }
+    runCompletions();
+}
+
+void
+DnsTcpConnection::connect() {
+    state_ = CONNECTING;
+    boost::asio::ip::tcp::endpoint
+        endpoint(boost::asio::ip::address::from_string(address_.toText()),
+                 port_);
+    socket_.async_connect(endpoint,
+                          boost::bind(&DnsTcpConnection::connectHandler,
+                                      shared_from_this(), generation_, _1));
+}
+
+void
+DnsTcpConnection::enqueue(const RequestPtr& request) {
+    outstanding_[request->id_] = request;
+    write_queue_.push_back(request);
+    if ((state_ == OPEN) && !writing_) {
+        writeNext();
+    }
+}
+
+void
+DnsTcpConnection::writeNext() {
+    // Skip the messages which were completed before being written.
+    while (!write_queue_.empty() && write_queue_.front()->done_) {
+        write_queue_.pop_front();
+    }
+
+    if (write_queue_.empty()) {
+        writing_ = false;
+        return;
+    }
+
+    RequestPtr req = write_queue_.front();
+    req->written_ = true;
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.push_back(boost::asio::buffer(req->length_,
+                                          sizeof(req->length_)));
+    buffers.push_back(boost::asio::buffer(req->request_->getData(),
+                                          req->request_->getLength()));
+    writing_ = true;
+    boost::asio::async_write(socket_, buffers,
+                             boost::bind(&DnsTcpConnection::writeHandler,
+                                         shared_from_this(), generation_,
+                                         req, _1));
+}
+
+void
+DnsTcpConnection::readLength() {
+    boost::asio::async_read(socket_,
+                            boost::asio::buffer(read_length_,
+                                                sizeof(read_length_)),
+                            boost::bind(&DnsTcpConnection::readLengthHandler,
+                                        shared_from_this(), generation_, _1));
+}
+
+void
+DnsTcpConnection::connectHandler(const unsigned int generation,
+                                 const boost::system::error_code& ec) {
+    {
+        Mutex::Locker lock(mutex_);
+        if (generation != generation_) {
+            return;
+        }
+
+        if (ec) {
+            closeWithError(ec);
+        } else {
+            state_ = OPEN;
+            ++open_count_;
+            boost::system::error_code ignored;
+            socket_.set_option(boost::asio::ip::tcp::no_delay(true), ignored);
+            LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                      DHCP_DDNS_TCP_CONNECTION_OPENED).arg(toText());
+
+            readLength();
+            writeNext();
+        }
+    }
+    runCompletions();
+}
+
+void
+DnsTcpConnection::writeHandler(const unsigned int generation,
+                               const RequestPtr&,
+                               const boost::system::error_code& ec) {
+    {
+        Mutex::Locker lock(mutex_);
+        if (generation != generation_) {
+            return;
+        }
+
+        if (ec) {
+            closeWithError(ec);
+        } else {
+            write_queue_.pop_front();
+            writeNext();
+        }
+    }
+    runCompletions();
+}
+
+void
+DnsTcpConnection::readLengthHandler(const unsigned int generation,
+                                    const boost::system::error_code& ec) {
+    {
+        Mutex::Locker lock(mutex_);
+        if (generation != generation_) {
+            return;
+        }
+
+        if (ec) {
+            closeWithError(ec);
+        } else {
+            const size_t length = (static_cast<size_t>(read_length_[0]) << 8) |
+                                  read_length_[1];
+            if (length == 0) {
+                readLength();
+                return;
+            }
+
+            read_buffer_.resize(length);
+            boost::asio::async_read(socket_,
+                                    boost::asio::buffer(&read_buffer_[0],
+                                                        length),
+                                    boost::bind(&DnsTcpConnection::
+                                                readMessageHandler,
+                                                shared_from_this(),
+                                                generation_, _1));
+            return;
+        }
+    }
+    runCompletions();
+}
+
+void
+DnsTcpConnection::readMessageHandler(const unsigned int generation,
+                                     const boost::system::error_code& ec) {
+    {
+        Mutex::Locker lock(mutex_);
+        if (generation != generation_) {
+            return;
+        }
+
+        if (ec) {
+            closeWithError(ec);
+        } else {
+            RequestPtr req;
+            if (read_buffer_.size() >= sizeof(uint16_t)) {
+                const uint16_t id =
+                    (static_cast<uint16_t>(read_buffer_[0]) << 8) |
+                    read_buffer_[1];
+                std::map<uint16_t, RequestPtr>::iterator it =
+                    outstanding_.find(id);
+                if (it == outstanding_.end()) {
+                    LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                              DHCP_DDNS_TCP_UNEXPECTED_RESPONSE)
+                        .arg(id).arg(toText());
+                } else if (it->second->done_) {
+                    // The late response releases the ID.
+                    LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                              DHCP_DDNS_TCP_LATE_RESPONSE)
+                        .arg(id).arg(toText());
+                    RequestPtr late = it->second;
+                    --reserved_count_;
+                    forget(late);
+                } else {
+                    req = it->second;
+                }
+            }
+
+            // The response is moved to the completion as the next read
+            // reuses the buffer.
+            if (req) {
+                complete(req, boost::system::error_code(), &read_buffer_);
+            }
+
+            readLength();
+        }
+    }
+    runCompletions();
+}
+
+void
+DnsTcpConnection::timeoutHandler(const boost::weak_ptr<Request>& weak_request,
+                                 const boost::system::error_code& ec) {
+    RequestPtr req = weak_request.lock();
+    if (ec || !req) {
+        return;
+    }
+
+    {
+        Mutex::Locker lock(mutex_);
+        // A held back message waits for its ID to be released.  When the
+        // ID is reserved by a message which timed out, the response which
+        // would release it may never come: the connection is wedged.
+        bool wedged = false;
+        if (!req->done_ && !req->written_) {
+            std::map<uint16_t, RequestPtr>::const_iterator it =
+                outstanding_.find(req->id_);
+            wedged = ((it != outstanding_.end()) && it->second->done_);
+        }
+
+        complete(req, boost::asio::error::timed_out);
+
+        if (wedged) {
+            LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                      DHCP_DDNS_TCP_CONNECTION_RESET)
+                .arg(toText()).arg(req->id_);
+            reset(boost::asio::error::connection_reset);
+        }
+    }
+    runCompletions();
+}
+
+void
+DnsTcpConnection::forget(const RequestPtr& request) {
+    std::map<uint16_t, RequestPtr>::iterator it =
+        outstanding_.find(request->id_);
+    if ((it != outstanding_.end()) && (it->second == request)) {
+        outstanding_.erase(it);
+
+        // Send the next message held back for the ID.
+        for (std::list<RequestPtr>::iterator next = backlog_.begin();
+             next != backlog_.end(); ++next) {
+            if ((*next)->id_ == request->id_) {
+                RequestPtr next_req = *next;
+                backlog_.erase(next);
+                enqueue(next_req);
+                break;
+            }
+        }
+    } else {
+        backlog_.remove(request);
+    }
+}
+
+void
+DnsTcpConnection::complete(const RequestPtr& request,
+                           const boost::system::error_code& ec,
+                           std::vector<uint8_t>* response) {
+    if (request->done_) {
+        return;
+    }
+
+    request->done_ = true;
+    boost::system::error_code ignored;
+    request->timer_->cancel(ignored);
+
+    // The server may still respond to a message which has been written:
+    // its ID stays reserved until then.
+    std::map<uint16_t, RequestPtr>::const_iterator it =
+        outstanding_.find(request->id_);
+    if (!response && request->written_ && (it != outstanding_.end()) &&
+        (it->second == request)) {
+        ++reserved_count_;
+    } else {
+        forget(request);
+    }
+
+    if (request->handler_) {
+        completions_.push_back(Completion());
+        Completion& completion = completions_.back();
+        completion.request_ = request->request_;
+        completion.handler_.swap(request->handler_);
+        completion.ec_ = ec;
+        if (response) {
+            completion.response_.swap(*response);
+        }
+    }
+}
+
+void
+DnsTcpConnection::runCompletions() {
+    // The handlers are taken one at a time, so that a message cancelled in
+    // the meantime is no longer invoked.  The handler being invoked is
+    // recorded so that cancel() waits for it to return.
+    const pthread_t self = pthread_self();
+    for (;;) {
+        Completion completion;
+        std::list<std::pair<OutputBufferPtr, pthread_t> >::iterator running;
+        {
+            Mutex::Locker lock(mutex_);
+            if (completions_.empty()) {
+                return;
+            }
+
+            std::swap(completion, completions_.front());
+            completions_.pop_front();
+            running = running_.insert(running_.end(),
+                                      std::make_pair(completion.request_,
+                                                     self));
+        }
+
+        try {
+            const uint8_t* data = (completion.response_.empty() ? NULL :
+                                   &completion.response_[0]);
+            completion.handler_(completion.ec_, data,
+                                completion.response_.size());
+        } catch (...) {
+            Mutex::Locker lock(mutex_);
+            running_.erase(running);
+            running_cond_.broadcast();
+            throw;
+        }
+
+        Mutex::Locker lock(mutex_);
+        running_.erase(running);
+        running_cond_.broadcast();
+    }
+}
+
+bool
+DnsTcpConnection::isRunningElsewhere(const OutputBufferPtr& request) const {
+    const pthread_t self = pthread_self();
+    for (std::list<std::pair<OutputBufferPtr, pthread_t> >::const_iterator
+         it = running_.begin(); it != running_.end(); ++it) {
+        if ((it->first == request) && !pthread_equal(it->second, self)) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void
+DnsTcpConnection::closeWithError(const boost::system::error_code& ec) {
+    if (state_ == CLOSED) {
+        return;
+    }
+
+    if (ec != boost::asio::error::operation_aborted) {
+        LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_TCP_CONNECTION_ERROR)
+            .arg(toText()).arg(ec.message());
+    }
+
+    reset(ec);
+}
+
+void
+DnsTcpConnection::reset(const boost::system::error_code& ec) {
+    if (state_ == CLOSED) {
+        return;
+    }
+
+    // Reset the connection before the handlers are invoked so they can send
+    // on a new one.
+    ++generation_;
+    state_ = CLOSED;
+    writing_ = false;
+    boost::system::error_code ignored;
+    socket_.close(ignored);
+
+    std::vector<RequestPtr> requests;
+    for (std::map<uint16_t, RequestPtr>::iterator it = outstanding_.begin();
+         it != outstanding_.end(); ++it) {
+        requests.push_back(it->second);
+    }
+    requests.insert(requests.end(), backlog_.begin(), backlog_.end());
+    outstanding_.clear();
+    reserved_count_ = 0;
+    backlog_.clear();
+    write_queue_.clear();
+
+    for (std::vector<RequestPtr>::iterator it = requests.begin();
+         it != requests.end(); ++it) {
+        complete(*it, ec);
+    }
+}
+
+DnsTcpConnectionPool::DnsTcpConnectionPool()
+    : mutex_(), connections_() {
+}
+
+DnsTcpConnectionPool::~DnsTcpConnectionPool() {
+    closeAll();
+}
+
+DnsTcpConnectionPtr
+DnsTcpConnectionPool::getConnection(IOService& io_service,
+                                    const IOAddress& address,
+                                    const uint16_t port) {
+    ServerKey key(address, port);
+    Mutex::Locker lock(mutex_);
+    std::map<ServerKey, DnsTcpConnectionPtr>::iterator it =
+        connections_.find(key);
+    if (it != connections_.end()) {
+        return (it->second);
+    }
+
+    DnsTcpConnectionPtr connection(new DnsTcpConnection(io_service, address,
+                                                        port));
+    connections_.insert(std::make_pair(key, connection));
+    return (connection);
+}
+
+void
+DnsTcpConnectionPool::closeAll() {
+    // Detach the connections first as the handlers invoked on close may
+    // use the pool.
+    std::map<ServerKey, DnsTcpConnectionPtr> connections;
+    {
+        Mutex::Locker lock(mutex_);
+        connections.swap(connections_);
+    }
+    for (std::map<ServerKey, DnsTcpConnectionPtr>::iterator it =
+         connections.begin(); it != connections.end(); ++it) {
+        it->second->close();
+    }
+}
+
+} // namespace isc::d2
+} // namespace isc
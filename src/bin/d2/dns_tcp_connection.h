@@ -0,0 +1,410 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DNS_TCP_CONNECTION_H
+#define DNS_TCP_CONNECTION_H
+
+/// @file dns_tcp_connection.h This file defines the classes
+/// DnsTcpConnection and DnsTcpConnectionPool.
+
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <util/buffer.h>
+#include <util/threads/sync.h>
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <pthread.h>
+
+#include <deque>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Persistent TCP connection to a DNS server.
+///
+/// A DnsTcpConnection carries DNS messages to a single server over one TCP
+/// connection, framed as described in RFC 1035, section 4.2.2.  The
+/// connection is opened by the first message sent and is kept open so that
+/// subsequent messages, possibly from different transactions, reuse it.
+///
+/// Messages are pipelined: a message is written as soon as the previous one
+/// has been written, without waiting for its response, and responses are
+/// matched to their requests by message ID, in whatever order the server
+/// sends them.  A message whose ID is already in use on the connection is
+/// held back until the ID is released.
+///
+/// Each message has its own timeout.  A timeout fails only the message it
+/// applies to; a connection error fails all of the messages waiting on the
+/// connection, which is then reopened by the next message sent.
+///
+/// The server may still respond to a message which has been written and
+/// has then timed out or been cancelled.  So that such a late response is
+/// not taken for the response to another message, the ID of the message
+/// stays reserved until the late response is received, which is dropped,
+/// or until the connection is closed.  When a message held back by a
+/// reserved ID times out the connection is reset to release the ID.
+///
+/// The completion handler of a message is always invoked from the IO
+/// service, never from within @c send.
+///
+/// A connection may be used from several threads running the IO service:
+/// its state is protected by a mutex, which is released before invoking
+/// the completion handlers, so that a handler may send on the connection.
+class DnsTcpConnection :
+        public boost::enable_shared_from_this<DnsTcpConnection>,
+        private boost::noncopyable {
+public:
+    /// @brief Maximum size of a message carried over TCP.
+    static const size_t MAX_MESSAGE_SIZE = 65535;
+
+    /// @brief Message completion handler.
+    ///
+    /// The handler is given the outcome of the exchange and, on success,
+    /// the response in wire format.  The outcome is one of:
+    /// - success: a response has been received,
+    /// - boost::asio::error::timed_out: no response within the timeout,
+    /// - boost::asio::error::operation_aborted: the connection was closed
+    /// by @c close,
+    /// - any other error: the connection failed.
+    typedef boost::function<void (const boost::system::error_code& ec,
+                                  const uint8_t* data,
+                                  size_t length)> Handler;
+
+    /// @brief Constructor
+    ///
+    /// The connection is not opened until a message is sent.
+    ///
+    /// @param io_service IO service to be used for IO processing
+    /// @param address address of the DNS server
+    /// @param port port of the DNS server
+    DnsTcpConnection(asiolink::IOService& io_service,
+                     const asiolink::IOAddress& address,
+                     const uint16_t port);
+
+    /// @brief Destructor
+    ///
+    /// Closes the socket without invoking the pending handlers.
+    ~DnsTcpConnection();
+
+    /// @brief Sends a message to the server.
+    ///
+    /// Opens the connection if it is not open and queues the message for
+    /// writing.
+    ///
+    /// @param request the message in wire format.  The buffer must not be
+    /// modified until the handler has been invoked or the message has been
+    /// cancelled.
+    /// @param wait timeout in milliseconds for the response
+    /// @param handler handler to invoke upon completion
+    ///
+    /// @throw isc::BadValue if the message is shorter than a DNS header ID
+    /// or larger than @c MAX_MESSAGE_SIZE.
+    void send(const util::OutputBufferPtr& request, const unsigned int wait,
+              const Handler& handler);
+
+    /// @brief Cancels a message.
+    ///
+    /// The message's handler will not be invoked.  A response received
+    /// later for the message is dropped.  If the message has been written
+    /// its ID stays reserved until then.  If the handler is being invoked
+    /// by another thread, waits for it to return.
+    ///
+    /// @param request the message as given to @c send
+    void cancel(const util::OutputBufferPtr& request);
+
+    /// @brief Closes the connection.
+    ///
+    /// The handlers of the messages waiting on the connection are invoked
+    /// with boost::asio::error::operation_aborted.
+    void close();
+
+    /// @brief Indicates whether the connection is open.
+    bool isOpen() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (state_ == OPEN);
+    }
+
+    /// @brief Returns the number of messages waiting for a response.
+    ///
+    /// The messages which timed out or were cancelled while their ID is
+    /// still reserved are not counted.
+    size_t getPendingCount() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (outstanding_.size() - reserved_count_ + backlog_.size());
+    }
+
+    /// @brief Returns the number of IDs reserved by messages which timed
+    /// out or were cancelled after being written.
+    size_t getReservedCount() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (reserved_count_);
+    }
+
+    /// @brief Returns the number of times the connection has been opened.
+    size_t getOpenCount() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (open_count_);
+    }
+
+    /// @brief Returns the address of the DNS server.
+    const asiolink::IOAddress& getAddress() const {
+        return (address_);
+    }
+
+    /// @brief Returns the port of the DNS server.
+    uint16_t getPort() const {
+        return (port_);
+    }
+
+    /// @brief Returns the server as text for logging.
+    std::string toText() const;
+
+private:
+    /// @brief A message sent over the connection.
+    struct Request {
+        /// @brief The message in wire format.
+        util::OutputBufferPtr request_;
+        /// @brief The message ID.
+        uint16_t id_;
+        /// @brief The framing length prefix.
+        uint8_t length_[2];
+        /// @brief Completion handler.
+        Handler handler_;
+        /// @brief Response timer.
+        boost::shared_ptr<boost::asio::deadline_timer> timer_;
+        /// @brief Set once the message has been completed or cancelled.
+        bool done_;
+        /// @brief Set once the message has started being written.
+        bool written_;
+    };
+
+    /// @brief Defines a pointer to a Request.
+    typedef boost::shared_ptr<Request> RequestPtr;
+
+    /// @brief A completion handler invocation, deferred until the mutex
+    /// is released.
+    struct Completion {
+        /// @brief The message as given to @c send.
+        util::OutputBufferPtr request_;
+        /// @brief Completion handler.
+        Handler handler_;
+        /// @brief Outcome of the exchange.
+        boost::system::error_code ec_;
+        /// @brief The response, if any.
+        std::vector<uint8_t> response_;
+    };
+
+    /// @brief Connection states.
+    enum State {
+        CLOSED,
+        CONNECTING,
+        OPEN
+    };
+
+    /// @brief Opens the connection.
+    void connect();
+
+    /// @brief Queues a message for writing and registers its ID.
+    void enqueue(const RequestPtr& request);
+
+    /// @brief Writes the next queued message, if any.
+    void writeNext();
+
+    /// @brief Starts reading the length prefix of the next response.
+    void readLength();
+
+    /// @brief Connect completion handler.
+    void connectHandler(const unsigned int generation,
+                        const boost::system::error_code& ec);
+
+    /// @brief Write completion handler.
+    ///
+    /// The message being written is bound to the handler to keep its
+    /// buffers alive until the write completes.
+    void writeHandler(const unsigned int generation,
+                      const RequestPtr& request,
+                      const boost::system::error_code& ec);
+
+    /// @brief Length prefix read completion handler.
+    void readLengthHandler(const unsigned int generation,
+                           const boost::system::error_code& ec);
+
+    /// @brief Response read completion handler.
+    void readMessageHandler(const unsigned int generation,
+                            const boost::system::error_code& ec);
+
+    /// @brief Response timer handler.
+    void timeoutHandler(const boost::weak_ptr<Request>& weak_request,
+                        const boost::system::error_code& ec);
+
+    /// @brief Completes a message.
+    ///
+    /// The invocation of the message's handler is added to the list of the
+    /// completions, invoked by @c runCompletions.  When the message has
+    /// been written and no response is given, its ID stays reserved.
+    /// Otherwise the next held back message with the same ID, if any, is
+    /// queued for writing.
+    ///
+    /// @param request the message
+    /// @param ec the outcome of the exchange
+    /// @param response the response, swapped into the completion, or NULL
+    void complete(const RequestPtr& request,
+                  const boost::system::error_code& ec,
+                  std::vector<uint8_t>* response = NULL);
+
+    /// @brief Invokes the handlers of the completed messages.
+    ///
+    /// Must be called without holding the mutex.
+    void runCompletions();
+
+    /// @brief Indicates whether the handler of a message is being invoked
+    /// by a thread other than the calling one.
+    ///
+    /// @param request the message as given to @c send
+    bool isRunningElsewhere(const util::OutputBufferPtr& request) const;
+
+    /// @brief Removes a message from the connection's lists.
+    void forget(const RequestPtr& request);
+
+    /// @brief Logs the error, closes the socket and fails all of the
+    /// waiting messages.
+    void closeWithError(const boost::system::error_code& ec);
+
+    /// @brief Closes the socket and fails all of the waiting messages.
+    ///
+    /// The IDs reserved by the completed messages are released.
+    ///
+    /// @param ec the error given to the handlers of the waiting messages
+    void reset(const boost::system::error_code& ec);
+
+    /// @brief Mutex protecting the members below.
+    mutable util::thread::Mutex mutex_;
+
+    /// @brief IO service used for IO processing.
+    asiolink::IOService& io_service_;
+
+    /// @brief Address of the DNS server.
+    asiolink::IOAddress address_;
+
+    /// @brief Port of the DNS server.
+    uint16_t port_;
+
+    /// @brief The socket.
+    boost::asio::ip::tcp::socket socket_;
+
+    /// @brief Connection state.
+    State state_;
+
+    /// @brief Incremented when the socket is closed so that completions
+    /// of the IO started on the previous socket are ignored.
+    unsigned int generation_;
+
+    /// @brief Number of times the connection has been opened.
+    size_t open_count_;
+
+    /// @brief Messages waiting for a response, by message ID.
+    ///
+    /// It also holds the completed messages which reserve their ID.
+    std::map<uint16_t, RequestPtr> outstanding_;
+
+    /// @brief Number of completed messages in @c outstanding_.
+    size_t reserved_count_;
+
+    /// @brief Messages held back because their ID is outstanding.
+    std::list<RequestPtr> backlog_;
+
+    /// @brief Messages to be written, the first one is being written
+    /// when @c writing_ is true.
+    std::deque<RequestPtr> write_queue_;
+
+    /// @brief True when a write is in progress.
+    bool writing_;
+
+    /// @brief Buffer for the length prefix of a response.
+    uint8_t read_length_[2];
+
+    /// @brief Buffer for a response.
+    std::vector<uint8_t> read_buffer_;
+
+    /// @brief Handlers of the completed messages waiting to be invoked.
+    std::deque<Completion> completions_;
+
+    /// @brief Messages whose handler is being invoked, with the thread
+    /// invoking it.
+    std::list<std::pair<util::OutputBufferPtr, pthread_t> > running_;
+
+    /// @brief Signaled when a handler returns.
+    util::thread::CondVar running_cond_;
+};
+
+/// @brief Defines a pointer to a DnsTcpConnection.
+typedef boost::shared_ptr<DnsTcpConnection> DnsTcpConnectionPtr;
+
+/// @brief Set of TCP connections to DNS servers.
+///
+/// The pool holds one DnsTcpConnection per DNS server address and port so
+/// that all of the DNSClients sharing the pool reuse the same connection
+/// to a given server.  The pool may be used from several threads.
+class DnsTcpConnectionPool : private boost::noncopyable {
+public:
+    /// @brief Constructor
+    DnsTcpConnectionPool();
+
+    /// @brief Destructor
+    ///
+    /// Closes all of the connections.
+    ~DnsTcpConnectionPool();
+
+    /// @brief Returns the connection to a server, creating it if needed.
+    ///
+    /// @param io_service IO service to be used by a new connection
+    /// @param address address of the DNS server
+    /// @param port port of the DNS server
+    ///
+    /// @return pointer to the connection.
+    DnsTcpConnectionPtr getConnection(asiolink::IOService& io_service,
+                                      const asiolink::IOAddress& address,
+                                      const uint16_t port);
+
+    /// @brief Closes and removes all of the connections.
+    void closeAll();
+
+    /// @brief Returns the number of connections in the pool.
+    size_t getConnectionCount() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (connections_.size());
+    }
+
+private:
+    /// @brief Mutex protecting the connections.
+    mutable util::thread::Mutex mutex_;
+
+    /// @brief Defines the key of a connection: server address and port.
+    typedef std::pair<asiolink::IOAddress, uint16_t> ServerKey;
+
+    /// @brief The connections.
+    std::map<ServerKey, DnsTcpConnectionPtr> connections_;
+};
+
+/// @brief Defines a pointer to a DnsTcpConnectionPool.
+typedef boost::shared_ptr<DnsTcpConnectionPool> DnsTcpConnectionPoolPtr;
+
+} // namespace isc::d2
+} // namespace isc
+
+#endif // DNS_TCP_CONNECTION_H
@@ -0,0 +1,605 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_log.h>
+#include <d2/d2_cfg_mgr.h>
+#include <d2/nc_add_batch.h>
+
+#include <boost/bind.hpp>
+
+#include <algorithm>
+
+namespace {
+
+/// @brief Returns the first request of a list.
+///
+/// @param ncrs the list of requests
+///
+/// @throw NameAddBatchTransactionError if the list is empty.
+isc::dhcp_ddns::NameChangeRequestPtr&
+firstNcr(isc::d2::NameChangeRequestList& ncrs) {
+    if (ncrs.empty()) {
+        isc_throw(isc::d2::NameAddBatchTransactionError,
+                  "NameAddBatchTransaction, request list cannot be empty");
+    }
+
+    return (ncrs[0]);
+}
+
+/// @brief Size of the fixed part of an RR (type, class, TTL, RDLENGTH).
+const size_t RR_FIXED_SIZE = 10;
+
+/// @brief Wire size of the longest reverse name (IPv6 nibbles).
+const size_t MAX_REVERSE_NAME_SIZE = 74;
+
+/// @brief Returns an upper bound of the wire size of a name.
+///
+/// @param name the name in text form
+size_t
+nameSize(const std::string& name) {
+    return (name.size() + 2);
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace d2 {
+
+// NameAddBatchTransaction states
+const int NameAddBatchTransaction::ADDING_FWD_ADDRS_ST;
+const int NameAddBatchTransaction::REPLACING_REV_PTRS_ST;
+
+const size_t NameAddBatchTransaction::MESSAGE_HEADER_SIZE;
+const size_t NameAddBatchTransaction::TSIG_SIZE_ALLOWANCE;
+
+NameAddBatchTransaction::
+NameAddBatchTransaction(asiolink::IOServicePtr& io_service,
+                        NameChangeRequestList& ncrs,
+                        DdnsDomainPtr& forward_domain,
+                        DdnsDomainPtr& reverse_domain,
+                        D2CfgMgrPtr& cfg_mgr)
+    : NameChangeTransaction(io_service, firstNcr(ncrs), forward_domain,
+                            reverse_domain, cfg_mgr),
+      ncrs_(ncrs), rejected_(false) {
+    for (NameChangeRequestList::const_iterator ncr = ncrs_.begin();
+         ncr != ncrs_.end(); ++ncr) {
+        if (!(*ncr) || ((*ncr)->getChangeType() != dhcp_ddns::CHG_ADD)) {
+            isc_throw (NameAddBatchTransactionError,
+                       "NameAddBatchTransaction, request type must be CHG_ADD");
+        }
+    }
+}
+
+NameAddBatchTransaction::~NameAddBatchTransaction(){
+}
+
+size_t
+NameAddBatchTransaction::getRequestSize(const dhcp_ddns::
+                                        NameChangeRequest& ncr) {
+    const size_t fqdn_size = nameSize(ncr.getFqdn());
+    const size_t dhcid_size = ncr.getDhcid().getBytes().size();
+    size_t size = 0;
+    if (ncr.isForwardChange()) {
+        // 'FQDN Is Not In Use' prerequisite, address and DHCID RRs.
+        size = (3 * (fqdn_size + RR_FIXED_SIZE)) +
+               (ncr.isV4() ? 4 : 16) + dhcid_size;
+    }
+
+    if (ncr.isReverseChange()) {
+        // PTR and DHCID 'delete' and 'add' RRs.
+        size = std::max(size, (4 * (MAX_REVERSE_NAME_SIZE + RR_FIXED_SIZE)) +
+                              fqdn_size + dhcid_size);
+    }
+
+    return (size);
+}
+
+size_t
+NameAddBatchTransaction::getOverheadSize(const DdnsDomainPtr& forward_domain,
+                                         const DdnsDomainPtr& reverse_domain) {
+    size_t size = 0;
+    const DdnsDomainPtr domains[] = { forward_domain, reverse_domain };
+    for (size_t i = 0; i < 2; ++i) {
+        if (!domains[i]) {
+            continue;
+        }
+
+        // Zone section: name, type and class.
+        size_t domain_size = MESSAGE_HEADER_SIZE +
+                             nameSize(domains[i]->getName()) + 4;
+        TSIGKeyInfoPtr tsig_key_info = domains[i]->getTSIGKeyInfo();
+        if (tsig_key_info) {
+            domain_size += nameSize(tsig_key_info->getName()) +
+                           TSIG_SIZE_ALLOWANCE;
+        }
+
+        size = std::max(size, domain_size);
+    }
+
+    return (size);
+}
+
+void
+NameAddBatchTransaction::defineStates() {
+    // Call superclass impl first.
+    NameChangeTransaction::defineStates();
+
+    // Define NameAddBatchTransaction states.
+    defineState(READY_ST, "READY_ST",
+             boost::bind(&NameAddBatchTransaction::readyHandler, this));
+
+    defineState(SELECTING_FWD_SERVER_ST, "SELECTING_FWD_SERVER_ST",
+             boost::bind(&NameAddBatchTransaction::selectingFwdServerHandler,
+                         this));
+
+    defineState(SELECTING_REV_SERVER_ST, "SELECTING_REV_SERVER_ST",
+             boost::bind(&NameAddBatchTransaction::selectingRevServerHandler,
+                         this));
+
+    defineState(ADDING_FWD_ADDRS_ST, "ADDING_FWD_ADDRS_ST",
+             boost::bind(&NameAddBatchTransaction::addingFwdAddrsHandler,
+                         this));
+
+    defineState(REPLACING_REV_PTRS_ST, "REPLACING_REV_PTRS_ST",
+             boost::bind(&NameAddBatchTransaction::replacingRevPtrsHandler,
+                         this));
+
+    defineState(PROCESS_TRANS_OK_ST, "PROCESS_TRANS_OK_ST",
+             boost::bind(&NameAddBatchTransaction::processAddOkHandler, this));
+
+    defineState(PROCESS_TRANS_FAILED_ST, "PROCESS_TRANS_FAILED_ST",
+             boost::bind(&NameAddBatchTransaction::processAddFailedHandler,
+                         this));
+}
+
+void
+NameAddBatchTransaction::verifyStates() {
+    // Call superclass implementation first to verify its states. These are
+    // states common to all transactions, and they must be defined.
+    // READY_ST
+    // SELECTING_FWD_SERVER_ST
+    // SELECTING_REV_SERVER_ST
+    // PROCESS_TRANS_OK_ST
+    // PROCESS_TRANS_FAILED_ST
+    NameChangeTransaction::verifyStates();
+
+    // Verify NameAddBatchTransaction states by attempting to fetch them.
+    getState(ADDING_FWD_ADDRS_ST);
+    getState(REPLACING_REV_PTRS_ST);
+}
+
+void
+NameAddBatchTransaction::readyHandler() {
+    switch(getNextEvent()) {
+    case START_EVT:
+        if (getForwardDomain()) {
+            // Requests include forward changes, do those first.
+            transition(SELECTING_FWD_SERVER_ST, SELECT_SERVER_EVT);
+        } else {
+            // Reverse changes only, transition accordingly.
+            transition(SELECTING_REV_SERVER_ST, SELECT_SERVER_EVT);
+        }
+
+        break;
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+}
+
+void
+NameAddBatchTransaction::selectingFwdServerHandler() {
+    switch(getNextEvent()) {
+    case SELECT_SERVER_EVT:
+        // First time through for this transaction, so initialize server
+        // selection.
+        initServerSelection(getForwardDomain());
+        break;
+    case SERVER_IO_ERROR_EVT:
+        // We failed to communicate with current server. Attempt to select
+        // another one below.
+        break;
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+
+    // Select the next server from the list of forward servers.
+    if (selectNextServer()) {
+        // We have a server to try.
+        transition(ADDING_FWD_ADDRS_ST, SERVER_SELECTED_EVT);
+    }
+    else {
+        // Server list is exhausted, so fail the transaction.
+        transition(PROCESS_TRANS_FAILED_ST, NO_MORE_SERVERS_EVT);
+    }
+}
+
+void
+NameAddBatchTransaction::addingFwdAddrsHandler() {
+    if (doOnEntry()) {
+        // Clear the request on initial transition. This allows us to reuse
+        // the request on retries if necessary.
+        clearDnsUpdateRequest();
+    }
+
+    switch(getNextEvent()) {
+    case SERVER_SELECTED_EVT:
+        if (!getDnsUpdateRequest()) {
+            // Request hasn't been constructed yet, so build it.
+            try {
+                buildAddFwdAddressRequest();
+            } catch (const std::exception& ex) {
+                LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_BUILD_FAILURE)
+                          .arg(getRequestId())
+                          .arg("forward add")
+                          .arg(ex.what());
+                transition(PROCESS_TRANS_FAILED_ST, UPDATE_FAILED_EVT);
+                break;
+            }
+        }
+
+        // Call sendUpdate() to initiate the async send. Note it also sets
+        // next event to NOP_EVT.
+        sendUpdate("Batch Forward Add");
+        break;
+
+    case IO_COMPLETED_EVT: {
+        switch (getDnsUpdateStatus()) {
+        case DNSClient::SUCCESS: {
+            // We successfully received a response packet from the server.
+            const dns::Rcode& rcode = getDnsUpdateResponse()->getRcode();
+            if (rcode == dns::Rcode::NOERROR()) {
+                // All of the FQDNs were added. Mark it as done.
+                setForwardChangeCompleted(true);
+
+                // If the requests call for reverse updates then do those
+                // next, otherwise we can process ok.
+                if (getReverseDomain()) {
+                    transition(SELECTING_REV_SERVER_ST, SELECT_SERVER_EVT);
+                } else {
+                    transition(PROCESS_TRANS_OK_ST, UPDATE_OK_EVT);
+                }
+            } else {
+                // Typically YXDOMAIN as one of the FQDNs is in use. The
+                // requests will be carried out one by one, so this is not
+                // an error.
+                LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                          DHCP_DDNS_BATCH_REJECTED)
+                          .arg(getRequestId())
+                          .arg(getCurrentServer()->toText())
+                          .arg("forward add")
+                          .arg(rcode.getCode());
+                rejected_ = true;
+                transition(PROCESS_TRANS_FAILED_ST, UPDATE_FAILED_EVT);
+            }
+
+            break;
+        }
+
+        case DNSClient::TIMEOUT:
+        case DNSClient::OTHER:
+            // We couldn't send to the current server, log it and set up
+            // to select the next server for a retry.
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_IO_ERROR)
+                      .arg(getRequestId())
+                      .arg("forward add")
+                      .arg(getCurrentServer()->toText());
+
+            retryTransition(SELECTING_FWD_SERVER_ST);
+            break;
+
+        case DNSClient::INVALID_RESPONSE:
+            // A response was received but was corrupt. Retry it like an IO
+            // error.
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_RESP_CORRUPT)
+                      .arg(getRequestId())
+                      .arg(getCurrentServer()->toText())
+                      .arg("forward add");
+
+            retryTransition(SELECTING_FWD_SERVER_ST);
+            break;
+
+        default:
+            // Any other value and we will fail this transaction, something
+            // bigger is wrong.
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_BAD_DNSCLIENT_STATUS)
+                      .arg(getRequestId())
+                      .arg(getDnsUpdateStatus())
+                      .arg("forward add")
+                      .arg(getCurrentServer()->toText());
+
+            transition(PROCESS_TRANS_FAILED_ST, UPDATE_FAILED_EVT);
+            break;
+        } // end switch on dns_status
+
+        break;
+    } // end case IO_COMPLETE_EVT
+
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+}
+
+void
+NameAddBatchTransaction::selectingRevServerHandler() {
+    switch(getNextEvent()) {
+    case SELECT_SERVER_EVT:
+        // First time through for this transaction, so initialize server
+        // selection.
+        initServerSelection(getReverseDomain());
+        break;
+    case SERVER_IO_ERROR_EVT:
+        // We failed to communicate with current server. Attempt to select
+        // another one below.
+        break;
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+
+    // Select the next server from the list of reverse servers.
+    if (selectNextServer()) {
+        // We have a server to try.
+        transition(REPLACING_REV_PTRS_ST, SERVER_SELECTED_EVT);
+    }
+    else {
+        // Server list is exhausted, so fail the transaction.
+        transition(PROCESS_TRANS_FAILED_ST, NO_MORE_SERVERS_EVT);
+    }
+}
+
+void
+NameAddBatchTransaction::replacingRevPtrsHandler() {
+    if (doOnEntry()) {
+        // Clear the request on initial transition. This allows us to reuse
+        // the request on retries if necessary.
+        clearDnsUpdateRequest();
+    }
+
+    switch(getNextEvent()) {
+    case SERVER_SELECTED_EVT:
+        if (!getDnsUpdateRequest()) {
+            // Request hasn't been constructed yet, so build it.
+            try {
+                buildReplaceRevPtrsRequest();
+            } catch (const std::exception& ex) {
+                LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_BUILD_FAILURE)
+                          .arg(getRequestId())
+                          .arg("reverse replace")
+                          .arg(ex.what());
+                transition(PROCESS_TRANS_FAILED_ST, UPDATE_FAILED_EVT);
+                break;
+            }
+        }
+
+        // Call sendUpdate() to initiate the async send. Note it also sets
+        // next event to NOP_EVT.
+        sendUpdate("Batch Reverse Replace");
+        break;
+
+    case IO_COMPLETED_EVT: {
+        switch (getDnsUpdateStatus()) {
+        case DNSClient::SUCCESS: {
+            // We successfully received a response packet from the server.
+            const dns::Rcode& rcode = getDnsUpdateResponse()->getRcode();
+            if (rcode == dns::Rcode::NOERROR()) {
+                // We were able to update the reverse mappings. Mark it as
+                // done.
+                setReverseChangeCompleted(true);
+                transition(PROCESS_TRANS_OK_ST, UPDATE_OK_EVT);
+            } else {
+                LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                          DHCP_DDNS_BATCH_REJECTED)
+                          .arg(getRequestId())
+                          .arg(getCurrentServer()->toText())
+                          .arg("reverse replace")
+                          .arg(rcode.getCode());
+                rejected_ = true;
+                transition(PROCESS_TRANS_FAILED_ST, UPDATE_FAILED_EVT);
+            }
+
+            break;
+        }
+
+        case DNSClient::TIMEOUT:
+        case DNSClient::OTHER:
+            // We couldn't send to the current server, log it and set up
+            // to select the next server for a retry.
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_IO_ERROR)
+                      .arg(getRequestId())
+                      .arg("reverse replace")
+                      .arg(getCurrentServer()->toText());
+
+            retryTransition(SELECTING_REV_SERVER_ST);
+            break;
+
+        case DNSClient::INVALID_RESPONSE:
+            // A response was received but was corrupt. Retry it like an IO
+            // error.
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_RESP_CORRUPT)
+                      .arg(getRequestId())
+                      .arg(getCurrentServer()->toText())
+                      .arg("reverse replace");
+
+            retryTransition(SELECTING_REV_SERVER_ST);
+            break;
+
+        default:
+            // Any other value and we will fail this transaction, something
+            // bigger is wrong.
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_BAD_DNSCLIENT_STATUS)
+                      .arg(getRequestId())
+                      .arg(getDnsUpdateStatus())
+                      .arg("reverse replace")
+                      .arg(getCurrentServer()->toText());
+
+            transition(PROCESS_TRANS_FAILED_ST, UPDATE_FAILED_EVT);
+            break;
+        } // end switch on dns_status
+
+        break;
+    } // end case IO_COMPLETE_EVT
+
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+}
+
+void
+NameAddBatchTransaction::processAddOkHandler() {
+    switch(getNextEvent()) {
+    case UPDATE_OK_EVT:
+        for (NameChangeRequestList::const_iterator ncr = ncrs_.begin();
+             ncr != ncrs_.end(); ++ncr) {
+            LOG_INFO(d2_to_dns_logger, DHCP_DDNS_ADD_SUCCEEDED)
+                     .arg((*ncr)->getRequestId())
+                     .arg((*ncr)->toText());
+            (*ncr)->setStatus(dhcp_ddns::ST_COMPLETED);
+        }
+
+        endModel();
+        break;
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+}
+
+void
+NameAddBatchTransaction::processAddFailedHandler() {
+    switch(getNextEvent()) {
+    case UPDATE_FAILED_EVT:
+    case NO_MORE_SERVERS_EVT:
+        setNcrStatus(dhcp_ddns::ST_FAILED);
+        if (rejected_) {
+            LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
+                      DHCP_DDNS_BATCH_FAILED)
+                      .arg(getRequestId())
+                      .arg(ncrs_.size())
+                      .arg(transactionOutcomeString());
+        } else {
+            // Carrying out the requests individually would only repeat
+            // the failure, so all of them fail.
+            for (NameChangeRequestList::const_iterator ncr = ncrs_.begin();
+                 ncr != ncrs_.end(); ++ncr) {
+                (*ncr)->setStatus(dhcp_ddns::ST_FAILED);
+            }
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_BATCH_ERROR)
+                      .arg(getRequestId())
+                      .arg(ncrs_.size())
+                      .arg(transactionOutcomeString());
+        }
+        endModel();
+        break;
+    default:
+        // Event is invalid.
+        isc_throw(NameAddBatchTransactionError,
+                  "Wrong event for context: " << getContextStr());
+    }
+}
+
+void
+NameAddBatchTransaction::buildAddFwdAddressRequest() {
+    // Construct an empty request.
+    D2UpdateMessagePtr request = prepNewRequest(getForwardDomain());
+
+    for (NameChangeRequestList::const_iterator ncr = ncrs_.begin();
+         ncr != ncrs_.end(); ++ncr) {
+        // Content for each request is based on RFC 4703, section 5.3.1
+        dns::Name fqdn(dns::Name((*ncr)->getFqdn()));
+
+        // Create 'FQDN Is Not In Use' prerequisite and add it to the
+        // prerequisite section.
+        // Based on RFC 2136, section 2.4.5
+        dns::RRsetPtr prereq(new dns::RRset(fqdn, dns::RRClass::NONE(),
+                                            dns::RRType::ANY(),
+                                            dns::RRTTL(0)));
+        request->addRRset(D2UpdateMessage::SECTION_PREREQUISITE, prereq);
+
+        // Create the TTL based on lease length.
+        dns::RRTTL lease_ttl((*ncr)->getLeaseLength());
+
+        // Create the FQDN/IP 'add' RR and add it to the to update section.
+        // Based on RFC 2136, section 2.5.1
+        dns::RRsetPtr update(new dns::RRset(fqdn, dns::RRClass::IN(),
+                                            ((*ncr)->isV4() ?
+                                             dns::RRType::A() :
+                                             dns::RRType::AAAA()),
+                                            lease_ttl));
+        addLeaseAddressRdata(update, **ncr);
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+
+        // Now create the FQDN/DHCID 'add' RR and add it to update section.
+        // Based on RFC 2136, section 2.5.1
+        update.reset(new dns::RRset(fqdn, dns::RRClass::IN(),
+                                    dns::RRType::DHCID(), lease_ttl));
+        addDhcidRdata(update, **ncr);
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+    }
+
+    // Set the transaction's update request to the new request.
+    setDnsUpdateRequest(request);
+}
+
+void
+NameAddBatchTransaction::buildReplaceRevPtrsRequest() {
+    // Construct an empty request.
+    D2UpdateMessagePtr request = prepNewRequest(getReverseDomain());
+
+    for (NameChangeRequestList::const_iterator ncr = ncrs_.begin();
+         ncr != ncrs_.end(); ++ncr) {
+        // Content for each request is based on RFC 4703, section 5.4
+        // Reverse replacement has no prerequisites.
+        std::string rev_addr =
+            D2CfgMgr::reverseIpAddress((*ncr)->getIpAddress());
+        dns::Name rev_ip(rev_addr);
+
+        // Create the TTL based on lease length.
+        dns::RRTTL lease_ttl((*ncr)->getLeaseLength());
+
+        // Create the PTR 'delete' RR and add it to update section.
+        dns::RRsetPtr update(new dns::RRset(rev_ip, dns::RRClass::ANY(),
+                                            dns::RRType::PTR(),
+                                            dns::RRTTL(0)));
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+
+        // Create the DHCID 'delete' RR and add it to the update section.
+        update.reset(new dns::RRset(rev_ip, dns::RRClass::ANY(),
+                                    dns::RRType::DHCID(), dns::RRTTL(0)));
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+
+        // Create the FQDN/IP PTR 'add' RR, add the FQDN as the PTR Rdata
+        // then add it to update section.
+        update.reset(new dns::RRset(rev_ip, dns::RRClass::IN(),
+                                    dns::RRType::PTR(), lease_ttl));
+        addPtrRdata(update, **ncr);
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+
+        // Create the FQDN/IP PTR 'add' RR, add the DHCID Rdata
+        // then add it to update section.
+        update.reset(new dns::RRset(rev_ip, dns::RRClass::IN(),
+                                    dns::RRType::DHCID(), lease_ttl));
+        addDhcidRdata(update, **ncr);
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+    }
+
+    // Set the transaction's update request to the new request.
+    setDnsUpdateRequest(request);
+}
+
+} // namespace isc::d2
+} // namespace isc
@@ -0,0 +1,314 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef NC_ADD_BATCH_H
+#define NC_ADD_BATCH_H
+
+/// @file nc_add_batch.h This file defines the class NameAddBatchTransaction.
+
+#include <d2/nc_trans.h>
+
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Thrown if the NameAddBatchTransaction encounters a general error.
+class NameAddBatchTransactionError : public isc::Exception {
+public:
+    NameAddBatchTransactionError(const char* file, size_t line,
+                                 const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Defines a list of NameChangeRequests carried out together.
+typedef std::vector<dhcp_ddns::NameChangeRequestPtr> NameChangeRequestList;
+
+/// @brief Carries out several DDNS Add requests with shared DNS updates.
+///
+/// NameAddBatchTransaction implements a state machine which fulfills a list
+/// of Add requests targeting the same forward and/or reverse domains with a
+/// single DNS UPDATE exchange per direction, rather than with one or more
+/// exchanges per request.  The updates are the first steps of RFC 4703,
+/// Sections 5.3 and 5.4, with the prerequisites and updates of all of the
+/// requests gathered in one message:
+///
+/// @code
+///
+/// If the requests include forward changes:
+///     Select a forward server
+///     Send the server a request to add the forward entries of all
+///     requests, provided none of the FQDNs is in use
+///
+/// If the requests include reverse changes:
+///     Select a reverse server
+///     Send the server a request to delete and then add the reverse entries
+///     of all requests
+///
+/// @endcode
+///
+/// As a DNS UPDATE is atomic, any rejection (e.g. one of the FQDNs is
+/// already in use) fails the whole batch.  The requests of a rejected batch
+/// are then expected to be carried out individually by NameAddTransactions,
+/// which handle the replace cases.  The forward and reverse change
+/// completion flags tell which direction has been applied to all requests
+/// before the failure.  When the batch fails for another reason, e.g. no
+/// server could be reached, all of its requests fail.
+///
+/// The first request of the list is the transaction's own request: its
+/// DHCID is the transaction key and its status reflects the outcome of the
+/// batch.  The caller is responsible for ensuring that the requests have the
+/// same change directions, distinct FQDNs, addresses and DHCIDs, and that
+/// they match the given domains.
+class NameAddBatchTransaction : public NameChangeTransaction {
+public:
+    //@{  Additional states needed for NameAddBatch state model.
+    /// @brief State that attempts to add the forward address records.
+    static const int ADDING_FWD_ADDRS_ST = NCT_DERIVED_STATE_MIN + 1;
+
+    /// @brief State that attempts to replace the reverse PTR records.
+    static const int REPLACING_REV_PTRS_ST = NCT_DERIVED_STATE_MIN + 2;
+    //@}
+
+    /// @brief Size of the fixed part of a DNS message.
+    static const size_t MESSAGE_HEADER_SIZE = 12;
+
+    /// @brief Size allowance for the TSIG record of a signed message.
+    static const size_t TSIG_SIZE_ALLOWANCE = 128;
+
+    /// @brief Constructor
+    ///
+    /// Instantiates a batch Add transaction that is ready to be started.
+    ///
+    /// @param io_service IO service to be used for IO processing
+    /// @param ncrs is the list of NameChangeRequests to fulfill
+    /// @param forward_domain is the domain to use for forward DNS updates
+    /// @param reverse_domain is the domain to use for reverse DNS updates
+    /// @param cfg_mgr pointer to the configuration manager
+    ///
+    /// @throw NameAddBatchTransactionError if the list is empty or if one of
+    /// the requests is not a CHG_ADD, NameChangeTransaction error for base
+    /// class construction errors.
+    NameAddBatchTransaction(asiolink::IOServicePtr& io_service,
+                            NameChangeRequestList& ncrs,
+                            DdnsDomainPtr& forward_domain,
+                            DdnsDomainPtr& reverse_domain,
+                            D2CfgMgrPtr& cfg_mgr);
+
+    /// @brief Destructor
+    virtual ~NameAddBatchTransaction();
+
+    /// @brief Fetches the list of requests carried out by the transaction.
+    const NameChangeRequestList& getNcrs() const {
+        return (ncrs_);
+    }
+
+    /// @brief Checks if a DNS server rejected the batch.
+    ///
+    /// @return true if the batch failed because a server responded with
+    /// an RCODE other than NOERROR, in which case its requests should be
+    /// carried out individually.
+    bool getRejected() const {
+        return (rejected_);
+    }
+
+    /// @brief Estimates the size a request adds to a batch update message.
+    ///
+    /// The estimate is an upper bound computed without name compression for
+    /// the larger of the forward and reverse updates the request calls for.
+    ///
+    /// @param ncr the request
+    ///
+    /// @return number of bytes.
+    static size_t getRequestSize(const dhcp_ddns::NameChangeRequest& ncr);
+
+    /// @brief Estimates the size of a batch update message without requests.
+    ///
+    /// This covers the header, the zone section and the TSIG record, if any,
+    /// of the larger of the forward and reverse update messages.
+    ///
+    /// @param forward_domain is the domain used for forward DNS updates,
+    /// may be empty
+    /// @param reverse_domain is the domain used for reverse DNS updates,
+    /// may be empty
+    ///
+    /// @return number of bytes.
+    static size_t getOverheadSize(const DdnsDomainPtr& forward_domain,
+                                  const DdnsDomainPtr& reverse_domain);
+
+protected:
+    /// @brief Adds states defined by NameAddBatchTransaction to the state
+    /// set.
+    ///
+    /// Invokes NameChangeTransaction's implementation and then defines the
+    /// states unique to batch Add transaction processing.
+    ///
+    /// @throw StateModelError if an state definition is invalid or a duplicate.
+    virtual void defineStates();
+
+    /// @brief Validates the contents of the set of states.
+    ///
+    /// Invokes NameChangeTransaction's implementation and then verifies the
+    /// batch Add transaction's states.
+    ///
+    /// @throw StateModelError if an event value is undefined.
+    virtual void verifyStates();
+
+    /// @brief State handler for READY_ST.
+    ///
+    /// Entered from:
+    /// - INIT_ST with next event of START_EVT
+    ///
+    /// Determines whether to start with the forward or the reverse changes.
+    ///
+    /// Transitions to:
+    /// - SELECTING_FWD_SERVER_ST with next event of SERVER_SELECT_ST if the
+    /// requests include forward changes.
+    ///
+    /// - SELECTING_REV_SERVER_ST with next event of SERVER_SELECT_ST if the
+    /// requests include only reverse changes.
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// START_EVT.
+    void readyHandler();
+
+    /// @brief State handler for SELECTING_FWD_SERVER_ST.
+    ///
+    /// Entered from:
+    /// - READY_ST with next event of SELECT_SERVER_EVT
+    /// - ADDING_FWD_ADDRS_ST with next event of SERVER_IO_ERROR_EVT
+    ///
+    /// Selects the server to be used from the forward domain.
+    ///
+    /// Transitions to:
+    /// - ADDING_FWD_ADDRS_ST with next event of SERVER_SELECTED upon successful
+    /// server selection
+    ///
+    /// - PROCESS_TRANS_FAILED with next event of NO_MORE_SERVERS_EVT upon
+    /// failure to select a server
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// SELECT_SERVER_EVT or SERVER_IO_ERROR_EVT.
+    void selectingFwdServerHandler();
+
+    /// @brief State handler for SELECTING_REV_SERVER_ST.
+    ///
+    /// Entered from:
+    /// - READY_ST with next event of SELECT_SERVER_EVT
+    /// - ADDING_FWD_ADDRS_ST with next event of SELECT_SERVER_EVT
+    /// - REPLACING_REV_PTRS_ST with next event of SERVER_IO_ERROR_EVT
+    ///
+    /// Selects the server to be used from the reverse domain.
+    ///
+    /// Transitions to:
+    /// - REPLACING_REV_PTRS_ST with next event of SERVER_SELECTED upon
+    /// successful server selection
+    ///
+    /// - PROCESS_TRANS_FAILED with next event of NO_MORE_SERVERS_EVT upon
+    /// failure to select a server
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// SELECT_SERVER_EVT or SERVER_IO_ERROR_EVT.
+    void selectingRevServerHandler();
+
+    /// @brief State handler for ADDING_FWD_ADDRS_ST.
+    ///
+    /// Entered from:
+    /// - SELECTING_FWD_SERVER with next event of SERVER_SELECTED_EVT
+    ///
+    /// Sends the batch forward add to the selected server.  The update
+    /// requires that none of the FQDNs is in use.
+    ///
+    /// Transitions to:
+    /// - SELECTING_REV_SERVER_ST with next event of SELECT_SERVER_EVT upon
+    /// success when the requests include reverse changes
+    ///
+    /// - PROCESS_TRANS_OK_ST with next event of UPDATE_OK_EVT upon success
+    /// when the requests include only forward changes
+    ///
+    /// - PROCESS_TRANS_FAILED_ST with next event of UPDATE_FAILED_EVT if the
+    /// server rejected the update or the update could not be sent
+    ///
+    /// - SELECTING_FWD_SERVER_ST with next event of SERVER_IO_ERROR_EVT upon
+    /// an IO error once the retries are exhausted
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// SERVER_SELECTED_EVT or IO_COMPLETED_EVT.
+    void addingFwdAddrsHandler();
+
+    /// @brief State handler for REPLACING_REV_PTRS_ST.
+    ///
+    /// Entered from:
+    /// - SELECTING_REV_SERVER with next event of SERVER_SELECTED_EVT
+    ///
+    /// Sends the batch reverse replacement to the selected server.
+    ///
+    /// Transitions to:
+    /// - PROCESS_TRANS_OK_ST with next event of UPDATE_OK_EVT upon success
+    ///
+    /// - PROCESS_TRANS_FAILED_ST with next event of UPDATE_FAILED_EVT if the
+    /// server rejected the update or the update could not be sent
+    ///
+    /// - SELECTING_REV_SERVER_ST with next event of SERVER_IO_ERROR_EVT upon
+    /// an IO error once the retries are exhausted
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// SERVER_SELECTED_EVT or IO_COMPLETED_EVT.
+    void replacingRevPtrsHandler();
+
+    /// @brief State handler for PROCESS_TRANS_OK_ST.
+    ///
+    /// Sets the status of all of the requests to completed and ends the
+    /// model.
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// UPDATE_OK_EVT.
+    void processAddOkHandler();
+
+    /// @brief State handler for PROCESS_TRANS_FAILED_ST.
+    ///
+    /// Sets the status of the transaction's own request to failed and ends
+    /// the model.  If the batch was rejected, the status of the other
+    /// requests is left unchanged as they are expected to be carried out
+    /// individually.  Otherwise all of the requests are failed.
+    ///
+    /// @throw NameAddBatchTransactionError if upon entry next event is not
+    /// UPDATE_FAILED_EVT or NO_MORE_SERVERS_EVT.
+    void processAddFailedHandler();
+
+    /// @brief Builds a DNS request to add the forward DNS entries of all
+    /// requests.
+    ///
+    /// For each request the prerequisite section holds an 'FQDN Is Not In
+    /// Use' RR and the update section holds the address and DHCID 'add' RRs,
+    /// as described in RFC 4703, section 5.3.1.
+    ///
+    /// @throw This method does not throw but underlying methods may.
+    void buildAddFwdAddressRequest();
+
+    /// @brief Builds a DNS request to replace the reverse DNS entries of all
+    /// requests.
+    ///
+    /// For each request the update section holds the PTR and DHCID 'delete'
+    /// and 'add' RRs, as described in RFC 4703, section 5.4.
+    ///
+    /// @throw This method does not throw but underlying methods may.
+    void buildReplaceRevPtrsRequest();
+
+private:
+    /// @brief The requests carried out by the transaction.
+    NameChangeRequestList ncrs_;
+
+    /// @brief Indicates that a DNS server rejected the batch.
+    bool rejected_;
+};
+
+/// @brief Defines a pointer to a NameAddBatchTransaction.
+typedef boost::shared_ptr<NameAddBatchTransaction> NameAddBatchTransactionPtr;
+
+} // namespace isc::d2
+} // namespace isc
+#endif
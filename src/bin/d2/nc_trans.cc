@@ -10,6 +10,8 @@
 #include <d2/nc_trans.h>
 #include <dns/rdata.h>
 
+#include <boost/bind.hpp>
+
 #include <sstream>
 
 using namespace isc::util;
@@ -46,11 +48,13 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
                       DdnsDomainPtr& reverse_domain,
                       D2CfgMgrPtr& cfg_mgr)
     : io_service_(io_service), ncr_(ncr), forward_domain_(forward_domain),
-     reverse_domain_(reverse_domain), dns_client_(), dns_update_request_(),
+     reverse_domain_(reverse_domain), dns_client_(),
+     dns_protocol_(DNSClient::UDP), tcp_pool_(), dns_update_request_(),
      dns_update_status_(DNSClient::OTHER), dns_update_response_(),
      forward_change_completed_(false), reverse_change_completed_(false),
      current_server_list_(), current_server_(), next_server_pos_(0),
-     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_() {
+     update_attempts_(0), cfg_mgr_(cfg_mgr), d2_params_(), strand_(),
+     done_handler_(), tsig_key_() {
     /// @todo if io_service is NULL we are multi-threading and should
     /// instantiate our own
     if (!io_service_) {
@@ -76,23 +80,84 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
         isc_throw(NameChangeTransactionError,
                   "Configuration manager cannot be null");
     }
+
+    d2_params_ = cfg_mgr_->getD2Params();
 }
 
 NameChangeTransaction::~NameChangeTransaction(){
+    // Destroy the DNSClient first: it waits for an exchange completing in
+    // another thread, which may still use the response placeholder.
+    dns_client_.reset();
 }
 
 void
 NameChangeTransaction::startTransaction() {
+    if (strand_) {
+        strand_->post(boost::bind(&NameChangeTransaction::doStartTransaction,
+                                  shared_from_this()));
+        return;
+    }
+
+    doStartTransaction();
+}
+
+void
+NameChangeTransaction::doStartTransaction() {
     LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
               DHCP_DDNS_STARTING_TRANSACTION)
               .arg(getRequestId());
 
     setNcrStatus(dhcp_ddns::ST_PENDING);
     startModel(READY_ST);
+    checkModelDone();
+}
+
+void
+NameChangeTransaction::setStrand(const StrandPtr& strand,
+                                 const boost::function<void()>& done_handler) {
+    strand_ = strand;
+    done_handler_ = done_handler;
+}
+
+void
+NameChangeTransaction::checkModelDone() {
+    if (done_handler_ && isModelDone()) {
+        done_handler_();
+    }
+}
+
+void
+NameChangeTransaction::setDnsTransport(const DNSClient::Protocol& protocol,
+                                       const DnsTcpConnectionPoolPtr&
+                                       tcp_pool) {
+    dns_protocol_ = protocol;
+    tcp_pool_ = tcp_pool;
 }
 
 void
 NameChangeTransaction::operator()(DNSClient::Status status) {
+    // The exchange completes in whatever thread runs the IOService, so the
+    // model must be re-entered from the strand.  The posted handler holds
+    // the transaction, which may be removed from the transaction list in
+    // the meantime.
+    if (strand_) {
+        NameChangeTransactionPtr trans;
+        try {
+            trans = shared_from_this();
+        } catch (const boost::bad_weak_ptr&) {
+            // The transaction is being destroyed: the exchange is abandoned.
+            return;
+        }
+        strand_->post(boost::bind(&NameChangeTransaction::doIOCompleted,
+                                  trans, status));
+        return;
+    }
+
+    doIOCompleted(status);
+}
+
+void
+NameChangeTransaction::doIOCompleted(DNSClient::Status status) {
     // Stow the completion status and re-enter the run loop with the event
     // set to indicate IO completed.
     // runModel is exception safe so we are good to call it here.
@@ -105,6 +170,7 @@ NameChangeTransaction::operator()(DNSClient::Status status) {
               .arg(responseString());
 
     runModel(IO_COMPLETED_EVT);
+    checkModelDone();
 }
 
 std::string
@@ -171,10 +237,9 @@ NameChangeTransaction::sendUpdate(const std::string& comment) {
         // use_tsig_ is true. We should be able to navigate to the TSIG key
         // for the current server.  If not we would need to add that.
 
-        D2ParamsPtr d2_params = cfg_mgr_->getD2Params();
         dns_client_->doUpdate(*io_service_, current_server_->getIpAddress(),
                               current_server_->getPort(), *dns_update_request_,
-                              d2_params->getDnsServerTimeout(), tsig_key_);
+                              d2_params_->getDnsServerTimeout(), tsig_key_);
         // Message is on its way, so the next event should be NOP_EVT.
         postNextEvent(NOP_EVT);
         LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
@@ -333,6 +398,13 @@ NameChangeTransaction::prepNewRequest(DdnsDomainPtr domain) {
 
 void
 NameChangeTransaction::addLeaseAddressRdata(dns::RRsetPtr& rrset) {
+    addLeaseAddressRdata(rrset, *ncr_);
+}
+
+void
+NameChangeTransaction::addLeaseAddressRdata(dns::RRsetPtr& rrset,
+                                            const dhcp_ddns::
+                                            NameChangeRequest& ncr) {
     if (!rrset) {
         isc_throw(NameChangeTransactionError,
                   "addLeaseAddressRdata - RRset cannot cannot be null");
@@ -341,10 +413,10 @@ NameChangeTransaction::addLeaseAddressRdata(dns::RRsetPtr& rrset) {
     try {
         // Manufacture an RData from the lease address then add it to the RR.
         dns::rdata::ConstRdataPtr rdata;
-        if (ncr_->isV4()) {
-            rdata.reset(new dns::rdata::in::A(ncr_->getIpAddress()));
+        if (ncr.isV4()) {
+            rdata.reset(new dns::rdata::in::A(ncr.getIpAddress()));
         } else {
-            rdata.reset(new dns::rdata::in::AAAA(ncr_->getIpAddress()));
+            rdata.reset(new dns::rdata::in::AAAA(ncr.getIpAddress()));
         }
         rrset->addRdata(rdata);
     } catch (const std::exception& ex) {
@@ -355,13 +427,19 @@ NameChangeTransaction::addLeaseAddressRdata(dns::RRsetPtr& rrset) {
 
 void
 NameChangeTransaction::addDhcidRdata(dns::RRsetPtr& rrset) {
+    addDhcidRdata(rrset, *ncr_);
+}
+
+void
+NameChangeTransaction::addDhcidRdata(dns::RRsetPtr& rrset,
+                                     const dhcp_ddns::NameChangeRequest& ncr) {
     if (!rrset) {
         isc_throw(NameChangeTransactionError,
                   "addDhcidRdata - RRset cannot cannot be null");
     }
 
     try {
-        const std::vector<uint8_t>& ncr_dhcid = ncr_->getDhcid().getBytes();
+        const std::vector<uint8_t>& ncr_dhcid = ncr.getDhcid().getBytes();
         util::InputBuffer buffer(ncr_dhcid.data(), ncr_dhcid.size());
         dns::rdata::ConstRdataPtr rdata (new dns::rdata::in::
                                          DHCID(buffer, ncr_dhcid.size()));
@@ -375,6 +453,12 @@ NameChangeTransaction::addDhcidRdata(dns::RRsetPtr& rrset) {
 
 void
 NameChangeTransaction::addPtrRdata(dns::RRsetPtr& rrset) {
+    addPtrRdata(rrset, *ncr_);
+}
+
+void
+NameChangeTransaction::addPtrRdata(dns::RRsetPtr& rrset,
+                                   const dhcp_ddns::NameChangeRequest& ncr) {
     if (!rrset) {
         isc_throw(NameChangeTransactionError,
                   "addPtrRdata - RRset cannot cannot be null");
@@ -382,7 +466,7 @@ NameChangeTransaction::addPtrRdata(dns::RRsetPtr& rrset) {
 
     try {
         dns::rdata::ConstRdataPtr rdata(new dns::rdata::generic::
-                                        PTR(getNcr()->getFqdn()));
+                                        PTR(ncr.getFqdn()));
         rrset->addRdata(rdata);
     } catch (const std::exception& ex) {
         isc_throw(NameChangeTransactionError, "Cannot add PTR rdata: "
@@ -448,12 +532,11 @@ NameChangeTransaction::selectNextServer() {
         // Toss out any previous response.
         dns_update_response_.reset();
 
-        // @todo  Protocol is set on DNSClient constructor.  We need
-        // to propagate a configuration value downward, probably starting
-        // at global, then domain, then server
-        // Once that is supported we need to add it here.
+        // @todo  The transport is set by the owner of the transaction. We
+        // need to propagate a configuration value downward, probably
+        // starting at global, then domain, then server.
         dns_client_.reset(new DNSClient(dns_update_response_ , this,
-                                        DNSClient::UDP));
+                                        dns_protocol_, tcp_pool_));
         ++next_server_pos_;
         return (true);
     }
@@ -466,6 +549,11 @@ NameChangeTransaction::getDNSClient() const {
     return (dns_client_);
 }
 
+DNSClient::Protocol
+NameChangeTransaction::getDnsProtocol() const {
+    return (dns_protocol_);
+}
+
 const DnsServerInfoPtr&
 NameChangeTransaction::getCurrentServer() const {
     return (current_server_);
@@ -9,6 +9,7 @@
 
 /// @file nc_trans.h This file defines the class NameChangeTransaction.
 
+#include <asiolink/asio_wrapper.h>
 #include <asiolink/io_service.h>
 #include <exceptions/exceptions.h>
 #include <d2/d2_cfg_mgr.h>
@@ -17,6 +18,9 @@
 #include <dns/tsig.h>
 #include <util/state_model.h>
 
+#include <boost/asio/strand.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
 
@@ -74,7 +78,8 @@ typedef isc::dhcp_ddns::D2Dhcid TransactionKey;
 /// as needed, but it must support the common set.  NameChangeTransaction
 /// does not supply any state handlers.  These are the sole responsibility of
 /// derivations.
-class NameChangeTransaction : public DNSClient::Callback, public util::StateModel {
+class NameChangeTransaction : public DNSClient::Callback, public util::StateModel,
+    public boost::enable_shared_from_this<NameChangeTransaction> {
 public:
 
     //@{ States common to all transactions.
@@ -175,20 +180,59 @@ public:
     /// @brief Destructor
     virtual ~NameChangeTransaction();
 
+    /// @brief Defines a pointer to a strand.
+    typedef boost::shared_ptr<boost::asio::io_service::strand> StrandPtr;
+
     /// @brief Begins execution of the transaction.
     ///
     /// This method invokes StateModel::startModel() with a value of READY_ST.
     /// This causes transaction's state model to attempt to begin execution
     /// with the state handler for READY_ST.
+    ///
+    /// If the transaction is pinned to a strand, the model is started by
+    /// the strand rather than from within this method.
     void startTransaction();
 
+    /// @brief Pins the transaction to a strand.
+    ///
+    /// This is used when the IOService of the transaction is run by several
+    /// threads.  The state model is then only run by handlers dispatched
+    /// through the strand, i.e. never concurrently, and the given handler
+    /// is invoked from the strand once the model is done.  The transaction
+    /// must not be accessed by other threads until then.  The handlers
+    /// dispatched through the strand hold a pointer to the transaction, so
+    /// the transaction must be owned by a NameChangeTransactionPtr.
+    ///
+    /// @param strand is the strand of the transaction's IOService to use.
+    /// @param done_handler is invoked when the model is done.
+    void setStrand(const StrandPtr& strand,
+                   const boost::function<void()>& done_handler);
+
+    /// @brief Fetches the strand the transaction is pinned to, if any.
+    const StrandPtr& getStrand() const {
+        return (strand_);
+    }
+
+    /// @brief Sets the transport used to carry out the DNS updates.
+    ///
+    /// The transport applies to the DNSClients created upon subsequent
+    /// server selections.  It defaults to UDP.
+    ///
+    /// @param protocol is the transport protocol to use.
+    /// @param tcp_pool is the pool of TCP connections to use with TCP. If it
+    /// is null, each DNSClient uses connections of its own.
+    void setDnsTransport(const DNSClient::Protocol& protocol,
+                         const DnsTcpConnectionPoolPtr& tcp_pool =
+                         DnsTcpConnectionPoolPtr());
+
     /// @brief Serves as the DNSClient IO completion event handler.
     ///
     /// This is the implementation of the method inherited by our derivation
     /// from DNSClient::Callback.  When the DNSClient completes an update it
     /// invokes this method as the completion handler.  This method stores
     /// the given status and invokes runStateModel() with an event value of
-    /// IO_COMPLETED_EVT.
+    /// IO_COMPLETED_EVT.  If the transaction is pinned to a strand, this is
+    /// done by a handler posted to the strand.
     ///
     /// @param status is the outcome of the DNS update packet exchange.
     /// This method is exception safe.
@@ -399,6 +443,41 @@ protected:
     /// the RData cannot be added to the given RRset.
     void addPtrRdata(dns::RRsetPtr& rrset);
 
+    /// @brief Adds an RData for the lease address of a request to the given
+    /// RRset.
+    ///
+    /// Same as addLeaseAddressRdata(dns::RRsetPtr&) but uses the given
+    /// request rather than the transaction's own.  This allows transactions
+    /// carrying out more than one request to build their updates.
+    ///
+    /// @param rrset RRset to which to add the RData
+    /// @param ncr request from which to take the lease address
+    ///
+    /// @throw NameChangeTransactionError if RData cannot be constructed or
+    /// the RData cannot be added to the given RRset.
+    void addLeaseAddressRdata(dns::RRsetPtr& rrset,
+                              const dhcp_ddns::NameChangeRequest& ncr);
+
+    /// @brief Adds an RData for the DHCID of a request to the given RRset.
+    ///
+    /// @param rrset RRset to which to add the RData
+    /// @param ncr request from which to take the DHCID
+    ///
+    /// @throw NameChangeTransactionError if RData cannot be constructed or
+    /// the RData cannot be added to the given RRset.
+    void addDhcidRdata(dns::RRsetPtr& rrset,
+                       const dhcp_ddns::NameChangeRequest& ncr);
+
+    /// @brief Adds an RData for the FQDN of a request to the given RRset.
+    ///
+    /// @param rrset RRset to which to add the RData
+    /// @param ncr request from which to take the FQDN
+    ///
+    /// @throw NameChangeTransactionError if RData cannot be constructed or
+    /// the RData cannot be added to the given RRset.
+    void addPtrRdata(dns::RRsetPtr& rrset,
+                     const dhcp_ddns::NameChangeRequest& ncr);
+
     /// @brief Returns a string version of the current response status and rcode
     ///
     /// Renders a string containing the a text label current DNS update status
@@ -475,6 +554,9 @@ public:
     /// @return A const pointer reference to the DNSClient
     const DNSClientPtr& getDNSClient() const;
 
+    /// @brief Fetches the transport protocol used for DNS updates.
+    DNSClient::Protocol getDnsProtocol() const;
+
     /// @brief Fetches the current DNS update request packet.
     ///
     /// @return A const pointer reference to the current D2UpdateMessage
@@ -524,6 +606,17 @@ public:
     const dns::RRType& getAddressRRType() const;
 
 private:
+    /// @brief Starts the state model.
+    void doStartTransaction();
+
+    /// @brief Runs the state model upon the completion of a DNS exchange.
+    ///
+    /// @param status is the outcome of the DNS update packet exchange.
+    void doIOCompleted(DNSClient::Status status);
+
+    /// @brief Invokes the done handler if the model is done.
+    void checkModelDone();
+
     /// @brief The IOService which should be used to for IO processing.
     asiolink::IOServicePtr io_service_;
 
@@ -547,6 +640,12 @@ private:
     /// @brief The DNSClient instance that will carry out DNS packet exchanges.
     DNSClientPtr dns_client_;
 
+    /// @brief The transport protocol of the DNS packet exchanges.
+    DNSClient::Protocol dns_protocol_;
+
+    /// @brief The pool of TCP connections used with TCP, may be null.
+    DnsTcpConnectionPoolPtr tcp_pool_;
+
     /// @brief The DNS current update request packet.
     D2UpdateMessagePtr dns_update_request_;
 
@@ -580,6 +679,19 @@ private:
     /// @brief Pointer to the configuration manager.
     D2CfgMgrPtr cfg_mgr_;
 
+    /// @brief Global parameters in effect when the transaction was created.
+    ///
+    /// The parameters are fetched once so that a transaction run by another
+    /// thread does not access the configuration manager, which may be
+    /// reconfigured in the meantime.
+    D2ParamsPtr d2_params_;
+
+    /// @brief The strand the transaction is pinned to, if any.
+    StrandPtr strand_;
+
+    /// @brief Invoked from the strand when the model is done.
+    boost::function<void()> done_handler_;
+
     /// @brief Pointer to the TSIG key which should be used (if any).
     dns::TSIGKeyPtr tsig_key_;
 };
@@ -148,6 +148,8 @@ D2ParserContext::contextName()
         return ("output-options");
     case NCR_PROTOCOL:
         return ("ncr-protocol");
+    case DNS_PROTOCOL:
+        return ("dns-protocol");
     case NCR_FORMAT:
         return ("ncr-format");
     default:
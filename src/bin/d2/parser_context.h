@@ -216,6 +216,9 @@ public:
         /// Used while parsing DhcpDdns/ncr-protocol
         NCR_PROTOCOL,
 
+        /// Used while parsing DhcpDdns/dns-protocol
+        DNS_PROTOCOL,
+
         /// Used while parsing DhcpDdns/ncr-format
         NCR_FORMAT
 
@@ -21,6 +21,8 @@
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 using namespace std;
 using namespace isc;
 using namespace isc::d2;
@@ -261,6 +263,50 @@ TEST_F(D2CfgMgrTest, validParamsEntry) {
     // Verify the configuration summary.
     EXPECT_EQ("listening on 3001::5, port 777, using UDP",
               d2_params_->getConfigSummary());
+
+    // Verify that the binary format is accepted.
+    config = makeParamsConfigString ("192.0.0.1", 777, 333, "UDP", "BINARY");
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, d2_params_->getNcrFormat());
+
+    // Verify that the number of update threads is accepted.
+    config =
+            "{"
+            " \"ip-address\": \"192.0.0.1\" , "
+            " \"port\": 777 , "
+            " \"dns-update-threads\": 4 , "
+            "\"tsig-keys\": [], "
+            "\"forward-ddns\" : {}, "
+            "\"reverse-ddns\" : {} "
+            "}";
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(4, d2_params_->getDnsUpdateThreads());
+
+    // Verify that the batch size is accepted.
+    config =
+            "{"
+            " \"ip-address\": \"192.0.0.1\" , "
+            " \"port\": 777 , "
+            " \"dns-update-batch-size\": 16 , "
+            "\"tsig-keys\": [], "
+            "\"forward-ddns\" : {}, "
+            "\"reverse-ddns\" : {} "
+            "}";
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(16, d2_params_->getDnsUpdateBatchSize());
+
+    // Verify that the DNS protocol is accepted.
+    config =
+            "{"
+            " \"ip-address\": \"192.0.0.1\" , "
+            " \"port\": 777 , "
+            " \"dns-protocol\": \"TCP\" , "
+            "\"tsig-keys\": [], "
+            "\"forward-ddns\" : {}, "
+            "\"reverse-ddns\" : {} "
+            "}";
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(dhcp_ddns::NCR_TCP, d2_params_->getDnsProtocol());
 }
 
 /// @brief Tests default values for D2Params.
@@ -359,6 +405,22 @@ TEST_F(D2CfgMgrTest, defaultValues) {
     ASSERT_TRUE(deflt);
     EXPECT_EQ(dhcp_ddns::stringToNcrFormat(deflt->stringValue()),
               d2_params_->getNcrFormat());
+
+    // Check that omitting the number of update threads gets you its default
+    ASSERT_NO_THROW(deflt = defaults->get("dns-update-threads"));
+    ASSERT_TRUE(deflt);
+    EXPECT_EQ(deflt->intValue(), d2_params_->getDnsUpdateThreads());
+
+    // Check that omitting the batch size gets you its default
+    ASSERT_NO_THROW(deflt = defaults->get("dns-update-batch-size"));
+    ASSERT_TRUE(deflt);
+    EXPECT_EQ(deflt->intValue(), d2_params_->getDnsUpdateBatchSize());
+
+    // Check that omitting the DNS protocol gets you its default
+    ASSERT_NO_THROW(deflt = defaults->get("dns-protocol"));
+    ASSERT_TRUE(deflt);
+    EXPECT_EQ(dhcp_ddns::stringToNcrProtocol(deflt->stringValue()),
+              d2_params_->getDnsProtocol());
 }
 
 /// @brief Tests the unsupported scalar parameters and objects are detected.
@@ -441,7 +503,8 @@ TEST_F(D2CfgMgrTest, invalidEntry) {
     // Invalid format
     config = makeParamsConfigString ("127.0.0.1", 777, 333, "UDP", "BOGUS");
     SYNTAX_ERROR(config, "<string>:1.115-121: syntax error,"
-                         " unexpected constant string, expecting JSON");
+                         " unexpected constant string,"
+                         " expecting JSON or BINARY");
 }
 
 // DdnsDomainList and TSIGKey tests moved to d2_simple_parser_unittest.cc
@@ -845,6 +908,70 @@ TEST_F(D2CfgMgrTest, matchReverse) {
     ASSERT_THROW(cfg_mgr_->matchReverse("", match), D2CfgError);
 }
 
+/// @brief Tests the domain matching of DdnsDomainListMgr with many domains.
+/// This test verifies that the longest matching domain is found, that
+/// matches are made on label boundaries only and that a domain name with a
+/// trailing dot only matches FQDNs with a trailing dot.
+TEST(DdnsDomainListMgr, matchDomain) {
+    DnsServerInfoStoragePtr servers(new DnsServerInfoStorage());
+    DdnsDomainMapPtr domains(new DdnsDomainMap());
+
+    // Add many reverse domains.
+    for (int i = 0; i < 256; ++i) {
+        for (int j = 0; j < 16; ++j) {
+            std::ostringstream name;
+            name << j << "." << i << ".10.in-addr.arpa.";
+            (*domains)[name.str()].reset(new DdnsDomain(name.str(), servers));
+        }
+    }
+    const char* names[] = { "10.in-addr.arpa.", "Example.COM", "one.example.com",
+                            "two.example.com." };
+    for (int i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+        (*domains)[names[i]].reset(new DdnsDomain(names[i], servers));
+    }
+
+    DdnsDomainListMgr mgr("test");
+    ASSERT_NO_THROW(mgr.setDomains(domains));
+    EXPECT_EQ(256 * 16 + 4, mgr.size());
+
+    DdnsDomainPtr match;
+    // Exact and sub-domain matches.
+    ASSERT_TRUE(mgr.matchDomain("7.200.10.in-addr.arpa.", match));
+    EXPECT_EQ("7.200.10.in-addr.arpa.", match->getName());
+    ASSERT_TRUE(mgr.matchDomain("1.7.200.10.IN-ADDR.ARPA.", match));
+    EXPECT_EQ("7.200.10.in-addr.arpa.", match->getName());
+
+    // The longest match wins.
+    ASSERT_TRUE(mgr.matchDomain("1.17.200.10.in-addr.arpa.", match));
+    EXPECT_EQ("10.in-addr.arpa.", match->getName());
+    ASSERT_TRUE(mgr.matchDomain("red.one.example.com", match));
+    EXPECT_EQ("one.example.com", match->getName());
+    ASSERT_TRUE(mgr.matchDomain("blue.example.com", match));
+    EXPECT_EQ("Example.COM", match->getName());
+
+    // Matches are made on label boundaries.
+    match.reset();
+    EXPECT_FALSE(mgr.matchDomain("anotherexample.com", match));
+    EXPECT_FALSE(mgr.matchDomain("7.200.110.in-addr.arpa.", match));
+
+    // Trailing dots must agree.
+    EXPECT_FALSE(mgr.matchDomain("blue.example.com.", match));
+    ASSERT_TRUE(mgr.matchDomain("two.example.com", match));
+    EXPECT_EQ("Example.COM", match->getName());
+    ASSERT_TRUE(mgr.matchDomain("blue.two.example.com.", match));
+    EXPECT_EQ("two.example.com.", match->getName());
+    EXPECT_FALSE(mgr.matchDomain("10.in-addr.arpa", match));
+    EXPECT_FALSE(mgr.matchDomain("", match));
+
+    // Replacing the domains rebuilds the trie.
+    domains.reset(new DdnsDomainMap());
+    (*domains)["example.org"].reset(new DdnsDomain("example.org", servers));
+    ASSERT_NO_THROW(mgr.setDomains(domains));
+    EXPECT_FALSE(mgr.matchDomain("blue.example.com", match));
+    ASSERT_TRUE(mgr.matchDomain("blue.example.org", match));
+    EXPECT_EQ("example.org", match->getName());
+}
+
 /// @brief Tests D2 config parsing against a wide range of config permutations.
 ///
 /// It tests for both syntax errors that the JSON parsing (D2ParserContext)
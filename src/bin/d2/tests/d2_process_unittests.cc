@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <sstream>
+#include <unistd.h>
 
 using namespace std;
 using namespace isc;
@@ -209,6 +210,94 @@ TEST_F(D2ProcessTest, configure) {
     EXPECT_EQ(D2QueueMgr::RUNNING, queue_mgr->getMgrState());
 }
 
+/// @brief Verifies that configure applies the DNS update parameters to the
+/// update manager.
+TEST_F(D2ProcessTest, configureUpdateMgr) {
+    const D2UpdateMgrPtr& update_mgr = getD2UpdateMgr();
+    ASSERT_TRUE(update_mgr);
+    EXPECT_EQ(1, update_mgr->getMaxBatchSize());
+    EXPECT_EQ(DNSClient::UDP, update_mgr->getDnsProtocol());
+
+    const char* config = "{ "
+                         "\"ip-address\" : \"127.0.0.1\" , "
+                         "\"port\" : 5031, "
+                         "\"dns-update-batch-size\" : 8, "
+                         "\"dns-protocol\" : \"TCP\", "
+                         "\"tsig-keys\": [] ,"
+                         "\"forward-ddns\" : {}, "
+                         "\"reverse-ddns\" : {} "
+                         "}";
+    ASSERT_TRUE(fromJSON(config));
+    isc::data::ConstElementPtr answer = configure(config_set_);
+    ASSERT_TRUE(checkAnswer(answer, 0));
+
+    EXPECT_EQ(8, update_mgr->getMaxBatchSize());
+    EXPECT_EQ(DNSClient::TCP, update_mgr->getDnsProtocol());
+}
+
+/// @brief Verifies that D2 can be reconfigured while DNS updates are carried
+/// out by the update threads.
+TEST_F(D2ProcessTest, reconfigureWithUpdatesInFlight) {
+    // The updates are sent to a server which never answers.
+    const std::string config_head = "{ "
+                                    "\"ip-address\" : \"127.0.0.1\" , "
+                                    "\"port\" : 5031, "
+                                    "\"dns-update-threads\" : ";
+    const std::string config_tail = ", "
+                                    "\"tsig-keys\": [] ,"
+                                    "\"forward-ddns\" : {"
+                                    "\"ddns-domains\": [ "
+                                    "{ \"name\": \"example.com.\" , "
+                                    "  \"dns-servers\" : [ "
+                                    "  { \"ip-address\": \"127.0.0.1\" , "
+                                    "    \"port\": 5301 } ] } ] }, "
+                                    "\"reverse-ddns\" : {} "
+                                    "}";
+    ASSERT_TRUE(fromJSON(config_head + "2" + config_tail));
+    ASSERT_TRUE(checkAnswer(configure(config_set_), 0));
+
+    const D2UpdateMgrPtr& update_mgr = getD2UpdateMgr();
+    EXPECT_EQ(2, update_mgr->getRunningUpdateThreads());
+
+    // Start two updates.
+    const char* dhcids[] = { "010203040A7F8E3D", "010203040A7F8E3E" };
+    std::vector<dhcp_ddns::NameChangeRequestPtr> ncrs;
+    for (int i = 0; i < 2; ++i) {
+        dhcp_ddns::NameChangeRequestPtr ncr(new dhcp_ddns::NameChangeRequest());
+        ncr->setChangeType(dhcp_ddns::CHG_ADD);
+        ncr->setForwardChange(true);
+        ncr->setReverseChange(false);
+        ncr->setFqdn("walah.example.com.");
+        ncr->setIpAddress("192.168.2.1");
+        ncr->setDhcid(dhcids[i]);
+        ncr->setLeaseExpiresOn("20130121132405");
+        ncr->setLeaseLength(1300);
+        ASSERT_NO_THROW(getD2QueueMgr()->enqueue(ncr));
+        ASSERT_NO_THROW(update_mgr->sweep());
+        ncrs.push_back(ncr);
+    }
+    ASSERT_EQ(2, update_mgr->getTransactionCount());
+
+    // Reconfigure while the updates are in flight.
+    ASSERT_TRUE(fromJSON(config_head + "3" + config_tail));
+    ASSERT_TRUE(checkAnswer(configure(config_set_), 0));
+    EXPECT_EQ(3, update_mgr->getRunningUpdateThreads());
+    EXPECT_EQ(2, update_mgr->getTransactionCount());
+
+    // The updates are still carried out to their end.
+    ptime deadline = microsec_clock::universal_time() + seconds(5);
+    while (update_mgr->getTransactionCount() &&
+           (microsec_clock::universal_time() < deadline)) {
+        update_mgr->sweep();
+        getIoService()->get_io_service().poll();
+        usleep(1000);
+    }
+
+    EXPECT_EQ(0, update_mgr->getTransactionCount());
+    EXPECT_EQ(dhcp_ddns::ST_FAILED, ncrs[0]->getStatus());
+    EXPECT_EQ(dhcp_ddns::ST_FAILED, ncrs[1]->getStatus());
+}
+
 /// @brief Tests checkQueueStatus() logic for stopping the queue on shutdown
 /// This test manually sets shutdown flag and verifies that queue manager
 /// stop is initiated.
@@ -286,6 +375,9 @@ TEST_F(D2ProcessTest, queueFullRecovery) {
     size_t max_queue_size = 5;
     queue_mgr->setMaxQueueSize(max_queue_size);
 
+    // The same request is queued several times: keep them all queued.
+    queue_mgr->setSupersedeRequests(false);
+
     // Manually enqueue max requests.
     dhcp_ddns::NameChangeRequestPtr ncr;
     ASSERT_NO_THROW(ncr = dhcp_ddns::NameChangeRequest::fromJSON(test_msg));
@@ -121,6 +121,9 @@ TEST(D2QueueMgrBasicTest, basicQueue) {
     ASSERT_NO_THROW(queue_mgr.reset(new D2QueueMgr(io_service, VALID_MSG_CNT)));
     ASSERT_EQ(VALID_MSG_CNT, queue_mgr->getMaxQueueSize());
 
+    // The test messages are for the same client: keep them all queued.
+    queue_mgr->setSupersedeRequests(false);
+
     // Verify queue is empty after construction.
     EXPECT_EQ(0, queue_mgr->getQueueSize());
 
@@ -192,6 +195,85 @@ TEST(D2QueueMgrBasicTest, basicQueue) {
                  D2QueueMgrInvalidIndex);
 }
 
+/// @brief Tests superseding of queued requests.
+/// This test verifies that:
+/// 1. Superseding is enabled by default.
+/// 2. A request supersedes queued requests for the same DHCID, FQDN and
+/// address, regardless of the FQDN case and of the change type.
+/// 3. Requests for a different address or covering a direction the newer
+/// request does not are kept.
+/// 4. The queue index follows dequeue, dequeueAt and clearQueue.
+TEST(D2QueueMgrBasicTest, supersede) {
+    asiolink::IOServicePtr io_service(new isc::asiolink::IOService());
+    D2QueueMgrPtr queue_mgr;
+    ASSERT_NO_THROW(queue_mgr.reset(new D2QueueMgr(io_service)));
+    EXPECT_TRUE(queue_mgr->getSupersedeRequests());
+    EXPECT_EQ(0, queue_mgr->getSupersededCount());
+
+    // Add, Remove, Add for the same client and address: each supersedes
+    // the previous one.
+    NameChangeRequestPtr add;
+    ASSERT_NO_THROW(add = NameChangeRequest::fromJSON(valid_msgs[0]));
+    NameChangeRequestPtr remove;
+    ASSERT_NO_THROW(remove = NameChangeRequest::fromJSON(valid_msgs[1]));
+    NameChangeRequestPtr add_again;
+    ASSERT_NO_THROW(add_again = NameChangeRequest::fromJSON(valid_msgs[0]));
+    add_again->setFqdn("WALAH.walah.com");
+
+    EXPECT_TRUE(D2QueueMgr::supersedes(*remove, *add));
+    EXPECT_TRUE(D2QueueMgr::supersedes(*add_again, *remove));
+
+    ASSERT_NO_THROW(queue_mgr->enqueue(add));
+    ASSERT_NO_THROW(queue_mgr->enqueue(remove));
+    EXPECT_EQ(1, queue_mgr->getQueueSize());
+    EXPECT_TRUE(queue_mgr->peek() == remove);
+    ASSERT_NO_THROW(queue_mgr->enqueue(add_again));
+    EXPECT_EQ(1, queue_mgr->getQueueSize());
+    EXPECT_TRUE(queue_mgr->peek() == add_again);
+    EXPECT_EQ(2, queue_mgr->getSupersededCount());
+    EXPECT_EQ(1, queue_mgr->getRequestCount(add->getDhcid(),
+                                            "walah.walah.com."));
+
+    // A request for a different address is kept.
+    NameChangeRequestPtr add_v6;
+    ASSERT_NO_THROW(add_v6 = NameChangeRequest::fromJSON(valid_msgs[2]));
+    EXPECT_FALSE(D2QueueMgr::supersedes(*add_v6, *add_again));
+    ASSERT_NO_THROW(queue_mgr->enqueue(add_v6));
+    EXPECT_EQ(2, queue_mgr->getQueueSize());
+
+    // A forward-only request does not supersede one which also updates
+    // the reverse zone, but the opposite is true.
+    NameChangeRequestPtr both;
+    ASSERT_NO_THROW(both = NameChangeRequest::fromJSON(valid_msgs[1]));
+    both->setReverseChange(true);
+    NameChangeRequestPtr forward;
+    ASSERT_NO_THROW(forward = NameChangeRequest::fromJSON(valid_msgs[1]));
+    EXPECT_FALSE(D2QueueMgr::supersedes(*forward, *both));
+    EXPECT_TRUE(D2QueueMgr::supersedes(*both, *forward));
+
+    queue_mgr->clearQueue();
+    ASSERT_NO_THROW(queue_mgr->enqueue(both));
+    ASSERT_NO_THROW(queue_mgr->enqueue(forward));
+    EXPECT_EQ(2, queue_mgr->getQueueSize());
+    EXPECT_EQ(2, queue_mgr->getSupersededCount());
+
+    // Dequeued requests can no longer be superseded.
+    ASSERT_NO_THROW(queue_mgr->dequeue());
+    ASSERT_NO_THROW(queue_mgr->dequeueAt(0));
+    EXPECT_EQ(0, queue_mgr->getRequestCount(add->getDhcid(),
+                                            "walah.walah.com."));
+    ASSERT_NO_THROW(queue_mgr->enqueue(add));
+    EXPECT_EQ(1, queue_mgr->getQueueSize());
+    EXPECT_EQ(2, queue_mgr->getSupersededCount());
+
+    // Verify that superseding can be disabled.
+    queue_mgr->setSupersedeRequests(false);
+    ASSERT_NO_THROW(queue_mgr->enqueue(remove));
+    EXPECT_EQ(2, queue_mgr->getQueueSize());
+    EXPECT_EQ(2, queue_mgr->getRequestCount(add->getDhcid(),
+                                            "walah.walah.com."));
+}
+
 /// @brief Compares two NameChangeRequests for equality.
 bool checkSendVsReceived(NameChangeRequestPtr sent_ncr,
                          NameChangeRequestPtr received_ncr) {
@@ -343,6 +425,9 @@ TEST_F (QueueMgrUDPTest, liveFeed) {
                                                     VALID_MSG_CNT)));
     ASSERT_EQ(D2QueueMgr::NOT_INITTED, queue_mgr_->getMgrState());
 
+    // The test messages are for the same client: keep them all queued.
+    queue_mgr_->setSupersedeRequests(false);
+
     // Verify that setting max queue size to 0 is not allowed.
     EXPECT_THROW(queue_mgr_->setMaxQueueSize(0), D2QueueMgrError);
     EXPECT_EQ(VALID_MSG_CNT, queue_mgr_->getMaxQueueSize());
@@ -272,7 +272,7 @@ TEST_F(D2SimpleParserTest, globalD2Defaults) {
     EXPECT_NO_THROW(num = D2SimpleParser::setAllDefaults(empty));
 
     // We expect 5 parameters to be inserted.
-    EXPECT_EQ(num, 8);
+    EXPECT_EQ(num, 11);
 
     // Let's go over all parameters we have defaults for.
     BOOST_FOREACH(SimpleDefault deflt, D2SimpleParser::D2_GLOBAL_DEFAULTS) {
@@ -0,0 +1,175 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_service.h>
+#include <d2/d2_thread_pool.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <set>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::d2;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Test fixture for testing D2ThreadPool.
+class D2ThreadPoolTest : public ::testing::Test {
+public:
+    /// @brief Constructor
+    D2ThreadPoolTest()
+        : io_service_(new IOService()), mutex_(), handled_(0),
+          threads_() {
+    }
+
+    /// @brief Handler posted to the IOService.
+    ///
+    /// Records the thread which ran it and waits a little, so that the
+    /// handlers posted together are run by several threads.
+    void handler() {
+        {
+            Mutex::Locker lock(mutex_);
+            ++handled_;
+            threads_.insert(pthread_self());
+        }
+        usleep(10000);
+    }
+
+    /// @brief Handler throwing an exception.
+    void throwingHandler() {
+        isc_throw(Unexpected, "handler failed");
+    }
+
+    /// @brief Returns the number of handlers run so far.
+    size_t getHandled() {
+        Mutex::Locker lock(mutex_);
+        return (handled_);
+    }
+
+    /// @brief Waits until the given number of handlers have been run.
+    ///
+    /// @param count number of handlers to wait for.
+    ///
+    /// @return true if the handlers have been run in less than 5 seconds.
+    bool waitHandled(const size_t count) {
+        for (int i = 0; i < 500; ++i) {
+            if (getHandled() >= count) {
+                return (true);
+            }
+            usleep(10000);
+        }
+        return (false);
+    }
+
+    /// @brief IOService run by the pools.
+    IOServicePtr io_service_;
+
+    /// @brief Protects the members below.
+    Mutex mutex_;
+
+    /// @brief Number of handlers run.
+    size_t handled_;
+
+    /// @brief Threads which ran the handlers.
+    std::set<pthread_t> threads_;
+};
+
+/// @brief Tests the construction of a D2ThreadPool.
+TEST_F(D2ThreadPoolTest, construction) {
+    // A null IOService is rejected.
+    EXPECT_THROW(D2ThreadPool pool((IOServicePtr())), BadValue);
+
+    D2ThreadPoolPtr pool;
+    ASSERT_NO_THROW(pool.reset(new D2ThreadPool(io_service_)));
+    EXPECT_EQ(io_service_, pool->getIOService());
+    EXPECT_FALSE(pool->isRunning());
+    EXPECT_EQ(0, pool->getThreadCount());
+}
+
+/// @brief Tests starting and stopping the threads.
+TEST_F(D2ThreadPoolTest, startStop) {
+    D2ThreadPool pool(io_service_);
+
+    // At least one thread is required.
+    EXPECT_THROW(pool.start(0), BadValue);
+    EXPECT_FALSE(pool.isRunning());
+
+    ASSERT_NO_THROW(pool.start(3));
+    EXPECT_TRUE(pool.isRunning());
+    EXPECT_EQ(3, pool.getThreadCount());
+
+    // The threads cannot be started twice.
+    EXPECT_THROW(pool.start(1), InvalidOperation);
+    EXPECT_EQ(3, pool.getThreadCount());
+
+    ASSERT_NO_THROW(pool.stop());
+    EXPECT_FALSE(pool.isRunning());
+    EXPECT_EQ(0, pool.getThreadCount());
+
+    // Stopping again does nothing.
+    EXPECT_NO_THROW(pool.stop());
+
+    // The threads can be started again.
+    ASSERT_NO_THROW(pool.start(2));
+    EXPECT_EQ(2, pool.getThreadCount());
+}
+
+/// @brief Tests that the handlers are run by several threads.
+TEST_F(D2ThreadPoolTest, concurrentHandlers) {
+    D2ThreadPool pool(io_service_);
+    ASSERT_NO_THROW(pool.start(4));
+
+    for (int i = 0; i < 40; ++i) {
+        io_service_->post(boost::bind(&D2ThreadPoolTest::handler, this));
+    }
+
+    ASSERT_TRUE(waitHandled(40));
+    pool.stop();
+    EXPECT_EQ(40, handled_);
+    EXPECT_LT(1, threads_.size());
+    EXPECT_FALSE(threads_.count(pthread_self()));
+}
+
+/// @brief Tests that the handlers posted while the threads are stopped are
+/// run once they are started again.
+TEST_F(D2ThreadPoolTest, restart) {
+    D2ThreadPool pool(io_service_);
+    ASSERT_NO_THROW(pool.start(2));
+    pool.stop();
+
+    for (int i = 0; i < 5; ++i) {
+        io_service_->post(boost::bind(&D2ThreadPoolTest::handler, this));
+    }
+    usleep(50000);
+    EXPECT_EQ(0, getHandled());
+
+    ASSERT_NO_THROW(pool.start(2));
+    EXPECT_TRUE(waitHandled(5));
+}
+
+/// @brief Tests that a handler throwing an exception doesn't stop the thread
+/// which ran it.
+TEST_F(D2ThreadPoolTest, handlerException) {
+    D2ThreadPool pool(io_service_);
+    ASSERT_NO_THROW(pool.start(1));
+
+    io_service_->post(boost::bind(&D2ThreadPoolTest::throwingHandler, this));
+    io_service_->post(boost::bind(&D2ThreadPoolTest::handler, this));
+
+    EXPECT_TRUE(waitHandled(1));
+    EXPECT_TRUE(pool.isRunning());
+}
+
+}
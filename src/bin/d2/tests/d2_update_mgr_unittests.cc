@@ -8,8 +8,10 @@
 
 #include <asiolink/io_service.h>
 #include <d2/d2_update_mgr.h>
+#include <d2/dns_tcp_connection.h>
 #include <nc_test_utils.h>
 #include <process/testutils/d_test_stubs.h>
+#include <stats/stats_mgr.h>
 #include <util/time_utilities.h>
 
 #include <boost/function.hpp>
@@ -51,6 +53,7 @@ public:
     using D2UpdateMgr::checkFinishedTransactions;
     using D2UpdateMgr::pickNextJob;
     using D2UpdateMgr::makeTransaction;
+    using D2UpdateMgr::makeBatch;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
@@ -148,6 +151,22 @@ public:
         ASSERT_TRUE(checkAnswer(0));
     }
 
+    /// @brief Creates an Add request with forward change only.
+    ///
+    /// @param fqdn FQDN of the request
+    /// @param address lease address of the request
+    /// @param dhcid DHCID of the request
+    NameChangeRequestPtr makeAddNcr(const std::string& fqdn,
+                                    const std::string& address,
+                                    const std::string& dhcid) {
+        NameChangeRequestPtr ncr(new NameChangeRequest(*canned_ncrs_[0]));
+        ncr->setChangeType(dhcp_ddns::CHG_ADD);
+        ncr->setFqdn(fqdn);
+        ncr->setIpAddress(address);
+        ncr->setDhcid(dhcid);
+        return (ncr);
+    }
+
     /// @brief Fakes the completion of a given transaction.
     ///
     /// @param index index of the request from which the transaction was formed.
@@ -207,7 +226,8 @@ public:
         // timeout processing to occur naturally.
         size_t timeout = cfg_mgr_->getD2Params()->getDnsServerTimeout() + 100;
         while (update_mgr_->getQueueCount() ||
-            update_mgr_->getTransactionCount()) {
+            update_mgr_->getTransactionCount() ||
+            update_mgr_->getFallbackCount()) {
             ++passes;
             update_mgr_->sweep();
             // If any transactions are waiting on IO, run the service.
@@ -236,6 +256,42 @@ public:
         }
     }
 
+    /// @brief Process events until all requests have been completed by
+    /// the update threads.
+    ///
+    /// This is processAll() for transactions run by update threads, which
+    /// must not be inspected by the test: the test's IOService is run
+    /// whenever there are transactions, until a transaction done by an
+    /// update thread wakes it up.
+    ///
+    /// @param max_passes maximum number of passes through the loop
+    void processAllThreaded(size_t max_passes = 100) {
+        size_t passes = 0;
+        // Nothing wakes the test up while an update thread retries a
+        // request, so wait for all the attempts to a server.
+        size_t timeout = cfg_mgr_->getD2Params()->getDnsServerTimeout() *
+            NameChangeTransaction::MAX_UPDATE_TRIES_PER_SERVER + 100;
+        while (update_mgr_->getQueueCount() ||
+            update_mgr_->getTransactionCount() ||
+            update_mgr_->getFallbackCount()) {
+            ++passes;
+            update_mgr_->sweep();
+            if (update_mgr_->getTransactionCount()) {
+                if (runTimedIO(timeout) == 0) {
+                    ADD_FAILURE() << "processAllThreaded: IO service stopped"
+                        " unexpectedly, passes: " << passes;
+                    return;
+                }
+            }
+
+            if (passes > max_passes) {
+                ADD_FAILURE() << "processAllThreaded failed, too many passes: "
+                    << passes;
+                return;
+            }
+        }
+    }
+
 };
 
 /// @brief Tests the D2UpdateMgr construction.
@@ -289,6 +345,103 @@ TEST(D2UpdateMgr, construction) {
 
     // Verify that max transactions is correct.
     EXPECT_EQ(100, update_mgr->getMaxTransactions());
+
+    // Verify that max batch size defaults properly and cannot be zero.
+    EXPECT_EQ(D2UpdateMgr::MAX_BATCH_SIZE_DEFAULT,
+              update_mgr->getMaxBatchSize());
+    EXPECT_THROW(D2UpdateMgr(queue_mgr, cfg_mgr, io_service, 100, 0),
+                 D2UpdateMgrError);
+    EXPECT_THROW(update_mgr->setMaxBatchSize(0), D2UpdateMgrError);
+
+    // Verify that DNS updates are sent over UDP by default and that the
+    // TCP connection pool exists.
+    EXPECT_EQ(DNSClient::UDP, update_mgr->getDnsProtocol());
+    EXPECT_TRUE(update_mgr->getTcpConnectionPool());
+
+    // Verify that transactions run on the given IOService by default.
+    EXPECT_EQ(0, update_mgr->getUpdateThreads());
+    EXPECT_EQ(0, update_mgr->getRunningUpdateThreads());
+    EXPECT_EQ(io_service, update_mgr->getUpdateIOService());
+}
+
+/// @brief Tests setting the number of update threads.
+/// This test verifies that:
+/// 1. Update threads run the transactions on an IOService of their own.
+/// 2. The number of threads can be changed while there are transactions.
+/// 3. Moving the transactions back to the given IOService is deferred
+/// until the transactions in progress are done.
+TEST_F(D2UpdateMgrTest, updateThreads) {
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(2));
+    EXPECT_EQ(2, update_mgr_->getUpdateThreads());
+    EXPECT_EQ(2, update_mgr_->getRunningUpdateThreads());
+    asiolink::IOServicePtr update_io_service =
+        update_mgr_->getUpdateIOService();
+    ASSERT_TRUE(update_io_service);
+    EXPECT_NE(io_service_, update_io_service);
+
+    // Start a transaction which will wait for a response that never comes.
+    ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[0]));
+    ASSERT_NO_THROW(update_mgr_->sweep());
+    ASSERT_EQ(1, update_mgr_->getTransactionCount());
+
+    // Resizing the pool keeps the transactions' IOService.
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(3));
+    EXPECT_EQ(3, update_mgr_->getRunningUpdateThreads());
+    EXPECT_EQ(update_io_service, update_mgr_->getUpdateIOService());
+
+    // Removing the threads must wait for the transaction, meanwhile no
+    // transaction is started.
+    ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[1]));
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(0));
+    EXPECT_EQ(0, update_mgr_->getUpdateThreads());
+    EXPECT_EQ(3, update_mgr_->getRunningUpdateThreads());
+    ASSERT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(1, update_mgr_->getQueueCount());
+
+    // Once the transaction has timed out, the threads are stopped and the
+    // next transaction runs on the test's IOService.
+    processAllThreaded();
+    EXPECT_EQ(dhcp_ddns::ST_FAILED, canned_ncrs_[0]->getStatus());
+    EXPECT_EQ(dhcp_ddns::ST_FAILED, canned_ncrs_[1]->getStatus());
+    EXPECT_EQ(0, update_mgr_->getRunningUpdateThreads());
+    EXPECT_EQ(io_service_, update_mgr_->getUpdateIOService());
+}
+
+/// @brief Tests pausing the updates.
+/// This test verifies that:
+/// 1. Pausing the updates stops the update threads and no transaction is
+/// started until they are resumed.
+/// 2. A number of threads set while paused is applied on resume.
+/// 3. Pauses may be nested.
+TEST_F(D2UpdateMgrTest, pauseUpdates) {
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(2));
+    asiolink::IOServicePtr update_io_service =
+        update_mgr_->getUpdateIOService();
+
+    update_mgr_->pauseUpdates();
+    update_mgr_->pauseUpdates();
+    EXPECT_EQ(0, update_mgr_->getRunningUpdateThreads());
+
+    ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[0]));
+    ASSERT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(0, update_mgr_->getTransactionCount());
+    EXPECT_EQ(1, update_mgr_->getQueueCount());
+
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(3));
+    EXPECT_EQ(0, update_mgr_->getRunningUpdateThreads());
+
+    // Only the last resume restarts the threads.
+    update_mgr_->resumeUpdates();
+    EXPECT_EQ(0, update_mgr_->getRunningUpdateThreads());
+    update_mgr_->resumeUpdates();
+    EXPECT_EQ(3, update_mgr_->getRunningUpdateThreads());
+    EXPECT_EQ(update_io_service, update_mgr_->getUpdateIOService());
+
+    ASSERT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+    processAllThreaded();
+    EXPECT_EQ(dhcp_ddns::ST_FAILED, canned_ncrs_[0]->getStatus());
 }
 
 /// @brief Tests the D2UpdateManager's transaction list services
@@ -860,4 +1013,262 @@ TEST_F(D2UpdateMgrTest, multiTransactionTimeout) {
     }
 }
 
+/// @brief Tests the combination of compatible requests into a batch.
+/// This test verifies that:
+/// 1. Add requests for the same domain are carried out by one transaction.
+/// 2. Requests of other types, domains or clients are left in the queue.
+/// 3. Requests conflicting with a request left in the queue are not batched.
+/// 4. The batch statistics are updated.
+TEST_F(D2UpdateMgrTest, makeBatch) {
+    stats::StatsMgr::instance().removeAll();
+    update_mgr_->setMaxBatchSize(32);
+
+    // Queue up a mix of requests.
+    std::vector<NameChangeRequestPtr> ncrs;
+    ncrs.push_back(makeAddNcr("one.example.com.", "192.168.1.1", "010101"));
+    ncrs.push_back(makeAddNcr("two.example.com.", "192.168.1.2", "020202"));
+    // Other domain.
+    ncrs.push_back(makeAddNcr("three.org.", "192.168.1.3", "030303"));
+    // Remove then Add for the same client: neither may be batched.
+    ncrs.push_back(makeAddNcr("four.example.com.", "192.168.1.4", "040404"));
+    ncrs.back()->setChangeType(dhcp_ddns::CHG_REMOVE);
+    ncrs.push_back(makeAddNcr("five.example.com.", "192.168.1.5", "040404"));
+    // Same FQDN as an earlier request, but for a different case.
+    ncrs.push_back(makeAddNcr("ONE.example.com.", "192.168.1.6", "060606"));
+    ncrs.push_back(makeAddNcr("seven.example.com.", "192.168.1.7", "070707"));
+    for (int i = 0; i < ncrs.size(); ++i) {
+        ASSERT_NO_THROW(queue_mgr_->enqueue(ncrs[i]));
+    }
+
+    // The first request is combined with the compatible ones.
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(4, update_mgr_->getQueueCount());
+
+    TransactionList::iterator pos =
+        update_mgr_->findTransaction(ncrs[0]->getDhcid());
+    ASSERT_TRUE(pos != update_mgr_->transactionListEnd());
+    NameChangeTransactionPtr trans = (*pos).second;
+    const int batched[] = { 0, 1, 6 };
+    for (int i = 0; i < 3; ++i) {
+        pos = update_mgr_->findTransaction(ncrs[batched[i]]->getDhcid());
+        ASSERT_TRUE(pos != update_mgr_->transactionListEnd());
+        EXPECT_TRUE((*pos).second == trans);
+    }
+
+    // The other requests are left in order.
+    EXPECT_TRUE(queue_mgr_->peekAt(0) == ncrs[2]);
+    EXPECT_TRUE(queue_mgr_->peekAt(1) == ncrs[3]);
+    EXPECT_TRUE(queue_mgr_->peekAt(2) == ncrs[4]);
+    EXPECT_TRUE(queue_mgr_->peekAt(3) == ncrs[5]);
+
+    stats::ObservationPtr batches =
+        stats::StatsMgr::instance().getObservation("update-batches");
+    ASSERT_TRUE(batches);
+    EXPECT_EQ(1, batches->getInteger().first);
+    stats::ObservationPtr requests =
+        stats::StatsMgr::instance().getObservation("update-batched-requests");
+    ASSERT_TRUE(requests);
+    EXPECT_EQ(3, requests->getInteger().first);
+
+    // Without batching each request gets its own transaction.
+    update_mgr_->setMaxBatchSize(1);
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_EQ(2, update_mgr_->getTransactionCount());
+    EXPECT_EQ(3, update_mgr_->getQueueCount());
+
+    // Removing the batch transaction removes all of its entries.
+    update_mgr_->clearTransactionList();
+    EXPECT_EQ(0, update_mgr_->getTransactionCount());
+}
+
+/// @brief Tests the fallback of a rejected batch to individual transactions.
+/// This test verifies that:
+/// 1. The requests of a batch rejected by the server are listed for
+/// individual processing.
+/// 2. They are carried out ahead of the queue, one transaction each.
+TEST_F(D2UpdateMgrTest, batchFallback) {
+    stats::StatsMgr::instance().removeAll();
+    update_mgr_->setMaxBatchSize(32);
+
+    std::vector<NameChangeRequestPtr> ncrs;
+    ncrs.push_back(makeAddNcr("one.example.com.", "192.168.1.1", "010101"));
+    ncrs.push_back(makeAddNcr("two.example.com.", "192.168.1.2", "020202"));
+    ncrs.push_back(makeAddNcr("three.example.com.", "192.168.1.3", "030303"));
+    for (int i = 0; i < ncrs.size(); ++i) {
+        ASSERT_NO_THROW(queue_mgr_->enqueue(ncrs[i]));
+    }
+
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(0, update_mgr_->getQueueCount());
+
+    // Queue a new request which must wait for the fallback.
+    NameChangeRequestPtr ncr = makeAddNcr("four.example.com.", "192.168.1.4",
+                                          "040404");
+    ASSERT_NO_THROW(queue_mgr_->enqueue(ncr));
+
+    // The server rejects the batch as one of the FQDNs is in use.
+    asiolink::IOAddress server_ip("127.0.0.1");
+    FauxServer server(*io_service_, server_ip, 5301);
+    server.receive(FauxServer::USE_RCODE, dns::Rcode::YXDOMAIN());
+    size_t timeout = cfg_mgr_->getD2Params()->getDnsServerTimeout() + 100;
+    for (int passes = 0; update_mgr_->getTransactionCount() &&
+         (passes < 10); ++passes) {
+        ASSERT_LT(0, runTimedIO(timeout));
+        EXPECT_NO_THROW(update_mgr_->checkFinishedTransactions());
+    }
+
+    EXPECT_EQ(0, update_mgr_->getTransactionCount());
+    EXPECT_EQ(3, update_mgr_->getFallbackCount());
+    stats::ObservationPtr fallbacks =
+        stats::StatsMgr::instance().getObservation("update-batch-fallbacks");
+    ASSERT_TRUE(fallbacks);
+    EXPECT_EQ(1, fallbacks->getInteger().first);
+
+    for (int i = 0; i < ncrs.size(); ++i) {
+        EXPECT_NO_THROW(update_mgr_->pickNextJob());
+        EXPECT_EQ(i + 1, update_mgr_->getTransactionCount());
+        EXPECT_EQ(2 - i, update_mgr_->getFallbackCount());
+        EXPECT_EQ(1, update_mgr_->getQueueCount());
+        EXPECT_TRUE(update_mgr_->hasTransaction(ncrs[i]->getDhcid()));
+    }
+}
+
+/// @brief Tests that a batch failing for lack of a server is not carried out
+/// again individually.
+/// This test verifies that when no server responds to a batch, all of its
+/// requests fail and none is listed for individual processing.
+TEST_F(D2UpdateMgrTest, batchFailure) {
+    stats::StatsMgr::instance().removeAll();
+    update_mgr_->setMaxBatchSize(32);
+
+    std::vector<NameChangeRequestPtr> ncrs;
+    ncrs.push_back(makeAddNcr("one.example.com.", "192.168.1.1", "010101"));
+    ncrs.push_back(makeAddNcr("two.example.com.", "192.168.1.2", "020202"));
+    ncrs.push_back(makeAddNcr("three.example.com.", "192.168.1.3", "030303"));
+    for (int i = 0; i < ncrs.size(); ++i) {
+        ASSERT_NO_THROW(queue_mgr_->enqueue(ncrs[i]));
+    }
+
+    // No server is running, so the batch will time out.
+    processAll();
+
+    for (int i = 0; i < ncrs.size(); ++i) {
+        EXPECT_EQ(dhcp_ddns::ST_FAILED, ncrs[i]->getStatus());
+    }
+    EXPECT_EQ(0, update_mgr_->getFallbackCount());
+    EXPECT_FALSE(stats::StatsMgr::instance().
+                 getObservation("update-batch-fallbacks"));
+}
+
+/// @brief Tests processing of a batch.
+/// This test verifies that update manager carries out compatible requests
+/// with a batch transaction, using a fake server that responds to all
+/// requests with NOERROR.
+TEST_F(D2UpdateMgrTest, batchTransaction) {
+    update_mgr_->setMaxBatchSize(32);
+
+    std::vector<NameChangeRequestPtr> ncrs;
+    ncrs.push_back(makeAddNcr("one.example.com.", "192.168.1.1", "010101"));
+    ncrs.push_back(makeAddNcr("two.example.com.", "192.168.1.2", "020202"));
+    ncrs.push_back(makeAddNcr("three.example.com.", "192.168.1.3", "030303"));
+    for (int i = 0; i < ncrs.size(); ++i) {
+        ncrs[i]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(ncrs[i]));
+    }
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    FauxServer server(*io_service_, server_ip, 5301);
+    server.receive(FauxServer::USE_RCODE, dns::Rcode::NOERROR());
+
+    // Run sweep and IO until everything is done.
+    processAll();
+
+    for (int i = 0; i < ncrs.size(); ++i) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, ncrs[i]->getStatus());
+    }
+}
+
+/// @brief Tests processing of a batch over TCP.
+/// This test verifies that when the update manager is set to use TCP, the
+/// requests are carried out over a single pooled connection to the server.
+TEST_F(D2UpdateMgrTest, batchTransactionTcp) {
+    update_mgr_->setDnsProtocol(DNSClient::TCP);
+    update_mgr_->setMaxBatchSize(32);
+
+    std::vector<NameChangeRequestPtr> ncrs;
+    ncrs.push_back(makeAddNcr("one.example.com.", "192.168.1.1", "010101"));
+    ncrs.push_back(makeAddNcr("two.example.com.", "192.168.1.2", "020202"));
+    ncrs.push_back(makeAddNcr("three.example.com.", "192.168.1.3", "030303"));
+    for (int i = 0; i < ncrs.size(); ++i) {
+        ncrs[i]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(ncrs[i]));
+    }
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    TcpFauxServer server(*io_service_, server_ip, 5301);
+
+    // Run sweep and IO until everything is done.
+    processAll();
+
+    for (int i = 0; i < ncrs.size(); ++i) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, ncrs[i]->getStatus());
+    }
+
+    // All of the updates went over the same connection.
+    EXPECT_EQ(1, server.accept_count_);
+    EXPECT_EQ(1, update_mgr_->getTcpConnectionPool()->getConnectionCount());
+}
+
+/// @brief Tests processing of multiple transactions by update threads.
+/// This test verifies that the transactions run by several update threads
+/// complete, using a fake server that responds to all requests with NOERROR.
+TEST_F(D2UpdateMgrTest, multiTransactionThreaded) {
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(4));
+
+    int test_count = canned_count_;
+    for (int i = test_count; i > 0; i--) {
+        canned_ncrs_[i-1]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i-1]));
+    }
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    FauxServer server(*io_service_, server_ip, 5301);
+    server.receive(FauxServer::USE_RCODE, dns::Rcode::NOERROR());
+
+    processAllThreaded();
+
+    for (int i = 0; i < test_count; i++) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, canned_ncrs_[i]->getStatus());
+    }
+}
+
+/// @brief Tests processing of multiple transactions by update threads over
+/// TCP.
+/// This test verifies that concurrent transactions run by several update
+/// threads share the pooled connection to the server.
+TEST_F(D2UpdateMgrTest, multiTransactionThreadedTcp) {
+    ASSERT_NO_THROW(update_mgr_->setUpdateThreads(4));
+    update_mgr_->setDnsProtocol(DNSClient::TCP);
+
+    int test_count = canned_count_;
+    for (int i = test_count; i > 0; i--) {
+        canned_ncrs_[i-1]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i-1]));
+    }
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    TcpFauxServer server(*io_service_, server_ip, 5301);
+
+    processAllThreaded();
+
+    for (int i = 0; i < test_count; i++) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, canned_ncrs_[i]->getStatus());
+    }
+
+    EXPECT_EQ(1, server.accept_count_);
+    EXPECT_EQ(1, update_mgr_->getTcpConnectionPool()->getConnectionCount());
+}
+
 }
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <d2/dns_client.h>
+#include <d2/dns_tcp_connection.h>
 #include <dns/opcode.h>
 #include <asiodns/io_fetch.h>
 #include <asiodns/logger.h>
@@ -260,11 +261,13 @@ public:
     // callback object is NULL.
     void runConstructorTest() {
         EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::UDP));
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP));
+        DnsTcpConnectionPoolPtr pool(new DnsTcpConnectionPool());
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP, pool));
 
-        // The TCP Transport is not supported right now. So, we return exception
-        // if caller specified TCP as a preferred protocol. This test will be
-        // removed once TCP is supported.
-        EXPECT_THROW(DNSClient(response_, NULL, DNSClient::TCP),
+        // An invalid protocol is rejected.
+        EXPECT_THROW(DNSClient(response_, NULL,
+                               static_cast<DNSClient::Protocol>(2)),
                      isc::NotImplemented);
     }
 
@@ -405,6 +408,54 @@ public:
         service_.get_io_service().reset();
     }
 
+    // This test verifies that DNSClient can send DNS Updates over TCP and
+    // receive the responses, and that the clients sharing a pool of TCP
+    // connections use a single connection to the server.
+    //
+    // @param clients number of clients sharing the pool, each of which
+    // sends an update.
+    // @param respond indicates if the server responds.
+    void runTcpSendReceiveTest(const size_t clients, const bool respond) {
+        expect_response_ = respond;
+
+        // Create a request DNS Update message.
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+
+        TcpFauxServer server(service_, IOAddress(TEST_ADDRESS), TEST_PORT);
+        server.respond_ = respond;
+
+        // The responses of all of the clients are stored in response_, this
+        // is fine as they are all identical.
+        DnsTcpConnectionPoolPtr pool(new DnsTcpConnectionPool());
+        std::vector<DNSClientPtr> clients_list;
+        for (size_t i = 0; i < clients; ++i) {
+            clients_list.push_back(DNSClientPtr(new DNSClient(response_, this,
+                                                              DNSClient::TCP,
+                                                              pool)));
+        }
+
+        const int timeout = 500;
+        for (size_t i = 0; i < clients; ++i) {
+            expected_++;
+            // Each message must have its own ID to be pipelined.
+            message.setId(static_cast<uint16_t>(i));
+            clients_list[i]->doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                      TEST_PORT, message, timeout);
+        }
+
+        service_.run();
+
+        EXPECT_EQ(clients, received_);
+        EXPECT_EQ(1, pool->getConnectionCount());
+        EXPECT_EQ(1, server.accept_count_);
+        EXPECT_EQ(clients, server.request_count_);
+
+        pool->closeAll();
+        service_.get_io_service().reset();
+    }
+
     // Performs a single request-response exchange with or without TSIG
     //
     // @param client_key TSIG passed to dns_client and also used by the
@@ -542,6 +593,23 @@ TEST_F(DNSClientTest, sendReceiveTwice) {
     EXPECT_EQ(2, received_);
 }
 
+// Verify that the DNSClient sends DNS Updates and receives the responses
+// over TCP.
+TEST_F(DNSClientTest, tcpSendReceive) {
+    runTcpSendReceiveTest(1, true);
+}
+
+// Verify that DNSClients sharing a pool of TCP connections pipeline their
+// updates over a single connection.
+TEST_F(DNSClientTest, tcpSharedConnection) {
+    runTcpSendReceiveTest(10, true);
+}
+
+// Verify that timeout is reported when no response is received over TCP.
+TEST_F(DNSClientTest, tcpTimeout) {
+    runTcpSendReceiveTest(1, false);
+}
+
 // Verify that it is possible to use the DNSClient instance to perform the
 // following  sequence of message exchanges:
 // 1. send
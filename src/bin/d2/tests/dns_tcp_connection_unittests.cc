@@ -0,0 +1,505 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <d2/dns_tcp_connection.h>
+#include <nc_test_utils.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::d2;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Outcome of a message exchange.
+struct Result {
+    boost::system::error_code ec_;
+    std::vector<uint8_t> response_;
+};
+
+/// @brief Completion handler blocking until it is released.
+class BlockingHandler {
+public:
+    /// @brief Constructor
+    BlockingHandler() : entered_(false), released_(false), cancelled_(false) {
+    }
+
+    /// @brief Completion handler.
+    ///
+    /// Cancels its own message, which must not block, and waits until
+    /// @c release is called.
+    void handler(const boost::system::error_code&, const uint8_t*, size_t) {
+        connection_->cancel(message_);
+        Mutex::Locker lock(mutex_);
+        entered_ = true;
+        cond_.signal();
+        while (!released_) {
+            cond_.wait(mutex_);
+        }
+    }
+
+    /// @brief Waits until the handler is invoked.
+    void waitEntered() {
+        Mutex::Locker lock(mutex_);
+        while (!entered_) {
+            cond_.wait(mutex_);
+        }
+    }
+
+    /// @brief Releases the handler.
+    void release() {
+        Mutex::Locker lock(mutex_);
+        released_ = true;
+        cond_.signal();
+    }
+
+    /// @brief Cancels the message from another thread.
+    void cancel() {
+        connection_->cancel(message_);
+        Mutex::Locker lock(mutex_);
+        cancelled_ = true;
+    }
+
+    /// @brief Indicates whether @c cancel returned.
+    bool isCancelled() {
+        Mutex::Locker lock(mutex_);
+        return (cancelled_);
+    }
+
+    /// @brief The connection the message is sent over.
+    DnsTcpConnectionPtr connection_;
+    /// @brief The message.
+    OutputBufferPtr message_;
+
+private:
+    Mutex mutex_;
+    CondVar cond_;
+    bool entered_;
+    bool released_;
+    bool cancelled_;
+};
+
+/// @brief Test fixture for testing DnsTcpConnection.
+///
+/// The connections talk to a TcpFauxServer listening on the test DNS
+/// server address and port.
+class DnsTcpConnectionTest : public TimedIO, public ::testing::Test {
+public:
+    /// @brief Outcomes of the exchanges, in completion order.
+    std::vector<Result> results_;
+
+    /// @brief Constructor
+    DnsTcpConnectionTest() : results_() {
+    }
+
+    /// @brief Builds a DNS message header with the given ID.
+    OutputBufferPtr makeMessage(const uint16_t id) {
+        OutputBufferPtr message(new OutputBuffer(12));
+        message->writeUint16(id);
+        // Opcode UPDATE.
+        message->writeUint8(0x28);
+        for (int i = 0; i < 9; ++i) {
+            message->writeUint8(0);
+        }
+        return (message);
+    }
+
+    /// @brief Creates a connection to the test DNS server.
+    ///
+    /// @param port port of the server, the test DNS server port by default
+    DnsTcpConnectionPtr makeConnection(const size_t port =
+                                       TEST_DNS_SERVER_PORT) {
+        return (DnsTcpConnectionPtr(new DnsTcpConnection(*io_service_,
+                                    IOAddress(TEST_DNS_SERVER_IP), port)));
+    }
+
+    /// @brief Exchange completion handler, records the outcome.
+    void handler(const boost::system::error_code& ec, const uint8_t* data,
+                 size_t length) {
+        Result result;
+        result.ec_ = ec;
+        if (data) {
+            result.response_.assign(data, data + length);
+        }
+        results_.push_back(result);
+    }
+
+    /// @brief Sends a message with the given ID.
+    void send(DnsTcpConnectionPtr& connection, const uint16_t id,
+              const unsigned int wait = 2000) {
+        ASSERT_NO_THROW(connection->send(makeMessage(id), wait,
+                                         boost::bind(&DnsTcpConnectionTest::
+                                                     handler, this,
+                                                     _1, _2, _3)));
+    }
+
+    /// @brief Runs IO until the given number of exchanges completed.
+    void runUntil(const size_t count) {
+        while (results_.size() < count) {
+            ASSERT_GT(runTimedIO(2000), 0);
+        }
+    }
+
+    /// @brief Returns the ID of a recorded response.
+    uint16_t responseId(const Result& result) {
+        EXPECT_LE(12, result.response_.size());
+        if (result.response_.size() < 2) {
+            return (0);
+        }
+        return ((result.response_[0] << 8) | result.response_[1]);
+    }
+};
+
+// Verifies a single exchange and that the connection stays open.
+TEST_F(DnsTcpConnectionTest, sendReceive) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    DnsTcpConnectionPtr connection = makeConnection();
+    EXPECT_FALSE(connection->isOpen());
+
+    send(connection, 0x1234);
+    EXPECT_EQ(1, connection->getPendingCount());
+    // The handler is never invoked from within send.
+    EXPECT_TRUE(results_.empty());
+
+    runUntil(1);
+    EXPECT_FALSE(results_[0].ec_);
+    EXPECT_EQ(0x1234, responseId(results_[0]));
+    EXPECT_EQ(0xA8, results_[0].response_[2]);
+    EXPECT_TRUE(connection->isOpen());
+    EXPECT_EQ(0, connection->getPendingCount());
+
+    // The second exchange reuses the connection.
+    send(connection, 0x1235);
+    runUntil(2);
+    EXPECT_FALSE(results_[1].ec_);
+    EXPECT_EQ(0x1235, responseId(results_[1]));
+    EXPECT_EQ(1, connection->getOpenCount());
+    EXPECT_EQ(1, server.accept_count_);
+}
+
+// Verifies that messages are pipelined and responses received out of order
+// are matched to their requests.
+TEST_F(DnsTcpConnectionTest, pipelining) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    // The server answers once it has received all of the requests, so
+    // they must have been sent without waiting for the responses.
+    server.hold_count_ = 5;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    for (uint16_t id = 1; id <= 5; ++id) {
+        send(connection, id);
+    }
+    EXPECT_EQ(5, connection->getPendingCount());
+
+    runUntil(5);
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_FALSE(results_[i].ec_);
+        // Responses were sent in reverse order.
+        EXPECT_EQ(5 - i, responseId(results_[i]));
+    }
+    EXPECT_EQ(1, server.accept_count_);
+    EXPECT_EQ(0, connection->getPendingCount());
+}
+
+// Verifies that a message with the ID of a message waiting for its response
+// is held back until that response is received.
+TEST_F(DnsTcpConnectionTest, sameId) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    server.hold_count_ = 2;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    send(connection, 7);
+    send(connection, 7);
+    send(connection, 8);
+    EXPECT_EQ(3, connection->getPendingCount());
+
+    // The server holds the responses until it gets two requests: the
+    // first message with ID 7 and the one with ID 8.
+    runUntil(2);
+    EXPECT_EQ(8, responseId(results_[0]));
+    EXPECT_EQ(7, responseId(results_[1]));
+
+    // Then the second message with ID 7 is sent.
+    send(connection, 9);
+    runUntil(4);
+    EXPECT_FALSE(results_[2].ec_);
+    EXPECT_EQ(9, responseId(results_[2]));
+    EXPECT_FALSE(results_[3].ec_);
+    EXPECT_EQ(7, responseId(results_[3]));
+    EXPECT_EQ(4, server.request_count_);
+}
+
+// Verifies that a timeout fails only the message and keeps the connection.
+TEST_F(DnsTcpConnectionTest, timeout) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    server.respond_ = false;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    send(connection, 1, 100);
+    runUntil(1);
+    EXPECT_EQ(boost::asio::error::timed_out, results_[0].ec_);
+    EXPECT_EQ(0, connection->getPendingCount());
+    EXPECT_TRUE(connection->isOpen());
+
+    // The connection is still usable.
+    server.respond_ = true;
+    send(connection, 2);
+    runUntil(2);
+    EXPECT_FALSE(results_[1].ec_);
+    EXPECT_EQ(2, responseId(results_[1]));
+    EXPECT_EQ(1, server.accept_count_);
+}
+
+// Verifies that the ID of a message which timed out stays reserved, so a
+// response arriving late is not taken for the response to the next message
+// with the same ID.
+TEST_F(DnsTcpConnectionTest, lateResponse) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    // The server answers in pairs, so the first message times out.
+    server.hold_count_ = 2;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    send(connection, 1, 100);
+    runUntil(1);
+    EXPECT_EQ(boost::asio::error::timed_out, results_[0].ec_);
+    EXPECT_EQ(0, connection->getPendingCount());
+    EXPECT_EQ(1, connection->getReservedCount());
+
+    // The next message with the same ID is held back.
+    send(connection, 1);
+    EXPECT_EQ(1, connection->getPendingCount());
+
+    // The server answers the second request and then, late, the first.
+    send(connection, 2);
+    runUntil(2);
+    EXPECT_FALSE(results_[1].ec_);
+    EXPECT_EQ(2, responseId(results_[1]));
+    while (connection->getReservedCount() > 0) {
+        ASSERT_GT(runTimedIO(2000), 0);
+    }
+    // The late response was dropped.
+    EXPECT_EQ(2, results_.size());
+    EXPECT_EQ(1, connection->getPendingCount());
+
+    // The held back message has been sent: it gets its own response.
+    send(connection, 3);
+    runUntil(4);
+    EXPECT_FALSE(results_[2].ec_);
+    EXPECT_EQ(3, responseId(results_[2]));
+    EXPECT_FALSE(results_[3].ec_);
+    EXPECT_EQ(1, responseId(results_[3]));
+    EXPECT_EQ(4, server.request_count_);
+    EXPECT_EQ(1, connection->getOpenCount());
+}
+
+// Verifies that the connection is reset when a message is held back by the
+// ID of a message which timed out and got no response.
+TEST_F(DnsTcpConnectionTest, reservedIdReset) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    server.respond_ = false;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    send(connection, 1, 100);
+    runUntil(1);
+    EXPECT_EQ(boost::asio::error::timed_out, results_[0].ec_);
+    EXPECT_EQ(1, connection->getReservedCount());
+
+    // The message with the reserved ID times out and the connection is
+    // reset, failing the other message waiting on it.
+    send(connection, 2, 5000);
+    send(connection, 1, 200);
+    runUntil(3);
+    EXPECT_EQ(boost::asio::error::timed_out, results_[1].ec_);
+    EXPECT_EQ(boost::asio::error::connection_reset, results_[2].ec_);
+    EXPECT_FALSE(connection->isOpen());
+    EXPECT_EQ(0, connection->getReservedCount());
+    EXPECT_EQ(0, connection->getPendingCount());
+
+    // The ID can be used on the new connection.
+    server.respond_ = true;
+    send(connection, 1);
+    runUntil(4);
+    EXPECT_FALSE(results_[3].ec_);
+    EXPECT_EQ(1, responseId(results_[3]));
+    EXPECT_EQ(2, connection->getOpenCount());
+}
+
+// Verifies that a connection closed by the server fails the pending
+// messages and is reopened by the next message.
+TEST_F(DnsTcpConnectionTest, serverClose) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    server.respond_ = false;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    send(connection, 1);
+    while (server.request_count_ < 1) {
+        ASSERT_GT(runTimedIO(2000), 0);
+    }
+    server.closeConnections();
+    runUntil(1);
+    EXPECT_TRUE(results_[0].ec_);
+    EXPECT_NE(boost::asio::error::timed_out, results_[0].ec_);
+    EXPECT_FALSE(connection->isOpen());
+
+    server.respond_ = true;
+    send(connection, 2);
+    runUntil(2);
+    EXPECT_FALSE(results_[1].ec_);
+    EXPECT_EQ(2, connection->getOpenCount());
+    EXPECT_EQ(2, server.accept_count_);
+}
+
+// Verifies that a connection failure is reported.
+TEST_F(DnsTcpConnectionTest, connectionRefused) {
+    // No server listens on this port.
+    DnsTcpConnectionPtr connection = makeConnection(TEST_DNS_SERVER_PORT + 1);
+    send(connection, 1);
+    runUntil(1);
+    EXPECT_TRUE(results_[0].ec_);
+    EXPECT_NE(boost::asio::error::timed_out, results_[0].ec_);
+    EXPECT_EQ(0, connection->getOpenCount());
+}
+
+// Verifies that cancelled messages are not completed and that closing the
+// connection aborts the pending messages.
+TEST_F(DnsTcpConnectionTest, cancelAndClose) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    server.hold_count_ = 2;
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    OutputBufferPtr message = makeMessage(1);
+    ASSERT_NO_THROW(connection->send(message, 2000,
+                                     boost::bind(&DnsTcpConnectionTest::
+                                                 handler, this, _1, _2, _3)));
+    send(connection, 2);
+    send(connection, 3);
+    connection->cancel(message);
+    EXPECT_EQ(2, connection->getPendingCount());
+
+    // The cancelled message is not sent.
+    runUntil(2);
+    EXPECT_EQ(3, responseId(results_[0]));
+    EXPECT_EQ(2, responseId(results_[1]));
+    EXPECT_EQ(2, server.request_count_);
+
+    send(connection, 4);
+    connection->close();
+    ASSERT_EQ(3, results_.size());
+    EXPECT_EQ(boost::asio::error::operation_aborted, results_[2].ec_);
+    EXPECT_FALSE(connection->isOpen());
+}
+
+// Verifies that cancelling a message waits for its handler when it is being
+// invoked by another thread.
+TEST_F(DnsTcpConnectionTest, cancelWaitsForHandler) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    BlockingHandler blocking;
+    blocking.connection_ = makeConnection();
+    blocking.message_ = makeMessage(1);
+    ASSERT_NO_THROW(blocking.connection_->send(blocking.message_, 2000,
+                                               boost::bind(&BlockingHandler::
+                                                           handler, &blocking,
+                                                           _1, _2, _3)));
+
+    // The handler is invoked by the IO thread.
+    Thread io_thread(boost::bind(&IOService::run, io_service_.get()));
+    blocking.waitEntered();
+
+    Thread cancel_thread(boost::bind(&BlockingHandler::cancel, &blocking));
+    usleep(100000);
+    EXPECT_FALSE(blocking.isCancelled());
+
+    blocking.release();
+    cancel_thread.wait();
+    EXPECT_TRUE(blocking.isCancelled());
+
+    io_service_->stop();
+    io_thread.wait();
+}
+
+// Verifies that invalid messages are rejected.
+TEST_F(DnsTcpConnectionTest, invalidMessage) {
+    DnsTcpConnectionPtr connection = makeConnection();
+    DnsTcpConnection::Handler handler;
+
+    OutputBufferPtr message(new OutputBuffer(1));
+    message->writeUint8(0);
+    EXPECT_THROW(connection->send(message, 100, handler), isc::BadValue);
+
+    message = makeMessage(1);
+    message->skip(DnsTcpConnection::MAX_MESSAGE_SIZE);
+    EXPECT_THROW(connection->send(message, 100, handler), isc::BadValue);
+    EXPECT_EQ(0, connection->getPendingCount());
+}
+
+// Verifies that the pool holds a connection per server.
+TEST_F(DnsTcpConnectionTest, pool) {
+    DnsTcpConnectionPool pool;
+    DnsTcpConnectionPtr first =
+        pool.getConnection(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                           TEST_DNS_SERVER_PORT);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first, pool.getConnection(*io_service_,
+                                        IOAddress(TEST_DNS_SERVER_IP),
+                                        TEST_DNS_SERVER_PORT));
+    EXPECT_NE(first, pool.getConnection(*io_service_,
+                                        IOAddress(TEST_DNS_SERVER_IP),
+                                        TEST_DNS_SERVER_PORT + 1));
+    EXPECT_NE(first, pool.getConnection(*io_service_, IOAddress("::1"),
+                                        TEST_DNS_SERVER_PORT));
+    EXPECT_EQ(3, pool.getConnectionCount());
+
+    pool.closeAll();
+    EXPECT_EQ(0, pool.getConnectionCount());
+}
+
+// Verifies that a burst of updates is carried over a single connection.
+TEST_F(DnsTcpConnectionTest, throughput) {
+    TcpFauxServer server(*io_service_, IOAddress(TEST_DNS_SERVER_IP),
+                         TEST_DNS_SERVER_PORT);
+    DnsTcpConnectionPtr connection = makeConnection();
+
+    const size_t count = 1000;
+    for (size_t i = 0; i < count; ++i) {
+        send(connection, static_cast<uint16_t>(i));
+    }
+    runUntil(count);
+
+    std::vector<bool> seen(count, false);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_FALSE(results_[i].ec_);
+        uint16_t id = responseId(results_[i]);
+        ASSERT_LT(id, count);
+        EXPECT_FALSE(seen[id]);
+        seen[id] = true;
+    }
+    EXPECT_EQ(1, server.accept_count_);
+    EXPECT_EQ(count, server.request_count_);
+}
+
+}
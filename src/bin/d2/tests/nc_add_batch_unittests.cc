@@ -0,0 +1,373 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_service.h>
+#include <d2/d2_cfg_mgr.h>
+#include <d2/nc_add_batch.h>
+#include <dns/messagerenderer.h>
+#include <nc_test_utils.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace isc;
+using namespace isc::d2;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test class derived from NameAddBatchTransaction to provide
+/// visibility to protected methods.
+class NameAddBatchStub : public NameAddBatchTransaction {
+public:
+    NameAddBatchStub(asiolink::IOServicePtr& io_service,
+                     NameChangeRequestList& ncrs,
+                     DdnsDomainPtr& forward_domain,
+                     DdnsDomainPtr& reverse_domain,
+                     D2CfgMgrPtr& cfg_mgr)
+        : NameAddBatchTransaction(io_service, ncrs, forward_domain,
+                                  reverse_domain, cfg_mgr) {
+    }
+
+    virtual ~NameAddBatchStub() {
+    }
+
+    /// @brief Simulates sending update requests to the DNS server
+    ///
+    /// Increments the update attempt count and posts a next event of
+    /// NOP_EVT, without an actual send.
+    ///
+    /// @param comment Parameter is unused, but present in base class method.
+    virtual void sendUpdate(const std::string& /*comment*/) {
+        setUpdateAttempts(getUpdateAttempts() + 1);
+        postNextEvent(StateModel::NOP_EVT);
+    }
+
+    /// @brief Simulates receiving a response
+    ///
+    /// @param status simulated DNSClient status
+    /// @param rcode  simulated server response code
+    void fakeResponse(const DNSClient::Status& status,
+                      const dns::Rcode& rcode) {
+        setDnsUpdateStatus(status);
+        D2UpdateMessagePtr msg(new D2UpdateMessage(D2UpdateMessage::OUTBOUND));
+        msg->setRcode(rcode);
+        setDnsUpdateResponse(msg);
+        postNextEvent(NameChangeTransaction::IO_COMPLETED_EVT);
+    }
+
+    /// @brief Selects the first server of the given domain.
+    bool selectServer(const DdnsDomainPtr& domain) {
+        initServerSelection(domain);
+        selectNextServer();
+        return (getCurrentServer().get() != 0);
+    }
+
+    using StateModel::postNextEvent;
+    using StateModel::setState;
+    using StateModel::initDictionaries;
+    using NameAddBatchTransaction::addingFwdAddrsHandler;
+    using NameAddBatchTransaction::replacingRevPtrsHandler;
+    using NameAddBatchTransaction::processAddOkHandler;
+    using NameAddBatchTransaction::processAddFailedHandler;
+    using NameAddBatchTransaction::buildAddFwdAddressRequest;
+    using NameAddBatchTransaction::buildReplaceRevPtrsRequest;
+};
+
+typedef boost::shared_ptr<NameAddBatchStub> NameAddBatchStubPtr;
+
+/// @brief Test fixture for testing NameAddBatchTransaction
+class NameAddBatchTransactionTest : public TransactionTest {
+public:
+    /// @brief Requests of the batch.
+    NameChangeRequestList ncrs_;
+
+    /// @brief Creates a batch of three IPv4 Add requests.
+    ///
+    /// The first request is the canned one, the others are copies with
+    /// their own FQDN, address and DHCID.
+    ///
+    /// @param change_mask determines which change directions are requested
+    NameAddBatchStubPtr makeBatch(int change_mask = FWD_AND_REV_CHG) {
+        setupForIPv4Transaction(dhcp_ddns::CHG_ADD, change_mask);
+        ncrs_.clear();
+        ncrs_.push_back(ncr_);
+        for (int i = 2; i <= 3; ++i) {
+            dhcp_ddns::NameChangeRequestPtr
+                ncr(new dhcp_ddns::NameChangeRequest(*ncr_));
+            std::ostringstream fqdn;
+            fqdn << "host" << i << ".forward.example.com.";
+            ncr->setFqdn(fqdn.str());
+            std::ostringstream address;
+            address << "192.168.2." << i;
+            ncr->setIpAddress(address.str());
+            std::ostringstream dhcid;
+            dhcid << "01020304050607" << i << i;
+            ncr->setDhcid(dhcid.str());
+            ncrs_.push_back(ncr);
+        }
+
+        return (NameAddBatchStubPtr(new NameAddBatchStub(io_service_, ncrs_,
+                                                         forward_domain_,
+                                                         reverse_domain_,
+                                                         cfg_mgr_)));
+    }
+
+    /// @brief Creates a batch at a known point in the state model.
+    ///
+    /// @param state value to set as the current state
+    /// @param event value to post as the next event
+    /// @param change_mask determines which change directions are requested
+    NameAddBatchStubPtr prepHandlerTest(unsigned int state, unsigned int event,
+                                        unsigned int change_mask =
+                                        FWD_AND_REV_CHG) {
+        NameAddBatchStubPtr batch = makeBatch(change_mask);
+        batch->initDictionaries();
+        batch->postNextEvent(event);
+        batch->setState(state);
+        return (batch);
+    }
+};
+
+// Checks construction requirements.
+TEST_F(NameAddBatchTransactionTest, construction) {
+    ASSERT_NO_THROW(makeBatch());
+    EXPECT_EQ(3, ncrs_.size());
+
+    // An empty list is rejected.
+    NameChangeRequestList empty;
+    EXPECT_THROW(NameAddBatchTransaction(io_service_, empty, forward_domain_,
+                                         reverse_domain_, cfg_mgr_),
+                 NameAddBatchTransactionError);
+
+    // Remove requests are rejected.
+    ncrs_[1]->setChangeType(dhcp_ddns::CHG_REMOVE);
+    EXPECT_THROW(NameAddBatchTransaction(io_service_, ncrs_, forward_domain_,
+                                         reverse_domain_, cfg_mgr_),
+                 NameAddBatchTransactionError);
+}
+
+// Checks the forward add request carries all of the requests.
+TEST_F(NameAddBatchTransactionTest, buildForwardAdd) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = makeBatch());
+    ASSERT_NO_THROW(batch->buildAddFwdAddressRequest());
+
+    const D2UpdateMessagePtr& request = batch->getDnsUpdateRequest();
+    ASSERT_TRUE(request);
+    checkZone(request, forward_domain_->getName());
+    checkRRCount(request, D2UpdateMessage::SECTION_PREREQUISITE, 3);
+    checkRRCount(request, D2UpdateMessage::SECTION_UPDATE, 6);
+
+    for (int i = 0; i < 3; ++i) {
+        const dhcp_ddns::NameChangeRequestPtr& ncr = ncrs_[i];
+        const std::string& fqdn = ncr->getFqdn();
+        dns::RRsetPtr rrset;
+        ASSERT_TRUE(rrset = getRRFromSection(request, D2UpdateMessage::
+                                             SECTION_PREREQUISITE, i));
+        checkRR(rrset, fqdn, dns::RRClass::NONE(), dns::RRType::ANY(), 0, ncr);
+
+        ASSERT_TRUE(rrset = getRRFromSection(request, D2UpdateMessage::
+                                             SECTION_UPDATE, 2 * i));
+        checkRR(rrset, fqdn, dns::RRClass::IN(), dns::RRType::A(),
+                ncr->getLeaseLength(), ncr);
+
+        ASSERT_TRUE(rrset = getRRFromSection(request, D2UpdateMessage::
+                                             SECTION_UPDATE, 2 * i + 1));
+        checkRR(rrset, fqdn, dns::RRClass::IN(), dns::RRType::DHCID(),
+                ncr->getLeaseLength(), ncr);
+    }
+}
+
+// Checks the reverse replace request carries all of the requests.
+TEST_F(NameAddBatchTransactionTest, buildReplaceRevPtrsRequest) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = makeBatch());
+    ASSERT_NO_THROW(batch->buildReplaceRevPtrsRequest());
+
+    const D2UpdateMessagePtr& request = batch->getDnsUpdateRequest();
+    ASSERT_TRUE(request);
+    checkZone(request, reverse_domain_->getName());
+    checkRRCount(request, D2UpdateMessage::SECTION_PREREQUISITE, 0);
+    checkRRCount(request, D2UpdateMessage::SECTION_UPDATE, 12);
+
+    for (int i = 0; i < 3; ++i) {
+        const dhcp_ddns::NameChangeRequestPtr& ncr = ncrs_[i];
+        std::string rev_addr = D2CfgMgr::reverseIpAddress(ncr->getIpAddress());
+        dns::RRsetPtr rrset;
+        ASSERT_TRUE(rrset = getRRFromSection(request, D2UpdateMessage::
+                                             SECTION_UPDATE, 4 * i));
+        checkRR(rrset, rev_addr, dns::RRClass::ANY(), dns::RRType::PTR(), 0,
+                ncr);
+
+        ASSERT_TRUE(rrset = getRRFromSection(request, D2UpdateMessage::
+                                             SECTION_UPDATE, 4 * i + 2));
+        checkRR(rrset, rev_addr, dns::RRClass::IN(), dns::RRType::PTR(),
+                ncr->getLeaseLength(), ncr);
+    }
+}
+
+// Checks the size estimates.
+TEST_F(NameAddBatchTransactionTest, sizes) {
+    // The estimates are upper bounds of the rendered messages.
+    NameAddBatchStubPtr batch = makeBatch(FORWARD_CHG);
+    ASSERT_NO_THROW(batch->buildAddFwdAddressRequest());
+    dns::MessageRenderer renderer;
+    batch->getDnsUpdateRequest()->toWire(renderer);
+    size_t estimate = NameAddBatchTransaction::getOverheadSize(forward_domain_,
+                                                               reverse_domain_);
+    for (int i = 0; i < 3; ++i) {
+        estimate += NameAddBatchTransaction::getRequestSize(*ncrs_[i]);
+    }
+    EXPECT_GE(estimate, renderer.getLength());
+
+    batch = makeBatch(REVERSE_CHG);
+    ASSERT_NO_THROW(batch->buildReplaceRevPtrsRequest());
+    renderer.clear();
+    batch->getDnsUpdateRequest()->toWire(renderer);
+    estimate = NameAddBatchTransaction::getOverheadSize(forward_domain_,
+                                                        reverse_domain_);
+    for (int i = 0; i < 3; ++i) {
+        estimate += NameAddBatchTransaction::getRequestSize(*ncrs_[i]);
+    }
+    EXPECT_GE(estimate, renderer.getLength());
+
+    // A TSIG key makes the message larger.
+    DdnsDomainPtr signed_domain = makeDomain("example.com.", "key.example.com");
+    DdnsDomainPtr no_domain;
+    EXPECT_GT(NameAddBatchTransaction::getOverheadSize(signed_domain,
+                                                       no_domain),
+              NameAddBatchTransaction::getOverheadSize(forward_domain_,
+                                                       no_domain));
+}
+
+// Checks the forward add of a batch which includes reverse changes.
+TEST_F(NameAddBatchTransactionTest, addingFwdAddrsHandler_fwdAndRevAddOK) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = prepHandlerTest(NameAddBatchTransaction::
+                                            ADDING_FWD_ADDRS_ST,
+                                            NameChangeTransaction::
+                                            SERVER_SELECTED_EVT));
+    ASSERT_TRUE(batch->selectServer(forward_domain_));
+
+    // Construct and send the request.
+    EXPECT_NO_THROW(batch->addingFwdAddrsHandler());
+    EXPECT_EQ(NameChangeTransaction::NOP_EVT, batch->getNextEvent());
+
+    batch->fakeResponse(DNSClient::SUCCESS, dns::Rcode::NOERROR());
+    EXPECT_NO_THROW(batch->addingFwdAddrsHandler());
+
+    EXPECT_TRUE(batch->getForwardChangeCompleted());
+    EXPECT_FALSE(batch->getReverseChangeCompleted());
+    EXPECT_EQ(NameChangeTransaction::SELECTING_REV_SERVER_ST,
+              batch->getCurrState());
+    EXPECT_EQ(NameChangeTransaction::SELECT_SERVER_EVT,
+              batch->getNextEvent());
+}
+
+// Checks that an FQDN in use fails the batch, rather than replacing it.
+TEST_F(NameAddBatchTransactionTest, addingFwdAddrsHandler_FqdnInUse) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = prepHandlerTest(NameAddBatchTransaction::
+                                            ADDING_FWD_ADDRS_ST,
+                                            NameChangeTransaction::
+                                            SERVER_SELECTED_EVT));
+    ASSERT_TRUE(batch->selectServer(forward_domain_));
+
+    EXPECT_NO_THROW(batch->addingFwdAddrsHandler());
+    batch->fakeResponse(DNSClient::SUCCESS, dns::Rcode::YXDOMAIN());
+    EXPECT_NO_THROW(batch->addingFwdAddrsHandler());
+
+    EXPECT_TRUE(batch->getRejected());
+    EXPECT_FALSE(batch->getForwardChangeCompleted());
+    EXPECT_FALSE(batch->getReverseChangeCompleted());
+    EXPECT_EQ(NameChangeTransaction::PROCESS_TRANS_FAILED_ST,
+              batch->getCurrState());
+    EXPECT_EQ(NameChangeTransaction::UPDATE_FAILED_EVT,
+              batch->getNextEvent());
+}
+
+// Checks the reverse replacement.
+TEST_F(NameAddBatchTransactionTest, replacingRevPtrsHandler_OK) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = prepHandlerTest(NameAddBatchTransaction::
+                                            REPLACING_REV_PTRS_ST,
+                                            NameChangeTransaction::
+                                            SERVER_SELECTED_EVT));
+    ASSERT_TRUE(batch->selectServer(reverse_domain_));
+
+    EXPECT_NO_THROW(batch->replacingRevPtrsHandler());
+    checkRRCount(batch->getDnsUpdateRequest(),
+                 D2UpdateMessage::SECTION_UPDATE, 12);
+
+    batch->fakeResponse(DNSClient::SUCCESS, dns::Rcode::NOERROR());
+    EXPECT_NO_THROW(batch->replacingRevPtrsHandler());
+
+    EXPECT_TRUE(batch->getReverseChangeCompleted());
+    EXPECT_EQ(NameChangeTransaction::PROCESS_TRANS_OK_ST,
+              batch->getCurrState());
+    EXPECT_EQ(NameChangeTransaction::UPDATE_OK_EVT,
+              batch->getNextEvent());
+}
+
+// Checks that success completes all of the requests.
+TEST_F(NameAddBatchTransactionTest, processAddOkHandler) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = prepHandlerTest(NameChangeTransaction::
+                                            PROCESS_TRANS_OK_ST,
+                                            NameChangeTransaction::
+                                            UPDATE_OK_EVT));
+    EXPECT_NO_THROW(batch->processAddOkHandler());
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, ncrs_[i]->getStatus());
+    }
+    EXPECT_EQ(StateModel::END_ST, batch->getCurrState());
+}
+
+// Checks that a rejection is only reported by the first request.
+TEST_F(NameAddBatchTransactionTest, processAddFailedHandler_rejected) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = prepHandlerTest(NameAddBatchTransaction::
+                                            ADDING_FWD_ADDRS_ST,
+                                            NameChangeTransaction::
+                                            SERVER_SELECTED_EVT));
+    ASSERT_TRUE(batch->selectServer(forward_domain_));
+    EXPECT_NO_THROW(batch->addingFwdAddrsHandler());
+    batch->fakeResponse(DNSClient::SUCCESS, dns::Rcode::YXDOMAIN());
+    EXPECT_NO_THROW(batch->addingFwdAddrsHandler());
+    ASSERT_EQ(NameChangeTransaction::PROCESS_TRANS_FAILED_ST,
+              batch->getCurrState());
+
+    EXPECT_NO_THROW(batch->processAddFailedHandler());
+
+    EXPECT_EQ(dhcp_ddns::ST_FAILED, ncrs_[0]->getStatus());
+    EXPECT_NE(dhcp_ddns::ST_FAILED, ncrs_[1]->getStatus());
+    EXPECT_NE(dhcp_ddns::ST_FAILED, ncrs_[2]->getStatus());
+    EXPECT_EQ(StateModel::END_ST, batch->getCurrState());
+}
+
+// Checks that a failure other than a rejection fails all of the requests.
+TEST_F(NameAddBatchTransactionTest, processAddFailedHandler) {
+    NameAddBatchStubPtr batch;
+    ASSERT_NO_THROW(batch = prepHandlerTest(NameChangeTransaction::
+                                            PROCESS_TRANS_FAILED_ST,
+                                            NameChangeTransaction::
+                                            NO_MORE_SERVERS_EVT));
+    EXPECT_NO_THROW(batch->processAddFailedHandler());
+
+    EXPECT_FALSE(batch->getRejected());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(dhcp_ddns::ST_FAILED, ncrs_[i]->getStatus());
+    }
+    EXPECT_EQ(StateModel::END_ST, batch->getCurrState());
+}
+
+}
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <asiolink/asio_wrapper.h>
+#include <asiolink/tcp_endpoint.h>
 #include <asiolink/udp_endpoint.h>
 #include <d2/d2_cfg_mgr.h>
 #include <dns/opcode.h>
@@ -211,6 +212,127 @@ FauxServer::requestHandler(const boost::system::error_code& error,
 
 
 
+//*************************** TcpFauxServer class ********************
+
+TcpFauxServer::TcpFauxServer(asiolink::IOService& io_service,
+                             const asiolink::IOAddress& address, size_t port)
+    : io_service_(io_service), acceptor_(io_service.get_io_service()),
+      connections_(), accept_count_(0), request_count_(0), respond_(true),
+      hold_count_(0) {
+    isc::asiolink::TCPEndpoint endpoint(address, port);
+    acceptor_.open(endpoint.getASIOEndpoint().protocol());
+    acceptor_.set_option(boost::asio::socket_base::reuse_address(true));
+    acceptor_.bind(endpoint.getASIOEndpoint());
+    acceptor_.listen();
+    accept();
+}
+
+TcpFauxServer::~TcpFauxServer() {
+    boost::system::error_code ignored;
+    acceptor_.close(ignored);
+    closeConnections();
+}
+
+void
+TcpFauxServer::closeConnections() {
+    for (std::list<ConnectionPtr>::iterator it = connections_.begin();
+         it != connections_.end(); ++it) {
+        boost::system::error_code ignored;
+        (*it)->socket_.close(ignored);
+    }
+    connections_.clear();
+}
+
+void
+TcpFauxServer::accept() {
+    ConnectionPtr connection(new Connection(io_service_.get_io_service()));
+    acceptor_.async_accept(connection->socket_,
+                           boost::bind(&TcpFauxServer::acceptHandler, this,
+                                       connection, _1));
+}
+
+void
+TcpFauxServer::acceptHandler(ConnectionPtr connection,
+                             const boost::system::error_code& error) {
+    if (error) {
+        return;
+    }
+
+    ++accept_count_;
+    connections_.push_back(connection);
+    readRequest(connection);
+    accept();
+}
+
+void
+TcpFauxServer::readRequest(ConnectionPtr connection) {
+    boost::asio::async_read(connection->socket_,
+                            boost::asio::buffer(connection->length_,
+                                                sizeof(connection->length_)),
+                            boost::bind(&TcpFauxServer::lengthHandler, this,
+                                        connection, _1));
+}
+
+void
+TcpFauxServer::lengthHandler(ConnectionPtr connection,
+                             const boost::system::error_code& error) {
+    if (error) {
+        return;
+    }
+
+    size_t length = (connection->length_[0] << 8) | connection->length_[1];
+    connection->request_.resize(length);
+    boost::asio::async_read(connection->socket_,
+                            boost::asio::buffer(connection->request_),
+                            boost::bind(&TcpFauxServer::requestHandler, this,
+                                        connection, _1));
+}
+
+void
+TcpFauxServer::requestHandler(ConnectionPtr connection,
+                              const boost::system::error_code& error) {
+    if (error) {
+        return;
+    }
+
+    ++request_count_;
+    if (respond_ && (connection->request_.size() > 2)) {
+        // Turn the request into a response: set the QR bit keeping the
+        // UPDATE opcode (see DNSClientTest::udpReceiveHandler).
+        std::vector<uint8_t> response(connection->request_);
+        response[2] = 0xA8;
+        if (hold_count_ == 0) {
+            respond(connection, response);
+        } else {
+            connection->held_.push_back(response);
+            if (connection->held_.size() >= hold_count_) {
+                for (std::vector<std::vector<uint8_t> >::reverse_iterator
+                     held = connection->held_.rbegin();
+                     held != connection->held_.rend(); ++held) {
+                    respond(connection, *held);
+                }
+                connection->held_.clear();
+            }
+        }
+    }
+
+    readRequest(connection);
+}
+
+void
+TcpFauxServer::respond(ConnectionPtr connection,
+                       const std::vector<uint8_t>& response) {
+    uint8_t length[2];
+    length[0] = static_cast<uint8_t>(response.size() >> 8);
+    length[1] = static_cast<uint8_t>(response.size() & 0xff);
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.push_back(boost::asio::buffer(length, sizeof(length)));
+    buffers.push_back(boost::asio::buffer(response));
+    // Loopback writes of small messages do not block.
+    boost::system::error_code ignored;
+    boost::asio::write(connection->socket_, buffers, ignored);
+}
+
 //********************** TimedIO class ***********************
 
 TimedIO::TimedIO()
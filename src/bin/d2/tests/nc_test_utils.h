@@ -13,10 +13,14 @@
 #include <asiolink/interval_timer.h>
 #include <d2/nc_trans.h>
 
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <gtest/gtest.h>
 
+#include <list>
+#include <vector>
+
 namespace isc {
 namespace d2 {
 
@@ -122,6 +126,87 @@ public:
     }
 };
 
+/// @brief This class simulates a DNS server reached over TCP.
+///
+/// It accepts connections and answers each request with a copy of the
+/// request turned into a response, as the DNSClient tests do.  The answers
+/// can be withheld, or held back until a number of requests has been
+/// received and then sent in the reverse order, to exercise pipelining.
+class TcpFauxServer {
+public:
+    /// @brief State of an accepted connection.
+    struct Connection {
+        Connection(boost::asio::io_service& io_service)
+            : socket_(io_service), held_() {
+        }
+
+        // The connection's socket.
+        boost::asio::ip::tcp::socket socket_;
+        // Length prefix of the request being read.
+        uint8_t length_[2];
+        // Request being read.
+        std::vector<uint8_t> request_;
+        // Responses held back.
+        std::vector<std::vector<uint8_t> > held_;
+    };
+    typedef boost::shared_ptr<Connection> ConnectionPtr;
+
+    // Reference to IOService to use for IO processing.
+    asiolink::IOService& io_service_;
+    // Acceptor on which connections are accepted.
+    boost::asio::ip::tcp::acceptor acceptor_;
+    // Accepted connections.
+    std::list<ConnectionPtr> connections_;
+    // Number of connections accepted.
+    size_t accept_count_;
+    // Number of requests received.
+    size_t request_count_;
+    // Indicates if the server answers the requests.
+    bool respond_;
+    // Number of responses to hold back before sending them in the reverse
+    // order, zero to answer each request at once.
+    size_t hold_count_;
+
+    /// @brief Constructor
+    ///
+    /// Starts listening for connections.
+    ///
+    /// @param io_service IOService to be used for socket IO.
+    /// @param address  IP address at which the server should listen.
+    /// @param port Port number at which the server should listen.
+    TcpFauxServer(asiolink::IOService& io_service,
+                  const asiolink::IOAddress& address, size_t port);
+
+    /// @brief Destructor
+    virtual ~TcpFauxServer();
+
+    /// @brief Closes the accepted connections.
+    void closeConnections();
+
+private:
+    /// @brief Starts accepting a connection.
+    void accept();
+
+    /// @brief Accept completion handler.
+    void acceptHandler(ConnectionPtr connection,
+                       const boost::system::error_code& error);
+
+    /// @brief Starts reading the next request on a connection.
+    void readRequest(ConnectionPtr connection);
+
+    /// @brief Request length prefix read completion handler.
+    void lengthHandler(ConnectionPtr connection,
+                       const boost::system::error_code& error);
+
+    /// @brief Request read completion handler.
+    void requestHandler(ConnectionPtr connection,
+                        const boost::system::error_code& error);
+
+    /// @brief Writes a response on a connection.
+    void respond(ConnectionPtr connection,
+                 const std::vector<uint8_t>& response);
+};
+
 /// @brief Provides a means to process IOService IO for a finite amount of time.
 ///
 /// This class instantiates an IOService provides a single method, runTimedIO
@@ -13,8 +13,11 @@
 #include <dhcp4/json_config_parser.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/incremental_config_cache.h>
+#include <dhcpsrv/lease_mgr_factory.h>
 #include <config/command_mgr.h>
 #include <stats/stats_mgr.h>
+#include <util/stopwatch.h>
 
 using namespace isc::data;
 using namespace isc::hooks;
@@ -200,6 +203,9 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_COMMAND, DHCP4_CONFIG_RECEIVED)
               .arg(config->str());
 
+    // Measure the time spent applying the configuration.
+    isc::util::Stopwatch stopwatch;
+
     ControlledDhcpv4Srv* srv = ControlledDhcpv4Srv::getInstance();
 
     // Single stream instance used in all error clauses
@@ -221,6 +227,7 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
     }
 
     ConstElementPtr answer = configureDhcp4Server(*srv, config);
+    const std::string parse_time = stopwatch.logFormatTotalDuration();
 
     // Check that configuration was successful. If not, do not reopen sockets
     // and don't bother with DDNS stuff.
@@ -239,7 +246,10 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
     try {
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
         cfg_db->setAppendedParameters("universe=4");
-        cfg_db->createManagers();
+        // The databases are still used by the server being replaced.
+        if (!srv->handoff_ || !srv->handoff_->isTakingOver()) {
+            cfg_db->createManagers();
+        }
 
     } catch (const std::exception& ex) {
         err << "Unable to open database: " << ex.what();
@@ -289,6 +299,16 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Install the timer reporting the suppressed log messages.
+    try {
+        CfgMgr::instance().getStagingCfg()->setupLogTimers();
+
+    } catch (const std::exception& ex) {
+        err << "unable to setup the timer for periodically reporting the"
+            " suppressed log messages: " << ex.what() << ".";
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // Start worker thread if there are any timers installed.
     if (TimerMgr::instance()->timersCount() > 0) {
         try {
@@ -300,11 +320,19 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         }
     }
 
+    stopwatch.stop();
+    LOG_INFO(dhcp4_logger, DHCP4_CONFIG_TIMING)
+        .arg(stopwatch.logFormatTotalDuration())
+        .arg(parse_time)
+        .arg(IncrementalConfigCache::instance().getReusedSubnets())
+        .arg(IncrementalConfigCache::instance().getParsedSubnets());
+
     return (answer);
 }
 
 ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
-    : Dhcpv4Srv(port), io_service_(), timer_mgr_(TimerMgr::instance()) {
+    : Dhcpv4Srv(port), io_service_(), timer_mgr_(TimerMgr::instance()),
+      handoff_(), handoff_pid_(0) {
     if (getInstance()) {
         isc_throw(InvalidOperation,
                   "There is another Dhcpv4Srv instance already.");
@@ -344,6 +372,12 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
 
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-histogram-get",
+        boost::bind(&StatsMgr::statisticHistogramGetHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-histogram-get-all",
+        boost::bind(&StatsMgr::statisticHistogramGetAllHandler, _1, _2));
 }
 
 void ControlledDhcpv4Srv::shutdown() {
@@ -351,6 +385,52 @@ void ControlledDhcpv4Srv::shutdown() {
     Dhcpv4Srv::shutdown(); // Initiate DHCPv4 shutdown procedure.
 }
 
+int
+ControlledDhcpv4Srv::takeOverSockets(const std::string& socket_name) {
+    handoff_.reset(new SocketHandoff(socket_name, AF_INET));
+    handoff_pid_ = handoff_->takeOver();
+    return (handoff_pid_);
+}
+
+void
+ControlledDhcpv4Srv::completeHandoff() {
+    if (!handoff_) {
+        return;
+    }
+
+    if (handoff_->isTakingOver()) {
+        // Wait for the replaced server to stop, then use its PID file
+        // and the databases it has closed.
+        handoff_->complete();
+        takeOverPIDFile(handoff_pid_);
+        handoff_pid_ = 0;
+
+        // The statistics couldn't be counted without the lease database
+        // when the configuration was committed.
+        SrvConfigPtr cfg =
+            boost::const_pointer_cast<SrvConfig>(CfgMgr::instance().getCurrentCfg());
+        cfg->getCfgDbAccess()->createManagers();
+        cfg->updateStatistics();
+    }
+
+    handoff_->listen(boost::bind(&ControlledDhcpv4Srv::handoffReady, this));
+}
+
+void
+ControlledDhcpv4Srv::handoffReady() {
+    // The successor uses the control socket and the PID file.
+    CommandMgr::instance().releaseCommandSocket();
+    releasePIDFile();
+
+    // Stop the timers and close the lease database before the successor
+    // opens it.
+    timer_mgr_->stopThread();
+    timer_mgr_->unregisterTimers();
+    LeaseMgrFactory::destroy();
+
+    shutdown();
+}
+
 ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
     try {
         cleanup();
@@ -374,6 +454,8 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-reset-all");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
+        CommandMgr::instance().deregisterCommand("statistic-histogram-get");
+        CommandMgr::instance().deregisterCommand("statistic-histogram-get-all");
 
     } catch (...) {
         // Don't want to throw exceptions from the destructor. The server
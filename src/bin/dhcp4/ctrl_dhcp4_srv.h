@@ -11,6 +11,7 @@
 #include <asiolink/asiolink.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <dhcpsrv/socket_handoff.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp4/dhcp4_srv.h>
 
@@ -52,6 +53,32 @@ public:
     /// @brief Initiates shutdown procedure for the whole DHCPv4 server.
     void shutdown();
 
+    /// @brief Takes over the sockets of a running server.
+    ///
+    /// This method must be called before @c init. If a server listens on
+    /// the handoff socket, its DHCP sockets and control socket are used by
+    /// this server instead of opening new ones, so as no packet is lost
+    /// while this server is configured. The running server keeps serving
+    /// the clients until @c completeHandoff is called. The lease and host
+    /// databases are opened by @c completeHandoff.
+    ///
+    /// @param socket_name path of the handoff socket.
+    ///
+    /// @return PID of the running server or 0 if there is none.
+    ///
+    /// @throw SocketHandoffError if the sockets can't be taken over.
+    int takeOverSockets(const std::string& socket_name);
+
+    /// @brief Completes the takeover of the sockets.
+    ///
+    /// This method must be called after @c init. It stops the replaced
+    /// server, takes over its PID file and opens the lease and host
+    /// databases. The server then listens on the handoff socket for its own
+    /// successor. It does nothing if @c takeOverSockets hasn't been called.
+    ///
+    /// @throw SocketHandoffError if the replaced server didn't stop.
+    void completeHandoff();
+
     /// @brief Command processor
     ///
     /// This method is uniform for all config backends. It processes received
@@ -106,6 +133,12 @@ private:
     /// (that was sent from some yet unspecified sender).
     static void sessionReader(void);
 
+    /// @brief Stops the server when its successor is ready.
+    ///
+    /// The control socket, the PID file and the lease database are
+    /// released for the successor, which takes over the DHCP sockets.
+    void handoffReady();
+
     /// @brief Handler for processing 'shutdown' command
     ///
     /// This handler processes shutdown command, which initializes shutdown
@@ -219,6 +252,12 @@ private:
     /// Shared pointer to the instance of timer @c TimerMgr is held here to
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Handoff of the sockets to or from another server.
+    SocketHandoffPtr handoff_;
+
+    /// @brief PID of the server whose sockets are taken over, or 0.
+    int handoff_pid_;
 };
 
 }; // namespace isc::dhcp
@@ -524,8 +524,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to parser4_text[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 141
-#define YY_END_OF_BUFFER 142
+#define YY_NUM_RULES 154
+#define YY_END_OF_BUFFER 155
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -533,135 +533,147 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1161] =
+static const flex_int16_t yy_accept[1262] =
     {   0,
-      134,  134,    0,    0,    0,    0,    0,    0,    0,    0,
-      142,  140,   10,   11,  140,    1,  134,  131,  134,  134,
-      140,  133,  132,  140,  140,  140,  140,  140,  127,  128,
-      140,  140,  140,  129,  130,    5,    5,    5,  140,  140,
-      140,   10,   11,    0,    0,  123,    0,    0,    0,    0,
+      147,  147,    0,    0,    0,    0,    0,    0,    0,    0,
+      155,  153,   10,   11,  153,    1,  147,  144,  147,  147,
+      153,  146,  145,  153,  153,  153,  153,  153,  140,  141,
+      153,  153,  153,  142,  143,    5,    5,    5,  153,  153,
+      153,   10,   11,    0,    0,  136,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    1,  134,  134,
-        0,  133,  134,    3,    2,    6,    0,  134,    0,    0,
-        0,    0,    0,    0,    4,    0,    0,    9,    0,  124,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  147,
+      147,    0,  146,  147,    3,    2,    6,    0,  147,    0,
+        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
 
+      137,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  139,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  126,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    2,    0,    0,    0,
-        0,    0,    0,    0,    8,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  125,    0,
+        0,    2,    0,    0,    0,    0,    0,    0,    0,    8,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  138,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   47,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   50,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      139,  137,    0,  136,  135,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  105,    0,  104,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   25,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  152,  150,    0,  149,  148,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  117,
+        0,  116,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,   25,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   15,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   16,    0,    0,    0,  138,
-      135,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      106,    0,    0,  108,    0,    0,    0,    0,    0,    0,
-        0,    0,   50,    0,    0,    0,   40,    0,    0,    0,
-        0,   62,    0,    0,    0,    0,    0,    0,    0,    0,
-       28,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   39,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   42,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   60,   21,    0,   26,    0,
-        0,    0,    0,    0,    0,    0,   12,  113,    0,  110,
-        0,  109,    0,    0,    0,    0,   71,    0,    0,    0,
+       15,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
+        0,    0,  151,  148,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  118,    0,    0,  121,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   53,    0,    0,
+
+        0,   43,    0,    0,    0,    0,   73,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   28,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   42,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   45,    0,    0,
+        0,    0,    0,   67,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       23,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       71,   21,    0,   26,    0,    0,    0,    0,    0,    0,
+        0,    0,   12,  126,    0,  123,    0,  122,    0,    0,
+        0,    0,   82,   56,    0,    0,    0,    0,    0,    0,
 
-       41,    0,    0,    0,    0,    0,    0,    0,   72,    0,
-        0,    0,    0,    0,    0,    0,   67,    0,    0,    0,
-        0,    7,    0,    0,  111,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   55,    0,
+        0,    0,   23,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   44,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   83,    0,    0,    0,    0,    0,
+        0,    0,    0,   78,    0,    0,    0,    0,    7,    0,
+        0,  124,  119,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   44,    0,
-        0,    0,    0,    0,    0,    0,   52,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   76,
-       53,    0,    0,    0,   22,    0,    0,    0,    0,    0,
-        0,    0,    0,   29,    0,    0,    0,    0,    0,    0,
+        0,   61,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   66,    0,    0,    0,    0,   47,    0,    0,    0,
+        0,    0,    0,    0,   55,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   36,    0,    0,    0,    0,    0,  114,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   66,    0,    0,    0,    0,    0,
+       87,   59,    0,    0,    0,    0,   22,   65,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,    0,   29,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   27,    0,    0,    0,   20,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   57,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   39,
+        0,    0,    0,    0,    0,  127,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   64,    0,    0,    0,    0,    0,   88,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   45,    0,    0,    0,    0,    0,    0,
+        0,    0,   77,    0,    0,    0,   68,    0,    0,    0,
+       32,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   27,    0,    0,    0,    0,
+        0,   20,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,   63,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   75,    0,
+        0,    0,    0,    0,  100,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   48,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       93,    0,    0,   91,    0,    0,    0,    0,    0,    0,
-
-        0,  117,    0,    0,    0,    0,    0,   65,    0,    0,
-        0,   68,   56,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   63,    0,   17,    0,
-       73,    0,    0,    0,    0,    0,   97,    0,    0,    0,
-       37,    0,    0,    0,   75,   24,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  105,    0,    0,  103,    0,    0,    0,    0,    0,
+        0,    0,  130,    0,    0,    0,    0,    0,   76,    0,
+        0,    0,   79,   62,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,   74,    0,
+       17,    0,   84,    0,    0,    0,    0,    0,    0,  109,
+        0,    0,    0,   40,    0,    0,    0,    0,    0,   86,
+       24,    0,   57,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   81,    0,   31,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   70,    0,    0,    0,
+        0,  133,   41,    0,    0,    0,    0,    0,    0,    0,
+       64,    0,    0,    0,   36,    0,    0,    0,  106,    0,
+
+      104,   99,   98,    0,    0,    0,    0,    0,  120,    0,
+        0,    0,   70,    0,    0,    0,    0,    0,   95,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   49,    0,
+        0,   33,   30,    0,    0,    0,    0,  108,    0,    0,
+        0,    0,    0,    0,   51,   37,    0,   80,    0,    0,
+       72,    0,    0,   46,    0,  128,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  120,   38,    0,    0,    0,    0,    0,    0,
-
-        0,    0,   33,    0,    0,    0,   94,    0,   92,   87,
-       86,    0,    0,    0,    0,    0,  107,    0,    0,    0,
-       59,    0,    0,    0,    0,    0,   84,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   46,    0,    0,   30,
-        0,    0,    0,    0,   96,    0,    0,    0,    0,   48,
-       34,    0,   69,    0,    0,   61,    0,    0,   43,    0,
-      115,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  135,   69,    0,
+
+       97,    0,    0,  131,  101,    0,    0,    0,    0,    0,
+        0,   19,    0,   18,    0,  107,    0,    0,   60,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   35,
+        0,    0,    0,    0,   34,    0,    0,    0,    0,    0,
+        0,   85,    0,    0,  132,    0,    0,   58,    0,    0,
+       96,    0,    0,    0,    0,  134,    0,  129,  125,    0,
+        0,    0,   14,    0,    0,  115,    0,    0,    0,    0,
+       93,    0,    0,    0,    0,    0,   52,    0,    0,    0,
+        0,    0,    0,    0,    0,   13,    0,    0,    0,  102,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-      122,   58,    0,   85,    0,    0,  118,   89,    0,    0,
-        0,    0,    0,    0,   19,    0,   18,    0,   95,    0,
-        0,   54,    0,    0,    0,    0,    0,    0,    0,    0,
-       32,    0,    0,    0,    0,   31,    0,    0,    0,    0,
-        0,    0,   74,    0,    0,  119,    0,    0,    0,    0,
-        0,    0,    0,    0,  121,    0,  116,  112,    0,    0,
-        0,   14,    0,    0,  103,    0,    0,    0,    0,   82,
-        0,    0,    0,    0,    0,   49,    0,    0,    0,    0,
-        0,    0,    0,    0,   13,    0,    0,    0,   90,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   81,
-
-        0,  100,    0,    0,    0,   99,   98,    0,    0,    0,
-       80,    0,    0,    0,  102,    0,    0,    0,    0,    0,
+       92,    0,  112,    0,    0,    0,  111,  110,    0,    0,
+        0,   91,    0,    0,    0,  114,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  101,    0,    0,    0,    0,    0,
-        0,   78,   83,   35,    0,    0,    0,   77,    0,    0,
-        0,    0,    0,    0,    0,   51,    0,    0,   79,    0
+        0,    0,    0,    0,    0,  113,    0,    0,    0,    0,
+        0,    0,   89,   94,   38,    0,    0,    0,   88,    0,
+        0,    0,    0,    0,    0,    0,   54,    0,    0,   90,
+        0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -673,13 +685,13 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,   27,    5,   28,    5,   29,    5,   30,   31,   32,
-        5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
-       40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
+        5,   27,   28,   29,    5,   30,    5,   31,   32,   33,
+        5,   34,   35,   36,   37,   38,   39,    5,   40,    5,
+       41,   42,   43,    5,   44,    5,   45,   46,   47,   48,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+       59,   60,   61,   62,   63,   64,   65,   66,   67,   68,
+       69,   70,   71,    5,   72,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -696,482 +708,516 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[73] =
     {   0,
         1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
         3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
         5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
+        3,    3,    3,    3,    5,    5,    5,    5,    5,    5,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        3,    3
     } ;
 
-static const flex_int16_t yy_base[1173] =
+static const flex_int16_t yy_base[1274] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1523, 1524,   32, 1519,  141,    0,  201, 1524,  206,   88,
-       11,  213, 1524, 1501,  114,   25,    2,    6, 1524, 1524,
-       73,   11,   17, 1524, 1524, 1524,  104, 1507, 1462,    0,
-     1499,  107, 1514,  217,  247, 1524, 1458,  185, 1464,   93,
-       58, 1456,   91,  209,  200,   14,  273,  190, 1455,  181,
-      186,  189,  223, 1464,   66,  206,  232,  204,  294,  256,
-      216, 1447,   78,  268,  300,  300, 1466,    0,  329,  344,
-      356,  364,  359, 1524,    0, 1524,  273,  335,  300,  335,
-      289,  353,  354,  299, 1524, 1463, 1502, 1524,  260, 1524,
-
-      375, 1491,  328, 1460,  356,  355, 1455,  350,  359,  357,
-      363,  371, 1498,    0,  426,  359, 1442, 1444, 1440, 1448,
-       74, 1444, 1433, 1434,   89, 1450, 1443, 1443,  213, 1434,
-     1428, 1434,  343, 1479, 1483, 1425, 1476, 1442, 1439, 1439,
-     1433,  336, 1426, 1419, 1424, 1418,  363, 1415, 1414, 1428,
-      365, 1414,  344, 1430,  351,  399,  372, 1427, 1428, 1426,
-     1408, 1410,  372, 1402, 1419, 1411,    0,  400,  424,  398,
-      401,  426,  432, 1410, 1524,    0, 1453,  438, 1404,  426,
-      434, 1412,  441, 1455,  442, 1454,  435, 1453, 1524,  479,
-     1400,  455, 1413, 1393, 1409, 1406, 1405,  420, 1446, 1440,
-
-     1406, 1385, 1393, 1388, 1399, 1387, 1399, 1399, 1390, 1379,
-     1392, 1392, 1384, 1374, 1392, 1524, 1387, 1390, 1371, 1421,
-     1370, 1380, 1383, 1417, 1378, 1366, 1377, 1413, 1360, 1370,
-     1362, 1359, 1375, 1356, 1355, 1361, 1352, 1359, 1361, 1406,
-     1364, 1358,  273, 1365, 1360, 1352, 1358, 1358, 1339, 1355,
-     1348, 1355, 1343, 1336, 1350, 1391, 1352, 1334, 1342,  459,
-     1524, 1524,  460, 1524, 1524, 1329,    0,  416,  430,  494,
-      471, 1386, 1339,  453, 1524, 1384, 1524, 1378,  515, 1322,
-      448, 1319, 1375, 1321, 1327, 1377, 1334, 1320, 1524, 1331,
-     1373, 1328, 1325,  500, 1370, 1364, 1319, 1314, 1311, 1320,
-
-     1309, 1358, 1306,  511, 1320, 1305, 1318, 1316, 1311, 1318,
-     1313, 1309,  452, 1307, 1303, 1351,  483, 1345, 1297, 1290,
-     1292, 1296, 1285, 1298,  491, 1299, 1296, 1300, 1524, 1288,
-     1288, 1300, 1282, 1274, 1275, 1296, 1278, 1290, 1289, 1275,
-     1287, 1286, 1285, 1326, 1325, 1524, 1269,  537, 1282, 1524,
-     1524, 1281,    0, 1270, 1262,  472, 1319, 1318, 1276, 1316,
-     1524, 1264, 1314, 1524,  515,  561, 1308,  487, 1312, 1268,
-     1264, 1252, 1524, 1268, 1255, 1254, 1524, 1256, 1253,  473,
-     1251, 1524, 1262, 1259, 1244, 1257, 1293, 1259, 1241, 1290,
-     1524, 1239, 1255, 1287, 1250, 1247, 1248, 1283, 1236, 1231,
-
-     1230, 1279, 1225, 1240, 1232, 1280, 1524, 1227, 1223, 1221,
-     1225, 1218, 1228, 1231, 1220, 1215, 1524, 1270, 1214, 1225,
-     1262, 1215, 1224, 1218, 1222, 1262, 1256, 1220, 1200, 1203,
-     1202, 1210, 1198, 1254, 1196, 1524, 1524, 1201, 1524, 1211,
-     1245, 1207,    0, 1191, 1208, 1246, 1524, 1524, 1194, 1524,
-     1200, 1524,  513,  517, 1203,  540, 1524, 1196, 1184, 1235,
-     1182, 1189, 1182, 1194, 1193, 1193, 1181, 1222, 1182, 1225,
-     1171, 1187, 1172, 1169, 1183, 1175, 1181, 1172, 1180, 1165,
-     1181, 1163, 1176, 1159, 1153, 1158, 1173, 1170, 1171, 1168,
-     1524, 1154, 1156, 1165, 1201,  527, 1164, 1147, 1148, 1145,
-
-     1524, 1159, 1138, 1159, 1149, 1192, 1146, 1190, 1524, 1137,
-     1151, 1154, 1186, 1185, 1132, 1183, 1524,   14, 1145, 1134,
-     1136, 1524, 1142, 1132, 1524, 1126, 1181,  517,  531, 1131,
-     1133, 1129, 1172,  542, 1171, 1170, 1124, 1114, 1167, 1120,
-     1130, 1164, 1122, 1109, 1117, 1160, 1122, 1121, 1122, 1115,
-     1104, 1117, 1120, 1115, 1116, 1113, 1116, 1111, 1152, 1151,
-     1101, 1091, 1099, 1147, 1096, 1088, 1089, 1102, 1524, 1090,
-     1099, 1098, 1098, 1138, 1081, 1090, 1083, 1072, 1076, 1127,
-     1074, 1084, 1124, 1071,  506,  538, 1065,  535, 1524, 1126,
-     1084, 1073, 1077, 1067, 1079, 1120, 1524, 1114,  533, 1072,
-
-     1066, 1074, 1069, 1065, 1072, 1055, 1055, 1072, 1067, 1055,
-     1051, 1058, 1052, 1062, 1050, 1064, 1052, 1060, 1058, 1049,
-     1058, 1054, 1095, 1037, 1037, 1050, 1035, 1033, 1034, 1524,
-     1524, 1042, 1045, 1048, 1524, 1047, 1032, 1024,  552, 1029,
-     1076, 1025, 1079, 1524, 1024, 1026, 1026, 1075, 1028, 1016,
-     1010, 1021, 1030, 1023, 1015, 1015, 1014, 1012, 1012, 1063,
-     1024,  999, 1524, 1055, 1002, 1015, 1014,  999, 1524,  522,
-      566, 1013, 1014, 1048, 1011, 1013, 1050, 1003,  996,  990,
-      997,  990, 1044, 1001,  990,  990,  999,  982,  996,  988,
-     1031,  997,  979,  978, 1524,  994,  975,  593,  974,  991,
-
-      969,  985, 1021,  979,  967,  983,  980,  964,  977,  962,
-      295,    6, 1524,   83,  219,  261, 1524,  283,  503,  498,
-      518,  514,  535,  595,  541,  541,  605,  551, 1524,  557,
-      556,  555,  569,  570,  575,  614,  588,  593,  565,  569,
-      568,  620,  565, 1524,  572,  583,  624,  625,  574, 1524,
-      570,  573,  572,  592,  589,  594,  595,  581,  589,  598,
-      578,  599,  639, 1524,  594,  641,  642,  606,  609,  597,
-      594,  601,  652,  601,  599,  617,  656,  611,  609,  607,
-      660,  661,  657,  617,  622,  615,  624,  612,  622,  618,
-     1524,  613,  614, 1524,  615,  631,  632,  633,  615,  620,
-
-      638, 1524,  660,  651,  624,  624,  645, 1524,  628,  643,
-      638, 1524, 1524,  648,  683,  632,  685,  634,  692,  637,
-      648,  640,  646,  642,  660,  661, 1524,  659, 1524,  661,
-     1524,  665,  655,  648,  660,  702, 1524,  660,  710,  711,
-     1524,  660,  667,  709, 1524, 1524,  659,  659,  662,  676,
-      663,  720,  679,  717,  723,  673,  725,  726,  727,  688,
-      672,  684,  689,  704,  733,  729,  694,  686,  737,  686,
-      697,  702,  684,  742,  697,  702, 1524,  703,  696,  705,
-      706,  703,  693,  695,  752,  701,  698,  755,  751,  694,
-      709,  759, 1524, 1524,  710,  720,  705,  706,  765,  767,
-
-      713,  769, 1524,  719,  721,  772, 1524,  736, 1524, 1524,
-     1524,  726,  776,  727,  778,  761, 1524,  723,  740,  742,
-     1524,  729,  728,  730,  731,  727, 1524,  749,  735,  736,
-      751,  751,  754,  754,  751,  756, 1524,  748,  758, 1524,
-      755,  760,  762,  759, 1524,  750,  756,  755,  766, 1524,
-     1524,  805, 1524,  754,  760, 1524,  763,  776, 1524,  773,
-     1524,  770,  793,  765,  814,  820,  821,  765,  823,  778,
-      772,  826,  827,  823,  788,  784,  826,  776,  781,  834,
-      792,  836,  796,  838,  801,  790,  841,  785,  802,  802,
-      786,  842,  807,  807,  804,  851,  811,  824,  813,  812,
-
-     1524, 1524,  856, 1524,  805,  816, 1524, 1524,  806,  855,
-      800,  805,  863,  813, 1524,  819, 1524,  866, 1524,  811,
-      826, 1524,  864,  832,  825,  834,  822,  832,  875,  826,
-     1524,  877,  878,  841,  826, 1524,  831,  883,  829,  828,
-      886,  841, 1524,  883,  845, 1524,  848,  891,  834,  836,
-      833,  849,  858,  897, 1524,  893, 1524, 1524,  842,  859,
-      896, 1524,  850,  857, 1524,  854,  859,  906,  851, 1524,
-      855,  867,  910,  854,  862, 1524,  873,  872,  864,  863,
-      877,  868,  877,  879, 1524,  921,  881,  923, 1524,  919,
-      883,  864,  927,  928,  887,  888,  889,  932,  891, 1524,
-
-      896, 1524,  878,  936,  897, 1524, 1524,  883,  883,  885,
-     1524,  890,  885,  897, 1524,  895,  899,  890,  942,  891,
-      907,  900,  909,  900,  907,  894,  909,  956,  915,  902,
-      918,  909,  923,  919, 1524,  963,  964,  965,  922,  921,
-      922, 1524, 1524, 1524,  969,  913,  929, 1524,  967,  918,
-      917,  919,  930,  977,  928, 1524,  937,  980, 1524, 1524,
-      986,  991,  996, 1001, 1006, 1011, 1016, 1019,  993,  998,
-     1000, 1013
+        0,   71,   19,   26,   42,   50,   36,   53,   59,   88,
+     1633, 1634,   31, 1629,  143,    0,  204, 1634,  209,   51,
+       11,  216, 1634, 1611,   90,   48,   33,   60, 1634, 1634,
+       88,   73,   77, 1634, 1634, 1634,  111, 1617, 1571,    0,
+     1609,  114, 1624,   26,  251, 1634, 1567,  187,  194, 1573,
+       96,  191, 1565,  202,  212,  209,  209,  278,  207,  236,
+       71,  203,  192,  285, 1574,   64,  271,  273,  193,  300,
+      286,  234, 1557,    2,  299,  316,  309, 1576,    0,  346,
+      354,  366,  372,  375, 1634,    0, 1634,  339,  378,  215,
+      343,  337,  353,  366,  339, 1634, 1573, 1613, 1634,  234,
+
+     1634,  392, 1602,  362,  236, 1570,  376,  376, 1565,  373,
+      377,  375,  381,  382, 1609,    0,  444,  377, 1552, 1544,
+     1553, 1549, 1557,   78, 1553, 1542, 1543,  239, 1559, 1552,
+     1552,  290, 1543, 1546, 1536, 1542,  364, 1588, 1592, 1533,
+     1585, 1550, 1547, 1547, 1541,  383,   62, 1528, 1533, 1527,
+      380, 1524, 1523, 1537,  414, 1523,  354,  370,  385,  439,
+     1527,  413, 1536, 1537, 1535, 1517, 1519,  393, 1511, 1528,
+     1520,    0,  401,  425,  438,  437,  432,  449, 1519, 1634,
+        0, 1563,  459,  461, 1513,  438,  447, 1521,  458, 1565,
+      471, 1564,  472, 1563, 1634,  517, 1509,  489, 1522, 1508,
+
+     1501, 1517, 1514, 1513,  263, 1555, 1549, 1514, 1493, 1501,
+     1496, 1507, 1495, 1507, 1507, 1498, 1501, 1486, 1499, 1499,
+     1491, 1481, 1499, 1634, 1494, 1497, 1478, 1529, 1477, 1487,
+     1477, 1489, 1524, 1484, 1470, 1471, 1482, 1519, 1465, 1475,
+     1467, 1464, 1470, 1479, 1460, 1459, 1465, 1456, 1463, 1453,
+     1464, 1467, 1509, 1466, 1460,   81, 1467, 1462, 1454, 1460,
+     1448, 1459, 1440, 1456, 1449, 1456, 1444, 1437, 1451, 1493,
+     1453, 1435, 1443,  486, 1634, 1634,  487, 1634, 1634, 1430,
+        0,  455,  209,  475,  498,  496, 1488, 1440,  482, 1634,
+     1486, 1634, 1480,  554, 1423,  477, 1420, 1441, 1476, 1421,
+
+     1427, 1478, 1434, 1420, 1634, 1431, 1474, 1428, 1425,  504,
+     1471, 1465, 1419, 1414, 1411, 1461, 1419, 1408, 1458, 1405,
+      547, 1419, 1404, 1417, 1415,  470, 1418, 1413, 1412, 1408,
+      463, 1406, 1413, 1401, 1450,  497, 1444, 1395, 1388,  194,
+     1403, 1394, 1383, 1396,  520, 1397, 1394, 1397, 1397,  419,
+     1634, 1385, 1385, 1397, 1379, 1371, 1372, 1393, 1375, 1380,
+     1386, 1385, 1371, 1383, 1382, 1381, 1423, 1422, 1634, 1365,
+      543, 1378, 1634, 1634, 1377,    0, 1366, 1358,  493,  512,
+     1416, 1415, 1372, 1413, 1634, 1360, 1411, 1634,  528,  597,
+     1405,  552, 1409, 1408, 1363, 1359, 1347, 1634, 1363, 1350,
+
+     1349, 1634, 1351, 1348,  526, 1346, 1634, 1357, 1354, 1339,
+     1352, 1350, 1388, 1353, 1335, 1385, 1634, 1333, 1349, 1382,
+     1344,  505, 1343, 1379, 1331, 1329, 1325, 1324, 1337, 1373,
+     1318, 1333, 1325, 1329, 1373, 1634, 1319, 1315, 1313, 1317,
+     1310, 1317, 1319, 1307, 1321, 1310, 1305, 1634, 1361, 1304,
+     1315, 1353, 1352, 1634, 1306, 1303, 1312, 1306, 1310, 1351,
+     1345, 1308, 1288, 1304, 1290, 1289, 1297, 1285, 1342, 1283,
+     1634, 1634, 1288, 1634, 1298, 1333, 1294,    0, 1278, 1295,
+     1334, 1333, 1634, 1634, 1280, 1634, 1286, 1634,  550,  562,
+     1289,  579, 1634, 1634, 1282, 1270, 1322, 1268, 1275, 1268,
+
+     1280, 1279, 1279, 1267, 1309, 1268, 1312, 1257, 1273, 1261,
+     1257, 1254, 1268, 1260, 1266, 1257, 1265, 1250, 1266, 1265,
+     1247, 1260, 1243, 1258, 1236, 1241, 1292, 1255, 1252, 1253,
+     1250, 1249, 1634, 1235, 1237, 1246, 1283,  554, 1234, 1244,
+     1280, 1226, 1227, 1224, 1634, 1238, 1217, 1222, 1237, 1230,
+     1226, 1270, 1223, 1268, 1634, 1214, 1228, 1231, 1269, 1263,
+     1262, 1208, 1260, 1634,  578, 1221, 1210, 1212, 1634, 1218,
+     1208, 1634, 1634, 1202, 1258,  561,  523, 1207, 1209, 1205,
+     1249,  561, 1248, 1247, 1200, 1190, 1244, 1196, 1206, 1241,
+     1198, 1185, 1193, 1237, 1185, 1197, 1196, 1197, 1190, 1179,
+
+     1192, 1195, 1190, 1191, 1181, 1187, 1190, 1185, 1184, 1226,
+     1225, 1167, 1173, 1163, 1171, 1220, 1219, 1167, 1159, 1160,
+     1173, 1634, 1161, 1152, 1169, 1153, 1167, 1167, 1208, 1150,
+     1159, 1158, 1151, 1152, 1139, 1143, 1195, 1141, 1151, 1192,
+     1138, 1634,  573,  575, 1132,  572, 1634, 1194, 1151, 1140,
+     1144, 1134, 1146, 1188, 1634, 1182,  571, 1139, 1133, 1141,
+     1136, 1132, 1139, 1122, 1122, 1139, 1134, 1122, 1118, 1125,
+     1119, 1129, 1117, 1131, 1119, 1117, 1126, 1124, 1115, 1124,
+     1120, 1162, 1103, 1103, 1116, 1158, 1100, 1098, 1099, 1154,
+     1634, 1634, 1095, 1105, 1108, 1111, 1634, 1634, 1110, 1095,
+
+     1087,  546, 1092, 1140, 1139, 1096, 1086, 1141, 1634, 1085,
+     1087, 1074, 1086, 1089, 1135, 1087, 1075, 1069, 1080, 1089,
+     1082,    0,   69,  233,  274,  297,  422,  484,  481, 1634,
+      540,  509,  542,  544,  543, 1634,  596,  591,  568,  584,
+      621,  589,  593,  633,  588,  589,  585,  594,  589,  646,
+      604,  595,  597,  609,  594,  610,  615,  605,  651,  618,
+      602,  603, 1634,  621,  604,  662, 1634,  606,  625,  605,
+     1634,  613,  625,  664,  623,  613,  631,  630,  616,  631,
+      618,  623,  637,  628,  623, 1634,  631,  637,  640,  633,
+      627, 1634,  635,  640,  634,  647,  641,  639,  693,  638,
+
+      638,  696,  641, 1634,  647,  645,  644,  658,  659,  664,
+      704,  677,  682,  654,  658,  657,  710,  654, 1634,  661,
+      672,  714,  715,  663, 1634,  659,  662,  662,  682,  679,
+      684,  666,  686,  672,  680,  689,  669,  690,  731, 1634,
+      685,  735,  736,  697,  699,  683,  689,  685,  692,  744,
+      692,  690,  708,  748,  702,  697,  701,  699,  710,  754,
+      755,  751,  757,  711,  702,  717,  710,  719,  707,  717,
+      713, 1634,  708,  709, 1634,  710,  726,  727,  728,  710,
+      715,  733, 1634,  756,  746,  719,  719,  740, 1634,  723,
+      738,  733, 1634, 1634,  743,  779,  727,  781,  729,  788,
+
+      732,  790,  744,  736,  742,  738,  756,  757, 1634,  755,
+     1634,  757, 1634,  761,  751,  759,  745,  758,  801, 1634,
+      757,  808,  809, 1634,  757,  761,  765,  808,  764, 1634,
+     1634,  758, 1634,  758,  817,  762,  776,  763,  821,  779,
+      818,  824,  773,  826,  827,  828,  788,  772,  784,  789,
+      804,  834,  830,  794,  786,  838,  786,  797,  802,  784,
+      843,  797,  802, 1634,  803, 1634,  796,  805,  806,  803,
+      793,  795,  853,  801,  798,  856,  857,  853,  795,  810,
+      862, 1634, 1634,  811,  817,  822,  807,  820,  810,  870,
+     1634,  871,  816,  873, 1634,  822,  825,  877, 1634,  839,
+
+     1634, 1634, 1634,  829,  880,  831,  883,  865, 1634,  826,
+      843,  844, 1634,  832,  831,  833,  834,  830, 1634,  852,
+      838,  839,  854,  854,  857,  857,  854,  859, 1634,  851,
+      861, 1634, 1634,  858,  863,  864,  862, 1634,  853,  870,
+      860,  859,  862,  871, 1634, 1634,  911, 1634,  859,  865,
+     1634,  868,  881, 1634,  878, 1634,  875,  898,  870,  920,
+      926,  927,  870,  929,  883,  877,  932,  933,  929,  893,
+      889,  932,  881,  886,  940,  897,  942,  901,  944,  906,
+      895,  947,  885,  891,  909,  909,  909,  893,  950,  914,
+      914,  911,  959,  918,  931,  920,  919, 1634, 1634,  964,
+
+     1634,  912,  923, 1634, 1634,  913,  963,  907,  912,  971,
+      920, 1634,  926, 1634,  974, 1634,  918,  933, 1634,  977,
+      973,  940,  980,  934,  943,  931,  941,  985,  935, 1634,
+      987,  988,  951,  936, 1634,  940,  993,  938,  937,  996,
+      950, 1634,  993,  954, 1634,  957, 1001, 1634,  943,  945,
+     1634,  942,  958,  967, 1007, 1634, 1003, 1634, 1634,  951,
+      968, 1006, 1634,  959,  966, 1634,  963,  968, 1016,  960,
+     1634,  964,  976, 1020,  963,  971, 1634,  982,  981,  973,
+      972,  986,  977,  986,  988, 1634, 1031,  990, 1033, 1634,
+     1029,  992,  973, 1037, 1038,  996,  997,  998, 1042, 1000,
+
+     1634, 1005, 1634,  987, 1046, 1006, 1634, 1634,  992,  992,
+      994, 1634,  999,  994, 1006, 1634, 1004, 1008,  999, 1052,
+     1000, 1016, 1009, 1018, 1009, 1016, 1003, 1018, 1066, 1024,
+     1011, 1027, 1018, 1032, 1028, 1634, 1073, 1074, 1075, 1031,
+     1030, 1031, 1634, 1634, 1634, 1079, 1022, 1038, 1634, 1077,
+     1027, 1026, 1028, 1039, 1087, 1037, 1634, 1046, 1090, 1634,
+     1634, 1096, 1101, 1106, 1111, 1116, 1121, 1126, 1129, 1103,
+     1108, 1110, 1123
     } ;
 
-static const flex_int16_t yy_def[1173] =
+static const flex_int16_t yy_def[1274] =
     {   0,
-     1161, 1161, 1162, 1162, 1161, 1161, 1161, 1161, 1161, 1161,
-     1160, 1160, 1160, 1160, 1160, 1163, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1164,
-     1160, 1160, 1160, 1165,   15, 1160,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1166,   45,   45,   45,
+     1262, 1262, 1263, 1263, 1262, 1262, 1262, 1262, 1262, 1262,
+     1261, 1261, 1261, 1261, 1261, 1264, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1265,
+     1261, 1261, 1261, 1266,   15, 1261,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1267,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1163, 1160, 1160,
-     1160, 1160, 1160, 1160, 1167, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1164, 1160, 1165, 1160,
+       45,   45,   45,   45,   45,   45,   45,   45, 1264, 1261,
+     1261, 1261, 1261, 1261, 1261, 1268, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1265, 1261, 1266,
 
-     1160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1168,   45, 1166,   45,   45,   45,   45,   45,
+     1261, 1261,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1269,   45, 1267,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1167, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1169,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1168, 1160, 1166,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1268, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1270,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1269, 1261, 1267,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1160,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1261,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1170,   45,   45,   45,
-       45,   45,   45,   45, 1160,   45, 1160,   45, 1166,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1271,   45,   45,   45,   45,   45,   45,   45,   45, 1261,
+       45, 1261,   45, 1267,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45, 1261,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1160,   45,   45,   45, 1160,
-     1160, 1160, 1171,   45,   45,   45,   45,   45,   45,   45,
-     1160,   45,   45, 1160,   45, 1166,   45,   45,   45,   45,
-       45,   45, 1160,   45,   45,   45, 1160,   45,   45,   45,
-       45, 1160,   45,   45,   45,   45,   45,   45,   45,   45,
-     1160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1160, 1160,   45, 1160,   45,
-       45, 1160, 1172,   45,   45,   45, 1160, 1160,   45, 1160,
-       45, 1160,   45,   45,   45,   45, 1160,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1261,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1261,   45,
+       45,   45, 1261, 1261, 1261, 1272,   45,   45,   45,   45,
+       45,   45,   45,   45, 1261,   45,   45, 1261,   45, 1267,
+       45,   45,   45,   45,   45,   45,   45, 1261,   45,   45,
+
+       45, 1261,   45,   45,   45,   45, 1261,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1261,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1261,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1261,   45,   45,
+       45,   45,   45, 1261,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1261, 1261,   45, 1261,   45,   45, 1261, 1273,   45,   45,
+       45,   45, 1261, 1261,   45, 1261,   45, 1261,   45,   45,
+       45,   45, 1261, 1261,   45,   45,   45,   45,   45,   45,
 
-     1160,   45,   45,   45,   45,   45,   45,   45, 1160,   45,
-       45,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
-       45, 1160,   45,   45, 1160,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1160,   45,
+       45,   45, 1261,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1261,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1261,   45,   45,   45,   45,   45,
+       45,   45,   45, 1261,   45,   45,   45,   45, 1261,   45,
+       45, 1261, 1261,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1160,   45,
-       45,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1160,
-     1160,   45,   45,   45, 1160,   45,   45,   45,   45,   45,
-       45,   45,   45, 1160,   45,   45,   45,   45,   45,   45,
+       45, 1261,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1160,   45,   45,   45,   45,   45, 1160,   45,
+       45, 1261,   45,   45,   45,   45, 1261,   45,   45,   45,
+       45,   45,   45,   45, 1261,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1160,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1261, 1261,   45,   45,   45,   45, 1261, 1261,   45,   45,
 
+       45,   45,   45,   45,   45,   45,   45,   45, 1261,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1160,   45,   45,   45, 1160,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1160,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1261,
+       45,   45,   45,   45,   45, 1261,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1160,   45,   45,   45,   45,   45, 1160,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1160,   45,   45,   45,   45,   45,   45,
+       45,   45, 1261,   45,   45,   45, 1261,   45,   45,   45,
+     1261,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1261,   45,   45,   45,   45,
+       45, 1261,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45, 1261,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1261,   45,
+       45,   45,   45,   45, 1261,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1261,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1160,   45,   45, 1160,   45,   45,   45,   45,   45,   45,
-
-       45, 1160,   45,   45,   45,   45,   45, 1160,   45,   45,
-       45, 1160, 1160,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1160,   45, 1160,   45,
-     1160,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
-     1160,   45,   45,   45, 1160, 1160,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1261,   45,   45, 1261,   45,   45,   45,   45,   45,
+       45,   45, 1261,   45,   45,   45,   45,   45, 1261,   45,
+       45,   45, 1261, 1261,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45, 1261,   45,
+     1261,   45, 1261,   45,   45,   45,   45,   45,   45, 1261,
+       45,   45,   45, 1261,   45,   45,   45,   45,   45, 1261,
+     1261,   45, 1261,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
+       45,   45,   45, 1261,   45, 1261,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1160, 1160,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 1160,   45,   45,   45, 1160,   45, 1160, 1160,
-     1160,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
-     1160,   45,   45,   45,   45,   45, 1160,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1160,   45,   45, 1160,
-       45,   45,   45,   45, 1160,   45,   45,   45,   45, 1160,
-     1160,   45, 1160,   45,   45, 1160,   45,   45, 1160,   45,
-     1160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1261, 1261,   45,   45,   45,   45,   45,   45,   45,
+     1261,   45,   45,   45, 1261,   45,   45,   45, 1261,   45,
+
+     1261, 1261, 1261,   45,   45,   45,   45,   45, 1261,   45,
+       45,   45, 1261,   45,   45,   45,   45,   45, 1261,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1261,   45,
+       45, 1261, 1261,   45,   45,   45,   45, 1261,   45,   45,
+       45,   45,   45,   45, 1261, 1261,   45, 1261,   45,   45,
+     1261,   45,   45, 1261,   45, 1261,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1261, 1261,   45,
+
+     1261,   45,   45, 1261, 1261,   45,   45,   45,   45,   45,
+       45, 1261,   45, 1261,   45, 1261,   45,   45, 1261,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1261,
+       45,   45,   45,   45, 1261,   45,   45,   45,   45,   45,
+       45, 1261,   45,   45, 1261,   45,   45, 1261,   45,   45,
+     1261,   45,   45,   45,   45, 1261,   45, 1261, 1261,   45,
+       45,   45, 1261,   45,   45, 1261,   45,   45,   45,   45,
+     1261,   45,   45,   45,   45,   45, 1261,   45,   45,   45,
+       45,   45,   45,   45,   45, 1261,   45,   45,   45, 1261,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-     1160, 1160,   45, 1160,   45,   45, 1160, 1160,   45,   45,
-       45,   45,   45,   45, 1160,   45, 1160,   45, 1160,   45,
-       45, 1160,   45,   45,   45,   45,   45,   45,   45,   45,
-     1160,   45,   45,   45,   45, 1160,   45,   45,   45,   45,
-       45,   45, 1160,   45,   45, 1160,   45,   45,   45,   45,
-       45,   45,   45,   45, 1160,   45, 1160, 1160,   45,   45,
-       45, 1160,   45,   45, 1160,   45,   45,   45,   45, 1160,
-       45,   45,   45,   45,   45, 1160,   45,   45,   45,   45,
-       45,   45,   45,   45, 1160,   45,   45,   45, 1160,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1160,
-
-       45, 1160,   45,   45,   45, 1160, 1160,   45,   45,   45,
-     1160,   45,   45,   45, 1160,   45,   45,   45,   45,   45,
+     1261,   45, 1261,   45,   45,   45, 1261, 1261,   45,   45,
+       45, 1261,   45,   45,   45, 1261,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1160,   45,   45,   45,   45,   45,
-       45, 1160, 1160, 1160,   45,   45,   45, 1160,   45,   45,
-       45,   45,   45,   45,   45, 1160,   45,   45, 1160,    0,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160
+       45,   45,   45,   45,   45, 1261,   45,   45,   45,   45,
+       45,   45, 1261, 1261, 1261,   45,   45,   45, 1261,   45,
+       45,   45,   45,   45,   45,   45, 1261,   45,   45, 1261,
+        0, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261
     } ;
 
-static const flex_int16_t yy_nxt[1596] =
+static const flex_int16_t yy_nxt[1707] =
     {   0,
-     1160,   13,   14,   13, 1160,   15,   16, 1160,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   84,  589,
-       37,   14,   37,   85,   25,   26,   38, 1160,  590,   27,
-       37,   14,   37,   42,   28,   42,   38,   90,   91,   29,
-      112,   30,   13,   14,   13,   89,   90,   25,   31,   91,
-       13,   14,   13,   13,   14,   13,   32,   40, 1160,   13,
-       14,   13,   33,   40,  112,   90,   91,  781,   89,   34,
-       35,   13,   14,   13,   93,   15,   16,   94,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  106,   39,   89,   25,   26,   13,   14,   13,   27,
-
-       39,   83,   83,   83,   28,   42,   41,   42,   42,   29,
-       42,   30,   81,  105,   41,  108,   92,   25,   31,  106,
-      197,  155,   87,  133,   87,  156,   32,   88,   88,   88,
-      198,  134,   33,  202,  203,   81,  105,  782,  108,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   47,   45,   45,   45,   45,
-       45,   48,   45,   45,   49,   45,   50,   45,   51,   52,
-       53,   45,   45,   45,   45,   54,   55,   45,   56,   45,
-       45,   57,   45,   45,   58,   59,   60,   61,   62,   63,
-       64,   65,   66,   51,   45,   67,   68,   69,   70,   71,
-
-       72,   73,   74,   75,   76,   77,   56,   45,   45,   45,
-       45,   45,   79,  103,   80,   80,   80,   79,  103,   82,
-       82,   82,  100,  111,   79,   81,   82,   82,   82,  124,
-       81,  109,  119,  125,  128,  120,  126,   81,  121,  103,
-      122,  110,  123,  105,  116,  129,  111,  142,   81,  127,
-      117,  143,  135,   81,  109,  130,  207,  101,  208,  151,
-       81,   45,  136,  152,  137,  100,  105,   45,  783,  110,
-       45,  144,   45,  153,   45,   45,   45,  131,  114,  138,
-      139,   45,   45,  140,   45,   45,   88,   88,   88,  141,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-      101,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  148,  157,  784,   45,  108,  149,
-      150,   45,  109,  111,  170,  158,  159,  332,  168,   45,
-      333,  160,  110,   45,  170,   45,  115,  145,  785,  146,
-      779,  147,   83,   83,   83,  109,  163,  161,   88,   88,
-       88,  780,  170,   81,  168,   79,  164,   80,   80,   80,
-      110,  165,  173,  169,   87,  178,   87,  162,   81,   88,
-       88,   88,   83,   83,   83,   79,   81,   82,   82,   82,
-       99,  168,  169,   81,  180,  181,  183,   99,   81,  169,
-      184,   81,  185,  178,  186,  187,  178,  212,  223,  183,
-
-      213,  236,  224,  186,  214,  237,   81,  171,  172,  239,
-      180,   81,  181,  191,  183,   99,  240,  184,  187,   99,
-      185,  186,  262,   99,  192,  233,  234,  183,  248,  229,
-      256,   99,  249,  260,  260,   99,  250,   99,  176,  190,
-      190,  190,  241,  242,  243,  262,  190,  190,  190,  190,
-      190,  190,  261,  244,  261,  245,  262,  246,  269,  271,
-      247,  260,  263,  272,  278,  274,  276,  354,  356,  190,
-      190,  190,  190,  190,  190,  269,  287,  355,  261,  265,
-      264,  269,  288,  350,  350,  363,  356,  271,  274,  276,
-      272,  278,  279,  279,  279,  360,  417,  356,  281,  279,
-
-      279,  279,  279,  279,  279,  446,  350,  351,  357,  358,
-      380,  403,  404,  363,  381,  368,  391,  359,  360,  466,
-      446,  392,  279,  279,  279,  279,  279,  279,  366,  366,
-      366,  408,  569,  446,  467,  366,  366,  366,  366,  366,
-      366,  409,  439,  528,  453,  525,  454,  440,  456,  529,
-      531,  598,  418,  737,  786,  599,  787,  655,  366,  366,
-      366,  366,  366,  366,  656,  788,  671,  393,  789,  570,
-      528,  453,  394,  454,   45,   45,   45,  529,  599,  598,
-      737,   45,   45,   45,   45,   45,   45,  604,  657,  658,
-      738,  661,  790,  605,  671,  708,  659,  662,  764,  709,
-
-      791,  792,  793,  765,   45,   45,   45,   45,   45,   45,
-      794,  795,  796,  738,  797,  798,  799,  800,  801,  802,
-      803,  805,  804,  806,  807,  808,  809,  810,  811,  812,
-      813,  814,  815,  816,  817,  818,  819,  820,  821,  822,
-      823,  824,  825,  826,  827,  828,  829,  831,  803,  804,
-      832,  830,  833,  834,  766,  835,  836,  837,  838,  839,
-      840,  841,  842,  843,  844,  845,  846,  847,  848,  849,
-      850,  851,  852,  853,  854,  855,  856,  857,  858,  859,
-      860,  861,  862,  863,  864,  865,  866,  867,  868,  869,
-      870,  871,  872,  873,  874,  875,  876,  877,  878,  879,
-
-      880,  881,  882,  883,  884,  885,  886,  864,  887,  888,
-      889,  890,  891,  865,  892,  893,  894,  895,  896,  897,
-      898,  899,  900,  901,  902,  903,  904,  905,  907,  908,
-      909,  910,  911,  912,  913,  914,  915,  916,  917,  918,
-      919,  920,  921,  923,  924,  925,  926,  927,  928,  929,
-      930,  931,  932,  933,  934,  935,  936,  937,  938,  939,
-      940,  941,  942,  943,  945,  916,  946,  947,  948,  949,
-      950,  944,  951,  952,  953,  954,  955,  956,  906,  957,
-      958,  959,  960,  961,  922,  963,  964,  965,  962,  966,
-      967,  968,  969,  970,  971,  972,  973,  974,  975,  976,
-
-      977,  978,  979,  980,  981,  982,  983,  984,  963,  985,
-      986,  987,  988,  989,  990,  991,  992,  993,  994,  995,
-      996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
-     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024,  998,
-     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
-     1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
-     1055, 1056, 1057, 1058, 1059, 1060, 1033, 1061, 1062, 1063,
-     1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073,
-
-     1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
-     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
-     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
-     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
-     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
-     1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
-     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1155, 1156, 1157, 1158, 1159,   12,   12,   12,   12,
-       12,   36,   36,   36,   36,   36,   78,  267,   78,   78,
-
-       78,   97,  353,   97,  443,   97,   99,   99,   99,   99,
-       99,  113,  113,  113,  113,  113,  167,   99,  167,  167,
-      167,  188,  188,  188,  778,  777,  776,  775,  774,  773,
-      772,  771,  770,  769,  768,  767,  763,  762,  761,  760,
-      759,  758,  757,  756,  755,  754,  753,  752,  751,  750,
-      749,  748,  747,  746,  745,  744,  743,  742,  741,  740,
-      739,  736,  735,  734,  733,  732,  731,  730,  729,  728,
-      727,  726,  725,  724,  723,  722,  721,  720,  719,  718,
-      717,  716,  715,  714,  713,  712,  711,  710,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  698,  697,  696,
-
-      695,  694,  693,  692,  691,  690,  689,  688,  687,  686,
-      685,  684,  683,  682,  681,  680,  679,  678,  677,  676,
-      675,  674,  673,  672,  670,  669,  668,  667,  666,  665,
-      664,  663,  660,  654,  653,  652,  651,  650,  649,  648,
-      647,  646,  645,  644,  643,  642,  641,  640,  639,  638,
-      637,  636,  635,  634,  633,  632,  631,  630,  629,  628,
-      627,  626,  625,  624,  623,  622,  621,  620,  619,  618,
-      617,  616,  615,  614,  613,  612,  611,  610,  609,  608,
-      607,  606,  603,  602,  601,  600,  597,  596,  595,  594,
-      593,  592,  591,  588,  587,  586,  585,  584,  583,  582,
-
-      581,  580,  579,  578,  577,  576,  575,  574,  573,  572,
-      571,  568,  567,  566,  565,  564,  563,  562,  561,  560,
-      559,  558,  557,  556,  555,  554,  553,  552,  551,  550,
-      549,  548,  547,  546,  545,  544,  543,  542,  541,  540,
-      539,  538,  537,  536,  535,  534,  533,  532,  530,  527,
-      526,  525,  524,  523,  522,  521,  520,  519,  518,  517,
-      516,  515,  514,  513,  512,  511,  510,  509,  508,  507,
-      506,  505,  504,  503,  502,  501,  500,  499,  498,  497,
-      496,  495,  494,  493,  492,  491,  490,  489,  488,  487,
-      486,  485,  484,  483,  482,  481,  480,  479,  478,  477,
-
-      476,  475,  474,  473,  472,  471,  470,  469,  468,  465,
-      464,  463,  462,  461,  460,  459,  458,  457,  455,  452,
-      451,  450,  449,  448,  447,  445,  444,  442,  441,  438,
-      437,  436,  435,  434,  433,  432,  431,  430,  429,  428,
-      427,  426,  425,  424,  423,  422,  421,  420,  419,  416,
-      415,  414,  413,  412,  411,  410,  407,  406,  405,  402,
-      401,  400,  399,  398,  397,  396,  395,  390,  389,  388,
-      387,  386,  385,  384,  383,  382,  379,  378,  377,  376,
-      375,  374,  373,  372,  371,  370,  369,  367,  365,  364,
-      362,  361,  352,  349,  348,  347,  346,  345,  344,  343,
-
-      342,  341,  340,  339,  338,  337,  336,  335,  334,  331,
-      330,  329,  328,  327,  326,  325,  324,  323,  322,  321,
-      320,  319,  318,  317,  316,  315,  314,  313,  312,  311,
-      310,  309,  308,  307,  306,  305,  304,  303,  302,  301,
-      300,  299,  298,  297,  296,  295,  294,  293,  292,  291,
-      290,  289,  286,  285,  284,  283,  282,  280,  189,  277,
-      275,  273,  270,  268,  266,  259,  258,  257,  255,  254,
-      253,  252,  251,  238,  235,  232,  231,  230,  228,  227,
-      226,  225,  222,  221,  220,  219,  218,  217,  216,  215,
-      211,  210,  209,  206,  205,  204,  201,  200,  199,  196,
-
-      195,  194,  193,  189,  182,  179,  177,  175,  174,  166,
-      154,  132,  118,  107,  104,  102,   43,   98,   96,   95,
-       86,   43, 1160,   11, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160
-
+     1261,   13,   14,   13, 1261,   15,   16, 1261,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   85, 1261,
+       37,   14,   37,   86,   25,   26,   38,   37,   14,   37,
+       27,  101,   42,   38,   42,   28, 1261,   13,   14,   13,
+       29,   40,   30,   13,   14,   13,  159, 1261,   25,   31,
+      160,   13,   14,   13,   13,   14,   13,   32,   40,  799,
+       13,   14,   13,   33,   84,   84,   84,  102,   90,   91,
+       34,   35,   13,   14,   13,   82,   15,   16,   41,   17,
+       18,   19,   20,   21,   22,   22,   22,   23,   24,   13,
+       14,   13,   90,   92,   39,   25,   26,   91,   88,   82,
+
+       88,   27,   39,   89,   89,   89,   28,   41,   90,   91,
+       92,   29,   42,   30,   42,   42,  107,   42,  234,   25,
+       31,   92,  137,  122,  235,  204,  123,  800,   32,  124,
+      138,  125,   93,  126,   33,  205,  354,   94,   95,  355,
+      107,   34,   35,   44,   44,   44,   45,   45,   46,   45,
+       45,   45,   45,   45,   45,   45,   45,   47,   45,   45,
+       45,   45,   45,   48,   49,   45,   50,   45,   51,   45,
+       45,   52,   53,   54,   45,   45,   45,   45,   55,   56,
+       45,   57,   45,   45,   58,   45,   45,   59,   60,   61,
+       62,   63,   64,   65,   66,   67,   52,   45,   68,   69,
+
+       70,   71,   72,   73,   74,   75,   76,   77,   78,   57,
+       45,   45,   45,   45,   45,   80,  104,   81,   81,   81,
+       80,  105,   83,   83,   83,  108,  110,   80,   82,   83,
+       83,   83,  113,   82,  111,  114,  104,  146,  131,  101,
+       82,  147,  104,  442,  173,  112,  105,  127,  379,  132,
+      110,  128,   82,  108,  129,  443,  113,   82,  111,  133,
+      114,  148,  118,  105,   82,   45,  184,  130,  119,  120,
+      173,   45,   45,  112,   45,  102,   45,  379,  155,   45,
+       45,   45,  156,  116,  209,  210,   45,   45,  105,   45,
+       45,  801,  157,  184,  121,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,  107,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  139,   45,
+      303,  142,  143,   45,  110,  144,  304,   45,  140,  107,
+      141,  145,  113,  802,  214,   45,  215,  134,  111,   45,
+      135,   45,  117,  161,  149,  152,  150,  162,  151,  112,
+      153,  154,   89,   89,   89,  803,  168,  163,  164,   84,
+       84,   84,  111,  165,  166,   80,  169,   81,   81,   81,
+       82,  170,  174,  175,   88,  175,   88,  112,   82,   89,
+       89,   89,  173,   80,  167,   83,   83,   83,   84,   84,
+       84,   89,   89,   89,   82,  174,   82,  100,  174,   82,
+
+      183,  175,   82,  178,  100,  186,  193,  187,  176,  190,
+      189,  191,  247,  192,  249,  183,  248,  189,  250,  220,
+       82,  177,  221,   82,  454,  192,  222,  804,  183,  455,
+      193,  186,  197,  100,  187,  274,  190,  100,  189,  191,
+      192,  100,  231,  198,  251,  189,  232,  239,  252,  100,
+      233,  253,  270,  100,  275,  100,  181,  196,  196,  196,
+      243,  275,  276,  274,  196,  196,  196,  196,  196,  196,
+      262,  274,  286,  276,  263,  244,  245,  287,  264,  283,
+      275,  284,  289,  254,  255,  256,  276,  278,  196,  196,
+      196,  196,  196,  196,  257,  291,  258,  279,  259,  277,
+
+      286,  260,  293,  283,  287,  284,  289,  377,  380,  283,
+      373,  373,  381,  382,  405,  387,  379,  378,  406,  291,
+      384,  383,  425,  431,  432,  448,  426,  481,  805,  293,
+      294,  294,  294,  296,  373,  374,  380,  294,  294,  294,
+      294,  294,  294,  387,  384,  392,  437,  657,  474,  806,
+      807,  482,  417,  475,  519,  481,  438,  418,  489,  622,
+      490,  294,  294,  294,  294,  294,  294,  390,  390,  390,
+      520,  657,  808,  503,  390,  390,  390,  390,  390,  390,
+      482,  576,  449,  647,  572,  489,  481,  490,  504,  579,
+      779,  809,  648,  810,  780,  577,  656,  623,  390,  390,
+
+      390,  390,  390,  390,  419,  738,  811,  662,  576,  420,
+       45,   45,   45,  663,  492,  813,  814,   45,   45,   45,
+       45,   45,   45,  577,  656,  722,  724,  725,  812,  728,
+      815,  816,  723,  738,  726,  729,  817,  818,  819,  813,
+      820,   45,   45,   45,   45,   45,   45,  821,  822,  823,
+      824,  825,  826,  827,  828,  812,  829,  830,  831,  832,
+      833,  834,  835,  836,  837,  838,  839,  840,  843,  844,
+      845,  846,  841,  847,  848,  849,  850,  851,  852,  853,
+      854,  855,  856,  857,  859,  860,  861,  862,  863,  864,
+      865,  866,  867,  868,  858,  869,  870,  871,  872,  873,
+
+      874,  875,  876,  877,  878,  879,  880,  881,  882,  883,
+      884,  886,  885,  887,  888,  889,  890,  891,  892,  893,
+      894,  895,  896,  897,  842,  898,  899,  900,  901,  902,
+      903,  904,  905,  906,  907,  908,  909,  910,  884,  885,
+      911,  913,  914,  915,  916,  912,  917,  918,  919,  920,
+      921,  922,  923,  924,  925,  926,  927,  928,  929,  930,
+      931,  932,  933,  934,  935,  936,  937,  938,  939,  940,
+      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
+      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
+      961,  962,  963,  964,  965,  966,  967,  968,  969,  970,
+
+      971,  972,  973,  974,  951,  975,  976,  977,  978,  952,
+      979,  980,  981,  982,  983,  984,  985,  986,  987,  988,
+      989,  990,  991,  992,  993,  994,  995,  996,  997,  999,
+     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+     1010, 1011, 1012, 1013, 1015, 1016, 1017, 1018, 1019, 1020,
+     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
+     1031, 1032, 1033, 1034, 1035, 1036, 1008, 1038, 1039, 1040,
+     1041, 1042, 1043, 1037, 1044, 1045, 1046, 1047, 1048, 1049,
+      998, 1050, 1051, 1052, 1053, 1054, 1014, 1055, 1056, 1058,
+     1059, 1060, 1061, 1057, 1062, 1063, 1064, 1065, 1066, 1067,
+
+     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+     1078, 1079, 1080, 1058, 1081, 1082, 1083, 1084, 1085, 1086,
+     1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+     1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+     1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116,
+     1117, 1118, 1119, 1120, 1121, 1095, 1122, 1123, 1124, 1125,
+     1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+     1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
+     1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
+     1156, 1157, 1158, 1159, 1132, 1160, 1161, 1162, 1163, 1164,
+
+     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
+     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+     1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
+     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
+     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+     1255, 1256, 1257, 1258, 1259, 1260,   12,   12,   12,   12,
+
+       12,   36,   36,   36,   36,   36,   79,  281,   79,   79,
+       79,   98,  376,   98,  478,   98,  100,  100,  100,  100,
+      100,  115,  115,  115,  115,  115,  172,  100,  172,  172,
+      172,  194,  194,  194,  798,  797,  796,  795,  794,  793,
+      792,  791,  790,  789,  788,  787,  786,  785,  784,  783,
+      782,  781,  778,  777,  776,  775,  774,  773,  772,  771,
+      770,  769,  768,  767,  766,  765,  764,  763,  762,  761,
+      760,  759,  758,  757,  756,  755,  754,  753,  752,  751,
+      750,  749,  748,  747,  746,  745,  744,  743,  742,  741,
+      740,  739,  737,  736,  735,  734,  733,  732,  731,  730,
+
+      727,  721,  720,  719,  718,  717,  716,  715,  714,  713,
+      712,  711,  710,  709,  708,  707,  706,  705,  704,  703,
+      702,  701,  700,  699,  698,  697,  696,  695,  694,  693,
+      692,  691,  690,  689,  688,  687,  686,  685,  684,  683,
+      682,  681,  680,  679,  678,  677,  676,  675,  674,  673,
+      672,  671,  670,  669,  668,  667,  666,  665,  664,  661,
+      660,  659,  658,  655,  654,  653,  652,  651,  650,  649,
+      646,  645,  644,  643,  642,  641,  640,  639,  638,  637,
+      636,  635,  634,  633,  632,  631,  630,  629,  628,  627,
+      626,  625,  624,  621,  620,  619,  618,  617,  616,  615,
+
+      614,  613,  612,  611,  610,  609,  608,  607,  606,  605,
+      604,  603,  602,  601,  600,  599,  598,  597,  596,  595,
+      594,  593,  592,  591,  590,  589,  588,  587,  586,  585,
+      584,  583,  582,  581,  580,  578,  575,  574,  573,  572,
+      571,  570,  569,  568,  567,  566,  565,  564,  563,  562,
+      561,  560,  559,  558,  557,  556,  555,  554,  553,  552,
+      551,  550,  549,  548,  547,  546,  545,  544,  543,  542,
+      541,  540,  539,  538,  537,  536,  535,  534,  533,  532,
+      531,  530,  529,  528,  527,  526,  525,  524,  523,  522,
+      521,  518,  517,  516,  515,  514,  513,  512,  511,  510,
+
+      509,  508,  507,  506,  505,  502,  501,  500,  499,  498,
+      497,  496,  495,  494,  493,  491,  488,  487,  486,  485,
+      484,  483,  480,  479,  477,  476,  473,  472,  471,  470,
+      469,  468,  467,  466,  465,  464,  463,  462,  461,  460,
+      459,  458,  457,  456,  453,  452,  451,  450,  447,  446,
+      445,  444,  441,  440,  439,  436,  435,  434,  433,  430,
+      429,  428,  427,  424,  423,  422,  421,  416,  415,  414,
+      413,  412,  411,  410,  409,  408,  407,  404,  403,  402,
+      401,  400,  399,  398,  397,  396,  395,  394,  393,  391,
+      389,  388,  386,  385,  375,  372,  371,  370,  369,  368,
+
+      367,  366,  365,  364,  363,  362,  361,  360,  359,  358,
+      357,  356,  353,  352,  351,  350,  349,  348,  347,  346,
+      345,  344,  343,  342,  341,  340,  339,  338,  337,  336,
+      335,  334,  333,  332,  331,  330,  329,  328,  327,  326,
+      325,  324,  323,  322,  321,  320,  319,  318,  317,  316,
+      315,  314,  313,  312,  311,  310,  309,  308,  307,  306,
+      305,  302,  301,  300,  299,  298,  297,  295,  195,  292,
+      290,  288,  285,  282,  280,  273,  272,  271,  269,  268,
+      267,  266,  265,  261,  246,  242,  241,  240,  238,  237,
+      236,  230,  229,  228,  227,  226,  225,  224,  223,  219,
+
+      218,  217,  216,  213,  212,  211,  208,  207,  206,  203,
+      202,  201,  200,  199,  195,  188,  185,  182,  180,  179,
+      171,  158,  136,  109,  106,  103,   43,   99,   97,   96,
+       87,   43, 1261,   11, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+
+     1261, 1261, 1261, 1261, 1261, 1261
     } ;
 
-static const flex_int16_t yy_chk[1596] =
+static const flex_int16_t yy_chk[1707] =
     {   0,
         0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  518,
-        3,    3,    3,   21,    1,    1,    3,    0,  518,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       56,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,    0,    8,
-        8,    8,    1,    8,   56,   27,   28,  712,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   51,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   50,   10,   53,   31,    2,    2,   51,
-      121,   73,   25,   65,   25,   73,    2,   25,   25,   25,
-      121,   65,    2,  125,  125,   20,   50,  714,   53,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,   21,    0,
+        3,    3,    3,   21,    1,    1,    3,    4,    4,    4,
+        1,   44,   13,    4,   13,    1,    0,    7,    7,    7,
+        1,    7,    1,    5,    5,    5,   74,    0,    1,    1,
+       74,    6,    6,    6,    8,    8,    8,    1,    8,  722,
+        9,    9,    9,    1,   20,   20,   20,   44,   26,   27,
+        1,    1,    2,    2,    2,   20,    2,    2,    9,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,   10,
+       10,   10,   26,   28,    5,    2,    2,   27,   25,   20,
+
+       25,    2,    6,   25,   25,   25,    2,   10,   31,   32,
+       33,    2,   37,    2,   37,   42,   51,   42,  147,    2,
+        2,   28,   66,   61,  147,  124,   61,  723,    2,   61,
+       66,   61,   31,   61,    2,  124,  256,   32,   33,  256,
+       51,    2,    2,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1179,159 +1225,171 @@ static const flex_int16_t yy_chk[1596] =
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   48,   17,   17,   17,   19,   58,   19,
-       19,   19,   44,   55,   22,   17,   22,   22,   22,   61,
-       19,   54,   60,   61,   62,   60,   61,   22,   60,   48,
-       60,   54,   60,   63,   58,   62,   55,   68,   17,   61,
-       58,   68,   66,   19,   54,   62,  129,   44,  129,   71,
-       22,   45,   66,   71,   66,   99,   63,   45,  715,   54,
-       45,   68,   45,   71,   45,   45,   45,   63,   57,   67,
-       67,   45,   45,   67,   45,   57,   87,   87,   87,   67,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       99,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   57,   70,   74,  716,   57,   69,   70,
-       70,   57,   75,   76,   91,   74,   74,  243,   89,   57,
-      243,   74,   75,   57,   94,   57,   57,   69,  718,   69,
-      711,   69,   79,   79,   79,   75,   76,   75,   88,   88,
-       88,  711,   91,   79,   89,   80,   76,   80,   80,   80,
-       75,   76,   94,   90,   81,  103,   81,   75,   80,   81,
-       81,   81,   83,   83,   83,   82,   79,   82,   82,   82,
-      101,   92,   93,   83,  105,  106,  108,  101,   82,   90,
-      109,   80,  110,  103,  111,  112,  116,  133,  142,  147,
-
-      133,  153,  142,  163,  133,  153,   83,   92,   93,  155,
-      105,   82,  106,  116,  108,  101,  155,  109,  112,  101,
-      110,  111,  170,  101,  116,  151,  151,  147,  157,  147,
-      163,  101,  157,  168,  171,  101,  157,  101,  101,  115,
-      115,  115,  156,  156,  156,  170,  115,  115,  115,  115,
-      115,  115,  169,  156,  172,  156,  173,  156,  178,  180,
-      156,  168,  171,  181,  187,  183,  185,  268,  269,  115,
-      115,  115,  115,  115,  115,  192,  198,  268,  169,  173,
-      172,  178,  198,  260,  263,  274,  281,  180,  183,  185,
-      181,  187,  190,  190,  190,  271,  325,  269,  192,  190,
-
-      190,  190,  190,  190,  190,  356,  260,  263,  270,  270,
-      294,  313,  313,  274,  294,  281,  304,  270,  271,  380,
-      368,  304,  190,  190,  190,  190,  190,  190,  279,  279,
-      279,  317,  496,  356,  380,  279,  279,  279,  279,  279,
-      279,  317,  348,  453,  365,  456,  365,  348,  368,  454,
-      456,  528,  325,  670,  719,  529,  720,  585,  279,  279,
-      279,  279,  279,  279,  585,  721,  599,  304,  722,  496,
-      453,  365,  304,  365,  366,  366,  366,  454,  529,  528,
-      670,  366,  366,  366,  366,  366,  366,  534,  586,  586,
-      671,  588,  723,  534,  599,  639,  586,  588,  698,  639,
-
-      724,  725,  726,  698,  366,  366,  366,  366,  366,  366,
-      727,  728,  730,  671,  731,  732,  733,  734,  735,  736,
-      737,  739,  738,  740,  741,  742,  743,  745,  746,  747,
-      748,  749,  751,  752,  753,  754,  755,  756,  757,  758,
-      759,  760,  761,  762,  763,  765,  766,  767,  737,  738,
-      768,  766,  769,  770,  698,  771,  772,  773,  774,  775,
-      776,  777,  778,  779,  780,  781,  782,  783,  784,  785,
-      786,  787,  788,  789,  790,  792,  793,  795,  796,  797,
-      798,  799,  800,  801,  803,  804,  805,  806,  807,  809,
-      810,  811,  814,  815,  816,  817,  818,  819,  820,  821,
-
-      822,  823,  824,  825,  826,  828,  830,  803,  832,  833,
-      834,  835,  836,  804,  838,  839,  840,  842,  843,  844,
-      847,  848,  849,  850,  851,  852,  853,  854,  855,  856,
-      857,  858,  859,  860,  861,  862,  863,  864,  865,  866,
-      867,  868,  869,  870,  871,  872,  873,  874,  875,  876,
-      878,  879,  880,  881,  882,  883,  884,  885,  886,  887,
-      888,  889,  890,  891,  892,  864,  895,  896,  897,  898,
-      899,  891,  900,  901,  902,  904,  905,  906,  854,  908,
-      912,  913,  914,  915,  869,  916,  918,  919,  915,  920,
-      922,  923,  924,  925,  926,  928,  929,  930,  931,  932,
-
-      933,  934,  935,  936,  938,  939,  941,  942,  916,  943,
-      944,  946,  947,  948,  949,  952,  954,  955,  957,  958,
-      960,  962,  963,  964,  965,  966,  967,  968,  969,  970,
-      971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
-      981,  982,  983,  984,  985,  986,  987,  988,  989,  963,
-      990,  991,  992,  993,  994,  995,  996,  997,  998,  999,
-     1000, 1003, 1005, 1006, 1009, 1010, 1011, 1012, 1013, 1014,
-     1016, 1018, 1020, 1021, 1023, 1024, 1025, 1026, 1027, 1028,
-     1029, 1030, 1032, 1033, 1034, 1035,  998, 1037, 1038, 1039,
-     1040, 1041, 1042, 1044, 1045, 1047, 1048, 1049, 1050, 1051,
-
-     1052, 1053, 1054, 1056, 1059, 1060, 1061, 1063, 1064, 1066,
-     1067, 1068, 1069, 1071, 1072, 1073, 1074, 1075, 1077, 1078,
-     1079, 1080, 1081, 1082, 1083, 1084, 1086, 1087, 1088, 1090,
-     1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1101,
-     1103, 1104, 1105, 1108, 1109, 1110, 1112, 1113, 1114, 1116,
-     1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
-     1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1136, 1137,
-     1138, 1139, 1140, 1141, 1145, 1146, 1147, 1149, 1150, 1151,
-     1152, 1153, 1154, 1155, 1157, 1158, 1161, 1161, 1161, 1161,
-     1161, 1162, 1162, 1162, 1162, 1162, 1163, 1169, 1163, 1163,
-
-     1163, 1164, 1170, 1164, 1171, 1164, 1165, 1165, 1165, 1165,
-     1165, 1166, 1166, 1166, 1166, 1166, 1167, 1172, 1167, 1167,
-     1167, 1168, 1168, 1168,  710,  709,  708,  707,  706,  705,
-      704,  703,  702,  701,  700,  699,  697,  696,  694,  693,
-      692,  691,  690,  689,  688,  687,  686,  685,  684,  683,
-      682,  681,  680,  679,  678,  677,  676,  675,  674,  673,
-      672,  668,  667,  666,  665,  664,  662,  661,  660,  659,
-      658,  657,  656,  655,  654,  653,  652,  651,  650,  649,
-      648,  647,  646,  645,  643,  642,  641,  640,  638,  637,
-      636,  634,  633,  632,  629,  628,  627,  626,  625,  624,
-
-      623,  622,  621,  620,  619,  618,  617,  616,  615,  614,
-      613,  612,  611,  610,  609,  608,  607,  606,  605,  604,
-      603,  602,  601,  600,  598,  596,  595,  594,  593,  592,
-      591,  590,  587,  584,  583,  582,  581,  580,  579,  578,
-      577,  576,  575,  574,  573,  572,  571,  570,  568,  567,
-      566,  565,  564,  563,  562,  561,  560,  559,  558,  557,
-      556,  555,  554,  553,  552,  551,  550,  549,  548,  547,
-      546,  545,  544,  543,  542,  541,  540,  539,  538,  537,
-      536,  535,  533,  532,  531,  530,  527,  526,  524,  523,
-      521,  520,  519,  516,  515,  514,  513,  512,  511,  510,
-
-      508,  507,  506,  505,  504,  503,  502,  500,  499,  498,
-      497,  495,  494,  493,  492,  490,  489,  488,  487,  486,
-      485,  484,  483,  482,  481,  480,  479,  478,  477,  476,
-      475,  474,  473,  472,  471,  470,  469,  468,  467,  466,
-      465,  464,  463,  462,  461,  460,  459,  458,  455,  451,
-      449,  446,  445,  444,  442,  441,  440,  438,  435,  434,
+       15,   15,   15,   15,   15,   17,   48,   17,   17,   17,
+       19,   49,   19,   19,   19,   52,   54,   22,   17,   22,
+       22,   22,   56,   19,   55,   57,   59,   69,   63,  100,
+       22,   69,   48,  340,   90,   55,   49,   62,  283,   63,
+       54,   62,   17,   52,   62,  340,   56,   19,   55,   63,
+       57,   69,   59,   60,   22,   45,  105,   62,   59,   59,
+       90,   45,   45,   55,   45,  100,   45,  283,   72,   45,
+       45,   45,   72,   58,  128,  128,   45,   45,   60,   45,
+       58,  724,   72,  105,   60,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   64,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   67,   58,
+      205,   68,   68,   58,   70,   68,  205,   58,   67,   64,
+       67,   68,   77,  725,  132,   58,  132,   64,   76,   58,
+       64,   58,   58,   75,   70,   71,   70,   75,   70,   76,
+       71,   71,   88,   88,   88,  726,   77,   75,   75,   80,
+       80,   80,   76,   75,   76,   81,   77,   81,   81,   81,
+       80,   77,   91,   92,   82,   95,   82,   76,   81,   82,
+       82,   82,   93,   83,   76,   83,   83,   83,   84,   84,
+       84,   89,   89,   89,   80,   94,   83,  102,   91,   84,
+
+      104,   92,   81,   95,  102,  107,  114,  108,   93,  111,
+      110,  112,  157,  113,  158,  118,  157,  151,  158,  137,
+       83,   94,  137,   84,  350,  168,  137,  727,  104,  350,
+      114,  107,  118,  102,  108,  173,  111,  102,  110,  112,
+      113,  102,  146,  118,  159,  151,  146,  151,  159,  102,
+      146,  159,  168,  102,  174,  102,  102,  117,  117,  117,
+      155,  177,  175,  173,  117,  117,  117,  117,  117,  117,
+      162,  176,  186,  178,  162,  155,  155,  187,  162,  183,
+      174,  184,  189,  160,  160,  160,  175,  177,  117,  117,
+      117,  117,  117,  117,  160,  191,  160,  178,  160,  176,
+
+      186,  160,  193,  183,  187,  184,  189,  282,  284,  198,
+      274,  277,  285,  285,  310,  289,  296,  282,  310,  191,
+      286,  285,  326,  331,  331,  345,  326,  379,  728,  193,
+      196,  196,  196,  198,  274,  277,  284,  196,  196,  196,
+      196,  196,  196,  289,  286,  296,  336,  577,  371,  729,
+      731,  380,  321,  371,  422,  379,  336,  321,  389,  538,
+      389,  196,  196,  196,  196,  196,  196,  294,  294,  294,
+      422,  577,  732,  405,  294,  294,  294,  294,  294,  294,
+      380,  489,  345,  565,  492,  389,  392,  389,  405,  492,
+      702,  733,  565,  734,  702,  490,  576,  538,  294,  294,
+
+      294,  294,  294,  294,  321,  657,  735,  582,  489,  321,
+      390,  390,  390,  582,  392,  738,  739,  390,  390,  390,
+      390,  390,  390,  490,  576,  643,  644,  644,  737,  646,
+      740,  741,  643,  657,  644,  646,  742,  743,  744,  738,
+      745,  390,  390,  390,  390,  390,  390,  746,  747,  748,
+      749,  750,  751,  752,  753,  737,  754,  755,  756,  757,
+      758,  759,  760,  761,  762,  764,  765,  766,  768,  769,
+      770,  772,  766,  773,  774,  775,  776,  777,  778,  779,
+      780,  781,  782,  783,  784,  785,  787,  788,  789,  790,
+      791,  793,  794,  795,  783,  796,  797,  798,  799,  800,
+
+      801,  802,  803,  805,  806,  807,  808,  809,  810,  811,
+      812,  814,  813,  815,  816,  817,  818,  820,  821,  822,
+      823,  824,  826,  827,  766,  828,  829,  830,  831,  832,
+      833,  834,  835,  836,  837,  838,  839,  841,  812,  813,
+      842,  843,  844,  845,  846,  842,  847,  848,  849,  850,
+      851,  852,  853,  854,  855,  856,  857,  858,  859,  860,
+      861,  862,  863,  864,  865,  866,  867,  868,  869,  870,
+      871,  873,  874,  876,  877,  878,  879,  880,  881,  882,
+      884,  885,  886,  887,  888,  890,  891,  892,  895,  896,
+      897,  898,  899,  900,  901,  902,  903,  904,  905,  906,
+
+      907,  908,  910,  912,  884,  914,  915,  916,  917,  885,
+      918,  919,  921,  922,  923,  925,  926,  927,  928,  929,
+      932,  934,  935,  936,  937,  938,  939,  940,  941,  942,
+      943,  944,  945,  946,  947,  948,  949,  950,  951,  952,
+      953,  954,  955,  956,  957,  958,  959,  960,  961,  962,
+      963,  965,  967,  968,  969,  970,  971,  972,  973,  974,
+      975,  976,  977,  978,  979,  980,  951,  981,  984,  985,
+      986,  987,  988,  980,  989,  990,  992,  993,  994,  996,
+      941,  997,  998, 1000, 1004, 1005,  956, 1006, 1007, 1008,
+     1010, 1011, 1012, 1007, 1014, 1015, 1016, 1017, 1018, 1020,
+
+     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1030, 1031,
+     1034, 1035, 1036, 1008, 1037, 1039, 1040, 1041, 1042, 1043,
+     1044, 1047, 1049, 1050, 1052, 1053, 1055, 1057, 1058, 1059,
+     1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+     1080, 1081, 1082, 1083, 1084, 1058, 1085, 1086, 1087, 1088,
+     1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1100,
+     1102, 1103, 1106, 1107, 1108, 1109, 1110, 1111, 1113, 1115,
+     1117, 1118, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127,
+     1128, 1129, 1131, 1132, 1095, 1133, 1134, 1136, 1137, 1138,
+
+     1139, 1140, 1141, 1143, 1144, 1146, 1147, 1149, 1150, 1152,
+     1153, 1154, 1155, 1157, 1160, 1161, 1162, 1164, 1165, 1167,
+     1168, 1169, 1170, 1172, 1173, 1174, 1175, 1176, 1178, 1179,
+     1180, 1181, 1182, 1183, 1184, 1185, 1187, 1188, 1189, 1191,
+     1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1202,
+     1204, 1205, 1206, 1209, 1210, 1211, 1213, 1214, 1215, 1217,
+     1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+     1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1237, 1238,
+     1239, 1240, 1241, 1242, 1246, 1247, 1248, 1250, 1251, 1252,
+     1253, 1254, 1255, 1256, 1258, 1259, 1262, 1262, 1262, 1262,
+
+     1262, 1263, 1263, 1263, 1263, 1263, 1264, 1270, 1264, 1264,
+     1264, 1265, 1271, 1265, 1272, 1265, 1266, 1266, 1266, 1266,
+     1266, 1267, 1267, 1267, 1267, 1267, 1268, 1273, 1268, 1268,
+     1268, 1269, 1269, 1269,  721,  720,  719,  718,  717,  716,
+      715,  714,  713,  712,  711,  710,  708,  707,  706,  705,
+      704,  703,  701,  700,  699,  696,  695,  694,  693,  690,
+      689,  688,  687,  686,  685,  684,  683,  682,  681,  680,
+      679,  678,  677,  676,  675,  674,  673,  672,  671,  670,
+      669,  668,  667,  666,  665,  664,  663,  662,  661,  660,
+      659,  658,  656,  654,  653,  652,  651,  650,  649,  648,
+
+      645,  641,  640,  639,  638,  637,  636,  635,  634,  633,
+      632,  631,  630,  629,  628,  627,  626,  625,  624,  623,
+      621,  620,  619,  618,  617,  616,  615,  614,  613,  612,
+      611,  610,  609,  608,  607,  606,  605,  604,  603,  602,
+      601,  600,  599,  598,  597,  596,  595,  594,  593,  592,
+      591,  590,  589,  588,  587,  586,  585,  584,  583,  581,
+      580,  579,  578,  575,  574,  571,  570,  568,  567,  566,
+      563,  562,  561,  560,  559,  558,  557,  556,  554,  553,
+      552,  551,  550,  549,  548,  547,  546,  544,  543,  542,
+      541,  540,  539,  537,  536,  535,  534,  532,  531,  530,
+
+      529,  528,  527,  526,  525,  524,  523,  522,  521,  520,
+      519,  518,  517,  516,  515,  514,  513,  512,  511,  510,
+      509,  508,  507,  506,  505,  504,  503,  502,  501,  500,
+      499,  498,  497,  496,  495,  491,  487,  485,  482,  481,
+      480,  479,  477,  476,  475,  473,  470,  469,  468,  467,
+      466,  465,  464,  463,  462,  461,  460,  459,  458,  457,
+      456,  455,  453,  452,  451,  450,  449,  447,  446,  445,
+      444,  443,  442,  441,  440,  439,  438,  437,  435,  434,
       433,  432,  431,  430,  429,  428,  427,  426,  425,  424,
-      423,  422,  421,  420,  419,  418,  416,  415,  414,  413,
-      412,  411,  410,  409,  408,  406,  405,  404,  403,  402,
-      401,  400,  399,  398,  397,  396,  395,  394,  393,  392,
-
-      390,  389,  388,  387,  386,  385,  384,  383,  381,  379,
-      378,  376,  375,  374,  372,  371,  370,  369,  367,  363,
-      362,  360,  359,  358,  357,  355,  354,  352,  349,  347,
-      345,  344,  343,  342,  341,  340,  339,  338,  337,  336,
-      335,  334,  333,  332,  331,  330,  328,  327,  326,  324,
-      323,  322,  321,  320,  319,  318,  316,  315,  314,  312,
-      311,  310,  309,  308,  307,  306,  305,  303,  302,  301,
-      300,  299,  298,  297,  296,  295,  293,  292,  291,  290,
-      288,  287,  286,  285,  284,  283,  282,  280,  278,  276,
-      273,  272,  266,  259,  258,  257,  256,  255,  254,  253,
-
-      252,  251,  250,  249,  248,  247,  246,  245,  244,  242,
-      241,  240,  239,  238,  237,  236,  235,  234,  233,  232,
-      231,  230,  229,  228,  227,  226,  225,  224,  223,  222,
-      221,  220,  219,  218,  217,  215,  214,  213,  212,  211,
-      210,  209,  208,  207,  206,  205,  204,  203,  202,  201,
-      200,  199,  197,  196,  195,  194,  193,  191,  188,  186,
-      184,  182,  179,  177,  174,  166,  165,  164,  162,  161,
-      160,  159,  158,  154,  152,  150,  149,  148,  146,  145,
-      144,  143,  141,  140,  139,  138,  137,  136,  135,  134,
-      132,  131,  130,  128,  127,  126,  124,  123,  122,  120,
-
-      119,  118,  117,  113,  107,  104,  102,   97,   96,   77,
-       72,   64,   59,   52,   49,   47,   43,   41,   39,   38,
-       24,   14,   11, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1160
-
+      423,  421,  420,  419,  418,  416,  415,  414,  413,  412,
+
+      411,  410,  409,  408,  406,  404,  403,  401,  400,  399,
+      397,  396,  395,  394,  393,  391,  387,  386,  384,  383,
+      382,  381,  378,  377,  375,  372,  370,  368,  367,  366,
+      365,  364,  363,  362,  361,  360,  359,  358,  357,  356,
+      355,  354,  353,  352,  349,  348,  347,  346,  344,  343,
+      342,  341,  339,  338,  337,  335,  334,  333,  332,  330,
+      329,  328,  327,  325,  324,  323,  322,  320,  319,  318,
+      317,  316,  315,  314,  313,  312,  311,  309,  308,  307,
+      306,  304,  303,  302,  301,  300,  299,  298,  297,  295,
+      293,  291,  288,  287,  280,  273,  272,  271,  270,  269,
+
+      268,  267,  266,  265,  264,  263,  262,  261,  260,  259,
+      258,  257,  255,  254,  253,  252,  251,  250,  249,  248,
+      247,  246,  245,  244,  243,  242,  241,  240,  239,  238,
+      237,  236,  235,  234,  233,  232,  231,  230,  229,  228,
+      227,  226,  225,  223,  222,  221,  220,  219,  218,  217,
+      216,  215,  214,  213,  212,  211,  210,  209,  208,  207,
+      206,  204,  203,  202,  201,  200,  199,  197,  194,  192,
+      190,  188,  185,  182,  179,  171,  170,  169,  167,  166,
+      165,  164,  163,  161,  156,  154,  153,  152,  150,  149,
+      148,  145,  144,  143,  142,  141,  140,  139,  138,  136,
+
+      135,  134,  133,  131,  130,  129,  127,  126,  125,  123,
+      122,  121,  120,  119,  115,  109,  106,  103,   98,   97,
+       78,   73,   65,   53,   50,   47,   43,   41,   39,   38,
+       24,   14,   11, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+     1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+
+     1261, 1261, 1261, 1261, 1261, 1261
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1340,23 +1398,25 @@ static char *yy_last_accepting_cpos;
 extern int parser4__flex_debug;
 int parser4__flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[141] =
+static const flex_int16_t yy_rule_linenum[154] =
     {   0,
       131,  133,  135,  140,  141,  146,  147,  148,  160,  163,
       168,  175,  184,  193,  202,  211,  221,  230,  239,  248,
       257,  268,  277,  286,  295,  304,  314,  324,  334,  344,
-      354,  364,  374,  384,  394,  403,  412,  421,  435,  450,
-      459,  468,  477,  486,  495,  504,  513,  522,  531,  540,
-      550,  559,  568,  577,  586,  595,  604,  613,  623,  633,
-      643,  652,  662,  672,  682,  692,  701,  711,  720,  729,
-      738,  747,  756,  766,  776,  785,  794,  803,  812,  821,
-      830,  839,  848,  857,  866,  875,  884,  893,  902,  911,
-      920,  929,  938,  947,  956,  965,  974,  983,  992, 1001,
-
-     1010, 1019, 1028, 1037, 1047, 1057, 1067, 1077, 1087, 1097,
-     1107, 1117, 1127, 1136, 1145, 1154, 1163, 1172, 1182, 1192,
-     1204, 1215, 1228, 1326, 1331, 1336, 1341, 1342, 1343, 1344,
-     1345, 1346, 1348, 1366, 1379, 1384, 1388, 1390, 1392, 1394
+      354,  364,  374,  384,  394,  404,  414,  424,  433,  442,
+      451,  465,  480,  489,  498,  507,  516,  525,  534,  543,
+      552,  561,  570,  580,  589,  598,  607,  616,  625,  634,
+      643,  652,  661,  670,  679,  688,  697,  706,  715,  725,
+      735,  745,  754,  764,  774,  784,  794,  803,  813,  822,
+      831,  840,  849,  858,  868,  878,  887,  896,  905,  914,
+      923,  932,  941,  950,  959,  968,  977,  986,  995, 1004,
+
+     1013, 1022, 1031, 1040, 1049, 1058, 1067, 1076, 1085, 1094,
+     1103, 1112, 1121, 1130, 1139, 1148, 1158, 1168, 1178, 1188,
+     1198, 1208, 1218, 1228, 1238, 1248, 1257, 1266, 1275, 1284,
+     1293, 1303, 1313, 1325, 1336, 1349, 1447, 1452, 1457, 1462,
+     1463, 1464, 1465, 1466, 1467, 1469, 1487, 1500, 1505, 1509,
+     1511, 1513, 1515
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1401,7 +1461,7 @@ unsigned int comment_start_line = 0;
 
 // To avoid the call to exit... oops!
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1404 "dhcp4_lexer.cc"
+#line 1464 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1427,8 +1487,8 @@ unsigned int comment_start_line = 0;
 // by moving it ahead by yyleng bytes. yyleng specifies the length of the
 // currently matched token.
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1430 "dhcp4_lexer.cc"
-#line 1431 "dhcp4_lexer.cc"
+#line 1490 "dhcp4_lexer.cc"
+#line 1491 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1750,7 +1810,7 @@ YY_DECL
     }
 
 
-#line 1753 "dhcp4_lexer.cc"
+#line 1813 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1779,13 +1839,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1161 )
+				if ( yy_current_state >= 1262 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1160 );
+		while ( yy_current_state != 1261 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1804,13 +1864,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 141 )
+			else if ( yy_act < 154 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], parser4_text );
-			else if ( yy_act == 141 )
+			else if ( yy_act == 154 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         parser4_text );
-			else if ( yy_act == 142 )
+			else if ( yy_act == 155 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2144,9 +2204,9 @@ YY_RULE_SETUP
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
     case isc::dhcp::Parser4Context::HOSTS_DATABASE:
-        return isc::dhcp::Dhcp4Parser::make_LFC_INTERVAL(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_MAPPED_STORE(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-interval", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("mapped-store", driver.loc_);
     }
 }
 	YY_BREAK
@@ -2157,15 +2217,54 @@ YY_RULE_SETUP
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
     case isc::dhcp::Parser4Context::HOSTS_DATABASE:
-        return isc::dhcp::Dhcp4Parser::make_CONNECT_TIMEOUT(driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_FILE_FORMAT(driver.loc_);
     default:
-        return isc::dhcp::Dhcp4Parser::make_STRING("connect-timeout", driver.loc_);
+        return isc::dhcp::Dhcp4Parser::make_STRING("file-format", driver.loc_);
     }
 }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 364 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+#line 374 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+#line 384 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CONNECT_TIMEOUT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("connect-timeout", driver.loc_);
+    }
+}
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+#line 394 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2176,9 +2275,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 36:
 YY_RULE_SETUP
-#line 374 "dhcp4_lexer.ll"
+#line 404 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2189,9 +2288,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 37:
 YY_RULE_SETUP
-#line 384 "dhcp4_lexer.ll"
+#line 414 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2202,9 +2301,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 38:
 YY_RULE_SETUP
-#line 394 "dhcp4_lexer.ll"
+#line 424 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2214,9 +2313,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 39:
 YY_RULE_SETUP
-#line 403 "dhcp4_lexer.ll"
+#line 433 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2226,9 +2325,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 40:
 YY_RULE_SETUP
-#line 412 "dhcp4_lexer.ll"
+#line 442 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2238,9 +2337,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 41:
 YY_RULE_SETUP
-#line 421 "dhcp4_lexer.ll"
+#line 451 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2255,9 +2354,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 42:
 YY_RULE_SETUP
-#line 435 "dhcp4_lexer.ll"
+#line 465 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2273,9 +2372,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 43:
 YY_RULE_SETUP
-#line 450 "dhcp4_lexer.ll"
+#line 480 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2285,9 +2384,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 44:
 YY_RULE_SETUP
-#line 459 "dhcp4_lexer.ll"
+#line 489 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2297,9 +2396,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 45:
 YY_RULE_SETUP
-#line 468 "dhcp4_lexer.ll"
+#line 498 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2309,9 +2408,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 46:
 YY_RULE_SETUP
-#line 477 "dhcp4_lexer.ll"
+#line 507 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2321,9 +2420,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 47:
 YY_RULE_SETUP
-#line 486 "dhcp4_lexer.ll"
+#line 516 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2333,9 +2432,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 48:
 YY_RULE_SETUP
-#line 495 "dhcp4_lexer.ll"
+#line 525 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2345,9 +2444,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 49:
 YY_RULE_SETUP
-#line 504 "dhcp4_lexer.ll"
+#line 534 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2357,9 +2456,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 50:
 YY_RULE_SETUP
-#line 513 "dhcp4_lexer.ll"
+#line 543 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2369,9 +2468,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 51:
 YY_RULE_SETUP
-#line 522 "dhcp4_lexer.ll"
+#line 552 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2381,9 +2480,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 52:
 YY_RULE_SETUP
-#line 531 "dhcp4_lexer.ll"
+#line 561 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2393,9 +2492,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 53:
 YY_RULE_SETUP
-#line 540 "dhcp4_lexer.ll"
+#line 570 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2406,9 +2505,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 54:
 YY_RULE_SETUP
-#line 550 "dhcp4_lexer.ll"
+#line 580 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2418,9 +2517,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 55:
 YY_RULE_SETUP
-#line 559 "dhcp4_lexer.ll"
+#line 589 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -2430,9 +2529,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 56:
 YY_RULE_SETUP
-#line 568 "dhcp4_lexer.ll"
+#line 598 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+#line 607 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+#line 616 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+#line 625 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -2442,9 +2577,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 60:
 YY_RULE_SETUP
-#line 577 "dhcp4_lexer.ll"
+#line 634 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2454,9 +2589,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 61:
 YY_RULE_SETUP
-#line 586 "dhcp4_lexer.ll"
+#line 643 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2466,9 +2601,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 62:
 YY_RULE_SETUP
-#line 595 "dhcp4_lexer.ll"
+#line 652 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2478,9 +2613,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 63:
 YY_RULE_SETUP
-#line 604 "dhcp4_lexer.ll"
+#line 661 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2490,9 +2625,69 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 64:
+YY_RULE_SETUP
+#line 670 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_RATE_LIMITS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate-limits", driver.loc_);
+    }
+}
+	YY_BREAK
+case 65:
 YY_RULE_SETUP
-#line 613 "dhcp4_lexer.ll"
+#line 679 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_MESSAGE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("message", driver.loc_);
+    }
+}
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+#line 688 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_SAMPLE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("sample", driver.loc_);
+    }
+}
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+#line 697 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate", driver.loc_);
+    }
+}
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+#line 706 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+#line 715 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2503,9 +2698,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 70:
 YY_RULE_SETUP
-#line 623 "dhcp4_lexer.ll"
+#line 725 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2516,9 +2711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 71:
 YY_RULE_SETUP
-#line 633 "dhcp4_lexer.ll"
+#line 735 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -2529,9 +2724,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 72:
 YY_RULE_SETUP
-#line 643 "dhcp4_lexer.ll"
+#line 745 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2541,9 +2736,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 73:
 YY_RULE_SETUP
-#line 652 "dhcp4_lexer.ll"
+#line 754 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2554,9 +2749,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 74:
 YY_RULE_SETUP
-#line 662 "dhcp4_lexer.ll"
+#line 764 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2567,9 +2762,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 75:
 YY_RULE_SETUP
-#line 672 "dhcp4_lexer.ll"
+#line 774 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2580,9 +2775,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 76:
 YY_RULE_SETUP
-#line 682 "dhcp4_lexer.ll"
+#line 784 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2593,9 +2788,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 77:
 YY_RULE_SETUP
-#line 692 "dhcp4_lexer.ll"
+#line 794 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -2605,9 +2800,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 78:
 YY_RULE_SETUP
-#line 701 "dhcp4_lexer.ll"
+#line 803 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2618,9 +2813,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 79:
 YY_RULE_SETUP
-#line 711 "dhcp4_lexer.ll"
+#line 813 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2630,9 +2825,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 80:
 YY_RULE_SETUP
-#line 720 "dhcp4_lexer.ll"
+#line 822 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2642,9 +2837,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 81:
 YY_RULE_SETUP
-#line 729 "dhcp4_lexer.ll"
+#line 831 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2654,9 +2849,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 82:
 YY_RULE_SETUP
-#line 738 "dhcp4_lexer.ll"
+#line 840 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2666,9 +2861,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 83:
 YY_RULE_SETUP
-#line 747 "dhcp4_lexer.ll"
+#line 849 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2678,9 +2873,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 84:
 YY_RULE_SETUP
-#line 756 "dhcp4_lexer.ll"
+#line 858 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -2691,9 +2886,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 85:
 YY_RULE_SETUP
-#line 766 "dhcp4_lexer.ll"
+#line 868 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2703,9 +2898,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 86:
 YY_RULE_SETUP
-#line 776 "dhcp4_lexer.ll"
+#line 878 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -2715,9 +2910,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 87:
 YY_RULE_SETUP
-#line 785 "dhcp4_lexer.ll"
+#line 887 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -2727,9 +2922,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 88:
 YY_RULE_SETUP
-#line 794 "dhcp4_lexer.ll"
+#line 896 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2739,9 +2934,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 89:
 YY_RULE_SETUP
-#line 803 "dhcp4_lexer.ll"
+#line 905 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2751,9 +2946,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 90:
 YY_RULE_SETUP
-#line 812 "dhcp4_lexer.ll"
+#line 914 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2763,9 +2958,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 91:
 YY_RULE_SETUP
-#line 821 "dhcp4_lexer.ll"
+#line 923 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2775,9 +2970,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 92:
 YY_RULE_SETUP
-#line 830 "dhcp4_lexer.ll"
+#line 932 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2787,9 +2982,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 93:
 YY_RULE_SETUP
-#line 839 "dhcp4_lexer.ll"
+#line 941 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2799,9 +2994,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 94:
 YY_RULE_SETUP
-#line 848 "dhcp4_lexer.ll"
+#line 950 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2811,9 +3006,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 95:
 YY_RULE_SETUP
-#line 857 "dhcp4_lexer.ll"
+#line 959 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2823,9 +3018,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 96:
+YY_RULE_SETUP
+#line 968 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_PACKET_TIMELINE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("packet-timeline", driver.loc_);
+    }
+}
+	YY_BREAK
+case 97:
 YY_RULE_SETUP
-#line 866 "dhcp4_lexer.ll"
+#line 977 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2835,9 +3042,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 98:
 YY_RULE_SETUP
-#line 875 "dhcp4_lexer.ll"
+#line 986 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -2847,9 +3054,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 99:
 YY_RULE_SETUP
-#line 884 "dhcp4_lexer.ll"
+#line 995 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -2859,9 +3066,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 100:
 YY_RULE_SETUP
-#line 893 "dhcp4_lexer.ll"
+#line 1004 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2871,9 +3078,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 101:
 YY_RULE_SETUP
-#line 902 "dhcp4_lexer.ll"
+#line 1013 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2883,9 +3090,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 102:
 YY_RULE_SETUP
-#line 911 "dhcp4_lexer.ll"
+#line 1022 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2895,9 +3102,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 103:
 YY_RULE_SETUP
-#line 920 "dhcp4_lexer.ll"
+#line 1031 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2907,9 +3114,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 104:
 YY_RULE_SETUP
-#line 929 "dhcp4_lexer.ll"
+#line 1040 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2919,9 +3126,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 105:
 YY_RULE_SETUP
-#line 938 "dhcp4_lexer.ll"
+#line 1049 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2931,9 +3138,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 106:
 YY_RULE_SETUP
-#line 947 "dhcp4_lexer.ll"
+#line 1058 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2943,9 +3150,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 107:
 YY_RULE_SETUP
-#line 956 "dhcp4_lexer.ll"
+#line 1067 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2955,9 +3162,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 108:
 YY_RULE_SETUP
-#line 965 "dhcp4_lexer.ll"
+#line 1076 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2967,9 +3174,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 109:
 YY_RULE_SETUP
-#line 974 "dhcp4_lexer.ll"
+#line 1085 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2979,9 +3186,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 110:
 YY_RULE_SETUP
-#line 983 "dhcp4_lexer.ll"
+#line 1094 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2991,9 +3198,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 111:
 YY_RULE_SETUP
-#line 992 "dhcp4_lexer.ll"
+#line 1103 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3003,9 +3210,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 112:
 YY_RULE_SETUP
-#line 1001 "dhcp4_lexer.ll"
+#line 1112 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3015,9 +3222,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 113:
 YY_RULE_SETUP
-#line 1010 "dhcp4_lexer.ll"
+#line 1121 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3027,9 +3234,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 114:
 YY_RULE_SETUP
-#line 1019 "dhcp4_lexer.ll"
+#line 1130 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3039,9 +3246,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 115:
 YY_RULE_SETUP
-#line 1028 "dhcp4_lexer.ll"
+#line 1139 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3051,9 +3258,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 116:
 YY_RULE_SETUP
-#line 1037 "dhcp4_lexer.ll"
+#line 1148 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3064,9 +3271,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 105:
+case 117:
 YY_RULE_SETUP
-#line 1047 "dhcp4_lexer.ll"
+#line 1158 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3077,9 +3284,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 106:
+case 118:
 YY_RULE_SETUP
-#line 1057 "dhcp4_lexer.ll"
+#line 1168 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -3090,9 +3297,22 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 107:
+case 119:
 YY_RULE_SETUP
-#line 1067 "dhcp4_lexer.ll"
+#line 1178 "dhcp4_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp4Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 120:
+YY_RULE_SETUP
+#line 1188 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3103,9 +3323,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 108:
+case 121:
 YY_RULE_SETUP
-#line 1077 "dhcp4_lexer.ll"
+#line 1198 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3116,9 +3336,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 109:
+case 122:
 YY_RULE_SETUP
-#line 1087 "dhcp4_lexer.ll"
+#line 1208 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3129,9 +3349,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 110:
+case 123:
 YY_RULE_SETUP
-#line 1097 "dhcp4_lexer.ll"
+#line 1218 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3142,9 +3362,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 111:
+case 124:
 YY_RULE_SETUP
-#line 1107 "dhcp4_lexer.ll"
+#line 1228 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3155,9 +3375,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 112:
+case 125:
 YY_RULE_SETUP
-#line 1117 "dhcp4_lexer.ll"
+#line 1238 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3168,9 +3388,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 113:
+case 126:
 YY_RULE_SETUP
-#line 1127 "dhcp4_lexer.ll"
+#line 1248 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3180,9 +3400,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 127:
 YY_RULE_SETUP
-#line 1136 "dhcp4_lexer.ll"
+#line 1257 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3192,9 +3412,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 128:
 YY_RULE_SETUP
-#line 1145 "dhcp4_lexer.ll"
+#line 1266 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3204,9 +3424,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 129:
 YY_RULE_SETUP
-#line 1154 "dhcp4_lexer.ll"
+#line 1275 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3216,9 +3436,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 130:
 YY_RULE_SETUP
-#line 1163 "dhcp4_lexer.ll"
+#line 1284 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3228,9 +3448,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 131:
 YY_RULE_SETUP
-#line 1172 "dhcp4_lexer.ll"
+#line 1293 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3241,9 +3461,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 132:
 YY_RULE_SETUP
-#line 1182 "dhcp4_lexer.ll"
+#line 1303 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3254,9 +3474,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 133:
 YY_RULE_SETUP
-#line 1192 "dhcp4_lexer.ll"
+#line 1313 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3269,9 +3489,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 134:
 YY_RULE_SETUP
-#line 1204 "dhcp4_lexer.ll"
+#line 1325 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3283,9 +3503,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 135:
 YY_RULE_SETUP
-#line 1215 "dhcp4_lexer.ll"
+#line 1336 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3297,9 +3517,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 136:
 YY_RULE_SETUP
-#line 1228 "dhcp4_lexer.ll"
+#line 1349 "dhcp4_lexer.ll"
 {
     // A string has been matched. It contains the actual string and single quotes.
     // We need to get those quotes out of the way and just use its content, e.g.
@@ -3398,65 +3618,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 124:
-/* rule 124 can match eol */
+case 137:
+/* rule 137 can match eol */
 YY_RULE_SETUP
-#line 1326 "dhcp4_lexer.ll"
+#line 1447 "dhcp4_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 125:
-/* rule 125 can match eol */
+case 138:
+/* rule 138 can match eol */
 YY_RULE_SETUP
-#line 1331 "dhcp4_lexer.ll"
+#line 1452 "dhcp4_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 126:
+case 139:
 YY_RULE_SETUP
-#line 1336 "dhcp4_lexer.ll"
+#line 1457 "dhcp4_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 127:
+case 140:
 YY_RULE_SETUP
-#line 1341 "dhcp4_lexer.ll"
+#line 1462 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 128:
+case 141:
 YY_RULE_SETUP
-#line 1342 "dhcp4_lexer.ll"
+#line 1463 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 129:
+case 142:
 YY_RULE_SETUP
-#line 1343 "dhcp4_lexer.ll"
+#line 1464 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 130:
+case 143:
 YY_RULE_SETUP
-#line 1344 "dhcp4_lexer.ll"
+#line 1465 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 131:
+case 144:
 YY_RULE_SETUP
-#line 1345 "dhcp4_lexer.ll"
+#line 1466 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 132:
+case 145:
 YY_RULE_SETUP
-#line 1346 "dhcp4_lexer.ll"
+#line 1467 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 133:
+case 146:
 YY_RULE_SETUP
-#line 1348 "dhcp4_lexer.ll"
+#line 1469 "dhcp4_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -3475,9 +3695,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 134:
+case 147:
 YY_RULE_SETUP
-#line 1366 "dhcp4_lexer.ll"
+#line 1487 "dhcp4_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -3491,43 +3711,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 135:
+case 148:
 YY_RULE_SETUP
-#line 1379 "dhcp4_lexer.ll"
+#line 1500 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 136:
+case 149:
 YY_RULE_SETUP
-#line 1384 "dhcp4_lexer.ll"
+#line 1505 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 137:
+case 150:
 YY_RULE_SETUP
-#line 1388 "dhcp4_lexer.ll"
+#line 1509 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 138:
+case 151:
 YY_RULE_SETUP
-#line 1390 "dhcp4_lexer.ll"
+#line 1511 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 139:
+case 152:
 YY_RULE_SETUP
-#line 1392 "dhcp4_lexer.ll"
+#line 1513 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 140:
+case 153:
 YY_RULE_SETUP
-#line 1394 "dhcp4_lexer.ll"
+#line 1515 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1396 "dhcp4_lexer.ll"
+#line 1517 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -3551,12 +3771,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 141:
+case 154:
 YY_RULE_SETUP
-#line 1419 "dhcp4_lexer.ll"
+#line 1540 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3559 "dhcp4_lexer.cc"
+#line 3779 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3871,7 +4091,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1161 )
+			if ( yy_current_state >= 1262 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3904,11 +4124,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1161 )
+		if ( yy_current_state >= 1262 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1160);
+	yy_is_jam = (yy_current_state == 1261);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4657,7 +4877,7 @@ void parser4_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1419 "dhcp4_lexer.ll"
+#line 1540 "dhcp4_lexer.ll"
 
 
 using namespace isc::dhcp;
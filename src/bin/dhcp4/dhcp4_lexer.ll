@@ -340,6 +340,36 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"mapped-store\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_MAPPED_STORE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("mapped-store", driver.loc_);
+    }
+}
+
+\"file-format\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_FILE_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("file-format", driver.loc_);
+    }
+}
+
+\"lfc-mode\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+
 \"lfc-interval\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -564,6 +594,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"queue-size\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+
+\"overflow-policy\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp4Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+
 \"loggers\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -609,6 +666,51 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"rate-limits\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_RATE_LIMITS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate-limits", driver.loc_);
+    }
+}
+
+\"message\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_MESSAGE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("message", driver.loc_);
+    }
+}
+
+\"sample\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_SAMPLE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("sample", driver.loc_);
+    }
+}
+
+\"rate\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate", driver.loc_);
+    }
+}
+
+\"interval\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp4Parser::make_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("interval", driver.loc_);
+    }
+}
+
 \"client-classes\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -862,6 +964,15 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"packet-timeline\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_PACKET_TIMELINE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("packet-timeline", driver.loc_);
+    }
+}
+
 \"control-socket\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -1063,6 +1174,16 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 
+(?i:\"BINARY\") {
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp4Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
+}
+
 (?i:\"when-present\") {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   parser4_lex
 
-// First part of user declarations.
 
-#line 39 "dhcp4_parser.cc" // lalr1.cc:404
-
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "dhcp4_parser.h"
 
-// User implementation prologue.
 
-#line 53 "dhcp4_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "dhcp4_parser.yy" // lalr1.cc:413
+#line 34 "dhcp4_parser.yy"
 
 #include <dhcp4/parser_context.h>
 
-#line 59 "dhcp4_parser.cc" // lalr1.cc:413
+#line 52 "dhcp4_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER4_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER4_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !PARSER4_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:479
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 145 "dhcp4_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp4Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp4_parser.cc"
 
   /// Build a parser object.
   Dhcp4Parser::Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg)
-    :
 #if PARSER4_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::~Dhcp4Parser ()
   {}
 
+  Dhcp4Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  Dhcp4Parser::by_state::by_state ()
+  Dhcp4Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  Dhcp4Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp4Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  Dhcp4Parser::by_state::clear ()
+  Dhcp4Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   Dhcp4Parser::by_state::move (by_state& that)
   {
@@ -227,55 +188,92 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  inline
-  Dhcp4Parser::by_state::by_state (state_type s)
+  Dhcp4Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  Dhcp4Parser::symbol_number_type
-  Dhcp4Parser::by_state::type_get () const
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   Dhcp4Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  Dhcp4Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
-        value.move< ElementPtr > (that.value);
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 132: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 131: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 130: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 129: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -283,38 +281,39 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   Dhcp4Parser::stack_symbol_type&
   Dhcp4Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 132: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 131: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 130: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 129: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -326,9 +325,50 @@ namespace isc { namespace dhcp {
     return *this;
   }
 
+  Dhcp4Parser::stack_symbol_type&
+  Dhcp4Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   Dhcp4Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -339,119 +379,115 @@ namespace isc { namespace dhcp {
 #if PARSER4_DEBUG
   template <typename Base>
   void
-  Dhcp4Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp4Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 129: // "constant string"
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 362 "dhcp4_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 400 "dhcp4_parser.cc"
         break;
 
-      case 130: // "integer"
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 369 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 406 "dhcp4_parser.cc"
         break;
 
-      case 131: // "floating point"
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 376 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 412 "dhcp4_parser.cc"
         break;
 
-      case 132: // "boolean"
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 383 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 418 "dhcp4_parser.cc"
         break;
 
-      case 146: // value
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 390 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 424 "dhcp4_parser.cc"
         break;
 
-      case 150: // map_value
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 397 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_map_value: // map_value
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 430 "dhcp4_parser.cc"
         break;
 
-      case 188: // socket_type
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 404 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_socket_type: // socket_type
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 436 "dhcp4_parser.cc"
         break;
 
-      case 197: // db_type
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 411 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_db_type: // db_type
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 442 "dhcp4_parser.cc"
         break;
 
-      case 397: // ncr_protocol_value
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 418 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 448 "dhcp4_parser.cc"
         break;
 
-      case 406: // replace_client_name_value
-
-#line 204 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 425 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 454 "dhcp4_parser.cc"
         break;
 
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 219 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 460 "dhcp4_parser.cc"
+        break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  Dhcp4Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  Dhcp4Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  Dhcp4Parser::yypush_ (const char* m, stack_symbol_type& s)
+  Dhcp4Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  Dhcp4Parser::yypop_ (unsigned int n)
+  Dhcp4Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -483,32 +519,37 @@ namespace isc { namespace dhcp {
   }
 #endif // PARSER4_DEBUG
 
-  inline Dhcp4Parser::state_type
+  Dhcp4Parser::state_type
   Dhcp4Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  Dhcp4Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   Dhcp4Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -526,11 +567,11 @@ namespace isc { namespace dhcp {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -538,48 +579,70 @@ namespace isc { namespace dhcp {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -596,54 +659,57 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
-        yylhs.value.build< ElementPtr > ();
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 132: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 131: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 130: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 129: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -651,286 +717,289 @@ namespace isc { namespace dhcp {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 213 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 670 "dhcp4_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 228 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 739 "dhcp4_parser.cc"
     break;
 
-  case 4:
-#line 214 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 676 "dhcp4_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 229 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 745 "dhcp4_parser.cc"
     break;
 
-  case 6:
-#line 215 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 682 "dhcp4_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 230 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP4; }
+#line 751 "dhcp4_parser.cc"
     break;
 
-  case 8:
-#line 216 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 688 "dhcp4_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 231 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 757 "dhcp4_parser.cc"
     break;
 
-  case 10:
-#line 217 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.SUBNET4; }
-#line 694 "dhcp4_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 232 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET4; }
+#line 763 "dhcp4_parser.cc"
     break;
 
-  case 12:
-#line 218 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.POOLS; }
-#line 700 "dhcp4_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 233 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 769 "dhcp4_parser.cc"
     break;
 
-  case 14:
-#line 219 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 706 "dhcp4_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 234 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 775 "dhcp4_parser.cc"
     break;
 
-  case 16:
-#line 220 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 712 "dhcp4_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 235 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 781 "dhcp4_parser.cc"
     break;
 
-  case 18:
-#line 221 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 718 "dhcp4_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 236 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 787 "dhcp4_parser.cc"
     break;
 
-  case 20:
-#line 222 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 724 "dhcp4_parser.cc" // lalr1.cc:859
+  case 20: // $@10: %empty
+#line 237 "dhcp4_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 793 "dhcp4_parser.cc"
     break;
 
-  case 22:
-#line 223 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 730 "dhcp4_parser.cc" // lalr1.cc:859
+  case 22: // $@11: %empty
+#line 238 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 799 "dhcp4_parser.cc"
     break;
 
-  case 24:
-#line 231 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 736 "dhcp4_parser.cc" // lalr1.cc:859
+  case 24: // value: "integer"
+#line 246 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 805 "dhcp4_parser.cc"
     break;
 
-  case 25:
-#line 232 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 742 "dhcp4_parser.cc" // lalr1.cc:859
+  case 25: // value: "floating point"
+#line 247 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 811 "dhcp4_parser.cc"
     break;
 
-  case 26:
-#line 233 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 748 "dhcp4_parser.cc" // lalr1.cc:859
+  case 26: // value: "boolean"
+#line 248 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 817 "dhcp4_parser.cc"
     break;
 
-  case 27:
-#line 234 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 754 "dhcp4_parser.cc" // lalr1.cc:859
+  case 27: // value: "constant string"
+#line 249 "dhcp4_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 823 "dhcp4_parser.cc"
     break;
 
-  case 28:
-#line 235 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 760 "dhcp4_parser.cc" // lalr1.cc:859
+  case 28: // value: "null"
+#line 250 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 829 "dhcp4_parser.cc"
     break;
 
-  case 29:
-#line 236 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 766 "dhcp4_parser.cc" // lalr1.cc:859
+  case 29: // value: map2
+#line 251 "dhcp4_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 835 "dhcp4_parser.cc"
     break;
 
-  case 30:
-#line 237 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 772 "dhcp4_parser.cc" // lalr1.cc:859
+  case 30: // value: list_generic
+#line 252 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 841 "dhcp4_parser.cc"
     break;
 
-  case 31:
-#line 240 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 31: // sub_json: value
+#line 255 "dhcp4_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 781 "dhcp4_parser.cc" // lalr1.cc:859
+#line 850 "dhcp4_parser.cc"
     break;
 
-  case 32:
-#line 245 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 32: // $@12: %empty
+#line 260 "dhcp4_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 792 "dhcp4_parser.cc" // lalr1.cc:859
+#line 861 "dhcp4_parser.cc"
     break;
 
-  case 33:
-#line 250 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 33: // map2: "{" $@12 map_content "}"
+#line 265 "dhcp4_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 802 "dhcp4_parser.cc" // lalr1.cc:859
+#line 871 "dhcp4_parser.cc"
     break;
 
-  case 34:
-#line 256 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 808 "dhcp4_parser.cc" // lalr1.cc:859
+  case 34: // map_value: map2
+#line 271 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 877 "dhcp4_parser.cc"
     break;
 
-  case 37:
-#line 263 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 37: // not_empty_map: "constant string" ":" value
+#line 278 "dhcp4_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 817 "dhcp4_parser.cc" // lalr1.cc:859
+#line 886 "dhcp4_parser.cc"
     break;
 
-  case 38:
-#line 267 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 38: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 282 "dhcp4_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 827 "dhcp4_parser.cc" // lalr1.cc:859
+#line 896 "dhcp4_parser.cc"
     break;
 
-  case 39:
-#line 274 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 39: // $@13: %empty
+#line 289 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 836 "dhcp4_parser.cc" // lalr1.cc:859
+#line 905 "dhcp4_parser.cc"
     break;
 
-  case 40:
-#line 277 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 40: // list_generic: "[" $@13 list_content "]"
+#line 292 "dhcp4_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 844 "dhcp4_parser.cc" // lalr1.cc:859
+#line 913 "dhcp4_parser.cc"
     break;
 
-  case 43:
-#line 285 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 43: // not_empty_list: value
+#line 300 "dhcp4_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 853 "dhcp4_parser.cc" // lalr1.cc:859
+#line 922 "dhcp4_parser.cc"
     break;
 
-  case 44:
-#line 289 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 44: // not_empty_list: not_empty_list "," value
+#line 304 "dhcp4_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 862 "dhcp4_parser.cc" // lalr1.cc:859
+#line 931 "dhcp4_parser.cc"
     break;
 
-  case 45:
-#line 296 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 45: // $@14: %empty
+#line 311 "dhcp4_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 870 "dhcp4_parser.cc" // lalr1.cc:859
+#line 939 "dhcp4_parser.cc"
     break;
 
-  case 46:
-#line 298 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 46: // list_strings: "[" $@14 list_strings_content "]"
+#line 313 "dhcp4_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 879 "dhcp4_parser.cc" // lalr1.cc:859
+#line 948 "dhcp4_parser.cc"
     break;
 
-  case 49:
-#line 307 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 49: // not_empty_list_strings: "constant string"
+#line 322 "dhcp4_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 888 "dhcp4_parser.cc" // lalr1.cc:859
+#line 957 "dhcp4_parser.cc"
     break;
 
-  case 50:
-#line 311 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 50: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 326 "dhcp4_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 897 "dhcp4_parser.cc" // lalr1.cc:859
+#line 966 "dhcp4_parser.cc"
     break;
 
-  case 51:
-#line 322 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 51: // unknown_map_entry: "constant string" ":"
+#line 337 "dhcp4_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 908 "dhcp4_parser.cc" // lalr1.cc:859
+#line 977 "dhcp4_parser.cc"
     break;
 
-  case 52:
-#line 332 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 52: // $@15: %empty
+#line 347 "dhcp4_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 919 "dhcp4_parser.cc" // lalr1.cc:859
+#line 988 "dhcp4_parser.cc"
     break;
 
-  case 53:
-#line 337 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 53: // syntax_map: "{" $@15 global_objects "}"
+#line 352 "dhcp4_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 929 "dhcp4_parser.cc" // lalr1.cc:859
+#line 998 "dhcp4_parser.cc"
     break;
 
-  case 61:
-#line 356 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 61: // $@16: %empty
+#line 371 "dhcp4_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -938,623 +1007,668 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP4);
 }
-#line 942 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1011 "dhcp4_parser.cc"
     break;
 
-  case 62:
-#line 363 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 62: // dhcp4_object: "Dhcp4" $@16 ":" "{" global_params "}"
+#line 378 "dhcp4_parser.yy"
+                                                    {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 954 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1023 "dhcp4_parser.cc"
     break;
 
-  case 63:
-#line 373 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 63: // $@17: %empty
+#line 388 "dhcp4_parser.yy"
+                          {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 964 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1033 "dhcp4_parser.cc"
     break;
 
-  case 64:
-#line 377 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 64: // sub_dhcp4: "{" $@17 global_params "}"
+#line 392 "dhcp4_parser.yy"
+                               {
     // parsing completed
 }
-#line 972 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1041 "dhcp4_parser.cc"
     break;
 
-  case 88:
-#line 410 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 89: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 426 "dhcp4_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 981 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1050 "dhcp4_parser.cc"
     break;
 
-  case 89:
-#line 415 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 90: // renew_timer: "renew-timer" ":" "integer"
+#line 431 "dhcp4_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 990 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1059 "dhcp4_parser.cc"
     break;
 
-  case 90:
-#line 420 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 91: // rebind_timer: "rebind-timer" ":" "integer"
+#line 436 "dhcp4_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 999 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1068 "dhcp4_parser.cc"
     break;
 
-  case 91:
-#line 425 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 92: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 441 "dhcp4_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1008 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1077 "dhcp4_parser.cc"
     break;
 
-  case 92:
-#line 430 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 93: // echo_client_id: "echo-client-id" ":" "boolean"
+#line 446 "dhcp4_parser.yy"
+                                             {
+    ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
 }
-#line 1017 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1086 "dhcp4_parser.cc"
     break;
 
-  case 93:
-#line 435 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 94: // match_client_id: "match-client-id" ":" "boolean"
+#line 451 "dhcp4_parser.yy"
+                                               {
+    ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
 }
-#line 1026 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1095 "dhcp4_parser.cc"
     break;
 
-  case 94:
-#line 441 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 95: // $@18: %empty
+#line 457 "dhcp4_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1037 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1106 "dhcp4_parser.cc"
     break;
 
-  case 95:
-#line 446 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 96: // interfaces_config: "interfaces-config" $@18 ":" "{" interfaces_config_params "}"
+#line 462 "dhcp4_parser.yy"
+                                                               {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1046 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1115 "dhcp4_parser.cc"
     break;
 
-  case 100:
-#line 459 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 101: // $@19: %empty
+#line 475 "dhcp4_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1056 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1125 "dhcp4_parser.cc"
     break;
 
-  case 101:
-#line 463 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 102: // sub_interfaces4: "{" $@19 interfaces_config_params "}"
+#line 479 "dhcp4_parser.yy"
+                                          {
     // parsing completed
 }
-#line 1064 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1133 "dhcp4_parser.cc"
     break;
 
-  case 102:
-#line 467 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 103: // $@20: %empty
+#line 483 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1075 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1144 "dhcp4_parser.cc"
     break;
 
-  case 103:
-#line 472 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 104: // interfaces_list: "interfaces" $@20 ":" list_strings
+#line 488 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1084 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1153 "dhcp4_parser.cc"
     break;
 
-  case 104:
-#line 477 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 105: // $@21: %empty
+#line 493 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1092 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1161 "dhcp4_parser.cc"
     break;
 
-  case 105:
-#line 479 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
+  case 106: // dhcp_socket_type: "dhcp-socket-type" $@21 ":" socket_type
+#line 495 "dhcp4_parser.yy"
+                    {
+    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1101 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1170 "dhcp4_parser.cc"
     break;
 
-  case 106:
-#line 484 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1107 "dhcp4_parser.cc" // lalr1.cc:859
+  case 107: // socket_type: "raw"
+#line 500 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
+#line 1176 "dhcp4_parser.cc"
     break;
 
-  case 107:
-#line 485 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1113 "dhcp4_parser.cc" // lalr1.cc:859
+  case 108: // socket_type: "udp"
+#line 501 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
+#line 1182 "dhcp4_parser.cc"
     break;
 
-  case 108:
-#line 488 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 109: // $@22: %empty
+#line 504 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1124 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1193 "dhcp4_parser.cc"
     break;
 
-  case 109:
-#line 493 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 110: // lease_database: "lease-database" $@22 ":" "{" database_map_params "}"
+#line 509 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1133 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1202 "dhcp4_parser.cc"
     break;
 
-  case 110:
-#line 498 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 111: // $@23: %empty
+#line 514 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1144 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1213 "dhcp4_parser.cc"
     break;
 
-  case 111:
-#line 503 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 112: // hosts_database: "hosts-database" $@23 ":" "{" database_map_params "}"
+#line 519 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1153 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1222 "dhcp4_parser.cc"
     break;
 
-  case 124:
-#line 524 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 128: // $@24: %empty
+#line 543 "dhcp4_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1161 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1230 "dhcp4_parser.cc"
     break;
 
-  case 125:
-#line 526 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 129: // database_type: "type" $@24 ":" db_type
+#line 545 "dhcp4_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1170 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1239 "dhcp4_parser.cc"
     break;
 
-  case 126:
-#line 531 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1176 "dhcp4_parser.cc" // lalr1.cc:859
+  case 130: // db_type: "memfile"
+#line 550 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1245 "dhcp4_parser.cc"
     break;
 
-  case 127:
-#line 532 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1182 "dhcp4_parser.cc" // lalr1.cc:859
+  case 131: // db_type: "mysql"
+#line 551 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1251 "dhcp4_parser.cc"
     break;
 
-  case 128:
-#line 533 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1188 "dhcp4_parser.cc" // lalr1.cc:859
+  case 132: // db_type: "postgresql"
+#line 552 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1257 "dhcp4_parser.cc"
     break;
 
-  case 129:
-#line 534 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1194 "dhcp4_parser.cc" // lalr1.cc:859
+  case 133: // db_type: "cql"
+#line 553 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1263 "dhcp4_parser.cc"
     break;
 
-  case 130:
-#line 537 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 134: // $@25: %empty
+#line 556 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1202 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1271 "dhcp4_parser.cc"
     break;
 
-  case 131:
-#line 539 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 135: // user: "user" $@25 ":" "constant string"
+#line 558 "dhcp4_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1212 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1281 "dhcp4_parser.cc"
     break;
 
-  case 132:
-#line 545 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 136: // $@26: %empty
+#line 564 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1220 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1289 "dhcp4_parser.cc"
     break;
 
-  case 133:
-#line 547 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 137: // password: "password" $@26 ":" "constant string"
+#line 566 "dhcp4_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1230 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1299 "dhcp4_parser.cc"
     break;
 
-  case 134:
-#line 553 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 138: // $@27: %empty
+#line 572 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1238 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1307 "dhcp4_parser.cc"
     break;
 
-  case 135:
-#line 555 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 139: // host: "host" $@27 ":" "constant string"
+#line 574 "dhcp4_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1248 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1317 "dhcp4_parser.cc"
     break;
 
-  case 136:
-#line 561 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 140: // $@28: %empty
+#line 580 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1256 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1325 "dhcp4_parser.cc"
     break;
 
-  case 137:
-#line 563 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 141: // name: "name" $@28 ":" "constant string"
+#line 582 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1266 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1335 "dhcp4_parser.cc"
     break;
 
-  case 138:
-#line 569 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 142: // persist: "persist" ":" "boolean"
+#line 588 "dhcp4_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1275 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1344 "dhcp4_parser.cc"
     break;
 
-  case 139:
-#line 574 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 143: // mapped_store: "mapped-store" ":" "boolean"
+#line 593 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("mapped-store", n);
+}
+#line 1353 "dhcp4_parser.cc"
+    break;
+
+  case 144: // $@29: %empty
+#line 598 "dhcp4_parser.yy"
+                         {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1361 "dhcp4_parser.cc"
+    break;
+
+  case 145: // file_format: "file-format" $@29 ":" "constant string"
+#line 600 "dhcp4_parser.yy"
+               {
+    ElementPtr format(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("file-format", format);
+    ctx.leave();
+}
+#line 1371 "dhcp4_parser.cc"
+    break;
+
+  case 146: // $@30: %empty
+#line 606 "dhcp4_parser.yy"
+                   {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1379 "dhcp4_parser.cc"
+    break;
+
+  case 147: // lfc_mode: "lfc-mode" $@30 ":" "constant string"
+#line 608 "dhcp4_parser.yy"
+               {
+    ElementPtr mode(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-mode", mode);
+    ctx.leave();
+}
+#line 1389 "dhcp4_parser.cc"
+    break;
+
+  case 148: // lfc_interval: "lfc-interval" ":" "integer"
+#line 614 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1284 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1398 "dhcp4_parser.cc"
     break;
 
-  case 140:
-#line 579 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 149: // readonly: "readonly" ":" "boolean"
+#line 619 "dhcp4_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1293 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1407 "dhcp4_parser.cc"
     break;
 
-  case 141:
-#line 584 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 150: // connect_timeout: "connect-timeout" ":" "integer"
+#line 624 "dhcp4_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1302 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1416 "dhcp4_parser.cc"
     break;
 
-  case 142:
-#line 589 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 151: // $@31: %empty
+#line 629 "dhcp4_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1313 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1427 "dhcp4_parser.cc"
     break;
 
-  case 143:
-#line 594 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 152: // host_reservation_identifiers: "host-reservation-identifiers" $@31 ":" "[" host_reservation_identifiers_list "]"
+#line 634 "dhcp4_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1322 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1436 "dhcp4_parser.cc"
     break;
 
-  case 150:
-#line 609 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 159: // duid_id: "duid"
+#line 649 "dhcp4_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1331 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1445 "dhcp4_parser.cc"
     break;
 
-  case 151:
-#line 614 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 160: // hw_address_id: "hw-address"
+#line 654 "dhcp4_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1340 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1454 "dhcp4_parser.cc"
     break;
 
-  case 152:
-#line 619 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 161: // circuit_id: "circuit-id"
+#line 659 "dhcp4_parser.yy"
+                        {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1349 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1463 "dhcp4_parser.cc"
     break;
 
-  case 153:
-#line 624 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 162: // client_id: "client-id"
+#line 664 "dhcp4_parser.yy"
+                      {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1358 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1472 "dhcp4_parser.cc"
     break;
 
-  case 154:
-#line 629 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 163: // $@32: %empty
+#line 669 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1369 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1483 "dhcp4_parser.cc"
     break;
 
-  case 155:
-#line 634 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 164: // hooks_libraries: "hooks-libraries" $@32 ":" "[" hooks_libraries_list "]"
+#line 674 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1378 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1492 "dhcp4_parser.cc"
     break;
 
-  case 160:
-#line 647 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 169: // $@33: %empty
+#line 687 "dhcp4_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1388 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1502 "dhcp4_parser.cc"
     break;
 
-  case 161:
-#line 651 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 170: // hooks_library: "{" $@33 hooks_params "}"
+#line 691 "dhcp4_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1396 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1510 "dhcp4_parser.cc"
     break;
 
-  case 162:
-#line 655 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 171: // $@34: %empty
+#line 695 "dhcp4_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1406 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1520 "dhcp4_parser.cc"
     break;
 
-  case 163:
-#line 659 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 172: // sub_hooks_library: "{" $@34 hooks_params "}"
+#line 699 "dhcp4_parser.yy"
+                              {
     // parsing completed
 }
-#line 1414 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1528 "dhcp4_parser.cc"
     break;
 
-  case 169:
-#line 672 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 178: // $@35: %empty
+#line 712 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1422 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1536 "dhcp4_parser.cc"
     break;
 
-  case 170:
-#line 674 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 179: // library: "library" $@35 ":" "constant string"
+#line 714 "dhcp4_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1432 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1546 "dhcp4_parser.cc"
     break;
 
-  case 171:
-#line 680 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 180: // $@36: %empty
+#line 720 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1440 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1554 "dhcp4_parser.cc"
     break;
 
-  case 172:
-#line 682 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 181: // parameters: "parameters" $@36 ":" value
+#line 722 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1449 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1563 "dhcp4_parser.cc"
     break;
 
-  case 173:
-#line 688 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 182: // $@37: %empty
+#line 728 "dhcp4_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1460 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1574 "dhcp4_parser.cc"
     break;
 
-  case 174:
-#line 693 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 183: // expired_leases_processing: "expired-leases-processing" $@37 ":" "{" expired_leases_params "}"
+#line 733 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1469 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1583 "dhcp4_parser.cc"
     break;
 
-  case 183:
-#line 710 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 192: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 750 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1478 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1592 "dhcp4_parser.cc"
     break;
 
-  case 184:
-#line 715 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 193: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 755 "dhcp4_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1487 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1601 "dhcp4_parser.cc"
     break;
 
-  case 185:
-#line 720 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 194: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 760 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1496 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1610 "dhcp4_parser.cc"
     break;
 
-  case 186:
-#line 725 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 195: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 765 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1505 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1619 "dhcp4_parser.cc"
     break;
 
-  case 187:
-#line 730 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 196: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 770 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1514 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1628 "dhcp4_parser.cc"
     break;
 
-  case 188:
-#line 735 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 197: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 775 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1523 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1637 "dhcp4_parser.cc"
     break;
 
-  case 189:
-#line 743 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 198: // $@38: %empty
+#line 783 "dhcp4_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1534 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1648 "dhcp4_parser.cc"
     break;
 
-  case 190:
-#line 748 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 199: // subnet4_list: "subnet4" $@38 ":" "[" subnet4_list_content "]"
+#line 788 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1543 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1657 "dhcp4_parser.cc"
     break;
 
-  case 195:
-#line 768 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 204: // $@39: %empty
+#line 808 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1553 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1667 "dhcp4_parser.cc"
     break;
 
-  case 196:
-#line 772 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 205: // subnet4: "{" $@39 subnet4_params "}"
+#line 812 "dhcp4_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1572,1389 +1686,1543 @@ namespace isc { namespace dhcp {
     // }
     ctx.stack_.pop_back();
 }
-#line 1576 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1690 "dhcp4_parser.cc"
     break;
 
-  case 197:
-#line 791 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 206: // $@40: %empty
+#line 831 "dhcp4_parser.yy"
+                            {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1586 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1700 "dhcp4_parser.cc"
     break;
 
-  case 198:
-#line 795 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 207: // sub_subnet4: "{" $@40 subnet4_params "}"
+#line 835 "dhcp4_parser.yy"
+                                {
     // parsing completed
 }
-#line 1594 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1708 "dhcp4_parser.cc"
     break;
 
-  case 221:
-#line 827 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 230: // $@41: %empty
+#line 867 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1602 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1716 "dhcp4_parser.cc"
     break;
 
-  case 222:
-#line 829 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 231: // subnet: "subnet" $@41 ":" "constant string"
+#line 869 "dhcp4_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1612 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1726 "dhcp4_parser.cc"
     break;
 
-  case 223:
-#line 835 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 232: // $@42: %empty
+#line 875 "dhcp4_parser.yy"
+                                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1620 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1734 "dhcp4_parser.cc"
     break;
 
-  case 224:
-#line 837 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 233: // subnet_4o6_interface: "4o6-interface" $@42 ":" "constant string"
+#line 877 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 1630 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1744 "dhcp4_parser.cc"
     break;
 
-  case 225:
-#line 843 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 234: // $@43: %empty
+#line 883 "dhcp4_parser.yy"
+                                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1638 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1752 "dhcp4_parser.cc"
     break;
 
-  case 226:
-#line 845 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 235: // subnet_4o6_interface_id: "4o6-interface-id" $@43 ":" "constant string"
+#line 885 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 1648 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1762 "dhcp4_parser.cc"
     break;
 
-  case 227:
-#line 851 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 236: // $@44: %empty
+#line 891 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1656 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1770 "dhcp4_parser.cc"
     break;
 
-  case 228:
-#line 853 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 237: // subnet_4o6_subnet: "4o6-subnet" $@44 ":" "constant string"
+#line 893 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 1666 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1780 "dhcp4_parser.cc"
     break;
 
-  case 229:
-#line 859 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 238: // $@45: %empty
+#line 899 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1674 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1788 "dhcp4_parser.cc"
     break;
 
-  case 230:
-#line 861 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 239: // interface: "interface" $@45 ":" "constant string"
+#line 901 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1684 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1798 "dhcp4_parser.cc"
     break;
 
-  case 231:
-#line 867 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 240: // $@46: %empty
+#line 907 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1692 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1806 "dhcp4_parser.cc"
     break;
 
-  case 232:
-#line 869 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 241: // interface_id: "interface-id" $@46 ":" "constant string"
+#line 909 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1702 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1816 "dhcp4_parser.cc"
     break;
 
-  case 233:
-#line 875 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 242: // $@47: %empty
+#line 915 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1710 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1824 "dhcp4_parser.cc"
     break;
 
-  case 234:
-#line 877 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 243: // client_class: "client-class" $@47 ":" "constant string"
+#line 917 "dhcp4_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1720 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1834 "dhcp4_parser.cc"
     break;
 
-  case 235:
-#line 883 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 244: // $@48: %empty
+#line 923 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1728 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1842 "dhcp4_parser.cc"
     break;
 
-  case 236:
-#line 885 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rm(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 245: // reservation_mode: "reservation-mode" $@48 ":" "constant string"
+#line 925 "dhcp4_parser.yy"
+               {
+    ElementPtr rm(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservation-mode", rm);
     ctx.leave();
 }
-#line 1738 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1852 "dhcp4_parser.cc"
     break;
 
-  case 237:
-#line 891 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 246: // id: "id" ":" "integer"
+#line 931 "dhcp4_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1747 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1861 "dhcp4_parser.cc"
     break;
 
-  case 238:
-#line 896 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 247: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 936 "dhcp4_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1756 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1870 "dhcp4_parser.cc"
     break;
 
-  case 239:
-#line 905 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 248: // $@49: %empty
+#line 945 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1767 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1881 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 910 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 249: // option_def_list: "option-def" $@49 ":" "[" option_def_list_content "]"
+#line 950 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1776 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1890 "dhcp4_parser.cc"
     break;
 
-  case 245:
-#line 927 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 254: // $@50: %empty
+#line 967 "dhcp4_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1786 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1900 "dhcp4_parser.cc"
     break;
 
-  case 246:
-#line 931 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 255: // option_def_entry: "{" $@50 option_def_params "}"
+#line 971 "dhcp4_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1794 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1908 "dhcp4_parser.cc"
     break;
 
-  case 247:
-#line 938 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 256: // $@51: %empty
+#line 978 "dhcp4_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1804 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1918 "dhcp4_parser.cc"
     break;
 
-  case 248:
-#line 942 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 257: // sub_option_def: "{" $@51 option_def_params "}"
+#line 982 "dhcp4_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1812 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1926 "dhcp4_parser.cc"
     break;
 
-  case 262:
-#line 968 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 271: // code: "code" ":" "integer"
+#line 1008 "dhcp4_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1821 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1935 "dhcp4_parser.cc"
     break;
 
-  case 264:
-#line 975 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 273: // $@52: %empty
+#line 1015 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1829 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1943 "dhcp4_parser.cc"
     break;
 
-  case 265:
-#line 977 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 274: // option_def_type: "type" $@52 ":" "constant string"
+#line 1017 "dhcp4_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1839 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1953 "dhcp4_parser.cc"
     break;
 
-  case 266:
-#line 983 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 275: // $@53: %empty
+#line 1023 "dhcp4_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1847 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1961 "dhcp4_parser.cc"
     break;
 
-  case 267:
-#line 985 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 276: // option_def_record_types: "record-types" $@53 ":" "constant string"
+#line 1025 "dhcp4_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1857 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1971 "dhcp4_parser.cc"
     break;
 
-  case 268:
-#line 991 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 277: // $@54: %empty
+#line 1031 "dhcp4_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1865 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1979 "dhcp4_parser.cc"
     break;
 
-  case 269:
-#line 993 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 278: // space: "space" $@54 ":" "constant string"
+#line 1033 "dhcp4_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1875 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1989 "dhcp4_parser.cc"
     break;
 
-  case 271:
-#line 1001 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 280: // $@55: %empty
+#line 1041 "dhcp4_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1883 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1997 "dhcp4_parser.cc"
     break;
 
-  case 272:
-#line 1003 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 281: // option_def_encapsulate: "encapsulate" $@55 ":" "constant string"
+#line 1043 "dhcp4_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 1893 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2007 "dhcp4_parser.cc"
     break;
 
-  case 273:
-#line 1009 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 282: // option_def_array: "array" ":" "boolean"
+#line 1049 "dhcp4_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 1902 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2016 "dhcp4_parser.cc"
     break;
 
-  case 274:
-#line 1018 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 283: // $@56: %empty
+#line 1058 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 1913 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2027 "dhcp4_parser.cc"
     break;
 
-  case 275:
-#line 1023 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 284: // option_data_list: "option-data" $@56 ":" "[" option_data_list_content "]"
+#line 1063 "dhcp4_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1922 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2036 "dhcp4_parser.cc"
     break;
 
-  case 280:
-#line 1042 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 289: // $@57: %empty
+#line 1082 "dhcp4_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1932 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2046 "dhcp4_parser.cc"
     break;
 
-  case 281:
-#line 1046 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 290: // option_data_entry: "{" $@57 option_data_params "}"
+#line 1086 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1940 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2054 "dhcp4_parser.cc"
     break;
 
-  case 282:
-#line 1053 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 291: // $@58: %empty
+#line 1093 "dhcp4_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1950 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2064 "dhcp4_parser.cc"
     break;
 
-  case 283:
-#line 1057 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 292: // sub_option_data: "{" $@58 option_data_params "}"
+#line 1097 "dhcp4_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1958 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2072 "dhcp4_parser.cc"
     break;
 
-  case 295:
-#line 1086 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 304: // $@59: %empty
+#line 1126 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1966 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2080 "dhcp4_parser.cc"
     break;
 
-  case 296:
-#line 1088 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 305: // option_data_data: "data" $@59 ":" "constant string"
+#line 1128 "dhcp4_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 1976 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2090 "dhcp4_parser.cc"
     break;
 
-  case 299:
-#line 1098 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 308: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1138 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 1985 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2099 "dhcp4_parser.cc"
     break;
 
-  case 300:
-#line 1106 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 309: // $@60: %empty
+#line 1146 "dhcp4_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 1996 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2110 "dhcp4_parser.cc"
     break;
 
-  case 301:
-#line 1111 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 310: // pools_list: "pools" $@60 ":" "[" pools_list_content "]"
+#line 1151 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2005 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2119 "dhcp4_parser.cc"
     break;
 
-  case 306:
-#line 1126 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 315: // $@61: %empty
+#line 1166 "dhcp4_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2015 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2129 "dhcp4_parser.cc"
     break;
 
-  case 307:
-#line 1130 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 316: // pool_list_entry: "{" $@61 pool_params "}"
+#line 1170 "dhcp4_parser.yy"
+                             {
     ctx.stack_.pop_back();
 }
-#line 2023 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2137 "dhcp4_parser.cc"
     break;
 
-  case 308:
-#line 1134 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 317: // $@62: %empty
+#line 1174 "dhcp4_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2033 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2147 "dhcp4_parser.cc"
     break;
 
-  case 309:
-#line 1138 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 318: // sub_pool4: "{" $@62 pool_params "}"
+#line 1178 "dhcp4_parser.yy"
+                             {
     // parsing completed
 }
-#line 2041 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2155 "dhcp4_parser.cc"
     break;
 
-  case 316:
-#line 1152 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 325: // $@63: %empty
+#line 1192 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2049 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2163 "dhcp4_parser.cc"
     break;
 
-  case 317:
-#line 1154 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 326: // pool_entry: "pool" $@63 ":" "constant string"
+#line 1194 "dhcp4_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2059 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2173 "dhcp4_parser.cc"
     break;
 
-  case 318:
-#line 1160 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 327: // $@64: %empty
+#line 1200 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2067 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2181 "dhcp4_parser.cc"
     break;
 
-  case 319:
-#line 1162 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
+  case 328: // user_context: "user-context" $@64 ":" map_value
+#line 1202 "dhcp4_parser.yy"
+                  {
+    ctx.stack_.back()->set("user-context", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2076 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2190 "dhcp4_parser.cc"
     break;
 
-  case 320:
-#line 1170 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 329: // $@65: %empty
+#line 1210 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2087 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2201 "dhcp4_parser.cc"
     break;
 
-  case 321:
-#line 1175 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 330: // reservations: "reservations" $@65 ":" "[" reservations_list "]"
+#line 1215 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2096 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2210 "dhcp4_parser.cc"
     break;
 
-  case 326:
-#line 1188 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 335: // $@66: %empty
+#line 1228 "dhcp4_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2106 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2220 "dhcp4_parser.cc"
     break;
 
-  case 327:
-#line 1192 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 336: // reservation: "{" $@66 reservation_params "}"
+#line 1232 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2114 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2228 "dhcp4_parser.cc"
     break;
 
-  case 328:
-#line 1196 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 337: // $@67: %empty
+#line 1236 "dhcp4_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2124 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2238 "dhcp4_parser.cc"
     break;
 
-  case 329:
-#line 1200 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 338: // sub_reservation: "{" $@67 reservation_params "}"
+#line 1240 "dhcp4_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2132 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2246 "dhcp4_parser.cc"
     break;
 
-  case 346:
-#line 1227 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 355: // $@68: %empty
+#line 1267 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2140 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2254 "dhcp4_parser.cc"
     break;
 
-  case 347:
-#line 1229 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 356: // next_server: "next-server" $@68 ":" "constant string"
+#line 1269 "dhcp4_parser.yy"
+               {
+    ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2150 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2264 "dhcp4_parser.cc"
     break;
 
-  case 348:
-#line 1235 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 357: // $@69: %empty
+#line 1275 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2158 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2272 "dhcp4_parser.cc"
     break;
 
-  case 349:
-#line 1237 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 358: // server_hostname: "server-hostname" $@69 ":" "constant string"
+#line 1277 "dhcp4_parser.yy"
+               {
+    ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2168 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2282 "dhcp4_parser.cc"
     break;
 
-  case 350:
-#line 1243 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 359: // $@70: %empty
+#line 1283 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2176 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2290 "dhcp4_parser.cc"
     break;
 
-  case 351:
-#line 1245 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 360: // boot_file_name: "boot-file-name" $@70 ":" "constant string"
+#line 1285 "dhcp4_parser.yy"
+               {
+    ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2186 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2300 "dhcp4_parser.cc"
     break;
 
-  case 352:
-#line 1251 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 361: // $@71: %empty
+#line 1291 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2194 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2308 "dhcp4_parser.cc"
     break;
 
-  case 353:
-#line 1253 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 362: // ip_address: "ip-address" $@71 ":" "constant string"
+#line 1293 "dhcp4_parser.yy"
+               {
+    ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2204 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2318 "dhcp4_parser.cc"
     break;
 
-  case 354:
-#line 1259 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 363: // $@72: %empty
+#line 1299 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2212 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2326 "dhcp4_parser.cc"
     break;
 
-  case 355:
-#line 1261 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 364: // duid: "duid" $@72 ":" "constant string"
+#line 1301 "dhcp4_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2222 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2336 "dhcp4_parser.cc"
     break;
 
-  case 356:
-#line 1267 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 365: // $@73: %empty
+#line 1307 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2230 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2344 "dhcp4_parser.cc"
     break;
 
-  case 357:
-#line 1269 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 366: // hw_address: "hw-address" $@73 ":" "constant string"
+#line 1309 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2240 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2354 "dhcp4_parser.cc"
     break;
 
-  case 358:
-#line 1275 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 367: // $@74: %empty
+#line 1315 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2248 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2362 "dhcp4_parser.cc"
     break;
 
-  case 359:
-#line 1277 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 368: // client_id_value: "client-id" $@74 ":" "constant string"
+#line 1317 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2258 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2372 "dhcp4_parser.cc"
     break;
 
-  case 360:
-#line 1283 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 369: // $@75: %empty
+#line 1323 "dhcp4_parser.yy"
+                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2266 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2380 "dhcp4_parser.cc"
     break;
 
-  case 361:
-#line 1285 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 370: // circuit_id_value: "circuit-id" $@75 ":" "constant string"
+#line 1325 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2276 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2390 "dhcp4_parser.cc"
     break;
 
-  case 362:
-#line 1292 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 371: // $@76: %empty
+#line 1332 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2284 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2398 "dhcp4_parser.cc"
     break;
 
-  case 363:
-#line 1294 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 372: // hostname: "hostname" $@76 ":" "constant string"
+#line 1334 "dhcp4_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2294 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2408 "dhcp4_parser.cc"
     break;
 
-  case 364:
-#line 1300 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 373: // $@77: %empty
+#line 1340 "dhcp4_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2305 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2419 "dhcp4_parser.cc"
     break;
 
-  case 365:
-#line 1305 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 374: // reservation_client_classes: "client-classes" $@77 ":" list_strings
+#line 1345 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2314 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2428 "dhcp4_parser.cc"
     break;
 
-  case 366:
-#line 1313 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 375: // $@78: %empty
+#line 1353 "dhcp4_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2325 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2439 "dhcp4_parser.cc"
     break;
 
-  case 367:
-#line 1318 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 376: // relay: "relay" $@78 ":" "{" relay_map "}"
+#line 1358 "dhcp4_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2334 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2448 "dhcp4_parser.cc"
     break;
 
-  case 368:
-#line 1323 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 377: // $@79: %empty
+#line 1363 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2342 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2456 "dhcp4_parser.cc"
     break;
 
-  case 369:
-#line 1325 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 378: // relay_map: "ip-address" $@79 ":" "constant string"
+#line 1365 "dhcp4_parser.yy"
+               {
+    ElementPtr ip(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2352 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2466 "dhcp4_parser.cc"
     break;
 
-  case 370:
-#line 1334 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 379: // $@80: %empty
+#line 1374 "dhcp4_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2363 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2477 "dhcp4_parser.cc"
     break;
 
-  case 371:
-#line 1339 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 380: // client_classes: "client-classes" $@80 ":" "[" client_classes_list "]"
+#line 1379 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2372 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2486 "dhcp4_parser.cc"
     break;
 
-  case 374:
-#line 1348 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 383: // $@81: %empty
+#line 1388 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2382 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2496 "dhcp4_parser.cc"
     break;
 
-  case 375:
-#line 1352 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 384: // client_class: "{" $@81 client_class_params "}"
+#line 1392 "dhcp4_parser.yy"
+                                     {
     ctx.stack_.pop_back();
 }
-#line 2390 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2504 "dhcp4_parser.cc"
     break;
 
-  case 388:
-#line 1375 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 397: // $@82: %empty
+#line 1415 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2398 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2512 "dhcp4_parser.cc"
     break;
 
-  case 389:
-#line 1377 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 398: // client_class_test: "test" $@82 ":" "constant string"
+#line 1417 "dhcp4_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2408 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2522 "dhcp4_parser.cc"
     break;
 
-  case 390:
-#line 1387 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 399: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1427 "dhcp4_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2417 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2531 "dhcp4_parser.cc"
     break;
 
-  case 391:
-#line 1394 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 400: // packet_timeline: "packet-timeline" ":" "boolean"
+#line 1432 "dhcp4_parser.yy"
+                                               {
+    ElementPtr timeline(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("packet-timeline", timeline);
+}
+#line 2540 "dhcp4_parser.cc"
+    break;
+
+  case 401: // $@83: %empty
+#line 1439 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2428 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2551 "dhcp4_parser.cc"
     break;
 
-  case 392:
-#line 1399 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 402: // control_socket: "control-socket" $@83 ":" "{" control_socket_params "}"
+#line 1444 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2437 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2560 "dhcp4_parser.cc"
     break;
 
-  case 397:
-#line 1412 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 407: // $@84: %empty
+#line 1457 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2445 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2568 "dhcp4_parser.cc"
     break;
 
-  case 398:
-#line 1414 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 408: // control_socket_type: "socket-type" $@84 ":" "constant string"
+#line 1459 "dhcp4_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2455 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2578 "dhcp4_parser.cc"
     break;
 
-  case 399:
-#line 1420 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 409: // $@85: %empty
+#line 1465 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2463 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2586 "dhcp4_parser.cc"
     break;
 
-  case 400:
-#line 1422 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 410: // control_socket_name: "socket-name" $@85 ":" "constant string"
+#line 1467 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2473 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2596 "dhcp4_parser.cc"
     break;
 
-  case 401:
-#line 1430 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 411: // $@86: %empty
+#line 1475 "dhcp4_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2484 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2607 "dhcp4_parser.cc"
     break;
 
-  case 402:
-#line 1435 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 412: // dhcp_ddns: "dhcp-ddns" $@86 ":" "{" dhcp_ddns_params "}"
+#line 1480 "dhcp4_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2493 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2616 "dhcp4_parser.cc"
     break;
 
-  case 403:
-#line 1440 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 413: // $@87: %empty
+#line 1485 "dhcp4_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2503 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2626 "dhcp4_parser.cc"
     break;
 
-  case 404:
-#line 1444 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 414: // sub_dhcp_ddns: "{" $@87 dhcp_ddns_params "}"
+#line 1489 "dhcp4_parser.yy"
+                                  {
     // parsing completed
 }
-#line 2511 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2634 "dhcp4_parser.cc"
     break;
 
-  case 423:
-#line 1470 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 433: // enable_updates: "enable-updates" ":" "boolean"
+#line 1515 "dhcp4_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2520 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2643 "dhcp4_parser.cc"
     break;
 
-  case 424:
-#line 1475 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 434: // $@88: %empty
+#line 1520 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2528 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2651 "dhcp4_parser.cc"
     break;
 
-  case 425:
-#line 1477 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 435: // qualifying_suffix: "qualifying-suffix" $@88 ":" "constant string"
+#line 1522 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2538 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2661 "dhcp4_parser.cc"
     break;
 
-  case 426:
-#line 1483 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 436: // $@89: %empty
+#line 1528 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2546 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2669 "dhcp4_parser.cc"
     break;
 
-  case 427:
-#line 1485 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 437: // server_ip: "server-ip" $@89 ":" "constant string"
+#line 1530 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2556 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2679 "dhcp4_parser.cc"
     break;
 
-  case 428:
-#line 1491 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 438: // server_port: "server-port" ":" "integer"
+#line 1536 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2565 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2688 "dhcp4_parser.cc"
     break;
 
-  case 429:
-#line 1496 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 439: // $@90: %empty
+#line 1541 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2573 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2696 "dhcp4_parser.cc"
     break;
 
-  case 430:
-#line 1498 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 440: // sender_ip: "sender-ip" $@90 ":" "constant string"
+#line 1543 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2583 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2706 "dhcp4_parser.cc"
     break;
 
-  case 431:
-#line 1504 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 441: // sender_port: "sender-port" ":" "integer"
+#line 1549 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2592 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2715 "dhcp4_parser.cc"
     break;
 
-  case 432:
-#line 1509 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 442: // max_queue_size: "max-queue-size" ":" "integer"
+#line 1554 "dhcp4_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2601 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2724 "dhcp4_parser.cc"
     break;
 
-  case 433:
-#line 1514 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 443: // $@91: %empty
+#line 1559 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2609 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2732 "dhcp4_parser.cc"
     break;
 
-  case 434:
-#line 1516 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 444: // ncr_protocol: "ncr-protocol" $@91 ":" ncr_protocol_value
+#line 1561 "dhcp4_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2618 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2741 "dhcp4_parser.cc"
     break;
 
-  case 435:
-#line 1522 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2624 "dhcp4_parser.cc" // lalr1.cc:859
+  case 445: // ncr_protocol_value: "udp"
+#line 1567 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 2747 "dhcp4_parser.cc"
     break;
 
-  case 436:
-#line 1523 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2630 "dhcp4_parser.cc" // lalr1.cc:859
+  case 446: // ncr_protocol_value: "tcp"
+#line 1568 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 2753 "dhcp4_parser.cc"
     break;
 
-  case 437:
-#line 1526 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 447: // $@92: %empty
+#line 1571 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2638 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2761 "dhcp4_parser.cc"
     break;
 
-  case 438:
-#line 1528 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 448: // ncr_format: "ncr-format" $@92 ":" ncr_format_value
+#line 1573 "dhcp4_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2648 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2770 "dhcp4_parser.cc"
     break;
 
-  case 439:
-#line 1534 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 449: // ncr_format_value: "JSON"
+#line 1579 "dhcp4_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 2776 "dhcp4_parser.cc"
+    break;
+
+  case 450: // ncr_format_value: "BINARY"
+#line 1580 "dhcp4_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 2782 "dhcp4_parser.cc"
+    break;
+
+  case 451: // always_include_fqdn: "always-include-fqdn" ":" "boolean"
+#line 1583 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2657 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2791 "dhcp4_parser.cc"
     break;
 
-  case 440:
-#line 1539 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 452: // allow_client_update: "allow-client-update" ":" "boolean"
+#line 1588 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("allow-client-update",  b);
 }
-#line 2666 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2800 "dhcp4_parser.cc"
     break;
 
-  case 441:
-#line 1544 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 453: // override_no_update: "override-no-update" ":" "boolean"
+#line 1593 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2675 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2809 "dhcp4_parser.cc"
     break;
 
-  case 442:
-#line 1549 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 454: // override_client_update: "override-client-update" ":" "boolean"
+#line 1598 "dhcp4_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2684 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2818 "dhcp4_parser.cc"
     break;
 
-  case 443:
-#line 1554 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 455: // $@93: %empty
+#line 1603 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2692 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2826 "dhcp4_parser.cc"
     break;
 
-  case 444:
-#line 1556 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 456: // replace_client_name: "replace-client-name" $@93 ":" replace_client_name_value
+#line 1605 "dhcp4_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2701 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2835 "dhcp4_parser.cc"
     break;
 
-  case 445:
-#line 1562 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
+  case 457: // replace_client_name_value: "when-present"
+#line 1611 "dhcp4_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2709 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2843 "dhcp4_parser.cc"
     break;
 
-  case 446:
-#line 1565 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 458: // replace_client_name_value: "never"
+#line 1614 "dhcp4_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2717 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2851 "dhcp4_parser.cc"
     break;
 
-  case 447:
-#line 1568 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 459: // replace_client_name_value: "always"
+#line 1617 "dhcp4_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2725 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2859 "dhcp4_parser.cc"
     break;
 
-  case 448:
-#line 1571 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 460: // replace_client_name_value: "when-not-present"
+#line 1620 "dhcp4_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2733 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2867 "dhcp4_parser.cc"
     break;
 
-  case 449:
-#line 1574 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 461: // replace_client_name_value: "boolean"
+#line 1623 "dhcp4_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2742 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2876 "dhcp4_parser.cc"
     break;
 
-  case 450:
-#line 1580 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 462: // $@94: %empty
+#line 1629 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2750 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2884 "dhcp4_parser.cc"
     break;
 
-  case 451:
-#line 1582 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 463: // generated_prefix: "generated-prefix" $@94 ":" "constant string"
+#line 1631 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 2760 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2894 "dhcp4_parser.cc"
     break;
 
-  case 452:
-#line 1590 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 464: // $@95: %empty
+#line 1639 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2768 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2902 "dhcp4_parser.cc"
     break;
 
-  case 453:
-#line 1592 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 465: // dhcp6_json_object: "Dhcp6" $@95 ":" value
+#line 1641 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2777 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2911 "dhcp4_parser.cc"
     break;
 
-  case 454:
-#line 1597 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 466: // $@96: %empty
+#line 1646 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2785 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2919 "dhcp4_parser.cc"
     break;
 
-  case 455:
-#line 1599 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 467: // dhcpddns_json_object: "DhcpDdns" $@96 ":" value
+#line 1648 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2794 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2928 "dhcp4_parser.cc"
     break;
 
-  case 456:
-#line 1609 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 468: // $@97: %empty
+#line 1658 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 2805 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2939 "dhcp4_parser.cc"
     break;
 
-  case 457:
-#line 1614 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 469: // logging_object: "Logging" $@97 ":" "{" logging_params "}"
+#line 1663 "dhcp4_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2814 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2948 "dhcp4_parser.cc"
     break;
 
-  case 461:
-#line 1631 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 474: // $@98: %empty
+#line 1681 "dhcp4_parser.yy"
+                     {
+    ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", m);
+    ctx.stack_.push_back(m);
+    ctx.enter(ctx.ASYNC_LOGGING);
+}
+#line 2959 "dhcp4_parser.cc"
+    break;
+
+  case 475: // async_logging: "async" $@98 ":" "{" async_logging_params "}"
+#line 1686 "dhcp4_parser.yy"
+                                                           {
+    ctx.stack_.pop_back();
+    ctx.leave();
+}
+#line 2968 "dhcp4_parser.cc"
+    break;
+
+  case 481: // queue_size: "queue-size" ":" "integer"
+#line 1700 "dhcp4_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 2977 "dhcp4_parser.cc"
+    break;
+
+  case 482: // $@99: %empty
+#line 1705 "dhcp4_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 2985 "dhcp4_parser.cc"
+    break;
+
+  case 483: // overflow_policy: "overflow-policy" $@99 ":" "constant string"
+#line 1707 "dhcp4_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 2995 "dhcp4_parser.cc"
+    break;
+
+  case 484: // $@100: %empty
+#line 1715 "dhcp4_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 2825 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3006 "dhcp4_parser.cc"
     break;
 
-  case 462:
-#line 1636 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 485: // loggers: "loggers" $@100 ":" "[" loggers_entries "]"
+#line 1720 "dhcp4_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2834 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3015 "dhcp4_parser.cc"
     break;
 
-  case 465:
-#line 1648 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 488: // $@101: %empty
+#line 1732 "dhcp4_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 2844 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3025 "dhcp4_parser.cc"
     break;
 
-  case 466:
-#line 1652 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 489: // logger_entry: "{" $@101 logger_params "}"
+#line 1736 "dhcp4_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 2852 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3033 "dhcp4_parser.cc"
     break;
 
-  case 474:
-#line 1667 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 498: // debuglevel: "debuglevel" ":" "integer"
+#line 1752 "dhcp4_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 2861 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3042 "dhcp4_parser.cc"
     break;
 
-  case 475:
-#line 1672 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 499: // $@102: %empty
+#line 1757 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2869 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3050 "dhcp4_parser.cc"
     break;
 
-  case 476:
-#line 1674 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 500: // severity: "severity" $@102 ":" "constant string"
+#line 1759 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 2879 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3060 "dhcp4_parser.cc"
     break;
 
-  case 477:
-#line 1680 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 501: // $@103: %empty
+#line 1765 "dhcp4_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 2890 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3071 "dhcp4_parser.cc"
     break;
 
-  case 478:
-#line 1685 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 502: // output_options_list: "output_options" $@103 ":" "[" output_options_list_content "]"
+#line 1770 "dhcp4_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2899 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3080 "dhcp4_parser.cc"
     break;
 
-  case 481:
-#line 1694 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 505: // $@104: %empty
+#line 1779 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2909 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3090 "dhcp4_parser.cc"
     break;
 
-  case 482:
-#line 1698 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 506: // output_entry: "{" $@104 output_params "}"
+#line 1783 "dhcp4_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 2917 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3098 "dhcp4_parser.cc"
     break;
 
-  case 485:
-#line 1706 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 509: // $@105: %empty
+#line 1791 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2925 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3106 "dhcp4_parser.cc"
     break;
 
-  case 486:
-#line 1708 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 510: // output_param: "output" $@105 ":" "constant string"
+#line 1793 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 2935 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3116 "dhcp4_parser.cc"
+    break;
+
+  case 511: // $@106: %empty
+#line 1801 "dhcp4_parser.yy"
+                              {
+    ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limits", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.RATE_LIMITS);
+}
+#line 3127 "dhcp4_parser.cc"
+    break;
+
+  case 512: // rate_limits_list: "rate-limits" $@106 ":" "[" rate_limits_list_content "]"
+#line 1806 "dhcp4_parser.yy"
+                                                                 {
+    ctx.stack_.pop_back();
+    ctx.leave();
+}
+#line 3136 "dhcp4_parser.cc"
     break;
 
+  case 517: // $@107: %empty
+#line 1819 "dhcp4_parser.yy"
+                                 {
+    ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->add(m);
+    ctx.stack_.push_back(m);
+}
+#line 3146 "dhcp4_parser.cc"
+    break;
+
+  case 518: // rate_limit_entry: "{" $@107 rate_limit_params "}"
+#line 1823 "dhcp4_parser.yy"
+                                   {
+    ctx.stack_.pop_back();
+}
+#line 3154 "dhcp4_parser.cc"
+    break;
+
+  case 525: // $@108: %empty
+#line 1837 "dhcp4_parser.yy"
+                            {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3162 "dhcp4_parser.cc"
+    break;
+
+  case 526: // rate_limit_message: "message" $@108 ":" "constant string"
+#line 1839 "dhcp4_parser.yy"
+               {
+    ElementPtr msg(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("message", msg);
+    ctx.leave();
+}
+#line 3172 "dhcp4_parser.cc"
+    break;
+
+  case 527: // rate_limit_sample: "sample" ":" "integer"
+#line 1845 "dhcp4_parser.yy"
+                                        {
+    ElementPtr sample(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("sample", sample);
+}
+#line 3181 "dhcp4_parser.cc"
+    break;
+
+  case 528: // rate_limit_rate: "rate" ":" "integer"
+#line 1850 "dhcp4_parser.yy"
+                                    {
+    ElementPtr rate(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate", rate);
+}
+#line 3190 "dhcp4_parser.cc"
+    break;
+
+  case 529: // rate_limit_interval: "interval" ":" "integer"
+#line 1855 "dhcp4_parser.yy"
+                                            {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("interval", interval);
+}
+#line 3199 "dhcp4_parser.cc"
+    break;
+
+
+#line 3203 "dhcp4_parser.cc"
 
-#line 2939 "dhcp4_parser.cc" // lalr1.cc:859
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -2963,7 +3231,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -2974,7 +3244,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -2991,69 +3261,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3061,6 +3343,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3069,12 +3352,12 @@ namespace isc { namespace dhcp {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -3085,26 +3368,112 @@ namespace isc { namespace dhcp {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   Dhcp4Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp4Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp4Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp4Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp4Parser::context.
+  Dhcp4Parser::context::context (const Dhcp4Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp4Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
 
+  int
+  Dhcp4Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3123,41 +3492,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp4Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3166,22 +3526,23 @@ namespace isc { namespace dhcp {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -3190,549 +3551,588 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp4Parser::yypact_ninf_ = -473;
+  const short Dhcp4Parser::yypact_ninf_ = -476;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   Dhcp4Parser::yypact_[] =
   {
-     121,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,    32,    19,    23,    45,    56,    74,    82,    86,
-     104,   115,   119,   148,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,    19,   -92,    17,    29,
-     154,    18,   -13,    68,    57,    52,    -6,   123,  -473,   169,
-     125,   205,   184,   226,  -473,  -473,  -473,  -473,   255,  -473,
-      30,  -473,  -473,  -473,  -473,  -473,  -473,   262,   263,  -473,
-    -473,  -473,   265,   267,   269,   270,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   271,  -473,  -473,  -473,    31,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,    40,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   273,   274,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,    41,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,    53,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-     272,   278,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,   280,  -473,  -473,  -473,   281,
-    -473,  -473,   279,   286,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,   288,  -473,  -473,  -473,  -473,
-     285,   291,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,   116,  -473,  -473,  -473,   295,  -473,  -473,   296,  -473,
-     298,   299,  -473,  -473,   300,   301,   302,   303,  -473,  -473,
-    -473,   122,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,    19,
-      19,  -473,   180,   304,   307,   309,   310,  -473,    17,  -473,
-     311,   187,   190,   312,   313,   314,   193,   194,   195,   197,
-     316,   322,   324,   325,   326,   327,   328,   203,   330,   331,
-      29,  -473,   332,   333,   154,  -473,    76,   334,   335,   336,
-     337,   338,   339,   342,   217,   216,   345,   346,   347,   348,
-      18,  -473,   349,   350,   -13,  -473,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,  -473,    68,   360,   361,   237,
-     362,   364,   365,   238,  -473,    57,   367,   240,  -473,    52,
-     369,   370,   186,  -473,   243,   372,   373,   248,   375,   250,
-     251,   378,   379,   252,   253,   254,   256,   383,   385,   123,
-    -473,  -473,  -473,   386,   384,   387,    19,    19,  -473,   388,
-    -473,  -473,   264,   389,   390,  -473,  -473,  -473,  -473,   393,
-     394,   395,   396,   397,   398,   399,  -473,   400,   401,  -473,
-     404,   236,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-     402,   408,  -473,  -473,  -473,   275,   276,   283,   409,   284,
-     287,   289,  -473,  -473,   290,   292,   410,   413,  -473,   294,
-     417,  -473,   305,   306,   404,   308,   317,   318,   319,   321,
-     323,  -473,   329,   340,  -473,   341,   343,   344,  -473,  -473,
-     363,  -473,  -473,   366,    19,  -473,  -473,   368,   371,  -473,
-     374,  -473,  -473,    14,   320,  -473,  -473,  -473,  -473,    36,
-     376,  -473,    19,    29,   377,  -473,  -473,   154,  -473,   131,
-     131,   421,   422,   423,   166,    50,   426,    91,   177,   123,
-    -473,  -473,  -473,  -473,  -473,   432,  -473,    76,  -473,  -473,
-    -473,   431,  -473,  -473,  -473,  -473,  -473,   435,   380,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,   149,  -473,   175,  -473,  -473,   179,
-    -473,  -473,  -473,  -473,   439,   441,   447,   450,  -473,   181,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-     182,  -473,   411,   436,  -473,  -473,   449,   454,  -473,  -473,
-     455,   457,  -473,  -473,  -473,  -473,  -473,    79,  -473,  -473,
-    -473,  -473,  -473,  -473,   126,  -473,   456,   460,  -473,   461,
-     462,   463,   464,   467,   470,   185,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,   188,  -473,  -473,  -473,   192,
-     381,   382,  -473,  -473,   458,   472,  -473,  -473,   471,   473,
-    -473,  -473,   474,  -473,   475,   377,  -473,  -473,   476,   477,
-     479,   480,   260,   391,   392,   403,   131,  -473,  -473,    18,
-    -473,   421,    57,  -473,   422,    52,  -473,   423,   166,  -473,
-      50,  -473,    -6,  -473,   426,   405,   406,   407,   412,   414,
-     415,    91,  -473,   481,   482,   177,  -473,  -473,  -473,   483,
-     484,  -473,   -13,  -473,   431,    68,  -473,   435,   486,  -473,
-     488,  -473,   230,   418,   419,   420,  -473,  -473,  -473,  -473,
-    -473,   196,  -473,   490,  -473,   491,  -473,  -473,  -473,   198,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,   424,   425,
-    -473,  -473,   427,   199,  -473,   493,  -473,   428,   487,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,   150,  -473,
-      65,   487,  -473,  -473,   492,  -473,  -473,  -473,   200,  -473,
-    -473,  -473,  -473,  -473,   498,   416,   500,    65,  -473,   501,
-    -473,   429,  -473,   502,  -473,  -473,   225,  -473,   430,   502,
-    -473,  -473,   224,  -473,  -473,   503,   430,  -473,   433,  -473,
-    -473
+     194,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,    30,    18,    49,    63,   109,   122,   248,   265,
+     267,   269,   270,   271,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,    18,   -95,    16,    33,
+     183,    22,   -16,    83,    64,   -14,   -33,    84,  -476,    86,
+     141,   170,   212,   224,  -476,  -476,  -476,  -476,   237,  -476,
+      40,  -476,  -476,  -476,  -476,  -476,  -476,   243,   276,  -476,
+    -476,  -476,   277,   279,   280,   283,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,   284,   286,  -476,  -476,  -476,    50,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,    56,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,   288,   291,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,    60,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,    85,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,   289,   293,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,   298,  -476,  -476,
+    -476,   299,  -476,  -476,   297,   303,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,   304,  -476,  -476,
+    -476,  -476,   301,   307,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,   103,  -476,  -476,  -476,   308,  -476,  -476,
+     310,  -476,   312,   313,  -476,  -476,   314,   315,   316,   317,
+    -476,  -476,  -476,   139,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,    18,    18,  -476,   165,   318,   319,   332,   333,  -476,
+      16,  -476,   334,   166,   195,   335,   337,   338,   200,   201,
+     202,   203,   345,   346,   347,   348,   349,   350,   351,   215,
+     211,   353,   355,    33,  -476,   356,   357,   183,  -476,    76,
+     358,   359,   360,   361,   362,   363,   364,   229,   225,   365,
+     367,   369,   370,    22,  -476,   371,   372,   -16,  -476,   373,
+     374,   375,   376,   377,   378,   379,   380,   381,  -476,    83,
+     382,   383,   245,   385,   386,   387,   247,  -476,    64,   389,
+     249,  -476,   -14,   391,   392,    -2,  -476,   252,   394,   395,
+     257,   397,   259,   260,   400,   401,   261,   262,   263,   264,
+     406,   407,    84,  -476,  -476,  -476,   408,   409,   410,    18,
+      18,  -476,   411,  -476,  -476,   272,   412,   413,  -476,  -476,
+    -476,  -476,   416,   417,   418,   419,   420,   422,   421,  -476,
+    -476,   425,   426,  -476,   424,   193,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,   405,   431,  -476,  -476,  -476,   273,
+     295,   296,   434,   300,   305,   309,  -476,  -476,   320,   322,
+     435,   436,  -476,   323,   439,  -476,   324,   325,   424,   326,
+     327,   328,   329,   330,   331,  -476,   336,   339,  -476,   340,
+     341,   342,  -476,  -476,   343,  -476,  -476,   344,    18,  -476,
+    -476,   352,   354,  -476,   366,  -476,  -476,    42,   157,  -476,
+    -476,  -476,  -476,    54,   368,  -476,    18,    33,    77,  -476,
+    -476,   183,  -476,   104,   104,   442,   443,   445,   181,    21,
+     447,   119,   179,    84,  -476,  -476,  -476,  -476,  -476,   437,
+    -476,    76,  -476,  -476,  -476,   448,  -476,  -476,  -476,  -476,
+    -476,   449,   398,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+     189,  -476,  -476,   206,  -476,  -476,  -476,   207,  -476,  -476,
+    -476,  -476,   453,   454,  -476,   455,  -476,   457,   471,  -476,
+     213,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,   214,  -476,   470,   474,  -476,  -476,
+     473,   477,  -476,  -476,   481,   485,  -476,  -476,  -476,  -476,
+    -476,   101,  -476,  -476,  -476,  -476,  -476,  -476,   102,  -476,
+     483,   487,  -476,   488,   489,   491,   493,   494,   495,   216,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,   220,
+    -476,  -476,  -476,   226,   384,   388,  -476,  -476,   496,   497,
+    -476,  -476,   498,   500,  -476,  -476,   499,  -476,   501,   502,
+      77,  -476,  -476,   505,   507,   508,   509,   390,   393,   510,
+     396,   511,   399,   402,   104,  -476,  -476,    22,  -476,   442,
+      64,  -476,   443,   -14,  -476,   445,   181,  -476,    21,  -476,
+     -33,  -476,   447,   403,   404,   414,   415,   423,   427,   119,
+    -476,   512,   513,   179,  -476,  -476,  -476,   514,   515,  -476,
+     -16,  -476,   448,    83,  -476,   449,   517,  -476,   486,   516,
+    -476,   233,   429,   430,   432,  -476,  -476,   433,  -476,   438,
+    -476,  -476,  -476,   227,  -476,   519,  -476,   520,  -476,  -476,
+    -476,   228,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+     440,   441,  -476,  -476,   444,   230,  -476,   521,  -476,   446,
+     518,   -90,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,   145,  -476,   527,  -476,  -476,   234,  -476,
+    -476,  -476,    52,   518,  -476,   450,   528,   -90,  -476,  -476,
+     529,  -476,  -476,  -476,  -476,   240,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,   452,  -476,   530,   456,   532,   533,    52,
+    -476,  -476,   535,  -476,   458,   536,  -476,   541,  -476,   542,
+    -476,   167,  -476,  -476,   537,   539,  -476,   451,   541,  -476,
+     137,  -476,   542,  -476,   241,  -476,  -476,  -476,   546,   547,
+     548,   242,  -476,  -476,  -476,  -476,  -476,  -476,   549,   451,
+    -476,   550,   459,   460,   461,   137,  -476,   463,  -476,   464,
+    -476,  -476,  -476,  -476,  -476,  -476
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     1,    39,    32,    28,    27,    24,
       25,    26,    31,     3,    29,    30,    52,     5,    63,     7,
-     100,     9,   197,    11,   308,    13,   328,    15,   247,    17,
-     282,    19,   162,    21,   403,    23,    41,    35,     0,     0,
-       0,     0,     0,   330,   249,   284,     0,     0,    43,     0,
-      42,     0,     0,    36,    61,   456,   452,   454,     0,    60,
-       0,    54,    56,    58,    59,    57,    94,     0,     0,   346,
-     108,   110,     0,     0,     0,     0,   189,   239,   274,   142,
-     370,   154,   173,     0,   391,   401,    87,     0,    65,    67,
-      68,    69,    70,    84,    85,    72,    73,    74,    75,    79,
-      80,    71,    77,    78,    86,    76,    81,    82,    83,   102,
-     104,     0,    96,    98,    99,   374,   223,   225,   227,   300,
-     221,   229,   231,     0,     0,   235,   233,   320,   366,   220,
-     201,   202,   203,   215,     0,   199,   206,   217,   218,   219,
-     207,   208,   211,   213,   209,   210,   204,   205,   212,   216,
-     214,   316,   318,   315,   313,     0,   310,   312,   314,   348,
-     350,   364,   354,   356,   360,   358,   362,   352,   345,   341,
-       0,   331,   332,   342,   343,   344,   338,   334,   339,   336,
-     337,   340,   335,   264,   136,     0,   268,   266,   271,     0,
-     260,   261,     0,   250,   251,   253,   263,   254,   255,   256,
-     270,   257,   258,   259,   295,     0,   293,   294,   297,   298,
-       0,   285,   286,   288,   289,   290,   291,   292,   169,   171,
-     166,     0,   164,   167,   168,     0,   424,   426,     0,   429,
-       0,     0,   433,   437,     0,     0,     0,     0,   443,   450,
-     422,     0,   405,   407,   408,   409,   410,   411,   412,   413,
-     414,   415,   416,   417,   418,   419,   420,   421,    40,     0,
-       0,    33,     0,     0,     0,     0,     0,    51,     0,    53,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     101,     9,   206,    11,   317,    13,   337,    15,   256,    17,
+     291,    19,   171,    21,   413,    23,    41,    35,     0,     0,
+       0,     0,     0,   339,   258,   293,     0,     0,    43,     0,
+      42,     0,     0,    36,    61,   468,   464,   466,     0,    60,
+       0,    54,    56,    58,    59,    57,    95,     0,     0,   355,
+     109,   111,     0,     0,     0,     0,   198,   248,   283,   151,
+     379,   163,   182,     0,     0,   401,   411,    88,     0,    65,
+      67,    68,    69,    70,    85,    86,    72,    73,    74,    75,
+      79,    80,    71,    77,    78,    87,    76,    81,    82,    83,
+      84,   103,   105,     0,    97,    99,   100,   383,   232,   234,
+     236,   309,   230,   238,   240,     0,     0,   244,   242,   329,
+     375,   229,   210,   211,   212,   224,     0,   208,   215,   226,
+     227,   228,   216,   217,   220,   222,   218,   219,   213,   214,
+     221,   225,   223,   325,   327,   324,   322,     0,   319,   321,
+     323,   357,   359,   373,   363,   365,   369,   367,   371,   361,
+     354,   350,     0,   340,   341,   351,   352,   353,   347,   343,
+     348,   345,   346,   349,   344,   273,   140,     0,   277,   275,
+     280,     0,   269,   270,     0,   259,   260,   262,   272,   263,
+     264,   265,   279,   266,   267,   268,   304,     0,   302,   303,
+     306,   307,     0,   294,   295,   297,   298,   299,   300,   301,
+     178,   180,   175,     0,   173,   176,   177,     0,   434,   436,
+       0,   439,     0,     0,   443,   447,     0,     0,     0,     0,
+     455,   462,   432,     0,   415,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+      40,     0,     0,    33,     0,     0,     0,     0,     0,    51,
+       0,    53,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    64,     0,     0,     0,   101,   376,     0,     0,     0,
+       0,     0,     0,     0,    64,     0,     0,     0,   102,   385,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   198,     0,     0,     0,   309,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   329,     0,     0,     0,     0,
-       0,     0,     0,     0,   248,     0,     0,     0,   283,     0,
-       0,     0,     0,   163,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   207,     0,     0,     0,   318,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   338,     0,
+       0,     0,     0,     0,     0,     0,     0,   257,     0,     0,
+       0,   292,     0,     0,     0,     0,   172,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     404,    44,    37,     0,     0,     0,     0,     0,    55,     0,
-      92,    93,     0,     0,     0,    88,    89,    90,    91,     0,
-       0,     0,     0,     0,     0,     0,   390,     0,     0,    66,
-       0,     0,    97,   388,   386,   387,   382,   383,   384,   385,
-       0,   377,   378,   380,   381,     0,     0,     0,     0,     0,
-       0,     0,   237,   238,     0,     0,     0,     0,   200,     0,
-       0,   311,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   333,     0,     0,   262,     0,     0,     0,   273,   252,
-       0,   299,   287,     0,     0,   165,   423,     0,     0,   428,
-       0,   431,   432,     0,     0,   439,   440,   441,   442,     0,
-       0,   406,     0,     0,     0,   453,   455,     0,   347,     0,
-       0,   191,   241,   276,     0,     0,   156,     0,     0,     0,
-      45,   103,   106,   107,   105,     0,   375,     0,   224,   226,
-     228,   302,   222,   230,   232,   236,   234,   322,     0,   317,
-      34,   319,   349,   351,   365,   355,   357,   361,   359,   363,
-     353,   265,   137,   269,   267,   272,   296,   170,   172,   425,
-     427,   430,   435,   436,   434,   438,   445,   446,   447,   448,
-     449,   444,   451,    38,     0,   461,     0,   458,   460,     0,
-     124,   130,   132,   134,     0,     0,     0,     0,   123,     0,
-     112,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-       0,   195,     0,   192,   193,   245,     0,   242,   243,   280,
-       0,   277,   278,   150,   151,   152,   153,     0,   144,   146,
-     147,   148,   149,   372,     0,   160,     0,   157,   158,     0,
-       0,     0,     0,     0,     0,     0,   175,   177,   178,   179,
-     180,   181,   182,   397,   399,     0,   393,   395,   396,     0,
-      47,     0,   379,   306,     0,   303,   304,   326,     0,   323,
-     324,   368,     0,    62,     0,     0,   457,    95,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   109,   111,     0,
-     190,     0,   249,   240,     0,   284,   275,     0,     0,   143,
-       0,   371,     0,   155,     0,     0,     0,     0,     0,     0,
-       0,     0,   174,     0,     0,     0,   392,   402,    49,     0,
-      48,   389,     0,   301,     0,   330,   321,     0,     0,   367,
-       0,   459,     0,     0,     0,     0,   138,   139,   140,   141,
-     113,     0,   194,     0,   244,     0,   279,   145,   373,     0,
-     159,   183,   184,   185,   186,   187,   188,   176,     0,     0,
-     394,    46,     0,     0,   305,     0,   325,     0,     0,   126,
-     127,   128,   129,   125,   131,   133,   135,   196,   246,   281,
-     161,   398,   400,    50,   307,   327,   369,   465,     0,   463,
-       0,     0,   462,   477,     0,   475,   473,   469,     0,   467,
-     471,   472,   470,   464,     0,     0,     0,     0,   466,     0,
-     474,     0,   468,     0,   476,   481,     0,   479,     0,     0,
-     478,   485,     0,   483,   480,     0,     0,   482,     0,   484,
-     486
+       0,     0,     0,   414,    44,    37,     0,     0,     0,     0,
+       0,    55,     0,    93,    94,     0,     0,     0,    89,    90,
+      91,    92,     0,     0,     0,     0,     0,     0,     0,   399,
+     400,     0,     0,    66,     0,     0,    98,   397,   395,   396,
+     391,   392,   393,   394,     0,   386,   387,   389,   390,     0,
+       0,     0,     0,     0,     0,     0,   246,   247,     0,     0,
+       0,     0,   209,     0,     0,   320,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   342,     0,     0,   271,     0,
+       0,     0,   282,   261,     0,   308,   296,     0,     0,   174,
+     433,     0,     0,   438,     0,   441,   442,     0,     0,   451,
+     452,   453,   454,     0,     0,   416,     0,     0,     0,   465,
+     467,     0,   356,     0,     0,   200,   250,   285,     0,     0,
+     165,     0,     0,     0,    45,   104,   107,   108,   106,     0,
+     384,     0,   233,   235,   237,   311,   231,   239,   241,   245,
+     243,   331,     0,   326,    34,   328,   358,   360,   374,   364,
+     366,   370,   368,   372,   362,   274,   141,   278,   276,   281,
+     305,   179,   181,   435,   437,   440,   445,   446,   444,   449,
+     450,   448,   457,   458,   459,   460,   461,   456,   463,    38,
+       0,   484,   474,     0,   470,   473,   472,     0,   128,   134,
+     136,   138,     0,     0,   144,     0,   146,     0,     0,   127,
+       0,   113,   115,   116,   117,   118,   119,   120,   121,   122,
+     124,   123,   125,   126,     0,   204,     0,   201,   202,   254,
+       0,   251,   252,   289,     0,   286,   287,   159,   160,   161,
+     162,     0,   153,   155,   156,   157,   158,   381,     0,   169,
+       0,   166,   167,     0,     0,     0,     0,     0,     0,     0,
+     184,   186,   187,   188,   189,   190,   191,   407,   409,     0,
+     403,   405,   406,     0,    47,     0,   388,   315,     0,   312,
+     313,   335,     0,   332,   333,   377,     0,    62,     0,     0,
+       0,   469,    96,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   110,   112,     0,   199,     0,
+     258,   249,     0,   293,   284,     0,     0,   152,     0,   380,
+       0,   164,     0,     0,     0,     0,     0,     0,     0,     0,
+     183,     0,     0,     0,   402,   412,    49,     0,    48,   398,
+       0,   310,     0,   339,   330,     0,     0,   376,     0,     0,
+     471,     0,     0,     0,     0,   142,   143,     0,   148,     0,
+     149,   150,   114,     0,   203,     0,   253,     0,   288,   154,
+     382,     0,   168,   192,   193,   194,   195,   196,   197,   185,
+       0,     0,   404,    46,     0,     0,   314,     0,   334,     0,
+       0,     0,   130,   131,   132,   133,   129,   135,   137,   139,
+     145,   147,   205,   255,   290,   170,   408,   410,    50,   316,
+     336,   378,   488,     0,   486,     0,   482,   480,     0,   476,
+     478,   479,     0,     0,   485,     0,     0,     0,   475,   501,
+       0,   499,   511,   497,   492,     0,   490,   494,   495,   493,
+     496,   487,   481,     0,   477,     0,     0,     0,     0,     0,
+     489,   483,     0,   498,     0,     0,   491,     0,   500,   513,
+     505,     0,   503,   517,     0,   514,   515,     0,     0,   502,
+       0,   512,     0,   509,     0,   507,   504,   525,     0,     0,
+       0,     0,   519,   521,   522,   523,   524,   516,     0,     0,
+     506,     0,     0,     0,     0,     0,   518,     0,   508,     0,
+     527,   528,   529,   520,   510,   526
   };
 
-  const short int
+  const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   -42,  -473,    38,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,    47,  -473,  -473,  -473,   -58,  -473,
-    -473,  -473,   220,  -473,  -473,  -473,  -473,    33,   202,   -60,
-     -44,   -40,  -473,  -473,   -39,  -473,  -473,    26,   201,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-      24,  -139,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,   -63,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -150,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -155,
-    -473,  -473,  -473,  -152,   160,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -158,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -136,  -473,  -473,  -473,  -133,   204,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -472,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -137,  -473,  -473,  -473,  -134,  -473,   174,  -473,   -49,
-    -473,  -473,  -473,  -473,  -473,   -47,  -473,  -473,  -473,  -473,
-    -473,   -51,  -473,  -473,  -473,  -135,  -473,  -473,  -473,  -127,
-    -473,   171,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -163,  -473,  -473,  -473,  -153,   206,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -156,  -473,  -473,  -473,
-    -145,  -473,   209,   -48,  -473,  -297,  -473,  -296,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,    44,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -126,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-      61,   173,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   -84,  -473,  -473,  -473,  -198,  -473,  -473,
-    -213,  -473,  -473,  -473,  -473,  -473,  -473,  -224,  -473,  -473,
-    -230,  -473
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,   -42,  -476,    57,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,    71,  -476,  -476,  -476,   -58,  -476,
+    -476,  -476,   232,  -476,  -476,  -476,  -476,    37,   246,   -60,
+     -44,   -40,  -476,  -476,   -39,  -476,  -476,    65,   238,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+      66,  -113,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,   -63,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -124,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -129,  -476,  -476,  -476,  -126,   208,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -134,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -112,  -476,
+    -476,  -476,  -109,   244,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -475,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -106,  -476,  -476,  -476,
+    -102,  -476,   221,  -476,   -49,  -476,  -476,  -476,  -476,  -476,
+     -47,  -476,  -476,  -476,  -476,  -476,   -51,  -476,  -476,  -476,
+    -104,  -476,  -476,  -476,   -99,  -476,   223,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -125,  -476,  -476,
+    -476,  -121,   253,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -123,  -476,  -476,  -476,  -122,  -476,   258,   -48,  -476,
+    -300,  -476,  -299,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,    87,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -108,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,    93,   219,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+    -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,  -476,
+     -52,  -476,  -476,  -476,  -200,  -476,  -476,  -476,  -476,  -476,
+    -476,  -184,  -476,  -476,  -209,  -476,  -476,  -476,  -476,  -476,
+    -476,  -226,  -476,  -476,  -246,  -476,  -476,  -476,  -476,  -476,
+    -228,  -476,  -476,  -250,  -476,  -476,  -476,  -476,  -476
   };
 
-  const short int
+  const short
   Dhcp4Parser::yydefgoto_[] =
   {
-      -1,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    32,    33,    34,    57,   521,    72,    73,
-      35,    56,    69,    70,   501,   630,   689,   690,   106,    37,
-      58,    80,    81,    82,   283,    39,    59,   107,   108,   109,
-     110,   111,   112,   113,   114,   115,   290,   131,   132,    41,
-      60,   133,   312,   134,   313,   504,   116,   294,   117,   295,
-     569,   570,   571,   648,   743,   572,   649,   573,   650,   574,
-     651,   211,   348,   576,   577,   578,   579,   118,   303,   597,
-     598,   599,   600,   601,   602,   119,   305,   606,   607,   608,
-     672,    53,    66,   241,   242,   243,   360,   244,   361,   120,
-     306,   615,   616,   617,   618,   619,   620,   621,   622,   121,
-     300,   582,   583,   584,   659,    43,    61,   154,   155,   156,
-     321,   157,   317,   158,   318,   159,   319,   160,   322,   161,
-     323,   162,   327,   163,   326,   164,   165,   122,   301,   586,
-     587,   588,   662,    49,    64,   212,   213,   214,   215,   216,
-     217,   218,   347,   219,   351,   220,   350,   221,   222,   352,
-     223,   123,   302,   590,   591,   592,   665,    51,    65,   230,
-     231,   232,   233,   234,   356,   235,   236,   237,   167,   320,
-     634,   635,   636,   692,    45,    62,   175,   176,   177,   332,
-     178,   333,   168,   328,   638,   639,   640,   695,    47,    63,
-     190,   191,   192,   124,   293,   194,   336,   195,   337,   196,
-     344,   197,   339,   198,   340,   199,   342,   200,   341,   201,
-     343,   202,   338,   170,   329,   642,   698,   125,   304,   604,
-     316,   420,   421,   422,   423,   424,   505,   126,   127,   308,
-     625,   626,   627,   683,   628,   684,   128,   309,    55,    67,
-     261,   262,   263,   264,   365,   265,   366,   266,   267,   368,
-     268,   269,   270,   371,   544,   271,   372,   272,   273,   274,
-     275,   276,   377,   551,   277,   378,    83,   285,    84,   286,
-      85,   284,   556,   557,   558,   644,   758,   759,   760,   768,
-     769,   770,   771,   776,   772,   774,   786,   787,   788,   792,
-     793,   795
+       0,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    32,    33,    34,    57,   525,    72,    73,
+      35,    56,    69,    70,   505,   644,   707,   708,   107,    37,
+      58,    80,    81,    82,   285,    39,    59,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   292,   133,   134,    41,
+      60,   135,   315,   136,   316,   508,   117,   296,   118,   297,
+     580,   581,   582,   663,   766,   583,   664,   584,   665,   585,
+     666,   213,   351,   587,   588,   589,   669,   590,   671,   591,
+     592,   593,   119,   305,   611,   612,   613,   614,   615,   616,
+     120,   307,   620,   621,   622,   690,    53,    66,   243,   244,
+     245,   363,   246,   364,   121,   308,   629,   630,   631,   632,
+     633,   634,   635,   636,   122,   302,   596,   597,   598,   677,
+      43,    61,   156,   157,   158,   324,   159,   320,   160,   321,
+     161,   322,   162,   325,   163,   326,   164,   330,   165,   329,
+     166,   167,   123,   303,   600,   601,   602,   680,    49,    64,
+     214,   215,   216,   217,   218,   219,   220,   350,   221,   354,
+     222,   353,   223,   224,   355,   225,   124,   304,   604,   605,
+     606,   683,    51,    65,   232,   233,   234,   235,   236,   359,
+     237,   238,   239,   169,   323,   648,   649,   650,   710,    45,
+      62,   177,   178,   179,   335,   180,   336,   170,   331,   652,
+     653,   654,   713,    47,    63,   192,   193,   194,   125,   295,
+     196,   339,   197,   340,   198,   347,   199,   342,   200,   343,
+     201,   345,   202,   344,   203,   346,   204,   341,   172,   332,
+     656,   716,   126,   306,   618,   319,   424,   425,   426,   427,
+     428,   509,   127,   128,   129,   311,   639,   640,   641,   701,
+     642,   702,   130,   312,    55,    67,   263,   264,   265,   266,
+     368,   267,   369,   268,   269,   371,   270,   271,   272,   374,
+     548,   273,   375,   551,   274,   275,   276,   277,   278,   380,
+     557,   279,   381,    83,   287,    84,   288,    85,   286,   563,
+     564,   565,   659,   788,   789,   790,   791,   796,   566,   658,
+     783,   784,   792,   805,   806,   807,   808,   817,   809,   815,
+     831,   832,   837,   844,   845,   858,   810,   818,   834,   835,
+     836,   840,   851,   852,   853,   861,   854,   855,   856
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yytable_[] =
   {
-      79,   150,   227,   149,   173,   188,   210,   226,   240,   260,
-     166,   174,   189,   169,    68,   193,   228,   151,   229,   418,
-     419,   152,   153,   603,    25,   135,    26,    74,    27,   542,
-      36,    98,    24,   288,   310,    88,    89,    71,   289,   311,
-      86,   171,   172,   314,   330,    87,    88,    89,   315,   331,
-      90,    91,    38,    92,    93,    94,   334,   135,   136,   137,
-     138,   335,    98,    40,    92,    93,    94,    95,    96,   238,
-     239,   139,    97,    98,   140,   141,   142,   143,   144,   145,
-     203,    42,   668,   146,   147,   669,    89,   179,   180,    44,
-     148,    99,   100,    46,    89,   179,   180,   204,   224,   205,
-     206,   225,   204,   101,   205,   206,   102,   207,   208,   209,
-     204,    48,    98,   103,   104,   146,    78,   105,   543,   362,
-      98,   204,    50,    78,   363,   379,    52,    75,   279,   670,
-     380,   181,   671,    76,    77,   182,   183,   184,   185,   186,
-     413,   187,   546,   547,   548,   549,    78,    78,    28,    29,
-      30,    31,   310,   761,   560,    54,   762,   643,    78,   561,
-     562,   563,   564,   565,   566,   567,   129,   130,   550,   609,
-     610,   611,   612,   613,   614,   278,   204,   763,   645,   764,
-     765,    78,   314,   646,   656,   656,    78,   647,   681,   657,
-     658,   685,   281,   682,    78,   379,   686,    78,   718,   330,
-     687,   362,   334,   777,   747,    78,   750,   754,   778,   280,
-     418,   419,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   796,   789,   282,
-      79,   790,   797,   593,   594,   595,   596,   381,   382,     1,
-       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-     502,   503,    78,   415,   739,   740,   741,   742,   414,   287,
-      78,   238,   239,   623,   624,   416,   291,   292,   417,   296,
-     150,   297,   149,   298,   299,   307,   173,   324,   325,   166,
-     345,   346,   169,   174,   349,   353,   151,   354,   188,   355,
-     152,   153,   357,   358,   359,   189,   227,   210,   193,   364,
-     367,   226,   369,   370,   373,   374,   375,   376,   384,   383,
-     228,   385,   229,   386,   387,   389,   392,   393,   394,   390,
-     399,   260,   391,   395,   396,   397,   400,   398,   401,   402,
-     403,   404,   405,   406,   407,   408,   410,   411,   425,   426,
-     427,   428,   429,   430,   485,   486,   431,   432,   433,   434,
-     435,   436,   437,   439,   440,   442,   443,   444,   445,   446,
-     447,   448,   449,   450,   452,   453,   455,   454,   456,   457,
-     458,   460,   461,   463,   464,   466,   467,   468,   469,   470,
-     471,   472,   473,   474,   475,   476,   477,   479,   478,   480,
-     482,   483,   706,   488,   484,   487,   489,   490,   491,   492,
-     493,   494,   495,   496,   508,   509,   497,   498,   499,   500,
-     506,   507,   510,   512,   511,   517,   513,   660,   514,   515,
-     518,   516,   538,   519,    26,   545,   575,   575,   581,   585,
-     589,   568,   568,   605,   522,   523,   631,   525,   633,   661,
-     553,   260,   637,   652,   415,   653,   526,   527,   528,   414,
-     529,   654,   530,   641,   655,   663,   416,   664,   531,   417,
-     667,   666,   673,   674,   693,   675,   676,   677,   678,   532,
-     533,   679,   534,   535,   680,   694,   697,   696,   520,   700,
-     702,   703,   699,   704,   705,   728,   729,   732,   555,   731,
-     737,   524,   536,   738,   757,   537,   775,   539,   748,   749,
-     540,   755,   779,   541,   781,   552,   783,   798,   388,   785,
-     688,   691,   409,   559,   580,   412,   554,   710,   717,   720,
-     719,   707,   465,   727,   708,   712,   711,   714,   713,   459,
-     462,   734,   716,   709,   438,   721,   722,   723,   715,   733,
-     441,   736,   724,   791,   725,   726,   780,   744,   745,   746,
-     735,   632,   481,   751,   752,   451,   753,   756,   784,   730,
-     629,   701,   800,   773,   782,   794,   799,     0,     0,     0,
+      79,   152,   229,   151,   175,   190,   212,   228,   242,   262,
+     168,   176,   191,   171,    68,   195,   230,   153,   231,   422,
+     423,   154,   155,    25,   617,    26,    74,    27,   137,   137,
+      24,    98,   785,   786,   206,   226,   207,   208,   227,    88,
+      89,   173,   174,   290,    86,   240,   241,    71,   291,    87,
+      88,    89,    78,   313,    90,    91,    36,   546,   314,   317,
+      92,    93,    94,   333,   318,   138,   139,   140,   334,    98,
+      38,    92,    93,    94,    95,    96,   240,   241,   141,    97,
+      98,   142,   143,   144,   145,   146,   147,   205,   337,   148,
+     148,   149,   280,   338,    89,   181,   182,   150,    99,   100,
+     206,    89,   181,   182,   686,   688,   365,   687,   689,    78,
+     101,   366,   206,   102,   207,   208,    40,   209,   210,   211,
+     103,   104,   105,    98,   206,   106,    78,   568,    78,    42,
+      98,    75,   569,   570,   571,   572,   573,   574,   575,   576,
+     577,   578,   382,   417,   281,    76,    77,   383,   793,   183,
+     547,   794,   206,   184,   185,   186,   187,   188,    78,   189,
+      28,    29,    30,    31,    78,   552,   553,   554,   555,   799,
+     838,   800,   801,   839,   282,    78,   802,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   313,   561,    78,   131,   132,   657,   562,   556,
+     623,   624,   625,   626,   627,   628,    78,   506,   507,   660,
+     317,   422,   423,   740,   661,   662,   674,   674,    78,   699,
+     283,   675,   676,   703,   700,    78,    78,   284,   704,   382,
+     333,   365,    79,   337,   705,   772,   775,   797,   779,   384,
+     385,   289,   798,   819,   859,   865,    78,   293,   820,   860,
+     866,   607,   608,   609,   610,    44,   419,   762,   763,   764,
+     765,   418,   847,   848,   849,   850,   549,   550,   420,   637,
+     638,   421,    46,   152,    48,   151,    50,    52,    54,   175,
+     294,   298,   168,   299,   300,   171,   176,   301,   309,   153,
+     310,   190,   327,   154,   155,   328,   349,   348,   191,   229,
+     212,   195,   352,   356,   228,   357,   358,   386,   360,   361,
+     362,   393,   367,   230,   370,   231,   372,   373,   376,   377,
+     378,   379,   387,   388,   262,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,   389,   390,   392,   395,
+     394,   396,   397,   398,   399,   400,   401,   489,   490,   402,
+     403,   404,   405,   406,   407,   408,   410,   411,   409,   412,
+     414,   415,   429,   430,   431,   432,   433,   434,   435,   438,
+     437,   439,   436,   440,   441,   443,   444,   446,   447,   448,
+     449,   450,   451,   452,   453,   454,   456,   457,   458,   459,
+     460,   461,   462,   464,   465,   467,   468,   470,   471,   472,
+     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
+     483,   484,   486,   510,   492,   512,   487,   488,   491,   493,
+     494,   495,   496,   497,   498,   499,   542,   500,   501,   504,
+     586,   586,   502,   503,   511,   579,   579,   513,   514,   515,
+     521,   645,   516,   522,   559,   262,    26,   517,   419,   595,
+     599,   518,   603,   418,   619,   647,   651,   667,   668,   670,
+     420,   672,   519,   421,   520,   523,   526,   527,   529,   530,
+     531,   532,   533,   534,   655,   673,   678,   679,   535,   681,
+     682,   536,   537,   538,   539,   540,   541,   684,   685,   691,
+     692,   760,   693,   694,   543,   695,   544,   696,   697,   698,
+     712,   524,   711,   715,   714,   718,   719,   717,   545,   721,
+     558,   722,   723,   724,   727,   729,   750,   751,   754,   528,
+     753,   759,   391,   761,   560,   782,   706,   773,   774,   780,
+     709,   795,   813,   816,   822,   725,   824,   825,   726,   728,
+     827,   829,   842,   841,   730,   731,   743,   744,   830,   833,
+     862,   863,   864,   867,   869,   416,   567,   745,   746,   413,
+     594,   732,   739,   742,   741,   749,   747,   734,   733,   843,
+     748,   767,   768,   469,   769,   770,   736,   442,   735,   463,
+     771,   738,   776,   777,   737,   466,   778,   756,   781,   755,
+     445,   757,   758,   812,   821,   752,   643,   814,   646,   823,
+     828,   485,   870,   871,   872,   874,   875,   455,   720,   811,
+     826,   586,   846,   868,   857,   873,   579,   152,     0,   151,
+     229,     0,   212,     0,     0,   228,   168,     0,     0,   171,
+       0,     0,   242,   153,   230,     0,   231,   154,   155,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   175,     0,     0,   190,     0,     0,     0,   176,
+       0,     0,   191,     0,     0,   195,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   575,     0,     0,     0,     0,   568,   150,
-       0,   149,   227,     0,   210,     0,     0,   226,   166,     0,
-       0,   169,     0,     0,   240,   151,   228,     0,   229,   152,
-     153,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   173,     0,     0,   188,     0,     0,
-       0,   174,     0,     0,   189,     0,     0,   193,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   787,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   804,
+       0,     0,     0,     0,   803,     0,     0,     0,     0,   787,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   767,     0,     0,
-       0,     0,   766,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   767,     0,     0,     0,     0,   766
+       0,     0,     0,     0,     0,     0,   804,     0,     0,     0,
+       0,   803
   };
 
-  const short int
+  const short
   Dhcp4Parser::yycheck_[] =
   {
       58,    61,    65,    61,    62,    63,    64,    65,    66,    67,
-      61,    62,    63,    61,    56,    63,    65,    61,    65,   316,
-     316,    61,    61,   495,     5,     7,     7,    10,     9,    15,
-       7,    44,     0,     3,     3,    17,    18,   129,     8,     8,
-      11,    54,    55,     3,     3,    16,    17,    18,     8,     8,
-      21,    22,     7,    35,    36,    37,     3,     7,    40,    41,
-      42,     8,    44,     7,    35,    36,    37,    38,    39,    75,
-      76,    53,    43,    44,    56,    57,    58,    59,    60,    61,
-      23,     7,     3,    65,    66,     6,    18,    19,    20,     7,
-      72,    62,    63,     7,    18,    19,    20,    45,    46,    47,
-      48,    49,    45,    74,    47,    48,    77,    50,    51,    52,
-      45,     7,    44,    84,    85,    65,   129,    88,   104,     3,
-      44,    45,     7,   129,     8,     3,     7,   110,     3,     3,
-       8,    63,     6,   116,   117,    67,    68,    69,    70,    71,
-      64,    73,   106,   107,   108,   109,   129,   129,   129,   130,
-     131,   132,     3,     3,    23,     7,     6,     8,   129,    28,
-      29,    30,    31,    32,    33,    34,    12,    13,   132,    78,
-      79,    80,    81,    82,    83,     6,    45,   112,     3,   114,
-     115,   129,     3,     8,     3,     3,   129,     8,     3,     8,
-       8,     3,     8,     8,   129,     3,     8,   129,   670,     3,
-       8,     3,     3,     3,     8,   129,     8,     8,     8,     4,
-     507,   507,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,     3,     3,     3,
-     288,     6,     8,    67,    68,    69,    70,   279,   280,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-      14,    15,   129,   316,    24,    25,    26,    27,   316,     4,
-     129,    75,    76,    86,    87,   316,     4,     4,   316,     4,
-     330,     4,   330,     4,     4,     4,   334,     4,     4,   330,
-       8,     3,   330,   334,     4,     4,   330,     8,   346,     3,
-     330,   330,     4,     8,     3,   346,   359,   355,   346,     4,
-       4,   359,     4,     4,     4,     4,     4,     4,     4,   129,
-     359,     4,   359,     4,     4,     4,     4,     4,     4,   132,
-       4,   379,   132,   130,   130,   130,     4,   130,     4,     4,
-       4,     4,     4,   130,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   386,   387,     4,   130,   132,     4,
+      61,    62,    63,    61,    56,    63,    65,    61,    65,   319,
+     319,    61,    61,     5,   499,     7,    10,     9,     7,     7,
+       0,    47,   122,   123,    48,    49,    50,    51,    52,    17,
+      18,    57,    58,     3,    11,    78,    79,   142,     8,    16,
+      17,    18,   142,     3,    21,    22,     7,    15,     8,     3,
+      38,    39,    40,     3,     8,    43,    44,    45,     8,    47,
+       7,    38,    39,    40,    41,    42,    78,    79,    56,    46,
+      47,    59,    60,    61,    62,    63,    64,    23,     3,    68,
+      68,    69,     6,     8,    18,    19,    20,    75,    65,    66,
+      48,    18,    19,    20,     3,     3,     3,     6,     6,   142,
+      77,     8,    48,    80,    50,    51,     7,    53,    54,    55,
+      87,    88,    89,    47,    48,    92,   142,    23,   142,     7,
+      47,   115,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,     3,    67,     3,   129,   130,     8,     3,    66,
+     108,     6,    48,    70,    71,    72,    73,    74,   142,    76,
+     142,   143,   144,   145,   142,   111,   112,   113,   114,   117,
+       3,   119,   120,     6,     4,   142,   124,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,     3,   116,   142,    12,    13,     8,   121,   145,
+      81,    82,    83,    84,    85,    86,   142,    14,    15,     3,
+       3,   511,   511,   688,     8,     8,     3,     3,   142,     3,
+       8,     8,     8,     3,     8,   142,   142,     3,     8,     3,
+       3,     3,   290,     3,     8,     8,     8,     3,     8,   281,
+     282,     4,     8,     3,     3,     3,   142,     4,     8,     8,
+       8,    70,    71,    72,    73,     7,   319,    24,    25,    26,
+      27,   319,   125,   126,   127,   128,   109,   110,   319,    90,
+      91,   319,     7,   333,     7,   333,     7,     7,     7,   337,
+       4,     4,   333,     4,     4,   333,   337,     4,     4,   333,
+       4,   349,     4,   333,   333,     4,     3,     8,   349,   362,
+     358,   349,     4,     4,   362,     8,     3,   142,     4,     8,
+       3,   145,     4,   362,     4,   362,     4,     4,     4,     4,
+       4,     4,     4,     4,   382,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,     4,     4,     4,     4,
+     145,     4,     4,   143,   143,   143,   143,   389,   390,     4,
+       4,     4,     4,     4,     4,     4,   145,     4,   143,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,   130,     4,     4,
-     132,     4,   132,     4,     4,   132,     4,     4,   130,     4,
-     130,   130,     4,     4,   132,   132,   132,     4,   132,     4,
-       4,     7,   132,   129,     7,     7,     7,     7,     5,     5,
-       5,     5,     5,     5,   129,   129,     7,     7,     7,     5,
-       8,     3,   129,   129,     5,     5,   129,     6,   129,   129,
-       7,   129,   464,   129,     7,   105,   489,   490,     7,     7,
-       7,   489,   490,     7,   129,   129,     4,   129,     7,     3,
-     482,   499,     7,     4,   507,     4,   129,   129,   129,   507,
-     129,     4,   129,    73,     4,     6,   507,     3,   129,   507,
-       3,     6,     6,     3,     6,     4,     4,     4,     4,   129,
-     129,     4,   129,   129,     4,     3,     3,     6,   440,     4,
-       4,     4,     8,     4,     4,     4,     4,     3,   111,     6,
-       4,   444,   129,     5,     7,   129,     4,   129,     8,     8,
-     129,     8,     4,   129,     4,   129,     5,     4,   288,     7,
-     129,   129,   310,   487,   490,   314,   483,   656,   668,   674,
-     672,   130,   362,   681,   132,   661,   659,   664,   662,   355,
-     359,   694,   667,   130,   330,   130,   130,   130,   665,   692,
-     334,   697,   130,   113,   130,   130,   130,   129,   129,   129,
-     695,   507,   379,   129,   129,   346,   129,   129,   129,   685,
-     499,   645,   129,   761,   777,   789,   796,    -1,    -1,    -1,
+     145,     4,   143,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,   143,     4,
+       4,     4,   145,     4,   145,     4,     4,   145,     4,     4,
+     143,     4,   143,   143,     4,     4,   145,   145,   145,   145,
+       4,     4,     4,     8,   142,   142,     7,     7,     7,     7,
+       7,     5,     5,     5,     5,     5,   468,     5,     7,     5,
+     493,   494,     7,     7,     3,   493,   494,   142,   142,     5,
+       5,     4,   142,     7,   486,   503,     7,   142,   511,     7,
+       7,   142,     7,   511,     7,     7,     7,     4,     4,     4,
+     511,     4,   142,   511,   142,   142,   142,   142,   142,   142,
+     142,   142,   142,   142,    76,     4,     6,     3,   142,     6,
+       3,   142,   142,   142,   142,   142,   142,     6,     3,     6,
+       3,     5,     4,     4,   142,     4,   142,     4,     4,     4,
+       3,   444,     6,     3,     6,     4,     4,     8,   142,     4,
+     142,     4,     4,     4,     4,     4,     4,     4,     3,   448,
+       6,     4,   290,     7,   487,     7,   142,     8,     8,     8,
+     142,     4,     4,     4,     4,   145,     4,     4,   145,   143,
+       5,     5,     3,     6,   145,   143,   143,   143,     7,     7,
+       4,     4,     4,     4,     4,   317,   491,   143,   143,   313,
+     494,   674,   686,   692,   690,   699,   143,   679,   677,   118,
+     143,   142,   142,   365,   142,   142,   682,   333,   680,   358,
+     142,   685,   142,   142,   683,   362,   142,   712,   142,   710,
+     337,   713,   715,   143,   142,   703,   503,   797,   511,   143,
+     142,   382,   143,   143,   143,   142,   142,   349,   660,   793,
+     819,   674,   838,   859,   842,   865,   674,   677,    -1,   677,
+     683,    -1,   680,    -1,    -1,   683,   677,    -1,    -1,   677,
+      -1,    -1,   690,   677,   683,    -1,   683,   677,   677,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   710,    -1,    -1,   713,    -1,    -1,    -1,   710,
+      -1,    -1,   713,    -1,    -1,   713,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   656,    -1,    -1,    -1,    -1,   656,   659,
-      -1,   659,   665,    -1,   662,    -1,    -1,   665,   659,    -1,
-      -1,   659,    -1,    -1,   672,   659,   665,    -1,   665,   659,
-     659,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   692,    -1,    -1,   695,    -1,    -1,
-      -1,   692,    -1,    -1,   695,    -1,    -1,   695,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   761,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   792,
+      -1,    -1,    -1,    -1,   792,    -1,    -1,    -1,    -1,   797,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   760,    -1,    -1,
-      -1,    -1,   760,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   777,    -1,    -1,    -1,    -1,   777
+      -1,    -1,    -1,    -1,    -1,    -1,   819,    -1,    -1,    -1,
+      -1,   819
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yystos_[] =
   {
-       0,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,     0,     5,     7,     9,   129,   130,
-     131,   132,   146,   147,   148,   153,     7,   162,     7,   168,
-       7,   182,     7,   248,     7,   317,     7,   331,     7,   276,
-       7,   300,     7,   224,     7,   381,   154,   149,   163,   169,
-     183,   249,   318,   332,   277,   301,   225,   382,   146,   155,
-     156,   129,   151,   152,    10,   110,   116,   117,   129,   161,
-     164,   165,   166,   409,   411,   413,    11,    16,    17,    18,
-      21,    22,    35,    36,    37,    38,    39,    43,    44,    62,
-      63,    74,    77,    84,    85,    88,   161,   170,   171,   172,
-     173,   174,   175,   176,   177,   178,   189,   191,   210,   218,
-     232,   242,   270,   294,   336,   360,   370,   371,   379,    12,
-      13,   180,   181,   184,   186,     7,    40,    41,    42,    53,
-      56,    57,    58,    59,    60,    61,    65,    66,    72,   161,
-     172,   173,   174,   177,   250,   251,   252,   254,   256,   258,
-     260,   262,   264,   266,   268,   269,   294,   311,   325,   336,
-     356,    54,    55,   161,   294,   319,   320,   321,   323,    19,
-      20,    63,    67,    68,    69,    70,    71,    73,   161,   294,
-     333,   334,   335,   336,   338,   340,   342,   344,   346,   348,
-     350,   352,   354,    23,    45,    47,    48,    50,    51,    52,
-     161,   204,   278,   279,   280,   281,   282,   283,   284,   286,
-     288,   290,   291,   293,    46,    49,   161,   204,   282,   288,
-     302,   303,   304,   305,   306,   308,   309,   310,    75,    76,
-     161,   226,   227,   228,   230,    89,    90,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     161,   383,   384,   385,   386,   388,   390,   391,   393,   394,
-     395,   398,   400,   401,   402,   403,   404,   407,     6,     3,
-       4,     8,     3,   167,   414,   410,   412,     4,     3,     8,
-     179,     4,     4,   337,   190,   192,     4,     4,     4,     4,
-     243,   271,   295,   211,   361,   219,   233,     4,   372,   380,
-       3,     8,   185,   187,     3,     8,   363,   255,   257,   259,
-     312,   253,   261,   263,     4,     4,   267,   265,   326,   357,
-       3,     8,   322,   324,     3,     8,   339,   341,   355,   345,
-     347,   351,   349,   353,   343,     8,     3,   285,   205,     4,
-     289,   287,   292,     4,     8,     3,   307,     4,     8,     3,
-     229,   231,     3,     8,     4,   387,   389,     4,   392,     4,
-       4,   396,   399,     4,     4,     4,     4,   405,   408,     3,
-       8,   146,   146,   129,     4,     4,     4,     4,   165,     4,
-     132,   132,     4,     4,     4,   130,   130,   130,   130,     4,
-       4,     4,     4,     4,     4,     4,   130,     4,     4,   171,
-       4,     4,   181,    64,   161,   204,   294,   336,   338,   340,
-     364,   365,   366,   367,   368,     4,     4,     4,     4,     4,
-       4,     4,   130,   132,     4,     4,     4,     4,   251,     4,
-       4,   320,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   335,     4,     4,   130,     4,     4,     4,   132,   280,
-       4,   132,   304,     4,     4,   227,   132,     4,     4,   130,
-       4,   130,   130,     4,     4,   132,   132,   132,   132,     4,
-       4,   384,     4,     7,     7,   146,   146,     7,   129,     7,
-       7,     5,     5,     5,     5,     5,     5,     7,     7,     7,
-       5,   157,    14,    15,   188,   369,     8,     3,   129,   129,
-     129,     5,   129,   129,   129,   129,   129,     5,     7,   129,
-     148,   150,   129,   129,   157,   129,   129,   129,   129,   129,
-     129,   129,   129,   129,   129,   129,   129,   129,   146,   129,
-     129,   129,    15,   104,   397,   105,   106,   107,   108,   109,
-     132,   406,   129,   146,   170,   111,   415,   416,   417,   180,
-      23,    28,    29,    30,    31,    32,    33,    34,   161,   193,
-     194,   195,   198,   200,   202,   204,   206,   207,   208,   209,
-     193,     7,   244,   245,   246,     7,   272,   273,   274,     7,
-     296,   297,   298,    67,    68,    69,    70,   212,   213,   214,
-     215,   216,   217,   264,   362,     7,   220,   221,   222,    78,
-      79,    80,    81,    82,    83,   234,   235,   236,   237,   238,
-     239,   240,   241,    86,    87,   373,   374,   375,   377,   383,
-     158,     4,   366,     7,   313,   314,   315,     7,   327,   328,
-     329,    73,   358,     8,   418,     3,     8,     8,   196,   199,
-     201,   203,     4,     4,     4,     4,     3,     8,     8,   247,
-       6,     3,   275,     6,     3,   299,     6,     3,     3,     6,
-       3,     6,   223,     6,     3,     4,     4,     4,     4,     4,
-       4,     3,     8,   376,   378,     3,     8,     8,   129,   159,
-     160,   129,   316,     6,     3,   330,     6,     3,   359,     8,
-       4,   416,     4,     4,     4,     4,   132,   130,   132,   130,
-     194,   250,   246,   278,   274,   302,   298,   213,   264,   226,
-     222,   130,   130,   130,   130,   130,   130,   235,     4,     4,
-     374,     6,     3,   319,   315,   333,   329,     4,     5,    24,
-      25,    26,    27,   197,   129,   129,   129,     8,     8,     8,
-       8,   129,   129,   129,     8,     8,   129,     7,   419,   420,
-     421,     3,     6,   112,   114,   115,   161,   204,   422,   423,
-     424,   425,   427,   420,   428,     4,   426,     3,     8,     4,
-     130,     4,   423,     5,   129,     7,   429,   430,   431,     3,
-       6,   113,   432,   433,   430,   434,     3,     8,     4,   433,
-     129
+       0,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,     0,     5,     7,     9,   142,   143,
+     144,   145,   159,   160,   161,   166,     7,   175,     7,   181,
+       7,   195,     7,   266,     7,   335,     7,   349,     7,   294,
+       7,   318,     7,   242,     7,   400,   167,   162,   176,   182,
+     196,   267,   336,   350,   295,   319,   243,   401,   159,   168,
+     169,   142,   164,   165,    10,   115,   129,   130,   142,   174,
+     177,   178,   179,   429,   431,   433,    11,    16,    17,    18,
+      21,    22,    38,    39,    40,    41,    42,    46,    47,    65,
+      66,    77,    80,    87,    88,    89,    92,   174,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   202,   204,   228,
+     236,   250,   260,   288,   312,   354,   378,   388,   389,   390,
+     398,    12,    13,   193,   194,   197,   199,     7,    43,    44,
+      45,    56,    59,    60,    61,    62,    63,    64,    68,    69,
+      75,   174,   185,   186,   187,   190,   268,   269,   270,   272,
+     274,   276,   278,   280,   282,   284,   286,   287,   312,   329,
+     343,   354,   374,    57,    58,   174,   312,   337,   338,   339,
+     341,    19,    20,    66,    70,    71,    72,    73,    74,    76,
+     174,   312,   351,   352,   353,   354,   356,   358,   360,   362,
+     364,   366,   368,   370,   372,    23,    48,    50,    51,    53,
+      54,    55,   174,   217,   296,   297,   298,   299,   300,   301,
+     302,   304,   306,   308,   309,   311,    49,    52,   174,   217,
+     300,   306,   320,   321,   322,   323,   324,   326,   327,   328,
+      78,    79,   174,   244,   245,   246,   248,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   174,   402,   403,   404,   405,   407,   409,   410,
+     412,   413,   414,   417,   420,   421,   422,   423,   424,   427,
+       6,     3,     4,     8,     3,   180,   434,   430,   432,     4,
+       3,     8,   192,     4,     4,   355,   203,   205,     4,     4,
+       4,     4,   261,   289,   313,   229,   379,   237,   251,     4,
+       4,   391,   399,     3,     8,   198,   200,     3,     8,   381,
+     273,   275,   277,   330,   271,   279,   281,     4,     4,   285,
+     283,   344,   375,     3,     8,   340,   342,     3,     8,   357,
+     359,   373,   363,   365,   369,   367,   371,   361,     8,     3,
+     303,   218,     4,   307,   305,   310,     4,     8,     3,   325,
+       4,     8,     3,   247,   249,     3,     8,     4,   406,   408,
+       4,   411,     4,     4,   415,   418,     4,     4,     4,     4,
+     425,   428,     3,     8,   159,   159,   142,     4,     4,     4,
+       4,   178,     4,   145,   145,     4,     4,     4,   143,   143,
+     143,   143,     4,     4,     4,     4,     4,     4,     4,   143,
+     145,     4,     4,   184,     4,     4,   194,    67,   174,   217,
+     312,   354,   356,   358,   382,   383,   384,   385,   386,     4,
+       4,     4,     4,     4,     4,     4,   143,   145,     4,     4,
+       4,     4,   269,     4,     4,   338,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   353,     4,     4,   143,     4,
+       4,     4,   145,   298,     4,   145,   322,     4,     4,   245,
+     145,     4,     4,   143,     4,   143,   143,     4,     4,   145,
+     145,   145,   145,     4,     4,   403,     4,     7,     7,   159,
+     159,     7,   142,     7,     7,     5,     5,     5,     5,     5,
+       5,     7,     7,     7,     5,   170,    14,    15,   201,   387,
+       8,     3,   142,   142,   142,     5,   142,   142,   142,   142,
+     142,     5,     7,   142,   161,   163,   142,   142,   170,   142,
+     142,   142,   142,   142,   142,   142,   142,   142,   142,   142,
+     142,   142,   159,   142,   142,   142,    15,   108,   416,   109,
+     110,   419,   111,   112,   113,   114,   145,   426,   142,   159,
+     183,   116,   121,   435,   436,   437,   444,   193,    23,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,   174,
+     206,   207,   208,   211,   213,   215,   217,   219,   220,   221,
+     223,   225,   226,   227,   206,     7,   262,   263,   264,     7,
+     290,   291,   292,     7,   314,   315,   316,    70,    71,    72,
+      73,   230,   231,   232,   233,   234,   235,   282,   380,     7,
+     238,   239,   240,    81,    82,    83,    84,    85,    86,   252,
+     253,   254,   255,   256,   257,   258,   259,    90,    91,   392,
+     393,   394,   396,   402,   171,     4,   384,     7,   331,   332,
+     333,     7,   345,   346,   347,    76,   376,     8,   445,   438,
+       3,     8,     8,   209,   212,   214,   216,     4,     4,   222,
+       4,   224,     4,     4,     3,     8,     8,   265,     6,     3,
+     293,     6,     3,   317,     6,     3,     3,     6,     3,     6,
+     241,     6,     3,     4,     4,     4,     4,     4,     4,     3,
+       8,   395,   397,     3,     8,     8,   142,   172,   173,   142,
+     334,     6,     3,   348,     6,     3,   377,     8,     4,     4,
+     436,     4,     4,     4,     4,   145,   145,     4,   143,     4,
+     145,   143,   207,   268,   264,   296,   292,   320,   316,   231,
+     282,   244,   240,   143,   143,   143,   143,   143,   143,   253,
+       4,     4,   393,     6,     3,   337,   333,   351,   347,     4,
+       5,     7,    24,    25,    26,    27,   210,   142,   142,   142,
+     142,   142,     8,     8,     8,     8,   142,   142,   142,     8,
+       8,   142,     7,   446,   447,   122,   123,   174,   439,   440,
+     441,   442,   448,     3,     6,     4,   443,     3,     8,   117,
+     119,   120,   124,   174,   217,   449,   450,   451,   452,   454,
+     462,   447,   143,     4,   440,   455,     4,   453,   463,     3,
+       8,   142,     4,   143,     4,     4,   450,     5,   142,     5,
+       7,   456,   457,     7,   464,   465,   466,   458,     3,     6,
+     467,     6,     3,   118,   459,   460,   457,   125,   126,   127,
+     128,   468,   469,   470,   472,   473,   474,   466,   461,     3,
+       8,   471,     4,     4,     4,     3,     8,     4,   460,     4,
+     143,   143,   143,   469,   142,   142
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   133,   135,   134,   136,   134,   137,   134,   138,   134,
-     139,   134,   140,   134,   141,   134,   142,   134,   143,   134,
-     144,   134,   145,   134,   146,   146,   146,   146,   146,   146,
-     146,   147,   149,   148,   150,   151,   151,   152,   152,   154,
-     153,   155,   155,   156,   156,   158,   157,   159,   159,   160,
-     160,   161,   163,   162,   164,   164,   165,   165,   165,   165,
-     165,   167,   166,   169,   168,   170,   170,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   171,   171,
-     171,   171,   171,   171,   171,   171,   171,   171,   172,   173,
-     174,   175,   176,   177,   179,   178,   180,   180,   181,   181,
-     183,   182,   185,   184,   187,   186,   188,   188,   190,   189,
-     192,   191,   193,   193,   194,   194,   194,   194,   194,   194,
-     194,   194,   194,   194,   196,   195,   197,   197,   197,   197,
-     199,   198,   201,   200,   203,   202,   205,   204,   206,   207,
-     208,   209,   211,   210,   212,   212,   213,   213,   213,   213,
-     214,   215,   216,   217,   219,   218,   220,   220,   221,   221,
-     223,   222,   225,   224,   226,   226,   226,   227,   227,   229,
-     228,   231,   230,   233,   232,   234,   234,   235,   235,   235,
-     235,   235,   235,   236,   237,   238,   239,   240,   241,   243,
-     242,   244,   244,   245,   245,   247,   246,   249,   248,   250,
-     250,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-     251,   253,   252,   255,   254,   257,   256,   259,   258,   261,
-     260,   263,   262,   265,   264,   267,   266,   268,   269,   271,
-     270,   272,   272,   273,   273,   275,   274,   277,   276,   278,
-     278,   279,   279,   280,   280,   280,   280,   280,   280,   280,
-     280,   281,   282,   283,   285,   284,   287,   286,   289,   288,
-     290,   292,   291,   293,   295,   294,   296,   296,   297,   297,
-     299,   298,   301,   300,   302,   302,   303,   303,   304,   304,
-     304,   304,   304,   304,   305,   307,   306,   308,   309,   310,
-     312,   311,   313,   313,   314,   314,   316,   315,   318,   317,
-     319,   319,   320,   320,   320,   320,   322,   321,   324,   323,
-     326,   325,   327,   327,   328,   328,   330,   329,   332,   331,
-     333,   333,   334,   334,   335,   335,   335,   335,   335,   335,
-     335,   335,   335,   335,   335,   335,   337,   336,   339,   338,
-     341,   340,   343,   342,   345,   344,   347,   346,   349,   348,
-     351,   350,   353,   352,   355,   354,   357,   356,   359,   358,
-     361,   360,   362,   362,   363,   264,   364,   364,   365,   365,
-     366,   366,   366,   366,   366,   366,   366,   367,   369,   368,
-     370,   372,   371,   373,   373,   374,   374,   376,   375,   378,
-     377,   380,   379,   382,   381,   383,   383,   384,   384,   384,
-     384,   384,   384,   384,   384,   384,   384,   384,   384,   384,
-     384,   384,   384,   385,   387,   386,   389,   388,   390,   392,
-     391,   393,   394,   396,   395,   397,   397,   399,   398,   400,
-     401,   402,   403,   405,   404,   406,   406,   406,   406,   406,
-     408,   407,   410,   409,   412,   411,   414,   413,   415,   415,
-     416,   418,   417,   419,   419,   421,   420,   422,   422,   423,
-     423,   423,   423,   423,   424,   426,   425,   428,   427,   429,
-     429,   431,   430,   432,   432,   434,   433
+       0,   146,   148,   147,   149,   147,   150,   147,   151,   147,
+     152,   147,   153,   147,   154,   147,   155,   147,   156,   147,
+     157,   147,   158,   147,   159,   159,   159,   159,   159,   159,
+     159,   160,   162,   161,   163,   164,   164,   165,   165,   167,
+     166,   168,   168,   169,   169,   171,   170,   172,   172,   173,
+     173,   174,   176,   175,   177,   177,   178,   178,   178,   178,
+     178,   180,   179,   182,   181,   183,   183,   184,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   185,
+     186,   187,   188,   189,   190,   192,   191,   193,   193,   194,
+     194,   196,   195,   198,   197,   200,   199,   201,   201,   203,
+     202,   205,   204,   206,   206,   207,   207,   207,   207,   207,
+     207,   207,   207,   207,   207,   207,   207,   207,   209,   208,
+     210,   210,   210,   210,   212,   211,   214,   213,   216,   215,
+     218,   217,   219,   220,   222,   221,   224,   223,   225,   226,
+     227,   229,   228,   230,   230,   231,   231,   231,   231,   232,
+     233,   234,   235,   237,   236,   238,   238,   239,   239,   241,
+     240,   243,   242,   244,   244,   244,   245,   245,   247,   246,
+     249,   248,   251,   250,   252,   252,   253,   253,   253,   253,
+     253,   253,   254,   255,   256,   257,   258,   259,   261,   260,
+     262,   262,   263,   263,   265,   264,   267,   266,   268,   268,
+     269,   269,   269,   269,   269,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   269,   269,   269,   269,   269,   269,
+     271,   270,   273,   272,   275,   274,   277,   276,   279,   278,
+     281,   280,   283,   282,   285,   284,   286,   287,   289,   288,
+     290,   290,   291,   291,   293,   292,   295,   294,   296,   296,
+     297,   297,   298,   298,   298,   298,   298,   298,   298,   298,
+     299,   300,   301,   303,   302,   305,   304,   307,   306,   308,
+     310,   309,   311,   313,   312,   314,   314,   315,   315,   317,
+     316,   319,   318,   320,   320,   321,   321,   322,   322,   322,
+     322,   322,   322,   323,   325,   324,   326,   327,   328,   330,
+     329,   331,   331,   332,   332,   334,   333,   336,   335,   337,
+     337,   338,   338,   338,   338,   340,   339,   342,   341,   344,
+     343,   345,   345,   346,   346,   348,   347,   350,   349,   351,
+     351,   352,   352,   353,   353,   353,   353,   353,   353,   353,
+     353,   353,   353,   353,   353,   355,   354,   357,   356,   359,
+     358,   361,   360,   363,   362,   365,   364,   367,   366,   369,
+     368,   371,   370,   373,   372,   375,   374,   377,   376,   379,
+     378,   380,   380,   381,   282,   382,   382,   383,   383,   384,
+     384,   384,   384,   384,   384,   384,   385,   387,   386,   388,
+     389,   391,   390,   392,   392,   393,   393,   395,   394,   397,
+     396,   399,   398,   401,   400,   402,   402,   403,   403,   403,
+     403,   403,   403,   403,   403,   403,   403,   403,   403,   403,
+     403,   403,   403,   404,   406,   405,   408,   407,   409,   411,
+     410,   412,   413,   415,   414,   416,   416,   418,   417,   419,
+     419,   420,   421,   422,   423,   425,   424,   426,   426,   426,
+     426,   426,   428,   427,   430,   429,   432,   431,   434,   433,
+     435,   435,   436,   436,   438,   437,   439,   439,   440,   440,
+     440,   441,   443,   442,   445,   444,   446,   446,   448,   447,
+     449,   449,   450,   450,   450,   450,   450,   450,   451,   453,
+     452,   455,   454,   456,   456,   458,   457,   459,   459,   461,
+     460,   463,   462,   464,   464,   465,   465,   467,   466,   468,
+     468,   469,   469,   469,   469,   471,   470,   472,   473,   474
   };
 
-  const unsigned char
+  const signed char
   Dhcp4Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -3743,64 +4143,69 @@ namespace isc { namespace dhcp {
        3,     2,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     0,     6,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     3,
-       3,     3,     3,     3,     0,     6,     1,     3,     1,     1,
-       0,     4,     0,     4,     0,     4,     1,     1,     0,     6,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     4,     0,     4,     3,     3,
-       3,     3,     0,     6,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     1,     3,     1,     1,     1,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     3,     3,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       3,     3,     3,     3,     3,     0,     6,     1,     3,     1,
+       1,     0,     4,     0,     4,     0,     4,     1,     1,     0,
+       6,     0,     6,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       0,     4,     3,     3,     0,     4,     0,     4,     3,     3,
+       3,     0,     6,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     1,     3,     1,     1,     1,     0,     4,
+       0,     4,     0,     6,     1,     3,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     3,     3,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     3,     1,     0,     4,     0,     4,     0,     4,     1,
+       0,     4,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     0,     4,     1,     1,     3,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     0,     4,     0,
        6,     0,     1,     1,     3,     0,     4,     0,     4,     0,
        1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     1,     0,     4,     0,     4,     0,     4,
-       1,     0,     4,     3,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     0,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     6,     0,     4,
-       0,     6,     1,     3,     0,     4,     0,     1,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     6,     0,     4,     0,
+       6,     1,     3,     0,     4,     0,     1,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
        3,     0,     6,     1,     3,     1,     1,     0,     4,     0,
        4,     0,     6,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     3,     0,     4,     0,     4,     3,     0,
-       4,     3,     3,     0,     4,     1,     1,     0,     4,     3,
-       3,     3,     3,     0,     4,     1,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     1,     3,     0,     4,     0,     6,     1,
-       3,     0,     4,     1,     3,     0,     4
+       4,     3,     3,     0,     4,     1,     1,     0,     4,     1,
+       1,     3,     3,     3,     3,     0,     4,     1,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     4,     0,     6,
+       1,     3,     1,     1,     0,     6,     1,     3,     1,     1,
+       1,     3,     0,     4,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     3,     0,
+       4,     0,     6,     1,     3,     0,     4,     1,     3,     0,
+       4,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
   };
 
 
-
+#if PARSER4_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp4Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
   "\"interfaces-config\"", "\"interfaces\"", "\"dhcp-socket-type\"",
   "\"raw\"", "\"udp\"", "\"echo-client-id\"", "\"match-client-id\"",
   "\"next-server\"", "\"server-hostname\"", "\"boot-file-name\"",
   "\"lease-database\"", "\"hosts-database\"", "\"type\"", "\"memfile\"",
   "\"mysql\"", "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"",
-  "\"host\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
+  "\"host\"", "\"persist\"", "\"mapped-store\"", "\"file-format\"",
+  "\"lfc-interval\"", "\"lfc-mode\"", "\"readonly\"",
   "\"connect-timeout\"", "\"valid-lifetime\"", "\"renew-timer\"",
   "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet4\"",
   "\"4o6-interface\"", "\"4o6-interface-id\"", "\"4o6-subnet\"",
@@ -3816,28 +4221,31 @@ namespace isc { namespace dhcp {
   "\"reclaim-timer-wait-time\"", "\"flush-reclaimed-timer-wait-time\"",
   "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
   "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"",
-  "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
-  "\"socket-name\"", "\"dhcp-ddns\"", "\"enable-updates\"",
-  "\"qualifying-suffix\"", "\"server-ip\"", "\"server-port\"",
-  "\"sender-ip\"", "\"sender-port\"", "\"max-queue-size\"",
-  "\"ncr-protocol\"", "\"ncr-format\"", "\"always-include-fqdn\"",
-  "\"allow-client-update\"", "\"override-no-update\"",
-  "\"override-client-update\"", "\"replace-client-name\"",
-  "\"generated-prefix\"", "\"tcp\"", "\"JSON\"", "\"when-present\"",
-  "\"never\"", "\"always\"", "\"when-not-present\"", "\"Logging\"",
-  "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"Dhcp6\"", "\"DhcpDdns\"", "TOPLEVEL_JSON",
-  "TOPLEVEL_DHCP4", "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4",
-  "SUB_POOL4", "SUB_RESERVATION", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
-  "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "\"constant string\"",
-  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
-  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10",
-  "$@11", "value", "sub_json", "map2", "$@12", "map_value", "map_content",
-  "not_empty_map", "list_generic", "$@13", "list_content",
-  "not_empty_list", "list_strings", "$@14", "list_strings_content",
-  "not_empty_list_strings", "unknown_map_entry", "syntax_map", "$@15",
-  "global_objects", "global_object", "dhcp4_object", "$@16", "sub_dhcp4",
-  "$@17", "global_params", "global_param", "valid_lifetime", "renew_timer",
+  "\"dhcp4o6-port\"", "\"packet-timeline\"", "\"control-socket\"",
+  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
+  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
+  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
+  "\"always-include-fqdn\"", "\"allow-client-update\"",
+  "\"override-no-update\"", "\"override-client-update\"",
+  "\"replace-client-name\"", "\"generated-prefix\"", "\"tcp\"", "\"JSON\"",
+  "\"BINARY\"", "\"when-present\"", "\"never\"", "\"always\"",
+  "\"when-not-present\"", "\"Logging\"", "\"loggers\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
+  "\"async\"", "\"queue-size\"", "\"overflow-policy\"", "\"rate-limits\"",
+  "\"message\"", "\"sample\"", "\"rate\"", "\"interval\"", "\"Dhcp6\"",
+  "\"DhcpDdns\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP4", "SUB_DHCP4",
+  "SUB_INTERFACES4", "SUB_SUBNET4", "SUB_POOL4", "SUB_RESERVATION",
+  "SUB_OPTION_DEF", "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY",
+  "SUB_DHCP_DDNS", "\"constant string\"", "\"integer\"",
+  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
+  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "value",
+  "sub_json", "map2", "$@12", "map_value", "map_content", "not_empty_map",
+  "list_generic", "$@13", "list_content", "not_empty_list", "list_strings",
+  "$@14", "list_strings_content", "not_empty_list_strings",
+  "unknown_map_entry", "syntax_map", "$@15", "global_objects",
+  "global_object", "dhcp4_object", "$@16", "sub_dhcp4", "$@17",
+  "global_params", "global_param", "valid_lifetime", "renew_timer",
   "rebind_timer", "decline_probation_period", "echo_client_id",
   "match_client_id", "interfaces_config", "$@18",
   "interfaces_config_params", "interfaces_config_param", "sub_interfaces4",
@@ -3845,143 +4253,153 @@ namespace isc { namespace dhcp {
   "socket_type", "lease_database", "$@22", "hosts_database", "$@23",
   "database_map_params", "database_map_param", "database_type", "$@24",
   "db_type", "user", "$@25", "password", "$@26", "host", "$@27", "name",
-  "$@28", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "host_reservation_identifiers", "$@29",
+  "$@28", "persist", "mapped_store", "file_format", "$@29", "lfc_mode",
+  "$@30", "lfc_interval", "readonly", "connect_timeout",
+  "host_reservation_identifiers", "$@31",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "hooks_libraries",
-  "$@30", "hooks_libraries_list", "not_empty_hooks_libraries_list",
-  "hooks_library", "$@31", "sub_hooks_library", "$@32", "hooks_params",
-  "hooks_param", "library", "$@33", "parameters", "$@34",
-  "expired_leases_processing", "$@35", "expired_leases_params",
+  "$@32", "hooks_libraries_list", "not_empty_hooks_libraries_list",
+  "hooks_library", "$@33", "sub_hooks_library", "$@34", "hooks_params",
+  "hooks_param", "library", "$@35", "parameters", "$@36",
+  "expired_leases_processing", "$@37", "expired_leases_params",
   "expired_leases_param", "reclaim_timer_wait_time",
   "flush_reclaimed_timer_wait_time", "hold_reclaimed_time",
   "max_reclaim_leases", "max_reclaim_time", "unwarned_reclaim_cycles",
-  "subnet4_list", "$@36", "subnet4_list_content", "not_empty_subnet4_list",
-  "subnet4", "$@37", "sub_subnet4", "$@38", "subnet4_params",
-  "subnet4_param", "subnet", "$@39", "subnet_4o6_interface", "$@40",
-  "subnet_4o6_interface_id", "$@41", "subnet_4o6_subnet", "$@42",
-  "interface", "$@43", "interface_id", "$@44", "client_class", "$@45",
-  "reservation_mode", "$@46", "id", "rapid_commit", "option_def_list",
-  "$@47", "option_def_list_content", "not_empty_option_def_list",
-  "option_def_entry", "$@48", "sub_option_def", "$@49",
+  "subnet4_list", "$@38", "subnet4_list_content", "not_empty_subnet4_list",
+  "subnet4", "$@39", "sub_subnet4", "$@40", "subnet4_params",
+  "subnet4_param", "subnet", "$@41", "subnet_4o6_interface", "$@42",
+  "subnet_4o6_interface_id", "$@43", "subnet_4o6_subnet", "$@44",
+  "interface", "$@45", "interface_id", "$@46", "client_class", "$@47",
+  "reservation_mode", "$@48", "id", "rapid_commit", "option_def_list",
+  "$@49", "option_def_list_content", "not_empty_option_def_list",
+  "option_def_entry", "$@50", "sub_option_def", "$@51",
   "option_def_params", "not_empty_option_def_params", "option_def_param",
-  "option_def_name", "code", "option_def_code", "option_def_type", "$@50",
-  "option_def_record_types", "$@51", "space", "$@52", "option_def_space",
-  "option_def_encapsulate", "$@53", "option_def_array", "option_data_list",
-  "$@54", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@55", "sub_option_data", "$@56",
+  "option_def_name", "code", "option_def_code", "option_def_type", "$@52",
+  "option_def_record_types", "$@53", "space", "$@54", "option_def_space",
+  "option_def_encapsulate", "$@55", "option_def_array", "option_data_list",
+  "$@56", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@57", "sub_option_data", "$@58",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@57",
+  "option_data_param", "option_data_name", "option_data_data", "$@59",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "pools_list", "$@58", "pools_list_content", "not_empty_pools_list",
-  "pool_list_entry", "$@59", "sub_pool4", "$@60", "pool_params",
-  "pool_param", "pool_entry", "$@61", "user_context", "$@62",
-  "reservations", "$@63", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@64", "sub_reservation",
-  "$@65", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@66", "server_hostname", "$@67",
-  "boot_file_name", "$@68", "ip_address", "$@69", "duid", "$@70",
-  "hw_address", "$@71", "client_id_value", "$@72", "circuit_id_value",
-  "$@73", "hostname", "$@74", "reservation_client_classes", "$@75",
-  "relay", "$@76", "relay_map", "$@77", "client_classes", "$@78",
-  "client_classes_list", "$@79", "client_class_params",
+  "pools_list", "$@60", "pools_list_content", "not_empty_pools_list",
+  "pool_list_entry", "$@61", "sub_pool4", "$@62", "pool_params",
+  "pool_param", "pool_entry", "$@63", "user_context", "$@64",
+  "reservations", "$@65", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@66", "sub_reservation",
+  "$@67", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@68", "server_hostname", "$@69",
+  "boot_file_name", "$@70", "ip_address", "$@71", "duid", "$@72",
+  "hw_address", "$@73", "client_id_value", "$@74", "circuit_id_value",
+  "$@75", "hostname", "$@76", "reservation_client_classes", "$@77",
+  "relay", "$@78", "relay_map", "$@79", "client_classes", "$@80",
+  "client_classes_list", "$@81", "client_class_params",
   "not_empty_client_class_params", "client_class_param",
-  "client_class_name", "client_class_test", "$@80", "dhcp4o6_port",
-  "control_socket", "$@81", "control_socket_params",
-  "control_socket_param", "control_socket_type", "$@82",
-  "control_socket_name", "$@83", "dhcp_ddns", "$@84", "sub_dhcp_ddns",
-  "$@85", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@86", "server_ip", "$@87", "server_port",
-  "sender_ip", "$@88", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@89", "ncr_protocol_value", "ncr_format", "$@90",
+  "client_class_name", "client_class_test", "$@82", "dhcp4o6_port",
+  "packet_timeline", "control_socket", "$@83", "control_socket_params",
+  "control_socket_param", "control_socket_type", "$@84",
+  "control_socket_name", "$@85", "dhcp_ddns", "$@86", "sub_dhcp_ddns",
+  "$@87", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
+  "qualifying_suffix", "$@88", "server_ip", "$@89", "server_port",
+  "sender_ip", "$@90", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@91", "ncr_protocol_value", "ncr_format", "$@92", "ncr_format_value",
   "always_include_fqdn", "allow_client_update", "override_no_update",
-  "override_client_update", "replace_client_name", "$@91",
-  "replace_client_name_value", "generated_prefix", "$@92",
-  "dhcp6_json_object", "$@93", "dhcpddns_json_object", "$@94",
-  "logging_object", "$@95", "logging_params", "logging_param", "loggers",
-  "$@96", "loggers_entries", "logger_entry", "$@97", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@98", "output_options_list",
-  "$@99", "output_options_list_content", "output_entry", "$@100",
-  "output_params", "output_param", "$@101", YY_NULLPTR
+  "override_client_update", "replace_client_name", "$@93",
+  "replace_client_name_value", "generated_prefix", "$@94",
+  "dhcp6_json_object", "$@95", "dhcpddns_json_object", "$@96",
+  "logging_object", "$@97", "logging_params", "logging_param",
+  "async_logging", "$@98", "async_logging_params", "async_logging_param",
+  "queue_size", "overflow_policy", "$@99", "loggers", "$@100",
+  "loggers_entries", "logger_entry", "$@101", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@102", "output_options_list",
+  "$@103", "output_options_list_content", "output_entry", "$@104",
+  "output_params", "output_param", "$@105", "rate_limits_list", "$@106",
+  "rate_limits_list_content", "rate_limit_entries", "rate_limit_entry",
+  "$@107", "rate_limit_params", "rate_limit_param", "rate_limit_message",
+  "$@108", "rate_limit_sample", "rate_limit_rate", "rate_limit_interval", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER4_DEBUG
-  const unsigned short int
+  const short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   213,   213,   213,   214,   214,   215,   215,   216,   216,
-     217,   217,   218,   218,   219,   219,   220,   220,   221,   221,
-     222,   222,   223,   223,   231,   232,   233,   234,   235,   236,
-     237,   240,   245,   245,   256,   259,   260,   263,   267,   274,
-     274,   281,   282,   285,   289,   296,   296,   303,   304,   307,
-     311,   322,   332,   332,   344,   345,   349,   350,   351,   352,
-     353,   356,   356,   373,   373,   381,   382,   387,   388,   389,
-     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-     400,   401,   402,   403,   404,   405,   406,   407,   410,   415,
-     420,   425,   430,   435,   441,   441,   451,   452,   455,   456,
-     459,   459,   467,   467,   477,   477,   484,   485,   488,   488,
-     498,   498,   508,   509,   512,   513,   514,   515,   516,   517,
-     518,   519,   520,   521,   524,   524,   531,   532,   533,   534,
-     537,   537,   545,   545,   553,   553,   561,   561,   569,   574,
-     579,   584,   589,   589,   599,   600,   603,   604,   605,   606,
-     609,   614,   619,   624,   629,   629,   639,   640,   643,   644,
-     647,   647,   655,   655,   663,   664,   665,   668,   669,   672,
-     672,   680,   680,   688,   688,   698,   699,   702,   703,   704,
-     705,   706,   707,   710,   715,   720,   725,   730,   735,   743,
-     743,   756,   757,   760,   761,   768,   768,   791,   791,   800,
-     801,   805,   806,   807,   808,   809,   810,   811,   812,   813,
-     814,   815,   816,   817,   818,   819,   820,   821,   822,   823,
-     824,   827,   827,   835,   835,   843,   843,   851,   851,   859,
-     859,   867,   867,   875,   875,   883,   883,   891,   896,   905,
-     905,   917,   918,   921,   922,   927,   927,   938,   938,   948,
-     949,   952,   953,   956,   957,   958,   959,   960,   961,   962,
-     963,   966,   968,   973,   975,   975,   983,   983,   991,   991,
-     999,  1001,  1001,  1009,  1018,  1018,  1030,  1031,  1036,  1037,
-    1042,  1042,  1053,  1053,  1064,  1065,  1070,  1071,  1076,  1077,
-    1078,  1079,  1080,  1081,  1084,  1086,  1086,  1094,  1096,  1098,
-    1106,  1106,  1118,  1119,  1122,  1123,  1126,  1126,  1134,  1134,
-    1142,  1143,  1146,  1147,  1148,  1149,  1152,  1152,  1160,  1160,
-    1170,  1170,  1180,  1181,  1184,  1185,  1188,  1188,  1196,  1196,
-    1204,  1205,  1208,  1209,  1213,  1214,  1215,  1216,  1217,  1218,
-    1219,  1220,  1221,  1222,  1223,  1224,  1227,  1227,  1235,  1235,
-    1243,  1243,  1251,  1251,  1259,  1259,  1267,  1267,  1275,  1275,
-    1283,  1283,  1292,  1292,  1300,  1300,  1313,  1313,  1323,  1323,
-    1334,  1334,  1344,  1345,  1348,  1348,  1356,  1357,  1360,  1361,
-    1364,  1365,  1366,  1367,  1368,  1369,  1370,  1373,  1375,  1375,
-    1387,  1394,  1394,  1404,  1405,  1408,  1409,  1412,  1412,  1420,
-    1420,  1430,  1430,  1440,  1440,  1448,  1449,  1452,  1453,  1454,
-    1455,  1456,  1457,  1458,  1459,  1460,  1461,  1462,  1463,  1464,
-    1465,  1466,  1467,  1470,  1475,  1475,  1483,  1483,  1491,  1496,
-    1496,  1504,  1509,  1514,  1514,  1522,  1523,  1526,  1526,  1534,
-    1539,  1544,  1549,  1554,  1554,  1562,  1565,  1568,  1571,  1574,
-    1580,  1580,  1590,  1590,  1597,  1597,  1609,  1609,  1622,  1623,
-    1627,  1631,  1631,  1643,  1644,  1648,  1648,  1656,  1657,  1660,
-    1661,  1662,  1663,  1664,  1667,  1672,  1672,  1680,  1680,  1690,
-    1691,  1694,  1694,  1702,  1703,  1706,  1706
+       0,   228,   228,   228,   229,   229,   230,   230,   231,   231,
+     232,   232,   233,   233,   234,   234,   235,   235,   236,   236,
+     237,   237,   238,   238,   246,   247,   248,   249,   250,   251,
+     252,   255,   260,   260,   271,   274,   275,   278,   282,   289,
+     289,   296,   297,   300,   304,   311,   311,   318,   319,   322,
+     326,   337,   347,   347,   359,   360,   364,   365,   366,   367,
+     368,   371,   371,   388,   388,   396,   397,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   426,
+     431,   436,   441,   446,   451,   457,   457,   467,   468,   471,
+     472,   475,   475,   483,   483,   493,   493,   500,   501,   504,
+     504,   514,   514,   524,   525,   528,   529,   530,   531,   532,
+     533,   534,   535,   536,   537,   538,   539,   540,   543,   543,
+     550,   551,   552,   553,   556,   556,   564,   564,   572,   572,
+     580,   580,   588,   593,   598,   598,   606,   606,   614,   619,
+     624,   629,   629,   639,   640,   643,   644,   645,   646,   649,
+     654,   659,   664,   669,   669,   679,   680,   683,   684,   687,
+     687,   695,   695,   703,   704,   705,   708,   709,   712,   712,
+     720,   720,   728,   728,   738,   739,   742,   743,   744,   745,
+     746,   747,   750,   755,   760,   765,   770,   775,   783,   783,
+     796,   797,   800,   801,   808,   808,   831,   831,   840,   841,
+     845,   846,   847,   848,   849,   850,   851,   852,   853,   854,
+     855,   856,   857,   858,   859,   860,   861,   862,   863,   864,
+     867,   867,   875,   875,   883,   883,   891,   891,   899,   899,
+     907,   907,   915,   915,   923,   923,   931,   936,   945,   945,
+     957,   958,   961,   962,   967,   967,   978,   978,   988,   989,
+     992,   993,   996,   997,   998,   999,  1000,  1001,  1002,  1003,
+    1006,  1008,  1013,  1015,  1015,  1023,  1023,  1031,  1031,  1039,
+    1041,  1041,  1049,  1058,  1058,  1070,  1071,  1076,  1077,  1082,
+    1082,  1093,  1093,  1104,  1105,  1110,  1111,  1116,  1117,  1118,
+    1119,  1120,  1121,  1124,  1126,  1126,  1134,  1136,  1138,  1146,
+    1146,  1158,  1159,  1162,  1163,  1166,  1166,  1174,  1174,  1182,
+    1183,  1186,  1187,  1188,  1189,  1192,  1192,  1200,  1200,  1210,
+    1210,  1220,  1221,  1224,  1225,  1228,  1228,  1236,  1236,  1244,
+    1245,  1248,  1249,  1253,  1254,  1255,  1256,  1257,  1258,  1259,
+    1260,  1261,  1262,  1263,  1264,  1267,  1267,  1275,  1275,  1283,
+    1283,  1291,  1291,  1299,  1299,  1307,  1307,  1315,  1315,  1323,
+    1323,  1332,  1332,  1340,  1340,  1353,  1353,  1363,  1363,  1374,
+    1374,  1384,  1385,  1388,  1388,  1396,  1397,  1400,  1401,  1404,
+    1405,  1406,  1407,  1408,  1409,  1410,  1413,  1415,  1415,  1427,
+    1432,  1439,  1439,  1449,  1450,  1453,  1454,  1457,  1457,  1465,
+    1465,  1475,  1475,  1485,  1485,  1493,  1494,  1497,  1498,  1499,
+    1500,  1501,  1502,  1503,  1504,  1505,  1506,  1507,  1508,  1509,
+    1510,  1511,  1512,  1515,  1520,  1520,  1528,  1528,  1536,  1541,
+    1541,  1549,  1554,  1559,  1559,  1567,  1568,  1571,  1571,  1579,
+    1580,  1583,  1588,  1593,  1598,  1603,  1603,  1611,  1614,  1617,
+    1620,  1623,  1629,  1629,  1639,  1639,  1646,  1646,  1658,  1658,
+    1671,  1672,  1676,  1677,  1681,  1681,  1691,  1692,  1695,  1696,
+    1697,  1700,  1705,  1705,  1715,  1715,  1727,  1728,  1732,  1732,
+    1740,  1741,  1744,  1745,  1746,  1747,  1748,  1749,  1752,  1757,
+    1757,  1765,  1765,  1775,  1776,  1779,  1779,  1787,  1788,  1791,
+    1791,  1801,  1801,  1811,  1812,  1815,  1816,  1819,  1819,  1827,
+    1828,  1831,  1832,  1833,  1834,  1837,  1837,  1845,  1850,  1855
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp4Parser::yystack_print_ ()
+  Dhcp4Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp4Parser::yy_reduce_print_ (int yyrule)
+  Dhcp4Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -3990,10 +4408,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER4_DEBUG
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:1167
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 3996 "dhcp4_parser.cc" // lalr1.cc:1167
-#line 1714 "dhcp4_parser.yy" // lalr1.cc:1168
+#line 4414 "dhcp4_parser.cc"
+
+#line 1860 "dhcp4_parser.yy"
 
 
 void
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +30,7 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+
 /**
  ** \file dhcp4_parser.h
  ** Define the isc::dhcp::parser class.
@@ -37,10 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
 #ifndef YY_PARSER4_DHCP4_PARSER_H_INCLUDED
 # define YY_PARSER4_DHCP4_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "dhcp4_parser.yy" // lalr1.cc:377
+// "%code requires" blocks.
+#line 17 "dhcp4_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -52,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 56 "dhcp4_parser.h" // lalr1.cc:377
+#line 61 "dhcp4_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -60,56 +65,87 @@ using namespace std;
 # include <stdexcept>
 # include <string>
 # include <vector>
-# include "stack.hh"
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER4__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER4__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -122,6 +158,39 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
 /* Debug traces.  */
 #ifndef PARSER4_DEBUG
 # if defined YYDEBUG
@@ -135,120 +204,187 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined PARSER4_DEBUG */
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:377
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 141 "dhcp4_parser.h" // lalr1.cc:377
+#line 210 "dhcp4_parser.h"
+
 
 
 
-  /// A char[S] buffer to store and retrieve objects.
+  /// A Bison parser.
+  class Dhcp4Parser
+  {
+  public:
+#ifdef PARSER4_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER4_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER4_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yytypeid_ (YY_NULLPTR)
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+      , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (const T& t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
-      new (yyas_<T> ()) T (t);
+      PARSER4__ASSERT (sizeof (T) <= size);
+      new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER4__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
-    build ()
+    emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T;
+      return *new (yyas_<T> ()) T ();
     }
 
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
-    build (const T& t)
+    emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
 
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
-    /// should not be the variant's responsability.
+    /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type&& that)
     {
-      build<T> ();
-      swap<T> (other);
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
+#endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      build<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -261,46 +397,31 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
-    self_type& operator=(const self_type&);
-    variant (const self_type&);
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class Dhcp4Parser
-  {
-  public:
-#ifndef PARSER4_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
@@ -309,192 +430,722 @@ namespace isc { namespace dhcp {
       // socket_type
       // db_type
       // ncr_protocol_value
+      // ncr_format_value
       // replace_client_name_value
-      char dummy1[sizeof(ElementPtr)];
+      char dummy1[sizeof (ElementPtr)];
 
       // "boolean"
-      char dummy2[sizeof(bool)];
+      char dummy2[sizeof (bool)];
 
       // "floating point"
-      char dummy3[sizeof(double)];
+      char dummy3[sizeof (double)];
 
       // "integer"
-      char dummy4[sizeof(int64_t)];
+      char dummy4[sizeof (int64_t)];
 
       // "constant string"
-      char dummy5[sizeof(std::string)];
-};
+      char dummy5[sizeof (std::string)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof(union_type)> semantic_type;
-#else
-    typedef PARSER4_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP4 = 265,
-        TOKEN_INTERFACES_CONFIG = 266,
-        TOKEN_INTERFACES = 267,
-        TOKEN_DHCP_SOCKET_TYPE = 268,
-        TOKEN_RAW = 269,
-        TOKEN_UDP = 270,
-        TOKEN_ECHO_CLIENT_ID = 271,
-        TOKEN_MATCH_CLIENT_ID = 272,
-        TOKEN_NEXT_SERVER = 273,
-        TOKEN_SERVER_HOSTNAME = 274,
-        TOKEN_BOOT_FILE_NAME = 275,
-        TOKEN_LEASE_DATABASE = 276,
-        TOKEN_HOSTS_DATABASE = 277,
-        TOKEN_TYPE = 278,
-        TOKEN_MEMFILE = 279,
-        TOKEN_MYSQL = 280,
-        TOKEN_POSTGRESQL = 281,
-        TOKEN_CQL = 282,
-        TOKEN_USER = 283,
-        TOKEN_PASSWORD = 284,
-        TOKEN_HOST = 285,
-        TOKEN_PERSIST = 286,
-        TOKEN_LFC_INTERVAL = 287,
-        TOKEN_READONLY = 288,
-        TOKEN_CONNECT_TIMEOUT = 289,
-        TOKEN_VALID_LIFETIME = 290,
-        TOKEN_RENEW_TIMER = 291,
-        TOKEN_REBIND_TIMER = 292,
-        TOKEN_DECLINE_PROBATION_PERIOD = 293,
-        TOKEN_SUBNET4 = 294,
-        TOKEN_SUBNET_4O6_INTERFACE = 295,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 296,
-        TOKEN_SUBNET_4O6_SUBNET = 297,
-        TOKEN_OPTION_DEF = 298,
-        TOKEN_OPTION_DATA = 299,
-        TOKEN_NAME = 300,
-        TOKEN_DATA = 301,
-        TOKEN_CODE = 302,
-        TOKEN_SPACE = 303,
-        TOKEN_CSV_FORMAT = 304,
-        TOKEN_RECORD_TYPES = 305,
-        TOKEN_ENCAPSULATE = 306,
-        TOKEN_ARRAY = 307,
-        TOKEN_POOLS = 308,
-        TOKEN_POOL = 309,
-        TOKEN_USER_CONTEXT = 310,
-        TOKEN_SUBNET = 311,
-        TOKEN_INTERFACE = 312,
-        TOKEN_INTERFACE_ID = 313,
-        TOKEN_ID = 314,
-        TOKEN_RAPID_COMMIT = 315,
-        TOKEN_RESERVATION_MODE = 316,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 317,
-        TOKEN_CLIENT_CLASSES = 318,
-        TOKEN_TEST = 319,
-        TOKEN_CLIENT_CLASS = 320,
-        TOKEN_RESERVATIONS = 321,
-        TOKEN_DUID = 322,
-        TOKEN_HW_ADDRESS = 323,
-        TOKEN_CIRCUIT_ID = 324,
-        TOKEN_CLIENT_ID = 325,
-        TOKEN_HOSTNAME = 326,
-        TOKEN_RELAY = 327,
-        TOKEN_IP_ADDRESS = 328,
-        TOKEN_HOOKS_LIBRARIES = 329,
-        TOKEN_LIBRARY = 330,
-        TOKEN_PARAMETERS = 331,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 332,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 333,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 334,
-        TOKEN_HOLD_RECLAIMED_TIME = 335,
-        TOKEN_MAX_RECLAIM_LEASES = 336,
-        TOKEN_MAX_RECLAIM_TIME = 337,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 338,
-        TOKEN_DHCP4O6_PORT = 339,
-        TOKEN_CONTROL_SOCKET = 340,
-        TOKEN_SOCKET_TYPE = 341,
-        TOKEN_SOCKET_NAME = 342,
-        TOKEN_DHCP_DDNS = 343,
-        TOKEN_ENABLE_UPDATES = 344,
-        TOKEN_QUALIFYING_SUFFIX = 345,
-        TOKEN_SERVER_IP = 346,
-        TOKEN_SERVER_PORT = 347,
-        TOKEN_SENDER_IP = 348,
-        TOKEN_SENDER_PORT = 349,
-        TOKEN_MAX_QUEUE_SIZE = 350,
-        TOKEN_NCR_PROTOCOL = 351,
-        TOKEN_NCR_FORMAT = 352,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 353,
-        TOKEN_ALLOW_CLIENT_UPDATE = 354,
-        TOKEN_OVERRIDE_NO_UPDATE = 355,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 356,
-        TOKEN_REPLACE_CLIENT_NAME = 357,
-        TOKEN_GENERATED_PREFIX = 358,
-        TOKEN_TCP = 359,
-        TOKEN_JSON = 360,
-        TOKEN_WHEN_PRESENT = 361,
-        TOKEN_NEVER = 362,
-        TOKEN_ALWAYS = 363,
-        TOKEN_WHEN_NOT_PRESENT = 364,
-        TOKEN_LOGGING = 365,
-        TOKEN_LOGGERS = 366,
-        TOKEN_OUTPUT_OPTIONS = 367,
-        TOKEN_OUTPUT = 368,
-        TOKEN_DEBUGLEVEL = 369,
-        TOKEN_SEVERITY = 370,
-        TOKEN_DHCP6 = 371,
-        TOKEN_DHCPDDNS = 372,
-        TOKEN_TOPLEVEL_JSON = 373,
-        TOKEN_TOPLEVEL_DHCP4 = 374,
-        TOKEN_SUB_DHCP4 = 375,
-        TOKEN_SUB_INTERFACES4 = 376,
-        TOKEN_SUB_SUBNET4 = 377,
-        TOKEN_SUB_POOL4 = 378,
-        TOKEN_SUB_RESERVATION = 379,
-        TOKEN_SUB_OPTION_DEF = 380,
-        TOKEN_SUB_OPTION_DATA = 381,
-        TOKEN_SUB_HOOKS_LIBRARY = 382,
-        TOKEN_SUB_DHCP_DDNS = 383,
-        TOKEN_STRING = 384,
-        TOKEN_INTEGER = 385,
-        TOKEN_FLOAT = 386,
-        TOKEN_BOOLEAN = 387
+      enum token_kind_type
+      {
+        TOKEN_PARSER4_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER4_error = 256,     // error
+    TOKEN_PARSER4_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP4 = 265,             // "Dhcp4"
+    TOKEN_INTERFACES_CONFIG = 266, // "interfaces-config"
+    TOKEN_INTERFACES = 267,        // "interfaces"
+    TOKEN_DHCP_SOCKET_TYPE = 268,  // "dhcp-socket-type"
+    TOKEN_RAW = 269,               // "raw"
+    TOKEN_UDP = 270,               // "udp"
+    TOKEN_ECHO_CLIENT_ID = 271,    // "echo-client-id"
+    TOKEN_MATCH_CLIENT_ID = 272,   // "match-client-id"
+    TOKEN_NEXT_SERVER = 273,       // "next-server"
+    TOKEN_SERVER_HOSTNAME = 274,   // "server-hostname"
+    TOKEN_BOOT_FILE_NAME = 275,    // "boot-file-name"
+    TOKEN_LEASE_DATABASE = 276,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 277,    // "hosts-database"
+    TOKEN_TYPE = 278,              // "type"
+    TOKEN_MEMFILE = 279,           // "memfile"
+    TOKEN_MYSQL = 280,             // "mysql"
+    TOKEN_POSTGRESQL = 281,        // "postgresql"
+    TOKEN_CQL = 282,               // "cql"
+    TOKEN_USER = 283,              // "user"
+    TOKEN_PASSWORD = 284,          // "password"
+    TOKEN_HOST = 285,              // "host"
+    TOKEN_PERSIST = 286,           // "persist"
+    TOKEN_MAPPED_STORE = 287,      // "mapped-store"
+    TOKEN_FILE_FORMAT = 288,       // "file-format"
+    TOKEN_LFC_INTERVAL = 289,      // "lfc-interval"
+    TOKEN_LFC_MODE = 290,          // "lfc-mode"
+    TOKEN_READONLY = 291,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 292,   // "connect-timeout"
+    TOKEN_VALID_LIFETIME = 293,    // "valid-lifetime"
+    TOKEN_RENEW_TIMER = 294,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 295,      // "rebind-timer"
+    TOKEN_DECLINE_PROBATION_PERIOD = 296, // "decline-probation-period"
+    TOKEN_SUBNET4 = 297,           // "subnet4"
+    TOKEN_SUBNET_4O6_INTERFACE = 298, // "4o6-interface"
+    TOKEN_SUBNET_4O6_INTERFACE_ID = 299, // "4o6-interface-id"
+    TOKEN_SUBNET_4O6_SUBNET = 300, // "4o6-subnet"
+    TOKEN_OPTION_DEF = 301,        // "option-def"
+    TOKEN_OPTION_DATA = 302,       // "option-data"
+    TOKEN_NAME = 303,              // "name"
+    TOKEN_DATA = 304,              // "data"
+    TOKEN_CODE = 305,              // "code"
+    TOKEN_SPACE = 306,             // "space"
+    TOKEN_CSV_FORMAT = 307,        // "csv-format"
+    TOKEN_RECORD_TYPES = 308,      // "record-types"
+    TOKEN_ENCAPSULATE = 309,       // "encapsulate"
+    TOKEN_ARRAY = 310,             // "array"
+    TOKEN_POOLS = 311,             // "pools"
+    TOKEN_POOL = 312,              // "pool"
+    TOKEN_USER_CONTEXT = 313,      // "user-context"
+    TOKEN_SUBNET = 314,            // "subnet"
+    TOKEN_INTERFACE = 315,         // "interface"
+    TOKEN_INTERFACE_ID = 316,      // "interface-id"
+    TOKEN_ID = 317,                // "id"
+    TOKEN_RAPID_COMMIT = 318,      // "rapid-commit"
+    TOKEN_RESERVATION_MODE = 319,  // "reservation-mode"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 320, // "host-reservation-identifiers"
+    TOKEN_CLIENT_CLASSES = 321,    // "client-classes"
+    TOKEN_TEST = 322,              // "test"
+    TOKEN_CLIENT_CLASS = 323,      // "client-class"
+    TOKEN_RESERVATIONS = 324,      // "reservations"
+    TOKEN_DUID = 325,              // "duid"
+    TOKEN_HW_ADDRESS = 326,        // "hw-address"
+    TOKEN_CIRCUIT_ID = 327,        // "circuit-id"
+    TOKEN_CLIENT_ID = 328,         // "client-id"
+    TOKEN_HOSTNAME = 329,          // "hostname"
+    TOKEN_RELAY = 330,             // "relay"
+    TOKEN_IP_ADDRESS = 331,        // "ip-address"
+    TOKEN_HOOKS_LIBRARIES = 332,   // "hooks-libraries"
+    TOKEN_LIBRARY = 333,           // "library"
+    TOKEN_PARAMETERS = 334,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 335, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 336, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 337, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 338, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 339, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 340,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 341, // "unwarned-reclaim-cycles"
+    TOKEN_DHCP4O6_PORT = 342,      // "dhcp4o6-port"
+    TOKEN_PACKET_TIMELINE = 343,   // "packet-timeline"
+    TOKEN_CONTROL_SOCKET = 344,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 345,       // "socket-type"
+    TOKEN_SOCKET_NAME = 346,       // "socket-name"
+    TOKEN_DHCP_DDNS = 347,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 348,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 349, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 350,         // "server-ip"
+    TOKEN_SERVER_PORT = 351,       // "server-port"
+    TOKEN_SENDER_IP = 352,         // "sender-ip"
+    TOKEN_SENDER_PORT = 353,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 354,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 355,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 356,        // "ncr-format"
+    TOKEN_ALWAYS_INCLUDE_FQDN = 357, // "always-include-fqdn"
+    TOKEN_ALLOW_CLIENT_UPDATE = 358, // "allow-client-update"
+    TOKEN_OVERRIDE_NO_UPDATE = 359, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 360, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 361, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 362,  // "generated-prefix"
+    TOKEN_TCP = 363,               // "tcp"
+    TOKEN_JSON = 364,              // "JSON"
+    TOKEN_BINARY = 365,            // "BINARY"
+    TOKEN_WHEN_PRESENT = 366,      // "when-present"
+    TOKEN_NEVER = 367,             // "never"
+    TOKEN_ALWAYS = 368,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 369,  // "when-not-present"
+    TOKEN_LOGGING = 370,           // "Logging"
+    TOKEN_LOGGERS = 371,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 372,    // "output_options"
+    TOKEN_OUTPUT = 373,            // "output"
+    TOKEN_DEBUGLEVEL = 374,        // "debuglevel"
+    TOKEN_SEVERITY = 375,          // "severity"
+    TOKEN_ASYNC = 376,             // "async"
+    TOKEN_QUEUE_SIZE = 377,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 378,   // "overflow-policy"
+    TOKEN_RATE_LIMITS = 379,       // "rate-limits"
+    TOKEN_MESSAGE = 380,           // "message"
+    TOKEN_SAMPLE = 381,            // "sample"
+    TOKEN_RATE = 382,              // "rate"
+    TOKEN_INTERVAL = 383,          // "interval"
+    TOKEN_DHCP6 = 384,             // "Dhcp6"
+    TOKEN_DHCPDDNS = 385,          // "DhcpDdns"
+    TOKEN_TOPLEVEL_JSON = 386,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP4 = 387,    // TOPLEVEL_DHCP4
+    TOKEN_SUB_DHCP4 = 388,         // SUB_DHCP4
+    TOKEN_SUB_INTERFACES4 = 389,   // SUB_INTERFACES4
+    TOKEN_SUB_SUBNET4 = 390,       // SUB_SUBNET4
+    TOKEN_SUB_POOL4 = 391,         // SUB_POOL4
+    TOKEN_SUB_RESERVATION = 392,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEF = 393,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 394,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 395, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 396,     // SUB_DHCP_DDNS
+    TOKEN_STRING = 397,            // "constant string"
+    TOKEN_INTEGER = 398,           // "integer"
+    TOKEN_FLOAT = 399,             // "floating point"
+    TOKEN_BOOLEAN = 400            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 146, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP4 = 10,                            // "Dhcp4"
+        S_INTERFACES_CONFIG = 11,                // "interfaces-config"
+        S_INTERFACES = 12,                       // "interfaces"
+        S_DHCP_SOCKET_TYPE = 13,                 // "dhcp-socket-type"
+        S_RAW = 14,                              // "raw"
+        S_UDP = 15,                              // "udp"
+        S_ECHO_CLIENT_ID = 16,                   // "echo-client-id"
+        S_MATCH_CLIENT_ID = 17,                  // "match-client-id"
+        S_NEXT_SERVER = 18,                      // "next-server"
+        S_SERVER_HOSTNAME = 19,                  // "server-hostname"
+        S_BOOT_FILE_NAME = 20,                   // "boot-file-name"
+        S_LEASE_DATABASE = 21,                   // "lease-database"
+        S_HOSTS_DATABASE = 22,                   // "hosts-database"
+        S_TYPE = 23,                             // "type"
+        S_MEMFILE = 24,                          // "memfile"
+        S_MYSQL = 25,                            // "mysql"
+        S_POSTGRESQL = 26,                       // "postgresql"
+        S_CQL = 27,                              // "cql"
+        S_USER = 28,                             // "user"
+        S_PASSWORD = 29,                         // "password"
+        S_HOST = 30,                             // "host"
+        S_PERSIST = 31,                          // "persist"
+        S_MAPPED_STORE = 32,                     // "mapped-store"
+        S_FILE_FORMAT = 33,                      // "file-format"
+        S_LFC_INTERVAL = 34,                     // "lfc-interval"
+        S_LFC_MODE = 35,                         // "lfc-mode"
+        S_READONLY = 36,                         // "readonly"
+        S_CONNECT_TIMEOUT = 37,                  // "connect-timeout"
+        S_VALID_LIFETIME = 38,                   // "valid-lifetime"
+        S_RENEW_TIMER = 39,                      // "renew-timer"
+        S_REBIND_TIMER = 40,                     // "rebind-timer"
+        S_DECLINE_PROBATION_PERIOD = 41,         // "decline-probation-period"
+        S_SUBNET4 = 42,                          // "subnet4"
+        S_SUBNET_4O6_INTERFACE = 43,             // "4o6-interface"
+        S_SUBNET_4O6_INTERFACE_ID = 44,          // "4o6-interface-id"
+        S_SUBNET_4O6_SUBNET = 45,                // "4o6-subnet"
+        S_OPTION_DEF = 46,                       // "option-def"
+        S_OPTION_DATA = 47,                      // "option-data"
+        S_NAME = 48,                             // "name"
+        S_DATA = 49,                             // "data"
+        S_CODE = 50,                             // "code"
+        S_SPACE = 51,                            // "space"
+        S_CSV_FORMAT = 52,                       // "csv-format"
+        S_RECORD_TYPES = 53,                     // "record-types"
+        S_ENCAPSULATE = 54,                      // "encapsulate"
+        S_ARRAY = 55,                            // "array"
+        S_POOLS = 56,                            // "pools"
+        S_POOL = 57,                             // "pool"
+        S_USER_CONTEXT = 58,                     // "user-context"
+        S_SUBNET = 59,                           // "subnet"
+        S_INTERFACE = 60,                        // "interface"
+        S_INTERFACE_ID = 61,                     // "interface-id"
+        S_ID = 62,                               // "id"
+        S_RAPID_COMMIT = 63,                     // "rapid-commit"
+        S_RESERVATION_MODE = 64,                 // "reservation-mode"
+        S_HOST_RESERVATION_IDENTIFIERS = 65,     // "host-reservation-identifiers"
+        S_CLIENT_CLASSES = 66,                   // "client-classes"
+        S_TEST = 67,                             // "test"
+        S_CLIENT_CLASS = 68,                     // "client-class"
+        S_RESERVATIONS = 69,                     // "reservations"
+        S_DUID = 70,                             // "duid"
+        S_HW_ADDRESS = 71,                       // "hw-address"
+        S_CIRCUIT_ID = 72,                       // "circuit-id"
+        S_CLIENT_ID = 73,                        // "client-id"
+        S_HOSTNAME = 74,                         // "hostname"
+        S_RELAY = 75,                            // "relay"
+        S_IP_ADDRESS = 76,                       // "ip-address"
+        S_HOOKS_LIBRARIES = 77,                  // "hooks-libraries"
+        S_LIBRARY = 78,                          // "library"
+        S_PARAMETERS = 79,                       // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 80,        // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 81,          // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 82,  // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 83,              // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 84,               // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 85,                 // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 86,          // "unwarned-reclaim-cycles"
+        S_DHCP4O6_PORT = 87,                     // "dhcp4o6-port"
+        S_PACKET_TIMELINE = 88,                  // "packet-timeline"
+        S_CONTROL_SOCKET = 89,                   // "control-socket"
+        S_SOCKET_TYPE = 90,                      // "socket-type"
+        S_SOCKET_NAME = 91,                      // "socket-name"
+        S_DHCP_DDNS = 92,                        // "dhcp-ddns"
+        S_ENABLE_UPDATES = 93,                   // "enable-updates"
+        S_QUALIFYING_SUFFIX = 94,                // "qualifying-suffix"
+        S_SERVER_IP = 95,                        // "server-ip"
+        S_SERVER_PORT = 96,                      // "server-port"
+        S_SENDER_IP = 97,                        // "sender-ip"
+        S_SENDER_PORT = 98,                      // "sender-port"
+        S_MAX_QUEUE_SIZE = 99,                   // "max-queue-size"
+        S_NCR_PROTOCOL = 100,                    // "ncr-protocol"
+        S_NCR_FORMAT = 101,                      // "ncr-format"
+        S_ALWAYS_INCLUDE_FQDN = 102,             // "always-include-fqdn"
+        S_ALLOW_CLIENT_UPDATE = 103,             // "allow-client-update"
+        S_OVERRIDE_NO_UPDATE = 104,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 105,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 106,             // "replace-client-name"
+        S_GENERATED_PREFIX = 107,                // "generated-prefix"
+        S_TCP = 108,                             // "tcp"
+        S_JSON = 109,                            // "JSON"
+        S_BINARY = 110,                          // "BINARY"
+        S_WHEN_PRESENT = 111,                    // "when-present"
+        S_NEVER = 112,                           // "never"
+        S_ALWAYS = 113,                          // "always"
+        S_WHEN_NOT_PRESENT = 114,                // "when-not-present"
+        S_LOGGING = 115,                         // "Logging"
+        S_LOGGERS = 116,                         // "loggers"
+        S_OUTPUT_OPTIONS = 117,                  // "output_options"
+        S_OUTPUT = 118,                          // "output"
+        S_DEBUGLEVEL = 119,                      // "debuglevel"
+        S_SEVERITY = 120,                        // "severity"
+        S_ASYNC = 121,                           // "async"
+        S_QUEUE_SIZE = 122,                      // "queue-size"
+        S_OVERFLOW_POLICY = 123,                 // "overflow-policy"
+        S_RATE_LIMITS = 124,                     // "rate-limits"
+        S_MESSAGE = 125,                         // "message"
+        S_SAMPLE = 126,                          // "sample"
+        S_RATE = 127,                            // "rate"
+        S_INTERVAL = 128,                        // "interval"
+        S_DHCP6 = 129,                           // "Dhcp6"
+        S_DHCPDDNS = 130,                        // "DhcpDdns"
+        S_TOPLEVEL_JSON = 131,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP4 = 132,                  // TOPLEVEL_DHCP4
+        S_SUB_DHCP4 = 133,                       // SUB_DHCP4
+        S_SUB_INTERFACES4 = 134,                 // SUB_INTERFACES4
+        S_SUB_SUBNET4 = 135,                     // SUB_SUBNET4
+        S_SUB_POOL4 = 136,                       // SUB_POOL4
+        S_SUB_RESERVATION = 137,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEF = 138,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 139,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 140,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 141,                   // SUB_DHCP_DDNS
+        S_STRING = 142,                          // "constant string"
+        S_INTEGER = 143,                         // "integer"
+        S_FLOAT = 144,                           // "floating point"
+        S_BOOLEAN = 145,                         // "boolean"
+        S_YYACCEPT = 146,                        // $accept
+        S_start = 147,                           // start
+        S_148_1 = 148,                           // $@1
+        S_149_2 = 149,                           // $@2
+        S_150_3 = 150,                           // $@3
+        S_151_4 = 151,                           // $@4
+        S_152_5 = 152,                           // $@5
+        S_153_6 = 153,                           // $@6
+        S_154_7 = 154,                           // $@7
+        S_155_8 = 155,                           // $@8
+        S_156_9 = 156,                           // $@9
+        S_157_10 = 157,                          // $@10
+        S_158_11 = 158,                          // $@11
+        S_value = 159,                           // value
+        S_sub_json = 160,                        // sub_json
+        S_map2 = 161,                            // map2
+        S_162_12 = 162,                          // $@12
+        S_map_value = 163,                       // map_value
+        S_map_content = 164,                     // map_content
+        S_not_empty_map = 165,                   // not_empty_map
+        S_list_generic = 166,                    // list_generic
+        S_167_13 = 167,                          // $@13
+        S_list_content = 168,                    // list_content
+        S_not_empty_list = 169,                  // not_empty_list
+        S_list_strings = 170,                    // list_strings
+        S_171_14 = 171,                          // $@14
+        S_list_strings_content = 172,            // list_strings_content
+        S_not_empty_list_strings = 173,          // not_empty_list_strings
+        S_unknown_map_entry = 174,               // unknown_map_entry
+        S_syntax_map = 175,                      // syntax_map
+        S_176_15 = 176,                          // $@15
+        S_global_objects = 177,                  // global_objects
+        S_global_object = 178,                   // global_object
+        S_dhcp4_object = 179,                    // dhcp4_object
+        S_180_16 = 180,                          // $@16
+        S_sub_dhcp4 = 181,                       // sub_dhcp4
+        S_182_17 = 182,                          // $@17
+        S_global_params = 183,                   // global_params
+        S_global_param = 184,                    // global_param
+        S_valid_lifetime = 185,                  // valid_lifetime
+        S_renew_timer = 186,                     // renew_timer
+        S_rebind_timer = 187,                    // rebind_timer
+        S_decline_probation_period = 188,        // decline_probation_period
+        S_echo_client_id = 189,                  // echo_client_id
+        S_match_client_id = 190,                 // match_client_id
+        S_interfaces_config = 191,               // interfaces_config
+        S_192_18 = 192,                          // $@18
+        S_interfaces_config_params = 193,        // interfaces_config_params
+        S_interfaces_config_param = 194,         // interfaces_config_param
+        S_sub_interfaces4 = 195,                 // sub_interfaces4
+        S_196_19 = 196,                          // $@19
+        S_interfaces_list = 197,                 // interfaces_list
+        S_198_20 = 198,                          // $@20
+        S_dhcp_socket_type = 199,                // dhcp_socket_type
+        S_200_21 = 200,                          // $@21
+        S_socket_type = 201,                     // socket_type
+        S_lease_database = 202,                  // lease_database
+        S_203_22 = 203,                          // $@22
+        S_hosts_database = 204,                  // hosts_database
+        S_205_23 = 205,                          // $@23
+        S_database_map_params = 206,             // database_map_params
+        S_database_map_param = 207,              // database_map_param
+        S_database_type = 208,                   // database_type
+        S_209_24 = 209,                          // $@24
+        S_db_type = 210,                         // db_type
+        S_user = 211,                            // user
+        S_212_25 = 212,                          // $@25
+        S_password = 213,                        // password
+        S_214_26 = 214,                          // $@26
+        S_host = 215,                            // host
+        S_216_27 = 216,                          // $@27
+        S_name = 217,                            // name
+        S_218_28 = 218,                          // $@28
+        S_persist = 219,                         // persist
+        S_mapped_store = 220,                    // mapped_store
+        S_file_format = 221,                     // file_format
+        S_222_29 = 222,                          // $@29
+        S_lfc_mode = 223,                        // lfc_mode
+        S_224_30 = 224,                          // $@30
+        S_lfc_interval = 225,                    // lfc_interval
+        S_readonly = 226,                        // readonly
+        S_connect_timeout = 227,                 // connect_timeout
+        S_host_reservation_identifiers = 228,    // host_reservation_identifiers
+        S_229_31 = 229,                          // $@31
+        S_host_reservation_identifiers_list = 230, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 231,     // host_reservation_identifier
+        S_duid_id = 232,                         // duid_id
+        S_hw_address_id = 233,                   // hw_address_id
+        S_circuit_id = 234,                      // circuit_id
+        S_client_id = 235,                       // client_id
+        S_hooks_libraries = 236,                 // hooks_libraries
+        S_237_32 = 237,                          // $@32
+        S_hooks_libraries_list = 238,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 239,  // not_empty_hooks_libraries_list
+        S_hooks_library = 240,                   // hooks_library
+        S_241_33 = 241,                          // $@33
+        S_sub_hooks_library = 242,               // sub_hooks_library
+        S_243_34 = 243,                          // $@34
+        S_hooks_params = 244,                    // hooks_params
+        S_hooks_param = 245,                     // hooks_param
+        S_library = 246,                         // library
+        S_247_35 = 247,                          // $@35
+        S_parameters = 248,                      // parameters
+        S_249_36 = 249,                          // $@36
+        S_expired_leases_processing = 250,       // expired_leases_processing
+        S_251_37 = 251,                          // $@37
+        S_expired_leases_params = 252,           // expired_leases_params
+        S_expired_leases_param = 253,            // expired_leases_param
+        S_reclaim_timer_wait_time = 254,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 255, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 256,             // hold_reclaimed_time
+        S_max_reclaim_leases = 257,              // max_reclaim_leases
+        S_max_reclaim_time = 258,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 259,         // unwarned_reclaim_cycles
+        S_subnet4_list = 260,                    // subnet4_list
+        S_261_38 = 261,                          // $@38
+        S_subnet4_list_content = 262,            // subnet4_list_content
+        S_not_empty_subnet4_list = 263,          // not_empty_subnet4_list
+        S_subnet4 = 264,                         // subnet4
+        S_265_39 = 265,                          // $@39
+        S_sub_subnet4 = 266,                     // sub_subnet4
+        S_267_40 = 267,                          // $@40
+        S_subnet4_params = 268,                  // subnet4_params
+        S_subnet4_param = 269,                   // subnet4_param
+        S_subnet = 270,                          // subnet
+        S_271_41 = 271,                          // $@41
+        S_subnet_4o6_interface = 272,            // subnet_4o6_interface
+        S_273_42 = 273,                          // $@42
+        S_subnet_4o6_interface_id = 274,         // subnet_4o6_interface_id
+        S_275_43 = 275,                          // $@43
+        S_subnet_4o6_subnet = 276,               // subnet_4o6_subnet
+        S_277_44 = 277,                          // $@44
+        S_interface = 278,                       // interface
+        S_279_45 = 279,                          // $@45
+        S_interface_id = 280,                    // interface_id
+        S_281_46 = 281,                          // $@46
+        S_client_class = 282,                    // client_class
+        S_283_47 = 283,                          // $@47
+        S_reservation_mode = 284,                // reservation_mode
+        S_285_48 = 285,                          // $@48
+        S_id = 286,                              // id
+        S_rapid_commit = 287,                    // rapid_commit
+        S_option_def_list = 288,                 // option_def_list
+        S_289_49 = 289,                          // $@49
+        S_option_def_list_content = 290,         // option_def_list_content
+        S_not_empty_option_def_list = 291,       // not_empty_option_def_list
+        S_option_def_entry = 292,                // option_def_entry
+        S_293_50 = 293,                          // $@50
+        S_sub_option_def = 294,                  // sub_option_def
+        S_295_51 = 295,                          // $@51
+        S_option_def_params = 296,               // option_def_params
+        S_not_empty_option_def_params = 297,     // not_empty_option_def_params
+        S_option_def_param = 298,                // option_def_param
+        S_option_def_name = 299,                 // option_def_name
+        S_code = 300,                            // code
+        S_option_def_code = 301,                 // option_def_code
+        S_option_def_type = 302,                 // option_def_type
+        S_303_52 = 303,                          // $@52
+        S_option_def_record_types = 304,         // option_def_record_types
+        S_305_53 = 305,                          // $@53
+        S_space = 306,                           // space
+        S_307_54 = 307,                          // $@54
+        S_option_def_space = 308,                // option_def_space
+        S_option_def_encapsulate = 309,          // option_def_encapsulate
+        S_310_55 = 310,                          // $@55
+        S_option_def_array = 311,                // option_def_array
+        S_option_data_list = 312,                // option_data_list
+        S_313_56 = 313,                          // $@56
+        S_option_data_list_content = 314,        // option_data_list_content
+        S_not_empty_option_data_list = 315,      // not_empty_option_data_list
+        S_option_data_entry = 316,               // option_data_entry
+        S_317_57 = 317,                          // $@57
+        S_sub_option_data = 318,                 // sub_option_data
+        S_319_58 = 319,                          // $@58
+        S_option_data_params = 320,              // option_data_params
+        S_not_empty_option_data_params = 321,    // not_empty_option_data_params
+        S_option_data_param = 322,               // option_data_param
+        S_option_data_name = 323,                // option_data_name
+        S_option_data_data = 324,                // option_data_data
+        S_325_59 = 325,                          // $@59
+        S_option_data_code = 326,                // option_data_code
+        S_option_data_space = 327,               // option_data_space
+        S_option_data_csv_format = 328,          // option_data_csv_format
+        S_pools_list = 329,                      // pools_list
+        S_330_60 = 330,                          // $@60
+        S_pools_list_content = 331,              // pools_list_content
+        S_not_empty_pools_list = 332,            // not_empty_pools_list
+        S_pool_list_entry = 333,                 // pool_list_entry
+        S_334_61 = 334,                          // $@61
+        S_sub_pool4 = 335,                       // sub_pool4
+        S_336_62 = 336,                          // $@62
+        S_pool_params = 337,                     // pool_params
+        S_pool_param = 338,                      // pool_param
+        S_pool_entry = 339,                      // pool_entry
+        S_340_63 = 340,                          // $@63
+        S_user_context = 341,                    // user_context
+        S_342_64 = 342,                          // $@64
+        S_reservations = 343,                    // reservations
+        S_344_65 = 344,                          // $@65
+        S_reservations_list = 345,               // reservations_list
+        S_not_empty_reservations_list = 346,     // not_empty_reservations_list
+        S_reservation = 347,                     // reservation
+        S_348_66 = 348,                          // $@66
+        S_sub_reservation = 349,                 // sub_reservation
+        S_350_67 = 350,                          // $@67
+        S_reservation_params = 351,              // reservation_params
+        S_not_empty_reservation_params = 352,    // not_empty_reservation_params
+        S_reservation_param = 353,               // reservation_param
+        S_next_server = 354,                     // next_server
+        S_355_68 = 355,                          // $@68
+        S_server_hostname = 356,                 // server_hostname
+        S_357_69 = 357,                          // $@69
+        S_boot_file_name = 358,                  // boot_file_name
+        S_359_70 = 359,                          // $@70
+        S_ip_address = 360,                      // ip_address
+        S_361_71 = 361,                          // $@71
+        S_duid = 362,                            // duid
+        S_363_72 = 363,                          // $@72
+        S_hw_address = 364,                      // hw_address
+        S_365_73 = 365,                          // $@73
+        S_client_id_value = 366,                 // client_id_value
+        S_367_74 = 367,                          // $@74
+        S_circuit_id_value = 368,                // circuit_id_value
+        S_369_75 = 369,                          // $@75
+        S_hostname = 370,                        // hostname
+        S_371_76 = 371,                          // $@76
+        S_reservation_client_classes = 372,      // reservation_client_classes
+        S_373_77 = 373,                          // $@77
+        S_relay = 374,                           // relay
+        S_375_78 = 375,                          // $@78
+        S_relay_map = 376,                       // relay_map
+        S_377_79 = 377,                          // $@79
+        S_client_classes = 378,                  // client_classes
+        S_379_80 = 379,                          // $@80
+        S_client_classes_list = 380,             // client_classes_list
+        S_381_81 = 381,                          // $@81
+        S_client_class_params = 382,             // client_class_params
+        S_not_empty_client_class_params = 383,   // not_empty_client_class_params
+        S_client_class_param = 384,              // client_class_param
+        S_client_class_name = 385,               // client_class_name
+        S_client_class_test = 386,               // client_class_test
+        S_387_82 = 387,                          // $@82
+        S_dhcp4o6_port = 388,                    // dhcp4o6_port
+        S_packet_timeline = 389,                 // packet_timeline
+        S_control_socket = 390,                  // control_socket
+        S_391_83 = 391,                          // $@83
+        S_control_socket_params = 392,           // control_socket_params
+        S_control_socket_param = 393,            // control_socket_param
+        S_control_socket_type = 394,             // control_socket_type
+        S_395_84 = 395,                          // $@84
+        S_control_socket_name = 396,             // control_socket_name
+        S_397_85 = 397,                          // $@85
+        S_dhcp_ddns = 398,                       // dhcp_ddns
+        S_399_86 = 399,                          // $@86
+        S_sub_dhcp_ddns = 400,                   // sub_dhcp_ddns
+        S_401_87 = 401,                          // $@87
+        S_dhcp_ddns_params = 402,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 403,                 // dhcp_ddns_param
+        S_enable_updates = 404,                  // enable_updates
+        S_qualifying_suffix = 405,               // qualifying_suffix
+        S_406_88 = 406,                          // $@88
+        S_server_ip = 407,                       // server_ip
+        S_408_89 = 408,                          // $@89
+        S_server_port = 409,                     // server_port
+        S_sender_ip = 410,                       // sender_ip
+        S_411_90 = 411,                          // $@90
+        S_sender_port = 412,                     // sender_port
+        S_max_queue_size = 413,                  // max_queue_size
+        S_ncr_protocol = 414,                    // ncr_protocol
+        S_415_91 = 415,                          // $@91
+        S_ncr_protocol_value = 416,              // ncr_protocol_value
+        S_ncr_format = 417,                      // ncr_format
+        S_418_92 = 418,                          // $@92
+        S_ncr_format_value = 419,                // ncr_format_value
+        S_always_include_fqdn = 420,             // always_include_fqdn
+        S_allow_client_update = 421,             // allow_client_update
+        S_override_no_update = 422,              // override_no_update
+        S_override_client_update = 423,          // override_client_update
+        S_replace_client_name = 424,             // replace_client_name
+        S_425_93 = 425,                          // $@93
+        S_replace_client_name_value = 426,       // replace_client_name_value
+        S_generated_prefix = 427,                // generated_prefix
+        S_428_94 = 428,                          // $@94
+        S_dhcp6_json_object = 429,               // dhcp6_json_object
+        S_430_95 = 430,                          // $@95
+        S_dhcpddns_json_object = 431,            // dhcpddns_json_object
+        S_432_96 = 432,                          // $@96
+        S_logging_object = 433,                  // logging_object
+        S_434_97 = 434,                          // $@97
+        S_logging_params = 435,                  // logging_params
+        S_logging_param = 436,                   // logging_param
+        S_async_logging = 437,                   // async_logging
+        S_438_98 = 438,                          // $@98
+        S_async_logging_params = 439,            // async_logging_params
+        S_async_logging_param = 440,             // async_logging_param
+        S_queue_size = 441,                      // queue_size
+        S_overflow_policy = 442,                 // overflow_policy
+        S_443_99 = 443,                          // $@99
+        S_loggers = 444,                         // loggers
+        S_445_100 = 445,                         // $@100
+        S_loggers_entries = 446,                 // loggers_entries
+        S_logger_entry = 447,                    // logger_entry
+        S_448_101 = 448,                         // $@101
+        S_logger_params = 449,                   // logger_params
+        S_logger_param = 450,                    // logger_param
+        S_debuglevel = 451,                      // debuglevel
+        S_severity = 452,                        // severity
+        S_453_102 = 453,                         // $@102
+        S_output_options_list = 454,             // output_options_list
+        S_455_103 = 455,                         // $@103
+        S_output_options_list_content = 456,     // output_options_list_content
+        S_output_entry = 457,                    // output_entry
+        S_458_104 = 458,                         // $@104
+        S_output_params = 459,                   // output_params
+        S_output_param = 460,                    // output_param
+        S_461_105 = 461,                         // $@105
+        S_rate_limits_list = 462,                // rate_limits_list
+        S_463_106 = 463,                         // $@106
+        S_rate_limits_list_content = 464,        // rate_limits_list_content
+        S_rate_limit_entries = 465,              // rate_limit_entries
+        S_rate_limit_entry = 466,                // rate_limit_entry
+        S_467_107 = 467,                         // $@107
+        S_rate_limit_params = 468,               // rate_limit_params
+        S_rate_limit_param = 469,                // rate_limit_param
+        S_rate_limit_message = 470,              // rate_limit_message
+        S_471_108 = 471,                         // $@108
+        S_rate_limit_sample = 472,               // rate_limit_sample
+        S_rate_limit_rate = 473,                 // rate_limit_rate
+        S_rate_limit_interval = 474              // rate_limit_interval
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -504,1995 +1155,3140 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
 
-      /// Copy constructor.
-      basic_symbol (const basic_symbol& other);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const location_type& l);
+      default:
+        break;
+    }
 
-  basic_symbol (typename Base::kind_type t, const ElementPtr v, const location_type& l);
+      }
+#endif
 
-  basic_symbol (typename Base::kind_type t, const bool v, const location_type& l);
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const double v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const int64_t v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Constructor for symbols with semantic value.
-      basic_symbol (typename Base::kind_type t,
-                    const semantic_type& v,
-                    const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp4Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
 
     private:
+#if YY_CPLUSPLUS < 201103L
       /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
-    /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
-
-    // Symbol constructors declarations.
-    static inline
-    symbol_type
-    make_END (const location_type& l);
-
-    static inline
-    symbol_type
-    make_COMMA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_COLON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LSQUARE_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RSQUARE_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LCURLY_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RCURLY_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NULL_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACES_CONFIG (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP_SOCKET_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RAW (const location_type& l);
-
-    static inline
-    symbol_type
-    make_UDP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ECHO_CLIENT_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MATCH_CLIENT_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NEXT_SERVER (const location_type& l);
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
 
-    static inline
-    symbol_type
-    make_SERVER_HOSTNAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_BOOT_FILE_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LEASE_DATABASE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOSTS_DATABASE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MEMFILE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MYSQL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_POSTGRESQL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CQL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_USER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PASSWORD (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOST (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PERSIST (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LFC_INTERVAL (const location_type& l);
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
 
-    static inline
-    symbol_type
-    make_READONLY (const location_type& l);
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
 
-    static inline
-    symbol_type
-    make_CONNECT_TIMEOUT (const location_type& l);
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER4_error <= tok && tok <= token::TOKEN_SUB_DHCP_DDNS));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
-    static inline
-    symbol_type
-    make_VALID_LIFETIME (const location_type& l);
+    /// Build a parser object.
+    Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg);
+    virtual ~Dhcp4Parser ();
 
-    static inline
-    symbol_type
-    make_RENEW_TIMER (const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp4Parser (const Dhcp4Parser&) = delete;
+    /// Non copyable.
+    Dhcp4Parser& operator= (const Dhcp4Parser&) = delete;
+#endif
 
-    static inline
-    symbol_type
-    make_REBIND_TIMER (const location_type& l);
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
 
-    static inline
-    symbol_type
-    make_DECLINE_PROBATION_PERIOD (const location_type& l);
+    /// Parse.
+    /// \returns  0 iff parsing succeeded.
+    virtual int parse ();
 
-    static inline
-    symbol_type
-    make_SUBNET4 (const location_type& l);
+#if PARSER4_DEBUG
+    /// The current debugging stream.
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging stream.
+    void set_debug_stream (std::ostream &);
 
-    static inline
-    symbol_type
-    make_SUBNET_4O6_INTERFACE (const location_type& l);
+    /// Type for debugging levels.
+    typedef int debug_level_type;
+    /// The current debugging level.
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging level.
+    void set_debug_level (debug_level_type l);
+#endif
 
-    static inline
-    symbol_type
-    make_SUBNET_4O6_INTERFACE_ID (const location_type& l);
+    /// Report a syntax error.
+    /// \param loc    where the syntax error is found.
+    /// \param msg    a description of the syntax error.
+    virtual void error (const location_type& loc, const std::string& msg);
 
-    static inline
-    symbol_type
-    make_SUBNET_4O6_SUBNET (const location_type& l);
+    /// Report a syntax error.
+    void error (const syntax_error& err);
 
-    static inline
-    symbol_type
-    make_OPTION_DEF (const location_type& l);
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
 
-    static inline
-    symbol_type
-    make_OPTION_DATA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DATA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CODE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SPACE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CSV_FORMAT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RECORD_TYPES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ENCAPSULATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ARRAY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_POOLS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_POOL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_USER_CONTEXT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUBNET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACE_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RAPID_COMMIT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RESERVATION_MODE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOST_RESERVATION_IDENTIFIERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CLIENT_CLASSES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TEST (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CLIENT_CLASS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RESERVATIONS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DUID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HW_ADDRESS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CIRCUIT_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CLIENT_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOSTNAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RELAY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_IP_ADDRESS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOOKS_LIBRARIES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LIBRARY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PARAMETERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_EXPIRED_LEASES_PROCESSING (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RECLAIM_TIMER_WAIT_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOLD_RECLAIMED_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAX_RECLAIM_LEASES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAX_RECLAIM_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_UNWARNED_RECLAIM_CYCLES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP4O6_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CONTROL_SOCKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SOCKET_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SOCKET_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP_DDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ENABLE_UPDATES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_QUALIFYING_SUFFIX (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SERVER_IP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SERVER_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SENDER_IP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SENDER_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAX_QUEUE_SIZE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NCR_PROTOCOL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NCR_FORMAT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALWAYS_INCLUDE_FQDN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALLOW_CLIENT_UPDATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OVERRIDE_NO_UPDATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OVERRIDE_CLIENT_UPDATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_REPLACE_CLIENT_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_GENERATED_PREFIX (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TCP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_JSON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_WHEN_PRESENT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NEVER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALWAYS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_WHEN_NOT_PRESENT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LOGGING (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LOGGERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OUTPUT_OPTIONS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OUTPUT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DEBUGLEVEL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SEVERITY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCPDDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TOPLEVEL_JSON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TOPLEVEL_DHCP4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DHCP4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_INTERFACES4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_SUBNET4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_POOL4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_RESERVATION (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_OPTION_DEF (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_OPTION_DATA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_HOOKS_LIBRARY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DHCP_DDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_STRING (const std::string& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTEGER (const int64_t& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_FLOAT (const double& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_BOOLEAN (const bool& v, const location_type& l);
-
-
-    /// Build a parser object.
-    Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg);
-    virtual ~Dhcp4Parser ();
-
-    /// Parse.
-    /// \returns  0 iff parsing succeeded.
-    virtual int parse ();
-
-#if PARSER4_DEBUG
-    /// The current debugging stream.
-    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
-    /// Set the current debugging stream.
-    void set_debug_stream (std::ostream &);
-
-    /// Type for debugging levels.
-    typedef int debug_level_type;
-    /// The current debugging level.
-    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
-    /// Set the current debugging level.
-    void set_debug_level (debug_level_type l);
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
 #endif
-
-    /// Report a syntax error.
-    /// \param loc    where the syntax error is found.
-    /// \param msg    a description of the syntax error.
-    virtual void error (const location_type& loc, const std::string& msg);
-
-    /// Report a syntax error.
-    void error (const syntax_error& err);
-
-  private:
-    /// This class is not copyable.
-    Dhcp4Parser (const Dhcp4Parser&);
-    Dhcp4Parser& operator= (const Dhcp4Parser&);
-
-    /// State numbers.
-    typedef int state_type;
-
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
-
-    /// Compute post-reduction state.
-    /// \param yystate   the current state
-    /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
-
-    /// Whether the given \c yypact_ value indicates a defaulted state.
-    /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
-
-    /// Whether the given \c yytable_ value indicates a syntax error.
-    /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
-
-    static const short int yypact_ninf_;
-    static const signed char yytable_ninf_;
-
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
-
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short int yypact_[];
-
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short int yydefact_[];
-
-  // YYPGOTO[NTERM-NUM].
-  static const short int yypgoto_[];
-
-  // YYDEFGOTO[NTERM-NUM].
-  static const short int yydefgoto_[];
-
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short int yytable_[];
-
-  static const short int yycheck_[];
-
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short int yystos_[];
-
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short int yyr1_[];
-
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
-
-
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
-
-
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
-#if PARSER4_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short int yyrline_[];
-    /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
-    /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
-
-    // Debugging.
-    int yydebug_;
-    std::ostream* yycdebug_;
-
-    /// \brief Display a symbol type, value and location.
-    /// \param yyo    The output stream.
-    /// \param yysym  The symbol.
-    template <typename Base>
-    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RAW (location_type l)
+      {
+        return symbol_type (token::TOKEN_RAW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RAW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RAW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UDP (location_type l)
+      {
+        return symbol_type (token::TOKEN_UDP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UDP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UDP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ECHO_CLIENT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ECHO_CLIENT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ECHO_CLIENT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ECHO_CLIENT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MATCH_CLIENT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_MATCH_CLIENT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MATCH_CLIENT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MATCH_CLIENT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEXT_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEXT_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEXT_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEXT_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOT_FILE_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOT_FILE_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOT_FILE_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOT_FILE_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTS_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTS_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MEMFILE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MEMFILE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MYSQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MYSQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POSTGRESQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POSTGRESQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PASSWORD (location_type l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PASSWORD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PERSIST (location_type l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PERSIST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAPPED_STORE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAPPED_STORE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAPPED_STORE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAPPED_STORE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FILE_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_FILE_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FILE_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FILE_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_MODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_MODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_MODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_MODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_READONLY (location_type l)
+      {
+        return symbol_type (token::TOKEN_READONLY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_READONLY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_READONLY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VALID_LIFETIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VALID_LIFETIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RENEW_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RENEW_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REBIND_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REBIND_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (location_type l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET_4O6_SUBNET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_SUBNET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET_4O6_SUBNET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_SUBNET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SPACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SPACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SPACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SPACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CSV_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CSV_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECORD_TYPES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECORD_TYPES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENCAPSULATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENCAPSULATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ARRAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ARRAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOLS (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOLS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOLS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOLS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER_CONTEXT (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER_CONTEXT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RAPID_COMMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RAPID_COMMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RAPID_COMMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RAPID_COMMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATION_MODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATION_MODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TEST (location_type l)
+      {
+        return symbol_type (token::TOKEN_TEST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TEST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TEST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DUID (location_type l)
+      {
+        return symbol_type (token::TOKEN_DUID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DUID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DUID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HW_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HW_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CIRCUIT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_CIRCUIT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CIRCUIT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CIRCUIT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RELAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_RELAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RELAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RELAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARAMETERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARAMETERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (location_type l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4O6_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4O6_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PACKET_TIMELINE (location_type l)
+      {
+        return symbol_type (token::TOKEN_PACKET_TIMELINE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PACKET_TIMELINE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PACKET_TIMELINE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_SOCKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_SOCKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENABLE_UPDATES (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENABLE_UPDATES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS_INCLUDE_FQDN (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_INCLUDE_FQDN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS_INCLUDE_FQDN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_INCLUDE_FQDN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALLOW_CLIENT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALLOW_CLIENT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALLOW_CLIENT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALLOW_CLIENT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GENERATED_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GENERATED_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MESSAGE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MESSAGE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MESSAGE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MESSAGE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SAMPLE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SAMPLE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SAMPLE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SAMPLE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_INTERFACES4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_INTERFACES4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_SUBNET4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_SUBNET4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_POOL4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_POOL4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_RESERVATION (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_RESERVATION (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
 #endif
 
-    /// \brief Reclaim the memory associated to a symbol.
-    /// \param yymsg     Why this token is reclaimed.
-    ///                  If null, print nothing.
-    /// \param yysym     The symbol.
-    template <typename Base>
-    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
-
-  private:
-    /// Type access provider for state based symbols.
-    struct by_state
-    {
-      /// Default constructor.
-      by_state ();
-
-      /// The symbol type as needed by the constructor.
-      typedef state_type kind_type;
-
-      /// Constructor.
-      by_state (kind_type s);
-
-      /// Copy constructor.
-      by_state (const by_state& other);
-
-      /// Record that this symbol is empty.
-      void clear ();
-
-      /// Steal the symbol type from \a that.
-      void move (by_state& that);
-
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
-
-      /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
-
-      /// The state.
-      /// \a empty when empty.
-      state_type state;
-    };
-
-    /// "Internal" symbol: element of the stack.
-    struct stack_symbol_type : basic_symbol<by_state>
-    {
-      /// Superclass.
-      typedef basic_symbol<by_state> super_type;
-      /// Construct an empty symbol.
-      stack_symbol_type ();
-      /// Steal the contents from \a sym to build this.
-      stack_symbol_type (state_type s, symbol_type& sym);
-      /// Assignment, needed by push_back.
-      stack_symbol_type& operator= (const stack_symbol_type& that);
-    };
-
-    /// Stack type.
-    typedef stack<stack_symbol_type> stack_type;
-
-    /// The stack.
-    stack_type yystack_;
-
-    /// Push a new state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the symbol
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, stack_symbol_type& s);
-
-    /// Push a new look ahead token on the state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the state
-    /// \param sym  the symbol (for its value and location).
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, state_type s, symbol_type& sym);
-
-    /// Pop \a n symbols the three stacks.
-    void yypop_ (unsigned int n = 1);
-
-    /// Constants.
-    enum
-    {
-      yyeof_ = 0,
-      yylast_ = 719,     ///< Last index in yytable_.
-      yynnts_ = 302,  ///< Number of nonterminal symbols.
-      yyfinal_ = 24, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 133  ///< Number of tokens.
-    };
-
-
-    // User arguments.
-    isc::dhcp::Parser4Context& ctx;
-  };
-
-  // Symbol number corresponding to token number t.
-  inline
-  Dhcp4Parser::token_number_type
-  Dhcp4Parser::yytranslate_ (token_type t)
-  {
-    static
-    const token_number_type
-    translate_table[] =
-    {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132
-    };
-    const unsigned int user_token_number_max_ = 387;
-    const token_number_type undef_token_ = 2;
-
-    if (static_cast<int>(t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned int> (t) <= user_token_number_max_)
-      return translate_table[t];
-    else
-      return undef_token_;
-  }
-
-  inline
-  Dhcp4Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
-  // basic_symbol.
-  template <typename Base>
-  inline
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-  {}
-
-  template <typename Base>
-  inline
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& other)
-    : Base (other)
-    , value ()
-    , location (other.location)
-  {
-      switch (other.type_get ())
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
-        value.copy< ElementPtr > (other.value);
-        break;
-
-      case 132: // "boolean"
-        value.copy< bool > (other.value);
-        break;
-
-      case 131: // "floating point"
-        value.copy< double > (other.value);
-        break;
-
-      case 130: // "integer"
-        value.copy< int64_t > (other.value);
-        break;
-
-      case 129: // "constant string"
-        value.copy< std::string > (other.value);
-        break;
-
-      default:
-        break;
-    }
-
-  }
-
-
-  template <typename Base>
-  inline
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const semantic_type& v, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {
-    (void) v;
-      switch (this->type_get ())
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
-        value.copy< ElementPtr > (v);
-        break;
-
-      case 132: // "boolean"
-        value.copy< bool > (v);
-        break;
-
-      case 131: // "floating point"
-        value.copy< double > (v);
-        break;
-
-      case 130: // "integer"
-        value.copy< int64_t > (v);
-        break;
-
-      case 129: // "constant string"
-        value.copy< std::string > (v);
-        break;
-
-      default:
-        break;
-    }
-}
-
-
-  // Implementation of basic_symbol constructor for each type.
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ElementPtr v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const bool v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const double v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const int64_t v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-
-  template <typename Base>
-  inline
-  Dhcp4Parser::basic_symbol<Base>::~basic_symbol ()
-  {
-    clear ();
-  }
-
-  template <typename Base>
-  inline
-  void
-  Dhcp4Parser::basic_symbol<Base>::clear ()
-  {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-    switch (yytype)
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
-        value.template destroy< ElementPtr > ();
-        break;
-
-      case 132: // "boolean"
-        value.template destroy< bool > ();
-        break;
-
-      case 131: // "floating point"
-        value.template destroy< double > ();
-        break;
-
-      case 130: // "integer"
-        value.template destroy< int64_t > ();
-        break;
-
-      case 129: // "constant string"
-        value.template destroy< std::string > ();
-        break;
-
-      default:
-        break;
-    }
-
-    Base::clear ();
-  }
-
-  template <typename Base>
-  inline
-  bool
-  Dhcp4Parser::basic_symbol<Base>::empty () const
-  {
-    return Base::type_get () == empty_symbol;
-  }
-
-  template <typename Base>
-  inline
-  void
-  Dhcp4Parser::basic_symbol<Base>::move (basic_symbol& s)
-  {
-    super_type::move(s);
-      switch (this->type_get ())
-    {
-      case 146: // value
-      case 150: // map_value
-      case 188: // socket_type
-      case 197: // db_type
-      case 397: // ncr_protocol_value
-      case 406: // replace_client_name_value
-        value.move< ElementPtr > (s.value);
-        break;
-
-      case 132: // "boolean"
-        value.move< bool > (s.value);
-        break;
-
-      case 131: // "floating point"
-        value.move< double > (s.value);
-        break;
-
-      case 130: // "integer"
-        value.move< int64_t > (s.value);
-        break;
-
-      case 129: // "constant string"
-        value.move< std::string > (s.value);
-        break;
-
-      default:
-        break;
-    }
-
-    location = s.location;
-  }
-
-  // by_type.
-  inline
-  Dhcp4Parser::by_type::by_type ()
-    : type (empty_symbol)
-  {}
-
-  inline
-  Dhcp4Parser::by_type::by_type (const by_type& other)
-    : type (other.type)
-  {}
-
-  inline
-  Dhcp4Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
-  {}
-
-  inline
-  void
-  Dhcp4Parser::by_type::clear ()
-  {
-    type = empty_symbol;
-  }
-
-  inline
-  void
-  Dhcp4Parser::by_type::move (by_type& that)
-  {
-    type = that.type;
-    that.clear ();
-  }
-
-  inline
-  int
-  Dhcp4Parser::by_type::type_get () const
-  {
-    return type;
-  }
 
-  inline
-  Dhcp4Parser::token_type
-  Dhcp4Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short int
-    yytoken_number_[] =
+    class context
     {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-  // Implementation of make_symbol for each symbol type.
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_END (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_END, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_COMMA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COMMA, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_COLON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COLON, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NULL_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP4, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACES_CONFIG (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES_CONFIG, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP_SOCKET_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP_SOCKET_TYPE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RAW (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RAW, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_UDP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_UDP, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ECHO_CLIENT_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ECHO_CLIENT_ID, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MATCH_CLIENT_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MATCH_CLIENT_ID, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NEXT_SERVER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NEXT_SERVER, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_HOSTNAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SERVER_HOSTNAME, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_BOOT_FILE_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_BOOT_FILE_NAME, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LEASE_DATABASE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LEASE_DATABASE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTS_DATABASE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOSTS_DATABASE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TYPE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MEMFILE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MEMFILE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MYSQL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MYSQL, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_POSTGRESQL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_POSTGRESQL, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CQL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CQL, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_USER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_USER, l);
-  }
+    public:
+      context (const Dhcp4Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PASSWORD (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PASSWORD, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOST (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOST, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PERSIST (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PERSIST, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LFC_INTERVAL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LFC_INTERVAL, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_READONLY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_READONLY, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONNECT_TIMEOUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_VALID_LIFETIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_VALID_LIFETIME, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RENEW_TIMER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RENEW_TIMER, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_REBIND_TIMER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_REBIND_TIMER, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DECLINE_PROBATION_PERIOD (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET4, l);
-  }
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET_4O6_INTERFACE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET_4O6_INTERFACE_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE_ID, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET_4O6_SUBNET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET_4O6_SUBNET, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OPTION_DEF (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DEF, l);
-  }
-
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OPTION_DATA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DATA, l);
-  }
+    private:
+      const Dhcp4Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NAME, l);
-  }
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    Dhcp4Parser (const Dhcp4Parser&);
+    /// Non copyable.
+    Dhcp4Parser& operator= (const Dhcp4Parser&);
+#endif
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DATA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DATA, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CODE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CODE, l);
-  }
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SPACE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SPACE, l);
-  }
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CSV_FORMAT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CSV_FORMAT, l);
-  }
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RECORD_TYPES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RECORD_TYPES, l);
-  }
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ENCAPSULATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ENCAPSULATE, l);
-  }
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ARRAY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ARRAY, l);
-  }
+    static const short yypact_ninf_;
+    static const signed char yytable_ninf_;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_POOLS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_POOLS, l);
-  }
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_POOL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_POOL, l);
-  }
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_USER_CONTEXT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, l);
-  }
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE, l);
-  }
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACE_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE_ID, l);
-  }
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ID, l);
-  }
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RAPID_COMMIT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RAPID_COMMIT, l);
-  }
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RESERVATION_MODE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RESERVATION_MODE, l);
-  }
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOST_RESERVATION_IDENTIFIERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, l);
-  }
+    static const short yycheck_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CLIENT_CLASSES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASSES, l);
-  }
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TEST (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TEST, l);
-  }
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CLIENT_CLASS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASS, l);
-  }
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RESERVATIONS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RESERVATIONS, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DUID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DUID, l);
-  }
+#if PARSER4_DEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HW_ADDRESS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HW_ADDRESS, l);
-  }
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CIRCUIT_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CIRCUIT_ID, l);
-  }
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CLIENT_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_ID, l);
-  }
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTNAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, l);
-  }
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RELAY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RELAY, l);
-  }
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_IP_ADDRESS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, l);
-  }
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOOKS_LIBRARIES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
-  }
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LIBRARY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LIBRARY, l);
-  }
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PARAMETERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PARAMETERS, l);
-  }
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_EXPIRED_LEASES_PROCESSING (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, l);
-  }
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RECLAIM_TIMER_WAIT_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, l);
-  }
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, l);
-  }
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOLD_RECLAIMED_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
-  }
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_RECLAIM_LEASES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, l);
-  }
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_RECLAIM_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, l);
-  }
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_UNWARNED_RECLAIM_CYCLES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
-  }
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP4O6_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
-  }
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONTROL_SOCKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
-  }
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SOCKET_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, l);
-  }
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SOCKET_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, l);
-  }
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP_DDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP_DDNS, l);
-  }
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ENABLE_UPDATES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ENABLE_UPDATES, l);
-  }
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_QUALIFYING_SUFFIX (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_IP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SERVER_IP, l);
-  }
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SERVER_PORT, l);
-  }
+    /// The stack.
+    stack_type yystack_;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SENDER_IP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SENDER_IP, l);
-  }
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SENDER_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SENDER_PORT, l);
-  }
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_QUEUE_SIZE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, l);
-  }
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NCR_PROTOCOL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
-  }
+    /// Constants.
+    enum
+    {
+      yylast_ = 761,     ///< Last index in yytable_.
+      yynnts_ = 329,  ///< Number of nonterminal symbols.
+      yyfinal_ = 24 ///< Termination state number.
+    };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NCR_FORMAT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ALWAYS_INCLUDE_FQDN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS_INCLUDE_FQDN, l);
-  }
+    // User arguments.
+    isc::dhcp::Parser4Context& ctx;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ALLOW_CLIENT_UPDATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALLOW_CLIENT_UPDATE, l);
-  }
+  };
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OVERRIDE_NO_UPDATE (const location_type& l)
+  inline
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, l);
-  }
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const unsigned char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145
+    };
+    // Last valid token kind.
+    const int code_max = 400;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OVERRIDE_CLIENT_UPDATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, l);
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_REPLACE_CLIENT_NAME (const location_type& l)
+  // basic_symbol.
+  template <typename Base>
+  Dhcp4Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
   {
-    return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, l);
-  }
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_GENERATED_PREFIX (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_GENERATED_PREFIX, l);
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TCP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TCP, l);
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_JSON, l);
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_WHEN_PRESENT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_WHEN_PRESENT, l);
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NEVER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NEVER, l);
-  }
+      default:
+        break;
+    }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ALWAYS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS, l);
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_WHEN_NOT_PRESENT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LOGGING (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LOGGERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OUTPUT_OPTIONS (const location_type& l)
+  template <typename Base>
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+    return this->kind ();
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OUTPUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DEBUGLEVEL (const location_type& l)
+  template <typename Base>
+  bool
+  Dhcp4Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SEVERITY (const location_type& l)
+  template <typename Base>
+  void
+  Dhcp4Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
-    return symbol_type (token::TOKEN_SEVERITY, l);
-  }
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (s.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, l);
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (s.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCPDDNS, l);
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (s.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TOPLEVEL_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (s.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TOPLEVEL_DHCP4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCP4, l);
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (s.value));
+        break;
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_DHCP4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCP4, l);
-  }
+      default:
+        break;
+    }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_INTERFACES4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_INTERFACES4, l);
+    location = YY_MOVE (s.location);
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_SUBNET4 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_SUBNET4, l);
-  }
+  // by_kind.
+  inline
+  Dhcp4Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_POOL4 (const location_type& l)
+#if 201103L <= YY_CPLUSPLUS
+  inline
+  Dhcp4Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
-    return symbol_type (token::TOKEN_SUB_POOL4, l);
+    that.clear ();
   }
+#endif
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_RESERVATION (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_RESERVATION, l);
-  }
+  inline
+  Dhcp4Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_OPTION_DEF (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DEF, l);
-  }
+  inline
+  Dhcp4Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_OPTION_DATA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DATA, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_HOOKS_LIBRARY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_DHCP_DDNS (const location_type& l)
+  inline
+  void
+  Dhcp4Parser::by_kind::clear () YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_SUB_DHCP_DDNS, l);
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_STRING (const std::string& v, const location_type& l)
+  inline
+  void
+  Dhcp4Parser::by_kind::move (by_kind& that)
   {
-    return symbol_type (token::TOKEN_STRING, v, l);
+    kind_ = that.kind_;
+    that.clear ();
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTEGER (const int64_t& v, const location_type& l)
+  inline
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_INTEGER, v, l);
+    return kind_;
   }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_FLOAT (const double& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, v, l);
-  }
 
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_BOOLEAN (const bool& v, const location_type& l)
+  inline
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_BOOLEAN, v, l);
+    return this->kind ();
   }
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:377
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 2496 "dhcp4_parser.h" // lalr1.cc:377
+#line 4292 "dhcp4_parser.h"
 
 
 
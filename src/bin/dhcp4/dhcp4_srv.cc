@@ -30,6 +30,7 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
+#include <dhcpsrv/pkt_timeline_stats.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <dhcpsrv/utils.h>
@@ -84,7 +85,13 @@ struct Dhcp4Hooks {
     int hook_index_buffer4_send_;   ///< index for "buffer4_send" hook point
     int hook_index_lease4_decline_; ///< index for "lease4_decline" hook point
 
-    /// Constructor that registers hook points for DHCPv4 engine
+    int arg_index_query4_;          ///< index for "query4" argument
+    int arg_index_response4_;       ///< index for "response4" argument
+    int arg_index_subnet4_;         ///< index for "subnet4" argument
+    int arg_index_subnet4collection_; ///< index for "subnet4collection" argument
+    int arg_index_lease4_;          ///< index for "lease4" argument
+
+    /// Constructor that registers hook points and arguments for DHCPv4 engine
     Dhcp4Hooks() {
         hook_index_buffer4_receive_= HooksManager::registerHook("buffer4_receive");
         hook_index_pkt4_receive_   = HooksManager::registerHook("pkt4_receive");
@@ -93,6 +100,13 @@ struct Dhcp4Hooks {
         hook_index_lease4_release_ = HooksManager::registerHook("lease4_release");
         hook_index_buffer4_send_   = HooksManager::registerHook("buffer4_send");
         hook_index_lease4_decline_ = HooksManager::registerHook("lease4_decline");
+
+        arg_index_query4_    = HooksManager::registerArgument("query4");
+        arg_index_response4_ = HooksManager::registerArgument("response4");
+        arg_index_subnet4_   = HooksManager::registerArgument("subnet4");
+        arg_index_subnet4collection_ =
+            HooksManager::registerArgument("subnet4collection");
+        arg_index_lease4_    = HooksManager::registerArgument("lease4");
     }
 };
 
@@ -154,6 +168,7 @@ Dhcpv4Exchange::Dhcpv4Exchange(const AllocEnginePtr& alloc_engine,
 
             // Check for static reservations.
             alloc_engine->findReservation(*context_);
+            query_->markEvent(Pkt::EVENT_HOST_LOOKUP);
 
             // Assign classes.
             setReservedClientClasses();
@@ -381,7 +396,7 @@ const std::string Dhcpv4Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
                      const bool direct_response_desired)
     : shutdown_(true), alloc_engine_(), port_(port),
-      use_bcast_(use_bcast) {
+      use_bcast_(use_bcast), timeline_stats_() {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET).arg(port);
     try {
@@ -514,9 +529,9 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query) const {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
-        callout_handle->setArgument("subnet4", subnet);
-        callout_handle->setArgument("subnet4collection",
+        callout_handle->setArgument(Hooks.arg_index_query4_, query);
+        callout_handle->setArgument(Hooks.arg_index_subnet4_, subnet);
+        callout_handle->setArgument(Hooks.arg_index_subnet4collection_,
                                     cfgmgr.getCurrentCfg()->
                                     getCfgSubnets4()->getAll());
 
@@ -537,9 +552,11 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query) const {
         /// @todo: Add support for DROP status
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet4", subnet);
+        callout_handle->getArgument(Hooks.arg_index_subnet4_, subnet);
     }
 
+    query->markEvent(Pkt::EVENT_SUBNET_SELECTED);
+
     if (subnet) {
         // Log at higher debug level that subnet has been found.
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC_DATA, DHCP4_SUBNET_SELECTED)
@@ -618,9 +635,9 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query) const {
         callout_handle->deleteAllArguments();
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
-        callout_handle->setArgument("subnet4", subnet);
-        callout_handle->setArgument("subnet4collection",
+        callout_handle->setArgument(Hooks.arg_index_query4_, query);
+        callout_handle->setArgument(Hooks.arg_index_subnet4_, subnet);
+        callout_handle->setArgument(Hooks.arg_index_subnet4collection_,
                                     cfgmgr.getCurrentCfg()->
                                     getCfgSubnets4()->getAll());
 
@@ -641,9 +658,11 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query) const {
         /// @todo: Add support for DROP status
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet4", subnet);
+        callout_handle->getArgument(Hooks.arg_index_subnet4_, subnet);
     }
 
+    query->markEvent(Pkt::EVENT_SUBNET_SELECTED);
+
     if (subnet) {
         // Log at higher debug level that subnet has been found.
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC_DATA, DHCP4_SUBNET_SELECTED)
@@ -767,6 +786,8 @@ Dhcpv4Srv::run_one() {
     processPacket(query, rsp);
 
     if (!rsp) {
+        // Nothing to send, so the processing of this packet is complete.
+        processStatsTimeline(query);
         return;
     }
 
@@ -785,7 +806,7 @@ Dhcpv4Srv::run_one() {
             ScopedEnableOptionsCopy<Pkt4> resp4_options_copy(rsp);
 
             // Pass incoming packet as argument
-            callout_handle->setArgument("response4", rsp);
+            callout_handle->setArgument(Hooks.arg_index_response4_, rsp);
 
             // Call callouts
             HooksManager::callCallouts(Hooks.hook_index_buffer4_send_,
@@ -803,7 +824,7 @@ Dhcpv4Srv::run_one() {
 
             /// @todo: Add support for DROP status.
 
-            callout_handle->getArgument("response4", rsp);
+            callout_handle->getArgument(Hooks.arg_index_response4_, rsp);
         }
 
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_SEND)
@@ -823,9 +844,11 @@ Dhcpv4Srv::run_one() {
             .arg(static_cast<int>(rsp->getType()))
             .arg(rsp->toText());
         sendPacket(rsp);
+        query->markEvent(Pkt::EVENT_SENT);
 
         // Update statistics accordingly for sent packet.
         processStatsSent(rsp);
+        processStatsTimeline(query);
 
     } catch (const std::exception& e) {
         LOG_ERROR(packet4_logger, DHCP4_PACKET_SEND_FAIL)
@@ -857,7 +880,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.arg_index_query4_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_buffer4_receive_,
@@ -876,7 +899,12 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             skip_unpack = true;
         }
 
-        callout_handle->getArgument("query4", query);
+        // A callout may have replaced the packet: keep its timeline.
+        Pkt4Ptr original = query;
+        callout_handle->getArgument(Hooks.arg_index_query4_, query);
+        if (query != original) {
+            query->copyTimeline(*original);
+        }
 
         /// @todo: add support for DROP status
     }
@@ -907,6 +935,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             return;
         }
     }
+    query->markEvent(Pkt::EVENT_PARSED);
 
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
@@ -915,6 +944,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // this before calling accept(), because getSubnet4() may need client
     // class information.
     classifyPacket(query);
+    query->markEvent(Pkt::EVENT_CLASSIFIED);
 
     // Check whether the message should be further processed or discarded.
     // There is no need to log anything here. This function logs by itself.
@@ -950,7 +980,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.arg_index_query4_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_receive_,
@@ -968,7 +998,13 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
 
         /// @todo: Add support for DROP status
 
-        callout_handle->getArgument("query4", query);
+        // A callout may have replaced the packet: keep its timeline.
+        Pkt4Ptr original = query;
+        callout_handle->getArgument(Hooks.arg_index_query4_, query);
+        if (query != original) {
+            query->copyTimeline(*original);
+        }
+        query->markEvent(Pkt::EVENT_RECEIVE_HOOKS);
     }
 
     try {
@@ -1043,10 +1079,10 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt4> query_resp_options_copy(query, rsp);
 
         // Set our response
-        callout_handle->setArgument("response4", rsp);
+        callout_handle->setArgument(Hooks.arg_index_response4_, rsp);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.arg_index_query4_, query);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_send_,
@@ -1063,6 +1099,8 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         }
 
         /// @todo: Add support for DROP status
+
+        query->markEvent(Pkt::EVENT_SEND_HOOKS);
     }
 
     if (!skip_pack) {
@@ -1070,6 +1108,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             LOG_DEBUG(options4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_PACK)
                 .arg(rsp->getLabel());
             rsp->pack();
+            query->markEvent(Pkt::EVENT_PACKED);
         } catch (const std::exception& e) {
             LOG_ERROR(options4_logger, DHCP4_PACKET_PACK_FAIL)
                 .arg(rsp->getLabel())
@@ -1735,6 +1774,7 @@ Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
     ctx->callout_handle_ = callout_handle;
 
     Lease4Ptr lease = alloc_engine_->allocateLease4(*ctx);
+    query->markEvent(Pkt::EVENT_LEASE_ALLOCATED);
 
     if (lease) {
         // We have a lease! Let's set it in the packet and send it back to
@@ -2249,10 +2289,10 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release) {
             ScopedEnableOptionsCopy<Pkt4> query4_options_copy(release);
 
             // Pass the original packet
-            callout_handle->setArgument("query4", release);
+            callout_handle->setArgument(Hooks.arg_index_query4_, release);
 
             // Pass the lease to be updated
-            callout_handle->setArgument("lease4", lease);
+            callout_handle->setArgument(Hooks.arg_index_lease4_, lease);
 
             // Call all installed callouts
             HooksManager::callCallouts(Hooks.hook_index_lease4_release_,
@@ -2395,8 +2435,8 @@ Dhcpv4Srv::declineLease(const Lease4Ptr& lease, const Pkt4Ptr& decline) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(decline);
 
         // Pass incoming Decline and the lease to be declined.
-        callout_handle->setArgument("lease4", lease);
-        callout_handle->setArgument("query4", decline);
+        callout_handle->setArgument(Hooks.arg_index_lease4_, lease);
+        callout_handle->setArgument(Hooks.arg_index_query4_, decline);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_lease4_decline_,
@@ -2876,6 +2916,20 @@ void Dhcpv4Srv::processStatsSent(const Pkt4Ptr& response) {
                                               static_cast<int64_t>(1));
 }
 
+void Dhcpv4Srv::processStatsTimeline(const Pkt4Ptr& query) {
+    if (timeline_stats_) {
+        timeline_stats_->record(*query);
+    }
+}
+
+void Dhcpv4Srv::configureTimelineStats(const bool enabled) {
+    if (enabled) {
+        timeline_stats_.reset(new PktTimelineStats("pkt4"));
+    } else {
+        timeline_stats_.reset();
+    }
+}
+
 int Dhcpv4Srv::getHookIndexBuffer4Receive() {
     return (Hooks.hook_index_buffer4_receive_);
 }
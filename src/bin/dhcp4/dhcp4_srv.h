@@ -18,6 +18,7 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/pkt_timeline_stats.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
 
@@ -819,6 +820,9 @@ private:
     uint16_t port_;  ///< UDP port number on which server listens.
     bool use_bcast_; ///< Should broadcast be enabled on sockets (if true).
 
+    /// @brief Latency histograms or null if they are not recorded.
+    PktTimelineStatsPtr timeline_stats_;
+
 public:
     /// Class methods for DHCPv4-over-DHCPv6 handler
 
@@ -830,6 +834,22 @@ public:
     /// @param response packet transmitted
     static void processStatsSent(const Pkt4Ptr& response);
 
+    /// @brief Records processing stage latencies of the packet
+    ///
+    /// Adds the durations of the processing stages recorded on the
+    /// packet timeline to the pkt4-latency-* histograms.
+    ///
+    /// @param query packet which processing has finished
+    void processStatsTimeline(const Pkt4Ptr& query);
+
+    /// @brief Enables or disables the recording of the latencies
+    ///
+    /// The histograms are looked up when the recording is enabled, so
+    /// the processed packets don't look them up by name.
+    ///
+    /// @param enabled true if the latencies should be recorded
+    void configureTimelineStats(const bool enabled);
+
     /// @brief Returns the index for "buffer4_receive" hook point
     /// @return the index for "buffer4_receive" hook point
     static int getHookIndexBuffer4Receive();
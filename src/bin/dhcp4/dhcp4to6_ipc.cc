@@ -64,6 +64,7 @@ void Dhcp4to6Ipc::handler() {
 
         // from Dhcpv4Srv::run_one() after receivePacket()
         if (pkt) {
+            pkt->markEvent(Pkt::EVENT_RECEIVED);
             LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP6_DHCP4O6_PACKET_RECEIVED)
                 .arg(static_cast<int>(pkt->getType()))
                 .arg(pkt->getRemoteAddr().toText())
@@ -100,13 +101,17 @@ void Dhcp4to6Ipc::handler() {
 
     // Extract the DHCPv4 packet with DHCPv6 packet attached
     Pkt4Ptr query(new Pkt4o6(msg->getData(), pkt));
+    query->copyTimeline(*pkt);
 
     // From Dhcpv4Srv::run_one() processing and after
     Pkt4Ptr rsp;
 
-    ControlledDhcpv4Srv::getInstance()->processPacket(query, rsp);
+    ControlledDhcpv4Srv* srv = ControlledDhcpv4Srv::getInstance();
+    srv->processPacket(query, rsp);
 
     if (!rsp) {
+        // Nothing to send, so the processing of this packet is complete.
+        srv->processStatsTimeline(query);
         return;
     }
 
@@ -170,9 +175,11 @@ void Dhcp4to6Ipc::handler() {
             .arg(rsp6->toText());
 
         ipc.send(rsp6->getPkt6());
+        query->markEvent(Pkt::EVENT_SENT);
 
         // Update statistics accordingly for sent packet.
         Dhcpv4Srv::processStatsSent(rsp);
+        srv->processStatsTimeline(query);
 
     } catch (const std::exception& e) {
         LOG_ERROR(packet4_logger, DHCP4_DHCP4O6_PACKET_SEND_FAIL)
@@ -8,11 +8,13 @@
 
 #include <cc/command_interpreter.h>
 #include <dhcp4/dhcp4_log.h>
+#include <dhcp4/dhcp4_srv.h>
 #include <dhcp4/simple_parser4.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option_definition.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/incremental_config_cache.h>
 #include <dhcpsrv/parsers/client_class_def_parser.h>
 #include <dhcp4/json_config_parser.h>
 #include <dhcpsrv/parsers/dbaccess_parser.h>
@@ -21,6 +23,7 @@
 #include <dhcpsrv/parsers/host_reservation_parser.h>
 #include <dhcpsrv/parsers/host_reservations_list_parser.h>
 #include <dhcpsrv/parsers/ifaces_config_parser.h>
+#include <dhcpsrv/parsers/parallel_subnets_parser.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <config/command_mgr.h>
 #include <util/encode/hex.h>
@@ -116,8 +119,13 @@ public:
     /// Configuration Manager.
     ///
     /// @param subnet A new subnet being configured.
+    /// @param [out] hosts Optional collection receiving the host
+    /// reservations of the subnet.
+    /// @param add_hosts Indicates whether the host reservations are added
+    /// to the staging configuration.
     /// @return a pointer to created Subnet4 object
-    Subnet4Ptr parse(ConstElementPtr subnet) {
+    Subnet4Ptr parse(ConstElementPtr subnet, HostCollection* hosts = 0,
+                     const bool add_hosts = true) {
         /// Parse Pools first.
         ConstElementPtr pools = subnet->get("pools");
         if (pools) {
@@ -149,7 +157,7 @@ public:
         ConstElementPtr reservations = subnet->get("reservations");
         if (reservations) {
             HostReservationsListParser<HostReservationParser4> parser;
-            parser.parse(subnet_->getID(), reservations);
+            parser.parse(subnet_->getID(), reservations, hosts, add_hosts);
         }
 
         return (sn4ptr);
@@ -180,19 +188,6 @@ protected:
         // SimpleParser4::setAllDefaults.
         SubnetID subnet_id = static_cast<SubnetID>(getInteger(params, "id"));
 
-        stringstream s;
-        s << addr << "/" << static_cast<int>(len) << " with params: ";
-        // t1 and t2 are optional may be not specified.
-        if (!t1.unspecified()) {
-            s << "t1=" << t1 << ", ";
-        }
-        if (!t2.unspecified()) {
-            s << "t2=" << t2 << ", ";
-        }
-        s <<"valid-lifetime=" << valid;
-
-        LOG_INFO(dhcp4_logger, DHCP4_CONFIG_NEW_SUBNET).arg(s.str());
-
         Subnet4Ptr subnet4(new Subnet4(addr, len, t1, t2, valid, subnet_id));
         subnet_ = subnet4;
 
@@ -267,6 +262,43 @@ protected:
     }
 };
 
+/// @brief Logs a new IPv4 subnet.
+///
+/// The subnets parsed ahead are logged when they are added to the
+/// configuration, in the main thread.
+///
+/// @param subnet the new subnet.
+void
+logNewSubnet4(const Subnet4Ptr& subnet) {
+    const std::pair<IOAddress, uint8_t> prefix = subnet->get();
+    stringstream s;
+    s << prefix.first << "/" << static_cast<int>(prefix.second)
+      << " with params: ";
+    // t1 and t2 are optional may be not specified.
+    if (!subnet->getT1().unspecified()) {
+        s << "t1=" << subnet->getT1() << ", ";
+    }
+    if (!subnet->getT2().unspecified()) {
+        s << "t2=" << subnet->getT2() << ", ";
+    }
+    s <<"valid-lifetime=" << subnet->getValid();
+
+    LOG_INFO(dhcp4_logger, DHCP4_CONFIG_NEW_SUBNET).arg(s.str());
+}
+
+/// @brief Parses an IPv4 subnet ahead of the configuration.
+///
+/// This function is called by the @c ParallelSubnetsParser threads.
+///
+/// @param subnet the subnet configuration.
+/// @param [out] hosts collection receiving the host reservations.
+/// @return a pointer to created Subnet4 object
+SubnetPtr
+parseSubnet4(const ConstElementPtr& subnet, HostCollection& hosts) {
+    Subnet4ConfigParser parser;
+    return (parser.parse(subnet, &hosts, false));
+}
+
 /// @brief this class parses list of DHCP4 subnets
 ///
 /// This is a wrapper parser that handles the whole list of Subnet4
@@ -279,16 +311,36 @@ public:
     ///
     /// Iterates over all entries on the list, parses its content
     /// (by instantiating Subnet6ConfigParser) and adds to specified
-    /// configuration.
+    /// configuration. The subnets which didn't change since the current
+    /// configuration was applied are taken from the
+    /// @c IncrementalConfigCache instead of being parsed. Most of the other
+    /// subnets are parsed ahead on several threads by the
+    /// @c ParallelSubnetsParser.
     ///
     /// @param subnets_list pointer to a list of IPv4 subnets
     /// @return number of subnets created
     size_t parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
+        IncrementalConfigCache& cache = IncrementalConfigCache::instance();
+        ParallelSubnetsParser parallel_parser(parseSubnet4);
+        parallel_parser.parse(subnets_list);
         size_t cnt = 0;
+        size_t index = 0;
         BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-            Subnet4ConfigParser parser;
-            Subnet4Ptr subnet = parser.parse(subnet_json);
+            Subnet4Ptr subnet = boost::dynamic_pointer_cast<
+                Subnet4>(cache.getSubnet(subnet_json));
+            if (!subnet) {
+                HostCollection hosts;
+                subnet = boost::dynamic_pointer_cast<
+                    Subnet4>(parallel_parser.getSubnet(index, hosts));
+                if (!subnet) {
+                    Subnet4ConfigParser parser;
+                    subnet = parser.parse(subnet_json, &hosts);
+                }
+                logNewSubnet4(subnet);
+                cache.addSubnet(subnet_json, subnet, hosts);
+            }
+            ++index;
             if (subnet) {
 
                 // Adding a subnet to the Configuration Manager may fail if the
@@ -323,6 +375,7 @@ public:
     /// - echo-client-id
     /// - decline-probation-period
     /// - dhcp4o6-port
+    /// - packet-timeline
     ///
     /// @throw DhcpConfigError if parameters are missing or
     /// or having incorrect values.
@@ -342,6 +395,9 @@ public:
         // @todo Change for uint16_t
         uint32_t dhcp4o6_port = getUint32(global, "dhcp4o6-port");
         cfg->setDhcp4o6Port(dhcp4o6_port);
+
+        // Set whether the packet processing latencies are recorded.
+        cfg->setPacketTimeline(getBoolean(global, "packet-timeline"));
     }
 
 private:
@@ -406,7 +462,7 @@ void configureCommandChannel() {
 }
 
 isc::data::ConstElementPtr
-configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
+configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                      bool check_only) {
     if (!config_set) {
         ConstElementPtr answer = isc::config::createAnswer(1,
@@ -459,6 +515,11 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
         // And now derive (inherit) global parameters to subnets, if not specified.
         SimpleParser4::deriveParameters(mutable_cfg);
 
+        // The subnets and client classes which didn't change can be reused
+        // unless the option definitions they use have changed.
+        IncrementalConfigCache::instance().
+            startConfig(mutable_cfg->get("option-def"));
+
         // We need definitions first
         ConstElementPtr option_defs = mutable_cfg->get("option-def");
         if (option_defs) {
@@ -532,9 +593,14 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
             }
 
             if (config_pair.first == "client-classes") {
-                ClientClassDefListParser parser;
+                IncrementalConfigCache& cache = IncrementalConfigCache::instance();
                 ClientClassDictionaryPtr dictionary =
-                    parser.parse(config_pair.second, AF_INET);
+                    cache.getClientClasses(config_pair.second);
+                if (!dictionary) {
+                    ClientClassDefListParser parser;
+                    dictionary = parser.parse(config_pair.second, AF_INET);
+                    cache.addClientClasses(config_pair.second, dictionary);
+                }
                 srv_cfg->setClientClassDictionary(dictionary);
                 continue;
             }
@@ -564,14 +630,16 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
 
             // Timers are not used in the global scope. Their values are derived
             // to specific subnets (see SimpleParser6::deriveParameters).
-            // decline-probation-period, dhcp4o6-port, echo-client-id are
-            // handled in global_parser.parse() which sets global parameters.
+            // decline-probation-period, dhcp4o6-port, echo-client-id and
+            // packet-timeline are handled in global_parser.parse() which sets
+            // global parameters.
             // match-client-id is derived to subnet scope level.
             if ( (config_pair.first == "renew-timer") ||
                  (config_pair.first == "rebind-timer") ||
                  (config_pair.first == "valid-lifetime") ||
                  (config_pair.first == "decline-probation-period") ||
                  (config_pair.first == "dhcp4o6-port") ||
+                 (config_pair.first == "packet-timeline") ||
                  (config_pair.first == "echo-client-id") ||
                  (config_pair.first == "match-client-id") ||
                  (config_pair.first == "next-server")) {
@@ -637,6 +705,10 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
             D2ClientConfigPtr cfg;
             cfg = CfgMgr::instance().getStagingCfg()->getD2ClientConfig();
             CfgMgr::instance().setD2ClientConfig(cfg);
+
+            // Get the latency histograms once rather than for each packet.
+            server.configureTimelineStats(CfgMgr::instance().getStagingCfg()->
+                                          getPacketTimeline());
         }
         catch (const isc::Exception& ex) {
             LOG_ERROR(dhcp4_logger, DHCP4_PARSER_COMMIT_FAIL).arg(ex.what());
@@ -659,6 +731,9 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
         return (answer);
     }
 
+    // Keep the parsed objects for the next configuration.
+    IncrementalConfigCache::instance().commit();
+
     LOG_INFO(dhcp4_logger, DHCP4_CONFIG_COMPLETE)
         .arg(CfgMgr::instance().getStagingCfg()->
              getConfigSummary(SrvConfig::CFGSEL_ALL4));
@@ -42,7 +42,7 @@ usage() {
     cerr << "Kea DHCPv4 server, version " << VERSION << endl;
     cerr << endl;
     cerr << "Usage: " << DHCP4_NAME
-         << " -[v|V|W] [-d] [-{c|t} cfgfile] [-p number]" << endl;
+         << " -[v|V|W] [-d] [-{c|t} cfgfile] [-p number] [-H socket]" << endl;
     cerr << "  -v: print version number and exit" << endl;
     cerr << "  -V: print extended version and exit" << endl;
     cerr << "  -W: display the configuration report and exit" << endl;
@@ -51,6 +51,8 @@ usage() {
     cerr << "  -t file: check the configuration file syntax and exit" << endl;
     cerr << "  -p number: specify non-standard port number 1-65535 "
          << "(useful for testing only)" << endl;
+    cerr << "  -H socket: take over the sockets of the server listening"
+         << " on the handoff socket" << endl;
     exit(EXIT_FAILURE);
 }
 } // end of anonymous namespace
@@ -66,7 +68,10 @@ main(int argc, char* argv[]) {
     // The standard config file
     std::string config_file("");
 
-    while ((ch = getopt(argc, argv, "dvVWc:p:t:")) != -1) {
+    // The socket used to hand off the sockets between servers
+    std::string handoff_socket("");
+
+    while ((ch = getopt(argc, argv, "dvVWc:p:t:H:")) != -1) {
         switch (ch) {
         case 'd':
             verbose_mode = true;
@@ -107,6 +112,10 @@ main(int argc, char* argv[]) {
             }
             break;
 
+        case 'H':
+            handoff_socket = optarg;
+            break;
+
         default:
             usage();
         }
@@ -195,11 +204,25 @@ main(int argc, char* argv[]) {
         // Create our PID file.
         server.setProcName(DHCP4_NAME);
         server.setConfigFile(config_file);
-        server.createPIDFile();
+
+        // Take over the sockets of the running server, if any. Its PID
+        // file is taken over once it has stopped.
+        int previous_pid = 0;
+        if (!handoff_socket.empty()) {
+            previous_pid = server.takeOverSockets(handoff_socket);
+        }
+        if (previous_pid == 0) {
+            server.createPIDFile();
+        }
 
         try {
             // Initialize the server.
             server.init(config_file);
+
+            // Stop the replaced server and wait for a successor.
+            if (!handoff_socket.empty()) {
+                server.completeHandoff();
+            }
         } catch (const std::exception& ex) {
 
             try {
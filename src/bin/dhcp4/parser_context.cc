@@ -165,6 +165,10 @@ Parser4Context::contextName()
         return ("loggers");
     case OUTPUT_OPTIONS:
         return ("output-options");
+    case RATE_LIMITS:
+        return ("rate-limits");
+    case ASYNC_LOGGING:
+        return ("async");
     case DHCP_DDNS:
         return ("dhcp-ddns");
     case NCR_PROTOCOL:
@@ -254,6 +254,12 @@ public:
         /// Used while parsing Logging/loggers/output_options structures.
         OUTPUT_OPTIONS,
 
+        /// Used while parsing Logging/loggers/rate-limits structures.
+        RATE_LIMITS,
+
+        /// Used while parsing Logging/async structures.
+        ASYNC_LOGGING,
+
         /// Used while parsing Dhcp4/dhcp-ddns.
         DHCP_DDNS,
 
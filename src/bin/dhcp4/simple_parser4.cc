@@ -60,6 +60,7 @@ const SimpleDefaults SimpleParser4::GLOBAL4_DEFAULTS = {
     { "valid-lifetime",           Element::integer, "7200" },
     { "decline-probation-period", Element::integer, "86400" }, // 24h
     { "dhcp4o6-port",             Element::integer, "0" },
+    { "packet-timeline",          Element::boolean, "true" },
     { "echo-client-id",           Element::boolean, "true" },
     { "match-client-id",          Element::boolean, "true" },
     { "next-server",              Element::string,  "0.0.0.0" }
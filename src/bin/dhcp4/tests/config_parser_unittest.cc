@@ -24,6 +24,7 @@
 #include <dhcpsrv/cfg_expiration.h>
 #include <dhcpsrv/cfg_hosts.h>
 #include <dhcpsrv/cfg_subnets4.h>
+#include <dhcpsrv/parsers/parallel_subnets_parser.h>
 #include <dhcpsrv/testutils/config_result_check.h>
 #include <hooks/hooks_manager.h>
 
@@ -3823,6 +3824,103 @@ TEST_F(Dhcp4ParserTest, reservations) {
     EXPECT_FALSE(host);
 }
 
+/// @brief Returns a configuration with many subnets and reservations.
+///
+/// Every fifth subnet has no identifier.
+///
+/// @param iface_config interfaces configuration.
+/// @param count number of subnets.
+/// @param bad_pool index of a subnet having a pool out of the subnet.
+/// @param bad_host index of a subnet having a duplicated reservation.
+std::string
+manySubnetsConfig(const std::string& iface_config, const int count,
+                  const int bad_pool = 0, const int bad_host = 0) {
+    std::ostringstream s;
+    s << "{ " << iface_config << ", \"valid-lifetime\": 4000, "
+      << "\"subnet4\": [ ";
+    for (int i = 1; i <= count; ++i) {
+        s << (i > 1 ? ", " : "") << "{ ";
+        if (i % 5) {
+            s << "\"id\": " << 1000 + i << ", ";
+        }
+        s << "\"subnet\": \"10.0." << i << ".0/24\", "
+          << "\"pools\": [ { \"pool\": \"10.0."
+          << (i == bad_pool ? i + 1 : i) << ".10 - 10.0."
+          << (i == bad_pool ? i + 1 : i) << ".100\" } ], "
+          << "\"reservations\": [ "
+          << "{ \"hw-address\": \"01:02:03:04:05:" << std::hex << i
+          << std::dec << "\", \"ip-address\": \"10.0." << i << ".200\" }";
+        if (i == bad_host) {
+            s << ", { \"hw-address\": \"01:02:03:04:06:01\","
+              << " \"ip-address\": \"10.0." << i << ".200\" }";
+        }
+        s << " ] }";
+    }
+    s << " ] }";
+    return (s.str());
+}
+
+// This test verifies that the subnets and the host reservations parsed
+// on several threads are configured as if they were parsed in order.
+TEST_F(Dhcp4ParserTest, parallelSubnets) {
+    ParallelSubnetsParser::setMaxThreads(4);
+    ParallelSubnetsParser::setMinSubnetsPerThread(1);
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(manySubnetsConfig(genIfaceConfig(),
+                                                        40)));
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 0);
+
+    CfgSubnets4Ptr subnets = CfgMgr::instance().getStagingCfg()->getCfgSubnets4();
+    CfgHostsPtr hosts = CfgMgr::instance().getStagingCfg()->getCfgHosts();
+    EXPECT_EQ(40, subnets->getAll()->size());
+    for (int i = 1; i <= 40; ++i) {
+        SCOPED_TRACE(i);
+        // The identifiers are generated in the order of the list.
+        const SubnetID id = (i % 5 ? 1000 + i : i / 5);
+        Subnet4Ptr subnet;
+        BOOST_FOREACH(Subnet4Ptr configured, *subnets->getAll()) {
+            if (configured->getID() == id) {
+                subnet = configured;
+            }
+        }
+        ASSERT_TRUE(subnet);
+        std::ostringstream prefix;
+        prefix << "10.0." << i << ".0/24";
+        EXPECT_EQ(prefix.str(), subnet->toText());
+        std::vector<uint8_t> hwaddr_vec;
+        for (int j = 1; j < 6; ++j) {
+            hwaddr_vec.push_back(static_cast<uint8_t>(j));
+        }
+        hwaddr_vec.push_back(static_cast<uint8_t>(i));
+        HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+        EXPECT_TRUE(hosts->get4(id, hwaddr));
+    }
+
+    // The first error in the order of the list is reported.
+    const std::string bad_config = manySubnetsConfig(genIfaceConfig(), 40,
+                                                     30, 7);
+    ASSERT_NO_THROW(json = parseDHCP4(bad_config));
+    CfgMgr::instance().rollback();
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+    ASSERT_TRUE(comment_);
+    const std::string parallel_error = comment_->stringValue();
+
+    ParallelSubnetsParser::setMaxThreads(1);
+    CfgMgr::instance().rollback();
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+    ASSERT_TRUE(comment_);
+    EXPECT_EQ(comment_->stringValue(), parallel_error);
+    EXPECT_NE(std::string::npos, parallel_error.find("10.0.7.200"));
+
+    ParallelSubnetsParser::setMaxThreads(0);
+    ParallelSubnetsParser::setMinSubnetsPerThread(32);
+}
+
 // This test checks that it is possible to configure option data for a
 // host using a user defined option format.
 TEST_F(Dhcp4ParserTest, reservationWithOptionDefinition) {
@@ -4128,6 +4226,34 @@ TEST_F(Dhcp4ParserTest, dhcp4o6portDefault) {
     EXPECT_EQ(0, CfgMgr::instance().getStagingCfg()->getDhcp4o6Port());
 }
 
+/// Check that the recording of the packet processing timeline is enabled
+/// by default and can be disabled.
+TEST_F(Dhcp4ParserTest, packetTimeline) {
+
+    string config_txt = "{ " + genIfaceConfig() + ","
+        "\"subnet4\": [  ] "
+        "}";
+    ConstElementPtr config;
+    ASSERT_NO_THROW(config = parseDHCP4(config_txt));
+
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, config));
+    checkResult(status, 0);
+    EXPECT_TRUE(CfgMgr::instance().getStagingCfg()->getPacketTimeline());
+
+    CfgMgr::instance().clear();
+
+    config_txt = "{ " + genIfaceConfig() + ","
+        "\"packet-timeline\": false,"
+        "\"subnet4\": [  ] "
+        "}";
+    ASSERT_NO_THROW(config = parseDHCP4(config_txt));
+
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, config));
+    checkResult(status, 0);
+    EXPECT_FALSE(CfgMgr::instance().getStagingCfg()->getPacketTimeline());
+}
+
 
 /// Check that the decline-probation-period value can be set properly.
 TEST_F(Dhcp4ParserTest, declineTimer) {
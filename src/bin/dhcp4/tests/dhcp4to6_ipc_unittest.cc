@@ -311,6 +311,9 @@ TEST_F(Dhcp4to6IpcTest, process) {
     EXPECT_FALSE(pkt4_snd);
     EXPECT_FALSE(pkt4_ack);
 
+    // Record the packet processing latencies.
+    srv_.configureTimelineStats(true);
+
     // Create an information request message
     Pkt4Ptr infreq(new Pkt4(DHCPINFORM, 1234));
     infreq->setHWAddr(generateHWAddr(6));
@@ -386,6 +389,14 @@ TEST_F(Dhcp4to6IpcTest, process) {
     ASSERT_TRUE(pkt4_ack);
     EXPECT_EQ(1, pkt4_snd->getInteger().first);
     EXPECT_EQ(1, pkt4_ack->getInteger().first);
+
+    // The latencies of the DHCPv4-over-DHCPv6 packet are recorded.
+    HistogramPtr total = mgr.getHistogram("pkt4-latency-total");
+    ASSERT_TRUE(total);
+    EXPECT_EQ(1, total->getCount());
+    HistogramPtr sent = mgr.getHistogram("pkt4-latency-send");
+    ASSERT_TRUE(sent);
+    EXPECT_EQ(1, sent->getCount());
 }
 
 } // end of anonymous namespace
@@ -10,12 +10,14 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/incremental_config_cache.h>
 #include <dhcp6/ctrl_dhcp6_srv.h>
 #include <dhcp6/dhcp6to4_ipc.h>
 #include <dhcp6/dhcp6_log.h>
 #include <dhcp6/json_config_parser.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/stopwatch.h>
 
 using namespace isc::config;
 using namespace isc::data;
@@ -208,6 +210,9 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_COMMAND, DHCP6_CONFIG_RECEIVED)
               .arg(config->str());
 
+    // Measure the time spent applying the configuration.
+    isc::util::Stopwatch stopwatch;
+
     ControlledDhcpv6Srv* srv = ControlledDhcpv6Srv::getInstance();
 
     if (!srv) {
@@ -228,6 +233,7 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
     }
 
     ConstElementPtr answer = configureDhcp6Server(*srv, config);
+    const std::string parse_time = stopwatch.logFormatTotalDuration();
 
     // Check that configuration was successful. If not, do not reopen sockets
     // and don't bother with DDNS stuff.
@@ -315,6 +321,17 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Install the timer reporting the suppressed log messages.
+    try {
+        CfgMgr::instance().getStagingCfg()->setupLogTimers();
+
+    } catch (const std::exception& ex) {
+        std::ostringstream err;
+        err << "unable to setup the timer for periodically reporting the"
+            " suppressed log messages: " << ex.what() << ".";
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // Start worker thread if there are any timers installed.
     if (TimerMgr::instance()->timersCount() > 0) {
         try {
@@ -331,6 +348,13 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
     // exception free.
     LibDHCP::commitRuntimeOptionDefs();
 
+    stopwatch.stop();
+    LOG_INFO(dhcp6_logger, DHCP6_CONFIG_TIMING)
+        .arg(stopwatch.logFormatTotalDuration())
+        .arg(parse_time)
+        .arg(IncrementalConfigCache::instance().getReusedSubnets())
+        .arg(IncrementalConfigCache::instance().getParsedSubnets());
+
     return (answer);
 }
 
@@ -373,6 +397,12 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
 
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-histogram-get",
+        boost::bind(&StatsMgr::statisticHistogramGetHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-histogram-get-all",
+        boost::bind(&StatsMgr::statisticHistogramGetAllHandler, _1, _2));
 }
 
 void ControlledDhcpv6Srv::shutdown() {
@@ -403,6 +433,8 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-reset-all");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
+        CommandMgr::instance().deregisterCommand("statistic-histogram-get");
+        CommandMgr::instance().deregisterCommand("statistic-histogram-get-all");
 
     } catch (...) {
         // Don't want to throw exceptions from the destructor. The server
@@ -524,8 +524,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to parser6_text[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 147
-#define YY_END_OF_BUFFER 148
+#define YY_NUM_RULES 160
+#define YY_END_OF_BUFFER 161
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -533,137 +533,149 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1181] =
+static const flex_int16_t yy_accept[1282] =
     {   0,
-      140,  140,    0,    0,    0,    0,    0,    0,    0,    0,
-      148,  146,   10,   11,  146,    1,  140,  137,  140,  140,
-      146,  139,  138,  146,  146,  146,  146,  146,  133,  134,
-      146,  146,  146,  135,  136,    5,    5,    5,  146,  146,
-      146,   10,   11,    0,    0,  129,    0,    0,    0,    0,
+      153,  153,    0,    0,    0,    0,    0,    0,    0,    0,
+      161,  159,   10,   11,  159,    1,  153,  150,  153,  153,
+      159,  152,  151,  159,  159,  159,  159,  159,  146,  147,
+      159,  159,  159,  148,  149,    5,    5,    5,  159,  159,
+      159,   10,   11,    0,    0,  142,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    1,  140,  140,    0,
-      139,  140,    3,    2,    6,    0,  140,    0,    0,    0,
-        0,    0,    0,    4,    0,    0,    9,    0,  130,    0,
+        0,    0,    0,    0,    0,    0,    0,    1,  153,  153,
+        0,  152,  153,    3,    2,    6,    0,  153,    0,    0,
+        0,    0,    0,    0,    4,    0,    0,    9,    0,  143,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  132,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  145,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    2,    0,    0,    0,    0,
-        0,    0,    0,    8,    0,    0,    0,  109,    0,    0,
-      110,    0,    0,    0,    0,    0,    0,    0,    0,  131,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        2,    0,    0,    0,    0,    0,    0,    0,    8,    0,
+        0,    0,    0,  121,    0,    0,  122,    0,    0,    0,
+        0,    0,    0,    0,    0,  144,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   75,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   79,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  145,  143,    0,  142,  141,    0,    0,
-        0,    0,    0,    0,  108,    0,    0,   28,    0,   27,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   46,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  158,  156,    0,
+      155,  154,    0,    0,    0,    0,    0,    0,    0,  120,
+        0,    0,   28,    0,   27,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,   47,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  144,  141,    0,    0,    0,    0,
-        0,    0,    0,   29,    0,    0,   31,    0,    0,    0,
-        0,    0,    0,   78,    0,    0,    0,   62,    0,    0,
-        0,    0,    0,   94,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   49,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   61,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   70,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  157,  154,    0,
+        0,    0,    0,    0,    0,    0,    0,   29,    0,    0,
+       32,    0,    0,    0,    0,    0,    0,    0,   82,    0,
+
+        0,    0,   66,    0,    0,    0,    0,    0,  106,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   50,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   90,  113,   42,    0,   47,    0,    0,    0,
-        0,    0,  127,   36,    0,   33,    0,   32,    0,    0,
-        0,    0,  101,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  112,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   44,    0,    0,
+       65,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   74,    0,    0,    0,    0,    0,    0,    0,
+       98,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  102,  125,   43,
+        0,   48,    0,    0,    0,    0,    0,    0,  140,   37,
+        0,   34,    0,   33,    0,    0,    0,    0,  113,   87,
 
-        0,    0,    0,    0,    0,    0,    0,   63,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  102,    0,    0,
-        0,    0,    0,    0,    0,    0,   97,    0,    0,    0,
-        0,    7,   34,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  124,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   45,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   85,    0,    0,    0,    0,
-        0,    0,    0,    0,   65,    0,    0,    0,    0,    0,
+        0,   67,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  114,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  109,    0,    0,    0,    0,    7,   35,
+       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,   72,    0,    0,    0,    0,    0,   82,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  106,
-       83,    0,    0,    0,   43,    0,    0,    0,    0,    0,
-        0,    0,    0,   50,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   92,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   69,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   58,    0,    0,    0,  128,
+        0,    0,    0,    0,   97,    0,    0,    0,    0,   76,
+        0,    0,    0,    0,    0,   86,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,   96,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   48,   64,    0,    0,    0,   93,    0,    0,   41,
+
+      118,   90,    0,    0,    0,    0,   44,   96,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   51,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   87,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  126,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   73,    0,    0,    0,    0,    0,
+        0,    0,   62,    0,    0,    0,  141,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  108,    0,    0,    0,    0,   99,    0,    0,    0,
+       54,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   49,   68,    0,    0,    0,  105,
 
-        0,    0,    0,   16,    0,  107,   14,    0,    0,    0,
+        0,    0,    0,    0,   42,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   94,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       98,   86,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   95,  111,    0,   38,
-        0,  103,    0,    0,    0,    0,    0,    0,   20,    0,
-        0,   59,    0,    0,    0,  105,   45,    0,   66,    0,
+        0,    0,    0,    0,  139,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       77,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  100,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,   79,    0,    0,    0,   60,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   55,    0,    0,    0,
-       17,   15,  125,  124,    0,    0,    0,    0,   30,    0,
-        0,   89,    0,    0,    0,    0,    0,  122,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   74,    0,
-       92,    0,   51,    0,    0,    0,   19,    0,    0,    0,
-        0,    0,   76,   56,    0,   99,    0,    0,    0,   91,
-        0,   71,    0,    0,    0,    0,    0,    0,    0,    0,
-       69,    0,  114,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   16,    0,  119,   14,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,  110,   93,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  107,  123,
+        0,   39,    0,  115,    0,    0,    0,    0,    0,    0,
+        0,   20,    0,    0,   63,    0,    0,    0,    0,    0,
+      117,   46,    0,   70,    0,   88,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       88,    0,  123,    0,   12,    0,    0,    0,    0,    0,
-        0,    0,   40,    0,   39,   18,    0,    0,   84,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   54,    0,
-        0,    0,   52,    0,   67,    0,    0,    0,    0,    0,
-      104,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   35,    0,    0,    0,    0,    0,
-        0,   26,    0,    0,    0,    0,  120,    0,    0,    0,
-        0,    0,    0,    0,   77,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   37,    0,    0,    0,    0,   13,
+        0,    0,    0,  112,    0,    0,    0,   53,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   83,
+        0,    0,    0,    0,   64,    0,    0,    0,    0,    0,
 
+        0,    0,    0,   95,    0,    0,    0,    0,   59,    0,
+        0,    0,   17,   15,  138,  137,    0,    0,    0,    0,
+       31,    0,    0,  101,    0,    0,    0,    0,    0,  134,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       78,    0,  104,    0,   55,   52,    0,    0,    0,   19,
+        0,    0,    0,    0,    0,    0,    0,   80,   60,    0,
+      111,    0,    0,    0,  103,    0,   75,    0,    0,    0,
+        0,    0,    0,    0,    0,   73,    0,  126,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  119,    0,   23,   53,    0,    0,    0,    0,
-       22,   21,    0,   68,    0,    0,  118,    0,    0,    0,
-        0,   25,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   24,    0,   80,    0,    0,    0,    0,
-        0,  116,  121,   57,    0,    0,    0,  115,    0,    0,
-        0,    0,    0,    0,    0,   81,    0,    0,  117,    0
+
+        0,    0,    0,    0,    0,    0,    0,  100,    0,  136,
+        0,   12,    0,    0,    0,    0,    0,    0,    0,   41,
+        0,   40,   18,    0,    0,   91,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   58,    0,    0,
+        0,   56,    0,   71,    0,    0,    0,    0,    0,  116,
+        0,    0,    0,    0,   89,    0,    0,  135,    0,    0,
+        0,    0,    0,    0,    0,   36,    0,    0,    0,    0,
+        0,    0,   26,    0,    0,    0,    0,  132,    0,    0,
+        0,    0,    0,    0,    0,   81,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   38,    0,    0,    0,    0,
+
+       13,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  131,    0,   23,   57,    0,    0,    0,
+        0,   22,   21,    0,   72,    0,    0,  130,    0,    0,
+        0,    0,   25,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   24,    0,   84,    0,    0,    0,
+        0,    0,  128,  133,   61,    0,    0,    0,  127,    0,
+        0,    0,    0,    0,    0,    0,   85,    0,    0,  129,
+        0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -675,13 +687,13 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,   27,    5,   28,    5,   29,    5,   30,   31,   32,
-        5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
-       40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
+        5,   27,   28,   29,    5,   30,    5,   31,   32,   33,
+        5,   34,   35,   36,   37,   38,   39,    5,   40,    5,
+       41,   42,   43,    5,   44,    5,   45,   46,   47,   48,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+       59,   60,   61,   62,   63,   64,   65,   66,   67,   68,
+       69,   70,   71,    5,   72,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -698,490 +710,524 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[73] =
     {   0,
         1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
         3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
         5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
+        3,    3,    3,    3,    5,    5,    5,    5,    5,    5,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        3,    3
     } ;
 
-static const flex_int16_t yy_base[1193] =
+static const flex_int16_t yy_base[1294] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1544, 1545,   32, 1540,  141,    0,  201, 1545,  206,   88,
-       11,  213, 1545, 1522,  114,   25,    2,    6, 1545, 1545,
-       73,   11,   17, 1545, 1545, 1545,  104, 1528, 1483,    0,
-     1520,  107, 1535,  217,  241, 1545,  185, 1486, 1506,   93,
-       58,  190,   91,  211,  200,   14,  267,  213,  175,  188,
-       64,  220, 1487,  187,   75,  261,  215,  289,  256,  278,
-     1470,  207,  284,  311,  293, 1489,    0,  337,  352,  360,
-      366,  372, 1545,    0, 1545,  331,  378,  227,  231,  259,
-      329,  341,  325, 1545, 1486, 1525, 1545,  237, 1545,  377,
-
-      335, 1484, 1523,  366,  253,  321, 1478,  362,  306,  366,
-      366,  293, 1521,    0,  428,  369, 1465, 1473,  356, 1469,
-     1458, 1459,  360, 1475, 1468,  365,  358, 1455, 1461,  361,
-     1449, 1505,  423, 1452, 1503, 1469, 1466, 1466, 1460,  364,
-     1453, 1446, 1451, 1445, 1442, 1441, 1455,  371, 1491, 1440,
-      350, 1452, 1455, 1439,  401,  400, 1451, 1452, 1450, 1432,
-     1437, 1433, 1425, 1442, 1434,    0,  402,  426,  414,  425,
-      437,  442, 1433, 1545,    0,  447, 1428, 1545,  435,  448,
-     1545, 1480, 1435,  445, 1478,  454, 1477,  450, 1476, 1545,
-      494, 1423,  462, 1436, 1431, 1430,  297, 1471, 1465, 1431,
-
-     1410, 1418, 1424, 1412, 1423, 1424, 1424, 1419, 1411, 1413,
-     1402, 1415, 1415, 1407, 1397, 1400, 1414, 1545, 1400, 1408,
-     1411, 1392, 1442, 1391, 1401, 1439, 1438, 1399, 1387, 1398,
-     1434, 1392, 1384, 1381, 1397, 1378, 1380, 1376, 1382, 1373,
-     1386, 1379, 1381, 1385, 1379,   80, 1386, 1381, 1373, 1379,
-     1379, 1360, 1376, 1369, 1376, 1364, 1357, 1371, 1370, 1373,
-     1355, 1363,  463, 1545, 1545,  464, 1545, 1545, 1350,    0,
-      445,  470,  473, 1407, 1545, 1360,  462, 1545, 1405, 1545,
-     1399,  530, 1343,  457, 1340, 1350, 1400, 1357, 1343, 1545,
-     1354, 1396, 1351, 1348, 1349,  488, 1392, 1342, 1337, 1334,
-
-     1330, 1332, 1341, 1330, 1379, 1327,  523, 1340, 1340, 1323,
-     1324, 1337, 1335, 1330, 1337, 1332, 1317,  440, 1326, 1322,
-     1370,  455, 1317, 1310, 1312, 1316, 1305, 1312, 1317,   62,
-     1318,  474, 1315, 1319, 1307, 1307, 1319, 1301, 1293, 1294,
-     1315, 1297, 1309, 1308, 1294, 1306, 1305, 1304, 1345, 1344,
-     1343, 1287,  521, 1300, 1545, 1545, 1299,    0,  496, 1339,
-     1338, 1296, 1336, 1545, 1284, 1334, 1545,  503,  572, 1328,
-      497, 1332, 1274, 1545, 1290, 1277, 1276, 1545, 1278, 1275,
-     1287, 1283, 1271, 1545, 1280, 1265, 1267, 1278, 1276, 1312,
-     1278, 1260, 1309, 1545, 1258, 1274, 1306, 1310, 1268, 1262,
-
-     1264, 1265, 1300, 1253, 1248, 1247, 1249, 1242, 1257, 1249,
-     1297, 1545, 1244, 1240, 1243, 1236, 1246, 1249, 1238, 1237,
-     1232, 1545, 1287, 1231, 1230, 1223, 1240, 1277, 1230, 1239,
-     1233, 1237,  555, 1272, 1236, 1216, 1219, 1218, 1226, 1214,
-     1270, 1212, 1545, 1545, 1545, 1217, 1545, 1227, 1261, 1223,
-        0, 1264, 1545, 1545, 1212, 1545, 1218, 1545,  505,  504,
-     1221,  558, 1545, 1255, 1202, 1209, 1202, 1214, 1213, 1197,
-     1212, 1242, 1246, 1192, 1194, 1206, 1206, 1191, 1188, 1202,
-     1194, 1200, 1191, 1199, 1545, 1184, 1195, 1199, 1181, 1194,
-     1177, 1171, 1176, 1173, 1188, 1189, 1186, 1545, 1172, 1174,
-
-     1220,  541, 1183, 1166, 1167, 1172, 1163, 1545, 1177, 1163,
-      561, 1155, 1176, 1166, 1209, 1163, 1207, 1545, 1155, 1153,
-     1167, 1170, 1202, 1201, 1148, 1199, 1545,  565, 1161, 1150,
-     1152, 1545, 1545, 1144, 1199,  538,  543, 1149, 1151, 1156,
-     1190, 1189, 1143, 1133, 1186, 1148, 1138, 1183, 1129, 1137,
-     1139, 1143, 1178, 1140, 1139, 1140, 1133, 1122, 1135, 1138,
-     1133, 1128, 1133, 1130, 1133, 1128, 1169, 1168, 1112, 1108,
-     1116, 1164, 1113, 1105, 1120, 1545, 1108, 1117, 1116, 1116,
-     1100, 1155, 1098, 1111, 1545, 1103, 1095, 1104, 1097, 1086,
-     1090, 1141, 1088, 1086, 1097, 1137, 1084,  498,  530, 1078,
-
-      542, 1545, 1139, 1097, 1086, 1090, 1135, 1545, 1129,  549,
-     1087, 1081, 1082, 1073, 1073, 1090, 1085, 1073, 1084, 1068,
-     1070, 1069, 1083, 1064, 1114, 1069, 1077, 1075, 1066, 1075,
-     1071, 1112, 1054, 1054, 1067, 1066, 1051, 1049, 1050, 1545,
-     1545, 1064, 1061, 1064, 1545, 1063, 1048,  480, 1046, 1093,
-     1042, 1096, 1095, 1545, 1040, 1052, 1050, 1091, 1039, 1039,
-     1088, 1041, 1029, 1023, 1031, 1033, 1042, 1035, 1027, 1027,
-      543, 1026, 1077, 1038, 1013, 1545, 1069, 1016, 1029, 1545,
-      568,  567, 1029, 1030, 1031, 1022, 1015, 1009, 1016, 1009,
-     1058, 1062, 1009, 1019, 1002, 1016, 1004, 1014, 1006, 1049,
-
-     1015,  997,  996, 1545, 1012,  993,  993,  597,  991, 1008,
-      986, 1002, 1038,  996,  984, 1000,   63,  197,  218,  391,
-      267, 1545, 1545,  294,  471,  491, 1545,  499,  514, 1545,
-      548,  554,  548,  551,  564,  558,  556,  616,  562,  618,
-      619,  565, 1545,  572,  570,  569,  583,  584,  600,  605,
-      577,  581,  575,  582,  593,  634,  635,  584,  588, 1545,
-      583,  601,  598,  636,  587,  605,  606,  592,  600,  609,
-      589,  610,  650,  651, 1545,  606,  654,  657,  619,  622,
-      605,  606,  613,  664,  613,  628,  667,  622,  620,  618,
-      671,  672,  624,  674,  670,  630,  635,  628,  637,  631,
-
-      626,  636,  632, 1545,  627, 1545, 1545,  628,  644,  645,
-      646,  628,  633,  672,  663,  636,  636,  639,  654,  649,
-     1545, 1545,  659,  658,  644,  645,  703,  658,  663,  650,
-      661,  653,  659,  655,  673,  674, 1545, 1545,  672, 1545,
-      675, 1545,  660,  679,  669,  719,  675,  717, 1545,  674,
-      724, 1545,  673,  680,  722, 1545, 1545,  682, 1545,  673,
-      673,  676,  690,  677,  688,  735,  694,  732,  738,  739,
-      740,  741,  702,  686,  698,  717,  746,  742,  707,  749,
-      698,  709,  714,  702,  754,  713, 1545,  715,  714,  716,
-      709,  718,  719,  716,  706,  708,  765,  714,  767,  712,
-
-      769, 1545,  707,  722,  772, 1545,  723,  733,  718,  734,
-      720,  780,  781,  727,  783,  742, 1545,  734,  736,  787,
-     1545, 1545, 1545, 1545,  740,  790,  742,  774, 1545,  736,
-      753, 1545,  740,  739,  741,  742,  800, 1545,  745,  802,
-      757,  748,  763,  763,  766,  766,  763,  768, 1545,  760,
-     1545,  770, 1545,  771,  772,  769, 1545,  761,  767,  766,
-      778,  778, 1545, 1545,  817, 1545,  782,  767,  773, 1545,
-      788, 1545,  785,  804,  776,  825,  831,  775,  833,  788,
-     1545,  835, 1545,  775,  832,  797,  793,  835,  785,  790,
-      843,  801,  845,  846,  809,  798,  849,  793,  810,  795,
-
-      810,  794,  851,  852,  817,  813,  860,  832,  821,  820,
-     1545,  864, 1545,  813, 1545,  866,  814,  863,  808,  813,
-      872,  822, 1545,  828, 1545, 1545,  819,  834, 1545,  872,
-      840,  833,  834,  843,  830,  832,  842,  835, 1545,  886,
-      849,  834, 1545,  839, 1545,  842,  837,  836,  894,  849,
-     1545,  891,  853,  856,  899,  842,  844,  852,  842,  858,
-      852,  868,  907,  903, 1545,  852,  869,  906,  870,  861,
-      868, 1545,  865,  870,  917,  862, 1545,  866,  878,  879,
-      922,  866,  867,  875, 1545,  886,  885,  877,  876,  879,
-      891,  882,  891,  893, 1545,  935,  895,  937,  938, 1545,
-
-      934,  894,  899,  880,  943,  944,  903,  946,  905,  906,
-      949,  908, 1545,  913, 1545, 1545,  895,  901,  954,  915,
-     1545, 1545,  901, 1545,  901,  903, 1545,  908,  903,  915,
-      911, 1545,  914,  918,  909,  961,  910,  926,  919,  914,
-      929,  920,  927,  914,  929,  976,  935,  978,  923,  939,
-      930,  944,  940, 1545,  984, 1545,  985,  986,  943,  942,
-      943, 1545, 1545, 1545,  990,  934,  950, 1545,  988,  939,
-      938,  940,  951,  998,  949, 1545,  958, 1001, 1545, 1545,
-     1007, 1012, 1017, 1022, 1027, 1032, 1037, 1040, 1014, 1019,
-     1021, 1034
+        0,   71,   19,   26,   42,   50,   36,   53,   59,   88,
+     1651, 1652,   31, 1647,  143,    0,  204, 1652,  209,   51,
+       11,  216, 1652, 1629,   90,   48,   33,   60, 1652, 1652,
+       88,   73,   77, 1652, 1652, 1652,  111, 1635, 1589,    0,
+     1627,  114, 1642,   26,  245, 1652,  187,  194, 1592, 1612,
+       96,  191,  197,  208,  215,  211,  209,  272,  257,   67,
+      199,   66,  279, 1593,   73,  192,  230,  272,  298,  273,
+      301, 1576,    2,  299,  308,  304, 1595,    0,  357,  364,
+      372,  378,  382, 1652,    0, 1652,  311,  385,  207,  212,
+      208,  216,  230,  251, 1652, 1592, 1632, 1652,  309, 1652,
+
+      378,  301,  298, 1590, 1630,  339,  343,  368, 1584,  367,
+      352,  372,  375,  385, 1628,    0,  430,  382, 1571, 1563,
+     1578,  367, 1574, 1563, 1564,  370, 1580, 1573,  394,  306,
+     1569, 1559, 1565,  355, 1553, 1610,  413, 1556, 1608, 1573,
+     1570, 1570, 1564,  400,   62, 1551, 1556, 1550, 1547, 1546,
+     1560,  401, 1597, 1545,   68, 1557,  412,  405,  425, 1548,
+      424, 1557, 1558, 1556, 1538, 1543, 1539, 1531, 1548, 1540,
+        0,  387,  436,  442,  424,  443,  449, 1539, 1652,    0,
+      463,  468, 1534, 1652,  458,  464, 1652, 1587, 1541,  469,
+     1585,  471, 1584,  466, 1583, 1652,  511, 1529,  483, 1542,
+
+     1528, 1536, 1535,  365, 1577, 1571, 1536, 1515, 1523, 1529,
+     1517, 1528, 1529, 1529, 1524, 1516, 1518, 1521, 1506, 1519,
+     1519, 1511, 1501, 1504, 1518, 1652, 1504, 1512, 1515, 1496,
+     1547, 1495, 1505, 1544, 1494, 1542, 1502, 1488, 1489, 1500,
+     1537, 1494, 1486, 1483, 1489, 1498, 1479, 1481, 1477, 1483,
+     1474, 1487, 1480, 1470, 1481, 1484, 1484, 1478,  444, 1485,
+     1480, 1472, 1478, 1466, 1477, 1458, 1474, 1467, 1474, 1462,
+     1455, 1469, 1468, 1471, 1453, 1461,  480, 1652, 1652,  481,
+     1652, 1652, 1448,    0,  462,  476,  499,  491, 1506, 1652,
+     1458,  477, 1652, 1504, 1652, 1498,  548, 1441,  472, 1438,
+
+     1459, 1447, 1498, 1454, 1440, 1652, 1451, 1494, 1448, 1445,
+     1446,  531, 1490, 1439, 1434, 1431, 1427, 1429, 1479, 1437,
+     1426, 1476, 1423,  541, 1436, 1436, 1419, 1420, 1433, 1431,
+      491, 1434, 1429, 1414, 1427,  488, 1422, 1429, 1417, 1466,
+      457, 1412, 1405,  493, 1420, 1411, 1400, 1407, 1412,  503,
+     1413,  526, 1410, 1413, 1413,  570, 1401, 1401, 1413, 1395,
+     1387, 1388, 1409, 1391, 1396, 1402, 1401, 1387, 1399, 1398,
+     1397, 1439, 1438, 1437, 1380,  571, 1393, 1652, 1652, 1392,
+        0,  543,  511, 1433, 1432, 1389, 1430, 1652, 1377, 1428,
+     1652,  552,  599, 1422,  553, 1426, 1425, 1366, 1652, 1382,
+
+     1369, 1368, 1652, 1370, 1367, 1379, 1375, 1363, 1652, 1372,
+     1357, 1359, 1370, 1368, 1366, 1404, 1369, 1351, 1401, 1652,
+     1349, 1365, 1398, 1402, 1359, 1353,  189, 1357, 1393, 1345,
+     1343, 1339, 1338, 1340, 1350, 1332, 1347, 1339, 1343, 1387,
+     1652, 1333, 1329, 1332, 1325, 1332, 1334, 1322, 1336, 1325,
+     1324, 1319, 1652, 1375, 1318, 1317, 1310, 1327, 1365, 1364,
+     1652, 1318, 1315, 1324, 1318, 1322,  578, 1358, 1321, 1301,
+     1317, 1303, 1302, 1310, 1298, 1355, 1296, 1652, 1652, 1652,
+     1301, 1652, 1311, 1346, 1307,    0, 1349, 1348, 1652, 1652,
+     1295, 1652, 1301, 1652,  533,  556, 1304,  580, 1652, 1652,
+
+     1339, 1285, 1292, 1285, 1297, 1296, 1280, 1295, 1326, 1330,
+     1275, 1277, 1289, 1289, 1277, 1273, 1270, 1284, 1276, 1282,
+     1273, 1281, 1652, 1266, 1277, 1281, 1280, 1262, 1275, 1258,
+     1273, 1251, 1256, 1253, 1306, 1267, 1268, 1265, 1264, 1652,
+     1250, 1252, 1299,  561, 1250, 1260, 1296, 1242, 1243, 1248,
+     1239, 1652, 1253, 1239,  620, 1231, 1236, 1251, 1244, 1240,
+     1284, 1237, 1282, 1652, 1229, 1227, 1241, 1244, 1282, 1276,
+     1275, 1221, 1273, 1652,  595, 1234, 1223, 1225, 1652, 1652,
+     1652, 1217, 1273,  564,  578, 1222, 1224, 1229, 1264, 1263,
+     1216, 1206, 1260, 1221, 1211, 1257, 1202, 1210, 1212, 1216,
+
+     1252, 1200, 1212, 1211, 1212, 1205, 1194, 1207, 1210, 1205,
+     1200, 1205, 1195, 1201, 1204, 1199, 1198, 1240, 1239, 1182,
+     1180, 1177, 1185, 1234, 1233, 1181, 1173, 1188, 1652, 1176,
+     1167, 1184, 1168, 1182, 1182, 1166, 1222, 1164, 1177, 1652,
+     1169, 1161, 1170, 1169, 1162, 1163, 1150, 1154, 1206, 1152,
+     1150, 1161, 1202, 1148, 1652,  549,  576, 1142,  574, 1652,
+     1204, 1161, 1150, 1154, 1200, 1652, 1194,  572, 1151, 1145,
+     1146, 1137, 1137, 1154, 1149, 1137, 1148, 1132, 1134, 1133,
+     1147, 1128, 1179, 1133, 1131, 1140, 1138, 1129, 1138, 1134,
+     1176, 1117, 1117, 1130, 1129, 1171, 1113, 1111, 1112, 1167,
+
+     1652, 1652, 1125, 1107, 1121, 1124, 1652, 1652, 1123, 1108,
+      585, 1106, 1154, 1153, 1110, 1100, 1155, 1154, 1652, 1098,
+     1110, 1108, 1150, 1097, 1084, 1096,    7,  130,  301,  301,
+      361,  372,  444,  472,  492,  493,  495,  591,  509,  581,
+      563,  548, 1652,  608,  569,  587, 1652,  607,  616,  593,
+      596,  605,  599,  594,  590,  599,  594,  646,  652,  600,
+      612,  597,  613,  603,  615,  621,  612,  659,  626,  610,
+      611, 1652,  629,  612,  614,  671, 1652,  615,  634,  614,
+     1652,  632,  624,  673,  632,  622,  640,  624,  639,  626,
+      631,  645,  636,  631, 1652, 1652,  639,  685,  639, 1652,
+
+      647,  650,  643,  637, 1652,  645,  651,  645,  646,  658,
+      652,  650,  704,  649,  706,  707,  652, 1652,  658,  656,
+      655,  669,  670,  686,  691,  663,  667,  661,  668,  679,
+      721,  722,  670,  674, 1652,  669,  687,  684,  724,  674,
+      692,  674,  694,  680,  688,  697,  677,  698,  739,  740,
+     1652,  694,  744,  745,  706,  708,  691,  694,  694,  701,
+      753,  701,  716,  756,  710,  705,  709,  707,  718,  762,
+      763,  714,  765,  761,  767,  721,  712,  727,  720,  729,
+      723,  718,  728,  724, 1652,  719, 1652, 1652,  720,  736,
+      737,  738,  720,  725,  765,  755,  728,  728,  732,  747,
+
+      742, 1652, 1652,  752,  750,  736,  737,  796,  750,  755,
+      742,  800,  754,  746,  752,  748,  766,  767, 1652, 1652,
+      765, 1652,  768, 1652,  753,  772,  762,  814,  772,  769,
+      812, 1652,  768,  819, 1652,  767,  771,  775,  818,  774,
+     1652, 1652,  778, 1652,  769, 1652,  769,  828,  773,  787,
+      774,  785,  833,  791,  830,  836,  837,  838,  839,  799,
+      783,  795,  814,  844,  840,  804,  847,  795,  806,  811,
+      799,  852,  810, 1652,  812,  811,  813, 1652,  806,  815,
+      816,  813,  803,  805,  863,  811,  865,  809,  867, 1652,
+      868,  805,  820,  872, 1652,  821,  827,  832,  817,  830,
+
+      835,  821,  881, 1652,  882,  827,  884,  842, 1652,  834,
+      837,  889, 1652, 1652, 1652, 1652,  841,  892,  842,  875,
+     1652,  836,  853, 1652,  840,  839,  841,  842,  901, 1652,
+      845,  903,  857,  848,  863,  863,  866,  866,  863,  868,
+     1652,  860, 1652,  870, 1652, 1652,  871,  872,  869, 1652,
+      860,  878,  868,  867,  870,  880,  880, 1652, 1652,  920,
+     1652,  884,  869,  875, 1652,  890, 1652,  887,  906,  878,
+      928,  934,  877,  936,  890, 1652,  938, 1652,  877,  935,
+      899,  895,  938,  887,  892,  946,  903,  948,  949,  911,
+      900,  952,  890,  896,  913,  913,  899,  915,  899,  956,
+
+      957,  921,  917,  965,  936,  925,  924, 1652,  969, 1652,
+      917, 1652,  971,  918,  968,  912,  917,  977,  926, 1652,
+      932, 1652, 1652,  923,  938, 1652,  982,  978,  945,  985,
+      939,  940,  949,  936,  938,  948,  941, 1652,  993,  956,
+      941, 1652,  945, 1652,  948,  943,  942, 1001,  955, 1652,
+      998,  959,  962, 1006, 1652,  948,  950, 1652,  958,  948,
+      964,  958,  974, 1014, 1010, 1652,  958,  975, 1013,  976,
+      967,  974, 1652,  971,  976, 1024,  968, 1652,  972,  984,
+      985, 1029,  972,  973,  981, 1652,  992,  991,  983,  982,
+      985,  997,  988,  997,  999, 1652, 1042, 1001, 1044, 1045,
+
+     1652, 1041, 1000, 1005,  986, 1050, 1051, 1009, 1053, 1011,
+     1012, 1056, 1014, 1652, 1019, 1652, 1652, 1001, 1007, 1061,
+     1021, 1652, 1652, 1007, 1652, 1007, 1009, 1652, 1014, 1009,
+     1021, 1017, 1652, 1020, 1024, 1015, 1068, 1016, 1032, 1025,
+     1020, 1035, 1026, 1033, 1020, 1035, 1083, 1041, 1085, 1029,
+     1045, 1036, 1050, 1046, 1652, 1091, 1652, 1092, 1093, 1049,
+     1048, 1049, 1652, 1652, 1652, 1097, 1040, 1056, 1652, 1095,
+     1045, 1044, 1046, 1057, 1105, 1055, 1652, 1064, 1108, 1652,
+     1652, 1114, 1119, 1124, 1129, 1134, 1139, 1144, 1147, 1121,
+     1126, 1128, 1141
 
     } ;
 
-static const flex_int16_t yy_def[1193] =
+static const flex_int16_t yy_def[1294] =
     {   0,
-     1181, 1181, 1182, 1182, 1181, 1181, 1181, 1181, 1181, 1181,
-     1180, 1180, 1180, 1180, 1180, 1183, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1184,
-     1180, 1180, 1180, 1185,   15, 1180,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1186,   45,   45,   45,
+     1282, 1282, 1283, 1283, 1282, 1282, 1282, 1282, 1282, 1282,
+     1281, 1281, 1281, 1281, 1281, 1284, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1285,
+     1281, 1281, 1281, 1286,   15, 1281,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1287,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1183, 1180, 1180, 1180,
-     1180, 1180, 1180, 1187, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1184, 1180, 1185, 1180, 1180,
+       45,   45,   45,   45,   45,   45,   45, 1284, 1281, 1281,
+     1281, 1281, 1281, 1281, 1288, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1285, 1281, 1286, 1281,
 
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1289,   45, 1287,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1188,   45, 1186,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1187, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1189,   45,   45, 1180,   45,   45,
-     1180,   45,   45,   45,   45,   45,   45,   45, 1188, 1180,
-     1186,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1288, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1290,
+       45,   45,   45, 1281,   45,   45, 1281,   45,   45,   45,
+       45,   45,   45,   45, 1289, 1281, 1287,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1180,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1281,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1190,
-       45,   45,   45,   45, 1180,   45,   45, 1180,   45, 1180,
-       45, 1186,   45,   45,   45,   45,   45,   45,   45, 1180,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1291,   45,   45,   45,   45,   45, 1281,
+       45,   45, 1281,   45, 1281,   45, 1287,   45,   45,   45,
 
+       45,   45,   45,   45,   45, 1281,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1180, 1180, 1180, 1191,   45,   45,
-       45,   45,   45, 1180,   45,   45, 1180,   45, 1186,   45,
-       45,   45,   45, 1180,   45,   45,   45, 1180,   45,   45,
-       45,   45,   45, 1180,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1180,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1180,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1180,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1281, 1281, 1281,
+     1292,   45,   45,   45,   45,   45,   45, 1281,   45,   45,
+     1281,   45, 1287,   45,   45,   45,   45,   45, 1281,   45,
+
+       45,   45, 1281,   45,   45,   45,   45,   45, 1281,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1281,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1180, 1180, 1180,   45, 1180,   45,   45, 1180,
-     1192,   45, 1180, 1180,   45, 1180,   45, 1180,   45,   45,
-       45,   45, 1180,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1180,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1180,   45,   45,
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1281,   45,   45,   45,   45,   45,   45,   45,
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1281, 1281, 1281,
+       45, 1281,   45,   45, 1281, 1293,   45,   45, 1281, 1281,
+       45, 1281,   45, 1281,   45,   45,   45,   45, 1281, 1281,
 
-       45,   45,   45,   45,   45,   45,   45, 1180,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1180,   45,   45,
-       45,   45,   45,   45,   45,   45, 1180,   45,   45,   45,
-       45, 1180, 1180,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1281,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1281,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1180,   45,   45,   45,   45,
-       45,   45,   45,   45, 1180,   45,   45,   45,   45,   45,
+       45, 1281,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1281,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1281,   45,   45,   45,   45, 1281, 1281,
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45, 1180,   45,   45,   45,   45,   45, 1180,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1180,
-     1180,   45,   45,   45, 1180,   45,   45,   45,   45,   45,
-       45,   45,   45, 1180,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1281,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1281,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1180,   45,   45,   45, 1180,
+       45,   45,   45,   45, 1281,   45,   45,   45,   45, 1281,
+       45,   45,   45,   45,   45, 1281,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45, 1180,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1180, 1180,   45,   45,   45, 1180,   45,   45, 1180,
+
+     1281, 1281,   45,   45,   45,   45, 1281, 1281,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1281,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1180,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1180,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1180,   45,   45,   45,   45,   45,
+       45,   45, 1281,   45,   45,   45, 1281,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1281,   45,   45,   45,   45, 1281,   45,   45,   45,
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1281, 1281,   45,   45,   45, 1281,
 
-       45,   45,   45, 1180,   45, 1180, 1180,   45,   45,   45,
+       45,   45,   45,   45, 1281,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1281,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1180, 1180,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1180, 1180,   45, 1180,
-       45, 1180,   45,   45,   45,   45,   45,   45, 1180,   45,
-       45, 1180,   45,   45,   45, 1180, 1180,   45, 1180,   45,
+       45,   45,   45,   45, 1281,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1180,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45, 1180,   45,   45,   45, 1180,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1180,   45,   45,   45,
-     1180, 1180, 1180, 1180,   45,   45,   45,   45, 1180,   45,
-       45, 1180,   45,   45,   45,   45,   45, 1180,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1180,   45,
-     1180,   45, 1180,   45,   45,   45, 1180,   45,   45,   45,
-       45,   45, 1180, 1180,   45, 1180,   45,   45,   45, 1180,
-       45, 1180,   45,   45,   45,   45,   45,   45,   45,   45,
-     1180,   45, 1180,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1281,   45, 1281, 1281,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
+       45, 1281, 1281,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1281, 1281,
+       45, 1281,   45, 1281,   45,   45,   45,   45,   45,   45,
+       45, 1281,   45,   45, 1281,   45,   45,   45,   45,   45,
+     1281, 1281,   45, 1281,   45, 1281,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1180,   45, 1180,   45, 1180,   45,   45,   45,   45,   45,
-       45,   45, 1180,   45, 1180, 1180,   45,   45, 1180,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1180,   45,
-       45,   45, 1180,   45, 1180,   45,   45,   45,   45,   45,
-     1180,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1180,   45,   45,   45,   45,   45,
-       45, 1180,   45,   45,   45,   45, 1180,   45,   45,   45,
-       45,   45,   45,   45, 1180,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1180,   45,   45,   45,   45, 1180,
+       45,   45,   45, 1281,   45,   45,   45, 1281,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1281,
+       45,   45,   45,   45, 1281,   45,   45,   45,   45,   45,
 
+       45,   45,   45, 1281,   45,   45,   45,   45, 1281,   45,
+       45,   45, 1281, 1281, 1281, 1281,   45,   45,   45,   45,
+     1281,   45,   45, 1281,   45,   45,   45,   45,   45, 1281,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1281,   45, 1281,   45, 1281, 1281,   45,   45,   45, 1281,
+       45,   45,   45,   45,   45,   45,   45, 1281, 1281,   45,
+     1281,   45,   45,   45, 1281,   45, 1281,   45,   45,   45,
+       45,   45,   45,   45,   45, 1281,   45, 1281,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1180,   45, 1180, 1180,   45,   45,   45,   45,
-     1180, 1180,   45, 1180,   45,   45, 1180,   45,   45,   45,
-       45, 1180,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1180,   45, 1180,   45,   45,   45,   45,
-       45, 1180, 1180, 1180,   45,   45,   45, 1180,   45,   45,
-       45,   45,   45,   45,   45, 1180,   45,   45, 1180,    0,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180
+
+       45,   45,   45,   45,   45,   45,   45, 1281,   45, 1281,
+       45, 1281,   45,   45,   45,   45,   45,   45,   45, 1281,
+       45, 1281, 1281,   45,   45, 1281,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1281,   45,   45,
+       45, 1281,   45, 1281,   45,   45,   45,   45,   45, 1281,
+       45,   45,   45,   45, 1281,   45,   45, 1281,   45,   45,
+       45,   45,   45,   45,   45, 1281,   45,   45,   45,   45,
+       45,   45, 1281,   45,   45,   45,   45, 1281,   45,   45,
+       45,   45,   45,   45,   45, 1281,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1281,   45,   45,   45,   45,
+
+     1281,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1281,   45, 1281, 1281,   45,   45,   45,
+       45, 1281, 1281,   45, 1281,   45,   45, 1281,   45,   45,
+       45,   45, 1281,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1281,   45, 1281,   45,   45,   45,
+       45,   45, 1281, 1281, 1281,   45,   45,   45, 1281,   45,
+       45,   45,   45,   45,   45,   45, 1281,   45,   45, 1281,
+        0, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281
 
     } ;
 
-static const flex_int16_t yy_nxt[1617] =
+static const flex_int16_t yy_nxt[1725] =
     {   0,
-     1180,   13,   14,   13, 1180,   15,   16, 1180,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   83, 1180,
-       37,   14,   37,   84,   25,   26,   38, 1180, 1180,   27,
-       37,   14,   37,   42,   28,   42,   38,   89,   90,   29,
-      112,   30,   13,   14,   13,   88,   89,   25,   31,   90,
-       13,   14,   13,   13,   14,   13,   32,   40, 1180,   13,
-       14,   13,   33,   40,  112,   89,   90,  422,   88,   34,
-       35,   13,   14,   13,   92,   15,   16,   93,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  105,   39,   88,   25,   26,   13,   14,   13,   27,
-
-       39,   82,   82,   82,   28,   42,   41,   42,   42,   29,
-       42,   30,   80,  104,   41,  108,   91,   25,   31,  105,
-      126,  133,   86,  423,   86,  786,   32,   87,   87,   87,
-      127,  134,   33,  135,  337,   80,  104,  338,  108,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
+     1281,   13,   14,   13, 1281,   15,   16, 1281,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   84, 1281,
+       37,   14,   37,   85,   25,   26,   38,   37,   14,   37,
+       27,  100,   42,   38,   42,   28, 1281,   13,   14,   13,
+       29,   40,   30,   13,   14,   13,  158, 1281,   25,   31,
+      159,   13,   14,   13,   13,   14,   13,   32,   40,  804,
+       13,   14,   13,   33,   83,   83,   83,  101,   89,   90,
+       34,   35,   13,   14,   13,   81,   15,   16,   41,   17,
+       18,   19,   20,   21,   22,   22,   22,   23,   24,   13,
+       14,   13,   89,   91,   39,   25,   26,   90,   87,   81,
+
+       87,   27,   39,   88,   88,   88,   28,   41,   89,   90,
+       91,   29,   42,   30,   42,   42,  106,   42,  237,   25,
+       31,   91,  121,  129,  238,  122,  250,  123,   32,  124,
+      251,  134,   92,  130,   33,  805,  135,   93,   94,  136,
+      106,   34,   35,   44,   44,   44,   45,   45,   46,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   45,   48,   49,   50,   45,   51,   52,
-       53,   45,   45,   45,   45,   54,   55,   45,   56,   45,
-       45,   57,   45,   45,   58,   45,   59,   60,   61,   62,
-       63,   64,   65,   51,   45,   66,   67,   68,   69,   70,
-
-       71,   72,   73,   74,   75,   76,   56,   45,   45,   45,
-       45,   45,   78,  101,   79,   79,   79,   78,  106,   81,
-       81,   81,   99,  111,   78,   80,   81,   81,   81,  118,
-       80,  122,  119,  109,  120,  123,  121,   80,  124,  101,
-      104,  101,   99,  110,  130,  787,  111,  107,   80,  131,
-      154,  125,  132,   80,  155,  167,  109,  100,  140,  168,
-       80,   45,  141,  104,   45,   45,   45,  116,   45,   45,
-       45,  110,  114,  117,  128,   45,   45,  100,   45,   45,
-      788,  167,  142,  180,   45,  168,   45,   45,   45,   45,
-       45,   45,   45,   45,  169,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,  136,  137,
-      180,   45,  138,  108,  145,   45,  111,  188,  139,  146,
-      147,  148,  169,   45,  149,  150,  181,   45,  791,   45,
-      115,  156,  143,  109,  144,  151,  108,  185,  152,  111,
-      188,  157,  158,  110,   87,   87,   87,  159,  792,  163,
-       82,   82,   82,  288,  164,  182,  109,  167,  160,  289,
-      169,   80,  161,   78,  185,   79,   79,   79,   86,  168,
-       86,  110,  176,   87,   87,   87,   80,   78,  162,   81,
-       81,   81,   98,  170,   80,   82,   82,   82,  172,   98,
-       80,   87,   87,   87,  179,  171,   80,  187,  184,   80,
-
-      176,  186,  196,  209,  201,  202,  176,  239,  206,  226,
-      207,  240,  197,   80,  203,  213,  210,   98,  214,   80,
-      179,   98,  215,  192,  187,   98,  184,  208,  218,  186,
-      227,  235,  236,   98,  193,  263,  789,   98,  265,   98,
-      175,  191,  191,  191,  244,  245,  246,  790,  191,  191,
-      191,  191,  191,  191,  264,  247,  251,  248,  263,  249,
-      252,  265,  250,  263,  253,  264,  265,  271,  273,  277,
-      219,  191,  191,  191,  191,  191,  191,  274,  279,  281,
-      264,  793,  271,  359,  360,  361,  266,  355,  355,  268,
-      271,  267,  277,  362,  366,  359,  273,  363,  382,  408,
-
-      409,  279,  383,  413,  274,  284,  281,  282,  282,  282,
-      355,  356,  359,  414,  282,  282,  282,  282,  282,  282,
-      363,  425,  366,  717,  371,  426,  447,  718,  394,  452,
-      452,  448,  459,  395,  460,  536,  537,  282,  282,  282,
-      282,  282,  282,  369,  369,  369,  576,  794,  795,  669,
-      369,  369,  369,  369,  369,  369,  670,  452,  462,  459,
-      518,  460,  536,  533,  537,  519,  585,  610,  539,  796,
-      602,  586,  609,  369,  369,  369,  369,  369,  369,  396,
-      603,  671,  682,  577,  397,   45,   45,   45,  672,  740,
-      610,  750,   45,   45,   45,   45,   45,   45,  674,  749,
-
-      609,  741,  775,  797,  675,  798,  799,  776,  587,  800,
-      682,  801,  802,  803,  750,   45,   45,   45,   45,   45,
-       45,  804,  805,  806,  807,  808,  749,  809,  810,  811,
-      812,  813,  814,  816,  815,  817,  818,  819,  820,  821,
-      822,  823,  824,  825,  826,  827,  828,  829,  830,  831,
-      832,  833,  834,  835,  836,  837,  838,  839,  777,  840,
-      814,  815,  842,  844,  841,  845,  846,  847,  848,  849,
-      850,  851,  852,  853,  854,  855,  856,  857,  858,  859,
-      860,  861,  862,  863,  864,  865,  866,  867,  868,  869,
-      870,  871,  872,  873,  874,  875,  876,  877,  878,  879,
-
-      880,  881,  882,  883,  843,  884,  885,  886,  887,  888,
-      889,  890,  891,  892,  893,  894,  895,  896,  897,  876,
-      898,  899,  900,  901,  902,  877,  903,  904,  905,  906,
-      907,  908,  909,  910,  911,  912,  913,  914,  915,  916,
-      917,  918,  919,  921,  922,  923,  924,  925,  926,  927,
-      928,  929,  930,  931,  932,  934,  935,  936,  937,  938,
-      939,  940,  941,  942,  943,  944,  945,  946,  947,  948,
-      949,  950,  951,  952,  953,  954,  955,  957,  928,  958,
-      959,  960,  961,  962,  956,  963,  964,  965,  966,  967,
-      968,  969,  970,  920,  971,  972,  933,  973,  974,  975,
-
-      976,  977,  978,  979,  980,  981,  982,  983,  984,  985,
-      986,  987,  988,  989,  990,  991,  992,  993,  994,  995,
-      996,  974,  997,  998,  999, 1000, 1001, 1002, 1003, 1004,
-     1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014,
-     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024,
-     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1008, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
-     1044, 1045, 1047, 1048, 1049, 1050, 1046, 1051, 1052, 1053,
-     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
-     1064, 1065, 1066, 1067, 1040, 1068, 1069, 1070, 1071, 1072,
-
-     1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
-     1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102,
-     1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
-     1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
-     1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132,
-     1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
-     1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
-     1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162,
-     1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
-
-     1173, 1174, 1175, 1176, 1177, 1178, 1179,   12,   12,   12,
-       12,   12,   36,   36,   36,   36,   36,   77,  270,   77,
-       77,   77,   96,  358,   96,  451,   96,   98,   98,   98,
-       98,   98,  113,  113,  113,  113,  113,  166,   98,  166,
-      166,  166,  189,  189,  189,  785,  784,  783,  782,  781,
-      780,  779,  778,  774,  773,  772,  771,  770,  769,  768,
-      767,  766,  765,  764,  763,  762,  761,  760,  759,  758,
-      757,  756,  755,  754,  753,  752,  751,  748,  747,  746,
-      745,  744,  743,  742,  739,  738,  737,  736,  735,  734,
-      733,  732,  731,  730,  729,  728,  727,  726,  725,  724,
-
-      723,  722,  721,  720,  719,  716,  715,  714,  713,  712,
-      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
-      701,  700,  699,  698,  697,  696,  695,  694,  693,  692,
-      691,  690,  689,  688,  687,  686,  685,  684,  683,  681,
-      680,  679,  678,  677,  676,  673,  668,  667,  666,  665,
-      664,  663,  662,  661,  660,  659,  658,  657,  656,  655,
-      654,  653,  652,  651,  650,  649,  648,  647,  646,  645,
-      644,  643,  642,  641,  640,  639,  638,  637,  636,  635,
-      634,  633,  632,  631,  630,  629,  628,  627,  626,  625,
-      624,  623,  622,  621,  620,  619,  618,  617,  616,  615,
-
-      614,  613,  612,  611,  608,  607,  606,  605,  604,  601,
-      600,  599,  598,  597,  596,  595,  594,  593,  592,  591,
-      590,  589,  588,  584,  583,  582,  581,  580,  579,  578,
-      575,  574,  573,  572,  571,  570,  569,  568,  567,  566,
-      565,  564,  563,  562,  561,  560,  559,  558,  557,  556,
-      555,  554,  553,  552,  551,  550,  549,  548,  547,  546,
-      545,  544,  543,  542,  541,  540,  538,  535,  534,  533,
-      532,  531,  530,  529,  528,  527,  526,  525,  524,  523,
-      522,  521,  520,  517,  516,  515,  514,  513,  512,  511,
-      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
+       45,   45,   45,   47,   48,   45,   49,   50,   51,   45,
+       45,   52,   53,   54,   45,   45,   45,   45,   55,   56,
+       45,   57,   45,   45,   58,   45,   45,   59,   48,   60,
+       61,   62,   63,   64,   65,   66,   52,   45,   67,   68,
+
+       69,   70,   71,   72,   73,   74,   75,   76,   77,   57,
+       45,   45,   45,   45,   45,   79,  102,   80,   80,   80,
+       79,  103,   82,   82,   82,  107,  108,   79,   81,   82,
+       82,   82,  110,   81,  113,  114,  172,  111,  526,  137,
+       81,  173,  102,  125,  174,  172,  103,  126,  112,  138,
+      127,  139,   81,  107,  527,  109,  110,   81,  113,  173,
+      114,  111,  172,  128,   81,   45,   45,  173,   45,   45,
+       45,  175,  174,   45,   45,   45,  112,  116,  140,  141,
+       45,   45,  142,   45,   45,  176,  102,  174,  143,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  106,
 
-      500,  499,  498,  497,  496,  495,  494,  493,  492,  491,
-      490,  489,  488,  487,  486,  485,  484,  483,  482,  481,
-      480,  479,  478,  477,  476,  475,  474,  473,  472,  471,
-      470,  469,  468,  467,  466,  465,  464,  463,  461,  458,
-      457,  456,  455,  454,  453,  450,  449,  446,  445,  444,
-      443,  442,  441,  440,  439,  438,  437,  436,  435,  434,
-      433,  432,  431,  430,  429,  428,  427,  424,  421,  420,
-      419,  418,  417,  416,  415,  412,  411,  410,  407,  406,
-      405,  404,  403,  402,  401,  400,  399,  398,  393,  392,
-      391,  390,  389,  388,  387,  386,  385,  384,  381,  380,
-
-      379,  378,  377,  376,  375,  374,  373,  372,  370,  368,
-      367,  365,  364,  357,  354,  353,  352,  351,  350,  349,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  118,   45,  100,  177,  144,   45,  119,  120,
+      145,   45,  110,  106,   88,   88,   88,  113,  182,   45,
+      111,  131,  149,   45,  132,   45,  117,  150,  151,  181,
+      146,  112,  147,  160,  148,  152,  110,  161,  153,  154,
+      101,  113,  216,  806,  111,  182,  165,  162,  163,  155,
+      166,  168,  156,  164,  807,  217,  169,  181,  185,  112,
+       83,   83,   83,  187,  186,   79,  167,   80,   80,   80,
+       87,   81,   87,   99,  191,   88,   88,   88,   81,   79,
+       99,   82,   82,   82,  185,   83,   83,   83,   88,   88,
+
+       88,  186,   81,  188,  190,   81,   81,  193,  192,  194,
+      221,  191,   81,  222,  203,  208,  209,  223,  226,   99,
+      181,  277,  304,   99,  204,  210,   81,   99,  305,  808,
+       81,  809,  190,  194,  193,   99,  192,  198,  213,   99,
+      214,   99,  180,  197,  197,  197,  234,  245,  199,  277,
+      197,  197,  197,  197,  197,  197,  253,  215,  277,  235,
+      254,  227,  246,  247,  255,  278,  279,  236,  256,  257,
+      258,  259,  278,  279,  197,  197,  197,  197,  197,  197,
+      260,  265,  261,  285,  262,  266,  280,  263,  286,  267,
+      279,  278,  288,  292,  289,  294,  296,  282,  281,  359,
+
+      810,  382,  360,  285,  378,  378,  442,  285,  453,  383,
+      390,  382,  286,  384,  385,  387,  443,  292,  811,  294,
+      288,  289,  386,  296,  297,  297,  297,  299,  378,  379,
+      382,  297,  297,  297,  297,  297,  297,  383,  390,  387,
+      395,  407,  446,  430,  812,  408,  420,  431,  436,  437,
+      488,  421,  813,  814,  447,  297,  297,  297,  297,  297,
+      297,  393,  393,  393,  584,  454,  629,  817,  393,  393,
+      393,  393,  393,  393,  456,  461,  482,  487,  457,  488,
+      462,  483,  495,  564,  496,  580,  818,  487,  565,  585,
+      587,  584,  393,  393,  393,  393,  393,  393,  422,  667,
+
+      660,  736,  668,  423,  630,  487,  749,  819,  737,  495,
+      661,  496,   45,   45,   45,  498,  820,  585,  821,   45,
+       45,   45,   45,   45,   45,  640,  668,  667,  738,  788,
+      641,  741,  822,  789,  749,  739,  823,  742,  815,  824,
+      825,  826,  827,   45,   45,   45,   45,   45,   45,  828,
+      816,  829,  830,  831,  832,  833,  834,  835,  836,  837,
+      838,  839,  840,  841,  825,  842,  824,  843,  642,  844,
+      845,  846,  847,  848,  849,  850,  851,  854,  855,  856,
+      857,  852,  858,  859,  860,  861,  862,  863,  864,  865,
+      866,  867,  869,  870,  871,  872,  873,  874,  875,  876,
+
+      877,  878,  868,  879,  880,  881,  882,  883,  884,  885,
+      886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
+      897,  896,  898,  899,  900,  901,  902,  903,  904,  905,
+      906,  907,  908,  853,  909,  910,  911,  912,  913,  914,
+      915,  916,  917,  918,  919,  920,  921,  895,  896,  922,
+      924,  926,  927,  928,  923,  929,  930,  931,  932,  933,
+      934,  935,  936,  937,  938,  939,  940,  941,  942,  943,
+      944,  945,  946,  947,  948,  949,  950,  951,  952,  953,
+      954,  955,  956,  957,  958,  959,  960,  961,  962,  963,
+      964,  965,  966,  925,  967,  968,  969,  970,  971,  972,
+
+      973,  974,  975,  976,  977,  978,  979,  980,  981,  982,
+      983,  984,  985,  963,  986,  987,  988,  989,  964,  990,
+      991,  992,  993,  994,  995,  996,  997,  998,  999, 1000,
+     1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
+     1011, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+     1022, 1023, 1024, 1026, 1027, 1028, 1029, 1030, 1031, 1032,
+     1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042,
+     1043, 1044, 1045, 1046, 1047, 1048, 1020, 1050, 1051, 1052,
+     1053, 1054, 1055, 1049, 1056, 1057, 1058, 1059, 1060, 1061,
+     1062, 1063, 1012, 1064, 1065, 1025, 1066, 1067, 1068, 1069,
+
+     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+     1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089,
+     1090, 1091, 1092, 1069, 1093, 1094, 1095, 1096, 1097, 1098,
+     1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
+     1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
+     1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+     1129, 1130, 1131, 1105, 1132, 1133, 1134, 1135, 1136, 1137,
+     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1146, 1147, 1148,
+     1149, 1145, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157,
+     1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1139,
+
+     1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+     1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
+     1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
+     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
+     1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
+     1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
+     1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+     1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+     1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256,
+     1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266,
+
+     1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+     1277, 1278, 1279, 1280,   12,   12,   12,   12,   12,   36,
+       36,   36,   36,   36,   78,  284,   78,   78,   78,   97,
+      381,   97,  486,   97,   99,   99,   99,   99,   99,  115,
+      115,  115,  115,  115,  171,   99,  171,  171,  171,  195,
+      195,  195,  803,  802,  801,  800,  799,  798,  797,  796,
+      795,  794,  793,  792,  791,  790,  787,  786,  785,  784,
+      783,  782,  781,  780,  779,  778,  777,  776,  775,  774,
+      773,  772,  771,  770,  769,  768,  767,  766,  765,  764,
+      763,  762,  761,  760,  759,  758,  757,  756,  755,  754,
+
+      753,  752,  751,  750,  748,  747,  746,  745,  744,  743,
+      740,  735,  734,  733,  732,  731,  730,  729,  728,  727,
+      726,  725,  724,  723,  722,  721,  720,  719,  718,  717,
+      716,  715,  714,  713,  712,  711,  710,  709,  708,  707,
+      706,  705,  704,  703,  702,  701,  700,  699,  698,  697,
+      696,  695,  694,  693,  692,  691,  690,  689,  688,  687,
+      686,  685,  684,  683,  682,  681,  680,  679,  678,  677,
+      676,  675,  674,  673,  672,  671,  670,  669,  666,  665,
+      664,  663,  662,  659,  658,  657,  656,  655,  654,  653,
+      652,  651,  650,  649,  648,  647,  646,  645,  644,  643,
+
+      639,  638,  637,  636,  635,  634,  633,  632,  631,  628,
+      627,  626,  625,  624,  623,  622,  621,  620,  619,  618,
+      617,  616,  615,  614,  613,  612,  611,  610,  609,  608,
+      607,  606,  605,  604,  603,  602,  601,  600,  599,  598,
+      597,  596,  595,  594,  593,  592,  591,  590,  589,  588,
+      586,  583,  582,  581,  580,  579,  578,  577,  576,  575,
+      574,  573,  572,  571,  570,  569,  568,  567,  566,  563,
+      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
+      552,  551,  550,  549,  548,  547,  546,  545,  544,  543,
+      542,  541,  540,  539,  538,  537,  536,  535,  534,  533,
+
+      532,  531,  530,  529,  528,  525,  524,  523,  522,  521,
+      520,  519,  518,  517,  516,  515,  514,  513,  512,  511,
+      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
+      500,  499,  497,  494,  493,  492,  491,  490,  489,  485,
+      484,  481,  480,  479,  478,  477,  476,  475,  474,  473,
+      472,  471,  470,  469,  468,  467,  466,  465,  464,  463,
+      460,  459,  458,  455,  452,  451,  450,  449,  448,  445,
+      444,  441,  440,  439,  438,  435,  434,  433,  432,  429,
+      428,  427,  426,  425,  424,  419,  418,  417,  416,  415,
+      414,  413,  412,  411,  410,  409,  406,  405,  404,  403,
+
+      402,  401,  400,  399,  398,  397,  396,  394,  392,  391,
+      389,  388,  380,  377,  376,  375,  374,  373,  372,  371,
+      370,  369,  368,  367,  366,  365,  364,  363,  362,  361,
+      358,  357,  356,  355,  354,  353,  352,  351,  350,  349,
       348,  347,  346,  345,  344,  343,  342,  341,  340,  339,
-      336,  335,  334,  333,  332,  331,  330,  329,  328,  327,
-      326,  325,  324,  323,  322,  321,  320,  319,  318,  317,
-      316,  315,  314,  313,  312,  311,  310,  309,  308,  307,
-      306,  305,  304,  303,  302,  301,  300,  299,  298,  297,
-      296,  295,  294,  293,  292,  291,  290,  287,  286,  285,
-      283,  190,  280,  278,  276,  275,  272,  269,  262,  261,
-      260,  259,  258,  257,  256,  255,  254,  243,  242,  241,
-
-      238,  237,  234,  233,  232,  231,  230,  229,  228,  225,
-      224,  223,  222,  221,  220,  217,  216,  212,  211,  205,
-      204,  200,  199,  198,  195,  194,  190,  183,  178,  177,
-      174,  173,  165,  153,  129,  103,  102,   43,   97,   95,
-       94,   85,   43, 1180,   11, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180
+      338,  337,  336,  335,  334,  333,  332,  331,  330,  329,
+      328,  327,  326,  325,  324,  323,  322,  321,  320,  319,
+      318,  317,  316,  315,  314,  313,  312,  311,  310,  309,
+      308,  307,  306,  303,  302,  301,  300,  298,  196,  295,
+      293,  291,  290,  287,  283,  276,  275,  274,  273,  272,
+
+      271,  270,  269,  268,  264,  252,  249,  248,  244,  243,
+      242,  241,  240,  239,  233,  232,  231,  230,  229,  228,
+      225,  224,  220,  219,  218,  212,  211,  207,  206,  205,
+      202,  201,  200,  196,  189,  184,  183,  179,  178,  170,
+      157,  133,  105,  104,   43,   98,   96,   95,   86,   43,
+     1281,   11, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281
     } ;
 
-static const flex_int16_t yy_chk[1617] =
+static const flex_int16_t yy_chk[1725] =
     {   0,
         0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,   21,    0,
-        3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       56,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,    0,    8,
-        8,    8,    1,    8,   56,   27,   28,  330,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   51,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   50,   10,   53,   31,    2,    2,   51,
-       61,   65,   25,  330,   25,  717,    2,   25,   25,   25,
-       61,   65,    2,   65,  246,   20,   50,  246,   53,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        3,    3,    3,   21,    1,    1,    3,    4,    4,    4,
+        1,   44,   13,    4,   13,    1,    0,    7,    7,    7,
+        1,    7,    1,    5,    5,    5,   73,    0,    1,    1,
+       73,    6,    6,    6,    8,    8,    8,    1,    8,  727,
+        9,    9,    9,    1,   20,   20,   20,   44,   26,   27,
+        1,    1,    2,    2,    2,   20,    2,    2,    9,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,   10,
+       10,   10,   26,   28,    5,    2,    2,   27,   25,   20,
+
+       25,    2,    6,   25,   25,   25,    2,   10,   31,   32,
+       33,    2,   37,    2,   37,   42,   51,   42,  145,    2,
+        2,   28,   60,   62,  145,   60,  155,   60,    2,   60,
+      155,   65,   31,   62,    2,  728,   65,   32,   33,   65,
+       51,    2,    2,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1189,161 +1235,173 @@ static const flex_int16_t yy_chk[1617] =
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   47,   17,   17,   17,   19,   52,   19,
-       19,   19,   44,   55,   22,   17,   22,   22,   22,   59,
-       19,   60,   59,   54,   59,   60,   59,   22,   60,   47,
-       62,   58,   98,   54,   64,  718,   55,   52,   17,   64,
-       72,   60,   64,   19,   72,   88,   54,   44,   67,   89,
-       22,   45,   67,   62,   45,   45,   45,   58,   45,   45,
-       45,   54,   57,   58,   62,   45,   45,   98,   45,   57,
-      719,   88,   67,  105,   45,   89,   45,   45,   45,   45,
-       45,   45,   45,   45,   90,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   57,   66,   66,
-      105,   57,   66,   68,   69,   57,   75,  112,   66,   69,
-       69,   70,   90,   57,   70,   70,  106,   57,  721,   57,
-       57,   73,   68,   74,   68,   70,   68,  109,   70,   75,
-      112,   73,   73,   74,   86,   86,   86,   73,  724,   75,
-       78,   78,   78,  197,   75,  106,   74,   91,   74,  197,
-       93,   78,   74,   79,  109,   79,   79,   79,   80,   92,
-       80,   74,  101,   80,   80,   80,   79,   81,   74,   81,
-       81,   81,  100,   91,   78,   82,   82,   82,   93,  100,
-       81,   87,   87,   87,  104,   92,   82,  111,  108,   79,
-
-      101,  110,  119,  127,  123,  123,  116,  151,  126,  140,
-      126,  151,  119,   81,  123,  130,  127,  100,  130,   82,
-      104,  100,  130,  116,  111,  100,  108,  126,  133,  110,
-      140,  148,  148,  100,  116,  167,  720,  100,  169,  100,
-      100,  115,  115,  115,  155,  155,  155,  720,  115,  115,
-      115,  115,  115,  115,  168,  155,  156,  155,  170,  155,
-      156,  169,  155,  167,  156,  171,  172,  176,  179,  184,
-      133,  115,  115,  115,  115,  115,  115,  180,  186,  188,
-      168,  725,  193,  271,  272,  272,  170,  263,  266,  172,
-      176,  171,  184,  272,  277,  284,  179,  273,  296,  318,
-
-      318,  186,  296,  322,  180,  193,  188,  191,  191,  191,
-      263,  266,  271,  322,  191,  191,  191,  191,  191,  191,
-      273,  332,  277,  648,  284,  332,  353,  648,  307,  359,
-      371,  353,  368,  307,  368,  459,  460,  191,  191,  191,
-      191,  191,  191,  282,  282,  282,  502,  726,  728,  598,
-      282,  282,  282,  282,  282,  282,  598,  359,  371,  368,
-      433,  368,  459,  462,  460,  433,  511,  537,  462,  729,
-      528,  511,  536,  282,  282,  282,  282,  282,  282,  307,
-      528,  599,  610,  502,  307,  369,  369,  369,  599,  671,
-      537,  682,  369,  369,  369,  369,  369,  369,  601,  681,
-
-      536,  671,  708,  731,  601,  732,  733,  708,  511,  734,
-      610,  735,  736,  737,  682,  369,  369,  369,  369,  369,
-      369,  738,  739,  740,  741,  742,  681,  744,  745,  746,
-      747,  748,  749,  751,  750,  752,  753,  754,  755,  756,
-      757,  758,  759,  761,  762,  763,  764,  765,  766,  767,
-      768,  769,  770,  771,  772,  773,  774,  776,  708,  777,
-      749,  750,  778,  779,  777,  780,  781,  782,  783,  784,
-      785,  786,  787,  788,  789,  790,  791,  792,  793,  794,
-      795,  796,  797,  798,  799,  800,  801,  802,  803,  805,
-      808,  809,  810,  811,  812,  813,  814,  815,  816,  817,
-
-      818,  819,  820,  823,  778,  824,  825,  826,  827,  828,
-      829,  830,  831,  832,  833,  834,  835,  836,  839,  814,
-      841,  843,  844,  845,  846,  815,  847,  848,  850,  851,
-      853,  854,  855,  858,  860,  861,  862,  863,  864,  865,
-      866,  867,  868,  869,  870,  871,  872,  873,  874,  875,
-      876,  877,  878,  879,  880,  881,  882,  883,  884,  885,
-      886,  888,  889,  890,  891,  892,  893,  894,  895,  896,
-      897,  898,  899,  900,  901,  903,  904,  905,  876,  907,
-      908,  909,  910,  911,  904,  912,  913,  914,  915,  916,
-      918,  919,  920,  868,  925,  926,  880,  927,  928,  930,
-
-      931,  933,  934,  935,  936,  937,  939,  940,  941,  942,
-      943,  944,  945,  946,  947,  948,  950,  952,  954,  955,
-      956,  928,  958,  959,  960,  961,  962,  965,  967,  968,
-      969,  971,  973,  974,  975,  976,  977,  978,  979,  980,
-      982,  984,  985,  986,  987,  988,  989,  990,  991,  992,
-      993,  994,  995,  996,  997,  998,  999, 1000, 1001, 1002,
-      974, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1012,
-     1014, 1016, 1017, 1018, 1019, 1020, 1016, 1021, 1022, 1024,
-     1027, 1028, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
-     1038, 1040, 1041, 1042, 1008, 1044, 1046, 1047, 1048, 1049,
-
-     1050, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
-     1061, 1062, 1063, 1064, 1066, 1067, 1068, 1069, 1070, 1071,
-     1073, 1074, 1075, 1076, 1078, 1079, 1080, 1081, 1082, 1083,
-     1084, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
-     1096, 1097, 1098, 1099, 1101, 1102, 1103, 1104, 1105, 1106,
-     1107, 1108, 1109, 1110, 1111, 1112, 1114, 1117, 1118, 1119,
-     1120, 1123, 1125, 1126, 1128, 1129, 1130, 1131, 1133, 1134,
-     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
-     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1155,
-     1157, 1158, 1159, 1160, 1161, 1165, 1166, 1167, 1169, 1170,
-
-     1171, 1172, 1173, 1174, 1175, 1177, 1178, 1181, 1181, 1181,
-     1181, 1181, 1182, 1182, 1182, 1182, 1182, 1183, 1189, 1183,
-     1183, 1183, 1184, 1190, 1184, 1191, 1184, 1185, 1185, 1185,
-     1185, 1185, 1186, 1186, 1186, 1186, 1186, 1187, 1192, 1187,
-     1187, 1187, 1188, 1188, 1188,  716,  715,  714,  713,  712,
-      711,  710,  709,  707,  706,  705,  703,  702,  701,  700,
-      699,  698,  697,  696,  695,  694,  693,  692,  691,  690,
-      689,  688,  687,  686,  685,  684,  683,  679,  678,  677,
-      675,  674,  673,  672,  670,  669,  668,  667,  666,  665,
-      664,  663,  662,  661,  660,  659,  658,  657,  656,  655,
-
-      653,  652,  651,  650,  649,  647,  646,  644,  643,  642,
-      639,  638,  637,  636,  635,  634,  633,  632,  631,  630,
-      629,  628,  627,  626,  625,  624,  623,  622,  621,  620,
-      619,  618,  617,  616,  615,  614,  613,  612,  611,  609,
-      607,  606,  605,  604,  603,  600,  597,  596,  595,  594,
-      593,  592,  591,  590,  589,  588,  587,  586,  584,  583,
-      582,  581,  580,  579,  578,  577,  575,  574,  573,  572,
-      571,  570,  569,  568,  567,  566,  565,  564,  563,  562,
-      561,  560,  559,  558,  557,  556,  555,  554,  553,  552,
-      551,  550,  549,  548,  547,  546,  545,  544,  543,  542,
-
-      541,  540,  539,  538,  535,  534,  531,  530,  529,  526,
-      525,  524,  523,  522,  521,  520,  519,  517,  516,  515,
-      514,  513,  512,  510,  509,  507,  506,  505,  504,  503,
-      501,  500,  499,  497,  496,  495,  494,  493,  492,  491,
-      490,  489,  488,  487,  486,  484,  483,  482,  481,  480,
-      479,  478,  477,  476,  475,  474,  473,  472,  471,  470,
-      469,  468,  467,  466,  465,  464,  461,  457,  455,  452,
-      450,  449,  448,  446,  442,  441,  440,  439,  438,  437,
-      436,  435,  434,  432,  431,  430,  429,  428,  427,  426,
-      425,  424,  423,  421,  420,  419,  418,  417,  416,  415,
-
-      414,  413,  411,  410,  409,  408,  407,  406,  405,  404,
-      403,  402,  401,  400,  399,  398,  397,  396,  395,  393,
-      392,  391,  390,  389,  388,  387,  386,  385,  383,  382,
-      381,  380,  379,  377,  376,  375,  373,  372,  370,  366,
-      365,  363,  362,  361,  360,  357,  354,  352,  351,  350,
-      349,  348,  347,  346,  345,  344,  343,  342,  341,  340,
-      339,  338,  337,  336,  335,  334,  333,  331,  329,  328,
-      327,  326,  325,  324,  323,  321,  320,  319,  317,  316,
-      315,  314,  313,  312,  311,  310,  309,  308,  306,  305,
-      304,  303,  302,  301,  300,  299,  298,  297,  295,  294,
-
-      293,  292,  291,  289,  288,  287,  286,  285,  283,  281,
-      279,  276,  274,  269,  262,  261,  260,  259,  258,  257,
-      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
-      245,  244,  243,  242,  241,  240,  239,  238,  237,  236,
-      235,  234,  233,  232,  231,  230,  229,  228,  227,  226,
-      225,  224,  223,  222,  221,  220,  219,  217,  216,  215,
-      214,  213,  212,  211,  210,  209,  208,  207,  206,  205,
-      204,  203,  202,  201,  200,  199,  198,  196,  195,  194,
-      192,  189,  187,  185,  183,  182,  177,  173,  165,  164,
-      163,  162,  161,  160,  159,  158,  157,  154,  153,  152,
-
-      150,  149,  147,  146,  145,  144,  143,  142,  141,  139,
-      138,  137,  136,  135,  134,  132,  131,  129,  128,  125,
-      124,  122,  121,  120,  118,  117,  113,  107,  103,  102,
-       96,   95,   76,   71,   63,   49,   48,   43,   41,   39,
-       38,   24,   14,   11, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-
-     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
-     1180, 1180, 1180, 1180, 1180, 1180
+       15,   15,   15,   15,   15,   17,   47,   17,   17,   17,
+       19,   48,   19,   19,   19,   52,   53,   22,   17,   22,
+       22,   22,   54,   19,   56,   57,   89,   55,  427,   66,
+       22,   90,   47,   61,   91,   92,   48,   61,   55,   66,
+       61,   66,   17,   52,  427,   53,   54,   19,   56,   93,
+       57,   55,   89,   61,   22,   45,   45,   90,   45,   45,
+       45,   92,   91,   45,   45,   45,   55,   58,   67,   67,
+       45,   45,   67,   45,   58,   93,   59,   94,   67,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   63,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   59,   58,   99,   94,   68,   58,   59,   59,
+       68,   58,   69,   63,   87,   87,   87,   76,  103,   58,
+       75,   63,   70,   58,   63,   58,   58,   70,   70,  102,
+       68,   75,   69,   74,   69,   71,   69,   74,   71,   71,
+       99,   76,  130,  729,   75,  103,   75,   74,   74,   71,
+       75,   76,   71,   74,  730,  130,   76,  102,  106,   75,
+       79,   79,   79,  108,  107,   80,   75,   80,   80,   80,
+       81,   79,   81,  101,  111,   81,   81,   81,   80,   82,
+      101,   82,   82,   82,  106,   83,   83,   83,   88,   88,
+
+       88,  107,   82,  108,  110,   79,   83,  113,  112,  114,
+      134,  111,   80,  134,  122,  126,  126,  134,  137,  101,
+      118,  172,  204,  101,  122,  126,   82,  101,  204,  731,
+       83,  732,  110,  114,  113,  101,  112,  118,  129,  101,
+      129,  101,  101,  117,  117,  117,  144,  152,  118,  172,
+      117,  117,  117,  117,  117,  117,  157,  129,  175,  144,
+      157,  137,  152,  152,  158,  173,  174,  144,  158,  159,
+      159,  159,  176,  177,  117,  117,  117,  117,  117,  117,
+      159,  161,  159,  181,  159,  161,  175,  159,  182,  161,
+      174,  173,  185,  190,  186,  192,  194,  177,  176,  259,
+
+      733,  285,  259,  199,  277,  280,  341,  181,  350,  286,
+      292,  299,  182,  287,  287,  288,  341,  190,  734,  192,
+      185,  186,  287,  194,  197,  197,  197,  199,  277,  280,
+      285,  197,  197,  197,  197,  197,  197,  286,  292,  288,
+      299,  312,  344,  331,  735,  312,  324,  331,  336,  336,
+      383,  324,  736,  737,  344,  197,  197,  197,  197,  197,
+      197,  297,  297,  297,  495,  350,  544,  739,  297,  297,
+      297,  297,  297,  297,  352,  356,  376,  382,  352,  383,
+      356,  376,  392,  467,  392,  498,  740,  395,  467,  496,
+      498,  495,  297,  297,  297,  297,  297,  297,  324,  584,
+
+      575,  656,  585,  324,  544,  382,  668,  741,  656,  392,
+      575,  392,  393,  393,  393,  395,  742,  496,  744,  393,
+      393,  393,  393,  393,  393,  555,  585,  584,  657,  711,
+      555,  659,  745,  711,  668,  657,  746,  659,  738,  748,
+      749,  750,  751,  393,  393,  393,  393,  393,  393,  752,
+      738,  753,  754,  755,  756,  757,  758,  759,  760,  761,
+      762,  763,  764,  765,  749,  766,  748,  767,  555,  768,
+      769,  770,  771,  773,  774,  775,  776,  778,  779,  780,
+      782,  776,  783,  784,  785,  786,  787,  788,  789,  790,
+      791,  792,  793,  794,  797,  798,  799,  801,  802,  803,
+
+      804,  806,  792,  807,  808,  809,  810,  811,  812,  813,
+      814,  815,  816,  817,  819,  820,  821,  822,  823,  824,
+      826,  825,  827,  828,  829,  830,  831,  832,  833,  834,
+      836,  837,  838,  776,  839,  840,  841,  842,  843,  844,
+      845,  846,  847,  848,  849,  850,  852,  824,  825,  853,
+      854,  855,  856,  857,  853,  858,  859,  860,  861,  862,
+      863,  864,  865,  866,  867,  868,  869,  870,  871,  872,
+      873,  874,  875,  876,  877,  878,  879,  880,  881,  882,
+      883,  884,  886,  889,  890,  891,  892,  893,  894,  895,
+      896,  897,  898,  854,  899,  900,  901,  904,  905,  906,
+
+      907,  908,  909,  910,  911,  912,  913,  914,  915,  916,
+      917,  918,  921,  895,  923,  925,  926,  927,  896,  928,
+      929,  930,  931,  933,  934,  936,  937,  938,  939,  940,
+      943,  945,  947,  948,  949,  950,  951,  952,  953,  954,
+      955,  956,  957,  958,  959,  960,  961,  962,  963,  964,
+      965,  966,  967,  968,  969,  970,  971,  972,  973,  975,
+      976,  977,  979,  980,  981,  982,  983,  984,  985,  986,
+      987,  988,  989,  991,  992,  993,  963,  994,  996,  997,
+      998,  999, 1000,  993, 1001, 1002, 1003, 1005, 1006, 1007,
+     1008, 1010,  955, 1011, 1012,  967, 1017, 1018, 1019, 1020,
+
+     1022, 1023, 1025, 1026, 1027, 1028, 1029, 1031, 1032, 1033,
+     1034, 1035, 1036, 1037, 1038, 1039, 1040, 1042, 1044, 1047,
+     1048, 1049, 1051, 1020, 1052, 1053, 1054, 1055, 1056, 1057,
+     1060, 1062, 1063, 1064, 1066, 1068, 1069, 1070, 1071, 1072,
+     1073, 1074, 1075, 1077, 1079, 1080, 1081, 1082, 1083, 1084,
+     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
+     1095, 1096, 1097, 1069, 1098, 1099, 1100, 1101, 1102, 1103,
+     1104, 1105, 1106, 1107, 1109, 1111, 1113, 1114, 1115, 1116,
+     1117, 1113, 1118, 1119, 1121, 1124, 1125, 1127, 1128, 1129,
+     1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1139, 1105,
+
+     1140, 1141, 1143, 1145, 1146, 1147, 1148, 1149, 1151, 1152,
+     1153, 1154, 1156, 1157, 1159, 1160, 1161, 1162, 1163, 1164,
+     1165, 1167, 1168, 1169, 1170, 1171, 1172, 1174, 1175, 1176,
+     1177, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1187, 1188,
+     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1197, 1198, 1199,
+     1200, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
+     1211, 1212, 1213, 1215, 1218, 1219, 1220, 1221, 1224, 1226,
+     1227, 1229, 1230, 1231, 1232, 1234, 1235, 1236, 1237, 1238,
+     1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248,
+     1249, 1250, 1251, 1252, 1253, 1254, 1256, 1258, 1259, 1260,
+
+     1261, 1262, 1266, 1267, 1268, 1270, 1271, 1272, 1273, 1274,
+     1275, 1276, 1278, 1279, 1282, 1282, 1282, 1282, 1282, 1283,
+     1283, 1283, 1283, 1283, 1284, 1290, 1284, 1284, 1284, 1285,
+     1291, 1285, 1292, 1285, 1286, 1286, 1286, 1286, 1286, 1287,
+     1287, 1287, 1287, 1287, 1288, 1293, 1288, 1288, 1288, 1289,
+     1289, 1289,  726,  725,  724,  723,  722,  721,  720,  718,
+      717,  716,  715,  714,  713,  712,  710,  709,  706,  705,
+      704,  703,  700,  699,  698,  697,  696,  695,  694,  693,
+      692,  691,  690,  689,  688,  687,  686,  685,  684,  683,
+      682,  681,  680,  679,  678,  677,  676,  675,  674,  673,
+
+      672,  671,  670,  669,  667,  665,  664,  663,  662,  661,
+      658,  654,  653,  652,  651,  650,  649,  648,  647,  646,
+      645,  644,  643,  642,  641,  639,  638,  637,  636,  635,
+      634,  633,  632,  631,  630,  628,  627,  626,  625,  624,
+      623,  622,  621,  620,  619,  618,  617,  616,  615,  614,
+      613,  612,  611,  610,  609,  608,  607,  606,  605,  604,
+      603,  602,  601,  600,  599,  598,  597,  596,  595,  594,
+      593,  592,  591,  590,  589,  588,  587,  586,  583,  582,
+      578,  577,  576,  573,  572,  571,  570,  569,  568,  567,
+      566,  565,  563,  562,  561,  560,  559,  558,  557,  556,
+
+      554,  553,  551,  550,  549,  548,  547,  546,  545,  543,
+      542,  541,  539,  538,  537,  536,  535,  534,  533,  532,
+      531,  530,  529,  528,  527,  526,  525,  524,  522,  521,
+      520,  519,  518,  517,  516,  515,  514,  513,  512,  511,
+      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
+      497,  493,  491,  488,  487,  485,  484,  483,  481,  477,
+      476,  475,  474,  473,  472,  471,  470,  469,  468,  466,
+      465,  464,  463,  462,  460,  459,  458,  457,  456,  455,
+      454,  452,  451,  450,  449,  448,  447,  446,  445,  444,
+      443,  442,  440,  439,  438,  437,  436,  435,  434,  433,
+
+      432,  431,  430,  429,  428,  426,  425,  424,  423,  422,
+      421,  419,  418,  417,  416,  415,  414,  413,  412,  411,
+      410,  408,  407,  406,  405,  404,  402,  401,  400,  398,
+      397,  396,  394,  390,  389,  387,  386,  385,  384,  380,
+      377,  375,  374,  373,  372,  371,  370,  369,  368,  367,
+      366,  365,  364,  363,  362,  361,  360,  359,  358,  357,
+      355,  354,  353,  351,  349,  348,  347,  346,  345,  343,
+      342,  340,  339,  338,  337,  335,  334,  333,  332,  330,
+      329,  328,  327,  326,  325,  323,  322,  321,  320,  319,
+      318,  317,  316,  315,  314,  313,  311,  310,  309,  308,
+
+      307,  305,  304,  303,  302,  301,  300,  298,  296,  294,
+      291,  289,  283,  276,  275,  274,  273,  272,  271,  270,
+      269,  268,  267,  266,  265,  264,  263,  262,  261,  260,
+      258,  257,  256,  255,  254,  253,  252,  251,  250,  249,
+      248,  247,  246,  245,  244,  243,  242,  241,  240,  239,
+      238,  237,  236,  235,  234,  233,  232,  231,  230,  229,
+      228,  227,  225,  224,  223,  222,  221,  220,  219,  218,
+      217,  216,  215,  214,  213,  212,  211,  210,  209,  208,
+      207,  206,  205,  203,  202,  201,  200,  198,  195,  193,
+      191,  189,  188,  183,  178,  170,  169,  168,  167,  166,
+
+      165,  164,  163,  162,  160,  156,  154,  153,  151,  150,
+      149,  148,  147,  146,  143,  142,  141,  140,  139,  138,
+      136,  135,  133,  132,  131,  128,  127,  125,  124,  123,
+      121,  120,  119,  115,  109,  105,  104,   97,   96,   77,
+       72,   64,   50,   49,   43,   41,   39,   38,   24,   14,
+       11, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1281, 1281, 1281, 1281
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1352,24 +1410,25 @@ static char *yy_last_accepting_cpos;
 extern int parser6__flex_debug;
 int parser6__flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[147] =
+static const flex_int16_t yy_rule_linenum[160] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  195,  204,  213,  222,  231,  240,  249,
       258,  267,  276,  285,  294,  303,  312,  322,  332,  342,
-      352,  362,  372,  382,  392,  402,  411,  420,  429,  438,
-      447,  456,  468,  477,  486,  495,  504,  514,  524,  534,
-      545,  555,  565,  575,  585,  595,  605,  614,  623,  632,
-      647,  662,  671,  680,  689,  698,  707,  716,  725,  734,
-      743,  753,  762,  771,  780,  789,  798,  807,  817,  826,
-      835,  844,  853,  862,  871,  880,  889,  898,  908,  918,
-      928,  937,  946,  955,  966,  976,  985,  995, 1004, 1013,
-
-     1022, 1031, 1040, 1049, 1059, 1068, 1077, 1086, 1095, 1104,
-     1113, 1122, 1131, 1140, 1149, 1158, 1167, 1176, 1185, 1194,
-     1203, 1212, 1221, 1230, 1239, 1248, 1257, 1266, 1275, 1373,
-     1378, 1383, 1388, 1389, 1390, 1391, 1392, 1393, 1395, 1413,
-     1426, 1431, 1435, 1437, 1439, 1441
+      352,  362,  372,  382,  392,  402,  412,  421,  430,  439,
+      448,  457,  466,  478,  487,  496,  505,  514,  524,  534,
+      544,  555,  565,  575,  585,  595,  605,  615,  625,  635,
+      645,  654,  663,  672,  687,  702,  711,  720,  729,  738,
+      747,  756,  765,  774,  783,  793,  802,  811,  820,  829,
+      838,  847,  857,  866,  875,  884,  893,  902,  911,  920,
+      929,  938,  947,  956,  965,  974,  983,  992, 1001, 1010,
+
+     1020, 1030, 1040, 1049, 1058, 1067, 1078, 1088, 1097, 1107,
+     1116, 1125, 1134, 1143, 1152, 1161, 1171, 1180, 1189, 1198,
+     1207, 1216, 1225, 1234, 1243, 1252, 1261, 1270, 1279, 1288,
+     1297, 1306, 1315, 1324, 1333, 1342, 1351, 1360, 1369, 1378,
+     1387, 1396, 1494, 1499, 1504, 1509, 1510, 1511, 1512, 1513,
+     1514, 1516, 1534, 1547, 1552, 1556, 1558, 1560, 1562
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1414,7 +1473,7 @@ unsigned int comment_start_line = 0;
 
 // To avoid the call to exit... oops!
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1417 "dhcp6_lexer.cc"
+#line 1476 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1440,8 +1499,8 @@ unsigned int comment_start_line = 0;
 // by moving it ahead by yyleng bytes. yyleng specifies the length of the
 // currently matched token.
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1443 "dhcp6_lexer.cc"
-#line 1444 "dhcp6_lexer.cc"
+#line 1502 "dhcp6_lexer.cc"
+#line 1503 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1765,7 +1824,7 @@ YY_DECL
     }
 
 
-#line 1768 "dhcp6_lexer.cc"
+#line 1827 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1794,13 +1853,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1181 )
+				if ( yy_current_state >= 1282 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1180 );
+		while ( yy_current_state != 1281 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1819,13 +1878,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 147 )
+			else if ( yy_act < 160 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], parser6_text );
-			else if ( yy_act == 147 )
+			else if ( yy_act == 160 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         parser6_text );
-			else if ( yy_act == 148 )
+			else if ( yy_act == 161 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2153,8 +2212,8 @@ YY_RULE_SETUP
 #line 342 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
+    if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp6Parser::make_BINARY(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2180,7 +2239,7 @@ YY_RULE_SETUP
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_NEVER(driver.loc_);
+        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2206,7 +2265,7 @@ YY_RULE_SETUP
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_ALWAYS(driver.loc_);
+        return isc::dhcp::Dhcp6Parser::make_NEVER(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2219,7 +2278,7 @@ YY_RULE_SETUP
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_WHEN_NOT_PRESENT(driver.loc_);
+        return isc::dhcp::Dhcp6Parser::make_ALWAYS(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2229,6 +2288,19 @@ YY_RULE_SETUP
 case 36:
 YY_RULE_SETUP
 #line 402 "dhcp6_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
+        return isc::dhcp::Dhcp6Parser::make_WHEN_NOT_PRESENT(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 412 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2238,9 +2310,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 411 "dhcp6_lexer.ll"
+#line 421 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2250,9 +2322,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 420 "dhcp6_lexer.ll"
+#line 430 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2262,9 +2334,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 429 "dhcp6_lexer.ll"
+#line 439 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2274,9 +2346,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 438 "dhcp6_lexer.ll"
+#line 448 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2286,9 +2358,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 447 "dhcp6_lexer.ll"
+#line 457 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOSTS_DATABASE:
@@ -2298,9 +2370,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 456 "dhcp6_lexer.ll"
+#line 466 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2313,9 +2385,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 468 "dhcp6_lexer.ll"
+#line 478 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2325,9 +2397,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 477 "dhcp6_lexer.ll"
+#line 487 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2337,9 +2409,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 486 "dhcp6_lexer.ll"
+#line 496 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2349,9 +2421,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 495 "dhcp6_lexer.ll"
+#line 505 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2361,9 +2433,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 504 "dhcp6_lexer.ll"
+#line 514 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2374,9 +2446,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 514 "dhcp6_lexer.ll"
+#line 524 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2387,9 +2459,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 524 "dhcp6_lexer.ll"
+#line 534 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2400,9 +2472,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 534 "dhcp6_lexer.ll"
+#line 544 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2414,9 +2486,48 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 52:
+YY_RULE_SETUP
+#line 555 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_MAPPED_STORE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("mapped-store", driver.loc_);
+    }
+}
+	YY_BREAK
+case 53:
 YY_RULE_SETUP
-#line 545 "dhcp6_lexer.ll"
+#line 565 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_FILE_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("file-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 575 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+#line 585 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2427,9 +2538,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 555 "dhcp6_lexer.ll"
+#line 595 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2440,9 +2551,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 565 "dhcp6_lexer.ll"
+#line 605 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2453,9 +2564,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 575 "dhcp6_lexer.ll"
+#line 615 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2466,9 +2577,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 585 "dhcp6_lexer.ll"
+#line 625 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2479,9 +2590,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 595 "dhcp6_lexer.ll"
+#line 635 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2492,9 +2603,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 605 "dhcp6_lexer.ll"
+#line 645 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2504,9 +2615,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 614 "dhcp6_lexer.ll"
+#line 654 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2516,9 +2627,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 63:
 YY_RULE_SETUP
-#line 623 "dhcp6_lexer.ll"
+#line 663 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2528,9 +2639,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 64:
 YY_RULE_SETUP
-#line 632 "dhcp6_lexer.ll"
+#line 672 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2546,9 +2657,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 65:
 YY_RULE_SETUP
-#line 647 "dhcp6_lexer.ll"
+#line 687 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2564,9 +2675,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 66:
 YY_RULE_SETUP
-#line 662 "dhcp6_lexer.ll"
+#line 702 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -2576,9 +2687,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 67:
 YY_RULE_SETUP
-#line 671 "dhcp6_lexer.ll"
+#line 711 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2588,9 +2699,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 68:
 YY_RULE_SETUP
-#line 680 "dhcp6_lexer.ll"
+#line 720 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2600,9 +2711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 69:
 YY_RULE_SETUP
-#line 689 "dhcp6_lexer.ll"
+#line 729 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2612,9 +2723,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 70:
 YY_RULE_SETUP
-#line 698 "dhcp6_lexer.ll"
+#line 738 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2624,9 +2735,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 71:
 YY_RULE_SETUP
-#line 707 "dhcp6_lexer.ll"
+#line 747 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2636,9 +2747,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 72:
 YY_RULE_SETUP
-#line 716 "dhcp6_lexer.ll"
+#line 756 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2648,9 +2759,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 73:
 YY_RULE_SETUP
-#line 725 "dhcp6_lexer.ll"
+#line 765 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2660,9 +2771,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 74:
 YY_RULE_SETUP
-#line 734 "dhcp6_lexer.ll"
+#line 774 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2672,9 +2783,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 75:
 YY_RULE_SETUP
-#line 743 "dhcp6_lexer.ll"
+#line 783 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2685,9 +2796,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 76:
 YY_RULE_SETUP
-#line 753 "dhcp6_lexer.ll"
+#line 793 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2697,9 +2808,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 77:
 YY_RULE_SETUP
-#line 762 "dhcp6_lexer.ll"
+#line 802 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2709,9 +2820,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 78:
 YY_RULE_SETUP
-#line 771 "dhcp6_lexer.ll"
+#line 811 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2721,9 +2832,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 79:
 YY_RULE_SETUP
-#line 780 "dhcp6_lexer.ll"
+#line 820 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2733,9 +2844,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 80:
 YY_RULE_SETUP
-#line 789 "dhcp6_lexer.ll"
+#line 829 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2745,9 +2856,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 81:
 YY_RULE_SETUP
-#line 798 "dhcp6_lexer.ll"
+#line 838 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2757,9 +2868,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 82:
 YY_RULE_SETUP
-#line 807 "dhcp6_lexer.ll"
+#line 847 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -2770,9 +2881,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 83:
 YY_RULE_SETUP
-#line 817 "dhcp6_lexer.ll"
+#line 857 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2782,9 +2893,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 84:
 YY_RULE_SETUP
-#line 826 "dhcp6_lexer.ll"
+#line 866 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2794,9 +2905,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 85:
 YY_RULE_SETUP
-#line 835 "dhcp6_lexer.ll"
+#line 875 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2806,9 +2917,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 86:
 YY_RULE_SETUP
-#line 844 "dhcp6_lexer.ll"
+#line 884 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2818,9 +2929,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 87:
+YY_RULE_SETUP
+#line 893 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGING:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 88:
 YY_RULE_SETUP
-#line 853 "dhcp6_lexer.ll"
+#line 902 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp6Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+#line 911 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp6Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 90:
+YY_RULE_SETUP
+#line 920 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGING:
@@ -2830,9 +2977,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 91:
 YY_RULE_SETUP
-#line 862 "dhcp6_lexer.ll"
+#line 929 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -2842,9 +2989,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 92:
 YY_RULE_SETUP
-#line 871 "dhcp6_lexer.ll"
+#line 938 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -2854,9 +3001,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 93:
 YY_RULE_SETUP
-#line 880 "dhcp6_lexer.ll"
+#line 947 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -2866,9 +3013,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 94:
 YY_RULE_SETUP
-#line 889 "dhcp6_lexer.ll"
+#line 956 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -2878,9 +3025,69 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 95:
+YY_RULE_SETUP
+#line 965 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGERS:
+        return isc::dhcp::Dhcp6Parser::make_RATE_LIMITS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate-limits", driver.loc_);
+    }
+}
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+#line 974 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_MESSAGE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("message", driver.loc_);
+    }
+}
+	YY_BREAK
+case 97:
 YY_RULE_SETUP
-#line 898 "dhcp6_lexer.ll"
+#line 983 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_SAMPLE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("sample", driver.loc_);
+    }
+}
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+#line 992 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate", driver.loc_);
+    }
+}
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+#line 1001 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 1010 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2891,9 +3098,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 101:
 YY_RULE_SETUP
-#line 908 "dhcp6_lexer.ll"
+#line 1020 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2904,9 +3111,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 102:
 YY_RULE_SETUP
-#line 918 "dhcp6_lexer.ll"
+#line 1030 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -2917,9 +3124,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 103:
 YY_RULE_SETUP
-#line 928 "dhcp6_lexer.ll"
+#line 1040 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2929,9 +3136,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 104:
 YY_RULE_SETUP
-#line 937 "dhcp6_lexer.ll"
+#line 1049 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -2941,9 +3148,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 105:
 YY_RULE_SETUP
-#line 946 "dhcp6_lexer.ll"
+#line 1058 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -2953,9 +3160,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 106:
 YY_RULE_SETUP
-#line 955 "dhcp6_lexer.ll"
+#line 1067 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -2967,9 +3174,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 107:
 YY_RULE_SETUP
-#line 966 "dhcp6_lexer.ll"
+#line 1078 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2980,9 +3187,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 108:
 YY_RULE_SETUP
-#line 976 "dhcp6_lexer.ll"
+#line 1088 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -2992,9 +3199,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 109:
 YY_RULE_SETUP
-#line 985 "dhcp6_lexer.ll"
+#line 1097 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3005,9 +3212,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 110:
 YY_RULE_SETUP
-#line 995 "dhcp6_lexer.ll"
+#line 1107 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3017,9 +3224,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 111:
 YY_RULE_SETUP
-#line 1004 "dhcp6_lexer.ll"
+#line 1116 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3029,9 +3236,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 112:
 YY_RULE_SETUP
-#line 1013 "dhcp6_lexer.ll"
+#line 1125 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3041,9 +3248,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 113:
 YY_RULE_SETUP
-#line 1022 "dhcp6_lexer.ll"
+#line 1134 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3053,9 +3260,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 114:
 YY_RULE_SETUP
-#line 1031 "dhcp6_lexer.ll"
+#line 1143 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3065,9 +3272,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 115:
 YY_RULE_SETUP
-#line 1040 "dhcp6_lexer.ll"
+#line 1152 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3077,9 +3284,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 116:
 YY_RULE_SETUP
-#line 1049 "dhcp6_lexer.ll"
+#line 1161 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3089,9 +3296,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 117:
 YY_RULE_SETUP
-#line 1059 "dhcp6_lexer.ll"
+#line 1171 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3101,9 +3308,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 118:
 YY_RULE_SETUP
-#line 1068 "dhcp6_lexer.ll"
+#line 1180 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3113,9 +3320,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 119:
 YY_RULE_SETUP
-#line 1077 "dhcp6_lexer.ll"
+#line 1189 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3125,9 +3332,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 120:
 YY_RULE_SETUP
-#line 1086 "dhcp6_lexer.ll"
+#line 1198 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3137,9 +3344,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 121:
 YY_RULE_SETUP
-#line 1095 "dhcp6_lexer.ll"
+#line 1207 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3149,9 +3356,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 122:
 YY_RULE_SETUP
-#line 1104 "dhcp6_lexer.ll"
+#line 1216 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3161,9 +3368,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 123:
 YY_RULE_SETUP
-#line 1113 "dhcp6_lexer.ll"
+#line 1225 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3173,9 +3380,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 124:
 YY_RULE_SETUP
-#line 1122 "dhcp6_lexer.ll"
+#line 1234 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3185,9 +3392,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 125:
 YY_RULE_SETUP
-#line 1131 "dhcp6_lexer.ll"
+#line 1243 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3197,9 +3404,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 126:
 YY_RULE_SETUP
-#line 1140 "dhcp6_lexer.ll"
+#line 1252 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3209,9 +3416,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 127:
 YY_RULE_SETUP
-#line 1149 "dhcp6_lexer.ll"
+#line 1261 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3221,9 +3428,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 128:
 YY_RULE_SETUP
-#line 1158 "dhcp6_lexer.ll"
+#line 1270 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3233,9 +3440,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 129:
 YY_RULE_SETUP
-#line 1167 "dhcp6_lexer.ll"
+#line 1279 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3245,9 +3452,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 130:
 YY_RULE_SETUP
-#line 1176 "dhcp6_lexer.ll"
+#line 1288 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3257,9 +3464,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 131:
 YY_RULE_SETUP
-#line 1185 "dhcp6_lexer.ll"
+#line 1297 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3269,9 +3476,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 132:
 YY_RULE_SETUP
-#line 1194 "dhcp6_lexer.ll"
+#line 1306 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3281,9 +3488,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 133:
 YY_RULE_SETUP
-#line 1203 "dhcp6_lexer.ll"
+#line 1315 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3293,9 +3500,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 134:
 YY_RULE_SETUP
-#line 1212 "dhcp6_lexer.ll"
+#line 1324 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3305,9 +3512,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 135:
+YY_RULE_SETUP
+#line 1333 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_PACKET_TIMELINE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("packet-timeline", driver.loc_);
+    }
+}
+	YY_BREAK
+case 136:
 YY_RULE_SETUP
-#line 1221 "dhcp6_lexer.ll"
+#line 1342 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3317,9 +3536,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 137:
 YY_RULE_SETUP
-#line 1230 "dhcp6_lexer.ll"
+#line 1351 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3329,9 +3548,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 138:
 YY_RULE_SETUP
-#line 1239 "dhcp6_lexer.ll"
+#line 1360 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3341,9 +3560,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 139:
 YY_RULE_SETUP
-#line 1248 "dhcp6_lexer.ll"
+#line 1369 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3353,9 +3572,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 140:
 YY_RULE_SETUP
-#line 1257 "dhcp6_lexer.ll"
+#line 1378 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3365,9 +3584,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 141:
 YY_RULE_SETUP
-#line 1266 "dhcp6_lexer.ll"
+#line 1387 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3377,9 +3596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 142:
 YY_RULE_SETUP
-#line 1275 "dhcp6_lexer.ll"
+#line 1396 "dhcp6_lexer.ll"
 {
     // A string has been matched. It contains the actual string and single quotes.
     // We need to get those quotes out of the way and just use its content, e.g.
@@ -3478,65 +3697,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 130:
-/* rule 130 can match eol */
+case 143:
+/* rule 143 can match eol */
 YY_RULE_SETUP
-#line 1373 "dhcp6_lexer.ll"
+#line 1494 "dhcp6_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 131:
-/* rule 131 can match eol */
+case 144:
+/* rule 144 can match eol */
 YY_RULE_SETUP
-#line 1378 "dhcp6_lexer.ll"
+#line 1499 "dhcp6_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 132:
+case 145:
 YY_RULE_SETUP
-#line 1383 "dhcp6_lexer.ll"
+#line 1504 "dhcp6_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 133:
+case 146:
 YY_RULE_SETUP
-#line 1388 "dhcp6_lexer.ll"
+#line 1509 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 134:
+case 147:
 YY_RULE_SETUP
-#line 1389 "dhcp6_lexer.ll"
+#line 1510 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 135:
+case 148:
 YY_RULE_SETUP
-#line 1390 "dhcp6_lexer.ll"
+#line 1511 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 136:
+case 149:
 YY_RULE_SETUP
-#line 1391 "dhcp6_lexer.ll"
+#line 1512 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 137:
+case 150:
 YY_RULE_SETUP
-#line 1392 "dhcp6_lexer.ll"
+#line 1513 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 138:
+case 151:
 YY_RULE_SETUP
-#line 1393 "dhcp6_lexer.ll"
+#line 1514 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 139:
+case 152:
 YY_RULE_SETUP
-#line 1395 "dhcp6_lexer.ll"
+#line 1516 "dhcp6_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -3555,9 +3774,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 140:
+case 153:
 YY_RULE_SETUP
-#line 1413 "dhcp6_lexer.ll"
+#line 1534 "dhcp6_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -3571,43 +3790,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 141:
+case 154:
 YY_RULE_SETUP
-#line 1426 "dhcp6_lexer.ll"
+#line 1547 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 142:
+case 155:
 YY_RULE_SETUP
-#line 1431 "dhcp6_lexer.ll"
+#line 1552 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 143:
+case 156:
 YY_RULE_SETUP
-#line 1435 "dhcp6_lexer.ll"
+#line 1556 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 144:
+case 157:
 YY_RULE_SETUP
-#line 1437 "dhcp6_lexer.ll"
+#line 1558 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 145:
+case 158:
 YY_RULE_SETUP
-#line 1439 "dhcp6_lexer.ll"
+#line 1560 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 146:
+case 159:
 YY_RULE_SETUP
-#line 1441 "dhcp6_lexer.ll"
+#line 1562 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1443 "dhcp6_lexer.ll"
+#line 1564 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -3631,12 +3850,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 147:
+case 160:
 YY_RULE_SETUP
-#line 1466 "dhcp6_lexer.ll"
+#line 1587 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3639 "dhcp6_lexer.cc"
+#line 3858 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3951,7 +4170,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1181 )
+			if ( yy_current_state >= 1282 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3984,11 +4203,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1181 )
+		if ( yy_current_state >= 1282 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1180);
+	yy_is_jam = (yy_current_state == 1281);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4737,7 +4956,7 @@ void parser6_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1466 "dhcp6_lexer.ll"
+#line 1587 "dhcp6_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -338,6 +338,16 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 
+(?i:\"BINARY\") {
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp6Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
+}
+
 (?i:\"when-present\") {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -541,6 +551,36 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"mapped-store\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_MAPPED_STORE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("mapped-store", driver.loc_);
+    }
+}
+
+\"file-format\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_FILE_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("file-format", driver.loc_);
+    }
+}
+
+\"lfc-mode\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+
 \"lfc-interval\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -849,6 +889,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGING:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"queue-size\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp6Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+
+\"overflow-policy\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::ASYNC_LOGGING:
+        return isc::dhcp::Dhcp6Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+
 \"loggers\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGING:
@@ -894,6 +961,51 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"rate-limits\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGERS:
+        return isc::dhcp::Dhcp6Parser::make_RATE_LIMITS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate-limits", driver.loc_);
+    }
+}
+
+\"message\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_MESSAGE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("message", driver.loc_);
+    }
+}
+
+\"sample\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_SAMPLE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("sample", driver.loc_);
+    }
+}
+
+\"rate\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate", driver.loc_);
+    }
+}
+
+\"interval\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::RATE_LIMITS:
+        return isc::dhcp::Dhcp6Parser::make_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("interval", driver.loc_);
+    }
+}
+
 \"client-classes\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -1217,6 +1329,15 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"packet-timeline\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_PACKET_TIMELINE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("packet-timeline", driver.loc_);
+    }
+}
+
 \"control-socket\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   parser6_lex
 
-// First part of user declarations.
 
-#line 39 "dhcp6_parser.cc" // lalr1.cc:404
-
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "dhcp6_parser.h"
 
-// User implementation prologue.
 
-#line 53 "dhcp6_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "dhcp6_parser.yy" // lalr1.cc:413
+#line 34 "dhcp6_parser.yy"
 
 #include <dhcp6/parser_context.h>
 
-#line 59 "dhcp6_parser.cc" // lalr1.cc:413
+#line 52 "dhcp6_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER6_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER6_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !PARSER6_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:479
+#line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 145 "dhcp6_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp6Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp6_parser.cc"
 
   /// Build a parser object.
   Dhcp6Parser::Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg)
-    :
 #if PARSER6_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::~Dhcp6Parser ()
   {}
 
+  Dhcp6Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  Dhcp6Parser::by_state::by_state ()
+  Dhcp6Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  Dhcp6Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp6Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  Dhcp6Parser::by_state::clear ()
+  Dhcp6Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   Dhcp6Parser::by_state::move (by_state& that)
   {
@@ -227,55 +188,92 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  inline
-  Dhcp6Parser::by_state::by_state (state_type s)
+  Dhcp6Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  Dhcp6Parser::symbol_number_type
-  Dhcp6Parser::by_state::type_get () const
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   Dhcp6Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  Dhcp6Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
-        value.move< ElementPtr > (that.value);
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 140: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 139: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 138: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 137: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -283,38 +281,39 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   Dhcp6Parser::stack_symbol_type&
   Dhcp6Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 140: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 139: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 138: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 137: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -326,9 +325,50 @@ namespace isc { namespace dhcp {
     return *this;
   }
 
+  Dhcp6Parser::stack_symbol_type&
+  Dhcp6Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   Dhcp6Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -339,119 +379,115 @@ namespace isc { namespace dhcp {
 #if PARSER6_DEBUG
   template <typename Base>
   void
-  Dhcp6Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp6Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 137: // "constant string"
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 362 "dhcp6_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 400 "dhcp6_parser.cc"
         break;
 
-      case 138: // "integer"
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 369 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 406 "dhcp6_parser.cc"
         break;
 
-      case 139: // "floating point"
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 376 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 412 "dhcp6_parser.cc"
         break;
 
-      case 140: // "boolean"
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 383 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 418 "dhcp6_parser.cc"
         break;
 
-      case 155: // value
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 390 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 424 "dhcp6_parser.cc"
         break;
 
-      case 159: // map_value
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 397 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_map_value: // map_value
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 430 "dhcp6_parser.cc"
         break;
 
-      case 200: // db_type
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 404 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_db_type: // db_type
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 436 "dhcp6_parser.cc"
         break;
 
-      case 387: // duid_type
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 411 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_duid_type: // duid_type
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 442 "dhcp6_parser.cc"
         break;
 
-      case 420: // ncr_protocol_value
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 418 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 448 "dhcp6_parser.cc"
         break;
 
-      case 429: // replace_client_name_value
-
-#line 212 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 425 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 454 "dhcp6_parser.cc"
         break;
 
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 227 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 460 "dhcp6_parser.cc"
+        break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  Dhcp6Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  Dhcp6Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  Dhcp6Parser::yypush_ (const char* m, stack_symbol_type& s)
+  Dhcp6Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  Dhcp6Parser::yypop_ (unsigned int n)
+  Dhcp6Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -483,32 +519,37 @@ namespace isc { namespace dhcp {
   }
 #endif // PARSER6_DEBUG
 
-  inline Dhcp6Parser::state_type
+  Dhcp6Parser::state_type
   Dhcp6Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  Dhcp6Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   Dhcp6Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -526,11 +567,11 @@ namespace isc { namespace dhcp {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -538,48 +579,70 @@ namespace isc { namespace dhcp {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -596,54 +659,57 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
-        yylhs.value.build< ElementPtr > ();
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 140: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 139: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 138: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 137: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -651,292 +717,295 @@ namespace isc { namespace dhcp {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 221 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 670 "dhcp6_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 236 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 739 "dhcp6_parser.cc"
     break;
 
-  case 4:
-#line 222 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 676 "dhcp6_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 237 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 745 "dhcp6_parser.cc"
     break;
 
-  case 6:
-#line 223 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 682 "dhcp6_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 238 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP6; }
+#line 751 "dhcp6_parser.cc"
     break;
 
-  case 8:
-#line 224 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 688 "dhcp6_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 239 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 757 "dhcp6_parser.cc"
     break;
 
-  case 10:
-#line 225 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.SUBNET6; }
-#line 694 "dhcp6_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 240 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET6; }
+#line 763 "dhcp6_parser.cc"
     break;
 
-  case 12:
-#line 226 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.POOLS; }
-#line 700 "dhcp6_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 241 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 769 "dhcp6_parser.cc"
     break;
 
-  case 14:
-#line 227 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.PD_POOLS; }
-#line 706 "dhcp6_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 242 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.PD_POOLS; }
+#line 775 "dhcp6_parser.cc"
     break;
 
-  case 16:
-#line 228 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 712 "dhcp6_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 243 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 781 "dhcp6_parser.cc"
     break;
 
-  case 18:
-#line 229 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 718 "dhcp6_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 244 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 787 "dhcp6_parser.cc"
     break;
 
-  case 20:
-#line 230 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 724 "dhcp6_parser.cc" // lalr1.cc:859
+  case 20: // $@10: %empty
+#line 245 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 793 "dhcp6_parser.cc"
     break;
 
-  case 22:
-#line 231 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 730 "dhcp6_parser.cc" // lalr1.cc:859
+  case 22: // $@11: %empty
+#line 246 "dhcp6_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 799 "dhcp6_parser.cc"
     break;
 
-  case 24:
-#line 232 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 736 "dhcp6_parser.cc" // lalr1.cc:859
+  case 24: // $@12: %empty
+#line 247 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 805 "dhcp6_parser.cc"
     break;
 
-  case 26:
-#line 240 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 742 "dhcp6_parser.cc" // lalr1.cc:859
+  case 26: // value: "integer"
+#line 255 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 811 "dhcp6_parser.cc"
     break;
 
-  case 27:
-#line 241 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 748 "dhcp6_parser.cc" // lalr1.cc:859
+  case 27: // value: "floating point"
+#line 256 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 817 "dhcp6_parser.cc"
     break;
 
-  case 28:
-#line 242 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 754 "dhcp6_parser.cc" // lalr1.cc:859
+  case 28: // value: "boolean"
+#line 257 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 823 "dhcp6_parser.cc"
     break;
 
-  case 29:
-#line 243 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 760 "dhcp6_parser.cc" // lalr1.cc:859
+  case 29: // value: "constant string"
+#line 258 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 829 "dhcp6_parser.cc"
     break;
 
-  case 30:
-#line 244 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 766 "dhcp6_parser.cc" // lalr1.cc:859
+  case 30: // value: "null"
+#line 259 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 835 "dhcp6_parser.cc"
     break;
 
-  case 31:
-#line 245 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 772 "dhcp6_parser.cc" // lalr1.cc:859
+  case 31: // value: map2
+#line 260 "dhcp6_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 841 "dhcp6_parser.cc"
     break;
 
-  case 32:
-#line 246 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 778 "dhcp6_parser.cc" // lalr1.cc:859
+  case 32: // value: list_generic
+#line 261 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 847 "dhcp6_parser.cc"
     break;
 
-  case 33:
-#line 249 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 33: // sub_json: value
+#line 264 "dhcp6_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 787 "dhcp6_parser.cc" // lalr1.cc:859
+#line 856 "dhcp6_parser.cc"
     break;
 
-  case 34:
-#line 254 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 34: // $@13: %empty
+#line 269 "dhcp6_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 798 "dhcp6_parser.cc" // lalr1.cc:859
+#line 867 "dhcp6_parser.cc"
     break;
 
-  case 35:
-#line 259 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 35: // map2: "{" $@13 map_content "}"
+#line 274 "dhcp6_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 808 "dhcp6_parser.cc" // lalr1.cc:859
+#line 877 "dhcp6_parser.cc"
     break;
 
-  case 36:
-#line 265 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 814 "dhcp6_parser.cc" // lalr1.cc:859
+  case 36: // map_value: map2
+#line 280 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 883 "dhcp6_parser.cc"
     break;
 
-  case 39:
-#line 272 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 39: // not_empty_map: "constant string" ":" value
+#line 287 "dhcp6_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 823 "dhcp6_parser.cc" // lalr1.cc:859
+#line 892 "dhcp6_parser.cc"
     break;
 
-  case 40:
-#line 276 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 40: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 291 "dhcp6_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 833 "dhcp6_parser.cc" // lalr1.cc:859
+#line 902 "dhcp6_parser.cc"
     break;
 
-  case 41:
-#line 283 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 41: // $@14: %empty
+#line 298 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 842 "dhcp6_parser.cc" // lalr1.cc:859
+#line 911 "dhcp6_parser.cc"
     break;
 
-  case 42:
-#line 286 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 42: // list_generic: "[" $@14 list_content "]"
+#line 301 "dhcp6_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 850 "dhcp6_parser.cc" // lalr1.cc:859
+#line 919 "dhcp6_parser.cc"
     break;
 
-  case 45:
-#line 294 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 45: // not_empty_list: value
+#line 309 "dhcp6_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 859 "dhcp6_parser.cc" // lalr1.cc:859
+#line 928 "dhcp6_parser.cc"
     break;
 
-  case 46:
-#line 298 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 46: // not_empty_list: not_empty_list "," value
+#line 313 "dhcp6_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 868 "dhcp6_parser.cc" // lalr1.cc:859
+#line 937 "dhcp6_parser.cc"
     break;
 
-  case 47:
-#line 305 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 47: // $@15: %empty
+#line 320 "dhcp6_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 876 "dhcp6_parser.cc" // lalr1.cc:859
+#line 945 "dhcp6_parser.cc"
     break;
 
-  case 48:
-#line 307 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 48: // list_strings: "[" $@15 list_strings_content "]"
+#line 322 "dhcp6_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 885 "dhcp6_parser.cc" // lalr1.cc:859
+#line 954 "dhcp6_parser.cc"
     break;
 
-  case 51:
-#line 316 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 51: // not_empty_list_strings: "constant string"
+#line 331 "dhcp6_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 894 "dhcp6_parser.cc" // lalr1.cc:859
+#line 963 "dhcp6_parser.cc"
     break;
 
-  case 52:
-#line 320 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 52: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 335 "dhcp6_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 903 "dhcp6_parser.cc" // lalr1.cc:859
+#line 972 "dhcp6_parser.cc"
     break;
 
-  case 53:
-#line 331 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 53: // unknown_map_entry: "constant string" ":"
+#line 346 "dhcp6_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 914 "dhcp6_parser.cc" // lalr1.cc:859
+#line 983 "dhcp6_parser.cc"
     break;
 
-  case 54:
-#line 341 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 54: // $@16: %empty
+#line 356 "dhcp6_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 925 "dhcp6_parser.cc" // lalr1.cc:859
+#line 994 "dhcp6_parser.cc"
     break;
 
-  case 55:
-#line 346 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 55: // syntax_map: "{" $@16 global_objects "}"
+#line 361 "dhcp6_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 935 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1004 "dhcp6_parser.cc"
     break;
 
-  case 63:
-#line 365 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 63: // $@17: %empty
+#line 380 "dhcp6_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -944,616 +1013,661 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP6);
 }
-#line 948 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1017 "dhcp6_parser.cc"
     break;
 
-  case 64:
-#line 372 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 64: // dhcp6_object: "Dhcp6" $@17 ":" "{" global_params "}"
+#line 387 "dhcp6_parser.yy"
+                                                    {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 960 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1029 "dhcp6_parser.cc"
     break;
 
-  case 65:
-#line 382 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 65: // $@18: %empty
+#line 397 "dhcp6_parser.yy"
+                          {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 970 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1039 "dhcp6_parser.cc"
     break;
 
-  case 66:
-#line 386 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 66: // sub_dhcp6: "{" $@18 global_params "}"
+#line 401 "dhcp6_parser.yy"
+                               {
     // parsing completed
 }
-#line 978 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1047 "dhcp6_parser.cc"
     break;
 
-  case 91:
-#line 420 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 92: // preferred_lifetime: "preferred-lifetime" ":" "integer"
+#line 436 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
 }
-#line 987 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1056 "dhcp6_parser.cc"
     break;
 
-  case 92:
-#line 425 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 93: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 441 "dhcp6_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 996 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1065 "dhcp6_parser.cc"
     break;
 
-  case 93:
-#line 430 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 94: // renew_timer: "renew-timer" ":" "integer"
+#line 446 "dhcp6_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1005 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1074 "dhcp6_parser.cc"
     break;
 
-  case 94:
-#line 435 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 95: // rebind_timer: "rebind-timer" ":" "integer"
+#line 451 "dhcp6_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1014 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1083 "dhcp6_parser.cc"
     break;
 
-  case 95:
-#line 440 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 96: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 456 "dhcp6_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1023 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1092 "dhcp6_parser.cc"
     break;
 
-  case 96:
-#line 445 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 97: // $@19: %empty
+#line 461 "dhcp6_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1034 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1103 "dhcp6_parser.cc"
     break;
 
-  case 97:
-#line 450 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 98: // interfaces_config: "interfaces-config" $@19 ":" "{" interface_config_map "}"
+#line 466 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1043 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1112 "dhcp6_parser.cc"
     break;
 
-  case 98:
-#line 455 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 99: // $@20: %empty
+#line 471 "dhcp6_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1053 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1122 "dhcp6_parser.cc"
     break;
 
-  case 99:
-#line 459 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 100: // sub_interfaces6: "{" $@20 interface_config_map "}"
+#line 475 "dhcp6_parser.yy"
+                                      {
     // parsing completed
 }
-#line 1061 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1130 "dhcp6_parser.cc"
     break;
 
-  case 100:
-#line 463 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 101: // $@21: %empty
+#line 479 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1072 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1141 "dhcp6_parser.cc"
     break;
 
-  case 101:
-#line 468 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 102: // interface_config_map: "interfaces" $@21 ":" list_strings
+#line 484 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1081 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1150 "dhcp6_parser.cc"
     break;
 
-  case 102:
-#line 473 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 103: // $@22: %empty
+#line 489 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1092 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1161 "dhcp6_parser.cc"
     break;
 
-  case 103:
-#line 478 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 104: // lease_database: "lease-database" $@22 ":" "{" database_map_params "}"
+#line 494 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1101 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1170 "dhcp6_parser.cc"
     break;
 
-  case 104:
-#line 483 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 105: // $@23: %empty
+#line 499 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1112 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1181 "dhcp6_parser.cc"
     break;
 
-  case 105:
-#line 488 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 106: // hosts_database: "hosts-database" $@23 ":" "{" database_map_params "}"
+#line 504 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1121 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1190 "dhcp6_parser.cc"
     break;
 
-  case 118:
-#line 509 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 122: // $@24: %empty
+#line 528 "dhcp6_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1129 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1198 "dhcp6_parser.cc"
     break;
 
-  case 119:
-#line 511 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 123: // database_type: "type" $@24 ":" db_type
+#line 530 "dhcp6_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1138 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1207 "dhcp6_parser.cc"
     break;
 
-  case 120:
-#line 516 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1144 "dhcp6_parser.cc" // lalr1.cc:859
+  case 124: // db_type: "memfile"
+#line 535 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1213 "dhcp6_parser.cc"
     break;
 
-  case 121:
-#line 517 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1150 "dhcp6_parser.cc" // lalr1.cc:859
+  case 125: // db_type: "mysql"
+#line 536 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1219 "dhcp6_parser.cc"
     break;
 
-  case 122:
-#line 518 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1156 "dhcp6_parser.cc" // lalr1.cc:859
+  case 126: // db_type: "postgresql"
+#line 537 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1225 "dhcp6_parser.cc"
     break;
 
-  case 123:
-#line 519 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1162 "dhcp6_parser.cc" // lalr1.cc:859
+  case 127: // db_type: "cql"
+#line 538 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1231 "dhcp6_parser.cc"
     break;
 
-  case 124:
-#line 522 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 128: // $@25: %empty
+#line 541 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1170 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1239 "dhcp6_parser.cc"
     break;
 
-  case 125:
-#line 524 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 129: // user: "user" $@25 ":" "constant string"
+#line 543 "dhcp6_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1180 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1249 "dhcp6_parser.cc"
     break;
 
-  case 126:
-#line 530 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 130: // $@26: %empty
+#line 549 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1188 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1257 "dhcp6_parser.cc"
     break;
 
-  case 127:
-#line 532 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 131: // password: "password" $@26 ":" "constant string"
+#line 551 "dhcp6_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1198 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1267 "dhcp6_parser.cc"
     break;
 
-  case 128:
-#line 538 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 132: // $@27: %empty
+#line 557 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1206 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1275 "dhcp6_parser.cc"
     break;
 
-  case 129:
-#line 540 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 133: // host: "host" $@27 ":" "constant string"
+#line 559 "dhcp6_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1216 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1285 "dhcp6_parser.cc"
     break;
 
-  case 130:
-#line 546 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 134: // $@28: %empty
+#line 565 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1224 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1293 "dhcp6_parser.cc"
     break;
 
-  case 131:
-#line 548 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 135: // name: "name" $@28 ":" "constant string"
+#line 567 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1234 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1303 "dhcp6_parser.cc"
     break;
 
-  case 132:
-#line 554 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 136: // persist: "persist" ":" "boolean"
+#line 573 "dhcp6_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1243 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1312 "dhcp6_parser.cc"
     break;
 
-  case 133:
-#line 559 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 137: // mapped_store: "mapped-store" ":" "boolean"
+#line 578 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("mapped-store", n);
+}
+#line 1321 "dhcp6_parser.cc"
+    break;
+
+  case 138: // $@29: %empty
+#line 583 "dhcp6_parser.yy"
+                         {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1329 "dhcp6_parser.cc"
+    break;
+
+  case 139: // file_format: "file-format" $@29 ":" "constant string"
+#line 585 "dhcp6_parser.yy"
+               {
+    ElementPtr format(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("file-format", format);
+    ctx.leave();
+}
+#line 1339 "dhcp6_parser.cc"
+    break;
+
+  case 140: // $@30: %empty
+#line 591 "dhcp6_parser.yy"
+                   {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1347 "dhcp6_parser.cc"
+    break;
+
+  case 141: // lfc_mode: "lfc-mode" $@30 ":" "constant string"
+#line 593 "dhcp6_parser.yy"
+               {
+    ElementPtr mode(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-mode", mode);
+    ctx.leave();
+}
+#line 1357 "dhcp6_parser.cc"
+    break;
+
+  case 142: // lfc_interval: "lfc-interval" ":" "integer"
+#line 599 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1252 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1366 "dhcp6_parser.cc"
     break;
 
-  case 134:
-#line 564 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 143: // readonly: "readonly" ":" "boolean"
+#line 604 "dhcp6_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1261 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1375 "dhcp6_parser.cc"
     break;
 
-  case 135:
-#line 569 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 144: // connect_timeout: "connect-timeout" ":" "integer"
+#line 609 "dhcp6_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1270 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1384 "dhcp6_parser.cc"
     break;
 
-  case 136:
-#line 574 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 145: // $@31: %empty
+#line 614 "dhcp6_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1281 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1395 "dhcp6_parser.cc"
     break;
 
-  case 137:
-#line 579 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 146: // mac_sources: "mac-sources" $@31 ":" "[" mac_sources_list "]"
+#line 619 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1290 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1404 "dhcp6_parser.cc"
     break;
 
-  case 142:
-#line 592 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 151: // duid_id: "duid"
+#line 632 "dhcp6_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1299 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1413 "dhcp6_parser.cc"
     break;
 
-  case 143:
-#line 597 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 152: // string_id: "constant string"
+#line 637 "dhcp6_parser.yy"
+                   {
+    ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1308 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1422 "dhcp6_parser.cc"
     break;
 
-  case 144:
-#line 602 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 153: // $@32: %empty
+#line 642 "dhcp6_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1319 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1433 "dhcp6_parser.cc"
     break;
 
-  case 145:
-#line 607 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 154: // host_reservation_identifiers: "host-reservation-identifiers" $@32 ":" "[" host_reservation_identifiers_list "]"
+#line 647 "dhcp6_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1328 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1442 "dhcp6_parser.cc"
     break;
 
-  case 150:
-#line 620 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 159: // hw_address_id: "hw-address"
+#line 660 "dhcp6_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1337 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1451 "dhcp6_parser.cc"
     break;
 
-  case 151:
-#line 627 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 160: // $@33: %empty
+#line 667 "dhcp6_parser.yy"
+                                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1348 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1462 "dhcp6_parser.cc"
     break;
 
-  case 152:
-#line 632 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 161: // relay_supplied_options: "relay-supplied-options" $@33 ":" "[" list_content "]"
+#line 672 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1357 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1471 "dhcp6_parser.cc"
     break;
 
-  case 153:
-#line 637 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 162: // $@34: %empty
+#line 677 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1368 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1482 "dhcp6_parser.cc"
     break;
 
-  case 154:
-#line 642 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 163: // hooks_libraries: "hooks-libraries" $@34 ":" "[" hooks_libraries_list "]"
+#line 682 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1377 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1491 "dhcp6_parser.cc"
     break;
 
-  case 159:
-#line 655 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 168: // $@35: %empty
+#line 695 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1387 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1501 "dhcp6_parser.cc"
     break;
 
-  case 160:
-#line 659 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 169: // hooks_library: "{" $@35 hooks_params "}"
+#line 699 "dhcp6_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1395 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1509 "dhcp6_parser.cc"
     break;
 
-  case 161:
-#line 663 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 170: // $@36: %empty
+#line 703 "dhcp6_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1405 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1519 "dhcp6_parser.cc"
     break;
 
-  case 162:
-#line 667 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 171: // sub_hooks_library: "{" $@36 hooks_params "}"
+#line 707 "dhcp6_parser.yy"
+                              {
     // parsing completed
 }
-#line 1413 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1527 "dhcp6_parser.cc"
     break;
 
-  case 168:
-#line 680 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 177: // $@37: %empty
+#line 720 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1421 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1535 "dhcp6_parser.cc"
     break;
 
-  case 169:
-#line 682 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 178: // library: "library" $@37 ":" "constant string"
+#line 722 "dhcp6_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1431 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1545 "dhcp6_parser.cc"
     break;
 
-  case 170:
-#line 688 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 179: // $@38: %empty
+#line 728 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1439 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1553 "dhcp6_parser.cc"
     break;
 
-  case 171:
-#line 690 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 180: // parameters: "parameters" $@38 ":" value
+#line 730 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1448 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1562 "dhcp6_parser.cc"
     break;
 
-  case 172:
-#line 696 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 181: // $@39: %empty
+#line 736 "dhcp6_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1459 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1573 "dhcp6_parser.cc"
     break;
 
-  case 173:
-#line 701 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 182: // expired_leases_processing: "expired-leases-processing" $@39 ":" "{" expired_leases_params "}"
+#line 741 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1468 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1582 "dhcp6_parser.cc"
     break;
 
-  case 182:
-#line 718 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 191: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 758 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1477 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1591 "dhcp6_parser.cc"
     break;
 
-  case 183:
-#line 723 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 192: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 763 "dhcp6_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1486 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1600 "dhcp6_parser.cc"
     break;
 
-  case 184:
-#line 728 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 193: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 768 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1495 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1609 "dhcp6_parser.cc"
     break;
 
-  case 185:
-#line 733 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 194: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 773 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1504 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1618 "dhcp6_parser.cc"
     break;
 
-  case 186:
-#line 738 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 195: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 778 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1513 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1627 "dhcp6_parser.cc"
     break;
 
-  case 187:
-#line 743 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 196: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 783 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1522 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1636 "dhcp6_parser.cc"
     break;
 
-  case 188:
-#line 751 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 197: // $@40: %empty
+#line 791 "dhcp6_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1533 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1647 "dhcp6_parser.cc"
     break;
 
-  case 189:
-#line 756 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 198: // subnet6_list: "subnet6" $@40 ":" "[" subnet6_list_content "]"
+#line 796 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1542 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1656 "dhcp6_parser.cc"
     break;
 
-  case 194:
-#line 776 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 203: // $@41: %empty
+#line 816 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1552 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1666 "dhcp6_parser.cc"
     break;
 
-  case 195:
-#line 780 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 204: // subnet6: "{" $@41 subnet6_params "}"
+#line 820 "dhcp6_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1571,1486 +1685,1640 @@ namespace isc { namespace dhcp {
     // }
     ctx.stack_.pop_back();
 }
-#line 1575 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1689 "dhcp6_parser.cc"
     break;
 
-  case 196:
-#line 799 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 205: // $@42: %empty
+#line 839 "dhcp6_parser.yy"
+                            {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1585 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1699 "dhcp6_parser.cc"
     break;
 
-  case 197:
-#line 803 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 206: // sub_subnet6: "{" $@42 subnet6_params "}"
+#line 843 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 1593 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1707 "dhcp6_parser.cc"
     break;
 
-  case 217:
-#line 832 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 226: // $@43: %empty
+#line 872 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1601 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1715 "dhcp6_parser.cc"
     break;
 
-  case 218:
-#line 834 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 227: // subnet: "subnet" $@43 ":" "constant string"
+#line 874 "dhcp6_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1611 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1725 "dhcp6_parser.cc"
     break;
 
-  case 219:
-#line 840 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 228: // $@44: %empty
+#line 880 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1619 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1733 "dhcp6_parser.cc"
     break;
 
-  case 220:
-#line 842 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 229: // interface: "interface" $@44 ":" "constant string"
+#line 882 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1629 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1743 "dhcp6_parser.cc"
     break;
 
-  case 221:
-#line 848 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 230: // $@45: %empty
+#line 888 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1637 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1751 "dhcp6_parser.cc"
     break;
 
-  case 222:
-#line 850 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 231: // interface_id: "interface-id" $@45 ":" "constant string"
+#line 890 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1647 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1761 "dhcp6_parser.cc"
     break;
 
-  case 223:
-#line 856 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 232: // $@46: %empty
+#line 896 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1655 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1769 "dhcp6_parser.cc"
     break;
 
-  case 224:
-#line 858 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 233: // client_class: "client-class" $@46 ":" "constant string"
+#line 898 "dhcp6_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1665 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1779 "dhcp6_parser.cc"
     break;
 
-  case 225:
-#line 864 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 234: // $@47: %empty
+#line 904 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1673 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1787 "dhcp6_parser.cc"
     break;
 
-  case 226:
-#line 866 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rm(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 235: // reservation_mode: "reservation-mode" $@47 ":" "constant string"
+#line 906 "dhcp6_parser.yy"
+               {
+    ElementPtr rm(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservation-mode", rm);
     ctx.leave();
 }
-#line 1683 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1797 "dhcp6_parser.cc"
     break;
 
-  case 227:
-#line 872 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 236: // id: "id" ":" "integer"
+#line 912 "dhcp6_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1692 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1806 "dhcp6_parser.cc"
     break;
 
-  case 228:
-#line 877 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 237: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 917 "dhcp6_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1701 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1815 "dhcp6_parser.cc"
     break;
 
-  case 229:
-#line 886 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 238: // $@48: %empty
+#line 926 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1712 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1826 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 891 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 239: // option_def_list: "option-def" $@48 ":" "[" option_def_list_content "]"
+#line 931 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1721 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1835 "dhcp6_parser.cc"
     break;
 
-  case 235:
-#line 908 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 244: // $@49: %empty
+#line 948 "dhcp6_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1731 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1845 "dhcp6_parser.cc"
     break;
 
-  case 236:
-#line 912 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 245: // option_def_entry: "{" $@49 option_def_params "}"
+#line 952 "dhcp6_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1739 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1853 "dhcp6_parser.cc"
     break;
 
-  case 237:
-#line 919 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 246: // $@50: %empty
+#line 959 "dhcp6_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1749 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1863 "dhcp6_parser.cc"
     break;
 
-  case 238:
-#line 923 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 247: // sub_option_def: "{" $@50 option_def_params "}"
+#line 963 "dhcp6_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1757 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1871 "dhcp6_parser.cc"
     break;
 
-  case 252:
-#line 949 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 261: // code: "code" ":" "integer"
+#line 989 "dhcp6_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1766 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1880 "dhcp6_parser.cc"
     break;
 
-  case 254:
-#line 956 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 263: // $@51: %empty
+#line 996 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1774 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1888 "dhcp6_parser.cc"
     break;
 
-  case 255:
-#line 958 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 264: // option_def_type: "type" $@51 ":" "constant string"
+#line 998 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1784 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1898 "dhcp6_parser.cc"
     break;
 
-  case 256:
-#line 964 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 265: // $@52: %empty
+#line 1004 "dhcp6_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1792 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1906 "dhcp6_parser.cc"
     break;
 
-  case 257:
-#line 966 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 266: // option_def_record_types: "record-types" $@52 ":" "constant string"
+#line 1006 "dhcp6_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1802 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1916 "dhcp6_parser.cc"
     break;
 
-  case 258:
-#line 972 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 267: // $@53: %empty
+#line 1012 "dhcp6_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1810 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1924 "dhcp6_parser.cc"
     break;
 
-  case 259:
-#line 974 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 268: // space: "space" $@53 ":" "constant string"
+#line 1014 "dhcp6_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1820 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1934 "dhcp6_parser.cc"
     break;
 
-  case 261:
-#line 982 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 270: // $@54: %empty
+#line 1022 "dhcp6_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1828 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1942 "dhcp6_parser.cc"
     break;
 
-  case 262:
-#line 984 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 271: // option_def_encapsulate: "encapsulate" $@54 ":" "constant string"
+#line 1024 "dhcp6_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 1838 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1952 "dhcp6_parser.cc"
     break;
 
-  case 263:
-#line 990 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 272: // option_def_array: "array" ":" "boolean"
+#line 1030 "dhcp6_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 1847 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1961 "dhcp6_parser.cc"
     break;
 
-  case 264:
-#line 999 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 273: // $@55: %empty
+#line 1039 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 1858 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1972 "dhcp6_parser.cc"
     break;
 
-  case 265:
-#line 1004 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 274: // option_data_list: "option-data" $@55 ":" "[" option_data_list_content "]"
+#line 1044 "dhcp6_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1867 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1981 "dhcp6_parser.cc"
     break;
 
-  case 270:
-#line 1023 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 279: // $@56: %empty
+#line 1063 "dhcp6_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1877 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1991 "dhcp6_parser.cc"
     break;
 
-  case 271:
-#line 1027 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 280: // option_data_entry: "{" $@56 option_data_params "}"
+#line 1067 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1885 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1999 "dhcp6_parser.cc"
     break;
 
-  case 272:
-#line 1034 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 281: // $@57: %empty
+#line 1074 "dhcp6_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1895 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2009 "dhcp6_parser.cc"
     break;
 
-  case 273:
-#line 1038 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 282: // sub_option_data: "{" $@57 option_data_params "}"
+#line 1078 "dhcp6_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1903 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2017 "dhcp6_parser.cc"
     break;
 
-  case 285:
-#line 1067 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 294: // $@58: %empty
+#line 1107 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1911 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2025 "dhcp6_parser.cc"
     break;
 
-  case 286:
-#line 1069 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 295: // option_data_data: "data" $@58 ":" "constant string"
+#line 1109 "dhcp6_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 1921 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2035 "dhcp6_parser.cc"
     break;
 
-  case 289:
-#line 1079 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 298: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1119 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 1930 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2044 "dhcp6_parser.cc"
     break;
 
-  case 290:
-#line 1087 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 299: // $@59: %empty
+#line 1127 "dhcp6_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 1941 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2055 "dhcp6_parser.cc"
     break;
 
-  case 291:
-#line 1092 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 300: // pools_list: "pools" $@59 ":" "[" pools_list_content "]"
+#line 1132 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1950 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2064 "dhcp6_parser.cc"
     break;
 
-  case 296:
-#line 1107 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 305: // $@60: %empty
+#line 1147 "dhcp6_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1960 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2074 "dhcp6_parser.cc"
     break;
 
-  case 297:
-#line 1111 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 306: // pool_list_entry: "{" $@60 pool_params "}"
+#line 1151 "dhcp6_parser.yy"
+                             {
     ctx.stack_.pop_back();
 }
-#line 1968 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2082 "dhcp6_parser.cc"
     break;
 
-  case 298:
-#line 1115 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 307: // $@61: %empty
+#line 1155 "dhcp6_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1978 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2092 "dhcp6_parser.cc"
     break;
 
-  case 299:
-#line 1119 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 308: // sub_pool6: "{" $@61 pool_params "}"
+#line 1159 "dhcp6_parser.yy"
+                             {
     // parsing completed
 }
-#line 1986 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2100 "dhcp6_parser.cc"
     break;
 
-  case 306:
-#line 1133 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 315: // $@62: %empty
+#line 1173 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1994 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2108 "dhcp6_parser.cc"
     break;
 
-  case 307:
-#line 1135 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 316: // pool_entry: "pool" $@62 ":" "constant string"
+#line 1175 "dhcp6_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2004 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2118 "dhcp6_parser.cc"
     break;
 
-  case 308:
-#line 1141 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 317: // $@63: %empty
+#line 1181 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2012 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2126 "dhcp6_parser.cc"
     break;
 
-  case 309:
-#line 1143 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
+  case 318: // user_context: "user-context" $@63 ":" map_value
+#line 1183 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("user-context", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2021 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2135 "dhcp6_parser.cc"
     break;
 
-  case 310:
-#line 1151 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 319: // $@64: %empty
+#line 1191 "dhcp6_parser.yy"
+                        {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2032 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2146 "dhcp6_parser.cc"
     break;
 
-  case 311:
-#line 1156 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 320: // pd_pools_list: "pd-pools" $@64 ":" "[" pd_pools_list_content "]"
+#line 1196 "dhcp6_parser.yy"
+                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2041 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2155 "dhcp6_parser.cc"
     break;
 
-  case 316:
-#line 1171 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 325: // $@65: %empty
+#line 1211 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2051 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2165 "dhcp6_parser.cc"
     break;
 
-  case 317:
-#line 1175 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 326: // pd_pool_entry: "{" $@65 pd_pool_params "}"
+#line 1215 "dhcp6_parser.yy"
+                                {
     ctx.stack_.pop_back();
 }
-#line 2059 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2173 "dhcp6_parser.cc"
     break;
 
-  case 318:
-#line 1179 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 327: // $@66: %empty
+#line 1219 "dhcp6_parser.yy"
+                            {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2069 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2183 "dhcp6_parser.cc"
     break;
 
-  case 319:
-#line 1183 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 328: // sub_pd_pool: "{" $@66 pd_pool_params "}"
+#line 1223 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 2077 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2191 "dhcp6_parser.cc"
     break;
 
-  case 330:
-#line 1201 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 339: // $@67: %empty
+#line 1241 "dhcp6_parser.yy"
+                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2085 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2199 "dhcp6_parser.cc"
     break;
 
-  case 331:
-#line 1203 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 340: // pd_prefix: "prefix" $@67 ":" "constant string"
+#line 1243 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2095 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2209 "dhcp6_parser.cc"
     break;
 
-  case 332:
-#line 1209 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 341: // pd_prefix_len: "prefix-len" ":" "integer"
+#line 1249 "dhcp6_parser.yy"
+                                        {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2104 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2218 "dhcp6_parser.cc"
     break;
 
-  case 333:
-#line 1214 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 342: // $@68: %empty
+#line 1254 "dhcp6_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2112 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2226 "dhcp6_parser.cc"
     break;
 
-  case 334:
-#line 1216 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 343: // excluded_prefix: "excluded-prefix" $@68 ":" "constant string"
+#line 1256 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2122 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2236 "dhcp6_parser.cc"
     break;
 
-  case 335:
-#line 1222 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 344: // excluded_prefix_len: "excluded-prefix-len" ":" "integer"
+#line 1262 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2131 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2245 "dhcp6_parser.cc"
     break;
 
-  case 336:
-#line 1227 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 345: // pd_delegated_len: "delegated-len" ":" "integer"
+#line 1267 "dhcp6_parser.yy"
+                                              {
+    ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2140 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2254 "dhcp6_parser.cc"
     break;
 
-  case 337:
-#line 1235 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 346: // $@69: %empty
+#line 1275 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2151 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2265 "dhcp6_parser.cc"
     break;
 
-  case 338:
-#line 1240 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 347: // reservations: "reservations" $@69 ":" "[" reservations_list "]"
+#line 1280 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2160 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2274 "dhcp6_parser.cc"
     break;
 
-  case 343:
-#line 1253 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 352: // $@70: %empty
+#line 1293 "dhcp6_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2170 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2284 "dhcp6_parser.cc"
     break;
 
-  case 344:
-#line 1257 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 353: // reservation: "{" $@70 reservation_params "}"
+#line 1297 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2178 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2292 "dhcp6_parser.cc"
     break;
 
-  case 345:
-#line 1261 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 354: // $@71: %empty
+#line 1301 "dhcp6_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2188 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2302 "dhcp6_parser.cc"
     break;
 
-  case 346:
-#line 1265 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 355: // sub_reservation: "{" $@71 reservation_params "}"
+#line 1305 "dhcp6_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2196 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2310 "dhcp6_parser.cc"
     break;
 
-  case 359:
-#line 1288 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 368: // $@72: %empty
+#line 1328 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2207 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2321 "dhcp6_parser.cc"
     break;
 
-  case 360:
-#line 1293 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 369: // ip_addresses: "ip-addresses" $@72 ":" list_strings
+#line 1333 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2216 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2330 "dhcp6_parser.cc"
     break;
 
-  case 361:
-#line 1298 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 370: // $@73: %empty
+#line 1338 "dhcp6_parser.yy"
+                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2227 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2341 "dhcp6_parser.cc"
     break;
 
-  case 362:
-#line 1303 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 371: // prefixes: "prefixes" $@73 ":" list_strings
+#line 1343 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2236 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2350 "dhcp6_parser.cc"
     break;
 
-  case 363:
-#line 1308 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 372: // $@74: %empty
+#line 1348 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2244 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2358 "dhcp6_parser.cc"
     break;
 
-  case 364:
-#line 1310 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 373: // duid: "duid" $@74 ":" "constant string"
+#line 1350 "dhcp6_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2254 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2368 "dhcp6_parser.cc"
     break;
 
-  case 365:
-#line 1316 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 374: // $@75: %empty
+#line 1356 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2262 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2376 "dhcp6_parser.cc"
     break;
 
-  case 366:
-#line 1318 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 375: // hw_address: "hw-address" $@75 ":" "constant string"
+#line 1358 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2272 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2386 "dhcp6_parser.cc"
     break;
 
-  case 367:
-#line 1324 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 376: // $@76: %empty
+#line 1364 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2280 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2394 "dhcp6_parser.cc"
     break;
 
-  case 368:
-#line 1326 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 377: // hostname: "hostname" $@76 ":" "constant string"
+#line 1366 "dhcp6_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2290 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2404 "dhcp6_parser.cc"
     break;
 
-  case 369:
-#line 1332 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 378: // $@77: %empty
+#line 1372 "dhcp6_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2301 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2415 "dhcp6_parser.cc"
     break;
 
-  case 370:
-#line 1337 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 379: // reservation_client_classes: "client-classes" $@77 ":" list_strings
+#line 1377 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2310 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2424 "dhcp6_parser.cc"
     break;
 
-  case 371:
-#line 1345 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 380: // $@78: %empty
+#line 1385 "dhcp6_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2321 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2435 "dhcp6_parser.cc"
     break;
 
-  case 372:
-#line 1350 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 381: // relay: "relay" $@78 ":" "{" relay_map "}"
+#line 1390 "dhcp6_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2330 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2444 "dhcp6_parser.cc"
     break;
 
-  case 373:
-#line 1355 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 382: // $@79: %empty
+#line 1395 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2338 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2452 "dhcp6_parser.cc"
     break;
 
-  case 374:
-#line 1357 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 383: // relay_map: "ip-address" $@79 ":" "constant string"
+#line 1397 "dhcp6_parser.yy"
+               {
+    ElementPtr ip(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2348 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2462 "dhcp6_parser.cc"
     break;
 
-  case 375:
-#line 1366 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 384: // $@80: %empty
+#line 1406 "dhcp6_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2359 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2473 "dhcp6_parser.cc"
     break;
 
-  case 376:
-#line 1371 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 385: // client_classes: "client-classes" $@80 ":" "[" client_classes_list "]"
+#line 1411 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2368 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2482 "dhcp6_parser.cc"
     break;
 
-  case 379:
-#line 1380 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 388: // $@81: %empty
+#line 1420 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2378 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2492 "dhcp6_parser.cc"
     break;
 
-  case 380:
-#line 1384 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 389: // client_class: "{" $@81 client_class_params "}"
+#line 1424 "dhcp6_parser.yy"
+                                     {
     ctx.stack_.pop_back();
 }
-#line 2386 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2500 "dhcp6_parser.cc"
     break;
 
-  case 390:
-#line 1404 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 399: // $@82: %empty
+#line 1444 "dhcp6_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2394 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2508 "dhcp6_parser.cc"
     break;
 
-  case 391:
-#line 1406 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 400: // client_class_test: "test" $@82 ":" "constant string"
+#line 1446 "dhcp6_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2404 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2518 "dhcp6_parser.cc"
     break;
 
-  case 392:
-#line 1415 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 401: // $@83: %empty
+#line 1455 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 2415 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2529 "dhcp6_parser.cc"
     break;
 
-  case 393:
-#line 1420 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 402: // server_id: "server-id" $@83 ":" "{" server_id_params "}"
+#line 1460 "dhcp6_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2424 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2538 "dhcp6_parser.cc"
     break;
 
-  case 403:
-#line 1438 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 412: // $@84: %empty
+#line 1478 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 2432 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2546 "dhcp6_parser.cc"
     break;
 
-  case 404:
-#line 1440 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 413: // server_id_type: "type" $@84 ":" duid_type
+#line 1480 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2441 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2555 "dhcp6_parser.cc"
     break;
 
-  case 405:
-#line 1445 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 2447 "dhcp6_parser.cc" // lalr1.cc:859
+  case 414: // duid_type: "LLT"
+#line 1485 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
+#line 2561 "dhcp6_parser.cc"
     break;
 
-  case 406:
-#line 1446 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 2453 "dhcp6_parser.cc" // lalr1.cc:859
+  case 415: // duid_type: "EN"
+#line 1486 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
+#line 2567 "dhcp6_parser.cc"
     break;
 
-  case 407:
-#line 1447 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 2459 "dhcp6_parser.cc" // lalr1.cc:859
+  case 416: // duid_type: "LL"
+#line 1487 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
+#line 2573 "dhcp6_parser.cc"
     break;
 
-  case 408:
-#line 1450 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 417: // htype: "htype" ":" "integer"
+#line 1490 "dhcp6_parser.yy"
+                           {
+    ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 2468 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2582 "dhcp6_parser.cc"
     break;
 
-  case 409:
-#line 1455 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 418: // $@85: %empty
+#line 1495 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2476 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2590 "dhcp6_parser.cc"
     break;
 
-  case 410:
-#line 1457 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 419: // identifier: "identifier" $@85 ":" "constant string"
+#line 1497 "dhcp6_parser.yy"
+               {
+    ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 2486 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2600 "dhcp6_parser.cc"
     break;
 
-  case 411:
-#line 1463 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 420: // time: "time" ":" "integer"
+#line 1503 "dhcp6_parser.yy"
+                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 2495 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2609 "dhcp6_parser.cc"
     break;
 
-  case 412:
-#line 1468 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 421: // enterprise_id: "enterprise-id" ":" "integer"
+#line 1508 "dhcp6_parser.yy"
+                                           {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 2504 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2618 "dhcp6_parser.cc"
     break;
 
-  case 413:
-#line 1475 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 422: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1515 "dhcp6_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2513 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2627 "dhcp6_parser.cc"
     break;
 
-  case 414:
-#line 1482 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 423: // packet_timeline: "packet-timeline" ":" "boolean"
+#line 1520 "dhcp6_parser.yy"
+                                               {
+    ElementPtr timeline(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("packet-timeline", timeline);
+}
+#line 2636 "dhcp6_parser.cc"
+    break;
+
+  case 424: // $@86: %empty
+#line 1527 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2524 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2647 "dhcp6_parser.cc"
     break;
 
-  case 415:
-#line 1487 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 425: // control_socket: "control-socket" $@86 ":" "{" control_socket_params "}"
+#line 1532 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2533 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2656 "dhcp6_parser.cc"
     break;
 
-  case 420:
-#line 1500 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 430: // $@87: %empty
+#line 1545 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2541 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2664 "dhcp6_parser.cc"
     break;
 
-  case 421:
-#line 1502 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 431: // socket_type: "socket-type" $@87 ":" "constant string"
+#line 1547 "dhcp6_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2551 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2674 "dhcp6_parser.cc"
     break;
 
-  case 422:
-#line 1508 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 432: // $@88: %empty
+#line 1553 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2559 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2682 "dhcp6_parser.cc"
     break;
 
-  case 423:
-#line 1510 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 433: // socket_name: "socket-name" $@88 ":" "constant string"
+#line 1555 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2569 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2692 "dhcp6_parser.cc"
     break;
 
-  case 424:
-#line 1518 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 434: // $@89: %empty
+#line 1563 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2580 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2703 "dhcp6_parser.cc"
     break;
 
-  case 425:
-#line 1523 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 435: // dhcp_ddns: "dhcp-ddns" $@89 ":" "{" dhcp_ddns_params "}"
+#line 1568 "dhcp6_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2589 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2712 "dhcp6_parser.cc"
     break;
 
-  case 426:
-#line 1528 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 436: // $@90: %empty
+#line 1573 "dhcp6_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2599 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2722 "dhcp6_parser.cc"
     break;
 
-  case 427:
-#line 1532 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 437: // sub_dhcp_ddns: "{" $@90 dhcp_ddns_params "}"
+#line 1577 "dhcp6_parser.yy"
+                                  {
     // parsing completed
 }
-#line 2607 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2730 "dhcp6_parser.cc"
     break;
 
-  case 446:
-#line 1558 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 456: // enable_updates: "enable-updates" ":" "boolean"
+#line 1603 "dhcp6_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2616 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2739 "dhcp6_parser.cc"
     break;
 
-  case 447:
-#line 1563 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 457: // $@91: %empty
+#line 1608 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2624 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2747 "dhcp6_parser.cc"
     break;
 
-  case 448:
-#line 1565 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 458: // qualifying_suffix: "qualifying-suffix" $@91 ":" "constant string"
+#line 1610 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2634 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2757 "dhcp6_parser.cc"
     break;
 
-  case 449:
-#line 1571 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 459: // $@92: %empty
+#line 1616 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2642 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2765 "dhcp6_parser.cc"
     break;
 
-  case 450:
-#line 1573 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 460: // server_ip: "server-ip" $@92 ":" "constant string"
+#line 1618 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2652 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2775 "dhcp6_parser.cc"
     break;
 
-  case 451:
-#line 1579 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 461: // server_port: "server-port" ":" "integer"
+#line 1624 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2661 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2784 "dhcp6_parser.cc"
     break;
 
-  case 452:
-#line 1584 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 462: // $@93: %empty
+#line 1629 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2669 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2792 "dhcp6_parser.cc"
     break;
 
-  case 453:
-#line 1586 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 463: // sender_ip: "sender-ip" $@93 ":" "constant string"
+#line 1631 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2679 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2802 "dhcp6_parser.cc"
     break;
 
-  case 454:
-#line 1592 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 464: // sender_port: "sender-port" ":" "integer"
+#line 1637 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2688 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2811 "dhcp6_parser.cc"
     break;
 
-  case 455:
-#line 1597 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 465: // max_queue_size: "max-queue-size" ":" "integer"
+#line 1642 "dhcp6_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2697 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2820 "dhcp6_parser.cc"
     break;
 
-  case 456:
-#line 1602 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 466: // $@94: %empty
+#line 1647 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2705 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2828 "dhcp6_parser.cc"
     break;
 
-  case 457:
-#line 1604 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 467: // ncr_protocol: "ncr-protocol" $@94 ":" ncr_protocol_value
+#line 1649 "dhcp6_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2714 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2837 "dhcp6_parser.cc"
     break;
 
-  case 458:
-#line 1610 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2720 "dhcp6_parser.cc" // lalr1.cc:859
+  case 468: // ncr_protocol_value: "UDP"
+#line 1655 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 2843 "dhcp6_parser.cc"
     break;
 
-  case 459:
-#line 1611 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2726 "dhcp6_parser.cc" // lalr1.cc:859
+  case 469: // ncr_protocol_value: "TCP"
+#line 1656 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 2849 "dhcp6_parser.cc"
     break;
 
-  case 460:
-#line 1614 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 470: // $@95: %empty
+#line 1659 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2734 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2857 "dhcp6_parser.cc"
     break;
 
-  case 461:
-#line 1616 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 471: // ncr_format: "ncr-format" $@95 ":" ncr_format_value
+#line 1661 "dhcp6_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2744 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2866 "dhcp6_parser.cc"
     break;
 
-  case 462:
-#line 1622 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 472: // ncr_format_value: "JSON"
+#line 1667 "dhcp6_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 2872 "dhcp6_parser.cc"
+    break;
+
+  case 473: // ncr_format_value: "BINARY"
+#line 1668 "dhcp6_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 2878 "dhcp6_parser.cc"
+    break;
+
+  case 474: // always_include_fqdn: "always-include-fqdn" ":" "boolean"
+#line 1671 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2753 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2887 "dhcp6_parser.cc"
     break;
 
-  case 463:
-#line 1627 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 475: // allow_client_update: "allow-client-update" ":" "boolean"
+#line 1676 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("allow-client-update",  b);
 }
-#line 2762 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2896 "dhcp6_parser.cc"
     break;
 
-  case 464:
-#line 1632 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 476: // override_no_update: "override-no-update" ":" "boolean"
+#line 1681 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2771 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2905 "dhcp6_parser.cc"
     break;
 
-  case 465:
-#line 1637 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 477: // override_client_update: "override-client-update" ":" "boolean"
+#line 1686 "dhcp6_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2780 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2914 "dhcp6_parser.cc"
     break;
 
-  case 466:
-#line 1642 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 478: // $@96: %empty
+#line 1691 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2788 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2922 "dhcp6_parser.cc"
     break;
 
-  case 467:
-#line 1644 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 479: // replace_client_name: "replace-client-name" $@96 ":" replace_client_name_value
+#line 1693 "dhcp6_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2797 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2931 "dhcp6_parser.cc"
     break;
 
-  case 468:
-#line 1650 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
+  case 480: // replace_client_name_value: "when-present"
+#line 1699 "dhcp6_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2805 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2939 "dhcp6_parser.cc"
     break;
 
-  case 469:
-#line 1653 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 481: // replace_client_name_value: "never"
+#line 1702 "dhcp6_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2813 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2947 "dhcp6_parser.cc"
     break;
 
-  case 470:
-#line 1656 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 482: // replace_client_name_value: "always"
+#line 1705 "dhcp6_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2821 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2955 "dhcp6_parser.cc"
     break;
 
-  case 471:
-#line 1659 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 483: // replace_client_name_value: "when-not-present"
+#line 1708 "dhcp6_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2829 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2963 "dhcp6_parser.cc"
     break;
 
-  case 472:
-#line 1662 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 484: // replace_client_name_value: "boolean"
+#line 1711 "dhcp6_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2838 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2972 "dhcp6_parser.cc"
     break;
 
-  case 473:
-#line 1668 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 485: // $@97: %empty
+#line 1717 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2846 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2980 "dhcp6_parser.cc"
     break;
 
-  case 474:
-#line 1670 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 486: // generated_prefix: "generated-prefix" $@97 ":" "constant string"
+#line 1719 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 2856 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2990 "dhcp6_parser.cc"
     break;
 
-  case 475:
-#line 1678 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 487: // $@98: %empty
+#line 1727 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2864 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2998 "dhcp6_parser.cc"
     break;
 
-  case 476:
-#line 1680 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 488: // dhcp4_json_object: "Dhcp4" $@98 ":" value
+#line 1729 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2873 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3007 "dhcp6_parser.cc"
     break;
 
-  case 477:
-#line 1685 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 489: // $@99: %empty
+#line 1734 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2881 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3015 "dhcp6_parser.cc"
     break;
 
-  case 478:
-#line 1687 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 490: // dhcpddns_json_object: "DhcpDdns" $@99 ":" value
+#line 1736 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2890 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3024 "dhcp6_parser.cc"
     break;
 
-  case 479:
-#line 1697 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 491: // $@100: %empty
+#line 1746 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 2901 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3035 "dhcp6_parser.cc"
     break;
 
-  case 480:
-#line 1702 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 492: // logging_object: "Logging" $@100 ":" "{" logging_params "}"
+#line 1751 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2910 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3044 "dhcp6_parser.cc"
     break;
 
-  case 484:
-#line 1719 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 497: // $@101: %empty
+#line 1769 "dhcp6_parser.yy"
+                     {
+    ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", m);
+    ctx.stack_.push_back(m);
+    ctx.enter(ctx.ASYNC_LOGGING);
+}
+#line 3055 "dhcp6_parser.cc"
+    break;
+
+  case 498: // async_logging: "async" $@101 ":" "{" async_logging_params "}"
+#line 1774 "dhcp6_parser.yy"
+                                                           {
+    ctx.stack_.pop_back();
+    ctx.leave();
+}
+#line 3064 "dhcp6_parser.cc"
+    break;
+
+  case 504: // queue_size: "queue-size" ":" "integer"
+#line 1788 "dhcp6_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 3073 "dhcp6_parser.cc"
+    break;
+
+  case 505: // $@102: %empty
+#line 1793 "dhcp6_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3081 "dhcp6_parser.cc"
+    break;
+
+  case 506: // overflow_policy: "overflow-policy" $@102 ":" "constant string"
+#line 1795 "dhcp6_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 3091 "dhcp6_parser.cc"
+    break;
+
+  case 507: // $@103: %empty
+#line 1803 "dhcp6_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 2921 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3102 "dhcp6_parser.cc"
     break;
 
-  case 485:
-#line 1724 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 508: // loggers: "loggers" $@103 ":" "[" loggers_entries "]"
+#line 1808 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2930 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3111 "dhcp6_parser.cc"
     break;
 
-  case 488:
-#line 1736 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 511: // $@104: %empty
+#line 1820 "dhcp6_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 2940 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3121 "dhcp6_parser.cc"
     break;
 
-  case 489:
-#line 1740 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 512: // logger_entry: "{" $@104 logger_params "}"
+#line 1824 "dhcp6_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 2948 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3129 "dhcp6_parser.cc"
     break;
 
-  case 497:
-#line 1755 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 521: // debuglevel: "debuglevel" ":" "integer"
+#line 1840 "dhcp6_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 2957 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3138 "dhcp6_parser.cc"
     break;
 
-  case 498:
-#line 1760 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 522: // $@105: %empty
+#line 1845 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2965 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3146 "dhcp6_parser.cc"
     break;
 
-  case 499:
-#line 1762 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 523: // severity: "severity" $@105 ":" "constant string"
+#line 1847 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 2975 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3156 "dhcp6_parser.cc"
     break;
 
-  case 500:
-#line 1768 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 524: // $@106: %empty
+#line 1853 "dhcp6_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 2986 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3167 "dhcp6_parser.cc"
     break;
 
-  case 501:
-#line 1773 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 525: // output_options_list: "output_options" $@106 ":" "[" output_options_list_content "]"
+#line 1858 "dhcp6_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2995 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3176 "dhcp6_parser.cc"
     break;
 
-  case 504:
-#line 1782 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 528: // $@107: %empty
+#line 1867 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3005 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3186 "dhcp6_parser.cc"
     break;
 
-  case 505:
-#line 1786 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 529: // output_entry: "{" $@107 output_params "}"
+#line 1871 "dhcp6_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3013 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3194 "dhcp6_parser.cc"
     break;
 
-  case 508:
-#line 1794 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 532: // $@108: %empty
+#line 1879 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3021 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3202 "dhcp6_parser.cc"
     break;
 
-  case 509:
-#line 1796 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 533: // output_param: "output" $@108 ":" "constant string"
+#line 1881 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3031 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3212 "dhcp6_parser.cc"
+    break;
+
+  case 534: // $@109: %empty
+#line 1889 "dhcp6_parser.yy"
+                              {
+    ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limits", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.RATE_LIMITS);
+}
+#line 3223 "dhcp6_parser.cc"
+    break;
+
+  case 535: // rate_limits_list: "rate-limits" $@109 ":" "[" rate_limits_list_content "]"
+#line 1894 "dhcp6_parser.yy"
+                                                                 {
+    ctx.stack_.pop_back();
+    ctx.leave();
+}
+#line 3232 "dhcp6_parser.cc"
+    break;
+
+  case 540: // $@110: %empty
+#line 1907 "dhcp6_parser.yy"
+                                 {
+    ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->add(m);
+    ctx.stack_.push_back(m);
+}
+#line 3242 "dhcp6_parser.cc"
+    break;
+
+  case 541: // rate_limit_entry: "{" $@110 rate_limit_params "}"
+#line 1911 "dhcp6_parser.yy"
+                                   {
+    ctx.stack_.pop_back();
+}
+#line 3250 "dhcp6_parser.cc"
+    break;
+
+  case 548: // $@111: %empty
+#line 1925 "dhcp6_parser.yy"
+                            {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3258 "dhcp6_parser.cc"
+    break;
+
+  case 549: // rate_limit_message: "message" $@111 ":" "constant string"
+#line 1927 "dhcp6_parser.yy"
+               {
+    ElementPtr msg(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("message", msg);
+    ctx.leave();
+}
+#line 3268 "dhcp6_parser.cc"
     break;
 
+  case 550: // rate_limit_sample: "sample" ":" "integer"
+#line 1933 "dhcp6_parser.yy"
+                                        {
+    ElementPtr sample(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("sample", sample);
+}
+#line 3277 "dhcp6_parser.cc"
+    break;
+
+  case 551: // rate_limit_rate: "rate" ":" "integer"
+#line 1938 "dhcp6_parser.yy"
+                                    {
+    ElementPtr rate(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate", rate);
+}
+#line 3286 "dhcp6_parser.cc"
+    break;
+
+  case 552: // rate_limit_interval: "interval" ":" "integer"
+#line 1943 "dhcp6_parser.yy"
+                                            {
+    ElementPtr interval(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("interval", interval);
+}
+#line 3295 "dhcp6_parser.cc"
+    break;
+
+
+#line 3299 "dhcp6_parser.cc"
 
-#line 3035 "dhcp6_parser.cc" // lalr1.cc:859
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3059,7 +3327,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3070,7 +3340,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3087,69 +3357,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3157,6 +3439,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3165,12 +3448,12 @@ namespace isc { namespace dhcp {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -3181,26 +3464,112 @@ namespace isc { namespace dhcp {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   Dhcp6Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp6Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp6Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp6Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp6Parser::context.
+  Dhcp6Parser::context::context (const Dhcp6Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
 
+  int
+  Dhcp6Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp6Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3219,41 +3588,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp6Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3262,22 +3622,23 @@ namespace isc { namespace dhcp {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -3286,575 +3647,618 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp6Parser::yypact_ninf_ = -490;
+  const short Dhcp6Parser::yypact_ninf_ = -494;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   Dhcp6Parser::yypact_[] =
   {
-     185,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,    46,    19,    91,   113,   117,   119,   160,
-     193,   227,   228,   249,   250,   251,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-      19,    16,    17,    31,   182,    23,    37,    68,    62,    32,
-     100,    11,   143,  -490,   205,   257,   258,   253,   261,  -490,
-    -490,  -490,  -490,   262,  -490,    40,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,   263,   264,   265,   268,   270,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   272,
-    -490,  -490,  -490,    92,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   269,  -490,  -490,
-    -490,  -490,  -490,  -490,   275,   277,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,   101,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,   147,  -490,  -490,  -490,  -490,   282,  -490,
-     283,   284,  -490,  -490,  -490,   158,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-     286,   292,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,   293,  -490,  -490,  -490,   294,  -490,  -490,   291,   298,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,   299,  -490,  -490,  -490,  -490,   314,   303,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   174,  -490,  -490,
-    -490,   319,  -490,  -490,   321,  -490,   322,   323,  -490,  -490,
-     324,   325,   326,   327,  -490,  -490,  -490,   176,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,    19,    19,  -490,   128,   328,
-     329,   330,   331,  -490,    17,  -490,   332,   333,   334,   164,
-     202,   203,   206,   208,   335,   338,   339,   341,   343,   344,
-     345,   346,   347,   348,   215,   350,   351,    31,  -490,   352,
-    -490,    48,   353,   354,   355,   356,   357,   224,   223,   360,
-     361,   362,   363,    23,  -490,   364,   365,    37,  -490,   366,
-     233,   368,   235,   236,    68,  -490,   371,   372,   373,   374,
-     375,   376,  -490,    62,   377,   378,   245,   380,   381,   382,
-     247,  -490,    32,   384,   252,  -490,   100,   385,   386,   -41,
-    -490,   254,   387,   389,   259,   391,   260,   266,   392,   395,
-     267,   271,   273,   274,   398,   399,   143,  -490,  -490,  -490,
-     401,   402,   403,    19,    19,  -490,   405,   408,   409,  -490,
-    -490,  -490,  -490,  -490,   412,   413,   414,   415,   416,   417,
-     418,   419,   420,   421,  -490,   422,   425,  -490,   428,  -490,
-    -490,  -490,  -490,   400,   423,  -490,  -490,  -490,   431,   432,
-     288,   301,   302,  -490,  -490,   305,   307,   435,   438,  -490,
-     309,   440,  -490,   312,  -490,   313,  -490,  -490,  -490,   428,
-     428,   428,   316,   317,   318,  -490,   320,   336,  -490,   337,
-     340,   342,  -490,  -490,   349,  -490,  -490,   358,    19,  -490,
-    -490,   359,   367,  -490,   369,  -490,  -490,     1,   370,  -490,
-    -490,  -490,  -490,    49,   379,  -490,    19,    31,   383,  -490,
-    -490,   182,    14,    14,   444,   449,   451,   -36,    19,    65,
-      34,   452,    66,    84,    83,   143,  -490,  -490,   456,  -490,
-      48,   454,   457,  -490,  -490,  -490,  -490,  -490,   458,   396,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,   180,  -490,   183,  -490,  -490,   455,
-    -490,  -490,  -490,  -490,   462,   464,   465,   466,  -490,   184,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-     187,  -490,   470,   468,  -490,  -490,   472,   469,  -490,  -490,
-     474,   478,  -490,  -490,  -490,   102,  -490,  -490,  -490,   477,
-    -490,  -490,   146,  -490,  -490,  -490,   220,  -490,   479,   481,
-    -490,   483,   484,   485,   486,   487,   488,   190,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   490,   493,   494,
-    -490,  -490,   194,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,   198,  -490,  -490,  -490,   200,   388,   390,  -490,  -490,
-     496,   497,  -490,  -490,   499,   500,  -490,  -490,   501,   505,
-    -490,  -490,   491,  -490,   506,   383,  -490,  -490,   507,   508,
-     509,   510,   393,   394,   397,   404,    14,  -490,  -490,    23,
-    -490,   444,    32,  -490,   449,   100,  -490,   451,   -36,  -490,
-    -490,    65,  -490,    34,  -490,    11,  -490,   452,   406,   407,
-     410,   411,   424,   426,    66,  -490,   511,   513,   427,   429,
-     430,    84,  -490,   514,   515,    83,  -490,  -490,  -490,   503,
-     517,  -490,    37,  -490,   454,    68,  -490,   457,    62,  -490,
-     458,   518,  -490,   516,  -490,   212,   433,   434,   436,  -490,
-    -490,  -490,  -490,  -490,   201,  -490,   520,  -490,   521,  -490,
-    -490,  -490,  -490,   204,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,   -29,   437,  -490,  -490,  -490,  -490,   439,   441,
-    -490,  -490,   442,   207,  -490,   210,  -490,   522,  -490,   443,
-     519,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,   221,  -490,    59,   519,
-    -490,  -490,   527,  -490,  -490,  -490,   211,  -490,  -490,  -490,
-    -490,  -490,   530,   445,   531,    59,  -490,   533,  -490,   447,
-    -490,   529,  -490,  -490,   230,  -490,   446,   529,  -490,  -490,
-     217,  -490,  -490,   535,   446,  -490,   448,  -490,  -490
+      74,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,   141,    20,    93,   153,   175,   203,   250,
+     254,   264,   268,   272,   284,   288,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+      20,    91,    18,    27,   241,    19,    33,    44,    81,    28,
+      -8,   -41,    96,  -494,   261,   295,   298,   296,   302,  -494,
+    -494,  -494,  -494,   305,  -494,    45,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,   317,   318,   319,   320,   321,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,   322,
+     324,  -494,  -494,  -494,   100,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,   323,
+    -494,  -494,  -494,  -494,  -494,  -494,   325,   326,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,   103,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,   116,  -494,  -494,  -494,  -494,
+     328,  -494,   329,   330,  -494,  -494,  -494,   135,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,   327,   303,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,   332,  -494,  -494,  -494,   333,  -494,  -494,
+     331,   335,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,   336,  -494,  -494,  -494,  -494,   334,   338,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,   136,
+    -494,  -494,  -494,   339,  -494,  -494,   340,  -494,   341,   342,
+    -494,  -494,   343,   344,   345,   346,  -494,  -494,  -494,   172,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,    20,    20,  -494,
+     201,   348,   349,   350,   351,  -494,    18,  -494,   352,   353,
+     354,   208,   209,   210,   211,   212,   360,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   223,   222,   372,   373,
+      27,  -494,   374,  -494,    17,   375,   376,   377,   378,   379,
+     233,   235,   381,   382,   383,   385,    19,  -494,   386,   387,
+      33,  -494,   388,   243,   389,   245,   247,    44,  -494,   391,
+     393,   395,   396,   397,   398,  -494,    81,   399,   400,   257,
+     403,   405,   406,   258,  -494,    28,   408,   263,  -494,    -8,
+     409,   410,    50,  -494,   265,   411,   413,   269,   415,   270,
+     271,   419,   420,   273,   275,   276,   277,   421,   423,    96,
+    -494,  -494,  -494,   427,   425,   426,    20,    20,  -494,   429,
+     430,   433,  -494,  -494,  -494,  -494,  -494,   436,   437,   438,
+     439,   441,   443,   444,   445,   446,   447,  -494,  -494,   448,
+     450,  -494,   453,  -494,  -494,  -494,  -494,   451,   457,  -494,
+    -494,  -494,   456,   458,   301,   312,   314,  -494,  -494,   315,
+     337,   462,   461,  -494,   347,   463,  -494,   355,  -494,   356,
+    -494,  -494,  -494,   453,   453,   453,   357,   358,   359,  -494,
+     370,   371,  -494,   380,   384,   390,  -494,  -494,   392,  -494,
+    -494,   394,    20,  -494,  -494,   401,   402,  -494,   404,  -494,
+    -494,   111,    31,  -494,  -494,  -494,  -494,    38,   407,  -494,
+      20,    27,    53,  -494,  -494,   241,   108,   108,   464,   465,
+     466,   -33,    20,   219,    35,   467,    82,    24,   204,    96,
+    -494,  -494,   471,  -494,    17,   469,   470,  -494,  -494,  -494,
+    -494,  -494,   472,   412,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+     176,  -494,  -494,   221,  -494,  -494,  -494,   474,  -494,  -494,
+    -494,  -494,   476,   479,  -494,   480,  -494,   481,   484,  -494,
+     224,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,   230,  -494,   483,   475,  -494,  -494,
+     485,   487,  -494,  -494,   486,   490,  -494,  -494,  -494,   104,
+    -494,  -494,  -494,   488,  -494,  -494,   183,  -494,  -494,  -494,
+     187,  -494,   489,   493,  -494,   494,   496,   497,   498,   499,
+     500,   232,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,   506,   507,   508,  -494,  -494,   234,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,   236,  -494,  -494,  -494,   240,
+     414,   416,  -494,  -494,   509,   510,  -494,  -494,   511,   513,
+    -494,  -494,   512,   516,  -494,  -494,   514,  -494,   519,   520,
+      53,  -494,  -494,   521,   522,   523,   524,   316,   417,   525,
+     418,   527,   422,   428,   108,  -494,  -494,    19,  -494,   464,
+      28,  -494,   465,    -8,  -494,   466,   -33,  -494,  -494,   219,
+    -494,    35,  -494,   -41,  -494,   467,   431,   432,   434,   435,
+     440,   442,    82,  -494,   528,   529,   449,   452,   454,    24,
+    -494,   531,   532,   204,  -494,  -494,  -494,   533,   534,  -494,
+      33,  -494,   469,    44,  -494,   470,    81,  -494,   472,   537,
+    -494,   538,   539,  -494,   297,   424,   459,   460,  -494,  -494,
+     468,  -494,   473,  -494,  -494,  -494,   242,  -494,   530,  -494,
+     540,  -494,  -494,  -494,  -494,   244,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,   -42,   477,  -494,  -494,  -494,  -494,
+     478,   492,  -494,  -494,   502,   246,  -494,   248,  -494,   541,
+    -494,   503,   543,   -46,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,   266,  -494,   549,  -494,  -494,   252,  -494,  -494,  -494,
+      61,   543,  -494,   455,   551,   -46,  -494,  -494,   552,  -494,
+    -494,  -494,  -494,   256,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,   505,  -494,   554,   482,   555,   556,    61,  -494,  -494,
+     542,  -494,   515,   557,  -494,   558,  -494,   560,  -494,   274,
+    -494,  -494,   562,   568,  -494,   491,   558,  -494,   185,  -494,
+     560,  -494,   260,  -494,  -494,  -494,   559,   569,   572,   262,
+    -494,  -494,  -494,  -494,  -494,  -494,   573,   491,  -494,   574,
+     517,   518,   535,   185,  -494,   526,  -494,   544,  -494,  -494,
+    -494,  -494,  -494,  -494
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,    24,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     1,    41,    34,    30,
       29,    26,    27,    28,    33,     3,    31,    32,    54,     5,
-      65,     7,    98,     9,   196,    11,   298,    13,   318,    15,
-     345,    17,   237,    19,   272,    21,   161,    23,   426,    25,
-      43,    37,     0,     0,     0,     0,     0,     0,   347,   239,
-     274,     0,     0,    45,     0,    44,     0,     0,    38,    63,
-     479,   475,   477,     0,    62,     0,    56,    58,    60,    61,
-      59,    96,   102,   104,     0,     0,     0,     0,     0,   188,
-     229,   264,   136,   151,   144,   375,   153,   172,   392,     0,
-     414,   424,    90,     0,    67,    69,    70,    71,    72,    73,
-      75,    76,    77,    78,    80,    79,    84,    85,    74,    82,
-      83,    81,    86,    87,    88,    89,   100,     0,   379,   290,
-     310,   217,   219,   221,     0,     0,   225,   223,   337,   371,
-     216,   200,   201,   202,   203,     0,   198,   207,   208,   209,
-     212,   214,   210,   211,   204,   205,   206,   213,   215,   306,
-     308,   305,   303,     0,   300,   302,   304,   330,     0,   333,
-       0,     0,   329,   325,   328,     0,   320,   322,   323,   326,
-     327,   324,   369,   359,   361,   363,   365,   367,   358,   357,
-       0,   348,   349,   353,   354,   351,   355,   356,   352,   254,
-     130,     0,   258,   256,   261,     0,   250,   251,     0,   240,
-     241,   243,   253,   244,   245,   246,   260,   247,   248,   249,
-     285,     0,   283,   284,   287,   288,     0,   275,   276,   278,
-     279,   280,   281,   282,   168,   170,   165,     0,   163,   166,
-     167,     0,   447,   449,     0,   452,     0,     0,   456,   460,
-       0,     0,     0,     0,   466,   473,   445,     0,   428,   430,
-     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
-     441,   442,   443,   444,    42,     0,     0,    35,     0,     0,
-       0,     0,     0,    53,     0,    55,     0,     0,     0,     0,
+      65,     7,    99,     9,   205,    11,   307,    13,   327,    15,
+     354,    17,   246,    19,   281,    21,   170,    23,   436,    25,
+      43,    37,     0,     0,     0,     0,     0,     0,   356,   248,
+     283,     0,     0,    45,     0,    44,     0,     0,    38,    63,
+     491,   487,   489,     0,    62,     0,    56,    58,    60,    61,
+      59,    97,   103,   105,     0,     0,     0,     0,     0,   197,
+     238,   273,   145,   160,   153,   384,   162,   181,   401,     0,
+       0,   424,   434,    91,     0,    67,    69,    70,    71,    72,
+      73,    75,    76,    77,    78,    80,    79,    84,    85,    74,
+      82,    83,    81,    86,    87,    88,    89,    90,   101,     0,
+     388,   299,   319,   226,   228,   230,     0,     0,   234,   232,
+     346,   380,   225,   209,   210,   211,   212,     0,   207,   216,
+     217,   218,   221,   223,   219,   220,   213,   214,   215,   222,
+     224,   315,   317,   314,   312,     0,   309,   311,   313,   339,
+       0,   342,     0,     0,   338,   334,   337,     0,   329,   331,
+     332,   335,   336,   333,   378,   368,   370,   372,   374,   376,
+     367,   366,     0,   357,   358,   362,   363,   360,   364,   365,
+     361,   263,   134,     0,   267,   265,   270,     0,   259,   260,
+       0,   249,   250,   252,   262,   253,   254,   255,   269,   256,
+     257,   258,   294,     0,   292,   293,   296,   297,     0,   284,
+     285,   287,   288,   289,   290,   291,   177,   179,   174,     0,
+     172,   175,   176,     0,   457,   459,     0,   462,     0,     0,
+     466,   470,     0,     0,     0,     0,   478,   485,   455,     0,
+     438,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+     449,   450,   451,   452,   453,   454,    42,     0,     0,    35,
+       0,     0,     0,     0,     0,    53,     0,    55,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    66,     0,   100,   390,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   206,     0,     0,
+       0,   308,     0,     0,     0,     0,     0,     0,   328,     0,
+       0,     0,     0,     0,     0,   355,     0,     0,     0,     0,
+       0,     0,     0,     0,   247,     0,     0,     0,   282,     0,
+       0,     0,     0,   171,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    66,     0,
-      99,   381,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   197,     0,     0,     0,   299,     0,
-       0,     0,     0,     0,     0,   319,     0,     0,     0,     0,
-       0,     0,   346,     0,     0,     0,     0,     0,     0,     0,
-       0,   238,     0,     0,     0,   273,     0,     0,     0,     0,
-     162,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   427,    46,    39,
-       0,     0,     0,     0,     0,    57,     0,     0,     0,    91,
-      92,    93,    94,    95,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   413,     0,     0,    68,     0,   390,
-     388,   389,   387,     0,   382,   383,   385,   386,     0,     0,
-       0,     0,     0,   227,   228,     0,     0,     0,     0,   199,
-       0,     0,   301,     0,   332,     0,   335,   336,   321,     0,
-       0,     0,     0,     0,     0,   350,     0,     0,   252,     0,
-       0,     0,   263,   242,     0,   289,   277,     0,     0,   164,
-     446,     0,     0,   451,     0,   454,   455,     0,     0,   462,
-     463,   464,   465,     0,     0,   429,     0,     0,     0,   476,
-     478,     0,     0,     0,   190,   231,   266,     0,    43,     0,
-       0,   155,     0,     0,     0,     0,    47,   101,     0,   380,
-       0,   292,   312,   218,   220,   222,   226,   224,   339,     0,
-     307,    36,   309,   331,   334,   370,   360,   362,   364,   366,
-     368,   255,   131,   259,   257,   262,   286,   169,   171,   448,
-     450,   453,   458,   459,   457,   461,   468,   469,   470,   471,
-     472,   467,   474,    40,     0,   484,     0,   481,   483,     0,
-     118,   124,   126,   128,     0,     0,     0,     0,   117,     0,
-     106,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-       0,   194,     0,   191,   192,   235,     0,   232,   233,   270,
-       0,   267,   268,   142,   143,     0,   138,   140,   141,     0,
-     150,   148,     0,   146,   149,   377,     0,   159,     0,   156,
-     157,     0,     0,     0,     0,     0,     0,     0,   174,   176,
-     177,   178,   179,   180,   181,   403,   409,     0,     0,     0,
-     402,   401,     0,   394,   396,   399,   397,   398,   400,   420,
-     422,     0,   416,   418,   419,     0,    49,     0,   384,   296,
-       0,   293,   294,   316,     0,   313,   314,   343,     0,   340,
-     341,   373,     0,    64,     0,     0,   480,    97,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   103,   105,     0,
-     189,     0,   239,   230,     0,   274,   265,     0,     0,   137,
-     152,     0,   145,     0,   376,     0,   154,     0,     0,     0,
-       0,     0,     0,     0,     0,   173,     0,     0,     0,     0,
-       0,     0,   393,     0,     0,     0,   415,   425,    51,     0,
-      50,   391,     0,   291,     0,     0,   311,     0,   347,   338,
-       0,     0,   372,     0,   482,     0,     0,     0,     0,   132,
-     133,   134,   135,   107,     0,   193,     0,   234,     0,   269,
-     139,   147,   378,     0,   158,   182,   183,   184,   185,   186,
-     187,   175,     0,     0,   408,   411,   412,   395,     0,     0,
-     417,    48,     0,     0,   295,     0,   315,     0,   342,     0,
-       0,   120,   121,   122,   123,   119,   125,   127,   129,   195,
-     236,   271,   160,   405,   406,   407,   404,   410,   421,   423,
-      52,   297,   317,   344,   374,   488,     0,   486,     0,     0,
-     485,   500,     0,   498,   496,   492,     0,   490,   494,   495,
-     493,   487,     0,     0,     0,     0,   489,     0,   497,     0,
-     491,     0,   499,   504,     0,   502,     0,     0,   501,   508,
-       0,   506,   503,     0,     0,   505,     0,   507,   509
+     437,    46,    39,     0,     0,     0,     0,     0,    57,     0,
+       0,     0,    92,    93,    94,    95,    96,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   422,   423,     0,
+       0,    68,     0,   399,   397,   398,   396,     0,   391,   392,
+     394,   395,     0,     0,     0,     0,     0,   236,   237,     0,
+       0,     0,     0,   208,     0,     0,   310,     0,   341,     0,
+     344,   345,   330,     0,     0,     0,     0,     0,     0,   359,
+       0,     0,   261,     0,     0,     0,   272,   251,     0,   298,
+     286,     0,     0,   173,   456,     0,     0,   461,     0,   464,
+     465,     0,     0,   474,   475,   476,   477,     0,     0,   439,
+       0,     0,     0,   488,   490,     0,     0,     0,   199,   240,
+     275,     0,    43,     0,     0,   164,     0,     0,     0,     0,
+      47,   102,     0,   389,     0,   301,   321,   227,   229,   231,
+     235,   233,   348,     0,   316,    36,   318,   340,   343,   379,
+     369,   371,   373,   375,   377,   264,   135,   268,   266,   271,
+     295,   178,   180,   458,   460,   463,   468,   469,   467,   472,
+     473,   471,   480,   481,   482,   483,   484,   479,   486,    40,
+       0,   507,   497,     0,   493,   496,   495,     0,   122,   128,
+     130,   132,     0,     0,   138,     0,   140,     0,     0,   121,
+       0,   107,   109,   110,   111,   112,   113,   114,   115,   116,
+     118,   117,   119,   120,     0,   203,     0,   200,   201,   244,
+       0,   241,   242,   279,     0,   276,   277,   151,   152,     0,
+     147,   149,   150,     0,   159,   157,     0,   155,   158,   386,
+       0,   168,     0,   165,   166,     0,     0,     0,     0,     0,
+       0,     0,   183,   185,   186,   187,   188,   189,   190,   412,
+     418,     0,     0,     0,   411,   410,     0,   403,   405,   408,
+     406,   407,   409,   430,   432,     0,   426,   428,   429,     0,
+      49,     0,   393,   305,     0,   302,   303,   325,     0,   322,
+     323,   352,     0,   349,   350,   382,     0,    64,     0,     0,
+       0,   492,    98,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   104,   106,     0,   198,     0,
+     248,   239,     0,   283,   274,     0,     0,   146,   161,     0,
+     154,     0,   385,     0,   163,     0,     0,     0,     0,     0,
+       0,     0,     0,   182,     0,     0,     0,     0,     0,     0,
+     402,     0,     0,     0,   425,   435,    51,     0,    50,   400,
+       0,   300,     0,     0,   320,     0,   356,   347,     0,     0,
+     381,     0,     0,   494,     0,     0,     0,     0,   136,   137,
+       0,   142,     0,   143,   144,   108,     0,   202,     0,   243,
+       0,   278,   148,   156,   387,     0,   167,   191,   192,   193,
+     194,   195,   196,   184,     0,     0,   417,   420,   421,   404,
+       0,     0,   427,    48,     0,     0,   304,     0,   324,     0,
+     351,     0,     0,     0,   124,   125,   126,   127,   123,   129,
+     131,   133,   139,   141,   204,   245,   280,   169,   414,   415,
+     416,   413,   419,   431,   433,    52,   306,   326,   353,   383,
+     511,     0,   509,     0,   505,   503,     0,   499,   501,   502,
+       0,     0,   508,     0,     0,     0,   498,   524,     0,   522,
+     534,   520,   515,     0,   513,   517,   518,   516,   519,   510,
+     504,     0,   500,     0,     0,     0,     0,     0,   512,   506,
+       0,   521,     0,     0,   514,     0,   523,   536,   528,     0,
+     526,   540,     0,   537,   538,     0,     0,   525,     0,   535,
+       0,   532,     0,   530,   527,   548,     0,     0,     0,     0,
+     542,   544,   545,   546,   547,   539,     0,     0,   529,     0,
+       0,     0,     0,     0,   541,     0,   531,     0,   550,   551,
+     552,   543,   533,   549
   };
 
-  const short int
+  const short
   Dhcp6Parser::yypgoto_[] =
   {
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,     7,  -490,   -35,  -490,  -490,  -490,
-    -490,  -490,  -490,    25,  -490,  -196,  -490,  -490,  -490,   -62,
-    -490,  -490,  -490,   246,  -490,  -490,  -490,  -490,    54,   226,
-     -63,   -50,   -49,   -43,  -490,  -490,  -490,  -490,  -490,    33,
-    -490,  -490,  -490,  -490,  -490,    53,  -129,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,   -58,  -490,  -489,  -490,
-    -490,  -490,  -490,  -490,  -490,  -138,  -474,  -490,  -490,  -490,
-    -490,  -140,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -145,
-    -490,  -490,  -490,  -142,   186,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -150,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -125,  -490,  -490,  -490,  -122,   225,  -490,
-    -490,  -490,  -490,  -490,  -490,  -477,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -124,  -490,  -490,  -490,  -123,
-    -490,   199,  -490,   -59,  -490,  -490,  -490,  -490,  -490,   -57,
-    -490,  -490,  -490,  -490,  -490,   -48,  -490,  -490,  -490,  -118,
-    -490,  -490,  -490,  -113,  -490,   197,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -149,  -490,  -490,  -490,
-    -141,   240,  -490,  -490,   -66,  -490,  -490,  -490,  -490,  -490,
-    -139,  -490,  -490,  -490,  -143,   242,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -137,  -490,  -490,
-    -490,  -136,  -490,   234,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,    79,  -490,  -490,  -490,
-    -490,  -490,  -490,  -121,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -120,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,    86,   213,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   -71,  -490,
-    -490,  -490,  -213,  -490,  -490,  -228,  -490,  -490,  -490,  -490,
-    -490,  -490,  -239,  -490,  -490,  -244,  -490
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,     9,  -494,    69,  -494,  -494,  -494,
+    -494,  -494,  -494,    43,  -494,  -171,  -494,  -494,  -494,   -62,
+    -494,  -494,  -494,   285,  -494,  -494,  -494,  -494,    70,   267,
+     -63,   -50,   -49,   -43,  -494,  -494,  -494,  -494,  -494,    77,
+    -494,  -494,  -494,  -494,  -494,    83,  -110,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,   -58,  -494,  -493,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -118,  -479,  -494,  -494,  -494,  -494,  -120,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -125,  -494,  -494,  -494,  -121,   225,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -128,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -104,  -494,
+    -494,  -494,  -101,   278,  -494,  -494,  -494,  -494,  -494,  -494,
+    -483,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -103,  -494,  -494,  -494,  -102,  -494,   237,  -494,   -59,  -494,
+    -494,  -494,  -494,  -494,   -57,  -494,  -494,  -494,  -494,  -494,
+     -48,  -494,  -494,  -494,   -98,  -494,  -494,  -494,   -99,  -494,
+     239,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -141,  -494,  -494,  -494,  -129,   279,  -494,  -494,   -66,
+    -494,  -494,  -494,  -494,  -494,  -133,  -494,  -494,  -494,  -130,
+     282,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -131,  -494,  -494,  -494,  -126,  -494,   259,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,   107,  -494,  -494,  -494,  -494,  -494,  -494,  -107,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -109,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,   117,   251,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,  -494,
+    -494,  -494,  -494,  -494,  -494,   -55,  -494,  -494,  -494,  -215,
+    -494,  -494,  -494,  -494,  -494,  -494,  -210,  -494,  -494,  -230,
+    -494,  -494,  -494,  -494,  -494,  -494,  -247,  -494,  -494,  -264,
+    -494,  -494,  -494,  -494,  -494,  -240,  -494,  -494,  -257,  -494,
+    -494,  -494,  -494,  -494
   };
 
-  const short int
+  const short
   Dhcp6Parser::yydefgoto_[] =
   {
-      -1,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    73,    35,    36,    61,   522,    77,
-      78,    37,    60,    74,    75,   507,   646,   719,   720,   112,
-      39,    62,    85,    86,    87,   289,    41,    63,   113,   114,
-     115,   116,   117,   118,   119,   120,   296,    43,    64,   137,
-     319,   121,   297,   122,   298,   569,   570,   571,   668,   785,
-     572,   669,   573,   670,   574,   671,   217,   355,   576,   577,
-     578,   579,   123,   307,   595,   596,   597,   598,   124,   309,
-     602,   603,   604,   125,   308,   126,   311,   608,   609,   610,
-     695,    57,    71,   247,   248,   249,   367,   250,   368,   127,
-     312,   617,   618,   619,   620,   621,   622,   623,   624,   128,
-     304,   582,   583,   584,   679,    45,    65,   155,   156,   157,
-     324,   158,   325,   159,   326,   160,   330,   161,   329,   162,
-     163,   129,   305,   586,   587,   588,   682,    53,    69,   218,
-     219,   220,   221,   222,   223,   224,   354,   225,   358,   226,
-     357,   227,   228,   359,   229,   130,   306,   590,   591,   592,
-     685,    55,    70,   236,   237,   238,   239,   240,   363,   241,
-     242,   243,   165,   322,   650,   651,   652,   722,    47,    66,
-     173,   174,   175,   335,   176,   336,   166,   323,   654,   655,
-     656,   725,    49,    67,   185,   186,   187,   339,   188,   189,
-     341,   190,   191,   167,   331,   658,   659,   660,   728,    51,
-      68,   200,   201,   202,   203,   347,   204,   348,   205,   349,
-     206,   350,   207,   351,   208,   346,   168,   332,   662,   731,
-     131,   310,   606,   321,   423,   424,   425,   426,   427,   508,
-     132,   313,   632,   633,   634,   706,   796,   635,   636,   707,
-     637,   638,   133,   134,   315,   641,   642,   643,   713,   644,
-     714,   135,   316,    59,    72,   267,   268,   269,   270,   372,
-     271,   373,   272,   273,   375,   274,   275,   276,   378,   544,
-     277,   379,   278,   279,   280,   281,   282,   384,   551,   283,
-     385,    88,   291,    89,   292,    90,   290,   556,   557,   558,
-     664,   806,   807,   808,   816,   817,   818,   819,   824,   820,
-     822,   834,   835,   836,   840,   841,   843
+       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    73,    35,    36,    61,   526,    77,
+      78,    37,    60,    74,    75,   511,   660,   737,   738,   113,
+      39,    62,    85,    86,    87,   291,    41,    63,   114,   115,
+     116,   117,   118,   119,   120,   121,   298,    43,    64,   139,
+     322,   122,   299,   123,   300,   580,   581,   582,   683,   808,
+     583,   684,   584,   685,   585,   686,   219,   358,   587,   588,
+     589,   689,   590,   691,   591,   592,   593,   124,   309,   609,
+     610,   611,   612,   125,   311,   616,   617,   618,   126,   310,
+     127,   313,   622,   623,   624,   713,    57,    71,   249,   250,
+     251,   370,   252,   371,   128,   314,   631,   632,   633,   634,
+     635,   636,   637,   638,   129,   306,   596,   597,   598,   697,
+      45,    65,   157,   158,   159,   327,   160,   328,   161,   329,
+     162,   333,   163,   332,   164,   165,   130,   307,   600,   601,
+     602,   700,    53,    69,   220,   221,   222,   223,   224,   225,
+     226,   357,   227,   361,   228,   360,   229,   230,   362,   231,
+     131,   308,   604,   605,   606,   703,    55,    70,   238,   239,
+     240,   241,   242,   366,   243,   244,   245,   167,   325,   664,
+     665,   666,   740,    47,    66,   175,   176,   177,   338,   178,
+     339,   168,   326,   668,   669,   670,   743,    49,    67,   187,
+     188,   189,   342,   190,   191,   344,   192,   193,   169,   334,
+     672,   673,   674,   746,    51,    68,   202,   203,   204,   205,
+     350,   206,   351,   207,   352,   208,   353,   209,   354,   210,
+     349,   170,   335,   676,   749,   132,   312,   620,   324,   427,
+     428,   429,   430,   431,   512,   133,   315,   646,   647,   648,
+     724,   821,   649,   650,   725,   651,   652,   134,   135,   136,
+     318,   655,   656,   657,   731,   658,   732,   137,   319,    59,
+      72,   269,   270,   271,   272,   375,   273,   376,   274,   275,
+     378,   276,   277,   278,   381,   548,   279,   382,   551,   280,
+     281,   282,   283,   284,   387,   557,   285,   388,    88,   293,
+      89,   294,    90,   292,   563,   564,   565,   679,   836,   837,
+     838,   839,   844,   566,   678,   831,   832,   840,   853,   854,
+     855,   856,   865,   857,   863,   879,   880,   885,   892,   893,
+     906,   858,   866,   882,   883,   884,   888,   899,   900,   901,
+     909,   902,   903,   904
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yytable_[] =
   {
-      84,   184,   151,   150,   171,   182,   198,   216,   232,   246,
-     266,   234,   233,   235,   631,   152,   153,   164,   172,   183,
-     199,    34,   154,   605,    27,   601,    28,    79,    29,   560,
-     138,   593,   244,   245,   561,   562,   563,   564,   565,   566,
-     567,   138,    91,   294,    92,    93,    26,   209,   295,   210,
-      94,    95,    96,    97,   793,   794,   795,   101,    94,    95,
-      96,    97,    98,    99,   100,   101,   139,   210,   140,   211,
-     212,   101,   213,   214,   215,   141,   142,   143,   144,   145,
-     146,   169,   101,   210,   244,   245,   147,   148,   170,   102,
-     103,   104,   105,   149,   210,   317,   101,   147,    38,   625,
-     318,   594,   101,   106,   333,   688,   107,   564,   689,   334,
-     419,   542,   543,   108,   177,   178,   179,   180,   181,   170,
-      40,   109,   110,   192,    42,   111,    44,   193,   194,   195,
-     196,   197,   593,   600,    80,   210,   230,   211,   212,   231,
-      81,    82,   611,   612,   613,   614,   615,   616,    83,   691,
-     337,    83,   692,    76,    83,   338,    30,    31,    32,    33,
-      83,   344,   546,   547,   548,   549,   345,    46,    83,    83,
-     626,   627,   628,   629,    83,   639,   640,   369,   811,   386,
-     812,   813,   370,   317,   387,    83,   665,   676,   663,   550,
-     676,   666,   677,   704,   136,   678,    83,   711,   705,    83,
-      48,   715,   712,   386,   333,    83,   716,   369,   717,   789,
-     337,   284,   792,   344,   825,   801,   752,   601,   802,   826,
-     844,    83,   631,   693,   809,   845,   694,   810,   781,   782,
-     783,   784,    84,   837,    50,    52,   838,    83,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   525,   526,   527,    54,    56,    58,   420,
-     285,   287,   286,   421,   288,   390,   293,   299,   300,   301,
-     151,   150,   302,   422,   303,   171,   314,   320,   184,   327,
-      83,   328,   182,   152,   153,   164,   340,   342,   343,   172,
-     154,   198,   388,   389,   352,   353,   183,   356,   360,   361,
-     216,   362,   399,   364,   232,   199,   366,   234,   233,   235,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,   365,   371,   266,   374,   376,   377,   380,   381,
-     382,   383,   391,   392,   393,   394,   396,   397,   398,   404,
-     400,   401,   405,   406,   402,   407,   403,   408,   409,   410,
-     411,   412,   413,   414,   415,   416,   418,   428,   429,   430,
-     431,   432,   433,   434,   435,   436,   437,   438,   440,   441,
-     443,   444,   445,   446,   447,   449,   450,   451,   452,   453,
-     454,   456,   457,   458,   459,   460,   461,   462,   464,   467,
-     468,   471,   465,   472,   470,   474,   477,   473,   475,   478,
-     489,   490,   483,   484,   476,   486,   521,   479,   509,   487,
-     488,   480,   491,   481,   482,   492,   493,   494,   495,   496,
-     497,   498,   499,   500,   501,   513,   510,   502,   503,   504,
-     568,   568,   505,   506,   575,   575,   511,   512,   514,   515,
-     518,   630,   516,   266,   517,   519,   520,    28,   420,   523,
-     524,   581,   421,   528,   529,   530,   585,   531,   589,   607,
-     647,   649,   422,   667,   653,   657,   672,   661,   673,   674,
-     675,   681,   684,   532,   533,   538,   680,   534,   683,   535,
-     686,   687,   545,   690,   697,   696,   536,   698,   699,   700,
-     701,   702,   703,   553,   708,   537,   539,   709,   710,   732,
-     724,   555,   723,   727,   540,   726,   541,   729,   730,   771,
-     733,   735,   736,   737,   738,   762,   552,   763,   768,   769,
-     772,   780,   779,   599,   559,   718,   805,   721,   790,   791,
-     803,   823,   740,   739,   827,   829,   833,   741,   831,   846,
-     395,   554,   742,   417,   755,   756,   580,   743,   757,   758,
-     750,   751,   754,   753,   761,   469,   745,   744,   439,   746,
-     747,   463,   759,   466,   760,   764,   839,   765,   766,   749,
-     786,   787,   748,   788,   797,   774,   798,   442,   799,   800,
-     804,   773,   775,   828,   832,   848,   448,   455,   776,   648,
-     767,   645,   777,   778,   734,   770,   821,   830,   842,   485,
-     847,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   568,     0,   151,   150,   575,     0,
-     216,     0,     0,   232,     0,     0,   234,   233,   235,   152,
-     153,   164,     0,   246,     0,     0,   154,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   630,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   184,
-     171,     0,     0,   182,     0,     0,   198,     0,     0,     0,
-       0,     0,     0,     0,   172,     0,     0,   183,     0,     0,
-     199,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      84,   186,   153,   152,   173,   184,   200,   218,   234,   248,
+     268,   236,   235,   237,   645,   154,   155,   166,   174,   185,
+     201,   619,   156,    34,   615,    27,   140,    28,    79,    29,
+     212,   232,   213,   214,   233,   246,   247,   607,    91,   639,
+      92,    93,   140,   211,   818,   819,   820,   572,   296,    94,
+      95,    96,    97,   297,   101,   212,   101,    94,    95,    96,
+      97,    98,    99,   100,   101,   141,   212,   142,   213,   214,
+     101,   215,   216,   217,   143,   144,   145,   146,   147,   148,
+     171,   101,   423,   833,   834,   149,   150,   172,   102,   103,
+     104,   105,   151,   179,   180,   181,   182,   183,   172,   212,
+      38,   149,   106,   320,    83,   107,   336,   706,   321,    83,
+     707,   337,   108,   640,   641,   642,   643,   608,   101,   340,
+     109,   110,   111,   568,   341,   112,   246,   247,   569,   570,
+     571,   572,   573,   574,   575,   576,   577,   578,   347,   372,
+      80,    26,    83,   348,   373,   194,   212,   549,   550,   195,
+     196,   197,   198,   199,    81,    82,   552,   553,   554,   555,
+      40,   625,   626,   627,   628,   629,   630,    83,    83,    83,
+      30,    31,    32,    33,    83,   389,   561,    83,    83,   320,
+     390,   562,    42,    83,   677,   847,   709,   848,   849,   710,
+     711,   556,   850,   712,    83,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+      44,    83,     1,     2,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,   680,   546,   547,   694,   774,   681,
+     615,    83,   695,   694,    84,   722,   645,   729,   696,   733,
+     723,    76,   730,   389,   734,   336,    83,   372,   735,   340,
+     814,   347,   817,   138,   826,   845,   827,    46,    83,   867,
+     846,    48,   424,   907,   868,   913,   425,   286,   908,   841,
+     914,    50,   842,   153,   152,    52,   426,   886,   173,    54,
+     887,   186,   529,   530,   531,   184,   154,   155,   166,   607,
+     614,    56,   174,   156,   200,    58,   391,   392,   287,   185,
+     653,   654,   288,   218,   289,   290,   356,   234,   201,   295,
+     236,   235,   237,   804,   805,   806,   807,   895,   896,   897,
+     898,   301,   302,   303,   304,   305,   316,   268,   317,   330,
+     331,   323,   343,   345,   346,   355,   359,   363,   365,   364,
+     367,   369,   368,   374,   377,   379,   380,   383,   384,   385,
+     386,   393,   394,   395,   396,   397,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   422,   432,
+     433,   434,   435,   436,   437,   439,   440,   441,   438,   442,
+     444,   445,   447,   449,   448,   453,   450,   454,   451,   455,
+     456,   457,   458,   460,   461,   493,   494,   463,   462,   464,
+     465,   466,   468,   471,   472,   475,   469,   476,   474,   478,
+     477,   479,   480,   481,   482,   487,   483,   488,   484,   485,
+     486,   490,   491,   492,   579,   579,   495,   496,   586,   586,
+     497,   498,   499,   500,   501,   644,   502,   268,   503,   504,
+     505,   517,   424,   506,   507,   508,   425,   509,   510,   513,
+     514,   515,   518,   516,   519,   520,   426,   522,   523,   758,
+      28,   595,   599,   603,   621,   661,   663,   667,   699,   671,
+     687,   542,   682,   688,   690,   692,   675,   521,   693,   698,
+     702,   701,   704,   705,   708,   714,   715,   524,   716,   559,
+     717,   718,   719,   720,   721,   527,   528,   532,   533,   534,
+     726,   727,   728,   742,   525,   741,   745,   744,   747,   748,
+     535,   536,   750,   751,   752,   754,   755,   756,   757,   760,
+     537,   762,   784,   785,   538,   790,   791,   794,   815,   793,
+     539,   801,   540,   802,   541,   613,   803,   875,   816,   828,
+     830,   543,   544,   843,   545,   861,   864,   558,   870,   872,
+     873,   560,   877,   910,   736,   878,   739,   881,   889,   761,
+     759,   890,   567,   911,   809,   763,   912,   915,   917,   764,
+     594,   398,   777,   778,   765,   779,   780,   421,   772,   773,
+     776,   781,   775,   782,   783,   767,   766,   473,   768,   769,
+     786,   796,   467,   787,   770,   788,   860,   771,   470,   810,
+     811,   795,   798,   797,   443,   459,   891,   800,   812,   446,
+     799,   662,   789,   813,   792,   753,   659,   822,   823,   452,
+     862,   859,   579,   871,   153,   152,   586,   874,   218,   894,
+     489,   234,   824,   916,   236,   235,   237,   154,   155,   166,
+     905,   248,   825,   829,   156,   869,   921,     0,     0,     0,
+       0,     0,     0,     0,     0,   876,     0,   644,   918,   919,
+       0,     0,     0,     0,     0,     0,   922,   186,   173,     0,
+       0,   184,     0,     0,   200,     0,   920,     0,     0,     0,
+       0,     0,   174,     0,   923,   185,     0,     0,   201,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   835,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   851,     0,
+       0,     0,   852,   835,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   814,     0,     0,     0,
-     815,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   814,     0,     0,     0,   815
+       0,     0,     0,     0,     0,   851,     0,     0,     0,   852
   };
 
-  const short int
+  const short
   Dhcp6Parser::yycheck_[] =
   {
       62,    67,    65,    65,    66,    67,    68,    69,    70,    71,
-      72,    70,    70,    70,   503,    65,    65,    65,    66,    67,
-      68,    14,    65,   500,     5,   499,     7,    10,     9,    15,
-       7,    67,    73,    74,    20,    21,    22,    23,    24,    25,
-      26,     7,    11,     3,    13,    14,     0,    15,     8,    35,
-      27,    28,    29,    30,    83,    84,    85,    34,    27,    28,
-      29,    30,    31,    32,    33,    34,    43,    35,    45,    37,
-      38,    34,    40,    41,    42,    52,    53,    54,    55,    56,
-      57,    44,    34,    35,    73,    74,    63,    64,    51,    58,
-      59,    60,    61,    70,    35,     3,    34,    63,     7,    15,
-       8,   137,    34,    72,     3,     3,    75,    23,     6,     8,
-      62,   110,   111,    82,    46,    47,    48,    49,    50,    51,
-       7,    90,    91,    61,     7,    94,     7,    65,    66,    67,
-      68,    69,    67,    68,   117,    35,    36,    37,    38,    39,
-     123,   124,    76,    77,    78,    79,    80,    81,   137,     3,
-       3,   137,     6,   137,   137,     8,   137,   138,   139,   140,
-     137,     3,   113,   114,   115,   116,     8,     7,   137,   137,
-      86,    87,    88,    89,   137,    92,    93,     3,   119,     3,
-     121,   122,     8,     3,     8,   137,     3,     3,     8,   140,
-       3,     8,     8,     3,    12,     8,   137,     3,     8,   137,
-       7,     3,     8,     3,     3,   137,     8,     3,     8,     8,
-       3,     6,     8,     3,     3,     8,   693,   691,     8,     8,
-       3,   137,   711,     3,     3,     8,     6,     6,    16,    17,
-      18,    19,   294,     3,     7,     7,     6,   137,    95,    96,
-      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   449,   450,   451,     7,     7,     7,   321,
-       3,     8,     4,   321,     3,   137,     4,     4,     4,     4,
-     333,   333,     4,   321,     4,   337,     4,     8,   344,     4,
-     137,     4,   344,   333,   333,   333,     4,     4,     4,   337,
-     333,   353,   285,   286,     8,     3,   344,     4,     4,     8,
-     362,     3,   138,     4,   366,   353,     3,   366,   366,   366,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,     8,     4,   386,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-     138,   138,     4,     4,   138,     4,   138,     4,     4,     4,
-       4,     4,     4,   138,     4,     4,     4,     4,     4,     4,
-       4,     4,   138,   140,     4,     4,     4,     4,     4,     4,
-       4,   138,     4,   138,   138,     4,     4,     4,     4,     4,
-       4,     4,     4,   138,     4,     4,     4,   140,     4,     4,
-       4,     4,   140,     4,   140,     4,     4,   138,   138,     4,
-     393,   394,     4,     4,   138,     4,   441,   140,     8,     7,
-       7,   140,     7,   140,   140,     7,     7,     5,     5,     5,
-       5,     5,     5,     5,     5,   137,     3,     7,     7,     7,
-     492,   493,     7,     5,   492,   493,     5,     5,   137,   137,
-       5,   503,   137,   505,   137,     7,   137,     7,   510,   137,
-     137,     7,   510,   137,   137,   137,     7,   137,     7,     7,
-       4,     7,   510,     8,     7,     7,     4,    71,     4,     4,
-       4,     3,     3,   137,   137,   468,     6,   137,     6,   137,
-       6,     3,   112,     6,     3,     6,   137,     4,     4,     4,
-       4,     4,     4,   486,     4,   137,   137,     4,     4,     8,
-       3,   118,     6,     3,   137,     6,   137,     6,     3,     6,
-       4,     4,     4,     4,     4,     4,   137,     4,     4,     4,
-       3,     5,     4,   498,   491,   137,     7,   137,     8,     8,
-       8,     4,   138,   140,     4,     4,     7,   140,     5,     4,
-     294,   487,   138,   317,   138,   138,   493,   676,   138,   138,
-     688,   691,   697,   695,   704,   369,   681,   679,   333,   682,
-     684,   362,   138,   366,   138,   138,   120,   138,   138,   687,
-     137,   137,   685,   137,   137,   724,   137,   337,   137,   137,
-     137,   722,   725,   138,   137,   137,   344,   353,   727,   510,
-     711,   505,   728,   730,   665,   715,   809,   825,   837,   386,
-     844,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   676,    -1,   679,   679,   676,    -1,
-     682,    -1,    -1,   685,    -1,    -1,   685,   685,   685,   679,
-     679,   679,    -1,   695,    -1,    -1,   679,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   711,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   725,
-     722,    -1,    -1,   725,    -1,    -1,   728,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   722,    -1,    -1,   725,    -1,    -1,
-     728,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      72,    70,    70,    70,   507,    65,    65,    65,    66,    67,
+      68,   504,    65,    14,   503,     5,     7,     7,    10,     9,
+      38,    39,    40,    41,    42,    76,    77,    70,    11,    15,
+      13,    14,     7,    15,    86,    87,    88,    23,     3,    30,
+      31,    32,    33,     8,    37,    38,    37,    30,    31,    32,
+      33,    34,    35,    36,    37,    46,    38,    48,    40,    41,
+      37,    43,    44,    45,    55,    56,    57,    58,    59,    60,
+      47,    37,    65,   129,   130,    66,    67,    54,    61,    62,
+      63,    64,    73,    49,    50,    51,    52,    53,    54,    38,
+       7,    66,    75,     3,   150,    78,     3,     3,     8,   150,
+       6,     8,    85,    89,    90,    91,    92,   150,    37,     3,
+      93,    94,    95,    15,     8,    98,    76,    77,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,     3,     3,
+     122,     0,   150,     8,     8,    64,    38,   116,   117,    68,
+      69,    70,    71,    72,   136,   137,   118,   119,   120,   121,
+       7,    79,    80,    81,    82,    83,    84,   150,   150,   150,
+     150,   151,   152,   153,   150,     3,   123,   150,   150,     3,
+       8,   128,     7,   150,     8,   124,     3,   126,   127,     6,
+       3,   153,   131,     6,   150,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+       7,   150,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,     3,   114,   115,     3,   711,     8,
+     709,   150,     8,     3,   296,     3,   729,     3,     8,     3,
+       8,   150,     8,     3,     8,     3,   150,     3,     8,     3,
+       8,     3,     8,    12,     8,     3,     8,     7,   150,     3,
+       8,     7,   324,     3,     8,     3,   324,     6,     8,     3,
+       8,     7,     6,   336,   336,     7,   324,     3,   340,     7,
+       6,   347,   453,   454,   455,   347,   336,   336,   336,    70,
+      71,     7,   340,   336,   356,     7,   287,   288,     3,   347,
+      96,    97,     4,   365,     8,     3,     3,   369,   356,     4,
+     369,   369,   369,    16,    17,    18,    19,   132,   133,   134,
+     135,     4,     4,     4,     4,     4,     4,   389,     4,     4,
+       4,     8,     4,     4,     4,     8,     4,     4,     3,     8,
+       4,     3,     8,     4,     4,     4,     4,     4,     4,     4,
+       4,   150,     4,     4,     4,     4,     4,     4,     4,   151,
+     151,   151,   151,   151,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,   151,   153,     4,     4,     4,     4,
+       4,     4,     4,     4,   151,     4,     4,     4,   153,     4,
+       4,     4,     4,     4,   151,     4,   151,     4,   151,     4,
+       4,     4,     4,     4,     4,   396,   397,     4,   151,     4,
+       4,   153,     4,     4,     4,     4,   153,     4,   153,     4,
+     151,   151,   151,     4,     4,     4,   153,     4,   153,   153,
+     153,     4,     7,     7,   496,   497,     7,     7,   496,   497,
+       7,     5,     5,     5,     5,   507,     5,   509,     5,     5,
+       5,   150,   514,     7,     7,     7,   514,     7,     5,     8,
+       3,     5,   150,     5,   150,   150,   514,     5,     7,   153,
+       7,     7,     7,     7,     7,     4,     7,     7,     3,     7,
+       4,   472,     8,     4,     4,     4,    74,   150,     4,     6,
+       3,     6,     6,     3,     6,     6,     3,   150,     4,   490,
+       4,     4,     4,     4,     4,   150,   150,   150,   150,   150,
+       4,     4,     4,     3,   445,     6,     3,     6,     6,     3,
+     150,   150,     8,     4,     4,     4,     4,     4,     4,     4,
+     150,     4,     4,     4,   150,     4,     4,     3,     8,     6,
+     150,     4,   150,     5,   150,   502,     7,     5,     8,     8,
+       7,   150,   150,     4,   150,     4,     4,   150,     4,     4,
+       4,   491,     5,     4,   150,     7,   150,     7,     6,   151,
+     153,     3,   495,     4,   150,   153,     4,     4,     4,   151,
+     497,   296,   151,   151,   694,   151,   151,   320,   706,   709,
+     715,   151,   713,   151,   722,   699,   697,   372,   700,   702,
+     151,   742,   365,   151,   703,   151,   151,   705,   369,   150,
+     150,   740,   745,   743,   336,   356,   125,   748,   150,   340,
+     746,   514,   729,   150,   733,   680,   509,   150,   150,   347,
+     845,   841,   694,   151,   697,   697,   694,   867,   700,   886,
+     389,   703,   150,   907,   703,   703,   703,   697,   697,   697,
+     890,   713,   150,   150,   697,   150,   913,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   150,    -1,   729,   151,   151,
+      -1,    -1,    -1,    -1,    -1,    -1,   150,   743,   740,    -1,
+      -1,   743,    -1,    -1,   746,    -1,   151,    -1,    -1,    -1,
+      -1,    -1,   740,    -1,   150,   743,    -1,    -1,   746,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   803,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   808,    -1,    -1,    -1,
-     808,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   825,    -1,    -1,    -1,   825
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   840,    -1,
+      -1,    -1,   840,   845,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   867,    -1,    -1,    -1,   867
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yystos_[] =
   {
-       0,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,   136,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,     0,     5,     7,     9,
-     137,   138,   139,   140,   155,   156,   157,   162,     7,   171,
-       7,   177,     7,   188,     7,   256,     7,   319,     7,   333,
-       7,   350,     7,   278,     7,   302,     7,   232,     7,   404,
-     163,   158,   172,   178,   189,   257,   320,   334,   351,   279,
-     303,   233,   405,   155,   164,   165,   137,   160,   161,    10,
-     117,   123,   124,   137,   170,   173,   174,   175,   432,   434,
-     436,    11,    13,    14,    27,    28,    29,    30,    31,    32,
-      33,    34,    58,    59,    60,    61,    72,    75,    82,    90,
-      91,    94,   170,   179,   180,   181,   182,   183,   184,   185,
-     186,   192,   194,   213,   219,   224,   226,   240,   250,   272,
-     296,   371,   381,   393,   394,   402,    12,   190,     7,    43,
-      45,    52,    53,    54,    55,    56,    57,    63,    64,    70,
-     170,   181,   182,   183,   184,   258,   259,   260,   262,   264,
-     266,   268,   270,   271,   296,   313,   327,   344,   367,    44,
-      51,   170,   296,   321,   322,   323,   325,    46,    47,    48,
-      49,    50,   170,   296,   325,   335,   336,   337,   339,   340,
-     342,   343,    61,    65,    66,    67,    68,    69,   170,   296,
-     352,   353,   354,   355,   357,   359,   361,   363,   365,    15,
-      35,    37,    38,    40,    41,    42,   170,   207,   280,   281,
-     282,   283,   284,   285,   286,   288,   290,   292,   293,   295,
-      36,    39,   170,   207,   284,   290,   304,   305,   306,   307,
-     308,   310,   311,   312,    73,    74,   170,   234,   235,   236,
-     238,    95,    96,    97,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   170,   406,   407,   408,
-     409,   411,   413,   414,   416,   417,   418,   421,   423,   424,
-     425,   426,   427,   430,     6,     3,     4,     8,     3,   176,
-     437,   433,   435,     4,     3,     8,   187,   193,   195,     4,
-       4,     4,     4,     4,   251,   273,   297,   214,   225,   220,
-     372,   227,   241,   382,     4,   395,   403,     3,     8,   191,
-       8,   374,   314,   328,   261,   263,   265,     4,     4,   269,
-     267,   345,   368,     3,     8,   324,   326,     3,     8,   338,
-       4,   341,     4,     4,     3,     8,   366,   356,   358,   360,
-     362,   364,     8,     3,   287,   208,     4,   291,   289,   294,
-       4,     8,     3,   309,     4,     8,     3,   237,   239,     3,
-       8,     4,   410,   412,     4,   415,     4,     4,   419,   422,
-       4,     4,     4,     4,   428,   431,     3,     8,   155,   155,
-     137,     4,     4,     4,     4,   174,     4,     4,     4,   138,
-     138,   138,   138,   138,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   138,     4,     4,   180,     4,    62,
-     170,   207,   296,   375,   376,   377,   378,   379,     4,     4,
-       4,     4,     4,   138,   140,     4,     4,     4,     4,   259,
-       4,     4,   322,     4,   138,     4,   138,   138,   336,     4,
-       4,     4,     4,     4,     4,   354,     4,     4,   138,     4,
-       4,     4,   140,   282,     4,   140,   306,     4,     4,   235,
-     140,     4,     4,   138,     4,   138,   138,     4,     4,   140,
-     140,   140,   140,     4,     4,   407,     4,     7,     7,   155,
-     155,     7,     7,     7,     5,     5,     5,     5,     5,     5,
-       5,     5,     7,     7,     7,     7,     5,   166,   380,     8,
-       3,     5,     5,   137,   137,   137,   137,   137,     5,     7,
-     137,   157,   159,   137,   137,   166,   166,   166,   137,   137,
-     137,   137,   137,   137,   137,   137,   137,   137,   155,   137,
-     137,   137,   110,   111,   420,   112,   113,   114,   115,   116,
-     140,   429,   137,   155,   179,   118,   438,   439,   440,   190,
-      15,    20,    21,    22,    23,    24,    25,    26,   170,   196,
-     197,   198,   201,   203,   205,   207,   209,   210,   211,   212,
-     196,     7,   252,   253,   254,     7,   274,   275,   276,     7,
-     298,   299,   300,    67,   137,   215,   216,   217,   218,   164,
-      68,   217,   221,   222,   223,   266,   373,     7,   228,   229,
-     230,    76,    77,    78,    79,    80,    81,   242,   243,   244,
-     245,   246,   247,   248,   249,    15,    86,    87,    88,    89,
-     170,   209,   383,   384,   385,   388,   389,   391,   392,    92,
-      93,   396,   397,   398,   400,   406,   167,     4,   377,     7,
-     315,   316,   317,     7,   329,   330,   331,     7,   346,   347,
-     348,    71,   369,     8,   441,     3,     8,     8,   199,   202,
-     204,   206,     4,     4,     4,     4,     3,     8,     8,   255,
-       6,     3,   277,     6,     3,   301,     6,     3,     3,     6,
-       6,     3,     6,     3,     6,   231,     6,     3,     4,     4,
-       4,     4,     4,     4,     3,     8,   386,   390,     4,     4,
-       4,     3,     8,   399,   401,     3,     8,     8,   137,   168,
-     169,   137,   318,     6,     3,   332,     6,     3,   349,     6,
-       3,   370,     8,     4,   439,     4,     4,     4,     4,   140,
-     138,   140,   138,   197,   258,   254,   280,   276,   304,   300,
-     216,   222,   266,   234,   230,   138,   138,   138,   138,   138,
-     138,   243,     4,     4,   138,   138,   138,   384,     4,     4,
-     397,     6,     3,   321,   317,   335,   331,   352,   348,     4,
-       5,    16,    17,    18,    19,   200,   137,   137,   137,     8,
-       8,     8,     8,    83,    84,    85,   387,   137,   137,   137,
-     137,     8,     8,     8,   137,     7,   442,   443,   444,     3,
-       6,   119,   121,   122,   170,   207,   445,   446,   447,   448,
-     450,   443,   451,     4,   449,     3,     8,     4,   138,     4,
-     446,     5,   137,     7,   452,   453,   454,     3,     6,   120,
-     455,   456,   453,   457,     3,     8,     4,   456,   137
+       0,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,     0,     5,     7,     9,
+     150,   151,   152,   153,   168,   169,   170,   175,     7,   184,
+       7,   190,     7,   201,     7,   274,     7,   337,     7,   351,
+       7,   368,     7,   296,     7,   320,     7,   250,     7,   423,
+     176,   171,   185,   191,   202,   275,   338,   352,   369,   297,
+     321,   251,   424,   168,   177,   178,   150,   173,   174,    10,
+     122,   136,   137,   150,   183,   186,   187,   188,   452,   454,
+     456,    11,    13,    14,    30,    31,    32,    33,    34,    35,
+      36,    37,    61,    62,    63,    64,    75,    78,    85,    93,
+      94,    95,    98,   183,   192,   193,   194,   195,   196,   197,
+     198,   199,   205,   207,   231,   237,   242,   244,   258,   268,
+     290,   314,   389,   399,   411,   412,   413,   421,    12,   203,
+       7,    46,    48,    55,    56,    57,    58,    59,    60,    66,
+      67,    73,   183,   194,   195,   196,   197,   276,   277,   278,
+     280,   282,   284,   286,   288,   289,   314,   331,   345,   362,
+     385,    47,    54,   183,   314,   339,   340,   341,   343,    49,
+      50,    51,    52,    53,   183,   314,   343,   353,   354,   355,
+     357,   358,   360,   361,    64,    68,    69,    70,    71,    72,
+     183,   314,   370,   371,   372,   373,   375,   377,   379,   381,
+     383,    15,    38,    40,    41,    43,    44,    45,   183,   220,
+     298,   299,   300,   301,   302,   303,   304,   306,   308,   310,
+     311,   313,    39,    42,   183,   220,   302,   308,   322,   323,
+     324,   325,   326,   328,   329,   330,    76,    77,   183,   252,
+     253,   254,   256,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   183,   425,
+     426,   427,   428,   430,   432,   433,   435,   436,   437,   440,
+     443,   444,   445,   446,   447,   450,     6,     3,     4,     8,
+       3,   189,   457,   453,   455,     4,     3,     8,   200,   206,
+     208,     4,     4,     4,     4,     4,   269,   291,   315,   232,
+     243,   238,   390,   245,   259,   400,     4,     4,   414,   422,
+       3,     8,   204,     8,   392,   332,   346,   279,   281,   283,
+       4,     4,   287,   285,   363,   386,     3,     8,   342,   344,
+       3,     8,   356,     4,   359,     4,     4,     3,     8,   384,
+     374,   376,   378,   380,   382,     8,     3,   305,   221,     4,
+     309,   307,   312,     4,     8,     3,   327,     4,     8,     3,
+     255,   257,     3,     8,     4,   429,   431,     4,   434,     4,
+       4,   438,   441,     4,     4,     4,     4,   448,   451,     3,
+       8,   168,   168,   150,     4,     4,     4,     4,   187,     4,
+       4,     4,   151,   151,   151,   151,   151,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,   151,   153,     4,
+       4,   193,     4,    65,   183,   220,   314,   393,   394,   395,
+     396,   397,     4,     4,     4,     4,     4,   151,   153,     4,
+       4,     4,     4,   277,     4,     4,   340,     4,   151,     4,
+     151,   151,   354,     4,     4,     4,     4,     4,     4,   372,
+       4,     4,   151,     4,     4,     4,   153,   300,     4,   153,
+     324,     4,     4,   253,   153,     4,     4,   151,     4,   151,
+     151,     4,     4,   153,   153,   153,   153,     4,     4,   426,
+       4,     7,     7,   168,   168,     7,     7,     7,     5,     5,
+       5,     5,     5,     5,     5,     5,     7,     7,     7,     7,
+       5,   179,   398,     8,     3,     5,     5,   150,   150,   150,
+     150,   150,     5,     7,   150,   170,   172,   150,   150,   179,
+     179,   179,   150,   150,   150,   150,   150,   150,   150,   150,
+     150,   150,   168,   150,   150,   150,   114,   115,   439,   116,
+     117,   442,   118,   119,   120,   121,   153,   449,   150,   168,
+     192,   123,   128,   458,   459,   460,   467,   203,    15,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,   183,
+     209,   210,   211,   214,   216,   218,   220,   222,   223,   224,
+     226,   228,   229,   230,   209,     7,   270,   271,   272,     7,
+     292,   293,   294,     7,   316,   317,   318,    70,   150,   233,
+     234,   235,   236,   177,    71,   235,   239,   240,   241,   284,
+     391,     7,   246,   247,   248,    79,    80,    81,    82,    83,
+      84,   260,   261,   262,   263,   264,   265,   266,   267,    15,
+      89,    90,    91,    92,   183,   222,   401,   402,   403,   406,
+     407,   409,   410,    96,    97,   415,   416,   417,   419,   425,
+     180,     4,   395,     7,   333,   334,   335,     7,   347,   348,
+     349,     7,   364,   365,   366,    74,   387,     8,   468,   461,
+       3,     8,     8,   212,   215,   217,   219,     4,     4,   225,
+       4,   227,     4,     4,     3,     8,     8,   273,     6,     3,
+     295,     6,     3,   319,     6,     3,     3,     6,     6,     3,
+       6,     3,     6,   249,     6,     3,     4,     4,     4,     4,
+       4,     4,     3,     8,   404,   408,     4,     4,     4,     3,
+       8,   418,   420,     3,     8,     8,   150,   181,   182,   150,
+     336,     6,     3,   350,     6,     3,   367,     6,     3,   388,
+       8,     4,     4,   459,     4,     4,     4,     4,   153,   153,
+       4,   151,     4,   153,   151,   210,   276,   272,   298,   294,
+     322,   318,   234,   240,   284,   252,   248,   151,   151,   151,
+     151,   151,   151,   261,     4,     4,   151,   151,   151,   402,
+       4,     4,   416,     6,     3,   339,   335,   353,   349,   370,
+     366,     4,     5,     7,    16,    17,    18,    19,   213,   150,
+     150,   150,   150,   150,     8,     8,     8,     8,    86,    87,
+      88,   405,   150,   150,   150,   150,     8,     8,     8,   150,
+       7,   469,   470,   129,   130,   183,   462,   463,   464,   465,
+     471,     3,     6,     4,   466,     3,     8,   124,   126,   127,
+     131,   183,   220,   472,   473,   474,   475,   477,   485,   470,
+     151,     4,   463,   478,     4,   476,   486,     3,     8,   150,
+       4,   151,     4,     4,   473,     5,   150,     5,     7,   479,
+     480,     7,   487,   488,   489,   481,     3,     6,   490,     6,
+       3,   125,   482,   483,   480,   132,   133,   134,   135,   491,
+     492,   493,   495,   496,   497,   489,   484,     3,     8,   494,
+       4,     4,     4,     3,     8,     4,   483,     4,   151,   151,
+     151,   492,   150,   150
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   141,   143,   142,   144,   142,   145,   142,   146,   142,
-     147,   142,   148,   142,   149,   142,   150,   142,   151,   142,
-     152,   142,   153,   142,   154,   142,   155,   155,   155,   155,
-     155,   155,   155,   156,   158,   157,   159,   160,   160,   161,
-     161,   163,   162,   164,   164,   165,   165,   167,   166,   168,
-     168,   169,   169,   170,   172,   171,   173,   173,   174,   174,
-     174,   174,   174,   176,   175,   178,   177,   179,   179,   180,
-     180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
-     180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
-     180,   181,   182,   183,   184,   185,   187,   186,   189,   188,
-     191,   190,   193,   192,   195,   194,   196,   196,   197,   197,
-     197,   197,   197,   197,   197,   197,   197,   197,   199,   198,
-     200,   200,   200,   200,   202,   201,   204,   203,   206,   205,
-     208,   207,   209,   210,   211,   212,   214,   213,   215,   215,
-     216,   216,   217,   218,   220,   219,   221,   221,   222,   222,
-     223,   225,   224,   227,   226,   228,   228,   229,   229,   231,
-     230,   233,   232,   234,   234,   234,   235,   235,   237,   236,
-     239,   238,   241,   240,   242,   242,   243,   243,   243,   243,
-     243,   243,   244,   245,   246,   247,   248,   249,   251,   250,
-     252,   252,   253,   253,   255,   254,   257,   256,   258,   258,
-     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
-     259,   259,   259,   259,   259,   259,   259,   261,   260,   263,
-     262,   265,   264,   267,   266,   269,   268,   270,   271,   273,
-     272,   274,   274,   275,   275,   277,   276,   279,   278,   280,
-     280,   281,   281,   282,   282,   282,   282,   282,   282,   282,
-     282,   283,   284,   285,   287,   286,   289,   288,   291,   290,
-     292,   294,   293,   295,   297,   296,   298,   298,   299,   299,
-     301,   300,   303,   302,   304,   304,   305,   305,   306,   306,
-     306,   306,   306,   306,   307,   309,   308,   310,   311,   312,
-     314,   313,   315,   315,   316,   316,   318,   317,   320,   319,
-     321,   321,   322,   322,   322,   322,   324,   323,   326,   325,
-     328,   327,   329,   329,   330,   330,   332,   331,   334,   333,
-     335,   335,   336,   336,   336,   336,   336,   336,   336,   336,
-     338,   337,   339,   341,   340,   342,   343,   345,   344,   346,
-     346,   347,   347,   349,   348,   351,   350,   352,   352,   353,
+       0,   154,   156,   155,   157,   155,   158,   155,   159,   155,
+     160,   155,   161,   155,   162,   155,   163,   155,   164,   155,
+     165,   155,   166,   155,   167,   155,   168,   168,   168,   168,
+     168,   168,   168,   169,   171,   170,   172,   173,   173,   174,
+     174,   176,   175,   177,   177,   178,   178,   180,   179,   181,
+     181,   182,   182,   183,   185,   184,   186,   186,   187,   187,
+     187,   187,   187,   189,   188,   191,   190,   192,   192,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   194,   195,   196,   197,   198,   200,   199,   202,
+     201,   204,   203,   206,   205,   208,   207,   209,   209,   210,
+     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
+     210,   210,   212,   211,   213,   213,   213,   213,   215,   214,
+     217,   216,   219,   218,   221,   220,   222,   223,   225,   224,
+     227,   226,   228,   229,   230,   232,   231,   233,   233,   234,
+     234,   235,   236,   238,   237,   239,   239,   240,   240,   241,
+     243,   242,   245,   244,   246,   246,   247,   247,   249,   248,
+     251,   250,   252,   252,   252,   253,   253,   255,   254,   257,
+     256,   259,   258,   260,   260,   261,   261,   261,   261,   261,
+     261,   262,   263,   264,   265,   266,   267,   269,   268,   270,
+     270,   271,   271,   273,   272,   275,   274,   276,   276,   277,
+     277,   277,   277,   277,   277,   277,   277,   277,   277,   277,
+     277,   277,   277,   277,   277,   277,   279,   278,   281,   280,
+     283,   282,   285,   284,   287,   286,   288,   289,   291,   290,
+     292,   292,   293,   293,   295,   294,   297,   296,   298,   298,
+     299,   299,   300,   300,   300,   300,   300,   300,   300,   300,
+     301,   302,   303,   305,   304,   307,   306,   309,   308,   310,
+     312,   311,   313,   315,   314,   316,   316,   317,   317,   319,
+     318,   321,   320,   322,   322,   323,   323,   324,   324,   324,
+     324,   324,   324,   325,   327,   326,   328,   329,   330,   332,
+     331,   333,   333,   334,   334,   336,   335,   338,   337,   339,
+     339,   340,   340,   340,   340,   342,   341,   344,   343,   346,
+     345,   347,   347,   348,   348,   350,   349,   352,   351,   353,
      353,   354,   354,   354,   354,   354,   354,   354,   354,   356,
-     355,   358,   357,   360,   359,   362,   361,   364,   363,   366,
-     365,   368,   367,   370,   369,   372,   371,   373,   373,   374,
-     266,   375,   375,   376,   376,   377,   377,   377,   377,   378,
-     380,   379,   382,   381,   383,   383,   384,   384,   384,   384,
-     384,   384,   384,   386,   385,   387,   387,   387,   388,   390,
-     389,   391,   392,   393,   395,   394,   396,   396,   397,   397,
-     399,   398,   401,   400,   403,   402,   405,   404,   406,   406,
-     407,   407,   407,   407,   407,   407,   407,   407,   407,   407,
-     407,   407,   407,   407,   407,   407,   408,   410,   409,   412,
-     411,   413,   415,   414,   416,   417,   419,   418,   420,   420,
-     422,   421,   423,   424,   425,   426,   428,   427,   429,   429,
-     429,   429,   429,   431,   430,   433,   432,   435,   434,   437,
-     436,   438,   438,   439,   441,   440,   442,   442,   444,   443,
-     445,   445,   446,   446,   446,   446,   446,   447,   449,   448,
-     451,   450,   452,   452,   454,   453,   455,   455,   457,   456
+     355,   357,   359,   358,   360,   361,   363,   362,   364,   364,
+     365,   365,   367,   366,   369,   368,   370,   370,   371,   371,
+     372,   372,   372,   372,   372,   372,   372,   372,   374,   373,
+     376,   375,   378,   377,   380,   379,   382,   381,   384,   383,
+     386,   385,   388,   387,   390,   389,   391,   391,   392,   284,
+     393,   393,   394,   394,   395,   395,   395,   395,   396,   398,
+     397,   400,   399,   401,   401,   402,   402,   402,   402,   402,
+     402,   402,   404,   403,   405,   405,   405,   406,   408,   407,
+     409,   410,   411,   412,   414,   413,   415,   415,   416,   416,
+     418,   417,   420,   419,   422,   421,   424,   423,   425,   425,
+     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
+     426,   426,   426,   426,   426,   426,   427,   429,   428,   431,
+     430,   432,   434,   433,   435,   436,   438,   437,   439,   439,
+     441,   440,   442,   442,   443,   444,   445,   446,   448,   447,
+     449,   449,   449,   449,   449,   451,   450,   453,   452,   455,
+     454,   457,   456,   458,   458,   459,   459,   461,   460,   462,
+     462,   463,   463,   463,   464,   466,   465,   468,   467,   469,
+     469,   471,   470,   472,   472,   473,   473,   473,   473,   473,
+     473,   474,   476,   475,   478,   477,   479,   479,   481,   480,
+     482,   482,   484,   483,   486,   485,   487,   487,   488,   488,
+     490,   489,   491,   491,   492,   492,   492,   492,   494,   493,
+     495,   496,   497
   };
 
-  const unsigned char
+  const signed char
   Dhcp6Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -3866,63 +4270,69 @@ namespace isc { namespace dhcp {
        1,     1,     1,     0,     6,     0,     4,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     0,     6,     0,     4,
-       0,     4,     0,     6,     0,     6,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       0,     4,     3,     3,     3,     3,     0,     6,     1,     3,
-       1,     1,     1,     1,     0,     6,     1,     3,     1,     1,
-       1,     0,     6,     0,     6,     0,     1,     1,     3,     0,
-       4,     0,     4,     1,     3,     1,     1,     1,     0,     4,
-       0,     4,     0,     6,     1,     3,     1,     1,     1,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
+       1,     1,     3,     3,     3,     3,     3,     0,     6,     0,
+       4,     0,     4,     0,     6,     0,     6,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     1,     0,     4,     0,     4,     0,     4,
-       1,     0,     4,     3,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     0,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
+       1,     1,     0,     4,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     0,     4,     3,     3,     0,     4,
+       0,     4,     3,     3,     3,     0,     6,     1,     3,     1,
+       1,     1,     1,     0,     6,     1,     3,     1,     1,     1,
+       0,     6,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     1,     3,     1,     1,     1,     0,     4,     0,
+       4,     0,     6,     1,     3,     1,     1,     1,     1,     1,
+       1,     3,     3,     3,     3,     3,     3,     0,     6,     0,
+       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
        1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     3,     0,     4,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
+       1,     3,     1,     0,     4,     0,     4,     0,     4,     1,
+       0,     4,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     0,     4,     1,     1,     3,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
        3,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     6,     0,     4,     0,     6,     1,     3,     0,
-       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
-       0,     4,     0,     6,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     1,     1,     1,     3,     0,
-       4,     3,     3,     3,     0,     6,     1,     3,     1,     1,
+       4,     3,     0,     4,     3,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     6,     0,     4,     0,     6,     1,     3,     0,     4,
+       0,     1,     1,     3,     1,     1,     1,     1,     1,     0,
+       4,     0,     6,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     1,     1,     1,     3,     0,     4,
+       3,     3,     3,     3,     0,     6,     1,     3,     1,     1,
        0,     4,     0,     4,     0,     6,     0,     4,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     3,     0,     4,     0,
        4,     3,     0,     4,     3,     3,     0,     4,     1,     1,
-       0,     4,     3,     3,     3,     3,     0,     4,     1,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
-       6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     3,     0,     4,
-       0,     6,     1,     3,     0,     4,     1,     3,     0,     4
+       0,     4,     1,     1,     3,     3,     3,     3,     0,     4,
+       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       4,     0,     6,     1,     3,     1,     1,     0,     6,     1,
+       3,     1,     1,     1,     3,     0,     4,     0,     6,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     3,     0,     4,     0,     6,     1,     3,     0,     4,
+       1,     3,     0,     4,     0,     6,     0,     1,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     0,     4,
+       3,     3,     3
   };
 
 
-
+#if PARSER6_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp6Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
   "\"interfaces-config\"", "\"interfaces\"", "\"lease-database\"",
   "\"hosts-database\"", "\"type\"", "\"memfile\"", "\"mysql\"",
   "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
-  "\"persist\"", "\"lfc-interval\"", "\"readonly\"", "\"connect-timeout\"",
+  "\"persist\"", "\"mapped-store\"", "\"file-format\"", "\"lfc-interval\"",
+  "\"lfc-mode\"", "\"readonly\"", "\"connect-timeout\"",
   "\"preferred-lifetime\"", "\"valid-lifetime\"", "\"renew-timer\"",
   "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet6\"",
   "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
@@ -3941,20 +4351,22 @@ namespace isc { namespace dhcp {
   "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
   "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"", "\"server-id\"",
   "\"LLT\"", "\"EN\"", "\"LL\"", "\"identifier\"", "\"htype\"", "\"time\"",
-  "\"enterprise-id\"", "\"dhcp4o6-port\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"enterprise-id\"", "\"dhcp4o6-port\"", "\"packet-timeline\"",
+  "\"control-socket\"", "\"socket-type\"", "\"socket-name\"",
+  "\"dhcp-ddns\"", "\"enable-updates\"", "\"qualifying-suffix\"",
+  "\"server-ip\"", "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
   "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
   "\"always-include-fqdn\"", "\"allow-client-update\"",
   "\"override-no-update\"", "\"override-client-update\"",
   "\"replace-client-name\"", "\"generated-prefix\"", "\"UDP\"", "\"TCP\"",
-  "\"JSON\"", "\"when-present\"", "\"never\"", "\"always\"",
+  "\"JSON\"", "\"BINARY\"", "\"when-present\"", "\"never\"", "\"always\"",
   "\"when-not-present\"", "\"Logging\"", "\"loggers\"",
   "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
-  "\"Dhcp4\"", "\"DhcpDdns\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6",
-  "SUB_DHCP6", "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6",
-  "SUB_PD_POOL", "SUB_RESERVATION", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
+  "\"async\"", "\"queue-size\"", "\"overflow-policy\"", "\"rate-limits\"",
+  "\"message\"", "\"sample\"", "\"rate\"", "\"interval\"", "\"Dhcp4\"",
+  "\"DhcpDdns\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6",
+  "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL",
+  "SUB_RESERVATION", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
   "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "\"constant string\"",
   "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
   "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10",
@@ -3970,149 +4382,161 @@ namespace isc { namespace dhcp {
   "lease_database", "$@22", "hosts_database", "$@23",
   "database_map_params", "database_map_param", "database_type", "$@24",
   "db_type", "user", "$@25", "password", "$@26", "host", "$@27", "name",
-  "$@28", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "mac_sources", "$@29", "mac_sources_list", "mac_sources_value",
-  "duid_id", "string_id", "host_reservation_identifiers", "$@30",
+  "$@28", "persist", "mapped_store", "file_format", "$@29", "lfc_mode",
+  "$@30", "lfc_interval", "readonly", "connect_timeout", "mac_sources",
+  "$@31", "mac_sources_list", "mac_sources_value", "duid_id", "string_id",
+  "host_reservation_identifiers", "$@32",
   "host_reservation_identifiers_list", "host_reservation_identifier",
-  "hw_address_id", "relay_supplied_options", "$@31", "hooks_libraries",
-  "$@32", "hooks_libraries_list", "not_empty_hooks_libraries_list",
-  "hooks_library", "$@33", "sub_hooks_library", "$@34", "hooks_params",
-  "hooks_param", "library", "$@35", "parameters", "$@36",
-  "expired_leases_processing", "$@37", "expired_leases_params",
+  "hw_address_id", "relay_supplied_options", "$@33", "hooks_libraries",
+  "$@34", "hooks_libraries_list", "not_empty_hooks_libraries_list",
+  "hooks_library", "$@35", "sub_hooks_library", "$@36", "hooks_params",
+  "hooks_param", "library", "$@37", "parameters", "$@38",
+  "expired_leases_processing", "$@39", "expired_leases_params",
   "expired_leases_param", "reclaim_timer_wait_time",
   "flush_reclaimed_timer_wait_time", "hold_reclaimed_time",
   "max_reclaim_leases", "max_reclaim_time", "unwarned_reclaim_cycles",
-  "subnet6_list", "$@38", "subnet6_list_content", "not_empty_subnet6_list",
-  "subnet6", "$@39", "sub_subnet6", "$@40", "subnet6_params",
-  "subnet6_param", "subnet", "$@41", "interface", "$@42", "interface_id",
-  "$@43", "client_class", "$@44", "reservation_mode", "$@45", "id",
-  "rapid_commit", "option_def_list", "$@46", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@47",
-  "sub_option_def", "$@48", "option_def_params",
+  "subnet6_list", "$@40", "subnet6_list_content", "not_empty_subnet6_list",
+  "subnet6", "$@41", "sub_subnet6", "$@42", "subnet6_params",
+  "subnet6_param", "subnet", "$@43", "interface", "$@44", "interface_id",
+  "$@45", "client_class", "$@46", "reservation_mode", "$@47", "id",
+  "rapid_commit", "option_def_list", "$@48", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@49",
+  "sub_option_def", "$@50", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@49",
-  "option_def_record_types", "$@50", "space", "$@51", "option_def_space",
-  "option_def_encapsulate", "$@52", "option_def_array", "option_data_list",
-  "$@53", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@54", "sub_option_data", "$@55",
+  "code", "option_def_code", "option_def_type", "$@51",
+  "option_def_record_types", "$@52", "space", "$@53", "option_def_space",
+  "option_def_encapsulate", "$@54", "option_def_array", "option_data_list",
+  "$@55", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@56", "sub_option_data", "$@57",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@56",
+  "option_data_param", "option_data_name", "option_data_data", "$@58",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "pools_list", "$@57", "pools_list_content", "not_empty_pools_list",
-  "pool_list_entry", "$@58", "sub_pool6", "$@59", "pool_params",
-  "pool_param", "pool_entry", "$@60", "user_context", "$@61",
-  "pd_pools_list", "$@62", "pd_pools_list_content",
-  "not_empty_pd_pools_list", "pd_pool_entry", "$@63", "sub_pd_pool",
-  "$@64", "pd_pool_params", "pd_pool_param", "pd_prefix", "$@65",
-  "pd_prefix_len", "excluded_prefix", "$@66", "excluded_prefix_len",
-  "pd_delegated_len", "reservations", "$@67", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@68", "sub_reservation",
-  "$@69", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "ip_addresses", "$@70", "prefixes", "$@71", "duid",
-  "$@72", "hw_address", "$@73", "hostname", "$@74",
-  "reservation_client_classes", "$@75", "relay", "$@76", "relay_map",
-  "$@77", "client_classes", "$@78", "client_classes_list", "$@79",
+  "pools_list", "$@59", "pools_list_content", "not_empty_pools_list",
+  "pool_list_entry", "$@60", "sub_pool6", "$@61", "pool_params",
+  "pool_param", "pool_entry", "$@62", "user_context", "$@63",
+  "pd_pools_list", "$@64", "pd_pools_list_content",
+  "not_empty_pd_pools_list", "pd_pool_entry", "$@65", "sub_pd_pool",
+  "$@66", "pd_pool_params", "pd_pool_param", "pd_prefix", "$@67",
+  "pd_prefix_len", "excluded_prefix", "$@68", "excluded_prefix_len",
+  "pd_delegated_len", "reservations", "$@69", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@70", "sub_reservation",
+  "$@71", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "ip_addresses", "$@72", "prefixes", "$@73", "duid",
+  "$@74", "hw_address", "$@75", "hostname", "$@76",
+  "reservation_client_classes", "$@77", "relay", "$@78", "relay_map",
+  "$@79", "client_classes", "$@80", "client_classes_list", "$@81",
   "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@80",
-  "server_id", "$@81", "server_id_params", "server_id_param",
-  "server_id_type", "$@82", "duid_type", "htype", "identifier", "$@83",
-  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@84",
-  "control_socket_params", "control_socket_param", "socket_type", "$@85",
-  "socket_name", "$@86", "dhcp_ddns", "$@87", "sub_dhcp_ddns", "$@88",
-  "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@89", "server_ip", "$@90", "server_port",
-  "sender_ip", "$@91", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@92", "ncr_protocol_value", "ncr_format", "$@93",
-  "always_include_fqdn", "allow_client_update", "override_no_update",
-  "override_client_update", "replace_client_name", "$@94",
-  "replace_client_name_value", "generated_prefix", "$@95",
-  "dhcp4_json_object", "$@96", "dhcpddns_json_object", "$@97",
-  "logging_object", "$@98", "logging_params", "logging_param", "loggers",
-  "$@99", "loggers_entries", "logger_entry", "$@100", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@101", "output_options_list",
-  "$@102", "output_options_list_content", "output_entry", "$@103",
-  "output_params", "output_param", "$@104", YY_NULLPTR
+  "client_class_param", "client_class_name", "client_class_test", "$@82",
+  "server_id", "$@83", "server_id_params", "server_id_param",
+  "server_id_type", "$@84", "duid_type", "htype", "identifier", "$@85",
+  "time", "enterprise_id", "dhcp4o6_port", "packet_timeline",
+  "control_socket", "$@86", "control_socket_params",
+  "control_socket_param", "socket_type", "$@87", "socket_name", "$@88",
+  "dhcp_ddns", "$@89", "sub_dhcp_ddns", "$@90", "dhcp_ddns_params",
+  "dhcp_ddns_param", "enable_updates", "qualifying_suffix", "$@91",
+  "server_ip", "$@92", "server_port", "sender_ip", "$@93", "sender_port",
+  "max_queue_size", "ncr_protocol", "$@94", "ncr_protocol_value",
+  "ncr_format", "$@95", "ncr_format_value", "always_include_fqdn",
+  "allow_client_update", "override_no_update", "override_client_update",
+  "replace_client_name", "$@96", "replace_client_name_value",
+  "generated_prefix", "$@97", "dhcp4_json_object", "$@98",
+  "dhcpddns_json_object", "$@99", "logging_object", "$@100",
+  "logging_params", "logging_param", "async_logging", "$@101",
+  "async_logging_params", "async_logging_param", "queue_size",
+  "overflow_policy", "$@102", "loggers", "$@103", "loggers_entries",
+  "logger_entry", "$@104", "logger_params", "logger_param", "debuglevel",
+  "severity", "$@105", "output_options_list", "$@106",
+  "output_options_list_content", "output_entry", "$@107", "output_params",
+  "output_param", "$@108", "rate_limits_list", "$@109",
+  "rate_limits_list_content", "rate_limit_entries", "rate_limit_entry",
+  "$@110", "rate_limit_params", "rate_limit_param", "rate_limit_message",
+  "$@111", "rate_limit_sample", "rate_limit_rate", "rate_limit_interval", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER6_DEBUG
-  const unsigned short int
+  const short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   221,   221,   221,   222,   222,   223,   223,   224,   224,
-     225,   225,   226,   226,   227,   227,   228,   228,   229,   229,
-     230,   230,   231,   231,   232,   232,   240,   241,   242,   243,
-     244,   245,   246,   249,   254,   254,   265,   268,   269,   272,
-     276,   283,   283,   290,   291,   294,   298,   305,   305,   312,
-     313,   316,   320,   331,   341,   341,   353,   354,   358,   359,
-     360,   361,   362,   365,   365,   382,   382,   390,   391,   396,
-     397,   398,   399,   400,   401,   402,   403,   404,   405,   406,
-     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
-     417,   420,   425,   430,   435,   440,   445,   445,   455,   455,
-     463,   463,   473,   473,   483,   483,   493,   494,   497,   498,
-     499,   500,   501,   502,   503,   504,   505,   506,   509,   509,
-     516,   517,   518,   519,   522,   522,   530,   530,   538,   538,
-     546,   546,   554,   559,   564,   569,   574,   574,   584,   585,
-     588,   589,   592,   597,   602,   602,   612,   613,   616,   617,
-     620,   627,   627,   637,   637,   647,   648,   651,   652,   655,
-     655,   663,   663,   671,   672,   673,   676,   677,   680,   680,
-     688,   688,   696,   696,   706,   707,   710,   711,   712,   713,
-     714,   715,   718,   723,   728,   733,   738,   743,   751,   751,
-     764,   765,   768,   769,   776,   776,   799,   799,   808,   809,
-     813,   814,   815,   816,   817,   818,   819,   820,   821,   822,
-     823,   824,   825,   826,   827,   828,   829,   832,   832,   840,
-     840,   848,   848,   856,   856,   864,   864,   872,   877,   886,
-     886,   898,   899,   902,   903,   908,   908,   919,   919,   929,
-     930,   933,   934,   937,   938,   939,   940,   941,   942,   943,
-     944,   947,   949,   954,   956,   956,   964,   964,   972,   972,
-     980,   982,   982,   990,   999,   999,  1011,  1012,  1017,  1018,
-    1023,  1023,  1034,  1034,  1045,  1046,  1051,  1052,  1057,  1058,
-    1059,  1060,  1061,  1062,  1065,  1067,  1067,  1075,  1077,  1079,
-    1087,  1087,  1099,  1100,  1103,  1104,  1107,  1107,  1115,  1115,
-    1123,  1124,  1127,  1128,  1129,  1130,  1133,  1133,  1141,  1141,
-    1151,  1151,  1163,  1164,  1167,  1168,  1171,  1171,  1179,  1179,
-    1187,  1188,  1191,  1192,  1193,  1194,  1195,  1196,  1197,  1198,
-    1201,  1201,  1209,  1214,  1214,  1222,  1227,  1235,  1235,  1245,
-    1246,  1249,  1250,  1253,  1253,  1261,  1261,  1269,  1270,  1273,
-    1274,  1278,  1279,  1280,  1281,  1282,  1283,  1284,  1285,  1288,
-    1288,  1298,  1298,  1308,  1308,  1316,  1316,  1324,  1324,  1332,
-    1332,  1345,  1345,  1355,  1355,  1366,  1366,  1376,  1377,  1380,
-    1380,  1388,  1389,  1392,  1393,  1396,  1397,  1398,  1399,  1402,
-    1404,  1404,  1415,  1415,  1425,  1426,  1429,  1430,  1431,  1432,
-    1433,  1434,  1435,  1438,  1438,  1445,  1446,  1447,  1450,  1455,
-    1455,  1463,  1468,  1475,  1482,  1482,  1492,  1493,  1496,  1497,
-    1500,  1500,  1508,  1508,  1518,  1518,  1528,  1528,  1536,  1537,
-    1540,  1541,  1542,  1543,  1544,  1545,  1546,  1547,  1548,  1549,
-    1550,  1551,  1552,  1553,  1554,  1555,  1558,  1563,  1563,  1571,
-    1571,  1579,  1584,  1584,  1592,  1597,  1602,  1602,  1610,  1611,
-    1614,  1614,  1622,  1627,  1632,  1637,  1642,  1642,  1650,  1653,
-    1656,  1659,  1662,  1668,  1668,  1678,  1678,  1685,  1685,  1697,
-    1697,  1710,  1711,  1715,  1719,  1719,  1731,  1732,  1736,  1736,
-    1744,  1745,  1748,  1749,  1750,  1751,  1752,  1755,  1760,  1760,
-    1768,  1768,  1778,  1779,  1782,  1782,  1790,  1791,  1794,  1794
+       0,   236,   236,   236,   237,   237,   238,   238,   239,   239,
+     240,   240,   241,   241,   242,   242,   243,   243,   244,   244,
+     245,   245,   246,   246,   247,   247,   255,   256,   257,   258,
+     259,   260,   261,   264,   269,   269,   280,   283,   284,   287,
+     291,   298,   298,   305,   306,   309,   313,   320,   320,   327,
+     328,   331,   335,   346,   356,   356,   368,   369,   373,   374,
+     375,   376,   377,   380,   380,   397,   397,   405,   406,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   436,   441,   446,   451,   456,   461,   461,   471,
+     471,   479,   479,   489,   489,   499,   499,   509,   510,   513,
+     514,   515,   516,   517,   518,   519,   520,   521,   522,   523,
+     524,   525,   528,   528,   535,   536,   537,   538,   541,   541,
+     549,   549,   557,   557,   565,   565,   573,   578,   583,   583,
+     591,   591,   599,   604,   609,   614,   614,   624,   625,   628,
+     629,   632,   637,   642,   642,   652,   653,   656,   657,   660,
+     667,   667,   677,   677,   687,   688,   691,   692,   695,   695,
+     703,   703,   711,   712,   713,   716,   717,   720,   720,   728,
+     728,   736,   736,   746,   747,   750,   751,   752,   753,   754,
+     755,   758,   763,   768,   773,   778,   783,   791,   791,   804,
+     805,   808,   809,   816,   816,   839,   839,   848,   849,   853,
+     854,   855,   856,   857,   858,   859,   860,   861,   862,   863,
+     864,   865,   866,   867,   868,   869,   872,   872,   880,   880,
+     888,   888,   896,   896,   904,   904,   912,   917,   926,   926,
+     938,   939,   942,   943,   948,   948,   959,   959,   969,   970,
+     973,   974,   977,   978,   979,   980,   981,   982,   983,   984,
+     987,   989,   994,   996,   996,  1004,  1004,  1012,  1012,  1020,
+    1022,  1022,  1030,  1039,  1039,  1051,  1052,  1057,  1058,  1063,
+    1063,  1074,  1074,  1085,  1086,  1091,  1092,  1097,  1098,  1099,
+    1100,  1101,  1102,  1105,  1107,  1107,  1115,  1117,  1119,  1127,
+    1127,  1139,  1140,  1143,  1144,  1147,  1147,  1155,  1155,  1163,
+    1164,  1167,  1168,  1169,  1170,  1173,  1173,  1181,  1181,  1191,
+    1191,  1203,  1204,  1207,  1208,  1211,  1211,  1219,  1219,  1227,
+    1228,  1231,  1232,  1233,  1234,  1235,  1236,  1237,  1238,  1241,
+    1241,  1249,  1254,  1254,  1262,  1267,  1275,  1275,  1285,  1286,
+    1289,  1290,  1293,  1293,  1301,  1301,  1309,  1310,  1313,  1314,
+    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1328,  1328,
+    1338,  1338,  1348,  1348,  1356,  1356,  1364,  1364,  1372,  1372,
+    1385,  1385,  1395,  1395,  1406,  1406,  1416,  1417,  1420,  1420,
+    1428,  1429,  1432,  1433,  1436,  1437,  1438,  1439,  1442,  1444,
+    1444,  1455,  1455,  1465,  1466,  1469,  1470,  1471,  1472,  1473,
+    1474,  1475,  1478,  1478,  1485,  1486,  1487,  1490,  1495,  1495,
+    1503,  1508,  1515,  1520,  1527,  1527,  1537,  1538,  1541,  1542,
+    1545,  1545,  1553,  1553,  1563,  1563,  1573,  1573,  1581,  1582,
+    1585,  1586,  1587,  1588,  1589,  1590,  1591,  1592,  1593,  1594,
+    1595,  1596,  1597,  1598,  1599,  1600,  1603,  1608,  1608,  1616,
+    1616,  1624,  1629,  1629,  1637,  1642,  1647,  1647,  1655,  1656,
+    1659,  1659,  1667,  1668,  1671,  1676,  1681,  1686,  1691,  1691,
+    1699,  1702,  1705,  1708,  1711,  1717,  1717,  1727,  1727,  1734,
+    1734,  1746,  1746,  1759,  1760,  1764,  1765,  1769,  1769,  1779,
+    1780,  1783,  1784,  1785,  1788,  1793,  1793,  1803,  1803,  1815,
+    1816,  1820,  1820,  1828,  1829,  1832,  1833,  1834,  1835,  1836,
+    1837,  1840,  1845,  1845,  1853,  1853,  1863,  1864,  1867,  1867,
+    1875,  1876,  1879,  1879,  1889,  1889,  1899,  1900,  1903,  1904,
+    1907,  1907,  1915,  1916,  1919,  1920,  1921,  1922,  1925,  1925,
+    1933,  1938,  1943
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp6Parser::yystack_print_ ()
+  Dhcp6Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp6Parser::yy_reduce_print_ (int yyrule)
+  Dhcp6Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -4121,10 +4545,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER6_DEBUG
 
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:1167
+#line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 4127 "dhcp6_parser.cc" // lalr1.cc:1167
-#line 1802 "dhcp6_parser.yy" // lalr1.cc:1168
+#line 4551 "dhcp6_parser.cc"
+
+#line 1948 "dhcp6_parser.yy"
 
 
 void
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +30,7 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+
 /**
  ** \file dhcp6_parser.h
  ** Define the isc::dhcp::parser class.
@@ -37,10 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
 #ifndef YY_PARSER6_DHCP6_PARSER_H_INCLUDED
 # define YY_PARSER6_DHCP6_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "dhcp6_parser.yy" // lalr1.cc:377
+// "%code requires" blocks.
+#line 17 "dhcp6_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -52,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 56 "dhcp6_parser.h" // lalr1.cc:377
+#line 61 "dhcp6_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -60,56 +65,87 @@ using namespace std;
 # include <stdexcept>
 # include <string>
 # include <vector>
-# include "stack.hh"
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER6__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER6__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -122,6 +158,39 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
 /* Debug traces.  */
 #ifndef PARSER6_DEBUG
 # if defined YYDEBUG
@@ -135,120 +204,187 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined PARSER6_DEBUG */
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:377
+#line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 141 "dhcp6_parser.h" // lalr1.cc:377
+#line 210 "dhcp6_parser.h"
+
 
 
 
-  /// A char[S] buffer to store and retrieve objects.
+  /// A Bison parser.
+  class Dhcp6Parser
+  {
+  public:
+#ifdef PARSER6_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER6_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER6_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yytypeid_ (YY_NULLPTR)
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
+      , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (const T& t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
-      new (yyas_<T> ()) T (t);
+      PARSER6__ASSERT (sizeof (T) <= size);
+      new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER6__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
-    build ()
+    emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T;
+      return *new (yyas_<T> ()) T ();
     }
 
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
-    build (const T& t)
+    emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
+# endif
+
+    /// Instantiate an empty \a T in here.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build ()
+    {
+      return emplace<T> ();
+    }
+
+    /// Instantiate a \a T in here from \a t.
+    /// Obsolete, use emplace.
+    template <typename T>
+    T&
+    build (const T& t)
+    {
+      return emplace<T> (t);
+    }
 
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == typeid (T));
+      PARSER6__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == typeid (T));
+      PARSER6__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
-    /// should not be the variant's responsability.
+    /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
+    template <typename T>
+    void
+    move (self_type& that)
+    {
+# if 201103L <= YY_CPLUSPLUS
+      emplace<T> (std::move (that.as<T> ()));
+# else
+      emplace<T> ();
+      swap<T> (that);
+# endif
+      that.destroy<T> ();
+    }
+
+# if 201103L <= YY_CPLUSPLUS
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type&& that)
     {
-      build<T> ();
-      swap<T> (other);
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
+#endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      build<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -261,46 +397,31 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
-    self_type& operator=(const self_type&);
-    variant (const self_type&);
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
+    self_type& operator= (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class Dhcp6Parser
-  {
-  public:
-#ifndef PARSER6_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
@@ -309,200 +430,753 @@ namespace isc { namespace dhcp {
       // db_type
       // duid_type
       // ncr_protocol_value
+      // ncr_format_value
       // replace_client_name_value
-      char dummy1[sizeof(ElementPtr)];
+      char dummy1[sizeof (ElementPtr)];
 
       // "boolean"
-      char dummy2[sizeof(bool)];
+      char dummy2[sizeof (bool)];
 
       // "floating point"
-      char dummy3[sizeof(double)];
+      char dummy3[sizeof (double)];
 
       // "integer"
-      char dummy4[sizeof(int64_t)];
+      char dummy4[sizeof (int64_t)];
 
       // "constant string"
-      char dummy5[sizeof(std::string)];
-};
+      char dummy5[sizeof (std::string)];
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof(union_type)> semantic_type;
-#else
-    typedef PARSER6_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP6 = 265,
-        TOKEN_INTERFACES_CONFIG = 266,
-        TOKEN_INTERFACES = 267,
-        TOKEN_LEASE_DATABASE = 268,
-        TOKEN_HOSTS_DATABASE = 269,
-        TOKEN_TYPE = 270,
-        TOKEN_MEMFILE = 271,
-        TOKEN_MYSQL = 272,
-        TOKEN_POSTGRESQL = 273,
-        TOKEN_CQL = 274,
-        TOKEN_USER = 275,
-        TOKEN_PASSWORD = 276,
-        TOKEN_HOST = 277,
-        TOKEN_PERSIST = 278,
-        TOKEN_LFC_INTERVAL = 279,
-        TOKEN_READONLY = 280,
-        TOKEN_CONNECT_TIMEOUT = 281,
-        TOKEN_PREFERRED_LIFETIME = 282,
-        TOKEN_VALID_LIFETIME = 283,
-        TOKEN_RENEW_TIMER = 284,
-        TOKEN_REBIND_TIMER = 285,
-        TOKEN_DECLINE_PROBATION_PERIOD = 286,
-        TOKEN_SUBNET6 = 287,
-        TOKEN_OPTION_DEF = 288,
-        TOKEN_OPTION_DATA = 289,
-        TOKEN_NAME = 290,
-        TOKEN_DATA = 291,
-        TOKEN_CODE = 292,
-        TOKEN_SPACE = 293,
-        TOKEN_CSV_FORMAT = 294,
-        TOKEN_RECORD_TYPES = 295,
-        TOKEN_ENCAPSULATE = 296,
-        TOKEN_ARRAY = 297,
-        TOKEN_POOLS = 298,
-        TOKEN_POOL = 299,
-        TOKEN_PD_POOLS = 300,
-        TOKEN_PREFIX = 301,
-        TOKEN_PREFIX_LEN = 302,
-        TOKEN_EXCLUDED_PREFIX = 303,
-        TOKEN_EXCLUDED_PREFIX_LEN = 304,
-        TOKEN_DELEGATED_LEN = 305,
-        TOKEN_USER_CONTEXT = 306,
-        TOKEN_SUBNET = 307,
-        TOKEN_INTERFACE = 308,
-        TOKEN_INTERFACE_ID = 309,
-        TOKEN_ID = 310,
-        TOKEN_RAPID_COMMIT = 311,
-        TOKEN_RESERVATION_MODE = 312,
-        TOKEN_MAC_SOURCES = 313,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 314,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 315,
-        TOKEN_CLIENT_CLASSES = 316,
-        TOKEN_TEST = 317,
-        TOKEN_CLIENT_CLASS = 318,
-        TOKEN_RESERVATIONS = 319,
-        TOKEN_IP_ADDRESSES = 320,
-        TOKEN_PREFIXES = 321,
-        TOKEN_DUID = 322,
-        TOKEN_HW_ADDRESS = 323,
-        TOKEN_HOSTNAME = 324,
-        TOKEN_RELAY = 325,
-        TOKEN_IP_ADDRESS = 326,
-        TOKEN_HOOKS_LIBRARIES = 327,
-        TOKEN_LIBRARY = 328,
-        TOKEN_PARAMETERS = 329,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 330,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 331,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 332,
-        TOKEN_HOLD_RECLAIMED_TIME = 333,
-        TOKEN_MAX_RECLAIM_LEASES = 334,
-        TOKEN_MAX_RECLAIM_TIME = 335,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 336,
-        TOKEN_SERVER_ID = 337,
-        TOKEN_LLT = 338,
-        TOKEN_EN = 339,
-        TOKEN_LL = 340,
-        TOKEN_IDENTIFIER = 341,
-        TOKEN_HTYPE = 342,
-        TOKEN_TIME = 343,
-        TOKEN_ENTERPRISE_ID = 344,
-        TOKEN_DHCP4O6_PORT = 345,
-        TOKEN_CONTROL_SOCKET = 346,
-        TOKEN_SOCKET_TYPE = 347,
-        TOKEN_SOCKET_NAME = 348,
-        TOKEN_DHCP_DDNS = 349,
-        TOKEN_ENABLE_UPDATES = 350,
-        TOKEN_QUALIFYING_SUFFIX = 351,
-        TOKEN_SERVER_IP = 352,
-        TOKEN_SERVER_PORT = 353,
-        TOKEN_SENDER_IP = 354,
-        TOKEN_SENDER_PORT = 355,
-        TOKEN_MAX_QUEUE_SIZE = 356,
-        TOKEN_NCR_PROTOCOL = 357,
-        TOKEN_NCR_FORMAT = 358,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 359,
-        TOKEN_ALLOW_CLIENT_UPDATE = 360,
-        TOKEN_OVERRIDE_NO_UPDATE = 361,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 362,
-        TOKEN_REPLACE_CLIENT_NAME = 363,
-        TOKEN_GENERATED_PREFIX = 364,
-        TOKEN_UDP = 365,
-        TOKEN_TCP = 366,
-        TOKEN_JSON = 367,
-        TOKEN_WHEN_PRESENT = 368,
-        TOKEN_NEVER = 369,
-        TOKEN_ALWAYS = 370,
-        TOKEN_WHEN_NOT_PRESENT = 371,
-        TOKEN_LOGGING = 372,
-        TOKEN_LOGGERS = 373,
-        TOKEN_OUTPUT_OPTIONS = 374,
-        TOKEN_OUTPUT = 375,
-        TOKEN_DEBUGLEVEL = 376,
-        TOKEN_SEVERITY = 377,
-        TOKEN_DHCP4 = 378,
-        TOKEN_DHCPDDNS = 379,
-        TOKEN_TOPLEVEL_JSON = 380,
-        TOKEN_TOPLEVEL_DHCP6 = 381,
-        TOKEN_SUB_DHCP6 = 382,
-        TOKEN_SUB_INTERFACES6 = 383,
-        TOKEN_SUB_SUBNET6 = 384,
-        TOKEN_SUB_POOL6 = 385,
-        TOKEN_SUB_PD_POOL = 386,
-        TOKEN_SUB_RESERVATION = 387,
-        TOKEN_SUB_OPTION_DEF = 388,
-        TOKEN_SUB_OPTION_DATA = 389,
-        TOKEN_SUB_HOOKS_LIBRARY = 390,
-        TOKEN_SUB_DHCP_DDNS = 391,
-        TOKEN_STRING = 392,
-        TOKEN_INTEGER = 393,
-        TOKEN_FLOAT = 394,
-        TOKEN_BOOLEAN = 395
+      enum token_kind_type
+      {
+        TOKEN_PARSER6_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER6_error = 256,     // error
+    TOKEN_PARSER6_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP6 = 265,             // "Dhcp6"
+    TOKEN_INTERFACES_CONFIG = 266, // "interfaces-config"
+    TOKEN_INTERFACES = 267,        // "interfaces"
+    TOKEN_LEASE_DATABASE = 268,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 269,    // "hosts-database"
+    TOKEN_TYPE = 270,              // "type"
+    TOKEN_MEMFILE = 271,           // "memfile"
+    TOKEN_MYSQL = 272,             // "mysql"
+    TOKEN_POSTGRESQL = 273,        // "postgresql"
+    TOKEN_CQL = 274,               // "cql"
+    TOKEN_USER = 275,              // "user"
+    TOKEN_PASSWORD = 276,          // "password"
+    TOKEN_HOST = 277,              // "host"
+    TOKEN_PERSIST = 278,           // "persist"
+    TOKEN_MAPPED_STORE = 279,      // "mapped-store"
+    TOKEN_FILE_FORMAT = 280,       // "file-format"
+    TOKEN_LFC_INTERVAL = 281,      // "lfc-interval"
+    TOKEN_LFC_MODE = 282,          // "lfc-mode"
+    TOKEN_READONLY = 283,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 284,   // "connect-timeout"
+    TOKEN_PREFERRED_LIFETIME = 285, // "preferred-lifetime"
+    TOKEN_VALID_LIFETIME = 286,    // "valid-lifetime"
+    TOKEN_RENEW_TIMER = 287,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 288,      // "rebind-timer"
+    TOKEN_DECLINE_PROBATION_PERIOD = 289, // "decline-probation-period"
+    TOKEN_SUBNET6 = 290,           // "subnet6"
+    TOKEN_OPTION_DEF = 291,        // "option-def"
+    TOKEN_OPTION_DATA = 292,       // "option-data"
+    TOKEN_NAME = 293,              // "name"
+    TOKEN_DATA = 294,              // "data"
+    TOKEN_CODE = 295,              // "code"
+    TOKEN_SPACE = 296,             // "space"
+    TOKEN_CSV_FORMAT = 297,        // "csv-format"
+    TOKEN_RECORD_TYPES = 298,      // "record-types"
+    TOKEN_ENCAPSULATE = 299,       // "encapsulate"
+    TOKEN_ARRAY = 300,             // "array"
+    TOKEN_POOLS = 301,             // "pools"
+    TOKEN_POOL = 302,              // "pool"
+    TOKEN_PD_POOLS = 303,          // "pd-pools"
+    TOKEN_PREFIX = 304,            // "prefix"
+    TOKEN_PREFIX_LEN = 305,        // "prefix-len"
+    TOKEN_EXCLUDED_PREFIX = 306,   // "excluded-prefix"
+    TOKEN_EXCLUDED_PREFIX_LEN = 307, // "excluded-prefix-len"
+    TOKEN_DELEGATED_LEN = 308,     // "delegated-len"
+    TOKEN_USER_CONTEXT = 309,      // "user-context"
+    TOKEN_SUBNET = 310,            // "subnet"
+    TOKEN_INTERFACE = 311,         // "interface"
+    TOKEN_INTERFACE_ID = 312,      // "interface-id"
+    TOKEN_ID = 313,                // "id"
+    TOKEN_RAPID_COMMIT = 314,      // "rapid-commit"
+    TOKEN_RESERVATION_MODE = 315,  // "reservation-mode"
+    TOKEN_MAC_SOURCES = 316,       // "mac-sources"
+    TOKEN_RELAY_SUPPLIED_OPTIONS = 317, // "relay-supplied-options"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 318, // "host-reservation-identifiers"
+    TOKEN_CLIENT_CLASSES = 319,    // "client-classes"
+    TOKEN_TEST = 320,              // "test"
+    TOKEN_CLIENT_CLASS = 321,      // "client-class"
+    TOKEN_RESERVATIONS = 322,      // "reservations"
+    TOKEN_IP_ADDRESSES = 323,      // "ip-addresses"
+    TOKEN_PREFIXES = 324,          // "prefixes"
+    TOKEN_DUID = 325,              // "duid"
+    TOKEN_HW_ADDRESS = 326,        // "hw-address"
+    TOKEN_HOSTNAME = 327,          // "hostname"
+    TOKEN_RELAY = 328,             // "relay"
+    TOKEN_IP_ADDRESS = 329,        // "ip-address"
+    TOKEN_HOOKS_LIBRARIES = 330,   // "hooks-libraries"
+    TOKEN_LIBRARY = 331,           // "library"
+    TOKEN_PARAMETERS = 332,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 333, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 334, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 335, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 336, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 337, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 338,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 339, // "unwarned-reclaim-cycles"
+    TOKEN_SERVER_ID = 340,         // "server-id"
+    TOKEN_LLT = 341,               // "LLT"
+    TOKEN_EN = 342,                // "EN"
+    TOKEN_LL = 343,                // "LL"
+    TOKEN_IDENTIFIER = 344,        // "identifier"
+    TOKEN_HTYPE = 345,             // "htype"
+    TOKEN_TIME = 346,              // "time"
+    TOKEN_ENTERPRISE_ID = 347,     // "enterprise-id"
+    TOKEN_DHCP4O6_PORT = 348,      // "dhcp4o6-port"
+    TOKEN_PACKET_TIMELINE = 349,   // "packet-timeline"
+    TOKEN_CONTROL_SOCKET = 350,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 351,       // "socket-type"
+    TOKEN_SOCKET_NAME = 352,       // "socket-name"
+    TOKEN_DHCP_DDNS = 353,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 354,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 355, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 356,         // "server-ip"
+    TOKEN_SERVER_PORT = 357,       // "server-port"
+    TOKEN_SENDER_IP = 358,         // "sender-ip"
+    TOKEN_SENDER_PORT = 359,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 360,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 361,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 362,        // "ncr-format"
+    TOKEN_ALWAYS_INCLUDE_FQDN = 363, // "always-include-fqdn"
+    TOKEN_ALLOW_CLIENT_UPDATE = 364, // "allow-client-update"
+    TOKEN_OVERRIDE_NO_UPDATE = 365, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 366, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 367, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 368,  // "generated-prefix"
+    TOKEN_UDP = 369,               // "UDP"
+    TOKEN_TCP = 370,               // "TCP"
+    TOKEN_JSON = 371,              // "JSON"
+    TOKEN_BINARY = 372,            // "BINARY"
+    TOKEN_WHEN_PRESENT = 373,      // "when-present"
+    TOKEN_NEVER = 374,             // "never"
+    TOKEN_ALWAYS = 375,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 376,  // "when-not-present"
+    TOKEN_LOGGING = 377,           // "Logging"
+    TOKEN_LOGGERS = 378,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 379,    // "output_options"
+    TOKEN_OUTPUT = 380,            // "output"
+    TOKEN_DEBUGLEVEL = 381,        // "debuglevel"
+    TOKEN_SEVERITY = 382,          // "severity"
+    TOKEN_ASYNC = 383,             // "async"
+    TOKEN_QUEUE_SIZE = 384,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 385,   // "overflow-policy"
+    TOKEN_RATE_LIMITS = 386,       // "rate-limits"
+    TOKEN_MESSAGE = 387,           // "message"
+    TOKEN_SAMPLE = 388,            // "sample"
+    TOKEN_RATE = 389,              // "rate"
+    TOKEN_INTERVAL = 390,          // "interval"
+    TOKEN_DHCP4 = 391,             // "Dhcp4"
+    TOKEN_DHCPDDNS = 392,          // "DhcpDdns"
+    TOKEN_TOPLEVEL_JSON = 393,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP6 = 394,    // TOPLEVEL_DHCP6
+    TOKEN_SUB_DHCP6 = 395,         // SUB_DHCP6
+    TOKEN_SUB_INTERFACES6 = 396,   // SUB_INTERFACES6
+    TOKEN_SUB_SUBNET6 = 397,       // SUB_SUBNET6
+    TOKEN_SUB_POOL6 = 398,         // SUB_POOL6
+    TOKEN_SUB_PD_POOL = 399,       // SUB_PD_POOL
+    TOKEN_SUB_RESERVATION = 400,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEF = 401,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 402,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 403, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 404,     // SUB_DHCP_DDNS
+    TOKEN_STRING = 405,            // "constant string"
+    TOKEN_INTEGER = 406,           // "integer"
+    TOKEN_FLOAT = 407,             // "floating point"
+    TOKEN_BOOLEAN = 408            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 154, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP6 = 10,                            // "Dhcp6"
+        S_INTERFACES_CONFIG = 11,                // "interfaces-config"
+        S_INTERFACES = 12,                       // "interfaces"
+        S_LEASE_DATABASE = 13,                   // "lease-database"
+        S_HOSTS_DATABASE = 14,                   // "hosts-database"
+        S_TYPE = 15,                             // "type"
+        S_MEMFILE = 16,                          // "memfile"
+        S_MYSQL = 17,                            // "mysql"
+        S_POSTGRESQL = 18,                       // "postgresql"
+        S_CQL = 19,                              // "cql"
+        S_USER = 20,                             // "user"
+        S_PASSWORD = 21,                         // "password"
+        S_HOST = 22,                             // "host"
+        S_PERSIST = 23,                          // "persist"
+        S_MAPPED_STORE = 24,                     // "mapped-store"
+        S_FILE_FORMAT = 25,                      // "file-format"
+        S_LFC_INTERVAL = 26,                     // "lfc-interval"
+        S_LFC_MODE = 27,                         // "lfc-mode"
+        S_READONLY = 28,                         // "readonly"
+        S_CONNECT_TIMEOUT = 29,                  // "connect-timeout"
+        S_PREFERRED_LIFETIME = 30,               // "preferred-lifetime"
+        S_VALID_LIFETIME = 31,                   // "valid-lifetime"
+        S_RENEW_TIMER = 32,                      // "renew-timer"
+        S_REBIND_TIMER = 33,                     // "rebind-timer"
+        S_DECLINE_PROBATION_PERIOD = 34,         // "decline-probation-period"
+        S_SUBNET6 = 35,                          // "subnet6"
+        S_OPTION_DEF = 36,                       // "option-def"
+        S_OPTION_DATA = 37,                      // "option-data"
+        S_NAME = 38,                             // "name"
+        S_DATA = 39,                             // "data"
+        S_CODE = 40,                             // "code"
+        S_SPACE = 41,                            // "space"
+        S_CSV_FORMAT = 42,                       // "csv-format"
+        S_RECORD_TYPES = 43,                     // "record-types"
+        S_ENCAPSULATE = 44,                      // "encapsulate"
+        S_ARRAY = 45,                            // "array"
+        S_POOLS = 46,                            // "pools"
+        S_POOL = 47,                             // "pool"
+        S_PD_POOLS = 48,                         // "pd-pools"
+        S_PREFIX = 49,                           // "prefix"
+        S_PREFIX_LEN = 50,                       // "prefix-len"
+        S_EXCLUDED_PREFIX = 51,                  // "excluded-prefix"
+        S_EXCLUDED_PREFIX_LEN = 52,              // "excluded-prefix-len"
+        S_DELEGATED_LEN = 53,                    // "delegated-len"
+        S_USER_CONTEXT = 54,                     // "user-context"
+        S_SUBNET = 55,                           // "subnet"
+        S_INTERFACE = 56,                        // "interface"
+        S_INTERFACE_ID = 57,                     // "interface-id"
+        S_ID = 58,                               // "id"
+        S_RAPID_COMMIT = 59,                     // "rapid-commit"
+        S_RESERVATION_MODE = 60,                 // "reservation-mode"
+        S_MAC_SOURCES = 61,                      // "mac-sources"
+        S_RELAY_SUPPLIED_OPTIONS = 62,           // "relay-supplied-options"
+        S_HOST_RESERVATION_IDENTIFIERS = 63,     // "host-reservation-identifiers"
+        S_CLIENT_CLASSES = 64,                   // "client-classes"
+        S_TEST = 65,                             // "test"
+        S_CLIENT_CLASS = 66,                     // "client-class"
+        S_RESERVATIONS = 67,                     // "reservations"
+        S_IP_ADDRESSES = 68,                     // "ip-addresses"
+        S_PREFIXES = 69,                         // "prefixes"
+        S_DUID = 70,                             // "duid"
+        S_HW_ADDRESS = 71,                       // "hw-address"
+        S_HOSTNAME = 72,                         // "hostname"
+        S_RELAY = 73,                            // "relay"
+        S_IP_ADDRESS = 74,                       // "ip-address"
+        S_HOOKS_LIBRARIES = 75,                  // "hooks-libraries"
+        S_LIBRARY = 76,                          // "library"
+        S_PARAMETERS = 77,                       // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 78,        // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 79,          // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 80,  // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 81,              // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 82,               // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 83,                 // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 84,          // "unwarned-reclaim-cycles"
+        S_SERVER_ID = 85,                        // "server-id"
+        S_LLT = 86,                              // "LLT"
+        S_EN = 87,                               // "EN"
+        S_LL = 88,                               // "LL"
+        S_IDENTIFIER = 89,                       // "identifier"
+        S_HTYPE = 90,                            // "htype"
+        S_TIME = 91,                             // "time"
+        S_ENTERPRISE_ID = 92,                    // "enterprise-id"
+        S_DHCP4O6_PORT = 93,                     // "dhcp4o6-port"
+        S_PACKET_TIMELINE = 94,                  // "packet-timeline"
+        S_CONTROL_SOCKET = 95,                   // "control-socket"
+        S_SOCKET_TYPE = 96,                      // "socket-type"
+        S_SOCKET_NAME = 97,                      // "socket-name"
+        S_DHCP_DDNS = 98,                        // "dhcp-ddns"
+        S_ENABLE_UPDATES = 99,                   // "enable-updates"
+        S_QUALIFYING_SUFFIX = 100,               // "qualifying-suffix"
+        S_SERVER_IP = 101,                       // "server-ip"
+        S_SERVER_PORT = 102,                     // "server-port"
+        S_SENDER_IP = 103,                       // "sender-ip"
+        S_SENDER_PORT = 104,                     // "sender-port"
+        S_MAX_QUEUE_SIZE = 105,                  // "max-queue-size"
+        S_NCR_PROTOCOL = 106,                    // "ncr-protocol"
+        S_NCR_FORMAT = 107,                      // "ncr-format"
+        S_ALWAYS_INCLUDE_FQDN = 108,             // "always-include-fqdn"
+        S_ALLOW_CLIENT_UPDATE = 109,             // "allow-client-update"
+        S_OVERRIDE_NO_UPDATE = 110,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 111,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 112,             // "replace-client-name"
+        S_GENERATED_PREFIX = 113,                // "generated-prefix"
+        S_UDP = 114,                             // "UDP"
+        S_TCP = 115,                             // "TCP"
+        S_JSON = 116,                            // "JSON"
+        S_BINARY = 117,                          // "BINARY"
+        S_WHEN_PRESENT = 118,                    // "when-present"
+        S_NEVER = 119,                           // "never"
+        S_ALWAYS = 120,                          // "always"
+        S_WHEN_NOT_PRESENT = 121,                // "when-not-present"
+        S_LOGGING = 122,                         // "Logging"
+        S_LOGGERS = 123,                         // "loggers"
+        S_OUTPUT_OPTIONS = 124,                  // "output_options"
+        S_OUTPUT = 125,                          // "output"
+        S_DEBUGLEVEL = 126,                      // "debuglevel"
+        S_SEVERITY = 127,                        // "severity"
+        S_ASYNC = 128,                           // "async"
+        S_QUEUE_SIZE = 129,                      // "queue-size"
+        S_OVERFLOW_POLICY = 130,                 // "overflow-policy"
+        S_RATE_LIMITS = 131,                     // "rate-limits"
+        S_MESSAGE = 132,                         // "message"
+        S_SAMPLE = 133,                          // "sample"
+        S_RATE = 134,                            // "rate"
+        S_INTERVAL = 135,                        // "interval"
+        S_DHCP4 = 136,                           // "Dhcp4"
+        S_DHCPDDNS = 137,                        // "DhcpDdns"
+        S_TOPLEVEL_JSON = 138,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP6 = 139,                  // TOPLEVEL_DHCP6
+        S_SUB_DHCP6 = 140,                       // SUB_DHCP6
+        S_SUB_INTERFACES6 = 141,                 // SUB_INTERFACES6
+        S_SUB_SUBNET6 = 142,                     // SUB_SUBNET6
+        S_SUB_POOL6 = 143,                       // SUB_POOL6
+        S_SUB_PD_POOL = 144,                     // SUB_PD_POOL
+        S_SUB_RESERVATION = 145,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEF = 146,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 147,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 148,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 149,                   // SUB_DHCP_DDNS
+        S_STRING = 150,                          // "constant string"
+        S_INTEGER = 151,                         // "integer"
+        S_FLOAT = 152,                           // "floating point"
+        S_BOOLEAN = 153,                         // "boolean"
+        S_YYACCEPT = 154,                        // $accept
+        S_start = 155,                           // start
+        S_156_1 = 156,                           // $@1
+        S_157_2 = 157,                           // $@2
+        S_158_3 = 158,                           // $@3
+        S_159_4 = 159,                           // $@4
+        S_160_5 = 160,                           // $@5
+        S_161_6 = 161,                           // $@6
+        S_162_7 = 162,                           // $@7
+        S_163_8 = 163,                           // $@8
+        S_164_9 = 164,                           // $@9
+        S_165_10 = 165,                          // $@10
+        S_166_11 = 166,                          // $@11
+        S_167_12 = 167,                          // $@12
+        S_value = 168,                           // value
+        S_sub_json = 169,                        // sub_json
+        S_map2 = 170,                            // map2
+        S_171_13 = 171,                          // $@13
+        S_map_value = 172,                       // map_value
+        S_map_content = 173,                     // map_content
+        S_not_empty_map = 174,                   // not_empty_map
+        S_list_generic = 175,                    // list_generic
+        S_176_14 = 176,                          // $@14
+        S_list_content = 177,                    // list_content
+        S_not_empty_list = 178,                  // not_empty_list
+        S_list_strings = 179,                    // list_strings
+        S_180_15 = 180,                          // $@15
+        S_list_strings_content = 181,            // list_strings_content
+        S_not_empty_list_strings = 182,          // not_empty_list_strings
+        S_unknown_map_entry = 183,               // unknown_map_entry
+        S_syntax_map = 184,                      // syntax_map
+        S_185_16 = 185,                          // $@16
+        S_global_objects = 186,                  // global_objects
+        S_global_object = 187,                   // global_object
+        S_dhcp6_object = 188,                    // dhcp6_object
+        S_189_17 = 189,                          // $@17
+        S_sub_dhcp6 = 190,                       // sub_dhcp6
+        S_191_18 = 191,                          // $@18
+        S_global_params = 192,                   // global_params
+        S_global_param = 193,                    // global_param
+        S_preferred_lifetime = 194,              // preferred_lifetime
+        S_valid_lifetime = 195,                  // valid_lifetime
+        S_renew_timer = 196,                     // renew_timer
+        S_rebind_timer = 197,                    // rebind_timer
+        S_decline_probation_period = 198,        // decline_probation_period
+        S_interfaces_config = 199,               // interfaces_config
+        S_200_19 = 200,                          // $@19
+        S_sub_interfaces6 = 201,                 // sub_interfaces6
+        S_202_20 = 202,                          // $@20
+        S_interface_config_map = 203,            // interface_config_map
+        S_204_21 = 204,                          // $@21
+        S_lease_database = 205,                  // lease_database
+        S_206_22 = 206,                          // $@22
+        S_hosts_database = 207,                  // hosts_database
+        S_208_23 = 208,                          // $@23
+        S_database_map_params = 209,             // database_map_params
+        S_database_map_param = 210,              // database_map_param
+        S_database_type = 211,                   // database_type
+        S_212_24 = 212,                          // $@24
+        S_db_type = 213,                         // db_type
+        S_user = 214,                            // user
+        S_215_25 = 215,                          // $@25
+        S_password = 216,                        // password
+        S_217_26 = 217,                          // $@26
+        S_host = 218,                            // host
+        S_219_27 = 219,                          // $@27
+        S_name = 220,                            // name
+        S_221_28 = 221,                          // $@28
+        S_persist = 222,                         // persist
+        S_mapped_store = 223,                    // mapped_store
+        S_file_format = 224,                     // file_format
+        S_225_29 = 225,                          // $@29
+        S_lfc_mode = 226,                        // lfc_mode
+        S_227_30 = 227,                          // $@30
+        S_lfc_interval = 228,                    // lfc_interval
+        S_readonly = 229,                        // readonly
+        S_connect_timeout = 230,                 // connect_timeout
+        S_mac_sources = 231,                     // mac_sources
+        S_232_31 = 232,                          // $@31
+        S_mac_sources_list = 233,                // mac_sources_list
+        S_mac_sources_value = 234,               // mac_sources_value
+        S_duid_id = 235,                         // duid_id
+        S_string_id = 236,                       // string_id
+        S_host_reservation_identifiers = 237,    // host_reservation_identifiers
+        S_238_32 = 238,                          // $@32
+        S_host_reservation_identifiers_list = 239, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 240,     // host_reservation_identifier
+        S_hw_address_id = 241,                   // hw_address_id
+        S_relay_supplied_options = 242,          // relay_supplied_options
+        S_243_33 = 243,                          // $@33
+        S_hooks_libraries = 244,                 // hooks_libraries
+        S_245_34 = 245,                          // $@34
+        S_hooks_libraries_list = 246,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 247,  // not_empty_hooks_libraries_list
+        S_hooks_library = 248,                   // hooks_library
+        S_249_35 = 249,                          // $@35
+        S_sub_hooks_library = 250,               // sub_hooks_library
+        S_251_36 = 251,                          // $@36
+        S_hooks_params = 252,                    // hooks_params
+        S_hooks_param = 253,                     // hooks_param
+        S_library = 254,                         // library
+        S_255_37 = 255,                          // $@37
+        S_parameters = 256,                      // parameters
+        S_257_38 = 257,                          // $@38
+        S_expired_leases_processing = 258,       // expired_leases_processing
+        S_259_39 = 259,                          // $@39
+        S_expired_leases_params = 260,           // expired_leases_params
+        S_expired_leases_param = 261,            // expired_leases_param
+        S_reclaim_timer_wait_time = 262,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 263, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 264,             // hold_reclaimed_time
+        S_max_reclaim_leases = 265,              // max_reclaim_leases
+        S_max_reclaim_time = 266,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 267,         // unwarned_reclaim_cycles
+        S_subnet6_list = 268,                    // subnet6_list
+        S_269_40 = 269,                          // $@40
+        S_subnet6_list_content = 270,            // subnet6_list_content
+        S_not_empty_subnet6_list = 271,          // not_empty_subnet6_list
+        S_subnet6 = 272,                         // subnet6
+        S_273_41 = 273,                          // $@41
+        S_sub_subnet6 = 274,                     // sub_subnet6
+        S_275_42 = 275,                          // $@42
+        S_subnet6_params = 276,                  // subnet6_params
+        S_subnet6_param = 277,                   // subnet6_param
+        S_subnet = 278,                          // subnet
+        S_279_43 = 279,                          // $@43
+        S_interface = 280,                       // interface
+        S_281_44 = 281,                          // $@44
+        S_interface_id = 282,                    // interface_id
+        S_283_45 = 283,                          // $@45
+        S_client_class = 284,                    // client_class
+        S_285_46 = 285,                          // $@46
+        S_reservation_mode = 286,                // reservation_mode
+        S_287_47 = 287,                          // $@47
+        S_id = 288,                              // id
+        S_rapid_commit = 289,                    // rapid_commit
+        S_option_def_list = 290,                 // option_def_list
+        S_291_48 = 291,                          // $@48
+        S_option_def_list_content = 292,         // option_def_list_content
+        S_not_empty_option_def_list = 293,       // not_empty_option_def_list
+        S_option_def_entry = 294,                // option_def_entry
+        S_295_49 = 295,                          // $@49
+        S_sub_option_def = 296,                  // sub_option_def
+        S_297_50 = 297,                          // $@50
+        S_option_def_params = 298,               // option_def_params
+        S_not_empty_option_def_params = 299,     // not_empty_option_def_params
+        S_option_def_param = 300,                // option_def_param
+        S_option_def_name = 301,                 // option_def_name
+        S_code = 302,                            // code
+        S_option_def_code = 303,                 // option_def_code
+        S_option_def_type = 304,                 // option_def_type
+        S_305_51 = 305,                          // $@51
+        S_option_def_record_types = 306,         // option_def_record_types
+        S_307_52 = 307,                          // $@52
+        S_space = 308,                           // space
+        S_309_53 = 309,                          // $@53
+        S_option_def_space = 310,                // option_def_space
+        S_option_def_encapsulate = 311,          // option_def_encapsulate
+        S_312_54 = 312,                          // $@54
+        S_option_def_array = 313,                // option_def_array
+        S_option_data_list = 314,                // option_data_list
+        S_315_55 = 315,                          // $@55
+        S_option_data_list_content = 316,        // option_data_list_content
+        S_not_empty_option_data_list = 317,      // not_empty_option_data_list
+        S_option_data_entry = 318,               // option_data_entry
+        S_319_56 = 319,                          // $@56
+        S_sub_option_data = 320,                 // sub_option_data
+        S_321_57 = 321,                          // $@57
+        S_option_data_params = 322,              // option_data_params
+        S_not_empty_option_data_params = 323,    // not_empty_option_data_params
+        S_option_data_param = 324,               // option_data_param
+        S_option_data_name = 325,                // option_data_name
+        S_option_data_data = 326,                // option_data_data
+        S_327_58 = 327,                          // $@58
+        S_option_data_code = 328,                // option_data_code
+        S_option_data_space = 329,               // option_data_space
+        S_option_data_csv_format = 330,          // option_data_csv_format
+        S_pools_list = 331,                      // pools_list
+        S_332_59 = 332,                          // $@59
+        S_pools_list_content = 333,              // pools_list_content
+        S_not_empty_pools_list = 334,            // not_empty_pools_list
+        S_pool_list_entry = 335,                 // pool_list_entry
+        S_336_60 = 336,                          // $@60
+        S_sub_pool6 = 337,                       // sub_pool6
+        S_338_61 = 338,                          // $@61
+        S_pool_params = 339,                     // pool_params
+        S_pool_param = 340,                      // pool_param
+        S_pool_entry = 341,                      // pool_entry
+        S_342_62 = 342,                          // $@62
+        S_user_context = 343,                    // user_context
+        S_344_63 = 344,                          // $@63
+        S_pd_pools_list = 345,                   // pd_pools_list
+        S_346_64 = 346,                          // $@64
+        S_pd_pools_list_content = 347,           // pd_pools_list_content
+        S_not_empty_pd_pools_list = 348,         // not_empty_pd_pools_list
+        S_pd_pool_entry = 349,                   // pd_pool_entry
+        S_350_65 = 350,                          // $@65
+        S_sub_pd_pool = 351,                     // sub_pd_pool
+        S_352_66 = 352,                          // $@66
+        S_pd_pool_params = 353,                  // pd_pool_params
+        S_pd_pool_param = 354,                   // pd_pool_param
+        S_pd_prefix = 355,                       // pd_prefix
+        S_356_67 = 356,                          // $@67
+        S_pd_prefix_len = 357,                   // pd_prefix_len
+        S_excluded_prefix = 358,                 // excluded_prefix
+        S_359_68 = 359,                          // $@68
+        S_excluded_prefix_len = 360,             // excluded_prefix_len
+        S_pd_delegated_len = 361,                // pd_delegated_len
+        S_reservations = 362,                    // reservations
+        S_363_69 = 363,                          // $@69
+        S_reservations_list = 364,               // reservations_list
+        S_not_empty_reservations_list = 365,     // not_empty_reservations_list
+        S_reservation = 366,                     // reservation
+        S_367_70 = 367,                          // $@70
+        S_sub_reservation = 368,                 // sub_reservation
+        S_369_71 = 369,                          // $@71
+        S_reservation_params = 370,              // reservation_params
+        S_not_empty_reservation_params = 371,    // not_empty_reservation_params
+        S_reservation_param = 372,               // reservation_param
+        S_ip_addresses = 373,                    // ip_addresses
+        S_374_72 = 374,                          // $@72
+        S_prefixes = 375,                        // prefixes
+        S_376_73 = 376,                          // $@73
+        S_duid = 377,                            // duid
+        S_378_74 = 378,                          // $@74
+        S_hw_address = 379,                      // hw_address
+        S_380_75 = 380,                          // $@75
+        S_hostname = 381,                        // hostname
+        S_382_76 = 382,                          // $@76
+        S_reservation_client_classes = 383,      // reservation_client_classes
+        S_384_77 = 384,                          // $@77
+        S_relay = 385,                           // relay
+        S_386_78 = 386,                          // $@78
+        S_relay_map = 387,                       // relay_map
+        S_388_79 = 388,                          // $@79
+        S_client_classes = 389,                  // client_classes
+        S_390_80 = 390,                          // $@80
+        S_client_classes_list = 391,             // client_classes_list
+        S_392_81 = 392,                          // $@81
+        S_client_class_params = 393,             // client_class_params
+        S_not_empty_client_class_params = 394,   // not_empty_client_class_params
+        S_client_class_param = 395,              // client_class_param
+        S_client_class_name = 396,               // client_class_name
+        S_client_class_test = 397,               // client_class_test
+        S_398_82 = 398,                          // $@82
+        S_server_id = 399,                       // server_id
+        S_400_83 = 400,                          // $@83
+        S_server_id_params = 401,                // server_id_params
+        S_server_id_param = 402,                 // server_id_param
+        S_server_id_type = 403,                  // server_id_type
+        S_404_84 = 404,                          // $@84
+        S_duid_type = 405,                       // duid_type
+        S_htype = 406,                           // htype
+        S_identifier = 407,                      // identifier
+        S_408_85 = 408,                          // $@85
+        S_time = 409,                            // time
+        S_enterprise_id = 410,                   // enterprise_id
+        S_dhcp4o6_port = 411,                    // dhcp4o6_port
+        S_packet_timeline = 412,                 // packet_timeline
+        S_control_socket = 413,                  // control_socket
+        S_414_86 = 414,                          // $@86
+        S_control_socket_params = 415,           // control_socket_params
+        S_control_socket_param = 416,            // control_socket_param
+        S_socket_type = 417,                     // socket_type
+        S_418_87 = 418,                          // $@87
+        S_socket_name = 419,                     // socket_name
+        S_420_88 = 420,                          // $@88
+        S_dhcp_ddns = 421,                       // dhcp_ddns
+        S_422_89 = 422,                          // $@89
+        S_sub_dhcp_ddns = 423,                   // sub_dhcp_ddns
+        S_424_90 = 424,                          // $@90
+        S_dhcp_ddns_params = 425,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 426,                 // dhcp_ddns_param
+        S_enable_updates = 427,                  // enable_updates
+        S_qualifying_suffix = 428,               // qualifying_suffix
+        S_429_91 = 429,                          // $@91
+        S_server_ip = 430,                       // server_ip
+        S_431_92 = 431,                          // $@92
+        S_server_port = 432,                     // server_port
+        S_sender_ip = 433,                       // sender_ip
+        S_434_93 = 434,                          // $@93
+        S_sender_port = 435,                     // sender_port
+        S_max_queue_size = 436,                  // max_queue_size
+        S_ncr_protocol = 437,                    // ncr_protocol
+        S_438_94 = 438,                          // $@94
+        S_ncr_protocol_value = 439,              // ncr_protocol_value
+        S_ncr_format = 440,                      // ncr_format
+        S_441_95 = 441,                          // $@95
+        S_ncr_format_value = 442,                // ncr_format_value
+        S_always_include_fqdn = 443,             // always_include_fqdn
+        S_allow_client_update = 444,             // allow_client_update
+        S_override_no_update = 445,              // override_no_update
+        S_override_client_update = 446,          // override_client_update
+        S_replace_client_name = 447,             // replace_client_name
+        S_448_96 = 448,                          // $@96
+        S_replace_client_name_value = 449,       // replace_client_name_value
+        S_generated_prefix = 450,                // generated_prefix
+        S_451_97 = 451,                          // $@97
+        S_dhcp4_json_object = 452,               // dhcp4_json_object
+        S_453_98 = 453,                          // $@98
+        S_dhcpddns_json_object = 454,            // dhcpddns_json_object
+        S_455_99 = 455,                          // $@99
+        S_logging_object = 456,                  // logging_object
+        S_457_100 = 457,                         // $@100
+        S_logging_params = 458,                  // logging_params
+        S_logging_param = 459,                   // logging_param
+        S_async_logging = 460,                   // async_logging
+        S_461_101 = 461,                         // $@101
+        S_async_logging_params = 462,            // async_logging_params
+        S_async_logging_param = 463,             // async_logging_param
+        S_queue_size = 464,                      // queue_size
+        S_overflow_policy = 465,                 // overflow_policy
+        S_466_102 = 466,                         // $@102
+        S_loggers = 467,                         // loggers
+        S_468_103 = 468,                         // $@103
+        S_loggers_entries = 469,                 // loggers_entries
+        S_logger_entry = 470,                    // logger_entry
+        S_471_104 = 471,                         // $@104
+        S_logger_params = 472,                   // logger_params
+        S_logger_param = 473,                    // logger_param
+        S_debuglevel = 474,                      // debuglevel
+        S_severity = 475,                        // severity
+        S_476_105 = 476,                         // $@105
+        S_output_options_list = 477,             // output_options_list
+        S_478_106 = 478,                         // $@106
+        S_output_options_list_content = 479,     // output_options_list_content
+        S_output_entry = 480,                    // output_entry
+        S_481_107 = 481,                         // $@107
+        S_output_params = 482,                   // output_params
+        S_output_param = 483,                    // output_param
+        S_484_108 = 484,                         // $@108
+        S_rate_limits_list = 485,                // rate_limits_list
+        S_486_109 = 486,                         // $@109
+        S_rate_limits_list_content = 487,        // rate_limits_list_content
+        S_rate_limit_entries = 488,              // rate_limit_entries
+        S_rate_limit_entry = 489,                // rate_limit_entry
+        S_490_110 = 490,                         // $@110
+        S_rate_limit_params = 491,               // rate_limit_params
+        S_rate_limit_param = 492,                // rate_limit_param
+        S_rate_limit_message = 493,              // rate_limit_message
+        S_494_111 = 494,                         // $@111
+        S_rate_limit_sample = 495,               // rate_limit_sample
+        S_rate_limit_rate = 496,                 // rate_limit_rate
+        S_rate_limit_interval = 497              // rate_limit_interval
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -512,2077 +1186,3260 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
 
-      /// Copy constructor.
-      basic_symbol (const basic_symbol& other);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
 
-  basic_symbol (typename Base::kind_type t, const location_type& l);
+      default:
+        break;
+    }
 
-  basic_symbol (typename Base::kind_type t, const ElementPtr v, const location_type& l);
+      }
+#endif
 
-  basic_symbol (typename Base::kind_type t, const bool v, const location_type& l);
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const double v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const int64_t v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-  basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
-      /// Constructor for symbols with semantic value.
-      basic_symbol (typename Base::kind_type t,
-                    const semantic_type& v,
-                    const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp6Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
 
     private:
+#if YY_CPLUSPLUS < 201103L
       /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
-    /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
-
-    // Symbol constructors declarations.
-    static inline
-    symbol_type
-    make_END (const location_type& l);
-
-    static inline
-    symbol_type
-    make_COMMA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_COLON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LSQUARE_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RSQUARE_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LCURLY_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RCURLY_BRACKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NULL_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACES_CONFIG (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LEASE_DATABASE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOSTS_DATABASE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MEMFILE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MYSQL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_POSTGRESQL (const location_type& l);
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
 
-    static inline
-    symbol_type
-    make_CQL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_USER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PASSWORD (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOST (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PERSIST (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LFC_INTERVAL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_READONLY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CONNECT_TIMEOUT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PREFERRED_LIFETIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_VALID_LIFETIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RENEW_TIMER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_REBIND_TIMER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DECLINE_PROBATION_PERIOD (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUBNET6 (const location_type& l);
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
 
-    static inline
-    symbol_type
-    make_OPTION_DEF (const location_type& l);
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
 
-    static inline
-    symbol_type
-    make_OPTION_DATA (const location_type& l);
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER6_error <= tok && tok <= token::TOKEN_SUB_DHCP_DDNS));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
-    static inline
-    symbol_type
-    make_NAME (const location_type& l);
+    /// Build a parser object.
+    Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg);
+    virtual ~Dhcp6Parser ();
 
-    static inline
-    symbol_type
-    make_DATA (const location_type& l);
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp6Parser (const Dhcp6Parser&) = delete;
+    /// Non copyable.
+    Dhcp6Parser& operator= (const Dhcp6Parser&) = delete;
+#endif
 
-    static inline
-    symbol_type
-    make_CODE (const location_type& l);
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
 
-    static inline
-    symbol_type
-    make_SPACE (const location_type& l);
+    /// Parse.
+    /// \returns  0 iff parsing succeeded.
+    virtual int parse ();
 
-    static inline
-    symbol_type
-    make_CSV_FORMAT (const location_type& l);
+#if PARSER6_DEBUG
+    /// The current debugging stream.
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging stream.
+    void set_debug_stream (std::ostream &);
 
-    static inline
-    symbol_type
-    make_RECORD_TYPES (const location_type& l);
+    /// Type for debugging levels.
+    typedef int debug_level_type;
+    /// The current debugging level.
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging level.
+    void set_debug_level (debug_level_type l);
+#endif
 
-    static inline
-    symbol_type
-    make_ENCAPSULATE (const location_type& l);
+    /// Report a syntax error.
+    /// \param loc    where the syntax error is found.
+    /// \param msg    a description of the syntax error.
+    virtual void error (const location_type& loc, const std::string& msg);
 
-    static inline
-    symbol_type
-    make_ARRAY (const location_type& l);
+    /// Report a syntax error.
+    void error (const syntax_error& err);
 
-    static inline
-    symbol_type
-    make_POOLS (const location_type& l);
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
 
-    static inline
-    symbol_type
-    make_POOL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PD_POOLS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PREFIX (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PREFIX_LEN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_EXCLUDED_PREFIX (const location_type& l);
-
-    static inline
-    symbol_type
-    make_EXCLUDED_PREFIX_LEN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DELEGATED_LEN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_USER_CONTEXT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUBNET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTERFACE_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RAPID_COMMIT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RESERVATION_MODE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAC_SOURCES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RELAY_SUPPLIED_OPTIONS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOST_RESERVATION_IDENTIFIERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CLIENT_CLASSES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TEST (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CLIENT_CLASS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RESERVATIONS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_IP_ADDRESSES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PREFIXES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DUID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HW_ADDRESS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOSTNAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RELAY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_IP_ADDRESS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOOKS_LIBRARIES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LIBRARY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_PARAMETERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_EXPIRED_LEASES_PROCESSING (const location_type& l);
-
-    static inline
-    symbol_type
-    make_RECLAIM_TIMER_WAIT_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HOLD_RECLAIMED_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAX_RECLAIM_LEASES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAX_RECLAIM_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_UNWARNED_RECLAIM_CYCLES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SERVER_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LLT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_EN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_IDENTIFIER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_HTYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TIME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ENTERPRISE_ID (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP4O6_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_CONTROL_SOCKET (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SOCKET_TYPE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SOCKET_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP_DDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ENABLE_UPDATES (const location_type& l);
-
-    static inline
-    symbol_type
-    make_QUALIFYING_SUFFIX (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SERVER_IP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SERVER_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SENDER_IP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SENDER_PORT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_MAX_QUEUE_SIZE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NCR_PROTOCOL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NCR_FORMAT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALWAYS_INCLUDE_FQDN (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALLOW_CLIENT_UPDATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OVERRIDE_NO_UPDATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OVERRIDE_CLIENT_UPDATE (const location_type& l);
-
-    static inline
-    symbol_type
-    make_REPLACE_CLIENT_NAME (const location_type& l);
-
-    static inline
-    symbol_type
-    make_GENERATED_PREFIX (const location_type& l);
-
-    static inline
-    symbol_type
-    make_UDP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TCP (const location_type& l);
-
-    static inline
-    symbol_type
-    make_JSON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_WHEN_PRESENT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_NEVER (const location_type& l);
-
-    static inline
-    symbol_type
-    make_ALWAYS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_WHEN_NOT_PRESENT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LOGGING (const location_type& l);
-
-    static inline
-    symbol_type
-    make_LOGGERS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OUTPUT_OPTIONS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_OUTPUT (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DEBUGLEVEL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SEVERITY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCP4 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_DHCPDDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TOPLEVEL_JSON (const location_type& l);
-
-    static inline
-    symbol_type
-    make_TOPLEVEL_DHCP6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DHCP6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_INTERFACES6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_SUBNET6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_POOL6 (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_PD_POOL (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_RESERVATION (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_OPTION_DEF (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_OPTION_DATA (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_HOOKS_LIBRARY (const location_type& l);
-
-    static inline
-    symbol_type
-    make_SUB_DHCP_DDNS (const location_type& l);
-
-    static inline
-    symbol_type
-    make_STRING (const std::string& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_INTEGER (const int64_t& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_FLOAT (const double& v, const location_type& l);
-
-    static inline
-    symbol_type
-    make_BOOLEAN (const bool& v, const location_type& l);
-
-
-    /// Build a parser object.
-    Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg);
-    virtual ~Dhcp6Parser ();
-
-    /// Parse.
-    /// \returns  0 iff parsing succeeded.
-    virtual int parse ();
-
-#if PARSER6_DEBUG
-    /// The current debugging stream.
-    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
-    /// Set the current debugging stream.
-    void set_debug_stream (std::ostream &);
-
-    /// Type for debugging levels.
-    typedef int debug_level_type;
-    /// The current debugging level.
-    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
-    /// Set the current debugging level.
-    void set_debug_level (debug_level_type l);
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
 #endif
-
-    /// Report a syntax error.
-    /// \param loc    where the syntax error is found.
-    /// \param msg    a description of the syntax error.
-    virtual void error (const location_type& loc, const std::string& msg);
-
-    /// Report a syntax error.
-    void error (const syntax_error& err);
-
-  private:
-    /// This class is not copyable.
-    Dhcp6Parser (const Dhcp6Parser&);
-    Dhcp6Parser& operator= (const Dhcp6Parser&);
-
-    /// State numbers.
-    typedef int state_type;
-
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
-
-    /// Compute post-reduction state.
-    /// \param yystate   the current state
-    /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
-
-    /// Whether the given \c yypact_ value indicates a defaulted state.
-    /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
-
-    /// Whether the given \c yytable_ value indicates a syntax error.
-    /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
-
-    static const short int yypact_ninf_;
-    static const signed char yytable_ninf_;
-
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
-
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short int yypact_[];
-
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short int yydefact_[];
-
-  // YYPGOTO[NTERM-NUM].
-  static const short int yypgoto_[];
-
-  // YYDEFGOTO[NTERM-NUM].
-  static const short int yydefgoto_[];
-
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short int yytable_[];
-
-  static const short int yycheck_[];
-
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short int yystos_[];
-
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short int yyr1_[];
-
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
-
-
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
-
-
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
-#if PARSER6_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short int yyrline_[];
-    /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
-    /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
-
-    // Debugging.
-    int yydebug_;
-    std::ostream* yycdebug_;
-
-    /// \brief Display a symbol type, value and location.
-    /// \param yyo    The output stream.
-    /// \param yysym  The symbol.
-    template <typename Base>
-    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER6_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER6_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER6_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER6_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_UNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTS_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTS_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MEMFILE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MEMFILE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MYSQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MYSQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POSTGRESQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POSTGRESQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PASSWORD (location_type l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PASSWORD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PERSIST (location_type l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PERSIST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAPPED_STORE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAPPED_STORE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAPPED_STORE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAPPED_STORE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FILE_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_FILE_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FILE_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FILE_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_MODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_MODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_MODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_MODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_READONLY (location_type l)
+      {
+        return symbol_type (token::TOKEN_READONLY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_READONLY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_READONLY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFERRED_LIFETIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFERRED_LIFETIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFERRED_LIFETIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFERRED_LIFETIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VALID_LIFETIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VALID_LIFETIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RENEW_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RENEW_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REBIND_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REBIND_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (location_type l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SPACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SPACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SPACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SPACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CSV_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CSV_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECORD_TYPES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECORD_TYPES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENCAPSULATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENCAPSULATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ARRAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ARRAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOLS (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOLS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOLS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOLS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PD_POOLS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PD_POOLS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PD_POOLS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PD_POOLS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFIX_LEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFIX_LEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFIX_LEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFIX_LEN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX_LEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX_LEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXCLUDED_PREFIX_LEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXCLUDED_PREFIX_LEN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DELEGATED_LEN (location_type l)
+      {
+        return symbol_type (token::TOKEN_DELEGATED_LEN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DELEGATED_LEN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DELEGATED_LEN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER_CONTEXT (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER_CONTEXT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RAPID_COMMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RAPID_COMMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RAPID_COMMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RAPID_COMMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATION_MODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATION_MODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAC_SOURCES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAC_SOURCES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAC_SOURCES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAC_SOURCES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RELAY_SUPPLIED_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RELAY_SUPPLIED_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RELAY_SUPPLIED_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RELAY_SUPPLIED_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TEST (location_type l)
+      {
+        return symbol_type (token::TOKEN_TEST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TEST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TEST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PREFIXES (location_type l)
+      {
+        return symbol_type (token::TOKEN_PREFIXES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PREFIXES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PREFIXES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DUID (location_type l)
+      {
+        return symbol_type (token::TOKEN_DUID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DUID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DUID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HW_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HW_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RELAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_RELAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RELAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RELAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARAMETERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARAMETERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (location_type l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LLT (location_type l)
+      {
+        return symbol_type (token::TOKEN_LLT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LLT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LLT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EN (location_type l)
+      {
+        return symbol_type (token::TOKEN_EN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LL (location_type l)
+      {
+        return symbol_type (token::TOKEN_LL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IDENTIFIER (location_type l)
+      {
+        return symbol_type (token::TOKEN_IDENTIFIER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IDENTIFIER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IDENTIFIER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HTYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_HTYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HTYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HTYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENTERPRISE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENTERPRISE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENTERPRISE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENTERPRISE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4O6_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4O6_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PACKET_TIMELINE (location_type l)
+      {
+        return symbol_type (token::TOKEN_PACKET_TIMELINE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PACKET_TIMELINE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PACKET_TIMELINE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_SOCKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_SOCKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENABLE_UPDATES (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENABLE_UPDATES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS_INCLUDE_FQDN (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_INCLUDE_FQDN, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS_INCLUDE_FQDN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_INCLUDE_FQDN, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALLOW_CLIENT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALLOW_CLIENT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALLOW_CLIENT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALLOW_CLIENT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GENERATED_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GENERATED_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UDP (location_type l)
+      {
+        return symbol_type (token::TOKEN_UDP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UDP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UDP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMITS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMITS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMITS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MESSAGE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MESSAGE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MESSAGE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MESSAGE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SAMPLE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SAMPLE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SAMPLE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SAMPLE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_INTERFACES6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_INTERFACES6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_SUBNET6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_SUBNET6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_POOL6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_POOL6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_PD_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_PD_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_PD_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_PD_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_RESERVATION (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_RESERVATION (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
 #endif
 
-    /// \brief Reclaim the memory associated to a symbol.
-    /// \param yymsg     Why this token is reclaimed.
-    ///                  If null, print nothing.
-    /// \param yysym     The symbol.
-    template <typename Base>
-    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
-
-  private:
-    /// Type access provider for state based symbols.
-    struct by_state
-    {
-      /// Default constructor.
-      by_state ();
-
-      /// The symbol type as needed by the constructor.
-      typedef state_type kind_type;
-
-      /// Constructor.
-      by_state (kind_type s);
-
-      /// Copy constructor.
-      by_state (const by_state& other);
-
-      /// Record that this symbol is empty.
-      void clear ();
-
-      /// Steal the symbol type from \a that.
-      void move (by_state& that);
-
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
-
-      /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
-
-      /// The state.
-      /// \a empty when empty.
-      state_type state;
-    };
-
-    /// "Internal" symbol: element of the stack.
-    struct stack_symbol_type : basic_symbol<by_state>
-    {
-      /// Superclass.
-      typedef basic_symbol<by_state> super_type;
-      /// Construct an empty symbol.
-      stack_symbol_type ();
-      /// Steal the contents from \a sym to build this.
-      stack_symbol_type (state_type s, symbol_type& sym);
-      /// Assignment, needed by push_back.
-      stack_symbol_type& operator= (const stack_symbol_type& that);
-    };
-
-    /// Stack type.
-    typedef stack<stack_symbol_type> stack_type;
-
-    /// The stack.
-    stack_type yystack_;
-
-    /// Push a new state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the symbol
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, stack_symbol_type& s);
-
-    /// Push a new look ahead token on the state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the state
-    /// \param sym  the symbol (for its value and location).
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, state_type s, symbol_type& sym);
-
-    /// Pop \a n symbols the three stacks.
-    void yypop_ (unsigned int n = 1);
-
-    /// Constants.
-    enum
-    {
-      yyeof_ = 0,
-      yylast_ = 767,     ///< Last index in yytable_.
-      yynnts_ = 317,  ///< Number of nonterminal symbols.
-      yyfinal_ = 26, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 141  ///< Number of tokens.
-    };
-
-
-    // User arguments.
-    isc::dhcp::Parser6Context& ctx;
-  };
-
-  // Symbol number corresponding to token number t.
-  inline
-  Dhcp6Parser::token_number_type
-  Dhcp6Parser::yytranslate_ (token_type t)
-  {
-    static
-    const token_number_type
-    translate_table[] =
-    {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140
-    };
-    const unsigned int user_token_number_max_ = 395;
-    const token_number_type undef_token_ = 2;
-
-    if (static_cast<int>(t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned int> (t) <= user_token_number_max_)
-      return translate_table[t];
-    else
-      return undef_token_;
-  }
-
-  inline
-  Dhcp6Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
-  // basic_symbol.
-  template <typename Base>
-  inline
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-  {}
-
-  template <typename Base>
-  inline
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& other)
-    : Base (other)
-    , value ()
-    , location (other.location)
-  {
-      switch (other.type_get ())
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
-        value.copy< ElementPtr > (other.value);
-        break;
-
-      case 140: // "boolean"
-        value.copy< bool > (other.value);
-        break;
-
-      case 139: // "floating point"
-        value.copy< double > (other.value);
-        break;
-
-      case 138: // "integer"
-        value.copy< int64_t > (other.value);
-        break;
-
-      case 137: // "constant string"
-        value.copy< std::string > (other.value);
-        break;
-
-      default:
-        break;
-    }
-
-  }
-
-
-  template <typename Base>
-  inline
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const semantic_type& v, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {
-    (void) v;
-      switch (this->type_get ())
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
-        value.copy< ElementPtr > (v);
-        break;
-
-      case 140: // "boolean"
-        value.copy< bool > (v);
-        break;
-
-      case 139: // "floating point"
-        value.copy< double > (v);
-        break;
-
-      case 138: // "integer"
-        value.copy< int64_t > (v);
-        break;
-
-      case 137: // "constant string"
-        value.copy< std::string > (v);
-        break;
-
-      default:
-        break;
-    }
-}
-
-
-  // Implementation of basic_symbol constructor for each type.
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , value ()
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ElementPtr v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const bool v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const double v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const int64_t v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-
-
-  template <typename Base>
-  inline
-  Dhcp6Parser::basic_symbol<Base>::~basic_symbol ()
-  {
-    clear ();
-  }
-
-  template <typename Base>
-  inline
-  void
-  Dhcp6Parser::basic_symbol<Base>::clear ()
-  {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-    switch (yytype)
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
-        value.template destroy< ElementPtr > ();
-        break;
-
-      case 140: // "boolean"
-        value.template destroy< bool > ();
-        break;
-
-      case 139: // "floating point"
-        value.template destroy< double > ();
-        break;
-
-      case 138: // "integer"
-        value.template destroy< int64_t > ();
-        break;
-
-      case 137: // "constant string"
-        value.template destroy< std::string > ();
-        break;
-
-      default:
-        break;
-    }
-
-    Base::clear ();
-  }
-
-  template <typename Base>
-  inline
-  bool
-  Dhcp6Parser::basic_symbol<Base>::empty () const
-  {
-    return Base::type_get () == empty_symbol;
-  }
-
-  template <typename Base>
-  inline
-  void
-  Dhcp6Parser::basic_symbol<Base>::move (basic_symbol& s)
-  {
-    super_type::move(s);
-      switch (this->type_get ())
-    {
-      case 155: // value
-      case 159: // map_value
-      case 200: // db_type
-      case 387: // duid_type
-      case 420: // ncr_protocol_value
-      case 429: // replace_client_name_value
-        value.move< ElementPtr > (s.value);
-        break;
-
-      case 140: // "boolean"
-        value.move< bool > (s.value);
-        break;
-
-      case 139: // "floating point"
-        value.move< double > (s.value);
-        break;
-
-      case 138: // "integer"
-        value.move< int64_t > (s.value);
-        break;
-
-      case 137: // "constant string"
-        value.move< std::string > (s.value);
-        break;
-
-      default:
-        break;
-    }
-
-    location = s.location;
-  }
-
-  // by_type.
-  inline
-  Dhcp6Parser::by_type::by_type ()
-    : type (empty_symbol)
-  {}
-
-  inline
-  Dhcp6Parser::by_type::by_type (const by_type& other)
-    : type (other.type)
-  {}
-
-  inline
-  Dhcp6Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
-  {}
-
-  inline
-  void
-  Dhcp6Parser::by_type::clear ()
-  {
-    type = empty_symbol;
-  }
-
-  inline
-  void
-  Dhcp6Parser::by_type::move (by_type& that)
-  {
-    type = that.type;
-    that.clear ();
-  }
-
-  inline
-  int
-  Dhcp6Parser::by_type::type_get () const
-  {
-    return type;
-  }
 
-  inline
-  Dhcp6Parser::token_type
-  Dhcp6Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short int
-    yytoken_number_[] =
+    class context
     {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-  // Implementation of make_symbol for each symbol type.
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_END (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_END, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_COMMA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COMMA, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_COLON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COLON, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NULL_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACES_CONFIG (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES_CONFIG, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LEASE_DATABASE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LEASE_DATABASE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTS_DATABASE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOSTS_DATABASE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TYPE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MEMFILE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MEMFILE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MYSQL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MYSQL, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_POSTGRESQL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_POSTGRESQL, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CQL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CQL, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_USER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_USER, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PASSWORD (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PASSWORD, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOST (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOST, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PERSIST (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PERSIST, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LFC_INTERVAL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LFC_INTERVAL, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_READONLY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_READONLY, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONNECT_TIMEOUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFERRED_LIFETIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PREFERRED_LIFETIME, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_VALID_LIFETIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_VALID_LIFETIME, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RENEW_TIMER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RENEW_TIMER, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_REBIND_TIMER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_REBIND_TIMER, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DECLINE_PROBATION_PERIOD (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUBNET6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET6, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OPTION_DEF (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DEF, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OPTION_DATA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DATA, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NAME, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DATA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DATA, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CODE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CODE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SPACE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SPACE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CSV_FORMAT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CSV_FORMAT, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RECORD_TYPES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RECORD_TYPES, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ENCAPSULATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ENCAPSULATE, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ARRAY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ARRAY, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_POOLS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_POOLS, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_POOL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_POOL, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PD_POOLS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PD_POOLS, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFIX (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PREFIX, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFIX_LEN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PREFIX_LEN, l);
-  }
+    public:
+      context (const Dhcp6Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EXCLUDED_PREFIX (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_EXCLUDED_PREFIX, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EXCLUDED_PREFIX_LEN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_EXCLUDED_PREFIX_LEN, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DELEGATED_LEN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DELEGATED_LEN, l);
-  }
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_USER_CONTEXT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, l);
-  }
-
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUBNET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUBNET, l);
-  }
+    private:
+      const Dhcp6Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE, l);
-  }
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    Dhcp6Parser (const Dhcp6Parser&);
+    /// Non copyable.
+    Dhcp6Parser& operator= (const Dhcp6Parser&);
+#endif
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTERFACE_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE_ID, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ID, l);
-  }
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RAPID_COMMIT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RAPID_COMMIT, l);
-  }
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RESERVATION_MODE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RESERVATION_MODE, l);
-  }
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAC_SOURCES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAC_SOURCES, l);
-  }
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RELAY_SUPPLIED_OPTIONS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RELAY_SUPPLIED_OPTIONS, l);
-  }
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOST_RESERVATION_IDENTIFIERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, l);
-  }
+    static const short yypact_ninf_;
+    static const signed char yytable_ninf_;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CLIENT_CLASSES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASSES, l);
-  }
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TEST (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TEST, l);
-  }
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CLIENT_CLASS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASS, l);
-  }
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RESERVATIONS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RESERVATIONS, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_IP_ADDRESSES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESSES, l);
-  }
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PREFIXES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PREFIXES, l);
-  }
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DUID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DUID, l);
-  }
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HW_ADDRESS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HW_ADDRESS, l);
-  }
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOSTNAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, l);
-  }
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RELAY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RELAY, l);
-  }
+    static const short yycheck_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_IP_ADDRESS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, l);
-  }
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOOKS_LIBRARIES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
-  }
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LIBRARY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LIBRARY, l);
-  }
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_PARAMETERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PARAMETERS, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EXPIRED_LEASES_PROCESSING (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, l);
-  }
+#if PARSER6_DEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_RECLAIM_TIMER_WAIT_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, l);
-  }
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, l);
-  }
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HOLD_RECLAIMED_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
-  }
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_RECLAIM_LEASES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, l);
-  }
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_RECLAIM_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, l);
-  }
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_UNWARNED_RECLAIM_CYCLES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
-  }
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SERVER_ID, l);
-  }
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LLT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LLT, l);
-  }
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_EN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_EN, l);
-  }
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LL, l);
-  }
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_IDENTIFIER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_IDENTIFIER, l);
-  }
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_HTYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HTYPE, l);
-  }
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TIME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TIME, l);
-  }
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ENTERPRISE_ID (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ENTERPRISE_ID, l);
-  }
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP4O6_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
-  }
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_CONTROL_SOCKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
-  }
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SOCKET_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, l);
-  }
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SOCKET_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, l);
-  }
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP_DDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP_DDNS, l);
-  }
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ENABLE_UPDATES (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ENABLE_UPDATES, l);
-  }
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_QUALIFYING_SUFFIX (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, l);
-  }
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_IP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SERVER_IP, l);
-  }
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SERVER_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SERVER_PORT, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SENDER_IP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SENDER_IP, l);
-  }
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SENDER_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SENDER_PORT, l);
-  }
+    /// The stack.
+    stack_type yystack_;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_MAX_QUEUE_SIZE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, l);
-  }
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NCR_PROTOCOL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
-  }
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NCR_FORMAT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, l);
-  }
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ALWAYS_INCLUDE_FQDN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS_INCLUDE_FQDN, l);
-  }
+    /// Constants.
+    enum
+    {
+      yylast_ = 809,     ///< Last index in yytable_.
+      yynnts_ = 344,  ///< Number of nonterminal symbols.
+      yyfinal_ = 26 ///< Termination state number.
+    };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ALLOW_CLIENT_UPDATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALLOW_CLIENT_UPDATE, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OVERRIDE_NO_UPDATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, l);
-  }
+    // User arguments.
+    isc::dhcp::Parser6Context& ctx;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OVERRIDE_CLIENT_UPDATE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, l);
-  }
+  };
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_REPLACE_CLIENT_NAME (const location_type& l)
+  inline
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, l);
-  }
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const unsigned char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153
+    };
+    // Last valid token kind.
+    const int code_max = 408;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_GENERATED_PREFIX (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_GENERATED_PREFIX, l);
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_UDP (const location_type& l)
+  // basic_symbol.
+  template <typename Base>
+  Dhcp6Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
   {
-    return symbol_type (token::TOKEN_UDP, l);
-  }
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TCP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TCP, l);
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_JSON, l);
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_WHEN_PRESENT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_WHEN_PRESENT, l);
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_NEVER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NEVER, l);
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_ALWAYS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS, l);
-  }
+      default:
+        break;
+    }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_WHEN_NOT_PRESENT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, l);
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LOGGING (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_LOGGERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OUTPUT_OPTIONS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_OUTPUT (const location_type& l)
+  template <typename Base>
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_OUTPUT, l);
+    return this->kind ();
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DEBUGLEVEL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SEVERITY (const location_type& l)
+  template <typename Base>
+  bool
+  Dhcp6Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_SEVERITY, l);
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCP4 (const location_type& l)
+  template <typename Base>
+  void
+  Dhcp6Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
-    return symbol_type (token::TOKEN_DHCP4, l);
-  }
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (s.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCPDDNS, l);
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (s.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TOPLEVEL_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (s.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_TOPLEVEL_DHCP6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCP6, l);
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (s.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_DHCP6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCP6, l);
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (s.value));
+        break;
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_INTERFACES6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_INTERFACES6, l);
-  }
+      default:
+        break;
+    }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_SUBNET6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_SUBNET6, l);
+    location = YY_MOVE (s.location);
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_POOL6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_POOL6, l);
-  }
+  // by_kind.
+  inline
+  Dhcp6Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_PD_POOL (const location_type& l)
+#if 201103L <= YY_CPLUSPLUS
+  inline
+  Dhcp6Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
-    return symbol_type (token::TOKEN_SUB_PD_POOL, l);
+    that.clear ();
   }
+#endif
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_RESERVATION (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_RESERVATION, l);
-  }
+  inline
+  Dhcp6Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_OPTION_DEF (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DEF, l);
-  }
+  inline
+  Dhcp6Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_OPTION_DATA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DATA, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_HOOKS_LIBRARY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_SUB_DHCP_DDNS (const location_type& l)
+  inline
+  void
+  Dhcp6Parser::by_kind::clear () YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_SUB_DHCP_DDNS, l);
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_STRING (const std::string& v, const location_type& l)
+  inline
+  void
+  Dhcp6Parser::by_kind::move (by_kind& that)
   {
-    return symbol_type (token::TOKEN_STRING, v, l);
+    kind_ = that.kind_;
+    that.clear ();
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_INTEGER (const int64_t& v, const location_type& l)
+  inline
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_INTEGER, v, l);
+    return kind_;
   }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_FLOAT (const double& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, v, l);
-  }
 
-  Dhcp6Parser::symbol_type
-  Dhcp6Parser::make_BOOLEAN (const bool& v, const location_type& l)
+  inline
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_BOOLEAN, v, l);
+    return this->kind ();
   }
 
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:377
+#line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 2586 "dhcp6_parser.h" // lalr1.cc:377
+#line 4443 "dhcp6_parser.h"
 
 
 
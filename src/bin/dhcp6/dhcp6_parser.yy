@@ -64,7 +64,10 @@ using namespace std;
   PASSWORD "password"
   HOST "host"
   PERSIST "persist"
+  MAPPED_STORE "mapped-store"
+  FILE_FORMAT "file-format"
   LFC_INTERVAL "lfc-interval"
+  LFC_MODE "lfc-mode"
   READONLY "readonly"
   CONNECT_TIMEOUT "connect-timeout"
 
@@ -143,6 +146,8 @@ using namespace std;
 
   DHCP4O6_PORT "dhcp4o6-port"
 
+  PACKET_TIMELINE "packet-timeline"
+
   CONTROL_SOCKET "control-socket"
   SOCKET_TYPE "socket-type"
   SOCKET_NAME "socket-name"
@@ -166,6 +171,7 @@ using namespace std;
   UDP "UDP"
   TCP "TCP"
   JSON "JSON"
+  BINARY "BINARY"
   WHEN_PRESENT "when-present"
   NEVER "never"
   ALWAYS "always"
@@ -177,6 +183,14 @@ using namespace std;
   OUTPUT "output"
   DEBUGLEVEL "debuglevel"
   SEVERITY "severity"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow-policy"
+  RATE_LIMITS "rate-limits"
+  MESSAGE "message"
+  SAMPLE "sample"
+  RATE "rate"
+  INTERVAL "interval"
 
   DHCP4 "Dhcp4"
   DHCPDDNS "DhcpDdns"
@@ -207,6 +221,7 @@ using namespace std;
 %type <ElementPtr> db_type
 %type <ElementPtr> duid_type
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 %type <ElementPtr> replace_client_name_value
 
 %printer { yyoutput << $$; } <*>;
@@ -412,6 +427,7 @@ global_param: preferred_lifetime
             | expired_leases_processing
             | server_id
             | dhcp4o6_port
+            | packet_timeline
             | control_socket
             | dhcp_ddns
             | unknown_map_entry
@@ -500,7 +516,10 @@ database_map_param: database_type
                   | host
                   | name
                   | persist
+                  | mapped_store
+                  | file_format
                   | lfc_interval
+                  | lfc_mode
                   | readonly
                   | connect_timeout
                   | unknown_map_entry
@@ -556,6 +575,27 @@ persist: PERSIST COLON BOOLEAN {
     ctx.stack_.back()->set("persist", n);
 };
 
+mapped_store: MAPPED_STORE COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("mapped-store", n);
+};
+
+file_format: FILE_FORMAT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr format(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("file-format", format);
+    ctx.leave();
+};
+
+lfc_mode: LFC_MODE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr mode(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("lfc-mode", mode);
+    ctx.leave();
+};
+
 lfc_interval: LFC_INTERVAL COLON INTEGER {
     ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1477,6 +1517,11 @@ dhcp4o6_port: DHCP4O6_PORT COLON INTEGER {
     ctx.stack_.back()->set("dhcp4o6-port", time);
 };
 
+packet_timeline: PACKET_TIMELINE COLON BOOLEAN {
+    ElementPtr timeline(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("packet-timeline", timeline);
+};
+
 // --- control socket ----------------------------------------
 
 control_socket: CONTROL_SOCKET {
@@ -1613,12 +1658,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 always_include_fqdn: ALWAYS_INCLUDE_FQDN COLON BOOLEAN {
     ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("always-include-fqdn", b);
@@ -1711,8 +1760,43 @@ logging_params: logging_param
               | logging_params COMMA logging_param
               ;
 
-// There's currently only one parameter defined, which is "loggers".
-logging_param: loggers;
+// The parameters are "loggers" and "async".
+logging_param: loggers
+             | async_logging
+             ;
+
+// "async" enables the asynchronous logging: "async": { ... }.
+async_logging: ASYNC {
+    ElementPtr m(new MapElement(ctx.loc2pos(@1)));
+    ctx.stack_.back()->set("async", m);
+    ctx.stack_.push_back(m);
+    ctx.enter(ctx.ASYNC_LOGGING);
+} COLON LCURLY_BRACKET async_logging_params RCURLY_BRACKET {
+    ctx.stack_.pop_back();
+    ctx.leave();
+};
+
+async_logging_params: async_logging_param
+                    | async_logging_params COMMA async_logging_param
+                    ;
+
+async_logging_param: queue_size
+                   | overflow_policy
+                   | unknown_map_entry
+                   ;
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", size);
+};
+
+overflow_policy: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr policy(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+};
 
 // "loggers", the only parameter currently defined in "Logging" object,
 // is "Loggers": [ ... ].
@@ -1749,6 +1833,7 @@ logger_param: name
             | output_options_list
             | debuglevel
             | severity
+            | rate_limits_list
             | unknown_map_entry
             ;
 
@@ -1799,6 +1884,67 @@ output_param: OUTPUT {
     ctx.leave();
 };
 
+// "rate-limits" limits the output of some messages of a logger:
+// "rate-limits": [ { "message": ..., "sample": ..., ... }, ... ].
+rate_limits_list: RATE_LIMITS {
+    ElementPtr l(new ListElement(ctx.loc2pos(@1)));
+    ctx.stack_.back()->set("rate-limits", l);
+    ctx.stack_.push_back(l);
+    ctx.enter(ctx.RATE_LIMITS);
+} COLON LSQUARE_BRACKET rate_limits_list_content RSQUARE_BRACKET {
+    ctx.stack_.pop_back();
+    ctx.leave();
+};
+
+rate_limits_list_content: %empty
+                        | rate_limit_entries
+                        ;
+
+rate_limit_entries: rate_limit_entry
+                  | rate_limit_entries COMMA rate_limit_entry
+                  ;
+
+rate_limit_entry: LCURLY_BRACKET {
+    ElementPtr m(new MapElement(ctx.loc2pos(@1)));
+    ctx.stack_.back()->add(m);
+    ctx.stack_.push_back(m);
+} rate_limit_params RCURLY_BRACKET {
+    ctx.stack_.pop_back();
+};
+
+rate_limit_params: rate_limit_param
+                 | rate_limit_params COMMA rate_limit_param
+                 ;
+
+rate_limit_param: rate_limit_message
+                | rate_limit_sample
+                | rate_limit_rate
+                | rate_limit_interval
+                ;
+
+rate_limit_message: MESSAGE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr msg(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("message", msg);
+    ctx.leave();
+};
+
+rate_limit_sample: SAMPLE COLON INTEGER {
+    ElementPtr sample(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("sample", sample);
+};
+
+rate_limit_rate: RATE COLON INTEGER {
+    ElementPtr rate(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("rate", rate);
+};
+
+rate_limit_interval: INTERVAL COLON INTEGER {
+    ElementPtr interval(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("interval", interval);
+};
+
 %%
 
 void
@@ -35,6 +35,7 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
+#include <dhcpsrv/pkt_timeline_stats.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <dhcpsrv/utils.h>
@@ -175,7 +176,8 @@ namespace dhcp {
 const std::string Dhcpv6Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 
 Dhcpv6Srv::Dhcpv6Srv(uint16_t port)
-    : port_(port), serverid_(), shutdown_(true), alloc_engine_()
+    : port_(port), serverid_(), shutdown_(true), alloc_engine_(),
+      timeline_stats_()
 {
 
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_START, DHCP6_OPEN_SOCKET).arg(port);
@@ -331,6 +333,7 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt, AllocEngine::ClientContext6& ctx) {
 
         // Find host reservations using specified identifiers.
         alloc_engine_->findReservation(ctx);
+        pkt->markEvent(Pkt::EVENT_HOST_LOOKUP);
     }
 }
 
@@ -427,6 +430,8 @@ void Dhcpv6Srv::run_one() {
     processPacket(query, rsp);
 
     if (!rsp) {
+        // Nothing to send, so the processing of this packet is complete.
+        processStatsTimeline(query);
         return;
     }
 
@@ -469,9 +474,11 @@ void Dhcpv6Srv::run_one() {
             .arg(static_cast<int>(rsp->getType())).arg(rsp->toText());
 
         sendPacket(rsp);
+        query->markEvent(Pkt::EVENT_SENT);
 
         // Update statistics accordingly for sent packet.
         processStatsSent(rsp);
+        processStatsTimeline(query);
 
     } catch (const std::exception& e) {
         LOG_ERROR(packet6_logger, DHCP6_PACKET_SEND_FAIL).arg(e.what());
@@ -513,7 +520,12 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
         /// @todo: Add support for DROP status.
 
+        // A callout may have replaced the packet: keep its timeline.
+        Pkt6Ptr original = query;
         callout_handle->getArgument("query6", query);
+        if (query != original) {
+            query->copyTimeline(*original);
+        }
     }
 
     // Unpack the packet information unless the buffer6_receive callouts
@@ -542,6 +554,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
     }
+    query->markEvent(Pkt::EVENT_PARSED);
 
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
@@ -605,11 +618,18 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
         /// @todo: Add support for DROP status.
 
+        // A callout may have replaced the packet: keep its timeline.
+        Pkt6Ptr original = query;
         callout_handle->getArgument("query6", query);
+        if (query != original) {
+            query->copyTimeline(*original);
+        }
+        query->markEvent(Pkt::EVENT_RECEIVE_HOOKS);
     }
 
     // Assign this packet to a class, if possible
     classifyPacket(query);
+    query->markEvent(Pkt::EVENT_CLASSIFIED);
 
     try {
         NameChangeRequestPtr ncr;
@@ -757,11 +777,14 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         }
 
         /// @todo: Add support for DROP status
+
+        query->markEvent(Pkt::EVENT_SEND_HOOKS);
     }
 
     if (!skip_pack) {
         try {
             rsp->pack();
+            query->markEvent(Pkt::EVENT_PACKED);
         } catch (const std::exception& e) {
             LOG_ERROR(options6_logger, DHCP6_PACK_FAIL).arg(e.what());
             return;
@@ -1079,6 +1102,8 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question) {
         callout_handle->getArgument("subnet6", subnet);
     }
 
+    question->markEvent(Pkt::EVENT_SUBNET_SELECTED);
+
     if (subnet) {
         // Log at higher debug level that subnet has been found.
         LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC_DATA, DHCP6_SUBNET_SELECTED)
@@ -1431,6 +1456,7 @@ Dhcpv6Srv::assignIA_NA(const Pkt6Ptr& query, const Pkt6Ptr& answer,
     // may be used instead. If fake_allocation is set to false, the lease will
     // be inserted into the LeaseMgr as well.
     Lease6Collection leases = alloc_engine_->allocateLeases6(ctx);
+    query->markEvent(Pkt::EVENT_LEASE_ALLOCATED);
 
     /// @todo: Handle more than one lease
     Lease6Ptr lease;
@@ -1550,6 +1576,7 @@ Dhcpv6Srv::assignIA_PD(const Pkt6Ptr& query, const Pkt6Ptr& answer,
     // may be used instead. If fake_allocation is set to false, the lease will
     // be inserted into the LeaseMgr as well.
     Lease6Collection leases = alloc_engine_->allocateLeases6(ctx);
+    query->markEvent(Pkt::EVENT_LEASE_ALLOCATED);
 
     if (!leases.empty()) {
 
@@ -1685,6 +1712,7 @@ Dhcpv6Srv::extendIA_NA(const Pkt6Ptr& query, const Pkt6Ptr& answer,
     }
 
     Lease6Collection leases = alloc_engine_->renewLeases6(ctx);
+    query->markEvent(Pkt::EVENT_LEASE_ALLOCATED);
 
     // Ok, now we have the leases extended. We have:
     // - what the client tried to renew in ctx.hints_
@@ -1848,6 +1876,7 @@ Dhcpv6Srv::extendIA_PD(const Pkt6Ptr& query,
     // - changed_leases - leases that have FQDN changed (not really important
     //                    in PD context)
     Lease6Collection leases = alloc_engine_->renewLeases6(ctx);
+    query->markEvent(Pkt::EVENT_LEASE_ALLOCATED);
 
     // For each IA inserted by the client we have to determine what to do
     // about included prefixes and notify the client. We will iterate over
@@ -3265,6 +3294,20 @@ void Dhcpv6Srv::processStatsSent(const Pkt6Ptr& response) {
     StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
 }
 
+void Dhcpv6Srv::processStatsTimeline(const Pkt6Ptr& query) {
+    if (timeline_stats_) {
+        timeline_stats_->record(*query);
+    }
+}
+
+void Dhcpv6Srv::configureTimelineStats(const bool enabled) {
+    if (enabled) {
+        timeline_stats_.reset(new PktTimelineStats("pkt6"));
+    } else {
+        timeline_stats_.reset();
+    }
+}
+
 int Dhcpv6Srv::getHookIndexBuffer6Send() {
     return (Hooks.hook_index_buffer6_send_);
 }
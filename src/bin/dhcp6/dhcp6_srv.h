@@ -18,6 +18,7 @@
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
+#include <dhcpsrv/pkt_timeline_stats.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
@@ -820,6 +821,22 @@ public:
     /// @param response packet transmitted
     static void processStatsSent(const Pkt6Ptr& response);
 
+    /// @brief Records processing stage latencies of the packet
+    ///
+    /// Adds the durations of the processing stages recorded on the
+    /// packet timeline to the pkt6-latency-* histograms.
+    ///
+    /// @param query packet which processing has finished
+    void processStatsTimeline(const Pkt6Ptr& query);
+
+    /// @brief Enables or disables the recording of the latencies
+    ///
+    /// The histograms are looked up when the recording is enabled, so
+    /// the processed packets don't look them up by name.
+    ///
+    /// @param enabled true if the latencies should be recorded
+    void configureTimelineStats(const bool enabled);
+
     /// @brief Returns the index of the buffer6_send hook
     /// @return the index of the buffer6_send hook
     static int getHookIndexBuffer6Send();
@@ -842,6 +859,9 @@ protected:
     /// Holds a list of @c isc::dhcp_ddns::NameChangeRequest objects, which
     /// are waiting for sending to kea-dhcp-ddns module.
     std::queue<isc::dhcp_ddns::NameChangeRequest> name_change_reqs_;
+
+    /// @brief Latency histograms or null if they are not recorded.
+    PktTimelineStatsPtr timeline_stats_;
 };
 
 }; // namespace isc::dhcp
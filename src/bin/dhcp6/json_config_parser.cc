@@ -13,10 +13,12 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcp6/json_config_parser.h>
 #include <dhcp6/dhcp6_log.h>
+#include <dhcp6/dhcp6_srv.h>
 #include <dhcp6/simple_parser6.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/incremental_config_cache.h>
 #include <dhcpsrv/pool.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/timer_mgr.h>
@@ -30,6 +32,7 @@
 #include <dhcpsrv/parsers/host_reservation_parser.h>
 #include <dhcpsrv/parsers/host_reservations_list_parser.h>
 #include <dhcpsrv/parsers/ifaces_config_parser.h>
+#include <dhcpsrv/parsers/parallel_subnets_parser.h>
 #include <log/logger_support.h>
 #include <util/encode/hex.h>
 #include <util/strutil.h>
@@ -281,8 +284,13 @@ public:
     /// Configuration Manager.
     ///
     /// @param subnet A new subnet being configured.
+    /// @param [out] hosts Optional collection receiving the host
+    /// reservations of the subnet.
+    /// @param add_hosts Indicates whether the host reservations are added
+    /// to the staging configuration.
     /// @return a pointer to created Subnet6 object
-    Subnet6Ptr parse(ConstElementPtr subnet) {
+    Subnet6Ptr parse(ConstElementPtr subnet, HostCollection* hosts = 0,
+                     const bool add_hosts = true) {
         /// Parse all pools first.
         ConstElementPtr pools = subnet->get("pools");
         if (pools) {
@@ -320,7 +328,7 @@ public:
         ConstElementPtr reservations = subnet->get("reservations");
         if (reservations) {
             HostReservationsListParser<HostReservationParser6> parser;
-            parser.parse(subnet_->getID(), reservations);
+            parser.parse(subnet_->getID(), reservations, hosts, add_hosts);
         }
 
         return (sn6ptr);
@@ -362,20 +370,8 @@ protected:
         // SimpleParser6::setAllDefaults.
         SubnetID subnet_id = static_cast<SubnetID>(getInteger(params, "id"));
 
-        // We want to log whether rapid-commit is enabled, so we get this
-        // before the actual subnet creation.
         bool rapid_commit = getBoolean(params, "rapid-commit");
 
-        std::ostringstream output;
-        output << addr << "/" << static_cast<int>(len)
-               << " with params t1=" << t1 << ", t2="
-               << t2 << ", preferred-lifetime=" << pref
-               << ", valid-lifetime=" << valid
-               << ", rapid-commit is " << (rapid_commit ? "enabled" : "disabled");
-
-
-        LOG_INFO(dhcp6_logger, DHCP6_CONFIG_NEW_SUBNET).arg(output.str());
-
         // Create a new subnet.
         Subnet6* subnet6 = new Subnet6(addr, len, t1, t2, pref, valid,
                                        subnet_id);
@@ -415,6 +411,40 @@ protected:
 };
 
 
+/// @brief Logs a new IPv6 subnet.
+///
+/// The subnets parsed ahead are logged when they are added to the
+/// configuration, in the main thread.
+///
+/// @param subnet the new subnet.
+void
+logNewSubnet6(const Subnet6Ptr& subnet) {
+    const std::pair<IOAddress, uint8_t> prefix = subnet->get();
+    std::ostringstream output;
+    output << prefix.first << "/" << static_cast<int>(prefix.second)
+           << " with params t1=" << subnet->getT1() << ", t2="
+           << subnet->getT2() << ", preferred-lifetime="
+           << subnet->getPreferred()
+           << ", valid-lifetime=" << subnet->getValid()
+           << ", rapid-commit is "
+           << (subnet->getRapidCommit() ? "enabled" : "disabled");
+
+    LOG_INFO(dhcp6_logger, DHCP6_CONFIG_NEW_SUBNET).arg(output.str());
+}
+
+/// @brief Parses an IPv6 subnet ahead of the configuration.
+///
+/// This function is called by the @c ParallelSubnetsParser threads.
+///
+/// @param subnet the subnet configuration.
+/// @param [out] hosts collection receiving the host reservations.
+/// @return a pointer to created Subnet6 object
+SubnetPtr
+parseSubnet6(const ConstElementPtr& subnet, HostCollection& hosts) {
+    Subnet6ConfigParser parser;
+    return (parser.parse(subnet, &hosts, false));
+}
+
 /// @brief this class parses a list of DHCP6 subnets
 ///
 /// This is a wrapper parser that handles the whole list of Subnet6
@@ -427,17 +457,37 @@ public:
     ///
     /// Iterates over all entries on the list, parses its content
     /// (by instantiating Subnet6ConfigParser) and adds to specified
-    /// configuration.
+    /// configuration. The subnets which didn't change since the current
+    /// configuration was applied are taken from the
+    /// @c IncrementalConfigCache instead of being parsed. Most of the other
+    /// subnets are parsed ahead on several threads by the
+    /// @c ParallelSubnetsParser.
     ///
     /// @param cfg configuration (parsed subnets will be stored here)
     /// @param subnets_list pointer to a list of IPv6 subnets
     /// @throw DhcpConfigError if CfgMgr rejects the subnet (e.g. subnet-id is a duplicate)
     size_t parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
+        IncrementalConfigCache& cache = IncrementalConfigCache::instance();
+        ParallelSubnetsParser parallel_parser(parseSubnet6);
+        parallel_parser.parse(subnets_list);
         size_t cnt = 0;
+        size_t index = 0;
         BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-            Subnet6ConfigParser parser;
-            Subnet6Ptr subnet = parser.parse(subnet_json);
+            Subnet6Ptr subnet = boost::dynamic_pointer_cast<
+                Subnet6>(cache.getSubnet(subnet_json));
+            if (!subnet) {
+                HostCollection hosts;
+                subnet = boost::dynamic_pointer_cast<
+                    Subnet6>(parallel_parser.getSubnet(index, hosts));
+                if (!subnet) {
+                    Subnet6ConfigParser parser;
+                    subnet = parser.parse(subnet_json, &hosts);
+                }
+                logNewSubnet6(subnet);
+                cache.addSubnet(subnet_json, subnet, hosts);
+            }
+            ++index;
 
             // Adding a subnet to the Configuration Manager may fail if the
             // subnet id is invalid (duplicate). Thus, we catch exceptions
@@ -534,6 +584,7 @@ public:
     ///
     /// - decline-probation-period
     /// - dhcp4o6-port
+    /// - packet-timeline
     ///
     /// @throw DhcpConfigError if parameters are missing or
     /// or having incorrect values.
@@ -548,6 +599,9 @@ public:
         // @todo Change for uint16_t
         uint32_t dhcp4o6_port = getUint32(global, "dhcp4o6-port");
         srv_config->setDhcp4o6Port(dhcp4o6_port);
+
+        // Set whether the packet processing latencies are recorded.
+        srv_config->setPacketTimeline(getBoolean(global, "packet-timeline"));
     }
 
 private:
@@ -612,7 +666,7 @@ void configureCommandChannel() {
 }
 
 isc::data::ConstElementPtr
-configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
+configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
                      bool check_only) {
 
     if (!config_set) {
@@ -666,6 +720,11 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
         // And now derive (inherit) global parameters to subnets, if not specified.
         SimpleParser6::deriveParameters(mutable_cfg);
 
+        // The subnets and client classes which didn't change can be reused
+        // unless the option definitions they use have changed.
+        IncrementalConfigCache::instance().
+            startConfig(mutable_cfg->get("option-def"));
+
         // Make parsers grouping.
         const std::map<std::string, ConstElementPtr>& values_map =
             mutable_cfg->mapValue();
@@ -754,9 +813,14 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
             }
 
             if (config_pair.first =="client-classes") {
-                ClientClassDefListParser parser;
+                IncrementalConfigCache& cache = IncrementalConfigCache::instance();
                 ClientClassDictionaryPtr dictionary =
-                    parser.parse(config_pair.second, AF_INET6);
+                    cache.getClientClasses(config_pair.second);
+                if (!dictionary) {
+                    ClientClassDefListParser parser;
+                    dictionary = parser.parse(config_pair.second, AF_INET6);
+                    cache.addClientClasses(config_pair.second, dictionary);
+                }
                 srv_config->setClientClassDictionary(dictionary);
                 continue;
             }
@@ -786,14 +850,16 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
 
             // Timers are not used in the global scope. Their values are derived
             // to specific subnets (see SimpleParser6::deriveParameters).
-            // decline-probation-period and dhcp4o6-port are handled in the
-            // global_parser.parse() which sets global parameters.
+            // decline-probation-period, dhcp4o6-port and packet-timeline are
+            // handled in the global_parser.parse() which sets global
+            // parameters.
             if ( (config_pair.first == "renew-timer") ||
                  (config_pair.first == "rebind-timer") ||
                  (config_pair.first == "preferred-lifetime") ||
                  (config_pair.first == "valid-lifetime") ||
                  (config_pair.first == "decline-probation-period") ||
-                 (config_pair.first == "dhcp4o6-port")) {
+                 (config_pair.first == "dhcp4o6-port") ||
+                 (config_pair.first == "packet-timeline")) {
                 continue;
             }
 
@@ -860,6 +926,10 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
             D2ClientConfigPtr cfg;
             cfg = CfgMgr::instance().getStagingCfg()->getD2ClientConfig();
             CfgMgr::instance().setD2ClientConfig(cfg);
+
+            // Get the latency histograms once rather than for each packet.
+            server.configureTimelineStats(CfgMgr::instance().getStagingCfg()->
+                                          getPacketTimeline());
         }
         catch (const isc::Exception& ex) {
             LOG_ERROR(dhcp6_logger, DHCP6_PARSER_COMMIT_FAIL).arg(ex.what());
@@ -884,6 +954,9 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
         return (answer);
     }
 
+    // Keep the parsed objects for the next configuration.
+    IncrementalConfigCache::instance().commit();
+
     LOG_INFO(dhcp6_logger, DHCP6_CONFIG_COMPLETE)
         .arg(CfgMgr::instance().getStagingCfg()->
              getConfigSummary(SrvConfig::CFGSEL_ALL6));
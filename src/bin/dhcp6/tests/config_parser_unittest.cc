@@ -4790,6 +4790,34 @@ TEST_F(Dhcp6ParserTest, dhcp4o6portDefault) {
     EXPECT_EQ(0, CfgMgr::instance().getStagingCfg()->getDhcp4o6Port());
 }
 
+/// Check that the recording of the packet processing timeline is enabled
+/// by default and can be disabled.
+TEST_F(Dhcp6ParserTest, packetTimeline) {
+
+    string config_txt = "{ " + genIfaceConfig() + ","
+        "\"subnet6\": [  ] "
+        "}";
+    ConstElementPtr config;
+    ASSERT_NO_THROW(config = parseDHCP6(config_txt));
+
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp6Server(srv_, config));
+    checkResult(status, 0);
+    EXPECT_TRUE(CfgMgr::instance().getStagingCfg()->getPacketTimeline());
+
+    CfgMgr::instance().clear();
+
+    config_txt = "{ " + genIfaceConfig() + ","
+        "\"packet-timeline\": false,"
+        "\"subnet6\": [  ] "
+        "}";
+    ASSERT_NO_THROW(config = parseDHCP6(config_txt));
+
+    EXPECT_NO_THROW(status = configureDhcp6Server(srv_, config));
+    checkResult(status, 0);
+    EXPECT_FALSE(CfgMgr::instance().getStagingCfg()->getPacketTimeline());
+}
+
 /// Check that the decline-probation-period value can be set properly.
 TEST_F(Dhcp6ParserTest, declineTimer) {
     string config = "{ " + genIfaceConfig() + "," +
@@ -10,6 +10,7 @@
 #include <lfc/lfc_log.h>
 #include <util/pid_file.h>
 #include <exceptions/exceptions.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/csv_lease_file4.h>
 #include <dhcpsrv/csv_lease_file6.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
@@ -34,6 +35,90 @@ using namespace isc::log;
 namespace {
 /// @brief Maximum number of errors to allow when reading leases from the file.
 const uint32_t MAX_LEASE_ERRORS = 100;
+
+/// @brief Statistics of the lease files summed over the processed files.
+struct LeaseFilesStats {
+    /// @brief Constructor.
+    LeaseFilesStats()
+        : reads_(0), read_leases_(0), read_errs_(0),
+          writes_(0), write_leases_(0), write_errs_(0) {
+    }
+
+    /// @brief Adds the read statistics of a lease file.
+    ///
+    /// @param stats Statistics of the lease file.
+    void addReads(const LeaseFileStats& stats) {
+        reads_ += stats.getReads();
+        read_leases_ += stats.getReadLeases();
+        read_errs_ += stats.getReadErrs();
+    }
+
+    /// @brief Adds the write statistics of a lease file.
+    ///
+    /// @param stats Statistics of the lease file.
+    void addWrites(const LeaseFileStats& stats) {
+        writes_ += stats.getWrites();
+        write_leases_ += stats.getWriteLeases();
+        write_errs_ += stats.getWriteErrs();
+    }
+
+    uint32_t reads_;        ///< Number of attempts to read a lease
+    uint32_t read_leases_;  ///< Number of leases read
+    uint32_t read_errs_;    ///< Number of errors while reading
+    uint32_t writes_;       ///< Number of attempts to write a lease
+    uint32_t write_leases_; ///< Number of leases written
+    uint32_t write_errs_;   ///< Number of errors while writing
+};
+
+/// @brief Reads the leases from a lease file in the format it is
+/// written in, if the file exists.
+///
+/// @param filename Name of the lease file.
+/// @param storage Storage where the leases are added.
+/// @param stats Statistics to which the file statistics are added.
+/// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+/// @tparam CSVFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+/// @tparam BinaryFileType A @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+/// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+template<typename LeaseObjectType, typename CSVFileType,
+         typename BinaryFileType, typename StorageType>
+void
+readLeaseFile(const std::string& filename, StorageType& storage,
+              LeaseFilesStats& stats) {
+    if (BinaryLeaseFile::isBinaryFile(filename)) {
+        BinaryFileType lease_file(filename);
+        LeaseFileLoader::load<LeaseObjectType>(lease_file, storage,
+                                               MAX_LEASE_ERRORS);
+        stats.addReads(lease_file);
+        return;
+    }
+
+    CSVFileType lease_file(filename);
+    if (lease_file.exists()) {
+        LeaseFileLoader::load<LeaseObjectType>(lease_file, storage,
+                                               MAX_LEASE_ERRORS);
+        stats.addReads(lease_file);
+    }
+}
+
+/// @brief Writes the leases to a lease file.
+///
+/// @param filename Name of the lease file.
+/// @param storage Storage holding the leases.
+/// @param stats Statistics to which the file statistics are added.
+/// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType Type of the lease file, which defines its format.
+/// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename StorageType>
+void
+writeLeaseFile(const std::string& filename, const StorageType& storage,
+               LeaseFilesStats& stats) {
+    LeaseFileType lease_file(filename);
+    LeaseFileLoader::write<LeaseObjectType>(lease_file, storage);
+    stats.addWrites(lease_file);
+}
+
 }; // namespace anonymous
 
 namespace isc {
@@ -51,7 +136,8 @@ const char* LFCController::lfc_bin_name_ = "kea-lfc";
 
 LFCController::LFCController()
     : protocol_version_(0), verbose_(false), config_file_(""), previous_file_(""),
-      copy_file_(""), output_file_(""), finish_file_(""), pid_file_("") {
+      copy_file_(""), output_file_(""), finish_file_(""), pid_file_(""),
+      file_format_("") {
 }
 
 LFCController::~LFCController() {
@@ -81,6 +167,30 @@ LFCController::launch(int argc, char* argv[], const bool test_mode) {
 
     LOG_INFO(lfc_logger, LFC_START);
 
+    // Converting a lease file doesn't involve the server files, so it
+    // doesn't need to be protected by the pid file.
+    if (!file_format_.empty()) {
+        LOG_INFO(lfc_logger, LFC_CONVERTING)
+          .arg(copy_file_)
+          .arg(output_file_)
+          .arg(file_format_);
+
+        try {
+            if (getProtocolVersion() == 4) {
+                convertLeases<Lease4, CSVLeaseFile4, BinaryLeaseFile4,
+                              Lease4Storage>();
+            } else {
+                convertLeases<Lease6, CSVLeaseFile6, BinaryLeaseFile6,
+                              Lease6Storage>();
+            }
+        } catch (const std::exception& conv_ex) {
+            LOG_FATAL(lfc_logger, LFC_FAIL_CONVERT).arg(conv_ex.what());
+        }
+
+        LOG_INFO(lfc_logger, LFC_TERMINATE);
+        return;
+    }
+
     // verify we are the only instance
     PIDFile pid_file(pid_file_);
 
@@ -109,9 +219,11 @@ LFCController::launch(int argc, char* argv[], const bool test_mode) {
 
         try {
             if (getProtocolVersion() == 4) {
-                processLeases<Lease4, CSVLeaseFile4, Lease4Storage>();
+                processLeases<Lease4, CSVLeaseFile4, BinaryLeaseFile4,
+                              Lease4Storage>();
             } else {
-                processLeases<Lease6, CSVLeaseFile6, Lease6Storage>();
+                processLeases<Lease6, CSVLeaseFile6, BinaryLeaseFile6,
+                              Lease6Storage>();
             }
         } catch (const std::exception& proc_ex) {
             // We don't want to do the cleanup but do want to get rid of the pid
@@ -150,7 +262,7 @@ LFCController::parseArgs(int argc, char* argv[]) {
 
     opterr = 0;
     optind = 1;
-    while ((ch = getopt(argc, argv, ":46dvVWp:x:i:o:c:f:")) != -1) {
+    while ((ch = getopt(argc, argv, ":46dvVWp:x:i:o:c:f:F:")) != -1) {
         switch (ch) {
         case '4':
             // Process DHCPv4 lease files.
@@ -230,6 +342,18 @@ LFCController::parseArgs(int argc, char* argv[]) {
             config_file_ = optarg;
             break;
 
+        case 'F':
+            // Format of the output file, enables the conversion mode.
+            if (optarg == NULL) {
+                isc_throw(InvalidUsage, "File format missing");
+            }
+            file_format_ = optarg;
+            if ((file_format_ != "csv") && (file_format_ != "binary")) {
+                isc_throw(InvalidUsage, "Invalid file format: "
+                          << file_format_);
+            }
+            break;
+
         case 'h':
             usage("");
             exit(EXIT_SUCCESS);
@@ -258,6 +382,26 @@ LFCController::parseArgs(int argc, char* argv[]) {
         isc_throw(InvalidUsage, "DHCP version required");
     }
 
+    // The conversion of a lease file only needs the input and output files.
+    if (!file_format_.empty()) {
+        if (copy_file_.empty()) {
+            isc_throw(InvalidUsage, "Input file not specified");
+        }
+
+        if (output_file_.empty()) {
+            isc_throw(InvalidUsage, "Output file not specified");
+        }
+
+        if (verbose_) {
+            std::cout << "Protocol version:    DHCPv" << protocol_version_ << std::endl
+                      << "Input lease file:          " << copy_file_ << std::endl
+                      << "Output lease file:         " << output_file_ << std::endl
+                      << "Output file format:        " << file_format_ << std::endl
+                      << std::endl;
+        }
+        return;
+    }
+
     if (pid_file_.empty()) {
         isc_throw(InvalidUsage, "PID file not specified");
     }
@@ -303,6 +447,7 @@ LFCController::usage(const std::string& text) {
 
     std::cerr << "Usage: " << lfc_bin_name_ << std::endl
               << " [-4|-6] -p file -x file -i file -o file -f file -c file" << std::endl
+              << " [-4|-6] -F csv|binary -i file -o file" << std::endl
               << "   -4 or -6 clean a set of v4 or v6 lease files" << std::endl
               << "   -p <file>: PID file" << std::endl
               << "   -x <file>: previous or ex lease file" << std::endl
@@ -310,6 +455,8 @@ LFCController::usage(const std::string& text) {
               << "   -o <file>: output lease file" << std::endl
               << "   -f <file>: finish file" << std::endl
               << "   -c <file>: configuration file" << std::endl
+              << "   -F <format>: convert the -i file to the -o file in"
+              << " the csv or binary format" << std::endl
               << "   -v: print version number and exit" << std::endl
               << "   -V: print extended version information and exit" << std::endl
               << "   -d: optional, verbose output " << std::endl
@@ -330,39 +477,44 @@ LFCController::getVersion(const bool extended) const{
     return (version_stream.str());
 }
 
-template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+template<typename LeaseObjectType, typename CSVFileType,
+         typename BinaryFileType, typename StorageType>
 void
 LFCController::processLeases() const {
     StorageType storage;
-
-    // If a previous file exists read the entries into storage
-    LeaseFileType lf_prev(getPreviousFile());
-    if (lf_prev.exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(lf_prev, storage,
-                                               MAX_LEASE_ERRORS);
+    LeaseFilesStats stats;
+
+    // If a previous file exists read the entries into storage, follow
+    // that with the copy of the current lease file
+    readLeaseFile<LeaseObjectType, CSVFileType,
+                  BinaryFileType>(getPreviousFile(), storage, stats);
+    readLeaseFile<LeaseObjectType, CSVFileType,
+                  BinaryFileType>(getCopyFile(), storage, stats);
+
+    // Write the result out to the output file, in the format of the
+    // most recent of the files as it is the one used by the server
+    std::string format_file = getCopyFile();
+    if (!CSVFile(format_file).exists()) {
+        format_file = getPreviousFile();
     }
-
-    // Follow that with the copy of the current lease file
-    LeaseFileType lf_copy(getCopyFile());
-    if (lf_copy.exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(lf_copy, storage,
-                                               MAX_LEASE_ERRORS);
+    if (BinaryLeaseFile::isBinaryFile(format_file)) {
+        writeLeaseFile<LeaseObjectType,
+                       BinaryFileType>(getOutputFile(), storage, stats);
+    } else {
+        writeLeaseFile<LeaseObjectType,
+                       CSVFileType>(getOutputFile(), storage, stats);
     }
 
-    // Write the result out to the output file
-    LeaseFileType lf_output(getOutputFile());
-    LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
-
     // If desired log the stats
     LOG_INFO(lfc_logger, LFC_READ_STATS)
-      .arg(lf_prev.getReadLeases() + lf_copy.getReadLeases())
-      .arg(lf_prev.getReads() + lf_copy.getReads())
-      .arg(lf_prev.getReadErrs() + lf_copy.getReadErrs());
+      .arg(stats.read_leases_)
+      .arg(stats.reads_)
+      .arg(stats.read_errs_);
 
     LOG_INFO(lfc_logger, LFC_WRITE_STATS)
-      .arg(lf_output.getWriteLeases())
-      .arg(lf_output.getWrites())
-      .arg(lf_output.getWriteErrs());
+      .arg(stats.write_leases_)
+      .arg(stats.writes_)
+      .arg(stats.write_errs_);
 
     // Once we've finished the output file move it to the complete file
     if (rename(getOutputFile().c_str(), getFinishFile().c_str()) != 0) {
@@ -372,6 +524,39 @@ LFCController::processLeases() const {
     }
 }
 
+template<typename LeaseObjectType, typename CSVFileType,
+         typename BinaryFileType, typename StorageType>
+void
+LFCController::convertLeases() const {
+    StorageType storage;
+    LeaseFilesStats stats;
+
+    if (!CSVFile(getCopyFile()).exists()) {
+        isc_throw(RunTimeFail, "Input file (" << copy_file_
+                  << ") does not exist");
+    }
+    readLeaseFile<LeaseObjectType, CSVFileType,
+                  BinaryFileType>(getCopyFile(), storage, stats);
+
+    if (file_format_ == "binary") {
+        writeLeaseFile<LeaseObjectType,
+                       BinaryFileType>(getOutputFile(), storage, stats);
+    } else {
+        writeLeaseFile<LeaseObjectType,
+                       CSVFileType>(getOutputFile(), storage, stats);
+    }
+
+    LOG_INFO(lfc_logger, LFC_READ_STATS)
+      .arg(stats.read_leases_)
+      .arg(stats.reads_)
+      .arg(stats.read_errs_);
+
+    LOG_INFO(lfc_logger, LFC_WRITE_STATS)
+      .arg(stats.write_leases_)
+      .arg(stats.writes_)
+      .arg(stats.write_errs_);
+}
+
 void
 LFCController::fileRotate() const {
     // Remove the old previous file
@@ -67,6 +67,9 @@ public:
     /// -# remove pid file
     /// -# exit to the caller
     ///
+    /// When the -F option is given the copy file is instead converted
+    /// to the output file in the requested format, see @c convertLeases.
+    ///
     /// @param argc Number of strings in the @c argv array.
     /// @param argv Array of arguments passed in via the program's main function.
     /// @param test_mode is a bool value which indicates if @c launch
@@ -149,6 +152,14 @@ public:
     std::string getPidFile() const {
         return (pid_file_);
     }
+
+    /// @brief Gets the format of the converted file
+    ///
+    /// @return Returns "csv" or "binary" when converting a lease file,
+    /// an empty string otherwise
+    std::string getFileFormat() const {
+        return (file_format_);
+    }
     //@}
 
 private:
@@ -162,6 +173,7 @@ private:
     std::string output_file_;   ///< The path to the output file
     std::string finish_file_;   ///< The path to the finished output file
     std::string pid_file_;      ///< The path to the pid file
+    std::string file_format_;   ///< The format of the converted file
 
     /// @brief Prints the program usage text to std error.
     ///
@@ -181,14 +193,36 @@ private:
     /// write the results out to the output file.  Upon completion of
     /// the write move the file to the finish file.
     ///
+    /// Each file is read in the format it is written in, CSV or binary.
+    /// The output file is written in the format of the copy file or, if
+    /// it doesn't exist, of the previous file.
+    ///
     /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
-    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam CSVFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam BinaryFileType A @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
     /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
     ///
     /// @throw RunTimeFail if we can't move the file.
-    template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+    template<typename LeaseObjectType, typename CSVFileType,
+             typename BinaryFileType, typename StorageType>
     void processLeases() const;
 
+    /// @brief Convert a file.
+    ///
+    /// Read in the leases from the copy file, in any format, and write
+    /// them out to the output file in the format given with the -F
+    /// option.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam CSVFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam BinaryFileType A @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw RunTimeFail if the copy file doesn't exist.
+    template<typename LeaseObjectType, typename CSVFileType,
+             typename BinaryFileType, typename StorageType>
+    void convertLeases() const;
+
     ///@brief Start up the logging system
     ///
     /// @param test_mode indicates if we have have been started from the test
@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <lfc/lfc_controller.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <util/csv_file.h>
 #include <gtest/gtest.h>
 #include <fstream>
@@ -269,6 +270,36 @@ TEST_F(LFCControllerTest, someBadData) {
     EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
 }
 
+/// @brief Verify that the conversion command line is parsed.
+/// The conversion only requires the protocol version, the copy (input)
+/// and output files and a valid format.
+TEST_F(LFCControllerTest, convertCommandLine) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-F"),
+                     const_cast<char*>("binary"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>("copy"),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>("output") };
+
+    for (int argc = 1; argc < 8; ++argc) {
+        EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage)
+            << "test failed for argc = " << argc;
+    }
+
+    ASSERT_NO_THROW(lfc_controller.parseArgs(8, argv));
+    EXPECT_EQ(lfc_controller.getFileFormat(), "binary");
+    EXPECT_EQ(lfc_controller.getCopyFile(), "copy");
+    EXPECT_EQ(lfc_controller.getOutputFile(), "output");
+
+    // Only the csv and binary formats are supported
+    argv[3] = const_cast<char*>("xml");
+    EXPECT_THROW(lfc_controller.parseArgs(8, argv), InvalidUsage);
+}
+
 /// @brief Verify that we do file rotation correctly.  We create different
 /// files and see if we properly delete and move them.
 TEST_F(LFCControllerTest, fileRotate) {
@@ -663,4 +694,97 @@ TEST_F(LFCControllerTest, launch6) {
     EXPECT_TRUE(noExistIOFP());
 }
 
+/// @brief Verify that a v4 lease file is converted to the binary format
+/// and back to the CSV format.
+TEST_F(LFCControllerTest, convert4) {
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-F"),
+                     const_cast<char*>("binary"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-d")
+    };
+    int argc = 8;
+
+    string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,200,8,1,1,host.example.com,1\n";
+    string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,500,8,1,1,host.example.com,1\n";
+    string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,100,7,0,0,,1\n";
+    writeFile(istr_, v4_hdr_ + a_1 + b_1 + a_2);
+
+    LFCController lfc_controller;
+    launch(lfc_controller, argc, argv);
+    EXPECT_TRUE(isc::dhcp::BinaryLeaseFile::isBinaryFile(ostr_));
+
+    // The conversion doesn't touch the other files
+    EXPECT_TRUE(noExist(pstr_));
+    EXPECT_TRUE(noExist(fstr_));
+
+    // Convert the binary file back to the CSV format
+    ASSERT_EQ(0, rename(ostr_.c_str(), istr_.c_str()));
+    argv[3] = const_cast<char*>("csv");
+    LFCController lfc_controller_csv;
+    launch(lfc_controller_csv, argc, argv);
+    EXPECT_EQ(readFile(ostr_), v4_hdr_ + a_2 + b_1);
+}
+
+/// @brief Verify that the lease files in different formats are cleaned
+/// up and that the result is written in the format of the copy file.
+TEST_F(LFCControllerTest, launchBinary4) {
+    char* conv_argv[] = { const_cast<char*>("progName"),
+                          const_cast<char*>("-4"),
+                          const_cast<char*>("-F"),
+                          const_cast<char*>("binary"),
+                          const_cast<char*>("-i"),
+                          const_cast<char*>(istr_.c_str()),
+                          const_cast<char*>("-o"),
+                          const_cast<char*>(ostr_.c_str()) };
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>(xstr_.c_str()),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(cstr_.c_str()),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>(fstr_.c_str()),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>(pstr_.c_str()) };
+
+    string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,200,8,1,1,host.example.com,1\n";
+    string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,500,8,1,1,host.example.com,1\n";
+    string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,100,7,0,0,,1\n";
+
+    // The previous file is in the CSV format and the copy file in the
+    // binary format
+    writeFile(xstr_, v4_hdr_ + a_1 + b_1);
+    writeFile(istr_, v4_hdr_ + a_2);
+    LFCController lfc_conv;
+    launch(lfc_conv, 8, conv_argv);
+    ASSERT_EQ(0, rename(ostr_.c_str(), istr_.c_str()));
+
+    LFCController lfc_controller;
+    launch(lfc_controller, 14, argv);
+    EXPECT_TRUE(isc::dhcp::BinaryLeaseFile::isBinaryFile(xstr_));
+    EXPECT_TRUE(noExistIOFP());
+
+    // Check the content of the result converted to the CSV format
+    conv_argv[3] = const_cast<char*>("csv");
+    conv_argv[5] = const_cast<char*>(xstr_.c_str());
+    LFCController lfc_conv_csv;
+    launch(lfc_conv_csv, 8, conv_argv);
+    EXPECT_EQ(readFile(ostr_), v4_hdr_ + a_2 + b_1);
+}
+
 } // end of anonymous namespace
@@ -134,9 +134,13 @@ CommandOptions::reset() {
     seeded_ = false;
     seed_ = 0;
     broadcast_ = false;
+    single_thread_mode_ = true;
+    output_format_ = OUTPUT_TEXT;
     rapid_commit_ = false;
     use_first_ = false;
     template_file_.clear();
+    replay_file_.clear();
+    replay_speed_ = 1.;
     rnd_offset_.clear();
     xid_offset_.clear();
     elp_offset_ = -1;
@@ -214,7 +218,7 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
     // In this section we collect argument values from command line
     // they will be tuned and validated elsewhere
     while((opt = getopt(argc, argv, "hv46A:r:t:R:b:n:p:d:D:l:P:a:L:M:"
-                        "s:iBc1T:X:O:E:S:I:x:w:e:f:F:")) != -1) {
+                        "s:iBc1T:X:O:E:S:I:x:w:e:f:F:g:j:Y:y:")) != -1) {
         stream << " -" << static_cast<char>(opt);
         if (optarg) {
             stream << " " << optarg;
@@ -329,6 +333,18 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                                             " positive integer");
             break;
 
+        case 'g':
+            sarg = std::string(optarg);
+            if (sarg == "single") {
+                single_thread_mode_ = true;
+            } else if (sarg == "multi") {
+                single_thread_mode_ = false;
+            } else {
+                isc_throw(InvalidParameter, "value of thread mode:"
+                          " -g<thread-mode> must be 'single' or 'multi'");
+            }
+            break;
+
         case 'h':
             usage();
             return (true);
@@ -343,6 +359,20 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                                           " positive integer");
             break;
 
+        case 'j':
+            sarg = std::string(optarg);
+            if (sarg == "text") {
+                output_format_ = OUTPUT_TEXT;
+            } else if (sarg == "json") {
+                output_format_ = OUTPUT_JSON;
+            } else if (sarg == "csv") {
+                output_format_ = OUTPUT_CSV;
+            } else {
+                isc_throw(InvalidParameter, "value of output format:"
+                          " -j<output-format> must be 'text', 'json' or 'csv'");
+            }
+            break;
+
         case 'l':
             localname_ = std::string(optarg);
             initIsInterface();
@@ -469,6 +499,26 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             xid_offset_.push_back(offset_arg);
             break;
 
+        case 'Y':
+            replay_file_ = nonEmptyString("capture file name not specified,"
+                                          " expected -Y<pcap-file>");
+            break;
+
+        case 'y':
+            sarg = std::string(optarg);
+            if (sarg == "max") {
+                replay_speed_ = 0.;
+            } else {
+                try {
+                    replay_speed_ = boost::lexical_cast<double>(sarg);
+                } catch (boost::bad_lexical_cast&) {
+                    replay_speed_ = -1.;
+                }
+                check(replay_speed_ <= 0., "value of replay speed:"
+                      " -y<replay-speed> must be a positive number or 'max'");
+            }
+            break;
+
         default:
             isc_throw(isc::InvalidParameter, "unknown command line option");
         }
@@ -784,13 +834,15 @@ CommandOptions::validate() const {
           "-F<release-rate> is not compatible with -i");
     check((getExchangeMode() != DO_SA) && (isRapidCommit() != 0),
           "-i must be set to use -c");
-    check((getRate() == 0) && (getReportDelay() != 0),
+    // The replayed capture sets the pace of the test as -r<rate> does.
+    const bool paced = (getRate() != 0) || !getReplayFile().empty();
+    check(!paced && (getReportDelay() != 0),
           "-r<rate> must be set to use -t<report>");
-    check((getRate() == 0) && (getNumRequests().size() > 0),
+    check(!paced && (getNumRequests().size() > 0),
           "-r<rate> must be set to use -n<num-request>");
-    check((getRate() == 0) && (getPeriod() != 0),
+    check(!paced && (getPeriod() != 0),
           "-r<rate> must be set to use -p<test-period>");
-    check((getRate() == 0) &&
+    check(!paced &&
           ((getMaxDrop().size() > 0) || getMaxDropPercentage().size() > 0),
           "-r<rate> must be set to use -D<max-drop>");
     check((getRate() != 0) && (getRenewRate() + getReleaseRate() > getRate()),
@@ -817,6 +869,19 @@ CommandOptions::validate() const {
           "use -I<ip-offset>");
     check((!getMacListFile().empty() && base_.size() > 0),
           "Can't use -b with -M option");
+    check(getReplayFile().empty() && (getReplaySpeed() != 1.),
+          "-Y<pcap-file> must be set to use -y<replay-speed>");
+    check(!getReplayFile().empty() && (getRate() != 0) &&
+          (getReplaySpeed() != 0.),
+          "-r<rate> may be used with -Y<pcap-file> only with -y max");
+    check(!getReplayFile().empty() && !getTemplateFiles().empty(),
+          "-T<template-file> is not compatible with -Y<pcap-file>");
+    check(!getReplayFile().empty() && (getExchangeMode() == DO_SA),
+          "-i is not compatible with -Y<pcap-file>");
+    check(!getReplayFile().empty() &&
+          ((getRenewRate() != 0) || (getReleaseRate() != 0)),
+          "-f<renew-rate> and -F<release-rate> are not compatible with"
+          " -Y<pcap-file>");
 }
 
 void
@@ -924,6 +989,14 @@ CommandOptions::printCommandLine() const {
     if (broadcast_) {
         std::cout << "broadcast" << std::endl;
     }
+    if (!single_thread_mode_) {
+        std::cout << "thread-mode=multi" << std::endl;
+    }
+    if (output_format_ == OUTPUT_JSON) {
+        std::cout << "output-format=json" << std::endl;
+    } else if (output_format_ == OUTPUT_CSV) {
+        std::cout << "output-format=csv" << std::endl;
+    }
     if (rapid_commit_) {
         std::cout << "rapid-commit" << std::endl;
     }
@@ -936,6 +1009,14 @@ CommandOptions::printCommandLine() const {
     for (size_t i = 0; i < template_file_.size(); ++i) {
         std::cout << "template-file[" << i << "]=" << template_file_[i] << std::endl;
     }
+    if (!replay_file_.empty()) {
+        std::cout << "replay-file=" << replay_file_ << std::endl;
+        if (replay_speed_ == 0.) {
+            std::cout << "replay-speed=max" << std::endl;
+        } else {
+            std::cout << "replay-speed=" << replay_speed_ << std::endl;
+        }
+    }
     for (size_t i = 0; i < xid_offset_.size(); ++i) {
         std::cout << "xid-offset[" << i << "]=" << xid_offset_[i] << std::endl;
     }
@@ -977,11 +1058,12 @@ CommandOptions::usage() const {
         "         [-F<release-rate>] [-t<report>] [-R<range>] [-b<base>]\n"
         "         [-n<num-request>] [-p<test-period>] [-d<drop-time>]\n"
         "         [-D<max-drop>] [-l<local-addr|interface>] [-P<preload>]\n"
+        "         [-g<thread-mode>] [-j<output-format>]\n"
         "         [-a<aggressivity>] [-L<local-port>] [-s<seed>] [-i] [-B]\n"
         "         [-c] [-1] [-M<mac-list-file>] [-T<template-file>]\n"
         "         [-X<xid-offset>] [-O<random-offset] [-E<time-offset>]\n"
         "         [-S<srvid-offset>] [-I<ip-offset>] [-x<diagnostic-selector>]\n"
-        "         [-w<wrapped>] [server]\n"
+        "         [-Y<pcap-file>] [-y<replay-speed>] [-w<wrapped>] [server]\n"
         "\n"
         "The [server] argument is the name/address of the DHCP server to\n"
         "contact.  For DHCPv4 operation, exchanges are initiated by\n"
@@ -1029,11 +1111,19 @@ CommandOptions::usage() const {
         "    with the exchange rate (given by -r<rate>).  Furthermore the sum of\n"
         "    this value and the release-rate (given by -F<rate) must be equal\n"
         "    to or less than the exchange rate.\n"
+        "-g<thread-mode>: 'single' (the default) sends and receives packets\n"
+        "    in a single thread. 'multi' receives packets and matches them with\n"
+        "    sent packets in a separate thread, which allows for driving the\n"
+        "    server at higher rates.\n"
         "-h: Print this help.\n"
         "-i: Do only the initial part of an exchange: DO or SA, depending on\n"
         "    whether -6 is given.\n"
         "-I<ip-offset>: Offset of the (DHCPv4) IP address in the requested-IP\n"
         "    option / (DHCPv6) IA_NA option in the (second/request) template.\n"
+        "-j<output-format>: Format of the statistics reports: 'text' (the\n"
+        "    default), 'json' (one JSON object per line and per report) or\n"
+        "    'csv' (a header row followed by one row per exchange type and\n"
+        "    per report). Delays are given in milliseconds.\n"
         "-l<local-addr|interface>: For DHCPv4 operation, specify the local\n"
         "    hostname/address to use when communicating with the server.  By\n"
         "    default, the interface address through which traffic would\n"
@@ -1075,6 +1165,16 @@ CommandOptions::usage() const {
         "   * 't': when finished, print timers of all successful exchanges\n"
         "   * 'T': when finished, print templates\n"
         "-X<xid-offset>: Transaction ID (aka. xid) offset in the template.\n"
+        "-Y<pcap-file>: Replay the DHCP messages sent to a server found in\n"
+        "    the capture file (in the pcap format) instead of generating\n"
+        "    exchanges. The capture is replayed once, or repeatedly until\n"
+        "    -n<num-request> or -p<test-period> is reached. The transaction\n"
+        "    ids and client identifiers are changed in each repetition.\n"
+        "    The messages are relayed as for generated exchanges.\n"
+        "-y<replay-speed>: Speed factor applied to the timing of the\n"
+        "    captured messages, e.g. 2 replays them twice as fast. The\n"
+        "    value 'max' sends them as fast as possible, or at the rate\n"
+        "    given by -r<rate>. The default is 1.\n"
         "\n"
         "DHCPv4 only options:\n"
         "-B: Force broadcast handling.\n"
@@ -1093,7 +1193,7 @@ CommandOptions::usage() const {
         "    traffic is an equivalent of the traffic passing through a single\n"
         "    relay agent.\n"
         "\n"
-        "The remaining options are used only in conjunction with -r:\n"
+        "The remaining options are used only in conjunction with -r or -Y:\n"
         "\n"
         "-D<max-drop>: Abort the test if more than <max-drop> requests have\n"
         "    been dropped.  Use -D0 to abort if even a single request has been\n"
@@ -105,6 +105,13 @@ public:
         DORA_SARR
     };
 
+    /// Format of the statistics reports (cmd line param -j)
+    enum OutputFormat {
+        OUTPUT_TEXT,
+        OUTPUT_JSON,
+        OUTPUT_CSV
+    };
+
     /// CommandOptions is a singleton class. This method returns reference
     /// to its sole instance.
     ///
@@ -262,6 +269,17 @@ public:
     /// \return true if broadcast address is to be used.
     bool isBroadcast() const { return broadcast_; }
 
+    /// \brief Checks if packets are sent and received in a single thread.
+    ///
+    /// \return true if single thread mode is used, false if packets are
+    /// received in a separate thread.
+    bool isSingleThreaded() const { return single_thread_mode_; }
+
+    /// \brief Returns the format of the statistics reports.
+    ///
+    /// \return format of the statistics reports.
+    OutputFormat getOutputFormat() const { return output_format_; }
+
     /// \brief Check if rapid commit option used.
     ///
     /// \return true if rapid commit option is used.
@@ -282,6 +300,18 @@ public:
     /// \return template file names.
     std::vector<std::string> getTemplateFiles() const { return template_file_; }
 
+    /// \brief Returns the name of the capture file to replay.
+    ///
+    /// \return name of the pcap file or an empty string if the messages
+    /// are not replayed from a capture.
+    std::string getReplayFile() const { return replay_file_; }
+
+    /// \brief Returns the speed factor applied to the capture timing.
+    ///
+    /// \return speed factor or 0 if the captured messages are sent as
+    /// fast as possible (or at the rate given by -r<rate>).
+    double getReplaySpeed() const { return replay_speed_; }
+
     /// \brief Returns location of the file containing list of MAC addresses.
     ///
     /// MAC addresses read from the file are used by the perfdhcp in message
@@ -551,6 +581,10 @@ private:
     bool seeded_;
     /// Indicates that we use broadcast address.
     bool broadcast_;
+    /// Indicates that packets are sent and received in a single thread.
+    bool single_thread_mode_;
+    /// Format of the statistics reports.
+    OutputFormat output_format_;
     /// Indicates that we do rapid commit option.
     bool rapid_commit_;
     /// Indicates that we take server id from first received packet.
@@ -559,6 +593,11 @@ private:
     /// that are used for initiating exchanges. Template packets
     /// read from files are later tuned with variable data.
     std::vector<std::string> template_file_;
+    /// Name of the pcap file holding the messages to replay.
+    std::string replay_file_;
+    /// Speed factor applied to the timing of the replayed messages,
+    /// 0 meaning as fast as possible.
+    double replay_speed_;
     /// Location of a file containing a list of MAC addresses, one per line.
     /// This can be used if you don't want to generate MAC address from a
     /// base MAC address, but rather provide the file with a list of MAC
@@ -0,0 +1,126 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <exceptions/exceptions.h>
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// \brief Number of buckets in each power of 2 above the lowest values.
+const uint64_t HALF_SUB_BUCKET_COUNT =
+    isc::perfdhcp::LatencyHistogram::SUB_BUCKET_COUNT / 2;
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(), count_(0), min_(std::numeric_limits<uint64_t>::max()),
+      max_(0), sum_(0.), sum_squared_(0.) {
+}
+
+void
+LatencyHistogram::record(const uint64_t value) {
+    const size_t index = getBucketIndex(value);
+    if (index >= counts_.size()) {
+        counts_.resize(index + 1, 0);
+    }
+    ++counts_[index];
+    ++count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    const double delay = static_cast<double>(value);
+    sum_ += delay;
+    sum_squared_ += delay * delay;
+}
+
+void
+LatencyHistogram::reset() {
+    counts_.clear();
+    count_ = 0;
+    min_ = std::numeric_limits<uint64_t>::max();
+    max_ = 0;
+    sum_ = 0.;
+    sum_squared_ = 0.;
+}
+
+uint64_t
+LatencyHistogram::getMin() const {
+    return (count_ > 0 ? min_ : 0);
+}
+
+double
+LatencyHistogram::getMean() const {
+    return (count_ > 0 ? sum_ / count_ : 0.);
+}
+
+double
+LatencyHistogram::getStdDev() const {
+    if (count_ == 0) {
+        return (0.);
+    }
+    const double mean = getMean();
+    // Rounding errors may produce a tiny negative variance.
+    return (sqrt(std::max(0., sum_squared_ / count_ - mean * mean)));
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    if ((percentile < 0.) || (percentile > 100.)) {
+        isc_throw(BadValue, "invalid percentile " << percentile
+                  << ", expected value between 0 and 100");
+    }
+    if (count_ == 0) {
+        return (0);
+    }
+    // Rank of the value at the percentile, counting from 1.
+    uint64_t rank = static_cast<uint64_t>(ceil(percentile / 100. * count_));
+    rank = std::max(rank, static_cast<uint64_t>(1));
+    uint64_t seen = 0;
+    for (size_t index = 0; index < counts_.size(); ++index) {
+        seen += counts_[index];
+        if (seen >= rank) {
+            return (std::max(min_, std::min(getBucketHighest(index), max_)));
+        }
+    }
+    return (max_);
+}
+
+size_t
+LatencyHistogram::getBucketIndex(const uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return (value);
+    }
+    // Position of the most significant bit.
+    unsigned msb = SUB_BUCKET_BITS;
+    while ((msb < 63) && ((value >> (msb + 1)) != 0)) {
+        ++msb;
+    }
+    // Drop the bits below the sub-bucket resolution: the remaining
+    // value is between SUB_BUCKET_COUNT / 2 and SUB_BUCKET_COUNT - 1.
+    const unsigned shift = msb - (SUB_BUCKET_BITS - 1);
+    return (SUB_BUCKET_COUNT + (shift - 1) * HALF_SUB_BUCKET_COUNT +
+            ((value >> shift) - HALF_SUB_BUCKET_COUNT));
+}
+
+uint64_t
+LatencyHistogram::getBucketHighest(const size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return (index);
+    }
+    const unsigned shift = (index - SUB_BUCKET_COUNT) / HALF_SUB_BUCKET_COUNT + 1;
+    const uint64_t sub_bucket = (index - SUB_BUCKET_COUNT) % HALF_SUB_BUCKET_COUNT +
+        HALF_SUB_BUCKET_COUNT;
+    return ((sub_bucket << shift) + ((static_cast<uint64_t>(1) << shift) - 1));
+}
+
+} // namespace perfdhcp
+} // namespace isc
@@ -0,0 +1,121 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Histogram of round trip times.
+///
+/// The minimum, maximum and average round trip times hide the tail
+/// latency, which is what matters when the server is loaded. This class
+/// records the distribution of the round trip times so as percentiles
+/// can be reported.
+///
+/// The values, in microseconds, are recorded in log-linear buckets, as
+/// in the HDR histograms: the values lower than \ref SUB_BUCKET_COUNT
+/// have their own bucket and each power of 2 above is divided in
+/// \ref SUB_BUCKET_COUNT / 2 buckets of equal width. The relative error
+/// of the reported percentiles is therefore lower than 1% whatever the
+/// magnitude of the values, while recording a value is O(1) and the
+/// memory used only grows with the logarithm of the highest value.
+///
+/// The count, minimum, maximum, mean and standard deviation are computed
+/// from the exact values.
+class LatencyHistogram {
+public:
+
+    /// \brief Number of bits used to select a bucket within a power of 2.
+    static const unsigned SUB_BUCKET_BITS = 8;
+
+    /// \brief Number of buckets holding the lowest values.
+    static const uint64_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+
+    /// \brief Constructor.
+    LatencyHistogram();
+
+    /// \brief Records a value.
+    ///
+    /// \param value value to be recorded in microseconds.
+    void record(const uint64_t value);
+
+    /// \brief Removes all recorded values.
+    void reset();
+
+    /// \brief Returns the number of recorded values.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// \brief Returns the lowest recorded value or 0 if none was recorded.
+    uint64_t getMin() const;
+
+    /// \brief Returns the highest recorded value or 0 if none was recorded.
+    uint64_t getMax() const {
+        return (max_);
+    }
+
+    /// \brief Returns the mean of the recorded values or 0 if none was
+    /// recorded.
+    double getMean() const;
+
+    /// \brief Returns the standard deviation of the recorded values or 0
+    /// if none was recorded.
+    double getStdDev() const;
+
+    /// \brief Returns the value at the specified percentile.
+    ///
+    /// The returned value is the highest value equivalent to the recorded
+    /// values in the bucket holding the percentile, but never greater than
+    /// the highest recorded value.
+    ///
+    /// \param percentile percentile, between 0 and 100.
+    /// \throw isc::BadValue if the percentile is out of range.
+    /// \return value at the percentile or 0 if no value was recorded.
+    uint64_t getPercentile(const double percentile) const;
+
+    /// \brief Returns the index of the bucket holding the value.
+    ///
+    /// \param value recorded value.
+    static size_t getBucketIndex(const uint64_t value);
+
+    /// \brief Returns the highest value held by the bucket.
+    ///
+    /// \param index bucket index.
+    static uint64_t getBucketHighest(const size_t index);
+
+private:
+
+    /// \brief Number of values recorded in each bucket.
+    ///
+    /// It is grown on demand up to the bucket of the highest value.
+    std::vector<uint64_t> counts_;
+
+    /// \brief Number of recorded values.
+    uint64_t count_;
+
+    /// \brief Lowest recorded value.
+    uint64_t min_;
+
+    /// \brief Highest recorded value.
+    uint64_t max_;
+
+    /// \brief Sum of the recorded values.
+    double sum_;
+
+    /// \brief Sum of the squares of the recorded values.
+    double sum_squared_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // LATENCY_HISTOGRAM_H
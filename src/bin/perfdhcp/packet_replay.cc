@@ -0,0 +1,250 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/duid.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <exceptions/exceptions.h>
+#include "packet_replay.h"
+
+#include <algorithm>
+
+using namespace boost::posix_time;
+using namespace isc::dhcp;
+
+namespace {
+
+/// \brief Multiplier used to shift the transaction ids between iterations.
+///
+/// This is the golden ratio scaled to 32 bits, which spreads the
+/// transaction ids of consecutive iterations over the whole range.
+const uint32_t TRANSID_MULTIPLIER = 0x9e3779b9;
+
+/// \brief Mixes the iteration number into an identifier.
+///
+/// The iteration is mixed into three bytes starting at the specified
+/// offset. The two lowest bits of the first byte are kept so the
+/// multicast and locally administered bits of a MAC address are
+/// preserved. If the identifier is too short the last bytes are used.
+///
+/// \param id identifier.
+/// \param offset offset of the bytes to rewrite.
+/// \param iteration iteration number.
+void
+mixIteration(std::vector<uint8_t>& id, size_t offset,
+             const uint32_t iteration) {
+    if (id.size() < offset + 3) {
+        offset = (id.size() >= 3 ? id.size() - 3 : 0);
+    }
+    const uint8_t mix[3] = {
+        static_cast<uint8_t>((iteration << 2) & 0xfc),
+        static_cast<uint8_t>((iteration >> 6) & 0xff),
+        static_cast<uint8_t>((iteration >> 14) & 0xff)
+    };
+    for (size_t i = 0; (i < 3) && (offset + i < id.size()); ++i) {
+        id[offset + i] ^= mix[i];
+    }
+}
+
+/// \brief Returns the offset of the variable part of a DUID.
+///
+/// The variable part follows the DUID type, the hardware type and the
+/// time or the enterprise number.
+///
+/// \param duid DUID in the wire format.
+size_t
+getDUIDVariableOffset(const std::vector<uint8_t>& duid) {
+    if (duid.size() < 2) {
+        return (0);
+    }
+    switch ((static_cast<uint16_t>(duid[0]) << 8) | duid[1]) {
+    case DUID::DUID_LLT:
+        return (8);
+    case DUID::DUID_EN:
+        return (6);
+    case DUID::DUID_LL:
+        return (4);
+    default:
+        return (2);
+    }
+}
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+PacketReplay::PacketReplay(const PcapFile::RecordCollection& records,
+                           const uint8_t ip_version, const double speed,
+                           const uint32_t iterations)
+    : records_(), ip_version_(ip_version), speed_(speed),
+      iterations_(iterations), period_(0), skipped_num_(0),
+      start_time_(microsec_clock::universal_time()), index_(0),
+      last_send_time_(start_time_) {
+    if ((ip_version_ != 4) && (ip_version_ != 6)) {
+        isc_throw(BadValue, "invalid IP version "
+                  << static_cast<int>(ip_version_));
+    }
+    if (speed_ < 0.) {
+        isc_throw(BadValue, "invalid replay speed " << speed_);
+    }
+
+    // Parse each message once so the malformed ones are not replayed.
+    for (PcapFile::RecordCollection::const_iterator record = records.begin();
+         record != records.end(); ++record) {
+        try {
+            parse(record->data_);
+        } catch (const isc::Exception&) {
+            ++skipped_num_;
+            continue;
+        }
+        records_.push_back(*record);
+    }
+    if (records_.empty()) {
+        isc_throw(BadValue, "none of the " << records.size()
+                  << " captured messages can be parsed");
+    }
+
+    // The capture is looped: the next iteration starts after a gap equal
+    // to the average interval between two messages.
+    const int64_t duration =
+        (records_.back().offset_ - records_.front().offset_).total_microseconds();
+    if (records_.size() > 1) {
+        period_ = duration + duration / (records_.size() - 1);
+    } else {
+        period_ = 1000000;
+    }
+    period_ = std::max(period_, static_cast<int64_t>(1));
+}
+
+void
+PacketReplay::start(const ptime& start) {
+    start_time_ = start;
+    last_send_time_ = start;
+    index_ = 0;
+}
+
+bool
+PacketReplay::isDone() const {
+    return ((iterations_ > 0) &&
+            (index_ >= static_cast<uint64_t>(iterations_) * records_.size()));
+}
+
+ptime
+PacketReplay::getDue() const {
+    if (!isTimed()) {
+        isc_throw(InvalidOperation, "the replay is not timed");
+    }
+    if (isDone()) {
+        isc_throw(InvalidOperation, "all captured messages have been"
+                  " replayed");
+    }
+    return (getDue(index_));
+}
+
+ptime
+PacketReplay::getDue(const uint64_t index) const {
+    const uint64_t iteration = index / records_.size();
+    const time_duration offset = records_[index % records_.size()].offset_ -
+        records_.front().offset_;
+    const double elapsed = (iteration * period_ + offset.total_microseconds()) /
+        speed_;
+    return (start_time_ + microseconds(static_cast<int64_t>(elapsed)));
+}
+
+uint64_t
+PacketReplay::getDueCount(const ptime& now) const {
+    if (!isTimed()) {
+        return (0);
+    }
+    uint64_t count = 0;
+    for (uint64_t index = index_; ; ++index) {
+        if ((iterations_ > 0) &&
+            (index >= static_cast<uint64_t>(iterations_) * records_.size())) {
+            break;
+        }
+        if (getDue(index) > now) {
+            break;
+        }
+        ++count;
+    }
+    return (count);
+}
+
+uint32_t
+PacketReplay::getIteration() const {
+    return (static_cast<uint32_t>(index_ / records_.size()));
+}
+
+PktPtr
+PacketReplay::next() {
+    if (isDone()) {
+        isc_throw(InvalidOperation, "all captured messages have been"
+                  " replayed");
+    }
+    const uint32_t iteration = getIteration();
+    PktPtr pkt = parse(records_[index_ % records_.size()].data_);
+    ++index_;
+    last_send_time_ = microsec_clock::universal_time();
+
+    // The first iteration replays the messages as they were captured.
+    if (iteration == 0) {
+        return (pkt);
+    }
+
+    const uint32_t transid = pkt->getTransid() + iteration * TRANSID_MULTIPLIER;
+    if (ip_version_ == 4) {
+        Pkt4Ptr pkt4 = boost::static_pointer_cast<Pkt4>(pkt);
+        pkt4->setTransid(transid);
+        HWAddrPtr hwaddr = pkt4->getHWAddr();
+        if (hwaddr && !hwaddr->hwaddr_.empty()) {
+            std::vector<uint8_t> mac = hwaddr->hwaddr_;
+            mixIteration(mac, 0, iteration);
+            pkt4->setHWAddr(hwaddr->htype_, mac.size(), mac);
+        }
+        OptionPtr client_id = pkt4->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+        if (client_id && !client_id->getData().empty()) {
+            std::vector<uint8_t> id = client_id->getData();
+            // RFC 4361 client identifiers hold a DUID after the type
+            // and the IAID, others usually hold the MAC address after
+            // the hardware type.
+            if ((id[0] == 0xff) && (id.size() > 5)) {
+                std::vector<uint8_t> duid(id.begin() + 5, id.end());
+                mixIteration(id, 5 + getDUIDVariableOffset(duid), iteration);
+            } else {
+                mixIteration(id, 1, iteration);
+            }
+            client_id->setData(id.begin(), id.end());
+        }
+
+    } else {
+        pkt->setTransid(transid & 0xffffff);
+        OptionPtr client_id = pkt->getOption(D6O_CLIENTID);
+        if (client_id && !client_id->getData().empty()) {
+            std::vector<uint8_t> duid = client_id->getData();
+            mixIteration(duid, getDUIDVariableOffset(duid), iteration);
+            client_id->setData(duid.begin(), duid.end());
+        }
+    }
+    return (pkt);
+}
+
+PktPtr
+PacketReplay::parse(const std::vector<uint8_t>& data) const {
+    PktPtr pkt;
+    if (ip_version_ == 4) {
+        pkt.reset(new Pkt4(&data[0], data.size()));
+    } else {
+        pkt.reset(new Pkt6(&data[0], data.size()));
+    }
+    pkt->unpack();
+    return (pkt);
+}
+
+} // namespace perfdhcp
+} // namespace isc
@@ -0,0 +1,164 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PACKET_REPLAY_H
+#define PACKET_REPLAY_H
+
+#include <dhcp/pkt.h>
+#include "pcap_file.h"
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <stdint.h>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Replays captured DHCP messages.
+///
+/// This class provides the messages read from a capture file with
+/// \ref PcapFile, in the capture order, and schedules them. The capture
+/// is replayed repeatedly, each replay being an iteration. In order to
+/// avoid collisions between the iterations, the following fields are
+/// rewritten in every iteration but the first one:
+/// - the transaction id, which is shifted by a value depending on the
+/// iteration,
+/// - the hardware address (DHCPv4 chaddr), the client identifier
+/// (DHCPv4 option 61) and the DUID (DHCPv6 client identifier option),
+/// in which the iteration number is mixed into three bytes: the first
+/// three bytes of the MAC addresses, keeping their multicast and locally
+/// administered bits, or the first bytes of the identifiers which follow
+/// the DUID type, hardware type and time or enterprise number.
+///
+/// The relay agent options, e.g. the DHCPv4 option 82, are not rewritten.
+///
+/// If the replay is timed, the messages are due at the time they were
+/// captured, relative to the start of the replay, divided by the speed
+/// factor. Each iteration starts after the previous one, as if the
+/// capture was looped. If the replay is not timed, the messages are sent
+/// at the pace chosen by the caller.
+class PacketReplay : public boost::noncopyable {
+public:
+
+    /// \brief Constructor.
+    ///
+    /// The messages which can't be parsed are skipped.
+    ///
+    /// \param records captured messages.
+    /// \param ip_version IP version of the messages (4 or 6).
+    /// \param speed speed factor applied to the capture timing or 0 if
+    /// the replay is not timed.
+    /// \param iterations number of times the capture is replayed or 0
+    /// if it is replayed until the test is stopped.
+    /// \throw isc::BadValue if the IP version or the speed are invalid
+    /// or if no message can be parsed.
+    PacketReplay(const PcapFile::RecordCollection& records,
+                 const uint8_t ip_version, const double speed,
+                 const uint32_t iterations);
+
+    /// \brief Sets the start time of the replay.
+    ///
+    /// The constructor sets the start time to the current time.
+    ///
+    /// \param start start time.
+    void start(const boost::posix_time::ptime& start);
+
+    /// \brief Checks if the messages are sent at the capture timing.
+    bool isTimed() const {
+        return (speed_ > 0.);
+    }
+
+    /// \brief Checks if all iterations have been replayed.
+    bool isDone() const;
+
+    /// \brief Returns the time the next message is due.
+    ///
+    /// \throw isc::InvalidOperation if all iterations have been replayed
+    /// or the replay is not timed.
+    boost::posix_time::ptime getDue() const;
+
+    /// \brief Returns the number of messages due.
+    ///
+    /// \param now current time.
+    /// \return number of messages due at the specified time, or 0 if the
+    /// replay is not timed.
+    uint64_t getDueCount(const boost::posix_time::ptime& now) const;
+
+    /// \brief Returns the next message.
+    ///
+    /// The message is parsed and its transaction id and client identifiers
+    /// are rewritten for the current iteration. It must be packed before
+    /// it is sent.
+    ///
+    /// \throw isc::InvalidOperation if all iterations have been replayed.
+    /// \return next message, i.e. a Pkt4 or Pkt6 object.
+    dhcp::PktPtr next();
+
+    /// \brief Returns the number of messages in the capture.
+    size_t getMessagesNum() const {
+        return (records_.size());
+    }
+
+    /// \brief Returns the number of captured messages which couldn't be
+    /// parsed.
+    size_t getSkippedNum() const {
+        return (skipped_num_);
+    }
+
+    /// \brief Returns the current iteration, counting from 0.
+    uint32_t getIteration() const;
+
+    /// \brief Returns the time the last message was returned by \ref next.
+    boost::posix_time::ptime getLastSendTime() const {
+        return (last_send_time_);
+    }
+
+private:
+
+    /// \brief Returns the time the specified message is due.
+    ///
+    /// \param index index of the message since the start of the replay.
+    boost::posix_time::ptime getDue(const uint64_t index) const;
+
+    /// \brief Parses a captured message.
+    ///
+    /// \param data message in the wire format.
+    /// \return parsed message.
+    dhcp::PktPtr parse(const std::vector<uint8_t>& data) const;
+
+    /// \brief Captured messages which can be parsed.
+    PcapFile::RecordCollection records_;
+
+    /// \brief IP version of the messages.
+    uint8_t ip_version_;
+
+    /// \brief Speed factor applied to the capture timing.
+    double speed_;
+
+    /// \brief Number of times the capture is replayed, 0 if unlimited.
+    uint32_t iterations_;
+
+    /// \brief Time between the start of two iterations, in microseconds.
+    int64_t period_;
+
+    /// \brief Number of captured messages which couldn't be parsed.
+    size_t skipped_num_;
+
+    /// \brief Start time of the replay.
+    boost::posix_time::ptime start_time_;
+
+    /// \brief Index of the next message since the start of the replay.
+    uint64_t index_;
+
+    /// \brief Time the last message was returned.
+    boost::posix_time::ptime last_send_time_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // PACKET_REPLAY_H
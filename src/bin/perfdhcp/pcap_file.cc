@@ -0,0 +1,326 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/pkt4.h>
+#include <exceptions/exceptions.h>
+#include <util/io_utilities.h>
+#include "pcap_file.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include <netinet/in.h>
+
+using namespace boost::posix_time;
+using namespace isc::dhcp;
+using namespace isc::util;
+
+namespace {
+
+/// \brief Magic number of pcap files with microsecond timestamps.
+const uint32_t PCAP_MAGIC_USEC = 0xa1b2c3d4;
+
+/// \brief Magic number of pcap files with nanosecond timestamps.
+const uint32_t PCAP_MAGIC_NSEC = 0xa1b23c4d;
+
+/// \brief Magic number of pcapng files (section header block type).
+const uint32_t PCAPNG_MAGIC = 0x0a0d0d0a;
+
+/// \brief Length of the pcap file header.
+const size_t PCAP_FILE_HEADER_LEN = 24;
+
+/// \brief Length of the pcap record header.
+const size_t PCAP_RECORD_HEADER_LEN = 16;
+
+/// \name Supported link types.
+//@{
+const uint32_t LINKTYPE_NULL = 0;
+const uint32_t LINKTYPE_ETHERNET = 1;
+const uint32_t LINKTYPE_RAW = 101;
+const uint32_t LINKTYPE_LINUX_SLL = 113;
+const uint32_t LINKTYPE_IPV4 = 228;
+const uint32_t LINKTYPE_IPV6 = 229;
+//@}
+
+/// \name Ethernet types.
+//@{
+const uint16_t ETHERTYPE_IPV4 = 0x0800;
+const uint16_t ETHERTYPE_IPV6 = 0x86dd;
+const uint16_t ETHERTYPE_VLAN = 0x8100;
+const uint16_t ETHERTYPE_QINQ = 0x88a8;
+//@}
+
+/// \brief Reads a 32-bit field of the pcap headers.
+///
+/// The byte order of the pcap headers is the one of the capturing host.
+///
+/// \param buf buffer holding the field.
+/// \param big_endian true if the file was written by a big endian host.
+uint32_t
+readPcapUint32(const uint8_t* buf, const bool big_endian) {
+    if (big_endian) {
+        return (readUint32(buf, sizeof(uint32_t)));
+    }
+    return ((static_cast<uint32_t>(buf[3]) << 24) |
+            (static_cast<uint32_t>(buf[2]) << 16) |
+            (static_cast<uint32_t>(buf[1]) << 8) |
+            static_cast<uint32_t>(buf[0]));
+}
+
+/// \brief Checks if the DHCPv6 message is sent by a client or a relay.
+///
+/// \param msg_type DHCPv6 message type.
+bool
+isClientMessage6(const uint8_t msg_type) {
+    switch (msg_type) {
+    case DHCPV6_SOLICIT:
+    case DHCPV6_REQUEST:
+    case DHCPV6_CONFIRM:
+    case DHCPV6_RENEW:
+    case DHCPV6_REBIND:
+    case DHCPV6_RELEASE:
+    case DHCPV6_DECLINE:
+    case DHCPV6_INFORMATION_REQUEST:
+    case DHCPV6_RELAY_FORW:
+    case DHCPV6_DHCPV4_QUERY:
+        return (true);
+    default:
+        return (false);
+    }
+}
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+PcapFile::PcapFile(const std::string& file_name, const uint8_t ip_version)
+    : ip_version_(ip_version), link_type_(LINKTYPE_ETHERNET), records_(),
+      skipped_num_(0) {
+    if ((ip_version_ != 4) && (ip_version_ != 6)) {
+        isc_throw(BadValue, "invalid IP version "
+                  << static_cast<int>(ip_version_));
+    }
+
+    std::ifstream file(file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        isc_throw(BadValue, "unable to open capture file " << file_name);
+    }
+    std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+    file.close();
+
+    if (contents.size() < PCAP_FILE_HEADER_LEN) {
+        isc_throw(BadValue, file_name << " is not a pcap file");
+    }
+    // The magic number tells the byte order of the headers and the
+    // resolution of the timestamps.
+    uint32_t magic = readPcapUint32(&contents[0], false);
+    if (magic == PCAPNG_MAGIC) {
+        isc_throw(BadValue, file_name << " is a pcapng file, which is not"
+                  " supported: convert it with 'editcap -F pcap'");
+    }
+    bool big_endian = false;
+    if ((magic != PCAP_MAGIC_USEC) && (magic != PCAP_MAGIC_NSEC)) {
+        big_endian = true;
+        magic = readPcapUint32(&contents[0], true);
+        if ((magic != PCAP_MAGIC_USEC) && (magic != PCAP_MAGIC_NSEC)) {
+            isc_throw(BadValue, file_name << " is not a pcap file");
+        }
+    }
+    const bool nsec = (magic == PCAP_MAGIC_NSEC);
+
+    link_type_ = readPcapUint32(&contents[20], big_endian);
+    switch (link_type_) {
+    case LINKTYPE_NULL:
+    case LINKTYPE_ETHERNET:
+    case LINKTYPE_RAW:
+    case LINKTYPE_LINUX_SLL:
+    case LINKTYPE_IPV4:
+    case LINKTYPE_IPV6:
+        break;
+    default:
+        isc_throw(BadValue, "unsupported link type " << link_type_
+                  << " in capture file " << file_name);
+    }
+
+    time_duration first_time;
+    size_t pos = PCAP_FILE_HEADER_LEN;
+    while (pos + PCAP_RECORD_HEADER_LEN <= contents.size()) {
+        const uint8_t* header = &contents[pos];
+        const uint32_t ts_sec = readPcapUint32(header, big_endian);
+        const uint32_t ts_frac = readPcapUint32(header + 4, big_endian);
+        const uint32_t captured_len = readPcapUint32(header + 8, big_endian);
+        pos += PCAP_RECORD_HEADER_LEN;
+        // The last record may be truncated if the capture was interrupted.
+        if (captured_len > contents.size() - pos) {
+            ++skipped_num_;
+            break;
+        }
+
+        Record record;
+        if ((captured_len == 0) ||
+            !extractMessage(&contents[pos], captured_len, record.data_)) {
+            ++skipped_num_;
+            pos += captured_len;
+            continue;
+        }
+        pos += captured_len;
+
+        const time_duration timestamp = seconds(ts_sec) +
+            microseconds(nsec ? ts_frac / 1000 : ts_frac);
+        if (records_.empty()) {
+            first_time = timestamp;
+        }
+        record.offset_ = timestamp - first_time;
+        // The frames may be slightly out of order when captured on several
+        // interfaces: never go back in time.
+        if (!records_.empty() && (record.offset_ < records_.back().offset_)) {
+            record.offset_ = records_.back().offset_;
+        }
+        records_.push_back(record);
+    }
+
+    if (records_.empty()) {
+        isc_throw(OutOfRange, "no DHCPv" << static_cast<int>(ip_version_)
+                  << " message sent to a server found in capture file "
+                  << file_name);
+    }
+}
+
+time_duration
+PcapFile::getDuration() const {
+    if (records_.empty()) {
+        return (time_duration(0, 0, 0));
+    }
+    return (records_.back().offset_);
+}
+
+bool
+PcapFile::extractMessage(const uint8_t* frame, size_t length,
+                         std::vector<uint8_t>& data) const {
+    switch (link_type_) {
+    case LINKTYPE_NULL:
+        // The address family is in the byte order of the capturing host:
+        // the IP version is checked instead.
+        if (length < 4) {
+            return (false);
+        }
+        return (extractFromIP(frame + 4, length - 4, data));
+
+    case LINKTYPE_ETHERNET:
+    {
+        size_t offset = 14;
+        if (length < offset) {
+            return (false);
+        }
+        uint16_t ether_type = readUint16(frame + 12, 2);
+        while ((ether_type == ETHERTYPE_VLAN) ||
+               (ether_type == ETHERTYPE_QINQ)) {
+            if (length < offset + 4) {
+                return (false);
+            }
+            ether_type = readUint16(frame + offset + 2, 2);
+            offset += 4;
+        }
+        if ((ether_type != ETHERTYPE_IPV4) && (ether_type != ETHERTYPE_IPV6)) {
+            return (false);
+        }
+        return (extractFromIP(frame + offset, length - offset, data));
+    }
+
+    case LINKTYPE_LINUX_SLL:
+        if (length < 16) {
+            return (false);
+        }
+        return (extractFromIP(frame + 16, length - 16, data));
+
+    default:
+        return (extractFromIP(frame, length, data));
+    }
+}
+
+bool
+PcapFile::extractFromIP(const uint8_t* packet, size_t length,
+                        std::vector<uint8_t>& data) const {
+    if ((length == 0) || ((packet[0] >> 4) != ip_version_)) {
+        return (false);
+    }
+
+    if (ip_version_ == 4) {
+        const size_t header_len = (packet[0] & 0x0f) * 4;
+        if ((header_len < 20) || (length < header_len)) {
+            return (false);
+        }
+        // Skip fragments: the More Fragments flag or an offset is set.
+        if ((readUint16(packet + 6, 2) & 0x3fff) != 0) {
+            return (false);
+        }
+        if (packet[9] != IPPROTO_UDP) {
+            return (false);
+        }
+        // Ignore the Ethernet padding.
+        length = std::min(length, static_cast<size_t>(readUint16(packet + 2, 2)));
+        if (length < header_len) {
+            return (false);
+        }
+        return (extractFromUDP(packet + header_len, length - header_len, data));
+    }
+
+    if (length < 40) {
+        return (false);
+    }
+    length = std::min(length, 40 + static_cast<size_t>(readUint16(packet + 4, 2)));
+    uint8_t next_header = packet[6];
+    size_t offset = 40;
+    // Skip the Hop-by-Hop, Routing and Destination Options headers.
+    while ((next_header == 0) || (next_header == 43) || (next_header == 60)) {
+        if (length < offset + 2) {
+            return (false);
+        }
+        next_header = packet[offset];
+        offset += (packet[offset + 1] + 1) * 8;
+    }
+    if ((next_header != IPPROTO_UDP) || (length < offset)) {
+        return (false);
+    }
+    return (extractFromUDP(packet + offset, length - offset, data));
+}
+
+bool
+PcapFile::extractFromUDP(const uint8_t* datagram, size_t length,
+                         std::vector<uint8_t>& data) const {
+    if (length < 8) {
+        return (false);
+    }
+    const uint16_t dst_port = readUint16(datagram + 2, 2);
+    const size_t udp_len = readUint16(datagram + 4, 2);
+    // Skip truncated datagrams.
+    if ((udp_len < 8) || (udp_len > length)) {
+        return (false);
+    }
+    const uint8_t* payload = datagram + 8;
+    const size_t payload_len = udp_len - 8;
+
+    if (ip_version_ == 4) {
+        if ((dst_port != DHCP4_SERVER_PORT) ||
+            (payload_len < Pkt4::DHCPV4_PKT_HDR_LEN) ||
+            (payload[0] != BOOTREQUEST)) {
+            return (false);
+        }
+    } else if ((dst_port != DHCP6_SERVER_PORT) || (payload_len < 4) ||
+               !isClientMessage6(payload[0])) {
+        return (false);
+    }
+    data.assign(payload, payload + payload_len);
+    return (true);
+}
+
+} // namespace perfdhcp
+} // namespace isc
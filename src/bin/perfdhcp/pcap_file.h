@@ -0,0 +1,126 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PCAP_FILE_H
+#define PCAP_FILE_H
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Reads DHCP client messages from a pcap file.
+///
+/// This class extracts the DHCP messages sent by clients or relays to
+/// the server from a capture file in the classic pcap format, as written
+/// by tcpdump or wireshark. The messages are then replayed by perfdhcp
+/// to benchmark the server with a realistic traffic mix.
+///
+/// The following link types are supported: Ethernet (with or without
+/// 802.1Q tags), Linux cooked capture, BSD loopback and raw IP. IP
+/// fragments are skipped. For DHCPv4, the BOOTREQUEST messages sent to
+/// port 67 are extracted. For DHCPv6, the Solicit, Request, Confirm, Renew,
+/// Rebind, Release, Decline, Information-request, Relay-forward and
+/// DHCPv4-query messages sent to port 547 are extracted.
+///
+/// The pcapng format is not supported: such files may be converted with
+/// "editcap -F pcap".
+class PcapFile {
+public:
+
+    /// \brief A DHCP message read from the capture.
+    struct Record {
+        /// \brief Time elapsed since the first extracted message.
+        boost::posix_time::time_duration offset_;
+
+        /// \brief DHCP message in the wire format, starting at the UDP
+        /// payload.
+        std::vector<uint8_t> data_;
+    };
+
+    /// \brief Collection of records.
+    typedef std::vector<Record> RecordCollection;
+
+    /// \brief Constructor.
+    ///
+    /// Reads the whole capture file.
+    ///
+    /// \param file_name name of the capture file.
+    /// \param ip_version IP version of the messages to extract (4 or 6).
+    /// \throw isc::BadValue if the file can't be opened, is not a pcap
+    /// file or uses an unsupported link type or if the IP version is
+    /// invalid.
+    /// \throw isc::OutOfRange if the file contains no DHCP message.
+    PcapFile(const std::string& file_name, const uint8_t ip_version);
+
+    /// \brief Returns the extracted messages in the capture order.
+    const RecordCollection& getRecords() const {
+        return (records_);
+    }
+
+    /// \brief Returns the time elapsed between the first and the last
+    /// extracted messages.
+    boost::posix_time::time_duration getDuration() const;
+
+    /// \brief Returns the number of skipped frames.
+    ///
+    /// Frames are skipped when they don't hold a DHCP message sent to the
+    /// server, are truncated or are IP fragments.
+    size_t getSkippedNum() const {
+        return (skipped_num_);
+    }
+
+private:
+
+    /// \brief Extracts the DHCP message from a captured frame.
+    ///
+    /// \param frame captured frame.
+    /// \param length captured length of the frame.
+    /// \param [out] data DHCP message.
+    /// \return true if the frame holds a DHCP message sent to the server.
+    bool extractMessage(const uint8_t* frame, size_t length,
+                        std::vector<uint8_t>& data) const;
+
+    /// \brief Extracts the DHCP message from an IP packet.
+    ///
+    /// \param packet IP packet.
+    /// \param length length of the IP packet.
+    /// \param [out] data DHCP message.
+    /// \return true if the packet holds a DHCP message sent to the server.
+    bool extractFromIP(const uint8_t* packet, size_t length,
+                       std::vector<uint8_t>& data) const;
+
+    /// \brief Extracts the DHCP message from an UDP datagram.
+    ///
+    /// \param datagram UDP datagram.
+    /// \param length length of the UDP datagram.
+    /// \param [out] data DHCP message.
+    /// \return true if the datagram holds a DHCP message sent to the
+    /// server.
+    bool extractFromUDP(const uint8_t* datagram, size_t length,
+                        std::vector<uint8_t>& data) const;
+
+    /// \brief IP version of the messages to extract.
+    uint8_t ip_version_;
+
+    /// \brief Link type of the capture.
+    uint32_t link_type_;
+
+    /// \brief Extracted messages.
+    RecordCollection records_;
+
+    /// \brief Number of skipped frames.
+    size_t skipped_num_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // PCAP_FILE_H
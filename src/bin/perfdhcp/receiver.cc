@@ -0,0 +1,177 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/iface_mgr.h>
+#include <exceptions/exceptions.h>
+#include "receiver.h"
+
+#include <boost/bind.hpp>
+
+#include <iostream>
+#include <sys/select.h>
+
+using namespace isc::dhcp;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace perfdhcp {
+
+Receiver::Receiver(const uint8_t ip_version,
+                   const MatchCallback& match_callback,
+                   const size_t batch_size)
+    : ip_version_(ip_version), match_callback_(match_callback),
+      batch_size_(batch_size), thread_(), mutex_(), stopping_(false),
+      responses_(), received_num_(0), watch_socket_() {
+    if ((ip_version_ != 4) && (ip_version_ != 6)) {
+        isc_throw(BadValue, "invalid IP version "
+                  << static_cast<int>(ip_version_));
+    }
+    if (batch_size_ == 0) {
+        isc_throw(BadValue, "the batch size must be greater than 0");
+    }
+    if (!match_callback_) {
+        isc_throw(BadValue, "the match callback must not be empty");
+    }
+}
+
+Receiver::~Receiver() {
+    try {
+        stop();
+    } catch (...) {
+        // Destructors must not throw.
+    }
+}
+
+void
+Receiver::start() {
+    if (thread_) {
+        isc_throw(InvalidOperation, "the receiver thread is already running");
+    }
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = false;
+    }
+    thread_.reset(new Thread(boost::bind(&Receiver::run, this)));
+}
+
+void
+Receiver::stop() {
+    if (!thread_) {
+        return;
+    }
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = true;
+    }
+    thread_->wait();
+    thread_.reset();
+}
+
+bool
+Receiver::isRunning() const {
+    return (static_cast<bool>(thread_));
+}
+
+bool
+Receiver::isStopping() const {
+    Mutex::Locker lock(mutex_);
+    return (stopping_);
+}
+
+bool
+Receiver::waitForResponses(const uint32_t timeout) {
+    if (!watch_socket_.isReady() && (timeout > 0)) {
+        const int fd = watch_socket_.getSelectFd();
+        fd_set sockets;
+        FD_ZERO(&sockets);
+        FD_SET(fd, &sockets);
+        struct timeval select_timeout;
+        select_timeout.tv_sec = timeout / 1000000;
+        select_timeout.tv_usec = timeout % 1000000;
+        // An interrupted wait is not an error: the caller checks the
+        // queue and its exit conditions anyway.
+        select(fd + 1, &sockets, NULL, NULL, &select_timeout);
+    }
+    Mutex::Locker lock(mutex_);
+    return (!responses_.empty());
+}
+
+size_t
+Receiver::getResponses(ResponseList& responses) {
+    // Clear the watch socket before taking the responses: a batch queued
+    // in between marks it ready again and is taken on the next call.
+    watch_socket_.clearReady();
+    Mutex::Locker lock(mutex_);
+    const size_t responses_num = responses_.size();
+    responses.splice(responses.end(), responses_);
+    return (responses_num);
+}
+
+uint64_t
+Receiver::getReceivedNum() const {
+    Mutex::Locker lock(mutex_);
+    return (received_num_);
+}
+
+PktPtr
+Receiver::receivePacket(const uint32_t timeout) {
+    PktPtr pkt;
+    try {
+        if (ip_version_ == 4) {
+            pkt = IfaceMgr::instance().receive4(timeout / 1000000,
+                                                timeout % 1000000);
+        } else {
+            pkt = IfaceMgr::instance().receive6(timeout / 1000000,
+                                                timeout % 1000000);
+        }
+        if (pkt) {
+            pkt->unpack();
+        }
+    } catch (const Exception& e) {
+        std::cerr << "Failed to receive DHCPv" << static_cast<int>(ip_version_)
+                  << " packet: " << e.what() << std::endl;
+        pkt.reset();
+    }
+    return (pkt);
+}
+
+void
+Receiver::run() {
+    while (!isStopping()) {
+        // Block until the first packet arrives, then take all packets
+        // already available on the socket, up to the batch size.
+        PktPtr pkt = receivePacket(POLL_TIMEOUT);
+        if (!pkt) {
+            continue;
+        }
+        ResponseList batch;
+        size_t received = 0;
+        do {
+            ++received;
+            PktPtr sent;
+            try {
+                if (match_callback_(pkt, sent)) {
+                    batch.push_back(Response(pkt, sent));
+                }
+            } catch (const Exception& e) {
+                std::cerr << "Failed to process received packet: "
+                          << e.what() << std::endl;
+            }
+        } while ((received < batch_size_) && (pkt = receivePacket(0)));
+
+        Mutex::Locker lock(mutex_);
+        received_num_ += received;
+        if (!batch.empty()) {
+            responses_.splice(responses_.end(), batch);
+            watch_socket_.markReady();
+        }
+    }
+}
+
+} // namespace perfdhcp
+} // namespace isc
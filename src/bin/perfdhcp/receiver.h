@@ -0,0 +1,170 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PERFDHCP_RECEIVER_H
+#define PERFDHCP_RECEIVER_H
+
+#include <dhcp/pkt.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <list>
+#include <stdint.h>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Receives packets from the server in a separate thread.
+///
+/// In the multi-threaded mode of perfdhcp, the packets sent by the server
+/// are received by a dedicated thread, so as receiving doesn't compete
+/// with sending for the main thread's time. The receiver thread receives
+/// a packet, parses it and passes it to the match callback, which is
+/// expected to match the packet with the corresponding sent packet and
+/// to update the statistics. The callback must therefore be thread safe.
+///
+/// If the received packet requires further action from the sender, e.g.
+/// a DHCPREQUEST must be sent in response to a DHCPOFFER, the callback
+/// returns true and the packet is appended to the queue of responses
+/// which is consumed by the main thread with \ref getResponses.
+///
+/// In order to limit the synchronization overhead, the packets available
+/// on the socket are processed in batches: the queue is only locked once
+/// for all packets received in a row and the main thread takes all queued
+/// responses at once.
+class Receiver : public boost::noncopyable {
+public:
+
+    /// \brief Default maximum number of packets received in a row.
+    static const size_t DEFAULT_BATCH_SIZE = 256;
+
+    /// \brief Maximum time (in microseconds) the receiver thread waits
+    /// for a packet before checking if it should stop.
+    static const uint32_t POLL_TIMEOUT = 100000;
+
+    /// \brief A received packet requiring an action from the sender.
+    struct Response {
+        /// \brief Constructor.
+        ///
+        /// \param rcvd received packet.
+        /// \param sent sent packet matched with the received one.
+        Response(const dhcp::PktPtr& rcvd, const dhcp::PktPtr& sent)
+            : rcvd_(rcvd), sent_(sent) {
+        }
+
+        /// \brief Received packet.
+        dhcp::PktPtr rcvd_;
+
+        /// \brief Sent packet matched with the received one. It may be
+        /// null if the action doesn't require it.
+        dhcp::PktPtr sent_;
+    };
+
+    /// \brief List of responses.
+    typedef std::list<Response> ResponseList;
+
+    /// \brief Callback invoked for each received packet.
+    ///
+    /// The first argument is the received packet. The second argument
+    /// is set by the callback to the matched sent packet. The callback
+    /// returns true if the packet must be passed to the main thread.
+    typedef boost::function<bool(const dhcp::PktPtr&,
+                                 dhcp::PktPtr&)> MatchCallback;
+
+    /// \brief Constructor.
+    ///
+    /// \param ip_version IP version of the packets received (4 or 6).
+    /// \param match_callback callback invoked for each received packet.
+    /// \param batch_size maximum number of packets received in a row.
+    /// \throw isc::BadValue if the IP version or batch size are invalid.
+    Receiver(const uint8_t ip_version, const MatchCallback& match_callback,
+             const size_t batch_size = DEFAULT_BATCH_SIZE);
+
+    /// \brief Destructor.
+    ///
+    /// Stops the receiver thread if it is running.
+    ~Receiver();
+
+    /// \brief Starts the receiver thread.
+    ///
+    /// \throw isc::InvalidOperation if the thread is already running.
+    void start();
+
+    /// \brief Stops the receiver thread and waits for it to terminate.
+    ///
+    /// It may take up to \ref POLL_TIMEOUT for the thread to notice.
+    void stop();
+
+    /// \brief Checks if the receiver thread is running.
+    bool isRunning() const;
+
+    /// \brief Waits for responses to be queued.
+    ///
+    /// \param timeout maximum time to wait in microseconds.
+    /// \return true if there are responses in the queue.
+    bool waitForResponses(const uint32_t timeout);
+
+    /// \brief Moves all queued responses to the specified list.
+    ///
+    /// \param [out] responses list the responses are appended to.
+    /// \return number of responses moved.
+    size_t getResponses(ResponseList& responses);
+
+    /// \brief Returns the number of packets received so far.
+    uint64_t getReceivedNum() const;
+
+private:
+
+    /// \brief Receives a packet.
+    ///
+    /// \param timeout time to wait for a packet in microseconds.
+    /// \return received and parsed packet or null if no packet has been
+    /// received or the packet could not be parsed.
+    dhcp::PktPtr receivePacket(const uint32_t timeout);
+
+    /// \brief Main function of the receiver thread.
+    void run();
+
+    /// \brief Checks if the receiver thread was asked to stop.
+    bool isStopping() const;
+
+    /// \brief IP version of the packets received.
+    uint8_t ip_version_;
+
+    /// \brief Callback invoked for each received packet.
+    MatchCallback match_callback_;
+
+    /// \brief Maximum number of packets received in a row.
+    size_t batch_size_;
+
+    /// \brief Receiver thread.
+    boost::scoped_ptr<isc::util::thread::Thread> thread_;
+
+    /// \brief Mutex protecting the members below.
+    mutable isc::util::thread::Mutex mutex_;
+
+    /// \brief Indicates that the receiver thread must stop.
+    bool stopping_;
+
+    /// \brief Responses waiting for the main thread.
+    ResponseList responses_;
+
+    /// \brief Number of packets received so far.
+    uint64_t received_num_;
+
+    /// \brief Watch socket marked ready when responses are queued.
+    isc::util::WatchSocket watch_socket_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // PERFDHCP_RECEIVER_H
@@ -10,6 +10,8 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+#include "latency_histogram.h"
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -20,9 +22,11 @@
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <queue>
+#include <sstream>
 
 
 namespace isc {
@@ -43,6 +47,9 @@ namespace perfdhcp {
 /// stored on the list of sent packets. When packets are matched the
 /// round trip time can be calculated.
 ///
+/// The methods updating and reporting the statistics are thread safe, so
+/// the packets may be sent and received in different threads.
+///
 /// \param T class representing DHCPv4 or DHCPv6 packet.
 template <class T = dhcp::Pkt4>
 class StatsMgr : public boost::noncopyable {
@@ -280,6 +287,8 @@ public:
               max_delay_(0.),
               sum_delay_(0.),
               sum_delay_squared_(0.),
+              rtt_histogram_(),
+              interval_rtt_histogram_(),
               orphans_(0),
               collected_(0),
               unordered_lookup_size_sum_(0),
@@ -370,6 +379,13 @@ public:
             // mean delays.
             sum_delay_ += delta;
             sum_delay_squared_ += delta * delta;
+
+            // Record the delay in the histograms used to report the
+            // percentiles for the whole test and for the current interval.
+            const uint64_t delta_us =
+                static_cast<uint64_t>(period.length().total_microseconds());
+            rtt_histogram_.record(delta_us);
+            interval_rtt_histogram_.record(delta_us);
         }
 
         /// \brief Match received packet with the corresponding sent packet.
@@ -548,6 +564,34 @@ public:
         /// \return maximum delay between packets.
         double getMaxDelay() const { return(max_delay_); }
 
+        /// \brief Return histogram of delays.
+        ///
+        /// Method returns the histogram of delays between sent and
+        /// received packets since the test was started.
+        ///
+        /// \return histogram of delays.
+        const LatencyHistogram& getRTTHistogram() const {
+            return (rtt_histogram_);
+        }
+
+        /// \brief Return histogram of delays in the current interval.
+        ///
+        /// Method returns the histogram of delays between sent and
+        /// received packets since the last call to \ref resetInterval.
+        ///
+        /// \return histogram of delays in the current interval.
+        const LatencyHistogram& getIntervalRTTHistogram() const {
+            return (interval_rtt_histogram_);
+        }
+
+        /// \brief Start new interval.
+        ///
+        /// Method clears the histogram of delays in the current interval.
+        /// It is called after each intermediate report.
+        void resetInterval() {
+            interval_rtt_histogram_.reset();
+        }
+
         /// \brief Return average packet delay.
         ///
         /// Method returns average packet delay. If no packets have been
@@ -692,9 +736,10 @@ public:
         ///
         /// Method prints round trip time packets statistics. Statistics
         /// includes minimum packet delay, maximum packet delay, average
-        /// packet delay and standard deviation of delays. Packet delay
-        /// is a duration between sending a packet to server and receiving
-        /// response from server.
+        /// packet delay, standard deviation of delays and the 50th, 90th,
+        /// 99th and 99.9th percentiles of delays. Packet delay is a duration
+        /// between sending a packet to server and receiving response from
+        /// server.
         void printRTTStats() const {
             using namespace std;
             try {
@@ -704,6 +749,15 @@ public:
                      << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                      << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
                      << endl
+                     << "p50 delay: "
+                     << rtt_histogram_.getPercentile(50) / 1e3 << " ms" << endl
+                     << "p90 delay: "
+                     << rtt_histogram_.getPercentile(90) / 1e3 << " ms" << endl
+                     << "p99 delay: "
+                     << rtt_histogram_.getPercentile(99) / 1e3 << " ms" << endl
+                     << "p99.9 delay: "
+                     << rtt_histogram_.getPercentile(99.9) / 1e3 << " ms"
+                     << endl
                      << "collected packets: " << getCollectedNum() << endl;
             } catch (const Exception&) {
                 cout << "Delay summary unavailable! No packets received." << endl;
@@ -846,6 +900,13 @@ public:
         double sum_delay_squared_;     ///< Squared sum of delays between
                                        ///< sent and received packets.
 
+        /// Histogram of delays between sent and received packets.
+        LatencyHistogram rtt_histogram_;
+
+        /// Histogram of delays between sent and received packets since
+        /// the last intermediate report.
+        LatencyHistogram interval_rtt_histogram_;
+
         uint64_t orphans_;   ///< Number of orphan received packets.
 
         uint64_t collected_; ///< Number of garbage collected packets.
@@ -894,7 +955,8 @@ public:
     StatsMgr(const bool archive_enabled = false) :
         exchanges_(),
         archive_enabled_(archive_enabled),
-        boot_time_(boost::posix_time::microsec_clock::universal_time()) {
+        boot_time_(boost::posix_time::microsec_clock::universal_time()),
+        csv_header_printed_(false) {
     }
 
     /// \brief Specify new exchange type.
@@ -954,6 +1016,7 @@ public:
     ///
     // \return true, if packet drops occurred.
     bool droppedPackets() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         for (ExchangesMapIterator it = exchanges_.begin();
              it != exchanges_.end();
              ++it) {
@@ -972,12 +1035,8 @@ public:
     /// The short counter name has to be used to access counter.
     /// \return pointer to specified counter object.
     CustomCounterPtr getCounter(const std::string& counter_key) {
-        CustomCountersMapIterator it = custom_counters_.find(counter_key);
-        if (it == custom_counters_.end()) {
-            isc_throw(BadValue,
-                      "Custom counter " << counter_key << "does not exist");
-        }
-        return(it->second);
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        return (findCounter(counter_key));
     }
 
     /// \brief Increment specified counter.
@@ -989,7 +1048,8 @@ public:
     /// \return pointer to specified counter after incrementation.
     const CustomCounter& incrementCounter(const std::string& counter_key,
                                           const uint64_t value = 1) {
-        CustomCounterPtr counter = getCounter(counter_key);
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        CustomCounterPtr counter = findCounter(counter_key);
         *counter += value;
         return (*counter);
     }
@@ -1006,6 +1066,7 @@ public:
     /// packet is null.
     void passSentPacket(const ExchangeType xchg_type,
                         const boost::shared_ptr<T>& packet) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         xchg_stats->appendSent(packet);
     }
@@ -1026,6 +1087,7 @@ public:
     boost::shared_ptr<T>
     passRcvdPacket(const ExchangeType xchg_type,
                    const boost::shared_ptr<T>& packet) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         boost::shared_ptr<T> sent_packet
             = xchg_stats->matchPackets(packet);
@@ -1048,6 +1110,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return minimum delay between packets.
     double getMinDelay(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getMinDelay());
     }
@@ -1061,6 +1124,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return maximum delay between packets.
     double getMaxDelay(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getMaxDelay());
     }
@@ -1072,6 +1136,7 @@ public:
     ///
     /// \return average packet delay.
     double getAvgDelay(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getAvgDelay());
     }
@@ -1083,10 +1148,27 @@ public:
     ///
     /// \return standard deviation of packet delay.
     double getStdDevDelay(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return percentile of packet delay.
+    ///
+    /// Method returns the specified percentile of packet delay
+    /// for specified exchange type.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param percentile percentile, between 0 and 100.
+    /// \throw isc::BadValue if the percentile is out of range.
+    /// \return percentile of packet delay.
+    double getDelayPercentile(const ExchangeType xchg_type,
+                              const double percentile) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        return(xchg_stats->getRTTHistogram().getPercentile(percentile) / 1e6);
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -1096,6 +1178,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of orphan packets so far.
     uint64_t getOrphans(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getOrphans());
     }
@@ -1110,6 +1193,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return average unordered lookup set size.
     double getAvgUnorderedLookupSetSize(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getAvgUnorderedLookupSetSize());
     }
@@ -1125,6 +1209,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of unordered lookups.
     uint64_t getUnorderedLookups(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getUnorderedLookups());
     }
@@ -1141,6 +1226,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of ordered lookups.
     uint64_t getOrderedLookups(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getOrderedLookups());
     }
@@ -1154,6 +1240,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of sent packets.
     uint64_t getSentPacketsNum(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getSentPacketsNum());
     }
@@ -1167,6 +1254,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of received packets.
     uint64_t getRcvdPacketsNum(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getRcvdPacketsNum());
     }
@@ -1180,6 +1268,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of dropped packets.
     uint64_t getDroppedPacketsNum(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getDroppedPacketsNum());
     }
@@ -1195,6 +1284,7 @@ public:
     /// \throw isc::BadValue if invalid exchange type specified.
     /// \return number of garbage collected packets.
     uint64_t getCollectedNum(const ExchangeType xchg_type) const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         return(xchg_stats->getCollectedNum());
     }
@@ -1256,6 +1346,7 @@ public:
     /// \throw isc::InvalidOperation if no exchange type added to
     /// track statistics.
      void printStats() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         if (exchanges_.empty()) {
             isc_throw(isc::InvalidOperation,
                       "no exchange type added for tracking");
@@ -1273,15 +1364,55 @@ public:
         }
     }
 
+    /// \brief Print statistics in JSON format.
+    ///
+    /// Method prints statistics for all exchange types as a single
+    /// line holding a JSON object, so as the output of several tests
+    /// may be easily processed by scripts.
+    ///
+    /// \throw isc::InvalidOperation if no exchange type added to
+    /// track statistics.
+    void printStatsJSON() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        if (exchanges_.empty()) {
+            isc_throw(isc::InvalidOperation,
+                      "no exchange type added for tracking");
+        }
+        printReportJSON("final", false);
+    }
+
+    /// \brief Print statistics in CSV format.
+    ///
+    /// Method prints statistics for all exchange types, one row
+    /// per exchange type. The header row is printed before the
+    /// first report.
+    ///
+    /// \throw isc::InvalidOperation if no exchange type added to
+    /// track statistics.
+    void printStatsCSV() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        if (exchanges_.empty()) {
+            isc_throw(isc::InvalidOperation,
+                      "no exchange type added for tracking");
+        }
+        printReportCSV("final", false);
+    }
+
     /// \brief Print intermediate statistics.
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
-    void printIntermediateStats() const {
+    /// counters and the 50th and 99th percentiles of packet delay
+    /// since the previous intermediate report.
+    void printIntermediateStats() {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         std::ostringstream stream_sent;
         std::ostringstream stream_rcvd;
         std::ostringstream stream_drops;
+        std::ostringstream stream_p50;
+        std::ostringstream stream_p99;
+        stream_p50 << std::fixed << std::setprecision(3);
+        stream_p99 << std::fixed << std::setprecision(3);
         std::string sep("");
         for (ExchangesMapIterator it = exchanges_.begin();
              it != exchanges_.end(); ++it) {
@@ -1289,14 +1420,42 @@ public:
             if (it != exchanges_.begin()) {
                 sep = "/";
             }
+            const LatencyHistogram& rtt = it->second->getIntervalRTTHistogram();
             stream_sent << sep << it->second->getSentPacketsNum();
             stream_rcvd << sep << it->second->getRcvdPacketsNum();
             stream_drops << sep << it->second->getDroppedPacketsNum();
+            stream_p50 << sep << rtt.getPercentile(50) / 1e3;
+            stream_p99 << sep << rtt.getPercentile(99) / 1e3;
         }
         std::cout << "sent: " << stream_sent.str()
                   << "; received: " << stream_rcvd.str()
                   << "; drops: " << stream_drops.str()
+                  << "; p50 delay: " << stream_p50.str() << " ms"
+                  << "; p99 delay: " << stream_p99.str() << " ms"
                   << std::endl;
+        resetIntervals();
+    }
+
+    /// \brief Print intermediate statistics in JSON format.
+    ///
+    /// Method prints the intermediate statistics for all exchanges
+    /// as a single line holding a JSON object. The delays are those
+    /// measured since the previous intermediate report.
+    void printIntermediateStatsJSON() {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        printReportJSON("interval", true);
+        resetIntervals();
+    }
+
+    /// \brief Print intermediate statistics in CSV format.
+    ///
+    /// Method prints the intermediate statistics for all exchanges,
+    /// one row per exchange type. The delays are those measured since
+    /// the previous intermediate report.
+    void printIntermediateStatsCSV() {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        printReportCSV("interval", true);
+        resetIntervals();
     }
 
     /// \brief Print timestamps of all packets.
@@ -1311,6 +1470,7 @@ public:
     /// \throw isc::InvalidOperation if no exchange type added to
     /// track statistics or packets archive mode is disabled.
     void printTimestamps() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         if (exchanges_.empty()) {
             isc_throw(isc::InvalidOperation,
                       "no exchange type added for tracking");
@@ -1334,6 +1494,7 @@ public:
     ///
     /// \throw isc::InvalidOperation if no custom counters added for tracking.
     void printCustomCounters() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
         if (custom_counters_.empty()) {
             isc_throw(isc::InvalidOperation, "no custom counters specified");
         }
@@ -1348,6 +1509,20 @@ public:
 
 private:
 
+    /// \brief Return specified counter without locking the mutex.
+    ///
+    /// \param counter_key key pointing to the counter in the counters map.
+    /// \return pointer to specified counter object.
+    /// \throw isc::BadValue if the counter does not exist.
+    CustomCounterPtr findCounter(const std::string& counter_key) const {
+        CustomCountersMapIterator it = custom_counters_.find(counter_key);
+        if (it == custom_counters_.end()) {
+            isc_throw(BadValue,
+                      "Custom counter " << counter_key << "does not exist");
+        }
+        return(it->second);
+    }
+
     /// \brief Return exchange stats object for given exchange type
     ///
     /// Method returns exchange stats object for given exchange type.
@@ -1364,6 +1539,106 @@ private:
         return(xchg_stats);
     }
 
+    /// \brief Return seconds elapsed since the start of test.
+    double getElapsedSeconds() const {
+        return (getTestPeriod().length().total_microseconds() / 1e6);
+    }
+
+    /// \brief Start new interval for all exchange types.
+    void resetIntervals() {
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            it->second->resetInterval();
+        }
+    }
+
+    /// \brief Print a report in JSON format.
+    ///
+    /// The delays are reported in milliseconds.
+    ///
+    /// \param report name of the report, i.e. "interval" or "final".
+    /// \param interval if true, the delays measured since the previous
+    /// intermediate report are printed, otherwise all delays.
+    void printReportJSON(const std::string& report, const bool interval) const {
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(3)
+          << "{ \"report\": \"" << report << "\", "
+          << "\"elapsed\": " << getElapsedSeconds() << ", "
+          << "\"exchanges\": [ ";
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            ExchangeStatsPtr xchg_stats = it->second;
+            const LatencyHistogram& rtt = interval ?
+                xchg_stats->getIntervalRTTHistogram() :
+                xchg_stats->getRTTHistogram();
+            if (it != exchanges_.begin()) {
+                s << ", ";
+            }
+            s << "{ \"exchange\": \"" << exchangeToString(it->first) << "\", "
+              << "\"sent\": " << xchg_stats->getSentPacketsNum() << ", "
+              << "\"received\": " << xchg_stats->getRcvdPacketsNum() << ", "
+              << "\"drops\": " << xchg_stats->getDroppedPacketsNum() << ", "
+              << "\"delays\": " << rtt.getCount() << ", "
+              << "\"min-delay\": " << rtt.getMin() / 1e3 << ", "
+              << "\"avg-delay\": " << rtt.getMean() / 1e3 << ", "
+              << "\"max-delay\": " << rtt.getMax() / 1e3 << ", "
+              << "\"std-deviation\": " << rtt.getStdDev() / 1e3 << ", "
+              << "\"p50-delay\": " << rtt.getPercentile(50) / 1e3 << ", "
+              << "\"p90-delay\": " << rtt.getPercentile(90) / 1e3 << ", "
+              << "\"p99-delay\": " << rtt.getPercentile(99) / 1e3 << ", "
+              << "\"p99.9-delay\": " << rtt.getPercentile(99.9) / 1e3
+              << " }";
+        }
+        s << " ] }";
+        std::cout << s.str() << std::endl;
+    }
+
+    /// \brief Print a report in CSV format.
+    ///
+    /// The header row is printed before the first report. The delays
+    /// are reported in milliseconds.
+    ///
+    /// \param report name of the report, i.e. "interval" or "final".
+    /// \param interval if true, the delays measured since the previous
+    /// intermediate report are printed, otherwise all delays.
+    void printReportCSV(const std::string& report, const bool interval) const {
+        std::ostringstream s;
+        if (!csv_header_printed_) {
+            s << "report,elapsed,exchange,sent,received,drops,delays,"
+              << "min-delay,avg-delay,max-delay,std-deviation,"
+              << "p50-delay,p90-delay,p99-delay,p99.9-delay" << std::endl;
+            csv_header_printed_ = true;
+        }
+        const double elapsed = getElapsedSeconds();
+        s << std::fixed << std::setprecision(3);
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            ExchangeStatsPtr xchg_stats = it->second;
+            const LatencyHistogram& rtt = interval ?
+                xchg_stats->getIntervalRTTHistogram() :
+                xchg_stats->getRTTHistogram();
+            s << report << "," << elapsed << ","
+              << exchangeToString(it->first) << ","
+              << xchg_stats->getSentPacketsNum() << ","
+              << xchg_stats->getRcvdPacketsNum() << ","
+              << xchg_stats->getDroppedPacketsNum() << ","
+              << rtt.getCount() << ","
+              << rtt.getMin() / 1e3 << ","
+              << rtt.getMean() / 1e3 << ","
+              << rtt.getMax() / 1e3 << ","
+              << rtt.getStdDev() / 1e3 << ","
+              << rtt.getPercentile(50) / 1e3 << ","
+              << rtt.getPercentile(90) / 1e3 << ","
+              << rtt.getPercentile(99) / 1e3 << ","
+              << rtt.getPercentile(99.9) / 1e3 << std::endl;
+        }
+        std::cout << s.str();
+    }
+
+    /// Mutex protecting exchanges and counters, which are updated by
+    /// the sender and receiver threads in the multi-threaded mode.
+    mutable isc::util::thread::Mutex mutex_;
+
     ExchangesMap exchanges_;            ///< Map of exchange types.
     CustomCountersMap custom_counters_; ///< Map with custom counters.
 
@@ -1378,6 +1653,9 @@ private:
     bool archive_enabled_;
 
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
+
+    /// Indicates that the header row of the CSV reports has been printed.
+    mutable bool csv_header_printed_;
 };
 
 } // namespace perfdhcp
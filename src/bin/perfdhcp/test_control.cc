@@ -17,7 +17,9 @@
 #include "command_options.h"
 #include "perf_pkt4.h"
 #include "perf_pkt6.h"
+#include "receiver.h"
 
+#include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/foreach.hpp>
 
@@ -315,6 +317,20 @@ TestControl::checkExitConditions() const {
         }
         return (true);
     }
+
+    // Check if the whole capture has been replayed and the responses
+    // to the last messages had the time to arrive.
+    if (replay_ && replay_->isDone()) {
+        const time_duration drop_time =
+            microseconds(static_cast<int64_t>(options.getDropTime()[0] * 1e6));
+        if (microsec_clock::universal_time() - replay_->getLastSendTime() >=
+            drop_time) {
+            if (testDiags('e')) {
+                std::cout << "Replayed the capture." << std::endl;
+            }
+            return (true);
+        }
+    }
     return (false);
 }
 
@@ -573,6 +589,18 @@ uint32_t
 TestControl::getCurrentTimeout() const {
     CommandOptions& options = CommandOptions::instance();
     ptime now(microsec_clock::universal_time());
+    if (replay_) {
+        // Once the whole capture has been sent, we only wait for the
+        // responses to the last messages.
+        if (replay_->isDone()) {
+            return (REPLAY_DONE_TIMEOUT);
+        }
+        if (replay_->isTimed()) {
+            const ptime due = replay_->getDue();
+            return (now >= due ? 0 :
+                    time_period(now, due).length().total_microseconds());
+        }
+    }
     // Check that we haven't passed the moment to send the next set of
     // packets.
     if (now >= basic_rate_control_.getDue() ||
@@ -718,6 +746,26 @@ TestControl::initPacketTemplates() {
     }
 }
 
+void
+TestControl::initPacketReplay() {
+    CommandOptions& options = CommandOptions::instance();
+    PcapFile capture(options.getReplayFile(), options.getIpVersion());
+    // Without a limit on the number of exchanges or on the test period,
+    // the capture is replayed once.
+    const uint32_t iterations = (options.getNumRequests().empty() &&
+                                 (options.getPeriod() == 0) ? 1 : 0);
+    replay_.reset(new PacketReplay(capture.getRecords(),
+                                   options.getIpVersion(),
+                                   options.getReplaySpeed(), iterations));
+    if (options.getOutputFormat() == CommandOptions::OUTPUT_TEXT) {
+        std::cout << "Replaying " << replay_->getMessagesNum()
+                  << " messages from " << options.getReplayFile()
+                  << " (" << capture.getSkippedNum() + replay_->getSkippedNum()
+                  << " frames skipped)" << std::endl;
+    }
+    replay_->start(microsec_clock::universal_time());
+}
+
 void
 TestControl::initializeStatsMgr() {
     CommandOptions& options = CommandOptions::instance();
@@ -730,7 +778,12 @@ TestControl::initializeStatsMgr() {
         stats_mgr4_ = StatsMgr4Ptr(new StatsMgr4(archive_mode));
         stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_DO,
                                       options.getDropTime()[0]);
-        if (options.getExchangeMode() == CommandOptions::DORA_SARR) {
+        if (replay_) {
+            // The captured DHCPREQUEST messages are not necessarily part
+            // of 4-way exchanges but they are all matched with DHCPACKs.
+            stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_RA,
+                                          options.getDropTime()[1]);
+        } else if (options.getExchangeMode() == CommandOptions::DORA_SARR) {
             stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_RA,
                                           options.getDropTime()[1]);
         }
@@ -747,10 +800,10 @@ TestControl::initializeStatsMgr() {
             stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RR,
                                           options.getDropTime()[1]);
         }
-        if (options.getRenewRate() != 0) {
+        if ((options.getRenewRate() != 0) || replay_) {
             stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RN);
         }
-        if (options.getReleaseRate() != 0) {
+        if ((options.getReleaseRate() != 0) || replay_) {
             stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RL);
         }
     }
@@ -875,7 +928,12 @@ TestControl::sendPackets(const TestControlSocket& socket,
                          const bool preload /* = false */) {
     CommandOptions& options = CommandOptions::instance();
     for (uint64_t i = packets_num; i > 0; --i) {
-        if (options.getIpVersion() == 4) {
+        if (replay_) {
+            if (replay_->isDone()) {
+                break;
+            }
+            sendReplayPacket(socket, preload);
+        } else if (options.getIpVersion() == 4) {
             // No template packets means that no -T option was specified.
             // We have to build packets ourselves.
             if (template_buffers_.empty()) {
@@ -897,7 +955,9 @@ TestControl::sendPackets(const TestControlSocket& socket,
             }
         }
         // If we preload server we don't want to receive any packets.
-        if (!preload) {
+        // In the multi-threaded mode the packets are received in the
+        // receiver thread and processed by the main loop in batches.
+        if (!preload && !receiver_) {
             uint64_t latercvd = receivePackets(socket);
             if (testDiags('i')) {
                 if (options.getIpVersion() == 4) {
@@ -1062,24 +1122,44 @@ TestControl::printIntermediateStats() {
     time_period time_since_report(last_report_, now);
     if (time_since_report.length().total_seconds() >= delay) {
         if (options.getIpVersion() == 4) {
-            stats_mgr4_->printIntermediateStats();
+            printIntermediateStats(*stats_mgr4_, options.getOutputFormat());
         } else if (options.getIpVersion() == 6) {
-            stats_mgr6_->printIntermediateStats();
+            printIntermediateStats(*stats_mgr6_, options.getOutputFormat());
         }
         last_report_ = now;
     }
 }
 
+template<class T>
+void
+TestControl::printIntermediateStats(StatsMgr<T>& stats_mgr,
+                                    const CommandOptions::OutputFormat format) {
+    switch (format) {
+    case CommandOptions::OUTPUT_JSON:
+        stats_mgr.printIntermediateStatsJSON();
+        break;
+    case CommandOptions::OUTPUT_CSV:
+        stats_mgr.printIntermediateStatsCSV();
+        break;
+    default:
+        stats_mgr.printIntermediateStats();
+    }
+}
+
 void
 TestControl::printStats() const {
-    printRate();
     CommandOptions& options = CommandOptions::instance();
+    // The machine readable reports are self-contained, so the rate summary
+    // which would break their parsing is only printed in the text format.
+    if (options.getOutputFormat() == CommandOptions::OUTPUT_TEXT) {
+        printRate();
+    }
     if (options.getIpVersion() == 4) {
         if (!stats_mgr4_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                       "hasn't been initialized");
         }
-        stats_mgr4_->printStats();
+        printStats(*stats_mgr4_, options.getOutputFormat());
         if (testDiags('i')) {
             stats_mgr4_->printCustomCounters();
         }
@@ -1088,13 +1168,29 @@ TestControl::printStats() const {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                       "hasn't been initialized");
         }
-        stats_mgr6_->printStats();
+        printStats(*stats_mgr6_, options.getOutputFormat());
         if (testDiags('i')) {
             stats_mgr6_->printCustomCounters();
         }
     }
 }
 
+template<class T>
+void
+TestControl::printStats(const StatsMgr<T>& stats_mgr,
+                        const CommandOptions::OutputFormat format) const {
+    switch (format) {
+    case CommandOptions::OUTPUT_JSON:
+        stats_mgr.printStatsJSON();
+        break;
+    case CommandOptions::OUTPUT_CSV:
+        stats_mgr.printStatsCSV();
+        break;
+    default:
+        stats_mgr.printStats();
+    }
+}
+
 std::string
 TestControl::vector2Hex(const std::vector<uint8_t>& vec,
                         const std::string& separator /* ="" */) const {
@@ -1159,23 +1255,33 @@ TestControl::readPacketTemplate(const std::string& file_name) {
     template_buffers_.push_back(binary_stream);
 }
 
-void
-TestControl::processReceivedPacket4(const TestControlSocket& socket,
-                            const Pkt4Ptr& pkt4) {
+bool
+TestControl::matchReceivedPacket(const PktPtr& pkt, PktPtr& sent_pkt) {
+    if (CommandOptions::instance().getIpVersion() == 4) {
+        Pkt4Ptr sent_pkt4;
+        const bool respond =
+            matchReceivedPacket4(boost::static_pointer_cast<Pkt4>(pkt),
+                                 sent_pkt4);
+        sent_pkt = sent_pkt4;
+        return (respond);
+    }
+    Pkt6Ptr sent_pkt6;
+    const bool respond =
+        matchReceivedPacket6(boost::static_pointer_cast<Pkt6>(pkt), sent_pkt6);
+    sent_pkt = sent_pkt6;
+    return (respond);
+}
+
+bool
+TestControl::matchReceivedPacket4(const Pkt4Ptr& pkt4, Pkt4Ptr& sent_pkt4) {
     if (pkt4->getType() == DHCPOFFER) {
-        Pkt4Ptr discover_pkt4(stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_DO,
-                                                          pkt4));
+        sent_pkt4 = stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_DO, pkt4);
         CommandOptions::ExchangeMode xchg_mode =
             CommandOptions::instance().getExchangeMode();
-        if ((xchg_mode == CommandOptions::DORA_SARR) && discover_pkt4) {
-            if (template_buffers_.size() < 2) {
-                sendRequest4(socket, discover_pkt4, pkt4);
-            } else {
-                // @todo add defines for packet type index that can be
-                // used to access template_buffers_.
-                sendRequest4(socket, template_buffers_[1], discover_pkt4, pkt4);
-            }
-        }
+        // The replayed capture holds its own DHCPREQUEST messages.
+        return (!replay_ && (xchg_mode == CommandOptions::DORA_SARR) &&
+                sent_pkt4);
+
     } else if (pkt4->getType() == DHCPACK) {
         // If received message is DHCPACK, we have to check if this is
         // a response to 4-way exchange. We'll match this packet with
@@ -1185,12 +1291,8 @@ TestControl::processReceivedPacket4(const TestControlSocket& socket,
             // So, we may need to keep this DHCPACK in the storage if renews.
             // Note that, DHCPACK messages hold the information about
             // leases assigned. We use this information to renew.
-            if (stats_mgr4_->hasExchangeStats(StatsMgr4::XCHG_RNA)) {
-                // Renew messages are sent, because StatsMgr has the
-                // specific exchange type specified. Let's append the DHCPACK.
-                // message to a storage
-                ack_storage_.append(pkt4);
-            }
+            return (stats_mgr4_->hasExchangeStats(StatsMgr4::XCHG_RNA));
+
         // The DHCPACK message is not a server's response to the DHCPREQUEST
         // message sent within the 4-way exchange. It may be a response to a
         // renewal. In this case we first check if StatsMgr has exchange type
@@ -1200,29 +1302,20 @@ TestControl::processReceivedPacket4(const TestControlSocket& socket,
             stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_RNA, pkt4);
         }
     }
+    return (false);
 }
 
-void
-TestControl::processReceivedPacket6(const TestControlSocket& socket,
-                            const Pkt6Ptr& pkt6) {
+bool
+TestControl::matchReceivedPacket6(const Pkt6Ptr& pkt6, Pkt6Ptr& sent_pkt6) {
     uint8_t packet_type = pkt6->getType();
     if (packet_type == DHCPV6_ADVERTISE) {
-        Pkt6Ptr solicit_pkt6(stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_SA,
-                                                         pkt6));
+        sent_pkt6 = stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_SA, pkt6);
         CommandOptions::ExchangeMode xchg_mode =
             CommandOptions::instance().getExchangeMode();
-        if ((xchg_mode == CommandOptions::DORA_SARR) && solicit_pkt6) {
-            // \todo check whether received ADVERTISE packet is sane.
-            // We might want to check if STATUS_CODE option is non-zero
-            // and if there is IAADR option in IA_NA.
-            if (template_buffers_.size() < 2) {
-                sendRequest6(socket, pkt6);
-            } else {
-                // @todo add defines for packet type index that can be
-                // used to access template_buffers_.
-                sendRequest6(socket, template_buffers_[1], pkt6);
-            }
-        }
+        // The replayed capture holds its own Request messages.
+        return (!replay_ && (xchg_mode == CommandOptions::DORA_SARR) &&
+                sent_pkt6);
+
     } else if (packet_type == DHCPV6_REPLY) {
         // If the received message is Reply, we have to find out which exchange
         // type the Reply message belongs to. It is doable by matching the Reply
@@ -1234,13 +1327,10 @@ TestControl::processReceivedPacket6(const TestControlSocket& socket,
             // being sent. Note that, Reply messages hold the information about
             // leases assigned. We use this information to construct Renew and
             // Release messages.
-            if (stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RN) ||
-                stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RL)) {
-                // Renew or Release messages are sent, because StatsMgr has the
-                // specific exchange type specified. Let's append the Reply
-                // message to a storage.
-                reply_storage_.append(pkt6);
-            }
+            return (!replay_ &&
+                    (stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RN) ||
+                     stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RL)));
+
         // The Reply message is not a server's response to the Request message
         // sent within the 4-way exchange. It may be a response to the Renew
         // or Release message. In the if clause we first check if StatsMgr
@@ -1256,10 +1346,97 @@ TestControl::processReceivedPacket6(const TestControlSocket& socket,
             stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_RL, pkt6);
         }
     }
+    return (false);
+}
+
+void
+TestControl::processResponse4(const TestControlSocket& socket,
+                              const Pkt4Ptr& pkt4,
+                              const Pkt4Ptr& sent_pkt4) {
+    if (pkt4->getType() == DHCPOFFER) {
+        if (template_buffers_.size() < 2) {
+            sendRequest4(socket, sent_pkt4, pkt4);
+        } else {
+            // @todo add defines for packet type index that can be
+            // used to access template_buffers_.
+            sendRequest4(socket, template_buffers_[1], sent_pkt4, pkt4);
+        }
+    } else if (pkt4->getType() == DHCPACK) {
+        // Renew messages are sent, because StatsMgr has the
+        // specific exchange type specified. Let's append the DHCPACK.
+        // message to a storage
+        ack_storage_.append(pkt4);
+    }
+}
+
+void
+TestControl::processResponse6(const TestControlSocket& socket,
+                              const Pkt6Ptr& pkt6) {
+    if (pkt6->getType() == DHCPV6_ADVERTISE) {
+        // \todo check whether received ADVERTISE packet is sane.
+        // We might want to check if STATUS_CODE option is non-zero
+        // and if there is IAADR option in IA_NA.
+        if (template_buffers_.size() < 2) {
+            sendRequest6(socket, pkt6);
+        } else {
+            // @todo add defines for packet type index that can be
+            // used to access template_buffers_.
+            sendRequest6(socket, template_buffers_[1], pkt6);
+        }
+    } else if (pkt6->getType() == DHCPV6_REPLY) {
+        // Renew or Release messages are sent, because StatsMgr has the
+        // specific exchange type specified. Let's append the Reply
+        // message to a storage.
+        reply_storage_.append(pkt6);
+    }
+}
+
+void
+TestControl::processReceivedPacket4(const TestControlSocket& socket,
+                                    const Pkt4Ptr& pkt4) {
+    Pkt4Ptr sent_pkt4;
+    if (matchReceivedPacket4(pkt4, sent_pkt4)) {
+        processResponse4(socket, pkt4, sent_pkt4);
+    }
+}
+
+void
+TestControl::processReceivedPacket6(const TestControlSocket& socket,
+                                    const Pkt6Ptr& pkt6) {
+    Pkt6Ptr sent_pkt6;
+    if (matchReceivedPacket6(pkt6, sent_pkt6)) {
+        processResponse6(socket, pkt6);
+    }
+}
+
+uint64_t
+TestControl::processResponses(const TestControlSocket& socket) {
+    // Wait for the responses no longer than until the next packets
+    // are due to be sent.
+    receiver_->waitForResponses(getCurrentTimeout());
+    Receiver::ResponseList responses;
+    const size_t responses_num = receiver_->getResponses(responses);
+    for (Receiver::ResponseList::const_iterator response = responses.begin();
+         response != responses.end(); ++response) {
+        if (CommandOptions::instance().getIpVersion() == 4) {
+            processResponse4(socket,
+                             boost::static_pointer_cast<Pkt4>(response->rcvd_),
+                             boost::static_pointer_cast<Pkt4>(response->sent_));
+        } else {
+            processResponse6(socket,
+                             boost::static_pointer_cast<Pkt6>(response->rcvd_));
+        }
+    }
+    return (responses_num);
 }
 
 uint64_t
 TestControl::receivePackets(const TestControlSocket& socket) {
+    // In the multi-threaded mode the packets are received by the
+    // receiver thread.
+    if (receiver_) {
+        return (processResponses(socket));
+    }
     bool receiving = true;
     uint64_t received = 0;
     while (receiving) {
@@ -1402,6 +1579,8 @@ TestControl::reset() {
     setTransidGenerator(NumberGeneratorPtr());
     setMacAddrGenerator(NumberGeneratorPtr());
     first_packet_serverid_.clear();
+    receiver_.reset();
+    replay_.reset();
     interrupted_ = false;
 }
 
@@ -1438,6 +1617,10 @@ TestControl::run() {
     }
     // Initialize packet templates.
     initPacketTemplates();
+    // Load the messages to replay.
+    if (!options.getReplayFile().empty()) {
+        initPacketReplay();
+    }
     // Initialize randomization seed.
     if (options.isSeeded()) {
         srandom(options.getSeed());
@@ -1461,11 +1644,26 @@ TestControl::run() {
 
     // Initialize Statistics Manager. Release previous if any.
     initializeStatsMgr();
+
+    // In the multi-threaded mode start receiving packets in a separate
+    // thread. This must be done after the Statistics Manager has been
+    // initialized because the received packets are matched in this thread.
+    if (!options.isSingleThreaded()) {
+        receiver_.reset(new Receiver(options.getIpVersion(),
+                                     boost::bind(&TestControl::matchReceivedPacket,
+                                                 this, _1, _2)));
+        receiver_->start();
+    }
     for (;;) {
         // Calculate number of packets to be sent to stay
         // catch up with rate.
-        uint64_t packets_due = basic_rate_control_.getOutboundMessageCount();
-        checkLateMessages(basic_rate_control_);
+        uint64_t packets_due = 0;
+        if (replay_ && replay_->isTimed()) {
+            packets_due = replay_->getDueCount(microsec_clock::universal_time());
+        } else {
+            packets_due = basic_rate_control_.getOutboundMessageCount();
+            checkLateMessages(basic_rate_control_);
+        }
         if ((packets_due == 0) && testDiags('i')) {
             if (options.getIpVersion() == 4) {
                 stats_mgr4_->incrementCounter("shortwait");
@@ -1527,6 +1725,8 @@ TestControl::run() {
         // searches in the long list of Reply packets increases CPU utilization.
         cleanCachedPackets();
     }
+    // Stop the receiver thread before the statistics are printed.
+    receiver_.reset();
     printStats();
 
     if (!options.getWrapped().empty()) {
@@ -1761,6 +1961,66 @@ TestControl::sendMessageFromReply(const uint16_t msg_type,
     return (true);
 }
 
+void
+TestControl::sendReplayPacket(const TestControlSocket& socket,
+                              const bool preload /*= false*/) {
+    basic_rate_control_.updateSendTime();
+    PktPtr pkt = replay_->next();
+    if (CommandOptions::instance().getIpVersion() == 4) {
+        Pkt4Ptr pkt4 = boost::static_pointer_cast<Pkt4>(pkt);
+        // Keep the hop count of the messages captured behind relays.
+        const uint8_t hops = pkt4->getHops();
+        setDefaults4(socket, pkt4);
+        if (hops > 1) {
+            pkt4->setHops(hops);
+        }
+        pkt4->pack();
+        IfaceMgr::instance().send(pkt4);
+        if (!preload) {
+            if (!stats_mgr4_) {
+                isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
+                          "hasn't been initialized");
+            }
+            if (pkt4->getType() == DHCPDISCOVER) {
+                stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO, pkt4);
+            } else if (pkt4->getType() == DHCPREQUEST) {
+                stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RA, pkt4);
+            }
+        }
+        saveFirstPacket(pkt4);
+
+    } else {
+        Pkt6Ptr pkt6 = boost::static_pointer_cast<Pkt6>(pkt);
+        setDefaults6(socket, pkt6);
+        pkt6->pack();
+        IfaceMgr::instance().send(pkt6);
+        if (!preload) {
+            if (!stats_mgr6_) {
+                isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
+                          "hasn't been initialized");
+            }
+            switch (pkt6->getType()) {
+            case DHCPV6_SOLICIT:
+                stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6);
+                break;
+            case DHCPV6_REQUEST:
+                stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RR, pkt6);
+                break;
+            case DHCPV6_RENEW:
+                stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RN, pkt6);
+                break;
+            case DHCPV6_RELEASE:
+                stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RL, pkt6);
+                break;
+            default:
+                // Other messages are sent but not accounted for.
+                ;
+            }
+        }
+        saveFirstPacket(pkt6);
+    }
+}
+
 void
 TestControl::sendRequest4(const TestControlSocket& socket,
                           const dhcp::Pkt4Ptr& discover_pkt4,
@@ -7,8 +7,11 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "command_options.h"
+#include "packet_replay.h"
 #include "packet_storage.h"
 #include "rate_control.h"
+#include "receiver.h"
 #include "stats_mgr.h"
 
 #include <dhcp/iface_mgr.h>
@@ -18,6 +21,7 @@
 #include <util/random/random_number_generator.h>
 
 #include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/function.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -49,6 +53,9 @@ static const size_t DHCPV6_ELAPSED_TIME_OFFSET = 84;
 static const size_t DHCPV6_SERVERID_OFFSET = 22;
 /// Default DHCPV6 IA_NA offset in the packet template.
 static const size_t DHCPV6_IA_NA_OFFSET = 40;
+/// Timeout in microseconds used when waiting for the responses to the
+/// last messages of a replayed capture.
+static const uint32_t REPLAY_DONE_TIMEOUT = 100000;
 
 /// @brief Exception thrown when the required option is not found in a packet.
 class OptionNotFound : public Exception {
@@ -93,6 +100,16 @@ public:
 /// - print statistics, e.g. achieved rate,
 /// - optionally print some diagnostics.
 ///
+/// In the multi-threaded mode (selected with '-g multi') the packets are
+/// received, parsed and matched with the sent packets by a separate
+/// \ref Receiver thread. The main loop then only sends packets and handles
+/// the responses which require an action, e.g. sends DHCPREQUEST in response
+/// to DHCPOFFER. The received packets are handed over to the main loop in
+/// batches. The \ref StatsMgr is thread safe. The sent packets are
+/// registered in it when the send returns, so the packet timestamp set by
+/// the packet filter is never read while it is being written. A response
+/// arriving before its packet has been registered is counted as orphaned.
+///
 /// With the '-w' command line option user may specify the external application
 /// or script to be executed. This is executed twice, first when the test starts
 /// and second time when the test ends. This external script or application must
@@ -527,6 +544,16 @@ protected:
     /// odd number of hexadecimal digits.
     void initPacketTemplates();
 
+    /// \brief Loads the capture to replay.
+    ///
+    /// Reads the capture file specified with the -Y option and prepares
+    /// the replay of its messages. The capture is replayed once unless
+    /// the number of exchanges or the test period are limited.
+    ///
+    /// \throw isc::BadValue if the capture file can't be read.
+    /// \throw isc::OutOfRange if the capture holds no DHCP message.
+    void initPacketReplay();
+
     /// \brief Initializes Statistics Manager.
     ///
     /// This function initializes Statistics Manager. If there is
@@ -556,9 +583,19 @@ protected:
     /// \brief Print intermediate statistics.
     ///
     /// Print brief statistics regarding number of sent packets,
-    /// received packets and dropped packets so far.
+    /// received packets and dropped packets so far and the delays
+    /// since the previous intermediate report.
     void printIntermediateStats();
 
+    /// \brief Print intermediate statistics in the specified format.
+    ///
+    /// \tparam T Pkt4 or Pkt6 class.
+    /// \param stats_mgr Statistics Manager holding the statistics.
+    /// \param format format of the report.
+    template<class T>
+    void printIntermediateStats(StatsMgr<T>& stats_mgr,
+                                const CommandOptions::OutputFormat format);
+
     /// \brief Print rate statistics.
     ///
     /// Method print packet exchange rate statistics.
@@ -571,6 +608,15 @@ protected:
     /// not initialized.
     void printStats() const;
 
+    /// \brief Print performance statistics in the specified format.
+    ///
+    /// \tparam T Pkt4 or Pkt6 class.
+    /// \param stats_mgr Statistics Manager holding the statistics.
+    /// \param format format of the report.
+    template<class T>
+    void printStats(const StatsMgr<T>& stats_mgr,
+                    const CommandOptions::OutputFormat format) const;
+
     /// \brief Process received DHCPv4 packet.
     ///
     /// Method performs processing of the received DHCPv4 packet,
@@ -605,6 +651,71 @@ protected:
     void processReceivedPacket6(const TestControlSocket& socket,
                                 const dhcp::Pkt6Ptr& pkt6);
 
+    /// \brief Match received packet with the sent packet.
+    ///
+    /// This is the callback invoked by the \ref Receiver thread for each
+    /// received packet. It calls \ref matchReceivedPacket4 or
+    /// \ref matchReceivedPacket6 depending on the IP version in use.
+    ///
+    /// \param [in] pkt received packet.
+    /// \param [out] sent_pkt matched sent packet.
+    /// \return true if the packet requires further processing by
+    /// \ref processResponse4 or \ref processResponse6.
+    bool matchReceivedPacket(const dhcp::PktPtr& pkt, dhcp::PktPtr& sent_pkt);
+
+    /// \brief Match received DHCPv4 packet with the sent packet.
+    ///
+    /// Method matches the received packet with the sent packet and
+    /// updates statistics. It only uses the thread safe
+    /// \ref StatsMgr, so it may be called by the receiver thread.
+    ///
+    /// \param [in] pkt4 received packet.
+    /// \param [out] sent_pkt4 matched sent packet.
+    /// \return true if the packet requires further processing, i.e.
+    /// a DHCPREQUEST must be sent in response to the DHCPOFFER or the
+    /// DHCPACK must be stored for sending renewals.
+    bool matchReceivedPacket4(const dhcp::Pkt4Ptr& pkt4,
+                              dhcp::Pkt4Ptr& sent_pkt4);
+
+    /// \brief Match received DHCPv6 packet with the sent packet.
+    ///
+    /// Method matches the received packet with the sent packet and
+    /// updates statistics. It only uses the thread safe
+    /// \ref StatsMgr, so it may be called by the receiver thread.
+    ///
+    /// \param [in] pkt6 received packet.
+    /// \param [out] sent_pkt6 matched sent packet.
+    /// \return true if the packet requires further processing, i.e.
+    /// a Request must be sent in response to the Advertise or the Reply
+    /// must be stored for sending renewals or releases.
+    bool matchReceivedPacket6(const dhcp::Pkt6Ptr& pkt6,
+                              dhcp::Pkt6Ptr& sent_pkt6);
+
+    /// \brief Respond to the received DHCPv4 packet.
+    ///
+    /// \param [in] socket socket to be used.
+    /// \param [in] pkt4 received packet.
+    /// \param [in] sent_pkt4 sent packet matched with the received one.
+    void processResponse4(const TestControlSocket& socket,
+                          const dhcp::Pkt4Ptr& pkt4,
+                          const dhcp::Pkt4Ptr& sent_pkt4);
+
+    /// \brief Respond to the received DHCPv6 packet.
+    ///
+    /// \param [in] socket socket to be used.
+    /// \param [in] pkt6 received packet.
+    void processResponse6(const TestControlSocket& socket,
+                          const dhcp::Pkt6Ptr& pkt6);
+
+    /// \brief Process responses queued by the receiver thread.
+    ///
+    /// Method waits for the responses until the next packets are due
+    /// to be sent and processes all queued responses.
+    ///
+    /// \param socket socket to be used.
+    /// \return number of processed responses.
+    uint64_t processResponses(const TestControlSocket& socket);
+
     /// \brief Receive DHCPv4 or DHCPv6 packets from the server.
     ///
     /// Method receives DHCPv4 or DHCPv6 packets from the server.
@@ -827,6 +938,24 @@ protected:
                       const dhcp::Pkt4Ptr& discover_pkt4,
                       const dhcp::Pkt4Ptr& offer_pkt4);
 
+    /// \brief Send the next message of the replayed capture.
+    ///
+    /// The message is relayed as the generated messages are, see
+    /// \ref setDefaults4 and \ref setDefaults6, except that the hop count
+    /// of the DHCPv4 messages captured behind relays is kept. A copy of
+    /// the DISCOVER, REQUEST, SOLICIT, Request, Renew and Release messages
+    /// is stored in the Statistics Manager, other messages are sent
+    /// without being accounted for.
+    ///
+    /// \param socket socket to be used to send the message.
+    /// \param preload mode, packets not included in statistics.
+    ///
+    /// \throw isc::InvalidOperation if the capture has been replayed or
+    /// the Statistics Manager has not been initialized.
+    /// \throw isc::dhcp::SocketWriteError if failed to send the packet.
+    void sendReplayPacket(const TestControlSocket& socket,
+                          const bool preload = false);
+
     /// \brief Send DHCPv6 REQUEST message.
     ///
     /// Method creates and sends DHCPv6 REQUEST message to the server
@@ -1133,6 +1262,13 @@ protected:
     std::map<uint8_t, dhcp::Pkt4Ptr> template_packets_v4_;
     std::map<uint8_t, dhcp::Pkt6Ptr> template_packets_v6_;
 
+    /// Replayed capture, set when the -Y option is specified.
+    boost::scoped_ptr<PacketReplay> replay_;
+
+    /// Receiver thread used in the multi-threaded mode. It is declared
+    /// last so as it is stopped before other members are destroyed.
+    boost::scoped_ptr<Receiver> receiver_;
+
     static bool interrupted_;  ///< Is program interrupted.
 };
 
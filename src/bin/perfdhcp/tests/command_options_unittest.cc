@@ -594,6 +594,77 @@ TEST_F(CommandOptionsTest, ExchangeMode) {
                  isc::InvalidParameter);
 }
 
+TEST_F(CommandOptionsTest, ThreadMode) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -l ethx all"));
+    EXPECT_TRUE(opt.isSingleThreaded());
+    EXPECT_NO_THROW(process("perfdhcp -g single -l ethx all"));
+    EXPECT_TRUE(opt.isSingleThreaded());
+    EXPECT_NO_THROW(process("perfdhcp -g multi -l ethx all"));
+    EXPECT_FALSE(opt.isSingleThreaded());
+
+    // Negative test cases
+    // Unknown thread mode
+    EXPECT_THROW(process("perfdhcp -g many -l ethx all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, OutputFormat) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -l ethx all"));
+    EXPECT_EQ(CommandOptions::OUTPUT_TEXT, opt.getOutputFormat());
+    EXPECT_NO_THROW(process("perfdhcp -j json -l ethx all"));
+    EXPECT_EQ(CommandOptions::OUTPUT_JSON, opt.getOutputFormat());
+    EXPECT_NO_THROW(process("perfdhcp -j csv -l ethx all"));
+    EXPECT_EQ(CommandOptions::OUTPUT_CSV, opt.getOutputFormat());
+    EXPECT_NO_THROW(process("perfdhcp -j text -l ethx all"));
+    EXPECT_EQ(CommandOptions::OUTPUT_TEXT, opt.getOutputFormat());
+
+    // Negative test cases
+    // Unknown output format
+    EXPECT_THROW(process("perfdhcp -j xml -l ethx all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, Replay) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -l ethx all"));
+    EXPECT_TRUE(opt.getReplayFile().empty());
+    EXPECT_EQ(1., opt.getReplaySpeed());
+    EXPECT_NO_THROW(process("perfdhcp -Y capture.pcap -l ethx all"));
+    EXPECT_EQ("capture.pcap", opt.getReplayFile());
+    EXPECT_EQ(1., opt.getReplaySpeed());
+    EXPECT_NO_THROW(process("perfdhcp -Y capture.pcap -y 2.5 -l ethx all"));
+    EXPECT_EQ(2.5, opt.getReplaySpeed());
+    EXPECT_NO_THROW(process("perfdhcp -Y capture.pcap -y max -r 100"
+                            " -l ethx all"));
+    EXPECT_EQ(0., opt.getReplaySpeed());
+    // The capture sets the pace of the test so -n and -p don't require -r.
+    EXPECT_NO_THROW(process("perfdhcp -Y capture.pcap -n 10 -p 5 -t 1"
+                            " -l ethx all"));
+
+    // Negative test cases
+    // Invalid speed
+    EXPECT_THROW(process("perfdhcp -Y capture.pcap -y 0 -l ethx all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -Y capture.pcap -y fast -l ethx all"),
+                 isc::InvalidParameter);
+    // Speed without capture
+    EXPECT_THROW(process("perfdhcp -y 2 -l ethx all"),
+                 isc::InvalidParameter);
+    // Rate with timed replay
+    EXPECT_THROW(process("perfdhcp -Y capture.pcap -r 100 -l ethx all"),
+                 isc::InvalidParameter);
+    // Incompatible options
+    EXPECT_THROW(process("perfdhcp -Y capture.pcap -T file.x -l ethx all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -Y capture.pcap -i -l ethx all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -6 -Y capture.pcap -y max -r 10 -F 5"
+                         " -l ethx all"),
+                 isc::InvalidParameter);
+}
+
 TEST_F(CommandOptionsTest, Offsets) {
     CommandOptions& opt = CommandOptions::instance();
     EXPECT_NO_THROW(process("perfdhcp -E5 -4 -I 2 -S3 -O 30 -X7 -l ethx "
@@ -0,0 +1,104 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <exceptions/exceptions.h>
+#include "latency_histogram.h"
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace isc;
+using namespace isc::perfdhcp;
+
+namespace {
+
+// Test that an empty histogram reports zeros.
+TEST(LatencyHistogramTest, empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0., histogram.getMean());
+    EXPECT_EQ(0., histogram.getStdDev());
+    EXPECT_EQ(0, histogram.getPercentile(50));
+    EXPECT_THROW(histogram.getPercentile(-1), isc::BadValue);
+    EXPECT_THROW(histogram.getPercentile(100.1), isc::BadValue);
+}
+
+// Test that the values are mapped to contiguous buckets and that each
+// bucket holds values within 1% of each other.
+TEST(LatencyHistogramTest, buckets) {
+    // The lowest values have their own bucket.
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKET_COUNT;
+         ++value) {
+        EXPECT_EQ(value, LatencyHistogram::getBucketIndex(value));
+        EXPECT_EQ(value, LatencyHistogram::getBucketHighest(value));
+    }
+    // Walk through the buckets above, up to the highest value.
+    uint64_t lowest = LatencyHistogram::SUB_BUCKET_COUNT;
+    size_t index = LatencyHistogram::SUB_BUCKET_COUNT;
+    for (;;) {
+        const uint64_t highest = LatencyHistogram::getBucketHighest(index);
+        ASSERT_GE(highest, lowest);
+        EXPECT_EQ(index, LatencyHistogram::getBucketIndex(lowest));
+        EXPECT_EQ(index, LatencyHistogram::getBucketIndex(highest));
+        EXPECT_LE(static_cast<double>(highest - lowest), lowest * 0.01);
+        if (highest == std::numeric_limits<uint64_t>::max()) {
+            break;
+        }
+        lowest = highest + 1;
+        ++index;
+    }
+}
+
+// Test that the statistics of the recorded values are exact.
+TEST(LatencyHistogramTest, statistics) {
+    LatencyHistogram histogram;
+    histogram.record(100);
+    histogram.record(300);
+    histogram.record(200);
+    EXPECT_EQ(3, histogram.getCount());
+    EXPECT_EQ(100, histogram.getMin());
+    EXPECT_EQ(300, histogram.getMax());
+    EXPECT_DOUBLE_EQ(200., histogram.getMean());
+    EXPECT_NEAR(81.65, histogram.getStdDev(), 0.01);
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+}
+
+// Test that the percentiles are reported within the histogram precision.
+TEST(LatencyHistogramTest, percentiles) {
+    LatencyHistogram histogram;
+    // Record 1 to 100000 microseconds, in a scrambled order.
+    const uint64_t count = 100000;
+    for (uint64_t i = 0; i < count; ++i) {
+        histogram.record((i * 7919) % count + 1);
+    }
+    ASSERT_EQ(count, histogram.getCount());
+
+    const double percentiles[] = { 10, 50, 90, 99, 99.9 };
+    for (int i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); ++i) {
+        const double expected = percentiles[i] * count / 100;
+        EXPECT_NEAR(expected, histogram.getPercentile(percentiles[i]),
+                    expected * 0.01) << "percentile " << percentiles[i];
+    }
+    EXPECT_EQ(1, histogram.getPercentile(0));
+    EXPECT_EQ(count, histogram.getPercentile(100));
+}
+
+// Test that the percentiles of a single value are that value.
+TEST(LatencyHistogramTest, singleValue) {
+    LatencyHistogram histogram;
+    histogram.record(123456);
+    EXPECT_EQ(123456, histogram.getPercentile(0));
+    EXPECT_EQ(123456, histogram.getPercentile(50));
+    EXPECT_EQ(123456, histogram.getPercentile(100));
+}
+
+} // end of anonymous namespace
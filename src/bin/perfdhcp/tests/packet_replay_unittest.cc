@@ -0,0 +1,203 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <exceptions/exceptions.h>
+#include "packet_replay.h"
+
+#include <boost/scoped_ptr.hpp>
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace boost::posix_time;
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+
+namespace {
+
+/// \brief Test fixture class for the \ref PacketReplay.
+class PacketReplayTest : public ::testing::Test {
+public:
+
+    /// \brief Appends a record to the capture.
+    ///
+    /// \param pkt message to append, packed by this function.
+    /// \param offset capture time relative to the first message, in
+    /// milliseconds.
+    void append(const PktPtr& pkt, const int offset) {
+        pkt->pack();
+        const uint8_t* data =
+            static_cast<const uint8_t*>(pkt->getBuffer().getData());
+        PcapFile::Record record;
+        record.offset_ = milliseconds(offset);
+        record.data_.assign(data, data + pkt->getBuffer().getLength());
+        records_.push_back(record);
+    }
+
+    /// \brief Creates a DHCPDISCOVER with a client identifier.
+    ///
+    /// \param transid transaction id.
+    /// \param client_id contents of the client identifier option.
+    static Pkt4Ptr createDiscover(const uint32_t transid,
+                                  const std::vector<uint8_t>& client_id) {
+        Pkt4Ptr pkt(new Pkt4(DHCPDISCOVER, transid));
+        const uint8_t mac[] = { 0x00, 0x0c, 0x01, 0x02, 0x03, 0x04 };
+        pkt->setHWAddr(HTYPE_ETHER, sizeof(mac),
+                       std::vector<uint8_t>(mac, mac + sizeof(mac)));
+        pkt->addOption(OptionPtr(new Option(Option::V4,
+                                            DHO_DHCP_CLIENT_IDENTIFIER,
+                                            client_id)));
+        return (pkt);
+    }
+
+    /// \brief Creates a Solicit with a DUID-LLT.
+    ///
+    /// \param transid transaction id.
+    static Pkt6Ptr createSolicit(const uint32_t transid) {
+        Pkt6Ptr pkt(new Pkt6(DHCPV6_SOLICIT, transid));
+        const uint8_t duid[] = { 0, 1, 0, 1, 0x11, 0x22, 0x33, 0x44,
+                                 0x00, 0x0c, 0x01, 0x02, 0x03, 0x04 };
+        pkt->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                            OptionBuffer(duid, duid + sizeof(duid)))));
+        return (pkt);
+    }
+
+    /// \brief Captured messages.
+    PcapFile::RecordCollection records_;
+};
+
+// Test that invalid parameters and malformed messages are rejected.
+TEST_F(PacketReplayTest, construction) {
+    EXPECT_THROW(PacketReplay(records_, 4, 1., 1), isc::BadValue);
+
+    append(createDiscover(1, std::vector<uint8_t>(7, 1)), 0);
+    EXPECT_THROW(PacketReplay(records_, 5, 1., 1), isc::BadValue);
+    EXPECT_THROW(PacketReplay(records_, 4, -1., 1), isc::BadValue);
+
+    // Add a truncated message.
+    PcapFile::Record record;
+    record.data_.resize(10, 1);
+    records_.push_back(record);
+    boost::scoped_ptr<PacketReplay> replay;
+    ASSERT_NO_THROW(replay.reset(new PacketReplay(records_, 4, 1., 1)));
+    EXPECT_EQ(1, replay->getMessagesNum());
+    EXPECT_EQ(1, replay->getSkippedNum());
+}
+
+// Test that the DHCPv4 messages are replayed unchanged in the first
+// iteration and that the identifiers differ in the next ones.
+TEST_F(PacketReplayTest, rewrite4) {
+    std::vector<uint8_t> client_id(7);
+    client_id[0] = HTYPE_ETHER;
+    for (int i = 1; i < client_id.size(); ++i) {
+        client_id[i] = i;
+    }
+    append(createDiscover(0x1234, client_id), 0);
+    PacketReplay replay(records_, 4, 0., 3);
+    EXPECT_FALSE(replay.isTimed());
+
+    std::set<uint32_t> transids;
+    std::set<std::vector<uint8_t> > macs;
+    std::set<std::vector<uint8_t> > client_ids;
+    for (uint32_t iteration = 0; iteration < 3; ++iteration) {
+        ASSERT_FALSE(replay.isDone());
+        EXPECT_EQ(iteration, replay.getIteration());
+        Pkt4Ptr pkt = boost::dynamic_pointer_cast<Pkt4>(replay.next());
+        ASSERT_TRUE(pkt);
+        EXPECT_EQ(DHCPDISCOVER, pkt->getType());
+        transids.insert(pkt->getTransid());
+        const std::vector<uint8_t>& mac = pkt->getHWAddr()->hwaddr_;
+        ASSERT_EQ(6, mac.size());
+        // The multicast and locally administered bits are kept.
+        EXPECT_EQ(0, mac[0] & 0x03);
+        macs.insert(mac);
+        OptionPtr opt = pkt->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+        ASSERT_TRUE(opt);
+        ASSERT_EQ(client_id.size(), opt->getData().size());
+        // The hardware type is kept.
+        EXPECT_EQ(HTYPE_ETHER, opt->getData()[0]);
+        client_ids.insert(opt->getData());
+        if (iteration == 0) {
+            EXPECT_EQ(0x1234, pkt->getTransid());
+            EXPECT_TRUE(client_id == opt->getData());
+        }
+        // The rewritten message can be packed.
+        EXPECT_NO_THROW(pkt->pack());
+    }
+    EXPECT_EQ(3, transids.size());
+    EXPECT_EQ(3, macs.size());
+    EXPECT_EQ(3, client_ids.size());
+    EXPECT_TRUE(replay.isDone());
+    EXPECT_THROW(replay.next(), isc::InvalidOperation);
+}
+
+// Test that the DUID of the DHCPv6 messages is rewritten after the
+// DUID type, hardware type and time.
+TEST_F(PacketReplayTest, rewrite6) {
+    append(createSolicit(0x123456), 0);
+    PacketReplay replay(records_, 6, 0., 0);
+    Pkt6Ptr first = boost::dynamic_pointer_cast<Pkt6>(replay.next());
+    ASSERT_TRUE(first);
+    Pkt6Ptr second = boost::dynamic_pointer_cast<Pkt6>(replay.next());
+    ASSERT_TRUE(second);
+    EXPECT_EQ(0x123456, first->getTransid());
+    EXPECT_NE(first->getTransid(), second->getTransid());
+    EXPECT_EQ(0, second->getTransid() & 0xff000000);
+
+    OptionPtr duid1 = first->getOption(D6O_CLIENTID);
+    OptionPtr duid2 = second->getOption(D6O_CLIENTID);
+    ASSERT_TRUE(duid1 && duid2);
+    ASSERT_EQ(duid1->getData().size(), duid2->getData().size());
+    EXPECT_TRUE(std::equal(duid1->getData().begin(),
+                           duid1->getData().begin() + 8,
+                           duid2->getData().begin()));
+    EXPECT_FALSE(duid1->getData() == duid2->getData());
+
+    // The replay is never done without a number of iterations.
+    EXPECT_FALSE(replay.isDone());
+    EXPECT_EQ(2, replay.getIteration());
+}
+
+// Test that the timed replay schedules the messages at the capture timing
+// divided by the speed, the capture being looped.
+TEST_F(PacketReplayTest, timing) {
+    append(createSolicit(1), 0);
+    append(createSolicit(2), 100);
+    append(createSolicit(3), 200);
+    PacketReplay replay(records_, 6, 2., 2);
+    ASSERT_TRUE(replay.isTimed());
+    const ptime start = microsec_clock::universal_time();
+    replay.start(start);
+
+    EXPECT_EQ(start, replay.getDue());
+    EXPECT_EQ(1, replay.getDueCount(start));
+    EXPECT_EQ(2, replay.getDueCount(start + milliseconds(50)));
+    EXPECT_EQ(3, replay.getDueCount(start + milliseconds(100)));
+    // The second iteration starts after the average interval between
+    // two messages: (200 + 100) / 2 = 150ms.
+    EXPECT_EQ(3, replay.getDueCount(start + milliseconds(149)));
+    EXPECT_EQ(4, replay.getDueCount(start + milliseconds(150)));
+    EXPECT_EQ(6, replay.getDueCount(start + seconds(10)));
+
+    replay.next();
+    EXPECT_EQ(start + milliseconds(50), replay.getDue());
+    EXPECT_EQ(5, replay.getDueCount(start + seconds(10)));
+    for (int i = 0; i < 5; ++i) {
+        replay.next();
+    }
+    EXPECT_TRUE(replay.isDone());
+    EXPECT_EQ(0, replay.getDueCount(start + seconds(10)));
+    EXPECT_THROW(replay.getDue(), isc::InvalidOperation);
+}
+
+} // end of anonymous namespace
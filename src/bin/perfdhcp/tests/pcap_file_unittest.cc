@@ -0,0 +1,353 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <exceptions/exceptions.h>
+#include "pcap_file.h"
+
+#include <boost/scoped_ptr.hpp>
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <netinet/in.h>
+#include <stdio.h>
+
+using namespace boost::posix_time;
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+
+namespace {
+
+/// \brief Name of the capture file created by the tests.
+const char* PCAP_FILE_NAME = "test_capture.pcap";
+
+/// \brief Test fixture class for the \ref PcapFile.
+///
+/// It provides functions building captured frames and writing them
+/// into a pcap file.
+class PcapFileTest : public ::testing::Test {
+public:
+
+    /// \brief Destructor.
+    ///
+    /// Removes the capture file.
+    virtual ~PcapFileTest() {
+        static_cast<void>(remove(PCAP_FILE_NAME));
+    }
+
+    /// \brief A captured frame.
+    struct Frame {
+        /// \brief Capture time in seconds.
+        uint32_t sec_;
+        /// \brief Capture time fraction (microseconds or nanoseconds).
+        uint32_t frac_;
+        /// \brief Frame contents.
+        std::vector<uint8_t> data_;
+    };
+
+    /// \brief Appends a 16-bit value in network byte order.
+    static void append16(std::vector<uint8_t>& buf, const uint16_t value) {
+        buf.push_back(value >> 8);
+        buf.push_back(value & 0xff);
+    }
+
+    /// \brief Appends a 32-bit value in the byte order of the pcap headers.
+    static void append32(std::vector<uint8_t>& buf, const uint32_t value,
+                         const bool big_endian) {
+        for (int i = 0; i < 4; ++i) {
+            const int shift = big_endian ? 24 - 8 * i : 8 * i;
+            buf.push_back((value >> shift) & 0xff);
+        }
+    }
+
+    /// \brief Builds an UDP datagram.
+    ///
+    /// \param dst_port destination port.
+    /// \param payload UDP payload.
+    static std::vector<uint8_t> udp(const uint16_t dst_port,
+                                    const std::vector<uint8_t>& payload) {
+        std::vector<uint8_t> datagram;
+        append16(datagram, 12345);
+        append16(datagram, dst_port);
+        append16(datagram, payload.size() + 8);
+        append16(datagram, 0);
+        datagram.insert(datagram.end(), payload.begin(), payload.end());
+        return (datagram);
+    }
+
+    /// \brief Builds an IPv4 packet.
+    ///
+    /// \param datagram UDP datagram.
+    /// \param fragment true if the packet should be flagged as a fragment.
+    static std::vector<uint8_t> ipv4(const std::vector<uint8_t>& datagram,
+                                     const bool fragment = false) {
+        std::vector<uint8_t> packet;
+        packet.push_back(0x45);
+        packet.push_back(0);
+        append16(packet, datagram.size() + 20);
+        append16(packet, 0);
+        append16(packet, fragment ? 0x2000 : 0);
+        packet.push_back(64);
+        packet.push_back(IPPROTO_UDP);
+        append16(packet, 0);
+        packet.insert(packet.end(), 8, 0);
+        packet.insert(packet.end(), datagram.begin(), datagram.end());
+        return (packet);
+    }
+
+    /// \brief Builds an IPv6 packet with a Hop-by-Hop Options header.
+    ///
+    /// \param datagram UDP datagram.
+    static std::vector<uint8_t> ipv6(const std::vector<uint8_t>& datagram) {
+        std::vector<uint8_t> packet;
+        packet.push_back(0x60);
+        packet.insert(packet.end(), 3, 0);
+        append16(packet, datagram.size() + 8);
+        packet.push_back(0);
+        packet.push_back(1);
+        packet.insert(packet.end(), 32, 0);
+        // Hop-by-Hop Options header with a PadN option.
+        packet.push_back(IPPROTO_UDP);
+        packet.push_back(0);
+        packet.push_back(1);
+        packet.push_back(4);
+        packet.insert(packet.end(), 4, 0);
+        packet.insert(packet.end(), datagram.begin(), datagram.end());
+        return (packet);
+    }
+
+    /// \brief Builds an Ethernet frame.
+    ///
+    /// \param ether_type type of the payload.
+    /// \param payload frame payload.
+    /// \param vlan true if the frame should be 802.1Q tagged.
+    static std::vector<uint8_t> ethernet(const uint16_t ether_type,
+                                         const std::vector<uint8_t>& payload,
+                                         const bool vlan = false) {
+        std::vector<uint8_t> frame(12, 0xaa);
+        if (vlan) {
+            append16(frame, 0x8100);
+            append16(frame, 42);
+        }
+        append16(frame, ether_type);
+        frame.insert(frame.end(), payload.begin(), payload.end());
+        // Ethernet padding must be ignored.
+        frame.insert(frame.end(), 4, 0);
+        return (frame);
+    }
+
+    /// \brief Builds a DHCPv4 message in the wire format.
+    ///
+    /// \param type message type.
+    /// \param transid transaction id.
+    static std::vector<uint8_t> dhcp4(const uint8_t type,
+                                      const uint32_t transid) {
+        Pkt4 pkt(type, transid);
+        pkt.pack();
+        const uint8_t* data =
+            static_cast<const uint8_t*>(pkt.getBuffer().getData());
+        return (std::vector<uint8_t>(data, data + pkt.getBuffer().getLength()));
+    }
+
+    /// \brief Builds a DHCPv6 message in the wire format.
+    ///
+    /// \param type message type.
+    /// \param transid transaction id.
+    static std::vector<uint8_t> dhcp6(const uint8_t type,
+                                      const uint32_t transid) {
+        Pkt6 pkt(type, transid);
+        pkt.pack();
+        const uint8_t* data =
+            static_cast<const uint8_t*>(pkt.getBuffer().getData());
+        return (std::vector<uint8_t>(data, data + pkt.getBuffer().getLength()));
+    }
+
+    /// \brief Writes the capture file.
+    ///
+    /// \param link_type link type of the frames.
+    /// \param frames captured frames.
+    /// \param big_endian true if the headers are in big endian order.
+    /// \param nsec true if the timestamps have a nanosecond resolution.
+    /// \param truncate number of bytes to remove from the end of the file.
+    void writeCapture(const uint32_t link_type,
+                      const std::vector<Frame>& frames,
+                      const bool big_endian = false,
+                      const bool nsec = false,
+                      const size_t truncate = 0) const {
+        std::vector<uint8_t> contents;
+        append32(contents, nsec ? 0xa1b23c4d : 0xa1b2c3d4, big_endian);
+        append16(contents, big_endian ? 2 : 0x0200);
+        append16(contents, big_endian ? 4 : 0x0400);
+        append32(contents, 0, big_endian);
+        append32(contents, 0, big_endian);
+        append32(contents, 65535, big_endian);
+        append32(contents, link_type, big_endian);
+        for (std::vector<Frame>::const_iterator frame = frames.begin();
+             frame != frames.end(); ++frame) {
+            append32(contents, frame->sec_, big_endian);
+            append32(contents, frame->frac_, big_endian);
+            append32(contents, frame->data_.size(), big_endian);
+            append32(contents, frame->data_.size(), big_endian);
+            contents.insert(contents.end(), frame->data_.begin(),
+                            frame->data_.end());
+        }
+        contents.resize(contents.size() - truncate);
+        writeFile(contents);
+    }
+
+    /// \brief Writes raw data into the capture file.
+    ///
+    /// \param contents file contents.
+    void writeFile(const std::vector<uint8_t>& contents) const {
+        std::ofstream file(PCAP_FILE_NAME, std::ios::out | std::ios::binary |
+                           std::ios::trunc);
+        ASSERT_TRUE(file.is_open());
+        file.write(reinterpret_cast<const char*>(&contents[0]),
+                   contents.size());
+        file.close();
+    }
+
+    /// \brief Creates a captured frame.
+    static Frame frame(const uint32_t sec, const uint32_t frac,
+                       const std::vector<uint8_t>& data) {
+        Frame f;
+        f.sec_ = sec;
+        f.frac_ = frac;
+        f.data_ = data;
+        return (f);
+    }
+};
+
+// Test that invalid files are rejected.
+TEST_F(PcapFileTest, invalidFiles) {
+    EXPECT_THROW(PcapFile("nonexistent.pcap", 4), isc::BadValue);
+
+    // Invalid IP version.
+    writeCapture(1, std::vector<Frame>());
+    EXPECT_THROW(PcapFile(PCAP_FILE_NAME, 5), isc::BadValue);
+
+    // Not a pcap file.
+    std::vector<uint8_t> contents(100, 'x');
+    writeFile(contents);
+    EXPECT_THROW(PcapFile(PCAP_FILE_NAME, 4), isc::BadValue);
+
+    // A pcapng file.
+    contents[0] = 0x0a;
+    contents[1] = 0x0d;
+    contents[2] = 0x0d;
+    contents[3] = 0x0a;
+    writeFile(contents);
+    EXPECT_THROW(PcapFile(PCAP_FILE_NAME, 4), isc::BadValue);
+
+    // Unsupported link type.
+    writeCapture(105, std::vector<Frame>());
+    EXPECT_THROW(PcapFile(PCAP_FILE_NAME, 4), isc::BadValue);
+
+    // No DHCP message.
+    writeCapture(1, std::vector<Frame>());
+    EXPECT_THROW(PcapFile(PCAP_FILE_NAME, 4), isc::OutOfRange);
+}
+
+// Test that the DHCPv4 messages sent to a server are extracted from
+// an Ethernet capture, and that other frames are skipped.
+TEST_F(PcapFileTest, ethernet4) {
+    std::vector<Frame> frames;
+    const std::vector<uint8_t> discover = dhcp4(DHCPDISCOVER, 1);
+    const std::vector<uint8_t> request = dhcp4(DHCPREQUEST, 2);
+    frames.push_back(frame(100, 500000,
+                           ethernet(0x0800, ipv4(udp(67, discover)))));
+    // Server response.
+    frames.push_back(frame(100, 600000,
+                           ethernet(0x0800, ipv4(udp(68, dhcp4(DHCPOFFER, 1))))));
+    // Not a DHCP message.
+    frames.push_back(frame(100, 700000,
+                           ethernet(0x0800, ipv4(udp(53, discover)))));
+    // IP fragment.
+    frames.push_back(frame(100, 800000,
+                           ethernet(0x0800, ipv4(udp(67, discover), true))));
+    // IPv6 frame.
+    frames.push_back(frame(100, 900000,
+                           ethernet(0x86dd, ipv6(udp(547, discover)))));
+    // Tagged frame.
+    frames.push_back(frame(101, 0,
+                           ethernet(0x0800, ipv4(udp(67, request)), true)));
+    writeCapture(1, frames);
+
+    boost::scoped_ptr<PcapFile> capture;
+    ASSERT_NO_THROW(capture.reset(new PcapFile(PCAP_FILE_NAME, 4)));
+    const PcapFile::RecordCollection& records = capture->getRecords();
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(4, capture->getSkippedNum());
+    EXPECT_TRUE(records[0].data_ == discover);
+    EXPECT_EQ(0, records[0].offset_.total_microseconds());
+    EXPECT_TRUE(records[1].data_ == request);
+    EXPECT_EQ(500000, records[1].offset_.total_microseconds());
+    EXPECT_EQ(500000, capture->getDuration().total_microseconds());
+}
+
+// Test that big endian captures with nanosecond timestamps are read and
+// that the offsets never go back in time.
+TEST_F(PcapFileTest, bigEndianNsec) {
+    std::vector<Frame> frames;
+    const std::vector<uint8_t> discover = dhcp4(DHCPDISCOVER, 1);
+    frames.push_back(frame(10, 250000000, ipv4(udp(67, discover))));
+    frames.push_back(frame(10, 750000000, ipv4(udp(67, discover))));
+    frames.push_back(frame(10, 500000000, ipv4(udp(67, discover))));
+    writeCapture(101, frames, true, true);
+
+    boost::scoped_ptr<PcapFile> capture;
+    ASSERT_NO_THROW(capture.reset(new PcapFile(PCAP_FILE_NAME, 4)));
+    const PcapFile::RecordCollection& records = capture->getRecords();
+    ASSERT_EQ(3, records.size());
+    EXPECT_EQ(0, records[0].offset_.total_microseconds());
+    EXPECT_EQ(500000, records[1].offset_.total_microseconds());
+    EXPECT_EQ(500000, records[2].offset_.total_microseconds());
+}
+
+// Test that the DHCPv6 client messages are extracted from a Linux cooked
+// capture and that the truncated last record is skipped.
+TEST_F(PcapFileTest, linuxCooked6) {
+    std::vector<Frame> frames;
+    const std::vector<uint8_t> solicit = dhcp6(DHCPV6_SOLICIT, 1);
+    const std::vector<uint8_t> renew = dhcp6(DHCPV6_RENEW, 2);
+    const std::vector<uint8_t> header(16, 0);
+    std::vector<uint8_t> data = header;
+    std::vector<uint8_t> packet = ipv6(udp(547, solicit));
+    data.insert(data.end(), packet.begin(), packet.end());
+    frames.push_back(frame(1, 0, data));
+    // Server response.
+    data = header;
+    packet = ipv6(udp(547, dhcp6(DHCPV6_ADVERTISE, 1)));
+    data.insert(data.end(), packet.begin(), packet.end());
+    frames.push_back(frame(1, 1, data));
+    data = header;
+    packet = ipv6(udp(547, renew));
+    data.insert(data.end(), packet.begin(), packet.end());
+    frames.push_back(frame(2, 0, data));
+    frames.push_back(frame(3, 0, data));
+    writeCapture(113, frames, false, false, 10);
+
+    boost::scoped_ptr<PcapFile> capture;
+    ASSERT_NO_THROW(capture.reset(new PcapFile(PCAP_FILE_NAME, 6)));
+    const PcapFile::RecordCollection& records = capture->getRecords();
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(2, capture->getSkippedNum());
+    EXPECT_TRUE(records[0].data_ == solicit);
+    EXPECT_TRUE(records[1].data_ == renew);
+    EXPECT_EQ(1000000, capture->getDuration().total_microseconds());
+
+    // There is no DHCPv4 message.
+    EXPECT_THROW(PcapFile(PCAP_FILE_NAME, 4), isc::OutOfRange);
+}
+
+} // end of anonymous namespace
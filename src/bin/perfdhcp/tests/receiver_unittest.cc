@@ -0,0 +1,174 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/pkt4.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+#include "receiver.h"
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Port the receiver's socket is bound to.
+const uint16_t RECEIVER_PORT = 10068;
+
+/// \brief Test fixture class for the \ref Receiver.
+///
+/// It opens a socket on the loopback address through the IfaceMgr,
+/// which the receiver thread uses, and a plain UDP socket used to
+/// send packets to it.
+class ReceiverTest : public ::testing::Test {
+public:
+
+    /// \brief Constructor.
+    ReceiverTest() : sender_fd_(-1), matched_num_(0) {
+        IfaceMgr::instance().closeSockets();
+        receiver_fd_ = IfaceMgr::instance().
+            openSocketFromAddress(IOAddress("127.0.0.1"), RECEIVER_PORT);
+        sender_fd_ = socket(AF_INET, SOCK_DGRAM, 0);
+    }
+
+    /// \brief Destructor.
+    virtual ~ReceiverTest() {
+        if (sender_fd_ >= 0) {
+            close(sender_fd_);
+        }
+        IfaceMgr::instance().closeSockets();
+    }
+
+    /// \brief Sends a DHCPOFFER to the receiver's socket.
+    ///
+    /// \param transid transaction id of the packet.
+    void sendOffer(const uint32_t transid) {
+        Pkt4 pkt(DHCPOFFER, transid);
+        pkt.pack();
+        struct sockaddr_in to;
+        memset(&to, 0, sizeof(to));
+        to.sin_family = AF_INET;
+        to.sin_port = htons(RECEIVER_PORT);
+        to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_GT(sendto(sender_fd_, pkt.getBuffer().getData(),
+                         pkt.getBuffer().getLength(), 0,
+                         reinterpret_cast<struct sockaddr*>(&to),
+                         sizeof(to)), 0);
+    }
+
+    /// \brief Match callback.
+    ///
+    /// Packets with an even transaction id are passed to the main
+    /// thread, the other ones are only counted.
+    bool match(const PktPtr& pkt, PktPtr& sent) {
+        Mutex::Locker lock(mutex_);
+        ++matched_num_;
+        sent = pkt;
+        return ((pkt->getTransid() % 2) == 0);
+    }
+
+    /// \brief Returns the number of packets passed to the callback.
+    size_t getMatchedNum() {
+        Mutex::Locker lock(mutex_);
+        return (matched_num_);
+    }
+
+    /// \brief Socket opened by the IfaceMgr.
+    int receiver_fd_;
+
+    /// \brief Socket used to send packets to the receiver.
+    int sender_fd_;
+
+    /// \brief Mutex protecting the number of matched packets.
+    Mutex mutex_;
+
+    /// \brief Number of packets passed to the callback.
+    size_t matched_num_;
+};
+
+// Test that invalid constructor parameters are rejected.
+TEST_F(ReceiverTest, constructor) {
+    Receiver::MatchCallback callback =
+        boost::bind(&ReceiverTest::match, this, _1, _2);
+    EXPECT_THROW(Receiver(5, callback), isc::BadValue);
+    EXPECT_THROW(Receiver(4, callback, 0), isc::BadValue);
+    EXPECT_THROW(Receiver(4, Receiver::MatchCallback()), isc::BadValue);
+    EXPECT_NO_THROW(Receiver(4, callback));
+    EXPECT_NO_THROW(Receiver(6, callback, 1));
+}
+
+// Test that the receiver thread can be started and stopped.
+TEST_F(ReceiverTest, startStop) {
+    Receiver receiver(4, boost::bind(&ReceiverTest::match, this, _1, _2));
+    EXPECT_FALSE(receiver.isRunning());
+    ASSERT_NO_THROW(receiver.start());
+    EXPECT_TRUE(receiver.isRunning());
+    EXPECT_THROW(receiver.start(), isc::InvalidOperation);
+    ASSERT_NO_THROW(receiver.stop());
+    EXPECT_FALSE(receiver.isRunning());
+    // Stopping a stopped receiver is no-op.
+    EXPECT_NO_THROW(receiver.stop());
+    // The receiver may be restarted.
+    ASSERT_NO_THROW(receiver.start());
+    EXPECT_TRUE(receiver.isRunning());
+}
+
+// Test that received packets are passed to the callback and those
+// requiring an action are queued for the main thread.
+TEST_F(ReceiverTest, receive) {
+    ASSERT_GE(receiver_fd_, 0);
+    ASSERT_GE(sender_fd_, 0);
+
+    // Use a small batch size so as the packets are queued in several
+    // batches.
+    Receiver receiver(4, boost::bind(&ReceiverTest::match, this, _1, _2), 3);
+    ASSERT_NO_THROW(receiver.start());
+
+    const uint32_t packets_num = 10;
+    for (uint32_t transid = 0; transid < packets_num; ++transid) {
+        sendOffer(transid);
+    }
+
+    // Collect the responses, waiting no longer than a few seconds.
+    Receiver::ResponseList responses;
+    for (int i = 0; (i < 50) && ((responses.size() < packets_num / 2) ||
+                                (getMatchedNum() < packets_num)); ++i) {
+        receiver.waitForResponses(100000);
+        receiver.getResponses(responses);
+    }
+    receiver.stop();
+
+    EXPECT_EQ(packets_num, getMatchedNum());
+    EXPECT_EQ(packets_num, receiver.getReceivedNum());
+    ASSERT_EQ(packets_num / 2, responses.size());
+    for (Receiver::ResponseList::const_iterator response = responses.begin();
+         response != responses.end(); ++response) {
+        ASSERT_TRUE(response->rcvd_);
+        EXPECT_EQ(DHCPOFFER, response->rcvd_->getType());
+        EXPECT_EQ(0, response->rcvd_->getTransid() % 2);
+        EXPECT_EQ(response->rcvd_, response->sent_);
+    }
+
+    // The queue has been emptied.
+    EXPECT_FALSE(receiver.waitForResponses(0));
+    EXPECT_EQ(0, receiver.getResponses(responses));
+}
+
+} // end of anonymous namespace
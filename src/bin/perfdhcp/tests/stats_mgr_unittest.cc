@@ -508,6 +508,22 @@ TEST_F(StatsMgrTest, Delays) {
     passDOPacketsWithDelay(stats_mgr, delay2, common_transid + 1);
     // Standard deviation is expected to be non-zero.
     EXPECT_GT(stats_mgr->getStdDevDelay(StatsMgr4::XCHG_DO), 0);
+
+    // The median is the shorter delay and the highest percentiles are
+    // the longer delay, within the histogram precision.
+    const double min_delay = stats_mgr->getMinDelay(StatsMgr4::XCHG_DO);
+    const double max_delay = stats_mgr->getMaxDelay(StatsMgr4::XCHG_DO);
+    EXPECT_NEAR(min_delay,
+                stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 50),
+                min_delay * 0.01);
+    EXPECT_NEAR(max_delay,
+                stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 99),
+                max_delay * 0.01);
+    EXPECT_NEAR(max_delay,
+                stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 100),
+                1e-6);
+    EXPECT_THROW(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 101),
+                 isc::BadValue);
 }
 
 TEST_F(StatsMgrTest, CustomCounters) {
@@ -569,6 +585,11 @@ TEST_F(StatsMgrTest, PrintStats) {
     // archived because it relies on counters. There is at least one
     // exchange needed to count the average delay and std deviation.
     EXPECT_NO_THROW(stats_mgr->printStats());
+    EXPECT_NO_THROW(stats_mgr->printStatsJSON());
+    EXPECT_NO_THROW(stats_mgr->printStatsCSV());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStats());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStatsJSON());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStatsCSV());
 
     // Printing timestamps is expected to fail because by default we
     // disable packets archiving mode. Without packets we can't get
@@ -0,0 +1,193 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/address_value.h>
+#include <exceptions/exceptions.h>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+namespace {
+
+/// @brief Reads a 64 bits integer in network byte order.
+///
+/// @param data pointer to the integer
+uint64_t
+readUint64(const uint8_t* data) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | data[i];
+    }
+    return (value);
+}
+
+/// @brief Writes a 64 bits integer in network byte order.
+///
+/// @param value integer to be written
+/// @param [out] data pointer to the buffer
+void
+writeUint64(uint64_t value, uint8_t* data) {
+    for (int i = 7; i >= 0; --i) {
+        data[i] = static_cast<uint8_t>(value);
+        value >>= 8;
+    }
+}
+
+/// @brief Returns a mask with the given number of least significant bits set.
+///
+/// @param bits number of bits (0-64)
+uint64_t
+lowBits(const unsigned int bits) {
+    return (bits >= 64 ? ~static_cast<uint64_t>(0) :
+            (static_cast<uint64_t>(1) << bits) - 1);
+}
+
+}
+
+namespace isc {
+namespace asiolink {
+
+AddressValue::AddressValue(const IOAddress& address)
+    : high_(0), low_(0), v6_(address.asio_address_.is_v6()) {
+    if (!v6_) {
+        low_ = address.asio_address_.to_v4().to_ulong();
+    } else {
+        const boost::asio::ip::address_v6::bytes_type bytes =
+            address.asio_address_.to_v6().to_bytes();
+        high_ = readUint64(&bytes[0]);
+        low_ = readUint64(&bytes[8]);
+    }
+}
+
+AddressValue
+AddressValue::fromBytes(const short family, const uint8_t* data) {
+    if (data == NULL) {
+        isc_throw(BadValue, "NULL pointer received.");
+    }
+    if (family == AF_INET) {
+        return (AddressValue((static_cast<uint32_t>(data[0]) << 24) |
+                             (static_cast<uint32_t>(data[1]) << 16) |
+                             (static_cast<uint32_t>(data[2]) << 8) |
+                             static_cast<uint32_t>(data[3])));
+    } else if (family == AF_INET6) {
+        return (AddressValue(readUint64(data), readUint64(data + 8)));
+    }
+    isc_throw(BadValue, "Invalid family type. Only AF_INET and AF_INET6"
+              << " are supported");
+}
+
+IOAddress
+AddressValue::toIOAddress() const {
+    if (!v6_) {
+        return (IOAddress(toUint32()));
+    }
+    boost::asio::ip::address_v6::bytes_type bytes;
+    toBytes(&bytes[0]);
+    return (IOAddress(boost::asio::ip::address(
+                          boost::asio::ip::address_v6(bytes))));
+}
+
+void
+AddressValue::toBytes(uint8_t* data) const {
+    if (!v6_) {
+        const uint32_t v4address = toUint32();
+        data[0] = static_cast<uint8_t>(v4address >> 24);
+        data[1] = static_cast<uint8_t>(v4address >> 16);
+        data[2] = static_cast<uint8_t>(v4address >> 8);
+        data[3] = static_cast<uint8_t>(v4address);
+    } else {
+        writeUint64(high_, data);
+        writeUint64(low_, data + 8);
+    }
+}
+
+AddressValue
+AddressValue::firstInPrefix(const uint8_t len) const {
+    AddressValue first(*this);
+    if (!v6_) {
+        if (len > 32) {
+            isc_throw(BadValue, "Too large netmask. 0..32 is allowed in IPv4");
+        }
+        first.low_ &= ~lowBits(32 - len) & 0xffffffff;
+    } else {
+        if (len > 128) {
+            isc_throw(BadValue, "Too large netmask. 0..128 is allowed in IPv6");
+        }
+        if (len <= 64) {
+            first.high_ &= ~lowBits(64 - len);
+            first.low_ = 0;
+        } else {
+            first.low_ &= ~lowBits(128 - len);
+        }
+    }
+    return (first);
+}
+
+AddressValue
+AddressValue::lastInPrefix(const uint8_t len) const {
+    AddressValue last(*this);
+    if (!v6_) {
+        if (len > 32) {
+            isc_throw(BadValue, "Too large netmask. 0..32 is allowed in IPv4");
+        }
+        last.low_ |= lowBits(32 - len);
+    } else {
+        if (len > 128) {
+            isc_throw(BadValue, "Too large netmask. 0..128 is allowed in IPv6");
+        }
+        if (len <= 64) {
+            last.high_ |= lowBits(64 - len);
+            last.low_ = ~static_cast<uint64_t>(0);
+        } else {
+            last.low_ |= lowBits(128 - len);
+        }
+    }
+    return (last);
+}
+
+AddressValue
+AddressValue::nextPrefix(const uint8_t len) const {
+    AddressValue next(*this);
+    if (!v6_) {
+        if ((len < 1) || (len > 32)) {
+            isc_throw(BadValue, "Cannot increase prefix: invalid prefix"
+                      " length: " << static_cast<unsigned>(len));
+        }
+        next.low_ = static_cast<uint32_t>(low_ +
+                                          (static_cast<uint64_t>(1) << (32 - len)));
+    } else {
+        if ((len < 1) || (len > 128)) {
+            isc_throw(BadValue, "Cannot increase prefix: invalid prefix"
+                      " length: " << static_cast<unsigned>(len));
+        }
+        if (len <= 64) {
+            next.high_ += static_cast<uint64_t>(1) << (64 - len);
+        } else {
+            next.low_ += static_cast<uint64_t>(1) << (128 - len);
+            if (next.low_ < low_) {
+                ++next.high_;
+            }
+        }
+    }
+    return (next);
+}
+
+AddressValue
+AddressValue::subtract(const AddressValue& a, const AddressValue& b) {
+    if (a.v6_ != b.v6_) {
+        isc_throw(BadValue, "Both addresses have to be the same family");
+    }
+    if (!a.v6_) {
+        return (AddressValue(static_cast<uint32_t>(a.low_ - b.low_)));
+    }
+    const uint64_t borrow = (a.low_ < b.low_ ? 1 : 0);
+    return (AddressValue(a.high_ - b.high_ - borrow, a.low_ - b.low_));
+}
+
+} // namespace asiolink
+} // namespace isc
@@ -0,0 +1,208 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ADDRESS_VALUE_H
+#define ADDRESS_VALUE_H
+
+#include <asiolink/io_address.h>
+
+#include <stdint.h>
+
+namespace isc {
+namespace asiolink {
+
+/// @brief Numeric value of an IPv4 or IPv6 address.
+///
+/// The @c IOAddress wraps the ASIO address, which is convenient for
+/// conversions from and to text and sockets, but not for arithmetic:
+/// most operations go through arrays of bytes. This class holds an
+/// address as a 128 bits integer made of two 64 bits halves (the IPv4
+/// addresses only use the low half) so as the comparisons, increments
+/// and prefix computations are performed with a few integer operations
+/// and without memory allocation.
+///
+/// It is used internally on the hot paths: pool and subnet range checks,
+/// address and prefix allocation and lease storage keys. The addresses
+/// are ordered like @c IOAddress objects: by family first (IPv4 before
+/// IPv6), then numerically.
+class AddressValue {
+public:
+
+    /// @brief Constructor of the IPv4 zero address.
+    AddressValue()
+        : high_(0), low_(0), v6_(false) {
+    }
+
+    /// @brief Constructor of an IPv4 address.
+    ///
+    /// @param v4address IPv4 address in host byte order
+    explicit AddressValue(const uint32_t v4address)
+        : high_(0), low_(v4address), v6_(false) {
+    }
+
+    /// @brief Constructor of an IPv6 address.
+    ///
+    /// @param high most significant 64 bits of the address
+    /// @param low least significant 64 bits of the address
+    AddressValue(const uint64_t high, const uint64_t low)
+        : high_(high), low_(low), v6_(true) {
+    }
+
+    /// @brief Constructor from an @c IOAddress.
+    ///
+    /// @param address address to be converted
+    explicit AddressValue(const IOAddress& address);
+
+    /// @brief Creates an address from over wire data.
+    ///
+    /// @param family AF_INET for IPv4 or AF_INET6 for IPv6
+    /// @param data pointer to the address in network byte order
+    ///
+    /// @throw BadValue if the family is invalid or the pointer is null.
+    static AddressValue fromBytes(const short family, const uint8_t* data);
+
+    /// @brief Converts the value to an @c IOAddress.
+    IOAddress toIOAddress() const;
+
+    /// @brief Writes the address in network byte order.
+    ///
+    /// @param [out] data buffer of at least 4 bytes for an IPv4 address
+    /// and 16 bytes for an IPv6 address
+    void toBytes(uint8_t* data) const;
+
+    /// @brief Checks if this is an IPv4 address.
+    bool isV4() const {
+        return (!v6_);
+    }
+
+    /// @brief Checks if this is an IPv6 address.
+    bool isV6() const {
+        return (v6_);
+    }
+
+    /// @brief Returns the IPv4 address in host byte order.
+    ///
+    /// The value is meaningless for an IPv6 address.
+    uint32_t toUint32() const {
+        return (static_cast<uint32_t>(low_));
+    }
+
+    /// @brief Returns the most significant 64 bits of an IPv6 address.
+    uint64_t getHigh() const {
+        return (high_);
+    }
+
+    /// @brief Returns the least significant 64 bits of the address.
+    uint64_t getLow() const {
+        return (low_);
+    }
+
+    /// @brief Compares two addresses for equality.
+    ///
+    /// @param other address to compare to
+    bool operator==(const AddressValue& other) const {
+        return ((low_ == other.low_) && (high_ == other.high_) &&
+                (v6_ == other.v6_));
+    }
+
+    /// @brief Compares two addresses for inequality.
+    ///
+    /// @param other address to compare to
+    bool operator!=(const AddressValue& other) const {
+        return (!operator==(other));
+    }
+
+    /// @brief Checks if this address is smaller than the other.
+    ///
+    /// IPv4 addresses are smaller than IPv6 addresses.
+    ///
+    /// @param other address to compare to
+    bool operator<(const AddressValue& other) const {
+        if (v6_ != other.v6_) {
+            return (other.v6_);
+        }
+        return ((high_ < other.high_) ||
+                ((high_ == other.high_) && (low_ < other.low_)));
+    }
+
+    /// @brief Checks if this address is smaller than or equal to the other.
+    ///
+    /// @param other address to compare to
+    bool operator<=(const AddressValue& other) const {
+        return (!other.operator<(*this));
+    }
+
+    /// @brief Checks if the address is within a range.
+    ///
+    /// @param first first address of the range
+    /// @param last last address of the range
+    bool inRange(const AddressValue& first, const AddressValue& last) const {
+        return ((first <= *this) && (*this <= last));
+    }
+
+    /// @brief Increases the address by one.
+    ///
+    /// The address space loops: the largest address of a family becomes
+    /// the zero address of that family.
+    AddressValue& increase() {
+        if (!v6_) {
+            low_ = static_cast<uint32_t>(low_ + 1);
+        } else if (++low_ == 0) {
+            ++high_;
+        }
+        return (*this);
+    }
+
+    /// @brief Returns the address with the host bits cleared.
+    ///
+    /// @param len prefix length (0-32 for IPv4, 0-128 for IPv6)
+    /// @throw BadValue if the prefix length is too large.
+    AddressValue firstInPrefix(const uint8_t len) const;
+
+    /// @brief Returns the address with the host bits set.
+    ///
+    /// @param len prefix length (0-32 for IPv4, 0-128 for IPv6)
+    /// @throw BadValue if the prefix length is too large.
+    AddressValue lastInPrefix(const uint8_t len) const;
+
+    /// @brief Returns the next prefix of the given length.
+    ///
+    /// The least significant bit of the prefix is increased, e.g. the
+    /// prefix following 2001:db8:0:ff00::/56 is 2001:db8:1::/56. The
+    /// address space loops like for @c increase.
+    ///
+    /// @param len prefix length (1-32 for IPv4, 1-128 for IPv6)
+    /// @throw BadValue if the prefix length is invalid.
+    AddressValue nextPrefix(const uint8_t len) const;
+
+    /// @brief Subtracts an address from another (a - b).
+    ///
+    /// The addresses are treated as integers, see
+    /// @c IOAddress::subtract.
+    ///
+    /// @param a address to be subtracted from
+    /// @param b address to be subtracted
+    /// @throw BadValue if the addresses are of different families.
+    static AddressValue subtract(const AddressValue& a,
+                                 const AddressValue& b);
+
+private:
+
+    /// @brief Most significant 64 bits of an IPv6 address, 0 for IPv4.
+    uint64_t high_;
+
+    /// @brief Least significant 64 bits of an IPv6 address, or the IPv4
+    /// address.
+    uint64_t low_;
+
+    /// @brief True for an IPv6 address.
+    bool v6_;
+};
+
+} // namespace asiolink
+} // namespace isc
+
+#endif // ADDRESS_VALUE_H
@@ -6,12 +6,11 @@
 
 #include <config.h>
 #include <asiolink/asio_wrapper.h>
+#include <asiolink/address_value.h>
 #include <asiolink/io_address.h>
 #include <asiolink/io_error.h>
 #include <exceptions/exceptions.h>
 
-#include <boost/static_assert.hpp>
-
 #include <unistd.h>             // for some IPC/network system calls
 #include <stdint.h>
 #include <sys/socket.h>
@@ -61,10 +60,9 @@ IOAddress::fromBytes(short family, const uint8_t* data) {
                   << "are supported");
     }
 
-    BOOST_STATIC_ASSERT(INET6_ADDRSTRLEN >= INET_ADDRSTRLEN);
-    char addr_str[INET6_ADDRSTRLEN];
-    inet_ntop(family, data, addr_str, INET6_ADDRSTRLEN);
-    return IOAddress(string(addr_str));
+    // Build the address from its numeric value rather than going
+    // through its textual representation.
+    return (AddressValue::fromBytes(family, data).toIOAddress());
 }
 
 std::vector<uint8_t>
@@ -132,44 +130,15 @@ IOAddress::subtract(const IOAddress& a, const IOAddress& b) {
         // Subtracting v4 is easy. We have a conversion function to uint32_t.
         return (IOAddress(a.toUint32() - b.toUint32()));
     } else {
-        // v6 is more involved.
-
-        // Let's extract the raw data first.
-        vector<uint8_t> a_vec = a.toBytes();
-        vector<uint8_t> b_vec = b.toBytes();
-
-        // ... and prepare the result
-        vector<uint8_t> result(V6ADDRESS_LEN,0);
-
-        // Carry is a boolean, but to avoid its frequent casting, let's
-        // use uint8_t. Also, some would prefer to call it borrow, but I prefer
-        // carry. Somewhat relevant discussion here:
-        // http://en.wikipedia.org/wiki/Carry_flag#Carry_flag_vs._Borrow_flag
-        uint8_t carry = 0;
-
-        // Now perform subtraction with borrow.
-        for (int i = a_vec.size() - 1; i >= 0; --i) {
-            result[i] = a_vec[i] - b_vec[i] - carry;
-            carry = (a_vec[i] < b_vec[i] + carry);
-        }
-
-        return (fromBytes(AF_INET6, &result[0]));
+        // v6 is more involved: subtract the numeric values with borrow.
+        return (AddressValue::subtract(AddressValue(a),
+                                       AddressValue(b)).toIOAddress());
     }
 }
 
 IOAddress
 IOAddress::increase(const IOAddress& addr) {
-    std::vector<uint8_t> packed(addr.toBytes());
-
-    // Start increasing the least significant byte
-    for (int i = packed.size() - 1; i >= 0; --i) {
-        // if we haven't overflowed (0xff -> 0x0), than we are done
-        if (++packed[i] != 0) {
-            break;
-        }
-    }
-
-    return (IOAddress::fromBytes(addr.getFamily(), &packed[0]));
+    return (AddressValue(addr).increase().toIOAddress());
 }
 
 
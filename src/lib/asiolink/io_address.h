@@ -29,6 +29,8 @@ namespace asiolink {
     /// Defines length of IPv4 address.
     const static size_t V4ADDRESS_LEN = 4;
 
+class AddressValue;
+
 /// \brief The \c IOAddress class represents an IP addresses (version
 /// agnostic)
 ///
@@ -311,6 +313,9 @@ public:
     //@}
 
 private:
+    /// @brief Reads the address without converting it to bytes.
+    friend class AddressValue;
+
     boost::asio::ip::address asio_address_;
 };
 
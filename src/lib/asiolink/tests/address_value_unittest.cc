@@ -0,0 +1,175 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <asiolink/address_value.h>
+#include <asiolink/io_address.h>
+#include <exceptions/exceptions.h>
+
+#include <string>
+
+using namespace isc;
+using namespace isc::asiolink;
+
+namespace {
+
+/// @brief Returns the text representation of a value.
+///
+/// @param value address value
+std::string
+toText(const AddressValue& value) {
+    return (value.toIOAddress().toText());
+}
+
+/// @brief Returns the value of an address given as text.
+///
+/// @param text address
+AddressValue
+fromText(const std::string& text) {
+    return (AddressValue(IOAddress(text)));
+}
+
+// Checks the conversions from and to IOAddress and bytes.
+TEST(AddressValueTest, conversions) {
+    AddressValue v4 = fromText("192.0.2.3");
+    EXPECT_TRUE(v4.isV4());
+    EXPECT_EQ(0xc0000203, v4.toUint32());
+    EXPECT_EQ("192.0.2.3", toText(v4));
+
+    AddressValue v6 = fromText("2001:db8:1::abcd:1");
+    EXPECT_TRUE(v6.isV6());
+    EXPECT_EQ(0x20010db800010000ULL, v6.getHigh());
+    EXPECT_EQ(0xabcd0001ULL, v6.getLow());
+    EXPECT_EQ("2001:db8:1::abcd:1", toText(v6));
+    EXPECT_EQ("2001:db8::1", toText(AddressValue(0x20010db8ULL << 32, 1)));
+
+    // An IPv4 address and an IPv6 address with the same numeric value
+    // are different.
+    EXPECT_TRUE(AddressValue(0, 0xc0000203) != v4);
+
+    const uint8_t v4_bytes[] = { 192, 0, 2, 3 };
+    EXPECT_TRUE(AddressValue::fromBytes(AF_INET, v4_bytes) == v4);
+    const uint8_t v6_bytes[] = { 0x20, 0x01, 0x0d, 0xb8, 0, 1, 0, 0,
+                                 0, 0, 0, 0, 0xab, 0xcd, 0, 1 };
+    EXPECT_TRUE(AddressValue::fromBytes(AF_INET6, v6_bytes) == v6);
+
+    uint8_t bytes[16];
+    v6.toBytes(bytes);
+    EXPECT_EQ(0, memcmp(bytes, v6_bytes, sizeof(v6_bytes)));
+    v4.toBytes(bytes);
+    EXPECT_EQ(0, memcmp(bytes, v4_bytes, sizeof(v4_bytes)));
+
+    EXPECT_THROW(AddressValue::fromBytes(AF_INET, NULL), BadValue);
+    EXPECT_THROW(AddressValue::fromBytes(AF_UNIX, v4_bytes), BadValue);
+}
+
+// Checks that the values are ordered like the IOAddress objects.
+TEST(AddressValueTest, compare) {
+    const char* addresses[] = {
+        "0.0.0.0", "192.0.2.1", "192.0.2.255", "255.255.255.255",
+        "::", "::1", "::ffff:ffff:ffff:ffff", "::1:0:0:0:0",
+        "2001:db8::1", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"
+    };
+    const size_t count = sizeof(addresses) / sizeof(addresses[0]);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < count; ++j) {
+            const IOAddress a(addresses[i]);
+            const IOAddress b(addresses[j]);
+            EXPECT_EQ(a < b, AddressValue(a) < AddressValue(b))
+                << a << " " << b;
+            EXPECT_EQ(a <= b, AddressValue(a) <= AddressValue(b))
+                << a << " " << b;
+            EXPECT_EQ(a == b, AddressValue(a) == AddressValue(b))
+                << a << " " << b;
+        }
+    }
+
+    EXPECT_TRUE(fromText("192.0.2.10").inRange(fromText("192.0.2.10"),
+                                               fromText("192.0.2.20")));
+    EXPECT_FALSE(fromText("192.0.2.21").inRange(fromText("192.0.2.10"),
+                                                fromText("192.0.2.20")));
+    EXPECT_TRUE(fromText("2001:db8::1:0").inRange(fromText("2001:db8::"),
+                                                  fromText("2001:db8::ffff:ffff")));
+    EXPECT_FALSE(fromText("192.0.2.10").inRange(fromText("::"),
+                                                fromText("ffff::")));
+}
+
+// Checks the increase of the addresses, including the carries and the
+// loop at the end of the address space.
+TEST(AddressValueTest, increase) {
+    EXPECT_EQ("192.0.2.1", toText(fromText("192.0.2.0").increase()));
+    EXPECT_EQ("192.0.3.0", toText(fromText("192.0.2.255").increase()));
+    EXPECT_EQ("0.0.0.0", toText(fromText("255.255.255.255").increase()));
+    EXPECT_EQ("2001:db8::1", toText(fromText("2001:db8::").increase()));
+    EXPECT_EQ("2001:db8:0:1::",
+              toText(fromText("2001:db8::ffff:ffff:ffff:ffff").increase()));
+    EXPECT_EQ("::",
+              toText(fromText("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff").increase()));
+}
+
+// Checks the first and last addresses of the prefixes.
+TEST(AddressValueTest, prefixBounds) {
+    AddressValue v4 = fromText("192.0.2.77");
+    EXPECT_EQ("192.0.2.64", toText(v4.firstInPrefix(26)));
+    EXPECT_EQ("192.0.2.127", toText(v4.lastInPrefix(26)));
+    EXPECT_EQ("0.0.0.0", toText(v4.firstInPrefix(0)));
+    EXPECT_EQ("255.255.255.255", toText(v4.lastInPrefix(0)));
+    EXPECT_EQ("192.0.2.77", toText(v4.firstInPrefix(32)));
+    EXPECT_EQ("192.0.2.77", toText(v4.lastInPrefix(32)));
+    EXPECT_THROW(v4.firstInPrefix(33), BadValue);
+    EXPECT_THROW(v4.lastInPrefix(33), BadValue);
+
+    AddressValue v6 = fromText("2001:db8:1:ff12:3456::1");
+    EXPECT_EQ("2001:db8:1:ff00::", toText(v6.firstInPrefix(56)));
+    EXPECT_EQ("2001:db8:1:ffff:ffff:ffff:ffff:ffff",
+              toText(v6.lastInPrefix(56)));
+    EXPECT_EQ("2001:db8:1:ff12::", toText(v6.firstInPrefix(64)));
+    EXPECT_EQ("2001:db8:1:ff12:ffff:ffff:ffff:ffff",
+              toText(v6.lastInPrefix(64)));
+    EXPECT_EQ("2001:db8:1:ff12:3400::", toText(v6.firstInPrefix(72)));
+    EXPECT_EQ("2001:db8:1:ff12:34ff:ffff:ffff:ffff",
+              toText(v6.lastInPrefix(72)));
+    EXPECT_EQ("::", toText(v6.firstInPrefix(0)));
+    EXPECT_EQ("2001:db8:1:ff12:3456::1", toText(v6.lastInPrefix(128)));
+    EXPECT_THROW(v6.firstInPrefix(129), BadValue);
+    EXPECT_THROW(v6.lastInPrefix(129), BadValue);
+}
+
+// Checks the next prefix computation.
+TEST(AddressValueTest, nextPrefix) {
+    EXPECT_EQ("2001:db8:1::",
+              toText(fromText("2001:db8:0:ff00::").nextPrefix(56)));
+    EXPECT_EQ("2001:db8:0:0:1::",
+              toText(fromText("2001:db8::").nextPrefix(80)));
+    EXPECT_EQ("2001:db8:0:1::",
+              toText(fromText("2001:db8::ffff:ffff:ffff:fff0").nextPrefix(124)));
+    EXPECT_EQ("2001:db8::2", toText(fromText("2001:db8::1").nextPrefix(128)));
+    EXPECT_EQ("::", toText(fromText("8000::").nextPrefix(1)));
+    EXPECT_EQ("192.0.3.0", toText(fromText("192.0.2.0").nextPrefix(24)));
+    EXPECT_EQ("0.0.0.0", toText(fromText("255.255.255.0").nextPrefix(24)));
+
+    EXPECT_THROW(fromText("2001:db8::").nextPrefix(0), BadValue);
+    EXPECT_THROW(fromText("2001:db8::").nextPrefix(129), BadValue);
+    EXPECT_THROW(fromText("192.0.2.0").nextPrefix(33), BadValue);
+}
+
+// Checks the subtraction of the addresses.
+TEST(AddressValueTest, subtract) {
+    EXPECT_EQ("0.0.0.16", toText(AddressValue::subtract(fromText("192.0.2.16"),
+                                                        fromText("192.0.2.0"))));
+    EXPECT_EQ("::ffff:ffff:ffff:ffff",
+              toText(AddressValue::subtract(fromText("2001:db8:0:1::"),
+                                            fromText("2001:db8::1"))));
+    EXPECT_EQ("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff",
+              toText(AddressValue::subtract(fromText("::"),
+                                            fromText("::1"))));
+    EXPECT_THROW(AddressValue::subtract(fromText("::1"),
+                                        fromText("192.0.2.1")), BadValue);
+}
+
+}
@@ -273,6 +273,113 @@ Element::createMap(const Position& pos) {
 // helper functions for fromJSON factory
 //
 namespace {
+
+/// @brief Reads JSON text from an input stream.
+///
+/// The parsing functions below are templates over the input so as the
+/// same code parses streams and contiguous buffers.
+class StreamInput {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param in input stream.
+    explicit StreamInput(std::istream& in) : in_(in) {
+    }
+
+    /// @brief Returns the next character without consuming it, or EOF.
+    int peek() {
+        return (in_.peek());
+    }
+
+    /// @brief Consumes and returns the next character, or EOF.
+    int get() {
+        return (in_.get());
+    }
+
+    /// @brief Consumes the next character.
+    void ignore() {
+        in_.ignore();
+    }
+
+    /// @brief Puts back the character returned by the last @c get.
+    void putback(const char c) {
+        in_.putback(c);
+    }
+
+private:
+    /// @brief The input stream.
+    std::istream& in_;
+};
+
+/// @brief Reads JSON text from a contiguous buffer.
+///
+/// When the comments are allowed, the lines starting with a hash are
+/// skipped as they are reached, which is equivalent to the
+/// @c Element::preprocess without copying the input.
+class BufferInput {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param data pointer to the text.
+    /// @param length length of the text.
+    /// @param skip_comments skip the lines starting with a hash.
+    BufferInput(const char* data, const size_t length, const bool skip_comments)
+        : begin_(data), cur_(data), end_(data + length),
+          skip_comments_(skip_comments) {
+    }
+
+    /// @brief Returns the next character without consuming it, or EOF.
+    int peek() {
+        skipComment();
+        return (cur_ < end_ ? static_cast<unsigned char>(*cur_) : EOF);
+    }
+
+    /// @brief Consumes and returns the next character, or EOF.
+    int get() {
+        skipComment();
+        return (cur_ < end_ ? static_cast<unsigned char>(*cur_++) : EOF);
+    }
+
+    /// @brief Consumes the next character.
+    void ignore() {
+        skipComment();
+        if (cur_ < end_) {
+            ++cur_;
+        }
+    }
+
+    /// @brief Puts back the character returned by the last @c get.
+    void putback(const char) {
+        --cur_;
+    }
+
+private:
+    /// @brief Skips a comment line, leaving its end of line.
+    void skipComment() {
+        if (skip_comments_ && (cur_ < end_) && (*cur_ == '#') &&
+            ((cur_ == begin_) || (cur_[-1] == '\n'))) {
+            const void* eol = std::memchr(cur_, '\n', end_ - cur_);
+            cur_ = (eol ? static_cast<const char*>(eol) : end_);
+        }
+    }
+
+    /// @brief Beginning of the text.
+    const char* begin_;
+
+    /// @brief Next character to read.
+    const char* cur_;
+
+    /// @brief End of the text.
+    const char* end_;
+
+    /// @brief Skip the comment lines.
+    bool skip_comments_;
+};
+
+template<typename Input>
+ElementPtr
+fromInput(Input& in, const std::string& file, int& line, int& pos);
+
 bool
 charIn(const int c, const char* chars) {
     const size_t chars_len = std::strlen(chars);
@@ -284,8 +391,9 @@ charIn(const int c, const char* chars) {
     return (false);
 }
 
+template<typename Input>
 void
-skipChars(std::istream& in, const char* chars, int& line, int& pos) {
+skipChars(Input& in, const char* chars, int& line, int& pos) {
     int c = in.peek();
     while (charIn(c, chars) && c != EOF) {
         if (c == '\n') {
@@ -304,8 +412,9 @@ skipChars(std::istream& in, const char* chars, int& line, int& pos) {
 // unless that character is specified in the optional may_skip
 //
 // It returns the found character (as an int value).
+template<typename Input>
 int
-skipTo(std::istream& in, const std::string& file, int& line,
+skipTo(Input& in, const std::string& file, int& line,
        int& pos, const char* chars, const char* may_skip="")
 {
     int c = in.get();
@@ -339,11 +448,12 @@ skipTo(std::istream& in, const std::string& file, int& line,
 
 // TODO: Should we check for all other official escapes here (and
 // error on the rest)?
+template<typename Input>
 std::string
-strFromStringstream(std::istream& in, const std::string& file,
+strFromStringstream(Input& in, const std::string& file,
                     const int line, int& pos) throw (JSONError)
 {
-    std::stringstream ss;
+    std::string s;
     int c = in.get();
     ++pos;
     if (c == '"') {
@@ -388,43 +498,46 @@ strFromStringstream(std::istream& in, const std::string& file,
             in.ignore();
             ++pos;
         }
-        ss.put(c);
+        s.push_back(static_cast<char>(c));
         c = in.get();
         ++pos;
     }
     if (c == EOF) {
         throwJSONError("Unterminated string", file, line, pos);
     }
-    return (ss.str());
+    return (s);
 }
 
+template<typename Input>
 std::string
-wordFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+wordFromStringstream(Input& in, int& pos) {
+    std::string s;
     while (isalpha(in.peek())) {
-        ss << (char) in.get();
+        s.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += s.size();
+    return (s);
 }
 
+template<typename Input>
 std::string
-numberFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+numberFromStringstream(Input& in, int& pos) {
+    std::string s;
     while (isdigit(in.peek()) || in.peek() == '+' || in.peek() == '-' ||
            in.peek() == '.' || in.peek() == 'e' || in.peek() == 'E') {
-        ss << (char) in.get();
+        s.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += s.size();
+    return (s);
 }
 
 // Should we change from IntElement and DoubleElement to NumberElement
 // that can also hold an e value? (and have specific getters if the
 // value is larger than an int can handle)
 //
+template<typename Input>
 ElementPtr
-fromStringstreamNumber(std::istream& in, const std::string& file,
+fromStringstreamNumber(Input& in, const std::string& file,
                        const int& line, int& pos) {
     // Remember position where the value starts. It will be set in the
     // Position structure of the Element to be created.
@@ -452,8 +565,9 @@ fromStringstreamNumber(std::istream& in, const std::string& file,
     return (ElementPtr());
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamBool(std::istream& in, const std::string& file,
+fromStringstreamBool(Input& in, const std::string& file,
                      const int line, int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -475,8 +589,9 @@ fromStringstreamBool(std::istream& in, const std::string& file,
     return (ElementPtr());
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamNull(std::istream& in, const std::string& file,
+fromStringstreamNull(Input& in, const std::string& file,
                      const int line, int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -493,8 +608,9 @@ fromStringstreamNull(std::istream& in, const std::string& file,
     }
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamString(std::istream& in, const std::string& file, int& line,
+fromStringstreamString(Input& in, const std::string& file, int& line,
                        int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -506,8 +622,9 @@ fromStringstreamString(std::istream& in, const std::string& file, int& line,
                                                             start_pos)));
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamList(std::istream& in, const std::string& file, int& line,
+fromStringstreamList(Input& in, const std::string& file, int& line,
                      int& pos)
 {
     int c = 0;
@@ -517,7 +634,7 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     skipChars(in, WHITESPACE, line, pos);
     while (c != EOF && c != ']') {
         if (in.peek() != ']') {
-            cur_list_element = Element::fromJSON(in, file, line, pos);
+            cur_list_element = fromInput(in, file, line, pos);
             list->add(cur_list_element);
             c = skipTo(in, file, line, pos, ",]", WHITESPACE);
         } else {
@@ -528,8 +645,9 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     return (list);
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamMap(std::istream& in, const std::string& file, int& line,
+fromStringstreamMap(Input& in, const std::string& file, int& line,
                     int& pos)
 {
     ElementPtr map = Element::createMap(Element::Position(file, line, pos));
@@ -547,7 +665,7 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
             skipTo(in, file, line, pos, ":", WHITESPACE);
             // skip the :
 
-            ConstElementPtr value = Element::fromJSON(in, file, line, pos);
+            ConstElementPtr value = fromInput(in, file, line, pos);
             map->set(key, value);
 
             c = skipTo(in, file, line, pos, ",}", WHITESPACE);
@@ -555,86 +673,9 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
     }
     return (map);
 }
-} // unnamed namespace
-
-std::string
-Element::typeToName(Element::types type) {
-    switch (type) {
-    case Element::integer:
-        return (std::string("integer"));
-    case Element::real:
-        return (std::string("real"));
-    case Element::boolean:
-        return (std::string("boolean"));
-    case Element::string:
-        return (std::string("string"));
-    case Element::list:
-        return (std::string("list"));
-    case Element::map:
-        return (std::string("map"));
-    case Element::null:
-        return (std::string("null"));
-    case Element::any:
-        return (std::string("any"));
-    default:
-        return (std::string("unknown"));
-    }
-}
-
-Element::types
-Element::nameToType(const std::string& type_name) {
-    if (type_name == "integer") {
-        return (Element::integer);
-    } else if (type_name == "real") {
-        return (Element::real);
-    } else if (type_name == "boolean") {
-        return (Element::boolean);
-    } else if (type_name == "string") {
-        return (Element::string);
-    } else if (type_name == "list") {
-        return (Element::list);
-    } else if (type_name == "map") {
-        return (Element::map);
-    } else if (type_name == "named_set") {
-        return (Element::map);
-    } else if (type_name == "null") {
-        return (Element::null);
-    } else if (type_name == "any") {
-        return (Element::any);
-    } else {
-        isc_throw(TypeError, type_name + " is not a valid type name");
-    }
-}
-
+template<typename Input>
 ElementPtr
-Element::fromJSON(std::istream& in, bool preproc) throw(JSONError) {
-
-    int line = 1, pos = 1;
-    stringstream filtered;
-    if (preproc) {
-        preprocess(in, filtered);
-    }
-
-    ElementPtr value = fromJSON(preproc ? filtered : in, "<istream>", line, pos);
-
-    return (value);
-}
-
-ElementPtr
-Element::fromJSON(std::istream& in, const std::string& file_name, bool preproc)
-    throw(JSONError)
-{
-    int line = 1, pos = 1;
-    stringstream filtered;
-    if (preproc) {
-        preprocess(in, filtered);
-    }
-    return (fromJSON(preproc ? filtered : in, file_name, line, pos));
-}
-
-ElementPtr
-Element::fromJSON(std::istream& in, const std::string& file, int& line,
-                  int& pos) throw(JSONError)
+fromInput(Input& in, const std::string& file, int& line, int& pos)
 {
     int c = 0;
     ElementPtr element;
@@ -703,25 +744,110 @@ Element::fromJSON(std::istream& in, const std::string& file, int& line,
     }
 }
 
+} // unnamed namespace
+
+std::string
+Element::typeToName(Element::types type) {
+    switch (type) {
+    case Element::integer:
+        return (std::string("integer"));
+    case Element::real:
+        return (std::string("real"));
+    case Element::boolean:
+        return (std::string("boolean"));
+    case Element::string:
+        return (std::string("string"));
+    case Element::list:
+        return (std::string("list"));
+    case Element::map:
+        return (std::string("map"));
+    case Element::null:
+        return (std::string("null"));
+    case Element::any:
+        return (std::string("any"));
+    default:
+        return (std::string("unknown"));
+    }
+}
+
+Element::types
+Element::nameToType(const std::string& type_name) {
+    if (type_name == "integer") {
+        return (Element::integer);
+    } else if (type_name == "real") {
+        return (Element::real);
+    } else if (type_name == "boolean") {
+        return (Element::boolean);
+    } else if (type_name == "string") {
+        return (Element::string);
+    } else if (type_name == "list") {
+        return (Element::list);
+    } else if (type_name == "map") {
+        return (Element::map);
+    } else if (type_name == "named_set") {
+        return (Element::map);
+    } else if (type_name == "null") {
+        return (Element::null);
+    } else if (type_name == "any") {
+        return (Element::any);
+    } else {
+        isc_throw(TypeError, type_name + " is not a valid type name");
+    }
+}
+
 ElementPtr
-Element::fromJSON(const std::string& in, bool preproc) {
-    std::stringstream ss;
-    ss << in;
+Element::fromJSON(std::istream& in, bool preproc) throw(JSONError) {
+    return (fromJSON(in, "<istream>", preproc));
+}
 
-    int line = 1, pos = 1;
-    stringstream filtered;
+ElementPtr
+Element::fromJSON(std::istream& in, const std::string& file_name, bool preproc)
+    throw(JSONError)
+{
+    // The preprocessing consumes the whole stream anyway, so read it
+    // at once and parse it from memory.
     if (preproc) {
-        preprocess(ss, filtered);
+        std::ostringstream buffer;
+        buffer << in.rdbuf();
+        const std::string content = buffer.str();
+        return (fromJSON(content.data(), content.size(), file_name, true));
     }
-    ElementPtr result(fromJSON(preproc ? filtered : ss, "<string>", line, pos));
-    skipChars(ss, WHITESPACE, line, pos);
-    // ss must now be at end
-    if (ss.peek() != EOF) {
-        throwJSONError("Extra data", "<string>", line, pos);
+    int line = 1, pos = 1;
+    return (fromJSON(in, file_name, line, pos));
+}
+
+ElementPtr
+Element::fromJSON(std::istream& in, const std::string& file, int& line,
+                  int& pos) throw(JSONError)
+{
+    StreamInput input(in);
+    return (fromInput(input, file, line, pos));
+}
+
+ElementPtr
+Element::fromJSON(const std::string& in, bool preproc) {
+    int line = 1, pos = 1;
+    BufferInput input(in.data(), in.size(), preproc);
+    ElementPtr result(fromInput(input, "<string>", line, pos));
+    // input must now be at end, except when preprocessing as the
+    // configuration may end with a comment following the last value.
+    if (!preproc) {
+        skipChars(input, WHITESPACE, line, pos);
+        if (input.peek() != EOF) {
+            throwJSONError("Extra data", "<string>", line, pos);
+        }
     }
     return result;
 }
 
+ElementPtr
+Element::fromJSON(const char* data, const size_t length,
+                  const std::string& file_name, bool preproc) {
+    int line = 1, pos = 1;
+    BufferInput input(data, length, preproc);
+    return (fromInput(input, file_name, line, pos));
+}
+
 ElementPtr
 Element::fromJSONFile(const std::string& file_name,
                       bool preproc) {
@@ -736,7 +862,18 @@ Element::fromJSONFile(const std::string& file_name,
                   << "': " << error);
     }
 
-    return (fromJSON(infile, file_name, preproc));
+    // Read the whole file at once and parse it from memory.
+    std::string content;
+    infile.seekg(0, std::ios::end);
+    const std::streamoff size = infile.tellg();
+    if (size > 0) {
+        content.resize(static_cast<size_t>(size));
+        infile.seekg(0, std::ios::beg);
+        infile.read(&content[0], size);
+        content.resize(static_cast<size_t>(infile.gcount()));
+    }
+
+    return (fromJSON(content.data(), content.size(), file_name, preproc));
 }
 
 // to JSON format
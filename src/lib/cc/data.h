@@ -459,6 +459,25 @@ public:
                                int& line, int &pos)
         throw(JSONError);
 
+    /// Creates an Element from the JSON text held in a contiguous buffer.
+    ///
+    /// The text is parsed in a single pass without copying it into a
+    /// stream, which is much faster than the stream based variants for
+    /// large inputs. The produced elements and their positions are the
+    /// same. Only the first value is parsed; the remaining text is
+    /// ignored.
+    ///
+    /// \param data Pointer to the text.
+    /// \param length Length of the text.
+    /// \param file_name The input name (used in error reporting).
+    /// \param preproc specified whether preprocessing (e.g. comment removal)
+    ///                should be performed
+    /// \return An ElementPtr that contains the element(s) specified
+    /// in the given buffer.
+    static ElementPtr fromJSON(const char* data, size_t length,
+                               const std::string& file_name,
+                               bool preproc = false);
+
     /// Reads contents of specified file and interprets it as JSON.
     ///
     /// @param file_name name of the file to read
@@ -8,6 +8,7 @@
 #include <boost/foreach.hpp>
 #include <boost/assign/std/vector.hpp>
 #include <climits>
+#include <cstring>
 
 #include <cc/data.h>
 
@@ -1149,4 +1150,86 @@ TEST(Element, getPositionCommented) {
     EXPECT_EQ(14, level2_el->getPosition().pos_);
     EXPECT_EQ("kea.conf", level2_el->getPosition().file_);
 }
+
+/// @brief Checks that two element trees are equal and have the same
+/// positions.
+///
+/// @param expected element parsed from a stream.
+/// @param actual element parsed from a buffer.
+void checkSamePositions(ConstElementPtr expected, ConstElementPtr actual) {
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(actual);
+    ASSERT_TRUE(expected->equals(*actual));
+    EXPECT_EQ(expected->getPosition().str(), actual->getPosition().str());
+    if (expected->getType() == Element::list) {
+        for (size_t i = 0; i < expected->size(); ++i) {
+            checkSamePositions(expected->get(i), actual->get(i));
+        }
+    } else if (expected->getType() == Element::map) {
+        typedef std::pair<std::string, ConstElementPtr> MapPair;
+        BOOST_FOREACH(MapPair child, expected->mapValue()) {
+            checkSamePositions(child.second, actual->get(child.first));
+        }
+    }
+}
+
+// Tests that parsing a buffer gives the same elements and positions as
+// parsing a stream.
+TEST(Element, fromJSONBuffer) {
+    const std::string json = "{\n"
+        "    \"a\":  2,\n"
+        "# comment\n"
+        "    \"cy\": \"a string\",\n"
+        "    \"dyz\": {\n"
+        "# another comment\n"
+        "      \"e\": [ 3, 4.5, true, \"a\\tb\" ],\n"
+        "        \"f\": null\n"
+        "\n"
+        "    } }\n";
+
+    for (int preproc = 0; preproc < 2; ++preproc) {
+        SCOPED_TRACE(preproc ? "with comments" : "without comments");
+        // Without the preprocessor the comments are removed by hand.
+        std::string text = json;
+        if (!preproc) {
+            std::string::size_type start;
+            while ((start = text.find('#')) != std::string::npos) {
+                text.erase(start, text.find('\n', start) - start);
+            }
+        }
+        std::istringstream ss(text);
+        ElementPtr expected = Element::fromJSON(ss, "kea.conf", preproc);
+        ElementPtr actual = Element::fromJSON(text.c_str(), text.size(),
+                                              "kea.conf", preproc);
+        checkSamePositions(expected, actual);
+    }
+
+    // Only the first value of the buffer is parsed.
+    const char two_values[] = "[ 1 ] [ 2 ]";
+    ElementPtr first = Element::fromJSON(two_values, sizeof(two_values) - 1,
+                                         "kea.conf");
+    EXPECT_EQ("[ 1 ]", first->str());
+
+    // Errors are reported the same way.
+    const char* bad[] = { "", "{ \"a\": 1,\n \"b\" 2 }", "[ 1, 2",
+                          "\"abc", "tru", "[ 1e ]" };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i) {
+        SCOPED_TRACE(bad[i]);
+        std::string stream_error;
+        std::string buffer_error;
+        try {
+            std::istringstream ss(bad[i]);
+            Element::fromJSON(ss, "kea.conf", false);
+        } catch (const JSONError& ex) {
+            stream_error = ex.what();
+        }
+        try {
+            Element::fromJSON(bad[i], strlen(bad[i]), "kea.conf");
+        } catch (const JSONError& ex) {
+            buffer_error = ex.what();
+        }
+        EXPECT_FALSE(stream_error.empty());
+        EXPECT_EQ(stream_error, buffer_error);
+    }
+}
 }
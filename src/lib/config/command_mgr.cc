@@ -11,6 +11,7 @@
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
 #include <boost/bind.hpp>
+#include <cstdio>
 #include <unistd.h>
 
 using namespace isc::data;
@@ -19,7 +20,7 @@ namespace isc {
 namespace config {
 
 CommandMgr::CommandMgr()
-    : HookedCommandMgr() {
+    : HookedCommandMgr(), inherited_name_(), inherited_fd_(-1) {
 }
 
 CommandSocketPtr
@@ -28,7 +29,25 @@ CommandMgr::openCommandSocket(const isc::data::ConstElementPtr& socket_info) {
         isc_throw(SocketError, "There is already a control socket open");
     }
 
-    socket_ = CommandSocketFactory::create(socket_info);
+    // Use the inherited socket if it has the same name.
+    int sockfd = -1;
+    if (socket_info && (inherited_fd_ >= 0)) {
+        ConstElementPtr type = socket_info->get("socket-type");
+        ConstElementPtr name = socket_info->get("socket-name");
+        if (type && (type->getType() == Element::string) &&
+            (type->stringValue() == "unix") && name &&
+            (name->getType() == Element::string) &&
+            (name->stringValue() == inherited_name_)) {
+            sockfd = inherited_fd_;
+        }
+    }
+
+    socket_ = CommandSocketFactory::create(socket_info, sockfd);
+
+    if (sockfd >= 0) {
+        inherited_name_.clear();
+        inherited_fd_ = -1;
+    }
 
     return (socket_);
 }
@@ -48,6 +67,29 @@ void CommandMgr::closeCommandSocket() {
     connections_.clear();
 }
 
+void CommandMgr::inheritCommandSocket(const std::string& socket_name,
+                                      const int sockfd) {
+    closeInheritedCommandSocket();
+    inherited_name_ = socket_name;
+    inherited_fd_ = sockfd;
+}
+
+void CommandMgr::closeInheritedCommandSocket() {
+    if (inherited_fd_ >= 0) {
+        ::close(inherited_fd_);
+        static_cast<void>(remove(inherited_name_.c_str()));
+    }
+    inherited_name_.clear();
+    inherited_fd_ = -1;
+}
+
+void CommandMgr::releaseCommandSocket() {
+    if (socket_) {
+        socket_->release();
+        socket_.reset();
+    }
+}
+
 
 void CommandMgr::addConnection(const CommandSocketPtr& conn) {
     connections_.push_back(conn);
@@ -47,6 +47,30 @@ public:
     /// @brief Shuts down any open control sockets
     void closeCommandSocket();
 
+    /// @brief Sets the control socket inherited from another process
+    ///
+    /// The inherited socket is used by @ref openCommandSocket instead of
+    /// opening a new socket when a UNIX socket with the same name is
+    /// opened. This allows the process taking over from another one to
+    /// keep the control channel open during the restart.
+    ///
+    /// @param socket_name UNIX path of the socket
+    /// @param sockfd descriptor of the listening socket
+    void inheritCommandSocket(const std::string& socket_name, const int sockfd);
+
+    /// @brief Closes the inherited control socket if it hasn't been used
+    ///
+    /// The socket file is removed as no process uses it any longer.
+    void closeInheritedCommandSocket();
+
+    /// @brief Releases the control socket handed off to another process
+    ///
+    /// The control socket stops accepting connections, but unlike
+    /// @ref closeCommandSocket its file is not removed, so as the process
+    /// which took over the socket keeps using it. The open connections are
+    /// not affected.
+    void releaseCommandSocket();
+
     /// @brief Reads data from a socket, parses as JSON command and processes it
     ///
     /// This method is used to handle traffic on connected socket. This callback
@@ -72,9 +96,9 @@ public:
 
     /// @brief Returns control socket descriptor
     ///
-    /// This method should be used only in tests.
+    /// @return descriptor of the control socket or -1 if there is none.
     int getControlSocketFD() const {
-        return (socket_->getFD());
+        return (socket_ ? socket_->getFD() : -1);
     }
 
 private:
@@ -95,6 +119,12 @@ private:
     /// These are the sockets that are dedicated to handle a specific connection.
     /// Their number is equal to number of current control connections.
     std::list<CommandSocketPtr> connections_;
+
+    /// @brief UNIX path of the inherited control socket
+    std::string inherited_name_;
+
+    /// @brief Descriptor of the inherited control socket or -1
+    int inherited_fd_;
 };
 
 }; // end of isc::config namespace
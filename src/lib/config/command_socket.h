@@ -52,6 +52,15 @@ public:
         ::close(sockfd_);
     }
 
+    /// @brief Closes the socket handed off to another process.
+    ///
+    /// This is the default implementation that closes the socket.
+    /// Derived classes may leave in place the resources needed by the
+    /// process using the socket.
+    virtual void release() {
+        close();
+    }
+
     /// @brief Virtual destructor.
     virtual ~CommandSocket() {
         close();
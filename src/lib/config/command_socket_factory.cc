@@ -36,11 +36,21 @@ public:
     /// Opens specified UNIX socket.
     ///
     /// @param filename socket filename
-    UnixCommandSocket(const std::string& filename)
+    /// @param sockfd descriptor of the socket inherited from another
+    /// process or -1
+    UnixCommandSocket(const std::string& filename, const int sockfd = -1)
         : filename_(filename) {
 
-        // Create the socket and set it up.
-        sockfd_ = createUnixSocket(filename_);
+        if (sockfd < 0) {
+            // Create the socket and set it up.
+            sockfd_ = createUnixSocket(filename_);
+
+        } else {
+            // The socket is already bound and listening.
+            sockfd_ = sockfd;
+            LOG_INFO(command_logger, COMMAND_SOCKET_UNIX_INHERIT).arg(sockfd_)
+                .arg(filename_);
+        }
 
         // Install this socket in Interface Manager.
         isc::dhcp::IfaceMgr::instance().addExternalSocket(sockfd_,
@@ -189,12 +199,24 @@ private:
         static_cast<void>(remove(filename_.c_str()));
     }
 
+    // This method is called when the socket is handed off to another
+    // process. The socket file is left in place for this process.
+    void release() {
+        LOG_INFO(command_logger, COMMAND_SOCKET_UNIX_RELEASE).arg(sockfd_)
+            .arg(filename_);
+
+        isc::dhcp::IfaceMgr::instance().deleteExternalSocket(sockfd_);
+        ::close(sockfd_);
+        sockfd_ = -1;
+    }
+
     /// @brief UNIX filename representing this socket
     std::string filename_;
 };
 
 CommandSocketPtr
-CommandSocketFactory::create(const isc::data::ConstElementPtr& socket_info) {
+CommandSocketFactory::create(const isc::data::ConstElementPtr& socket_info,
+                             const int sockfd) {
     if(!socket_info) {
         isc_throw(BadSocketInfo, "Missing socket_info parameters, can't create socket.");
     }
@@ -215,7 +237,8 @@ CommandSocketFactory::create(const isc::data::ConstElementPtr& socket_info) {
             isc_throw(BadSocketInfo, "'socket-name' parameter expected to be a string");
         }
 
-        return (CommandSocketPtr(new UnixCommandSocket(name->stringValue())));
+        return (CommandSocketPtr(new UnixCommandSocket(name->stringValue(),
+                                                       sockfd)));
     } else {
         isc_throw(BadSocketInfo, "Specified socket type ('" + type->stringValue()
                   + "') is not supported.");
@@ -29,8 +29,11 @@ public:
     /// @throw CommandSocketError
     ///
     /// @param socket_info structure that describes the socket
+    /// @param sockfd descriptor of a socket inherited from another process,
+    /// used instead of opening a new socket, or -1
     /// @return socket descriptor
-    static CommandSocketPtr create(const isc::data::ConstElementPtr& socket_info);
+    static CommandSocketPtr create(const isc::data::ConstElementPtr& socket_info,
+                                   const int sockfd = -1);
 };
 
 };
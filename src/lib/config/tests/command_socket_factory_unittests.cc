@@ -13,6 +13,11 @@
 #include <cstdio>
 #include <cstdlib>
 
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 using namespace isc::config;
 using namespace isc::data;
 
@@ -92,3 +97,52 @@ TEST_F(CommandSocketFactoryTest, unixCreateTooLong) {
 
     EXPECT_THROW(CommandSocketFactory::create(socket_info), SocketError);
 }
+
+// Checks that the command socket is released without removing its file
+// and that the socket inherited from another process is used when the
+// socket with the same name is opened.
+TEST_F(CommandSocketFactoryTest, unixInherit) {
+    ElementPtr socket_info = Element::createMap();
+    socket_info->set("socket-type", Element::create("unix"));
+    socket_info->set("socket-name", Element::create(SOCKET_NAME));
+
+    // Open the socket and keep a duplicate as if it had been received
+    // by another process.
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+    const int fd = CommandMgr::instance().getControlSocketFD();
+    ASSERT_NE(-1, fd);
+    const int inherited_fd = dup(fd);
+    ASSERT_NE(-1, inherited_fd);
+
+    // The released socket is closed but its file is left in place.
+    CommandMgr::instance().releaseCommandSocket();
+    EXPECT_EQ(-1, CommandMgr::instance().getControlSocketFD());
+    struct stat st;
+    EXPECT_EQ(0, stat(SOCKET_NAME.c_str(), &st));
+
+    CommandMgr::instance().inheritCommandSocket(SOCKET_NAME, inherited_fd);
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+    EXPECT_EQ(inherited_fd, CommandMgr::instance().getControlSocketFD());
+
+    // Closing the inherited socket removes its file.
+    CommandMgr::instance().closeCommandSocket();
+    EXPECT_NE(0, stat(SOCKET_NAME.c_str(), &st));
+}
+
+// Checks that the inherited socket is closed when it hasn't been used.
+TEST_F(CommandSocketFactoryTest, unixInheritUnused) {
+    const int inherited_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_NE(-1, inherited_fd);
+    CommandMgr::instance().inheritCommandSocket(SOCKET_NAME + ".old",
+                                                inherited_fd);
+
+    ElementPtr socket_info = Element::createMap();
+    socket_info->set("socket-type", Element::create("unix"));
+    socket_info->set("socket-name", Element::create(SOCKET_NAME));
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+    EXPECT_NE(inherited_fd, CommandMgr::instance().getControlSocketFD());
+
+    CommandMgr::instance().closeInheritedCommandSocket();
+    EXPECT_EQ(-1, fcntl(inherited_fd, F_GETFD));
+    CommandMgr::instance().closeCommandSocket();
+}
@@ -278,6 +278,7 @@ IfaceMgr::~IfaceMgr() {
     control_buf_len_ = 0;
 
     closeSockets();
+    closeInheritedSockets();
 }
 
 bool
@@ -323,6 +324,43 @@ IfaceMgr::deleteAllExternalSockets() {
     callbacks_.clear();
 }
 
+void
+IfaceMgr::addInheritedSocket(const std::string& iface_name,
+                             const SocketInfo& socket,
+                             const bool direct_response) {
+    inherited_sockets_.push_back(InheritedSocket(iface_name, socket,
+                                                 direct_response));
+}
+
+void
+IfaceMgr::closeInheritedSockets() {
+    for (std::list<InheritedSocket>::const_iterator s =
+             inherited_sockets_.begin(); s != inherited_sockets_.end(); ++s) {
+        close(s->socket_.sockfd_);
+        if (s->socket_.fallbackfd_ >= 0) {
+            close(s->socket_.fallbackfd_);
+        }
+    }
+    inherited_sockets_.clear();
+}
+
+int
+IfaceMgr::useInheritedSocket(Iface& iface, const IOAddress& addr,
+                             const uint16_t port, const bool direct_response) {
+    for (std::list<InheritedSocket>::iterator s = inherited_sockets_.begin();
+         s != inherited_sockets_.end(); ++s) {
+        if ((s->iface_name_ == iface.getName()) &&
+            (s->socket_.addr_ == addr) && (s->socket_.port_ == port) &&
+            (s->direct_response_ == direct_response)) {
+            const SocketInfo info = s->socket_;
+            inherited_sockets_.erase(s);
+            iface.addSocket(info);
+            return (info.sockfd_);
+        }
+    }
+    return (-1);
+}
+
 void
 IfaceMgr::setPacketFilter(const PktFilterPtr& packet_filter) {
     // Do not allow NULL pointer.
@@ -846,6 +884,13 @@ IfaceMgr::openSocket4(Iface& iface, const IOAddress& addr,
                           const uint16_t port, const bool receive_bcast,
                           const bool send_bcast) {
 
+    // Use the socket inherited from the replaced process, if any.
+    const int inherited = useInheritedSocket(iface, addr, port,
+                                             isDirectResponseSupported());
+    if (inherited >= 0) {
+        return (inherited);
+    }
+
     // Assuming that packet filter is not NULL, because its modifier checks it.
     SocketInfo info = packet_filter_->openSocket(iface, addr, port,
                                                  receive_bcast, send_bcast);
@@ -986,7 +1031,12 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
 
     // Now we have a socket, let's get some data from it!
     // Assuming that packet filter is not NULL, because its modifier checks it.
-    return (packet_filter_->receive(*iface, *candidate));
+    Pkt4Ptr pkt = packet_filter_->receive(*iface, *candidate);
+    if (pkt) {
+        // Start the processing timeline of the packet.
+        pkt->markEvent(Pkt::EVENT_RECEIVED);
+    }
+    return (pkt);
 }
 
 Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ ) {
@@ -1094,7 +1144,12 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         isc_throw(SocketReadError, "received data over unknown socket");
     }
     // Assuming that packet filter is not NULL, because its modifier checks it.
-    return (packet_filter6_->receive(*candidate));
+    Pkt6Ptr pkt = packet_filter6_->receive(*candidate);
+    if (pkt) {
+        // Start the processing timeline of the packet.
+        pkt->markEvent(Pkt::EVENT_RECEIVED);
+    }
+    return (pkt);
 }
 
 uint16_t IfaceMgr::getSocket(const isc::dhcp::Pkt6& pkt) {
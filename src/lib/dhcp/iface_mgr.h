@@ -993,6 +993,32 @@ public:
     /// @brief Deletes all external sockets.
     void deleteAllExternalSockets();
 
+    /// @brief Adds a socket inherited from another process.
+    ///
+    /// The inherited sockets are used when the server takes over the
+    /// sockets of the process it replaces, so as no packets are lost
+    /// during the restart. An inherited socket is used instead of opening
+    /// a new one when a socket is opened on the same interface, address
+    /// and port, and the current packet filter uses the same kind of
+    /// sockets. The sockets which haven't been used are closed by the
+    /// @c IfaceMgr::closeInheritedSockets.
+    ///
+    /// @param iface_name name of the interface the socket is open on.
+    /// @param socket socket information, including the fallback socket.
+    /// @param direct_response true if the socket has been opened by a
+    /// packet filter supporting direct responses.
+    void addInheritedSocket(const std::string& iface_name,
+                            const SocketInfo& socket,
+                            const bool direct_response);
+
+    /// @brief Returns the number of inherited sockets not used yet.
+    size_t countInheritedSockets() const {
+        return (inherited_sockets_.size());
+    }
+
+    /// @brief Closes the inherited sockets which haven't been used.
+    void closeInheritedSockets();
+
     /// @brief Set packet filter object to handle sending and receiving DHCPv4
     /// messages.
     ///
@@ -1123,6 +1149,19 @@ protected:
     int openSocket6(Iface& iface, const isc::asiolink::IOAddress& addr,
                     uint16_t port, const bool join_multicast);
 
+    /// @brief Uses an inherited socket instead of opening a new one.
+    ///
+    /// @param iface interface on which the socket is opened.
+    /// @param addr address the socket should be bound to.
+    /// @param port port the socket should be bound to.
+    /// @param direct_response true if the current packet filter supports
+    /// direct responses.
+    ///
+    /// @return descriptor of the inherited socket added to the interface,
+    /// or a negative value if there is no matching inherited socket.
+    int useInheritedSocket(Iface& iface, const isc::asiolink::IOAddress& addr,
+                           const uint16_t port, const bool direct_response);
+
     /// @brief Stub implementation of network interface detection.
     ///
     /// This implementations reads a single line from interfaces.txt file
@@ -1215,6 +1254,33 @@ private:
     /// @brief Contains list of callbacks for external sockets
     SocketCallbackInfoContainer callbacks_;
 
+    /// @brief Holds a socket inherited from another process.
+    struct InheritedSocket {
+        /// @brief Constructor.
+        ///
+        /// @param iface_name name of the interface.
+        /// @param socket socket information.
+        /// @param direct_response direct responses are supported.
+        InheritedSocket(const std::string& iface_name,
+                        const SocketInfo& socket,
+                        const bool direct_response)
+            : iface_name_(iface_name), socket_(socket),
+              direct_response_(direct_response) {
+        }
+
+        /// @brief Name of the interface.
+        std::string iface_name_;
+
+        /// @brief Socket information.
+        SocketInfo socket_;
+
+        /// @brief Direct responses are supported.
+        bool direct_response_;
+    };
+
+    /// @brief Inherited sockets not used yet.
+    std::list<InheritedSocket> inherited_sockets_;
+
     /// @brief Indicates if the IfaceMgr is in the test mode.
     bool test_mode_;
 };
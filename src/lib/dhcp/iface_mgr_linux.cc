@@ -578,6 +578,12 @@ IfaceMgr::openMulticastSocket(Iface& iface,
 int
 IfaceMgr::openSocket6(Iface& iface, const IOAddress& addr, uint16_t port,
                       const bool join_multicast) {
+    // Use the socket inherited from the replaced process, if any.
+    const int inherited = useInheritedSocket(iface, addr, port, false);
+    if (inherited >= 0) {
+        return (inherited);
+    }
+
     // Assuming that packet filter is not NULL, because its modifier checks it.
     SocketInfo info = packet_filter6_->openSocket(iface, addr, port,
                                                   join_multicast);
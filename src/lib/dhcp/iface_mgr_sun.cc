@@ -156,6 +156,13 @@ int
 IfaceMgr::openSocket6(Iface& iface, const IOAddress& addr, uint16_t port,
                       const bool join_multicast) {
     IOAddress actual_address = join_multicast ? IOAddress("::") : addr;
+
+    // Use the socket inherited from the replaced process, if any.
+    const int inherited = useInheritedSocket(iface, actual_address, port, false);
+    if (inherited >= 0) {
+        return (inherited);
+    }
+
     SocketInfo info = packet_filter6_->openSocket(iface, actual_address, port,
                                                   join_multicast);
     iface.addSocket(info);
@@ -9,6 +9,7 @@
 #include <dhcp/pkt.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/hwaddr.h>
+#include <chrono>
 #include <vector>
 
 namespace isc {
@@ -27,6 +28,7 @@ Pkt::Pkt(uint32_t transid, const isc::asiolink::IOAddress& local_addr,
      buffer_out_(0),
      copy_retrieved_options_(false)
 {
+    clearTimeline();
 }
 
 Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local_addr,
@@ -42,6 +44,7 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
      buffer_out_(0),
      copy_retrieved_options_(false)
 {
+    clearTimeline();
 
     if (len != 0) {
         if (buf == NULL) {
@@ -108,6 +111,94 @@ Pkt::updateTimestamp() {
     timestamp_ = boost::posix_time::microsec_clock::universal_time();
 }
 
+uint64_t
+Pkt::getStageDuration(const TimelineEvent event) const {
+    const uint64_t end = getEventTime(event);
+    if ((event == EVENT_RECEIVED) || (end == 0)) {
+        return (0);
+    }
+
+    // The stage starts at the most recent event recorded before this
+    // one. Events are not necessarily recorded in the order of their
+    // enumeration, e.g. the DHCPv6 server classifies the packet after
+    // pkt6_receive callouts, so we have to compare timestamps.
+    uint64_t start = 0;
+    for (int i = EVENT_RECEIVED; i < EVENT_NUM; ++i) {
+        if ((i != event) && (timeline_[i] != 0) && (timeline_[i] <= end) &&
+            (timeline_[i] > start)) {
+            start = timeline_[i];
+        }
+    }
+    return (start != 0 ? end - start : 0);
+}
+
+uint64_t
+Pkt::getTotalDuration() const {
+    const uint64_t start = timeline_[EVENT_RECEIVED];
+    if (start == 0) {
+        return (0);
+    }
+    uint64_t end = start;
+    for (int i = EVENT_PARSED; i < EVENT_NUM; ++i) {
+        if (timeline_[i] > end) {
+            end = timeline_[i];
+        }
+    }
+    return (end - start);
+}
+
+void
+Pkt::clearTimeline() {
+    for (int i = 0; i < EVENT_NUM; ++i) {
+        timeline_[i] = 0;
+    }
+}
+
+void
+Pkt::copyTimeline(const Pkt& pkt) {
+    for (int i = 0; i < EVENT_NUM; ++i) {
+        timeline_[i] = pkt.timeline_[i];
+    }
+}
+
+const char*
+Pkt::getStageName(const TimelineEvent event) {
+    switch (event) {
+    case EVENT_RECEIVED:
+        return ("receive");
+    case EVENT_PARSED:
+        return ("parse");
+    case EVENT_CLASSIFIED:
+        return ("classify");
+    case EVENT_RECEIVE_HOOKS:
+        return ("receive-hooks");
+    case EVENT_SUBNET_SELECTED:
+        return ("subnet-select");
+    case EVENT_HOST_LOOKUP:
+        return ("host-lookup");
+    case EVENT_LEASE_ALLOCATED:
+        return ("lease-alloc");
+    case EVENT_SEND_HOOKS:
+        return ("send-hooks");
+    case EVENT_PACKED:
+        return ("pack");
+    case EVENT_SENT:
+        return ("send");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
+uint64_t
+Pkt::getMonotonicTime() {
+    // The value of 0 is reserved for events not recorded, so make sure
+    // we never return it even if the clock epoch happens to be now.
+    const uint64_t now = std::chrono::duration_cast<std::chrono::microseconds>
+        (std::chrono::steady_clock::now().time_since_epoch()).count();
+    return (now != 0 ? now : 1);
+}
+
 void Pkt::repack() {
     if (!data_.empty()) {
         buffer_out_.writeData(&data_[0], data_.size());
@@ -388,6 +388,97 @@ public:
         return timestamp_;
     }
 
+    /// @brief Points of the packet processing timeline.
+    ///
+    /// The server records a monotonic timestamp for each of these events
+    /// as the packet moves through the processing pipeline. The time
+    /// spent in a given stage is the difference between the timestamp
+    /// of the event ending this stage and the most recent event recorded
+    /// before it. Events which haven't been recorded (e.g. because the
+    /// packet was dropped or the message type doesn't involve lease
+    /// allocation) are skipped.
+    enum TimelineEvent {
+        EVENT_RECEIVED = 0,      ///< Packet read from the socket.
+        EVENT_PARSED,            ///< Packet unpacked.
+        EVENT_CLASSIFIED,        ///< Client classification done.
+        EVENT_RECEIVE_HOOKS,     ///< pkt4_receive/pkt6_receive callouts done.
+        EVENT_SUBNET_SELECTED,   ///< Subnet selected for the packet.
+        EVENT_HOST_LOOKUP,       ///< Host reservations looked up.
+        EVENT_LEASE_ALLOCATED,   ///< Leases allocated or renewed.
+        EVENT_SEND_HOOKS,        ///< pkt4_send/pkt6_send callouts done.
+        EVENT_PACKED,            ///< Response packed.
+        EVENT_SENT,              ///< Response written to the socket.
+        EVENT_NUM                ///< Number of events (not an event).
+    };
+
+    /// @brief Records the current monotonic time for the specified event.
+    ///
+    /// If the event has been already recorded, the timestamp is
+    /// overwritten, so the stage covers the last occurrence of the
+    /// event.
+    ///
+    /// @param event Event to be recorded.
+    void markEvent(const TimelineEvent event) {
+        if (event < EVENT_NUM) {
+            timeline_[event] = getMonotonicTime();
+        }
+    }
+
+    /// @brief Returns the timestamp of the specified event.
+    ///
+    /// @param event Event for which the timestamp should be returned.
+    ///
+    /// @return Monotonic time in microseconds at which the event was
+    /// recorded or 0 if the event hasn't been recorded.
+    uint64_t getEventTime(const TimelineEvent event) const {
+        return (event < EVENT_NUM ? timeline_[event] : 0);
+    }
+
+    /// @brief Returns the duration of the stage ending with the event.
+    ///
+    /// The stage starts at the most recent event recorded before the
+    /// specified event.
+    ///
+    /// @param event Event ending the stage.
+    ///
+    /// @return Duration of the stage in microseconds or 0 if the event
+    /// (or any preceding event) hasn't been recorded.
+    uint64_t getStageDuration(const TimelineEvent event) const;
+
+    /// @brief Returns the time elapsed between the reception of the
+    /// packet and the last recorded event.
+    ///
+    /// @return Duration in microseconds or 0 if the reception hasn't
+    /// been recorded.
+    uint64_t getTotalDuration() const;
+
+    /// @brief Clears all recorded events.
+    void clearTimeline();
+
+    /// @brief Copies the recorded events from another packet.
+    ///
+    /// This is used when a packet is replaced by a hook library, so
+    /// the timeline of the replacement starts at the reception of the
+    /// original packet.
+    ///
+    /// @param pkt Packet from which the events are copied.
+    void copyTimeline(const Pkt& pkt);
+
+    /// @brief Returns the name of the stage ending with the event.
+    ///
+    /// The names are used to build statistic names, e.g.
+    /// "pkt4-latency-parse".
+    ///
+    /// @param event Event ending the stage.
+    ///
+    /// @return Stage name, e.g. "parse" for @c EVENT_PARSED.
+    static const char* getStageName(const TimelineEvent event);
+
+    /// @brief Returns the current value of the monotonic clock.
+    ///
+    /// @return Monotonic time in microseconds.
+    static uint64_t getMonotonicTime();
+
     /// @brief Copies content of input buffer to output buffer.
     ///
     /// This is mostly a diagnostic function. It is being used for sending
@@ -736,6 +827,10 @@ protected:
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
+    /// @brief Monotonic timestamps (in microseconds) of the processing
+    /// events, indexed by @c TimelineEvent.
+    uint64_t timeline_[EVENT_NUM];
+
     // remote HW address (src if receiving packet, dst if sending packet)
     HWAddrPtr remote_hwaddr_;
 
@@ -757,6 +852,9 @@ private:
                                  HWAddrPtr& storage);
 };
 
+/// @brief A pointer to either Pkt4 or Pkt6 packet
+typedef boost::shared_ptr<isc::dhcp::Pkt> PktPtr;
+
 }; // namespace isc::dhcp
 }; // namespace isc
 
@@ -19,7 +19,8 @@ namespace dhcp {
 
 PktFilterInet::PktFilterInet()
     : control_buf_len_(CMSG_SPACE(sizeof(struct in6_pktinfo))),
-      control_buf_(new char[control_buf_len_])
+      control_buf_(new char[control_buf_len_]),
+      send_control_buf_(new char[control_buf_len_])
 {
 }
 
@@ -211,7 +212,7 @@ PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
 int
 PktFilterInet::send(const Iface&, uint16_t sockfd,
                     const Pkt4Ptr& pkt) {
-    memset(&control_buf_[0], 0, control_buf_len_);
+    memset(&send_control_buf_[0], 0, control_buf_len_);
 
     // Set the target address we're sending to.
     sockaddr_in to;
@@ -247,7 +248,7 @@ PktFilterInet::send(const Iface&, uint16_t sockfd,
     // We have to create a "control message", and set that to
     // define the IPv4 packet information. We set the source address
     // to handle correctly interfaces with multiple addresses.
-    m.msg_control = &control_buf_[0];
+    m.msg_control = &send_control_buf_[0];
     m.msg_controllen = control_buf_len_;
     struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
     cmsg->cmsg_level = IPPROTO_IP;
@@ -80,8 +80,13 @@ public:
 private:
     /// Length of the control_buf_ array.
     size_t control_buf_len_;
-    /// Control buffer, used in transmission and reception.
+    /// Control buffer, used in reception.
     boost::scoped_array<char> control_buf_;
+    /// Control buffer, used in transmission.
+    ///
+    /// It is separate from the reception buffer so as packets can be
+    /// sent and received concurrently by different threads.
+    boost::scoped_array<char> send_control_buf_;
 };
 
 } // namespace isc::dhcp
@@ -21,7 +21,8 @@ namespace dhcp {
 
 PktFilterInet6::PktFilterInet6()
 : control_buf_len_(CMSG_SPACE(sizeof(struct in6_pktinfo))),
-    control_buf_(new char[control_buf_len_]) {
+    control_buf_(new char[control_buf_len_]),
+    send_control_buf_(new char[control_buf_len_]) {
 }
 
 SocketInfo
@@ -241,7 +242,7 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
 int
 PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
 
-    memset(&control_buf_[0], 0, control_buf_len_);
+    memset(&send_control_buf_[0], 0, control_buf_len_);
 
     // Set the target address we're sending to.
     sockaddr_in6 to;
@@ -283,7 +284,7 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
     // define the IPv6 packet information. We could set the
     // source address if we wanted, but we can safely let the
     // kernel decide what that should be.
-    m.msg_control = &control_buf_[0];
+    m.msg_control = &send_control_buf_[0];
     m.msg_controllen = control_buf_len_;
     struct cmsghdr *cmsg = CMSG_FIRSTHDR(&m);
 
@@ -1651,6 +1651,60 @@ TEST_F(IfaceMgrTest, hasOpenSocketForAddress4) {
 
 }
 
+// This test verifies that the sockets inherited from another process are
+// used instead of opening new sockets, and that the sockets which haven't
+// been used are closed.
+TEST_F(IfaceMgrTest, inheritedSockets4) {
+    NakedIfaceMgr ifacemgr;
+
+    // Remove all real interfaces and create a set of dummy interfaces.
+    ifacemgr.createIfaces();
+
+    // Use the custom packet filter object. This object mimics the socket
+    // opening operation - the real socket is not open.
+    boost::shared_ptr<TestPktFilter> custom_packet_filter(new TestPktFilter());
+    ASSERT_NO_THROW(ifacemgr.setPacketFilter(custom_packet_filter));
+
+    // The socket for eth0 matches the socket to open. The socket for eth1
+    // is bound to another port and the last one has been opened by a packet
+    // filter supporting direct responses.
+    const int sock0 = socket(AF_INET, SOCK_DGRAM, 0);
+    const int sock1 = socket(AF_INET, SOCK_DGRAM, 0);
+    const int sock2 = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(sock0, 0);
+    ASSERT_GE(sock1, 0);
+    ASSERT_GE(sock2, 0);
+    ifacemgr.addInheritedSocket("eth0", SocketInfo(IOAddress("10.0.0.1"),
+                                                   DHCP4_SERVER_PORT, sock0),
+                                false);
+    ifacemgr.addInheritedSocket("eth1", SocketInfo(IOAddress("192.0.2.3"),
+                                                   DHCP4_SERVER_PORT + 1,
+                                                   sock1),
+                                false);
+    ifacemgr.addInheritedSocket("eth1", SocketInfo(IOAddress("192.0.2.3"),
+                                                   DHCP4_SERVER_PORT, sock2),
+                                true);
+    EXPECT_EQ(3, ifacemgr.countInheritedSockets());
+
+    ASSERT_NO_THROW(ifacemgr.openSockets4(DHCP4_SERVER_PORT, true, 0));
+
+    // The inherited socket is used for eth0.
+    ASSERT_EQ(1, ifacemgr.getIface("eth0")->getSockets().size());
+    EXPECT_EQ(sock0, ifacemgr.getIface("eth0")->getSockets().front().sockfd_);
+    // A new socket is opened for eth1.
+    ASSERT_EQ(1, ifacemgr.getIface("eth1")->getSockets().size());
+    EXPECT_EQ(255, ifacemgr.getIface("eth1")->getSockets().front().sockfd_);
+    EXPECT_TRUE(custom_packet_filter->open_socket_called_);
+    EXPECT_EQ(2, ifacemgr.countInheritedSockets());
+
+    // The sockets which haven't been used are closed.
+    ifacemgr.closeInheritedSockets();
+    EXPECT_EQ(0, ifacemgr.countInheritedSockets());
+    EXPECT_EQ(-1, fcntl(sock1, F_GETFD));
+    EXPECT_EQ(-1, fcntl(sock2, F_GETFD));
+    EXPECT_NE(-1, fcntl(sock0, F_GETFD));
+}
+
 // This test checks that the sockets are open and bound to link local addresses
 // only, if unicast addresses are not specified.
 TEST_F(IfaceMgrTest, openSockets6LinkLocal) {
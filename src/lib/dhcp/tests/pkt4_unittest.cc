@@ -821,6 +821,57 @@ TEST_F(Pkt4Test, Timestamp) {
     EXPECT_TRUE(ts_period.length().total_microseconds() >= 0);
 }
 
+// Checks that the processing timeline is recorded and stage durations
+// are calculated correctly.
+TEST_F(Pkt4Test, timeline) {
+    scoped_ptr<Pkt4> pkt(new Pkt4(DHCPDISCOVER, 1234));
+
+    // No events are recorded after construction.
+    for (int i = 0; i < Pkt::EVENT_NUM; ++i) {
+        EXPECT_EQ(0, pkt->getEventTime(static_cast<Pkt::TimelineEvent>(i)));
+    }
+    EXPECT_EQ(0, pkt->getTotalDuration());
+    EXPECT_EQ(0, pkt->getStageDuration(Pkt::EVENT_PARSED));
+
+    pkt->markEvent(Pkt::EVENT_RECEIVED);
+    pkt->markEvent(Pkt::EVENT_PARSED);
+    pkt->markEvent(Pkt::EVENT_CLASSIFIED);
+    pkt->markEvent(Pkt::EVENT_SENT);
+
+    const uint64_t received = pkt->getEventTime(Pkt::EVENT_RECEIVED);
+    const uint64_t parsed = pkt->getEventTime(Pkt::EVENT_PARSED);
+    const uint64_t classified = pkt->getEventTime(Pkt::EVENT_CLASSIFIED);
+    const uint64_t sent = pkt->getEventTime(Pkt::EVENT_SENT);
+    ASSERT_NE(0, received);
+    ASSERT_LE(received, parsed);
+    ASSERT_LE(parsed, classified);
+    ASSERT_LE(classified, sent);
+
+    EXPECT_EQ(0, pkt->getStageDuration(Pkt::EVENT_RECEIVED));
+    EXPECT_EQ(parsed - received, pkt->getStageDuration(Pkt::EVENT_PARSED));
+    EXPECT_EQ(classified - parsed,
+              pkt->getStageDuration(Pkt::EVENT_CLASSIFIED));
+    // Events not recorded in between are skipped.
+    EXPECT_EQ(sent - classified, pkt->getStageDuration(Pkt::EVENT_SENT));
+    EXPECT_EQ(0, pkt->getStageDuration(Pkt::EVENT_PACKED));
+    EXPECT_EQ(sent - received, pkt->getTotalDuration());
+
+    // The events can be copied to another packet.
+    Pkt4 copy(DHCPDISCOVER, 1234);
+    copy.copyTimeline(*pkt);
+    EXPECT_EQ(received, copy.getEventTime(Pkt::EVENT_RECEIVED));
+    EXPECT_EQ(sent, copy.getEventTime(Pkt::EVENT_SENT));
+    EXPECT_EQ(0, copy.getEventTime(Pkt::EVENT_PACKED));
+
+    pkt->clearTimeline();
+    EXPECT_EQ(0, pkt->getEventTime(Pkt::EVENT_RECEIVED));
+    EXPECT_EQ(0, pkt->getTotalDuration());
+
+    EXPECT_EQ(std::string("parse"), Pkt::getStageName(Pkt::EVENT_PARSED));
+    EXPECT_EQ(std::string("lease-alloc"),
+              Pkt::getStageName(Pkt::EVENT_LEASE_ALLOCATED));
+}
+
 TEST_F(Pkt4Test, hwaddr) {
     scoped_ptr<Pkt4> pkt(new Pkt4(DHCPOFFER, 1234));
     const uint8_t hw[] = { 2, 4, 6, 8, 10, 12 }; // MAC
@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <dhcp_ddns/ncr_msg.h>
+#include <dns/exceptions.h>
 #include <dns/name.h>
 #include <asiolink/io_address.h>
 #include <asiolink/io_error.h>
@@ -27,6 +28,10 @@ NameChangeFormat stringToNcrFormat(const std::string& fmt_str) {
         return FMT_JSON;
     }
 
+    if (boost::iequals(fmt_str, "BINARY")) {
+        return FMT_BINARY;
+    }
+
     isc_throw(BadValue, "Invalid NameChangeRequest format: " << fmt_str);
 }
 
@@ -36,6 +41,10 @@ std::string ncrFormatToString(NameChangeFormat format) {
         return ("JSON");
     }
 
+    if (format == FMT_BINARY) {
+        return ("BINARY");
+    }
+
     std::ostringstream stream;
     stream  << "UNKNOWN(" << format << ")";
     return (stream.str());
@@ -196,6 +205,19 @@ operator<<(std::ostream& os, const D2Dhcid& dhcid) {
 
 /**************************** NameChangeRequest ******************************/
 
+// Makes constant visible to Google test macros.
+const uint8_t NameChangeRequest::BINARY_FORMAT_VERSION;
+
+namespace {
+
+/// @brief Flag of the binary format set for a forward change.
+const uint8_t BINARY_FLAG_FORWARD = 0x01;
+
+/// @brief Flag of the binary format set for a reverse change.
+const uint8_t BINARY_FLAG_REVERSE = 0x02;
+
+}
+
 NameChangeRequest::NameChangeRequest()
     : change_type_(CHG_ADD), forward_change_(false),
     reverse_change_(false), fqdn_(""), ip_io_address_("0.0.0.0"),
@@ -253,6 +275,19 @@ NameChangeRequest::fromFormat(const NameChangeFormat format,
                       << ex.what());
         }
 
+        break;
+        }
+    case FMT_BINARY: {
+        try {
+            // Get the length of the binary rendition, then decode it.
+            size_t len = buffer.readUint16();
+            ncr = NameChangeRequest::fromBinary(buffer, len);
+        } catch (isc::util::InvalidBufferPosition& ex) {
+            // Read error accessing data in InputBuffer.
+            isc_throw(NcrMessageError, "fromFormat: buffer read error: "
+                      << ex.what());
+        }
+
         break;
         }
     default:
@@ -281,6 +316,16 @@ NameChangeRequest::toFormat(const NameChangeFormat format,
         buffer.writeData(json.c_str(), length);
         break;
         }
+    case FMT_BINARY: {
+        // Reserve room for the length, write the binary rendition, then go
+        // back and fill in its length.
+        size_t length_pos = buffer.getLength();
+        buffer.writeUint16(0);
+        toBinary(buffer);
+        buffer.writeUint16At(buffer.getLength() - length_pos - sizeof(uint16_t),
+                             length_pos);
+        break;
+        }
     default:
         // Programmatic error, shouldn't happen.
         isc_throw(NcrMessageError, "toFormat - invalid format");
@@ -370,6 +415,101 @@ NameChangeRequest::toJSON() const  {
     return (stream.str());
 }
 
+NameChangeRequestPtr
+NameChangeRequest::fromBinary(isc::util::InputBuffer& buffer,
+                              const size_t length) {
+    const size_t start = buffer.getPosition();
+    if (buffer.getLength() - start < length) {
+        isc_throw(NcrMessageError, "binary NameChangeRequest is truncated");
+    }
+
+    NameChangeRequestPtr ncr(new NameChangeRequest());
+    try {
+        uint8_t version = buffer.readUint8();
+        if (version != BINARY_FORMAT_VERSION) {
+            isc_throw(NcrMessageError, "unsupported binary NameChangeRequest"
+                      " version: " << static_cast<int>(version));
+        }
+
+        uint8_t change_type = buffer.readUint8();
+        if ((change_type != CHG_ADD) && (change_type != CHG_REMOVE)) {
+            isc_throw(NcrMessageError, "Invalid NameChangeRequest change type: "
+                      << static_cast<int>(change_type));
+        }
+        ncr->change_type_ = static_cast<NameChangeType>(change_type);
+
+        uint8_t flags = buffer.readUint8();
+        ncr->forward_change_ = ((flags & BINARY_FLAG_FORWARD) != 0);
+        ncr->reverse_change_ = ((flags & BINARY_FLAG_REVERSE) != 0);
+
+        uint8_t address[16];
+        uint8_t address_len = buffer.readUint8();
+        if (address_len == 4) {
+            buffer.readData(address, address_len);
+            ncr->ip_io_address_ = asiolink::IOAddress::fromBytes(AF_INET,
+                                                                 address);
+        } else if (address_len == 16) {
+            buffer.readData(address, address_len);
+            ncr->ip_io_address_ = asiolink::IOAddress::fromBytes(AF_INET6,
+                                                                 address);
+        } else {
+            isc_throw(NcrMessageError, "Invalid NameChangeRequest address"
+                      " length: " << static_cast<int>(address_len));
+        }
+
+        uint64_t expires_on = buffer.readUint32();
+        expires_on = (expires_on << 32) | buffer.readUint32();
+        ncr->lease_expires_on_ = expires_on;
+        ncr->lease_length_ = buffer.readUint32();
+
+        std::vector<uint8_t> dhcid;
+        buffer.readVector(dhcid, buffer.readUint16());
+        ncr->dhcid_.fromBytes(dhcid);
+
+        ncr->fqdn_ = dns::Name(buffer).toText();
+    } catch (const isc::util::InvalidBufferPosition& ex) {
+        isc_throw(NcrMessageError, "binary NameChangeRequest is truncated: "
+                  << ex.what());
+    } catch (const dns::Exception& ex) {
+        isc_throw(NcrMessageError, "Invalid FQDN in binary NameChangeRequest: "
+                  << ex.what());
+    }
+
+    if (buffer.getPosition() - start > length) {
+        isc_throw(NcrMessageError, "binary NameChangeRequest content exceeds"
+                  " its length: " << length);
+    }
+
+    // Skip values appended by later revisions of the format.
+    buffer.setPosition(start + length);
+
+    ncr->validateContent();
+    return (ncr);
+}
+
+void
+NameChangeRequest::toBinary(isc::util::OutputBuffer& buffer) const {
+    buffer.writeUint8(BINARY_FORMAT_VERSION);
+    buffer.writeUint8(static_cast<uint8_t>(change_type_));
+    buffer.writeUint8((forward_change_ ? BINARY_FLAG_FORWARD : 0) |
+                      (reverse_change_ ? BINARY_FLAG_REVERSE : 0));
+
+    const std::vector<uint8_t> address = ip_io_address_.toBytes();
+    buffer.writeUint8(static_cast<uint8_t>(address.size()));
+    buffer.writeData(&address[0], address.size());
+
+    buffer.writeUint32(static_cast<uint32_t>(lease_expires_on_ >> 32));
+    buffer.writeUint32(static_cast<uint32_t>(lease_expires_on_));
+    buffer.writeUint32(lease_length_);
+
+    const std::vector<uint8_t>& dhcid = dhcid_.getBytes();
+    buffer.writeUint16(static_cast<uint16_t>(dhcid.size()));
+    if (!dhcid.empty()) {
+        buffer.writeData(&dhcid[0], dhcid.size());
+    }
+
+    dns::Name(fqdn_).toWire(buffer);
+}
 
 void
 NameChangeRequest::validateContent() {
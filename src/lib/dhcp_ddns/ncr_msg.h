@@ -58,13 +58,14 @@ enum NameChangeStatus  {
 
 /// @brief Defines the list of data wire formats supported.
 enum NameChangeFormat {
-  FMT_JSON
+  FMT_JSON,
+  FMT_BINARY
 };
 
 /// @brief Function which converts labels to  NameChangeFormat enum values.
 ///
 /// @param fmt_str text to convert to an enum.
-/// Valid string values: "JSON"
+/// Valid string values: "JSON", "BINARY"
 ///
 /// @return NameChangeFormat value which maps to the given string.
 ///
@@ -163,6 +164,13 @@ public:
     void fromHWAddr(const isc::dhcp::HWAddrPtr& hwaddr,
                     const std::vector<uint8_t>& wire_fqdn);
 
+    /// @brief Sets the DHCID value to the given bytes.
+    ///
+    /// @param bytes the DHCID in wire format.
+    void fromBytes(const std::vector<uint8_t>& bytes) {
+        bytes_ = bytes;
+    }
+
     /// @brief Returns a reference to the DHCID byte vector.
     ///
     /// @return a reference to the vector.
@@ -220,12 +228,15 @@ typedef std::map<std::string, isc::data::ConstElementPtr> ElementMap;
 /// This class is used by DHCP-DDNS clients (e.g. DHCP4, DHCP6) to
 /// request DNS updates.  Each message contains a single DNS change (either an
 /// add/update or a remove) for a single FQDN.  It provides marshalling services
-/// for moving instances to and from the wire.  Currently, the only format
-/// supported is JSON detailed here isc::dhcp_ddns::NameChangeRequest::fromJSON
-/// The class provides an interface such that other formats can be readily
-/// supported.
+/// for moving instances to and from the wire.  Two formats are supported:
+/// JSON, detailed here isc::dhcp_ddns::NameChangeRequest::fromJSON, and a
+/// compact binary format, detailed here
+/// isc::dhcp_ddns::NameChangeRequest::fromBinary.
 class NameChangeRequest {
 public:
+    /// @brief Version of the binary format written by toBinary.
+    static const uint8_t BINARY_FORMAT_VERSION = 1;
+
     /// @brief Default Constructor.
     ///
     /// @todo Currently, fromWire makes use of the ability to create an empty
@@ -272,7 +283,10 @@ public:
     /// is than treated as JSON which is then parsed into the data needed
     /// to create a request instance.
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: The buffer is expected to contain a two byte unsigned integer
+    /// which specifies the length of the binary rendition; followed by the
+    /// rendition itself, as described under
+    /// isc::dhcp_ddns::NameChangeRequest::fromBinary.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the input buffer containing the marshalled request
@@ -297,7 +311,10 @@ public:
     /// is identical that described under
     /// isc::dhcp_ddns::NameChangeRequest::fromJSON
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: Upon completion, the buffer will contain a two byte unsigned
+    /// integer which specifies the length of the binary rendition; followed
+    /// by the rendition itself, as described under
+    /// isc::dhcp_ddns::NameChangeRequest::fromBinary.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the output buffer to which the request should be
@@ -403,6 +420,48 @@ public:
     /// @return a string containing the JSON rendition of the request
     std::string toJSON() const;
 
+    /// @brief Static method for creating a NameChangeRequest from its
+    /// binary rendition.
+    ///
+    /// The binary rendition carries the same values as the JSON one, in
+    /// network byte order and without any text conversion:
+    ///
+    /// @code
+    ///     version            1 byte, BINARY_FORMAT_VERSION
+    ///     change-type        1 byte
+    ///     flags              1 byte, 0x01 forward change, 0x02 reverse change
+    ///     address length     1 byte, 4 or 16
+    ///     ip-address         4 or 16 bytes
+    ///     lease-expires-on   8 bytes, seconds since the epoch
+    ///     lease-length       4 bytes
+    ///     dhcid length       2 bytes
+    ///     dhcid              dhcid length bytes
+    ///     fqdn               DNS wire format, uncompressed
+    /// @endcode
+    ///
+    /// Bytes following the FQDN within the given length are ignored so
+    /// that later revisions of the version 1 format may append values.
+    ///
+    /// @param buffer is the input buffer positioned at the rendition
+    /// @param length is the length of the rendition.  Upon return the
+    /// buffer is positioned past the rendition.
+    ///
+    /// @return a pointer to the new NameChangeRequest
+    ///
+    /// @throw NcrMessageError if the rendition is truncated, its version
+    /// is not supported or its content is invalid.
+    static NameChangeRequestPtr fromBinary(isc::util::InputBuffer& buffer,
+                                           const size_t length);
+
+    /// @brief Instance method for marshalling the contents of the request
+    /// into its binary rendition.
+    ///
+    /// The rendition is described under fromBinary.  Its length is not
+    /// written.
+    ///
+    /// @param buffer is the output buffer to which the rendition is appended
+    void toBinary(isc::util::OutputBuffer& buffer) const;
+
     /// @brief Validates the content of a populated request.  This method is
     /// used by both the full constructor and from-wire marshalling to ensure
     /// that the request is content valid.  Currently it enforces the
@@ -582,6 +582,138 @@ TEST(NameChangeRequestTest, toFromBufferTest) {
     ASSERT_EQ(final_str, msg_str);
 }
 
+/// @brief Tests converting to and from the binary format.
+/// This test verifies that:
+/// 1. Every valid JSON test request survives a round trip through the
+/// binary format, both directly and via toFormat/fromFormat.
+/// 2. The binary rendition is smaller than the JSON one.
+/// 3. Several requests can be read back to back from a single buffer.
+TEST(NameChangeRequestTest, toFromBinaryTest) {
+    isc::util::OutputBuffer output_buffer(1024);
+    std::vector<NameChangeRequestPtr> ncrs;
+    int num_msgs = sizeof(valid_msgs)/sizeof(char*);
+    for (int i = 0; i < num_msgs; i++) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[i]));
+        ncrs.push_back(ncr);
+
+        // Convert directly.
+        isc::util::OutputBuffer binary(0);
+        ASSERT_NO_THROW(ncr->toBinary(binary));
+        isc::util::InputBuffer input(binary.getData(), binary.getLength());
+        NameChangeRequestPtr ncr2;
+        ASSERT_NO_THROW(ncr2 = NameChangeRequest::fromBinary(input,
+                                                             binary.getLength()));
+        ASSERT_TRUE(ncr2);
+        EXPECT_TRUE(*ncr == *ncr2) << "message idx: " << i;
+        EXPECT_EQ(ncr->toJSON(), ncr2->toJSON());
+        EXPECT_EQ(binary.getLength(), input.getPosition());
+
+        isc::util::OutputBuffer json(0);
+        ASSERT_NO_THROW(ncr->toFormat(FMT_JSON, json));
+        EXPECT_LT(binary.getLength(), json.getLength());
+
+        // Append to the buffer holding all of the requests.
+        ASSERT_NO_THROW(ncr->toFormat(FMT_BINARY, output_buffer));
+    }
+
+    isc::util::InputBuffer input_buffer(output_buffer.getData(),
+                                        output_buffer.getLength());
+    for (int i = 0; i < num_msgs; i++) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromFormat(FMT_BINARY,
+                                                            input_buffer));
+        ASSERT_TRUE(ncr);
+        EXPECT_TRUE(*(ncrs[i]) == *ncr) << "message idx: " << i;
+    }
+    EXPECT_EQ(output_buffer.getLength(), input_buffer.getPosition());
+}
+
+/// @brief Tests that invalid binary renditions are rejected.
+/// This test verifies that:
+/// 1. Truncated renditions are rejected.
+/// 2. Unsupported versions, change types and address lengths are rejected.
+/// 3. Content exceeding the length given is rejected.
+/// 4. Values appended after the FQDN are skipped.
+TEST(NameChangeRequestTest, invalidBinaryChecks) {
+    NameChangeRequestPtr ncr;
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+    isc::util::OutputBuffer binary(0);
+    ASSERT_NO_THROW(ncr->toBinary(binary));
+    const uint8_t* data = static_cast<const uint8_t*>(binary.getData());
+    std::vector<uint8_t> wire(data, data + binary.getLength());
+
+    // Every truncation fails.
+    for (size_t len = 0; len < wire.size(); ++len) {
+        isc::util::InputBuffer input(&wire[0], len);
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, len),
+                     NcrMessageError) << "length: " << len;
+    }
+
+    // The length given exceeds the data.
+    {
+        isc::util::InputBuffer input(&wire[0], wire.size());
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, wire.size() + 1),
+                     NcrMessageError);
+    }
+
+    // The content exceeds the length given.
+    {
+        std::vector<uint8_t> longer(wire);
+        longer.push_back(0);
+        isc::util::InputBuffer input(&longer[0], longer.size());
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, wire.size() - 1),
+                     NcrMessageError);
+    }
+
+    // Unsupported version.
+    std::vector<uint8_t> bad(wire);
+    bad[0] = NameChangeRequest::BINARY_FORMAT_VERSION + 1;
+    {
+        isc::util::InputBuffer input(&bad[0], bad.size());
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, bad.size()),
+                     NcrMessageError);
+    }
+
+    // Invalid change type.
+    bad = wire;
+    bad[1] = 2;
+    {
+        isc::util::InputBuffer input(&bad[0], bad.size());
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, bad.size()),
+                     NcrMessageError);
+    }
+
+    // Neither forward nor reverse change.
+    bad = wire;
+    bad[2] = 0;
+    {
+        isc::util::InputBuffer input(&bad[0], bad.size());
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, bad.size()),
+                     NcrMessageError);
+    }
+
+    // Invalid address length.
+    bad = wire;
+    bad[3] = 5;
+    {
+        isc::util::InputBuffer input(&bad[0], bad.size());
+        EXPECT_THROW(NameChangeRequest::fromBinary(input, bad.size()),
+                     NcrMessageError);
+    }
+
+    // Appended values are skipped.
+    std::vector<uint8_t> extended(wire);
+    extended.push_back(0xAA);
+    extended.push_back(0xBB);
+    isc::util::InputBuffer input(&extended[0], extended.size());
+    NameChangeRequestPtr ncr2;
+    ASSERT_NO_THROW(ncr2 = NameChangeRequest::fromBinary(input,
+                                                         extended.size()));
+    EXPECT_TRUE(*ncr == *ncr2);
+    EXPECT_EQ(extended.size(), input.getPosition());
+}
+
 /// @brief Tests ip address modification and validation
 TEST(NameChangeRequestTest, ipAddresses) {
     NameChangeRequest ncr;
@@ -608,9 +740,12 @@ TEST(NameChangeRequestTest, ipAddresses) {
 TEST(NameChangeFormatTest, formatEnumConversion){
     ASSERT_EQ(stringToNcrFormat("JSON"), dhcp_ddns::FMT_JSON);
     ASSERT_EQ(stringToNcrFormat("jSoN"), dhcp_ddns::FMT_JSON);
+    ASSERT_EQ(stringToNcrFormat("BINARY"), dhcp_ddns::FMT_BINARY);
+    ASSERT_EQ(stringToNcrFormat("Binary"), dhcp_ddns::FMT_BINARY);
     ASSERT_THROW(stringToNcrFormat("bogus"), isc::BadValue);
 
     ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_JSON), "JSON");
+    ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_BINARY), "BINARY");
 }
 
 /// @brief Tests conversion of NameChangeProtocol between enum and strings.
@@ -4,12 +4,11 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <asiolink/address_value.h>
 #include <dhcpsrv/addr_utilities.h>
 #include <exceptions/exceptions.h>
 
-#include <vector>
 #include <limits>
-#include <string.h>
 
 using namespace isc;
 using namespace isc::asiolink;
@@ -29,9 +28,6 @@ const uint32_t bitMask4[] = { 0xffffffff, 0x7fffffff, 0x3fffffff, 0x1fffffff,
                               0x0000000f, 0x00000007, 0x00000003, 0x00000001,
                               0x00000000 };
 
-/// @brief mask used for first/last address calculation in a IPv6 prefix
-const uint8_t bitMask6[]= { 0, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff };
-
 /// @brief calculates the first IPv6 address in a IPv6 prefix
 ///
 /// Note: This is a private function. Do not use it directly.
@@ -41,42 +37,10 @@ const uint8_t bitMask6[]= { 0, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff };
 /// @param len prefix length
 isc::asiolink::IOAddress firstAddrInPrefix6(const isc::asiolink::IOAddress& prefix,
                                             uint8_t len) {
-    if (len > 128) {
-        isc_throw(isc::BadValue,
-                  "Too large netmask. 0..128 is allowed in IPv6");
-    }
-
-    // First we copy the whole address as 16 bytes.
-    // We don't check that it is a valid IPv6 address and thus has
-    // the required length because it is already checked by
-    // the calling function.
-    uint8_t packed[V6ADDRESS_LEN];
-    memcpy(packed, &prefix.toBytes()[0], V6ADDRESS_LEN);
-
-    // If the length is divisible by 8, it is simple. We just zero out the host
-    // part. Otherwise we need to handle the byte that has to be partially
-    // zeroed.
-    if (len % 8 != 0) {
-
-        // Get the appropriate mask. It has relevant bits (those that should
-        // stay) set and irrelevant (those that should be wiped) cleared.
-        uint8_t mask = bitMask6[len % 8];
-
-        // Let's leave only whatever the mask says should not be cleared.
-        packed[len / 8] = packed[len / 8] & mask;
-
-        // Since we have just dealt with this byte, let's move the prefix length
-        // to the beginning of the next byte (len is expressed in bits).
-        len = (len / 8 + 1) * 8;
-    }
-
-    // Clear out the remaining bits.
-    for (int i = len / 8; i < sizeof(packed); ++i) {
-        packed[i] = 0x0;
-    }
-
-    // Finally, let's wrap this into nice and easy IOAddress object.
-    return (isc::asiolink::IOAddress::fromBytes(AF_INET6, packed));
+    // The host bits are cleared on the numeric value of the address. We
+    // don't check that it is a valid IPv6 address because it is already
+    // checked by the calling function.
+    return (AddressValue(prefix).firstInPrefix(len).toIOAddress());
 }
 
 /// @brief calculates the first IPv4 address in a IPv4 prefix
@@ -125,41 +89,8 @@ isc::asiolink::IOAddress lastAddrInPrefix4(const isc::asiolink::IOAddress& prefi
 /// @param len netmask length (0-128)
 isc::asiolink::IOAddress lastAddrInPrefix6(const isc::asiolink::IOAddress& prefix,
                                            uint8_t len) {
-    if (len > 128) {
-        isc_throw(isc::BadValue,
-                  "Too large netmask. 0..128 is allowed in IPv6");
-    }
-
-    // First we copy the whole address as 16 bytes.
-    uint8_t packed[V6ADDRESS_LEN];
-    memcpy(packed, &prefix.toBytes()[0], 16);
-
-    // if the length is divisible by 8, it is simple. We just fill the host part
-    // with ones. Otherwise we need to handle the byte that has to be partially
-    // zeroed.
-    if (len % 8 != 0) {
-        // Get the appropriate mask. It has relevant bits (those that should
-        // stay) set and irrelevant (those that should be set to 1) cleared.
-        uint8_t mask = bitMask6[len % 8];
-
-        // Let's set those irrelevant bits with 1. It would be perhaps
-        // easier to not use negation here and invert bitMask6 content. However,
-        // with this approach, we can use the same mask in first and last
-        // address calculations.
-        packed[len / 8] = packed[len / 8] | ~mask;
-
-        // Since we have just dealt with this byte, let's move the prefix length
-        // to the beginning of the next byte (len is expressed in bits).
-        len = (len / 8 + 1) * 8;
-    }
-
-    // Finally set remaining bits to 1.
-    for (int i = len / 8; i < sizeof(packed); ++i) {
-        packed[i] = 0xff;
-    }
-
-    // Finally, let's wrap this into nice and easy IOAddress object.
-    return (isc::asiolink::IOAddress::fromBytes(AF_INET6, packed));
+    // The host bits are set on the numeric value of the address.
+    return (AddressValue(prefix).lastInPrefix(len).toIOAddress());
 }
 
 }; // end of anonymous namespace
@@ -229,44 +160,28 @@ addrsInRange(const isc::asiolink::IOAddress& min,
         // [a, b] range to the [0, (b-a)] range. We don't care about the beginning
         // of the new range (it's always zero). The upper bound now specifies
         // the number of addresses minus one.
-        IOAddress count = IOAddress::subtract(max, min);
-
-        // There's one very special case. Someone is trying to check how many
-        // IPv6 addresses are in IPv6 address space. He called this method
-        // with ::, ffff:ffff:ffff:fffff:ffff:ffff:ffff:ffff. The diff is also
-        // all 1s. Had we increased it by one, the address would flip to all 0s.
-        // This will not happen in a real world. Apparently, unit-tests are
-        // sometimes nastier then a real world.
-        static IOAddress max6("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
-        if (count == max6) {
-            return (std::numeric_limits<uint64_t>::max());
-        }
+        AddressValue count = AddressValue::subtract(AddressValue(max),
+                                                    AddressValue(min));
 
         // Increase it by one (a..a range still contains one address, even though
         // a subtracted from a is zero).
-        count = IOAddress::increase(count);
-
-        // We don't have uint128, so for anything greater than 2^64, we'll just
-        // assume numeric_limits<uint64_t>::max. Let's do it the manual way.
-        const std::vector<uint8_t>& bin(count.toBytes());
+        count.increase();
 
         // If any of the most significant 64 bits is set, we have more than
-        // 2^64 addresses and can't represent it even on uint64_t.
-        for (int i = 0 ; i < 8; i++) {
-            if (bin[i]) {
-                return (std::numeric_limits<uint64_t>::max());
-            }
+        // 2^64 addresses and can't represent it even on uint64_t. There's
+        // also one very special case. Someone is trying to check how many
+        // IPv6 addresses are in IPv6 address space. He called this method
+        // with ::, ffff:ffff:ffff:fffff:ffff:ffff:ffff:ffff. The diff is also
+        // all 1s, so increasing it by one flipped it to all 0s. This will not
+        // happen in a real world. Apparently, unit-tests are sometimes
+        // nastier then a real world.
+        if ((count.getHigh() != 0) || (count.getLow() == 0)) {
+            return (std::numeric_limits<uint64_t>::max());
         }
 
         // Ok, we're good. The pool is sanely sized. It may be huge, but at least
         // that's something we can represent on uint64_t.
-        uint64_t numeric = 0;
-        for (int i = 8; i < 16; i++) {
-            numeric <<= 8;
-            numeric += bin[i];
-        }
-
-        return (numeric);
+        return (count.getLow());
     }
 }
 
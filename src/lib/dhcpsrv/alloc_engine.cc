@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <asiolink/address_value.h>
 #include <dhcp/dhcp6.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
@@ -94,52 +95,14 @@ AllocEngine::IterativeAllocator::increasePrefix(const isc::asiolink::IOAddress&
                   "increase prefix " << prefix << ")");
     }
 
-    // Get a buffer holding an address.
-    const std::vector<uint8_t>& vec = prefix.toBytes();
-
     if (prefix_len < 1 || prefix_len > 128) {
         isc_throw(BadValue, "Cannot increase prefix: invalid prefix length: "
                   << prefix_len);
     }
 
-    // Brief explanation what happens here:
-    // http://www.youtube.com/watch?v=NFQCYpIHLNQ
-
-    uint8_t n_bytes = (prefix_len - 1)/8;
-    uint8_t n_bits = 8 - (prefix_len - n_bytes*8);
-    uint8_t mask = 1 << n_bits;
-
-    // Longer explanation: n_bytes specifies number of full bytes that are
-    // in-prefix. They can also be used as an offset for the first byte that
-    // is not in prefix. n_bits specifies number of bits on the last byte that
-    // is (often partially) in prefix. For example for a /125 prefix, the values
-    // are 15 and 3, respectively. Mask is a bitmask that has the least
-    // significant bit from the prefix set.
-
-    uint8_t packed[V6ADDRESS_LEN];
-
-    // Copy the address. It must be V6, but we already checked that.
-    std::memcpy(packed, &vec[0], V6ADDRESS_LEN);
-
-    // Can we safely increase only the last byte in prefix without overflow?
-    if (packed[n_bytes] + uint16_t(mask) < 256u) {
-        packed[n_bytes] += mask;
-        return (IOAddress::fromBytes(AF_INET6, packed));
-    }
-
-    // Overflow (done on uint8_t, but the sum is greater than 255)
-    packed[n_bytes] += mask;
-
-    // Deal with the overflow. Start increasing the least significant byte
-    for (int i = n_bytes - 1; i >= 0; --i) {
-        ++packed[i];
-        // If we haven't overflowed (0xff->0x0) the next byte, then we are done
-        if (packed[i] != 0) {
-            break;
-        }
-    }
-
-    return (IOAddress::fromBytes(AF_INET6, packed));
+    // The least significant bit of the prefix is added to the numeric
+    // value of the address, which carries over the bytes as needed.
+    return (AddressValue(prefix).nextPrefix(prefix_len).toIOAddress());
 }
 
 
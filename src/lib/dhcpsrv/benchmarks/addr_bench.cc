@@ -0,0 +1,238 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/addr_utilities.h>
+#include <dhcpsrv/alloc_engine.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <dhcpsrv/pool.h>
+#include <dhcpsrv/subnet.h>
+#include <log/logger_support.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief Number of addresses checked or allocated by a single run.
+const size_t NUM_ADDRESSES = 1000000;
+
+/// @brief Exposes the allocator of the allocation engine.
+///
+/// The class is never instantiated.
+class BenchAllocEngine : public AllocEngine {
+public:
+    /// @brief Allocator used by the servers by default.
+    typedef AllocEngine::IterativeAllocator BenchAllocator;
+};
+
+/// @brief Returns addresses randomly spread around a prefix.
+///
+/// Half of the addresses belong to the prefix, the other half to the
+/// following prefix of the same length.
+///
+/// @param prefix prefix
+/// @param len prefix length
+/// @param count number of addresses
+std::vector<IOAddress>
+randomAddresses(const IOAddress& prefix, const uint8_t len,
+                const size_t count) {
+    BenchRandom random(BENCH_SEED);
+    std::vector<uint8_t> bytes = prefix.toBytes();
+    const size_t host_bytes = (bytes.size() * 8 - len) / 8;
+    std::vector<IOAddress> addresses;
+    addresses.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = bytes.size() - host_bytes; j < bytes.size(); ++j) {
+            bytes[j] = static_cast<uint8_t>(random());
+        }
+        // The last byte of the prefix selects the prefix or the next one.
+        const size_t last = bytes.size() - host_bytes - 1;
+        bytes[last] = prefix.toBytes()[last] + (i % 2);
+        addresses.push_back(IOAddress::fromBytes(prefix.getFamily(),
+                                                 &bytes[0]));
+    }
+    return (addresses);
+}
+
+/// @brief Measures Pool::inRange.
+class PoolInRangeBench {
+public:
+    PoolInRangeBench(const PoolPtr& pool,
+                     const std::vector<IOAddress>& addresses)
+        : pool_(pool), addresses_(addresses), found_(0) {
+    }
+    size_t run() {
+        for (size_t i = 0; i < addresses_.size(); ++i) {
+            if (pool_->inRange(addresses_[i])) {
+                ++found_;
+            }
+        }
+        return (addresses_.size());
+    }
+private:
+    PoolPtr pool_;
+    const std::vector<IOAddress>& addresses_;
+    size_t found_;
+};
+
+/// @brief Measures Subnet::inRange.
+class SubnetInRangeBench {
+public:
+    SubnetInRangeBench(const SubnetPtr& subnet,
+                       const std::vector<IOAddress>& addresses)
+        : subnet_(subnet), addresses_(addresses), found_(0) {
+    }
+    size_t run() {
+        for (size_t i = 0; i < addresses_.size(); ++i) {
+            if (subnet_->inRange(addresses_[i])) {
+                ++found_;
+            }
+        }
+        return (addresses_.size());
+    }
+private:
+    SubnetPtr subnet_;
+    const std::vector<IOAddress>& addresses_;
+    size_t found_;
+};
+
+/// @brief Measures firstAddrInPrefix and lastAddrInPrefix.
+class PrefixBoundsBench {
+public:
+    PrefixBoundsBench(const std::vector<IOAddress>& addresses,
+                      const uint8_t len)
+        : addresses_(addresses), len_(len) {
+    }
+    size_t run() {
+        for (size_t i = 0; i < addresses_.size(); ++i) {
+            firstAddrInPrefix(addresses_[i], len_);
+            lastAddrInPrefix(addresses_[i], len_);
+        }
+        return (addresses_.size());
+    }
+private:
+    const std::vector<IOAddress>& addresses_;
+    uint8_t len_;
+};
+
+/// @brief Measures IOAddress::increase.
+class IncreaseBench {
+public:
+    IncreaseBench(const IOAddress& first, const size_t count)
+        : first_(first), count_(count) {
+    }
+    size_t run() {
+        IOAddress addr(first_);
+        for (size_t i = 0; i < count_; ++i) {
+            addr = IOAddress::increase(addr);
+        }
+        return (count_);
+    }
+private:
+    IOAddress first_;
+    size_t count_;
+};
+
+/// @brief Measures the iterative allocator picking the candidate
+/// addresses or prefixes from the pools of a subnet.
+class PickAddressBench {
+public:
+    PickAddressBench(const SubnetPtr& subnet, const Lease::Type type,
+                     const size_t count)
+        : subnet_(subnet), allocator_(type), count_(count) {
+    }
+    size_t run() {
+        const DuidPtr duid;
+        const IOAddress hint("::");
+        for (size_t i = 0; i < count_; ++i) {
+            allocator_.pickAddress(subnet_, duid, hint);
+        }
+        return (count_);
+    }
+private:
+    SubnetPtr subnet_;
+    BenchAllocEngine::BenchAllocator allocator_;
+    size_t count_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("addr-bench", isc::log::WARN);
+
+    const size_t num_addresses = params.scale(NUM_ADDRESSES);
+
+    // The subnets have several pools, like most deployments, and the
+    // iterative allocator walks through all of them.
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("10.0.0.0"), 8, 1000, 2000,
+                                   3000));
+    Subnet6Ptr subnet6(new Subnet6(IOAddress("2001:db8::"), 32, 1000, 2000,
+                                   3000, 4000));
+    for (int i = 0; i < 4; ++i) {
+        subnet4->addPool(Pool4Ptr(new Pool4(IOAddress(0x0a000000 + (i << 16)),
+                                            24)));
+        std::vector<uint8_t> prefix = IOAddress("2001:db8::").toBytes();
+        prefix[5] = static_cast<uint8_t>(i);
+        subnet6->addPool(Pool6Ptr(new Pool6(Lease::TYPE_NA,
+                                            IOAddress::fromBytes(AF_INET6,
+                                                                 &prefix[0]),
+                                            112)));
+        prefix[4] = 0x80;
+        subnet6->addPool(Pool6Ptr(new Pool6(Lease::TYPE_PD,
+                                            IOAddress::fromBytes(AF_INET6,
+                                                                 &prefix[0]),
+                                            48, 64)));
+    }
+
+    const std::vector<IOAddress> addresses4 =
+        randomAddresses(IOAddress("10.0.0.0"), 24, num_addresses);
+    const std::vector<IOAddress> addresses6 =
+        randomAddresses(IOAddress("2001:db8::"), 112, num_addresses);
+
+    std::cout << "Range checks with " << num_addresses << " addresses"
+              << std::endl;
+    PoolInRangeBench pool4_bench(subnet4->getPools(Lease::TYPE_V4)[0],
+                                 addresses4);
+    runBenchMark("Pool4::inRange", pool4_bench, params.iterations_);
+    PoolInRangeBench pool6_bench(subnet6->getPools(Lease::TYPE_NA)[0],
+                                 addresses6);
+    runBenchMark("Pool6::inRange", pool6_bench, params.iterations_);
+    SubnetInRangeBench subnet4_bench(subnet4, addresses4);
+    runBenchMark("Subnet4::inRange", subnet4_bench, params.iterations_);
+    SubnetInRangeBench subnet6_bench(subnet6, addresses6);
+    runBenchMark("Subnet6::inRange", subnet6_bench, params.iterations_);
+    PrefixBoundsBench bounds_bench(addresses6, 56);
+    runBenchMark("first/lastAddrInPrefix (v6)", bounds_bench,
+                 params.iterations_);
+
+    std::cout << std::endl << "Address iteration with " << num_addresses
+              << " addresses" << std::endl;
+    IncreaseBench increase4_bench(IOAddress("10.0.0.0"), num_addresses);
+    runBenchMark("IOAddress::increase (v4)", increase4_bench,
+                 params.iterations_);
+    IncreaseBench increase6_bench(IOAddress("2001:db8::"), num_addresses);
+    runBenchMark("IOAddress::increase (v6)", increase6_bench,
+                 params.iterations_);
+    PickAddressBench pick4_bench(subnet4, Lease::TYPE_V4, num_addresses);
+    runBenchMark("IterativeAllocator (v4)", pick4_bench, params.iterations_);
+    PickAddressBench pick6_bench(subnet6, Lease::TYPE_NA, num_addresses);
+    runBenchMark("IterativeAllocator (NA)", pick6_bench, params.iterations_);
+    PickAddressBench pickpd_bench(subnet6, Lease::TYPE_PD, num_addresses);
+    runBenchMark("IterativeAllocator (PD)", pickpd_bench, params.iterations_);
+
+    return (0);
+}
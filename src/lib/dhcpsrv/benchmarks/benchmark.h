@@ -0,0 +1,141 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DHCPSRV_BENCHMARK_H
+#define DHCPSRV_BENCHMARK_H
+
+#include <util/stopwatch.h>
+#include <boost/random/mersenne_twister.hpp>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace isc {
+namespace dhcp {
+namespace bench {
+
+/// @brief Seed of the random number generator used to build workloads.
+///
+/// The seed is fixed so as all runs of a benchmark operate on exactly
+/// the same data and their results can be compared.
+const uint32_t BENCH_SEED = 0x6b656121;
+
+/// @brief Random number generator used to build workloads.
+typedef boost::mt19937 BenchRandom;
+
+/// @brief Benchmark parameters taken from the command line.
+struct BenchParams {
+    /// @brief Number of times each benchmark is repeated.
+    unsigned int iterations_;
+
+    /// @brief Divisor applied to the size of the synthetic data sets.
+    ///
+    /// The default data sets are large (e.g. 1M leases) to mimic big
+    /// deployments. The divisor allows for quick runs during development.
+    unsigned int divisor_;
+
+    /// @brief Constructor.
+    BenchParams() : iterations_(1), divisor_(1) {
+    }
+
+    /// @brief Returns the size of a data set scaled with the divisor.
+    ///
+    /// @param size default size of the data set
+    /// @return scaled size, at least 1
+    size_t scale(const size_t size) const {
+        const size_t scaled = size / divisor_;
+        return (scaled > 0 ? scaled : 1);
+    }
+};
+
+/// @brief Prints usage of a benchmark program and exits.
+///
+/// @param progname program name
+inline void
+benchUsage(const char* progname) {
+    std::cerr << "Usage: " << progname << " [-n iterations] [-d divisor]"
+              << std::endl
+              << "  -n: number of times each benchmark is repeated (default 1)"
+              << std::endl
+              << "  -d: divide the size of the synthetic data sets"
+              << " (default 1)" << std::endl;
+    exit(1);
+}
+
+/// @brief Parses the command line of a benchmark program.
+///
+/// @param argc number of arguments
+/// @param argv arguments
+/// @return parsed parameters
+inline BenchParams
+parseBenchArgs(int argc, char* argv[]) {
+    BenchParams params;
+    int ch;
+    while ((ch = getopt(argc, argv, "n:d:")) != -1) {
+        switch (ch) {
+        case 'n':
+            params.iterations_ = atoi(optarg);
+            break;
+        case 'd':
+            params.divisor_ = atoi(optarg);
+            break;
+        default:
+            benchUsage(argv[0]);
+        }
+    }
+    if ((params.iterations_ == 0) || (params.divisor_ == 0) ||
+        (optind < argc)) {
+        benchUsage(argv[0]);
+    }
+    return (params);
+}
+
+/// @brief Runs a benchmark and prints its result.
+///
+/// The benchmark class must provide a @c run method which performs
+/// the measured operations and returns the number of operations it
+/// performed. The @c run method is called the specified number of
+/// times and the average throughput and per-operation cost are
+/// printed on the standard output.
+///
+/// @tparam T benchmark class
+/// @param name benchmark name
+/// @param target benchmark object
+/// @param iterations number of times the benchmark is repeated
+template<typename T>
+void
+runBenchMark(const std::string& name, T& target,
+             const unsigned int iterations) {
+    isc::util::Stopwatch stopwatch(false);
+    uint64_t operations = 0;
+    for (unsigned int i = 0; i < iterations; ++i) {
+        stopwatch.start();
+        operations += target.run();
+        stopwatch.stop();
+    }
+
+    const double usec = static_cast<double>(stopwatch.getTotalMicroseconds());
+    std::cout << std::left << std::setw(32) << name << std::right
+              << std::setw(10) << operations << " ops "
+              << std::fixed << std::setprecision(3)
+              << std::setw(10) << (usec / 1000000.0) << " s ";
+    if ((usec > 0) && (operations > 0)) {
+        std::cout << std::setw(12) << std::setprecision(0)
+                  << (operations * 1000000.0 / usec) << " ops/s "
+                  << std::setw(10) << std::setprecision(1)
+                  << (usec * 1000.0 / operations) << " ns/op";
+    }
+    std::cout << std::endl;
+}
+
+} // end of namespace isc::dhcp::bench
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // DHCPSRV_BENCHMARK_H
@@ -0,0 +1,198 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <dhcpsrv/cfg_hosts.h>
+#include <dhcpsrv/cfg_subnets4.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/subnet_selector.h>
+#include <log/logger_support.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief Default number of subnets.
+const size_t NUM_SUBNETS = 10000;
+
+/// @brief Default number of host reservations.
+const size_t NUM_RESERVATIONS = 100000;
+
+/// @brief Number of subnets the reservations are spread across.
+const uint32_t NUM_RESERVATION_SUBNETS = 1000;
+
+/// @brief Number of lookups performed by a single run.
+const size_t NUM_LOOKUPS = 1000000;
+
+/// @brief Returns the prefix of the subnet with the given index.
+///
+/// The subnets are /24 prefixes starting at 10.0.0.0.
+///
+/// @param index subnet index
+uint32_t
+subnetPrefix(const uint32_t index) {
+    return (0x0a000000 + (index << 8));
+}
+
+/// @brief Returns a HW address derived from an index.
+///
+/// @param index index of the client
+std::vector<uint8_t>
+makeHWAddr(const uint32_t index) {
+    std::vector<uint8_t> hwaddr(6, 0);
+    hwaddr[0] = 0x02;
+    hwaddr[2] = static_cast<uint8_t>(index >> 24);
+    hwaddr[3] = static_cast<uint8_t>(index >> 16);
+    hwaddr[4] = static_cast<uint8_t>(index >> 8);
+    hwaddr[5] = static_cast<uint8_t>(index);
+    return (hwaddr);
+}
+
+/// @brief Measures subnet selection for relayed clients.
+///
+/// The configuration holds many subnets and every lookup selects the
+/// subnet by the relay address, which is the most common case in large
+/// deployments.
+class SelectSubnetByRelayBench {
+public:
+    SelectSubnetByRelayBench(const size_t num_subnets, const size_t lookups)
+        : subnets_(), selectors_() {
+        for (uint32_t i = 0; i < num_subnets; ++i) {
+            Subnet4Ptr subnet(new Subnet4(IOAddress(subnetPrefix(i)), 24,
+                                          900, 1800, 3600, i + 1));
+            subnet->addPool(Pool4Ptr(new Pool4(IOAddress(subnetPrefix(i) + 10),
+                                               IOAddress(subnetPrefix(i) + 250))));
+            subnets_.add(subnet);
+        }
+        BenchRandom random(BENCH_SEED);
+        selectors_.resize(lookups);
+        for (size_t i = 0; i < lookups; ++i) {
+            selectors_[i].giaddr_ = IOAddress(subnetPrefix(random() % num_subnets) + 1);
+            selectors_[i].remote_address_ = selectors_[i].giaddr_;
+            selectors_[i].local_address_ = IOAddress("192.0.2.1");
+            selectors_[i].iface_name_ = "eth0";
+        }
+    }
+    size_t run() {
+        for (size_t i = 0; i < selectors_.size(); ++i) {
+            subnets_.selectSubnet(selectors_[i]);
+        }
+        return (selectors_.size());
+    }
+private:
+    CfgSubnets4 subnets_;
+    std::vector<SubnetSelector> selectors_;
+};
+
+/// @brief Host reservations shared by the host lookup benchmarks.
+///
+/// The reservations use the HW address as identifier and are evenly
+/// spread across subnets. The lookup order is random and half of the
+/// lookups are for clients without reservations, which is what the
+/// server does for every client it serves.
+class HostTable {
+public:
+    HostTable(const size_t num_hosts, const size_t lookups)
+        : hosts_(), identifiers_(), subnet_ids_(), addresses_() {
+        for (uint32_t i = 0; i < num_hosts; ++i) {
+            const SubnetID subnet_id = 1 + (i % NUM_RESERVATION_SUBNETS);
+            const std::vector<uint8_t> hwaddr = makeHWAddr(i);
+            const IOAddress address(subnetPrefix(subnet_id) + 10 +
+                                    i / NUM_RESERVATION_SUBNETS);
+            HostPtr host(new Host(&hwaddr[0], hwaddr.size(), Host::IDENT_HWADDR,
+                                  subnet_id, 0, address));
+            hosts_.add(host);
+        }
+        BenchRandom random(BENCH_SEED);
+        for (size_t i = 0; i < lookups; ++i) {
+            const uint32_t index = random() % (2 * num_hosts);
+            identifiers_.push_back(makeHWAddr(index));
+            subnet_ids_.push_back(1 + (index % NUM_RESERVATION_SUBNETS));
+            addresses_.push_back(IOAddress(subnetPrefix(subnet_ids_.back()) + 10 +
+                                           index / NUM_RESERVATION_SUBNETS));
+        }
+    }
+
+    /// @brief Host reservations under test.
+    CfgHosts hosts_;
+
+    /// @brief Identifiers used for lookups.
+    std::vector<std::vector<uint8_t> > identifiers_;
+
+    /// @brief Subnet identifiers used for lookups.
+    std::vector<SubnetID> subnet_ids_;
+
+    /// @brief Addresses used for lookups.
+    std::vector<IOAddress> addresses_;
+};
+
+/// @brief Measures lookups of reservations by identifier.
+class GetHostByIdentifierBench {
+public:
+    GetHostByIdentifierBench(const HostTable& table) : table_(table) {
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.identifiers_.size(); ++i) {
+            const std::vector<uint8_t>& id = table_.identifiers_[i];
+            table_.hosts_.get4(table_.subnet_ids_[i], Host::IDENT_HWADDR,
+                               &id[0], id.size());
+        }
+        return (table_.identifiers_.size());
+    }
+private:
+    const HostTable& table_;
+};
+
+/// @brief Measures lookups of reservations by reserved address.
+class GetHostByAddressBench {
+public:
+    GetHostByAddressBench(const HostTable& table) : table_(table) {
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.addresses_.size(); ++i) {
+            table_.hosts_.get4(table_.subnet_ids_[i], table_.addresses_[i]);
+        }
+        return (table_.addresses_.size());
+    }
+private:
+    const HostTable& table_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("cfg-bench", isc::log::WARN);
+
+    const size_t num_subnets = params.scale(NUM_SUBNETS);
+    const size_t num_lookups = params.scale(NUM_LOOKUPS);
+    std::cout << "CfgSubnets4 with " << num_subnets << " subnets" << std::endl;
+    SelectSubnetByRelayBench select_bench(num_subnets, num_lookups);
+    runBenchMark("selectSubnet(giaddr)", select_bench, params.iterations_);
+
+    const size_t num_hosts = params.scale(NUM_RESERVATIONS);
+    std::cout << std::endl << "CfgHosts with " << num_hosts
+              << " reservations" << std::endl;
+    const HostTable table(num_hosts, num_lookups);
+    GetHostByIdentifierBench get_id_bench(table);
+    runBenchMark("get4(subnet, identifier)", get_id_bench, params.iterations_);
+    GetHostByAddressBench get_addr_bench(table);
+    runBenchMark("get4(subnet, address)", get_addr_bench, params.iterations_);
+
+    return (0);
+}
@@ -0,0 +1,161 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <dhcpsrv/subnet.h>
+#include <hooks/callout_handle.h>
+#include <hooks/callout_manager.h>
+#include <hooks/hooks_manager.h>
+#include <log/logger_support.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <iostream>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace isc::hooks;
+
+namespace {
+
+/// @brief Number of packets processed by a single run.
+const size_t NUM_PACKETS = 1000000;
+
+/// @brief Index of the hook point the callouts are registered on.
+int hook_index_bench = -1;
+
+/// @brief Indexes of the arguments, as registered by kea-dhcp4.
+int arg_index_query4 = -1;
+int arg_index_subnet4 = -1;
+int arg_index_subnet4collection = -1;
+
+/// @brief Callout reading the arguments by name, as a library does.
+///
+/// @param handle callout handle
+/// @return 0
+int
+benchCallout(CalloutHandle& handle) {
+    Pkt4Ptr query;
+    Subnet4Ptr subnet;
+    handle.getArgument("query4", query);
+    handle.getArgument("subnet4", subnet);
+    return (0);
+}
+
+/// @brief Measures the overhead of a hook point, per packet.
+///
+/// The work done for each packet is the one of kea-dhcp4 at the
+/// subnet4_select hook point: the callout handle is obtained for the
+/// packet, three arguments are set, the callouts are called and an
+/// argument is read back.  One callout reading two arguments is
+/// registered by each library.
+///
+/// The libraries are simulated by registering the callouts directly with
+/// a CalloutManager, so the benchmark doesn't depend on loadable modules.
+class HookPointBench {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param num_libraries number of libraries with a callout
+    /// @param recycle recycle the callout handle rather than creating a new
+    /// one for each packet
+    /// @param by_index set and get the arguments by index rather than by name
+    /// @param packets number of packets processed by a run
+    HookPointBench(const int num_libraries, const bool recycle,
+                   const bool by_index, const size_t packets)
+        : manager_(new CalloutManager(num_libraries)),
+          query_(new Pkt4(DHCPDISCOVER, 1234)),
+          subnet_(new Subnet4(asiolink::IOAddress("192.0.2.0"), 24,
+                              1000, 2000, 3000, 1)),
+          subnets_(), recycle_(recycle), by_index_(by_index),
+          packets_(packets) {
+        subnets_.push_back(subnet_);
+        for (int i = 1; i <= num_libraries; ++i) {
+            manager_->setLibraryIndex(i);
+            manager_->registerCallout("bench_hook", benchCallout);
+        }
+        manager_->setLibraryIndex(-1);
+    }
+
+    size_t run() {
+        const Subnet4Collection* subnets = &subnets_;
+        CalloutHandlePtr handle;
+        for (size_t i = 0; i < packets_; ++i) {
+            if (recycle_ && handle) {
+                handle->recycle();
+            } else {
+                handle.reset(new CalloutHandle(manager_));
+            }
+
+            Subnet4Ptr subnet;
+            if (by_index_) {
+                handle->setArgument(arg_index_query4, query_);
+                handle->setArgument(arg_index_subnet4, subnet_);
+                handle->setArgument(arg_index_subnet4collection, subnets);
+                manager_->callCallouts(hook_index_bench, *handle);
+                handle->getArgument(arg_index_subnet4, subnet);
+            } else {
+                handle->setArgument("query4", query_);
+                handle->setArgument("subnet4", subnet_);
+                handle->setArgument("subnet4collection", subnets);
+                manager_->callCallouts(hook_index_bench, *handle);
+                handle->getArgument("subnet4", subnet);
+            }
+        }
+        return (packets_);
+    }
+
+private:
+    boost::shared_ptr<CalloutManager> manager_;
+    Pkt4Ptr query_;
+    Subnet4Ptr subnet_;
+    Subnet4Collection subnets_;
+    bool recycle_;
+    bool by_index_;
+    size_t packets_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("hooks-bench", isc::log::WARN);
+
+    // The hook and the arguments must be registered before the callout
+    // managers are created.
+    hook_index_bench = HooksManager::registerHook("bench_hook");
+    arg_index_query4 = HooksManager::registerArgument("query4");
+    arg_index_subnet4 = HooksManager::registerArgument("subnet4");
+    arg_index_subnet4collection =
+        HooksManager::registerArgument("subnet4collection");
+
+    const size_t num_packets = params.scale(NUM_PACKETS);
+    const int libraries[] = { 1, 5 };
+    for (size_t i = 0; i < sizeof(libraries) / sizeof(libraries[0]); ++i) {
+        std::cout << "Hook point with " << libraries[i] << " librar"
+                  << (libraries[i] > 1 ? "ies" : "y") << ", "
+                  << num_packets << " packets" << std::endl;
+
+        HookPointBench by_name(libraries[i], false, false, num_packets);
+        runBenchMark("new handle, by name", by_name, params.iterations_);
+
+        HookPointBench by_index(libraries[i], false, true, num_packets);
+        runBenchMark("new handle, by index", by_index, params.iterations_);
+
+        HookPointBench recycled(libraries[i], true, true, num_packets);
+        runBenchMark("recycled handle, by index", recycled,
+                     params.iterations_);
+        std::cout << std::endl;
+    }
+
+    return (0);
+}
@@ -0,0 +1,165 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/data.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <log/logger_support.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace isc;
+using namespace isc::data;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief Number of subnets in the configuration.
+const size_t NUM_SUBNETS = 10000;
+
+/// @brief Number of host reservations per subnet.
+const size_t NUM_RESERVATIONS = 4;
+
+/// @brief Name of the configuration file written by the benchmark.
+const char* CONFIG_FILE = "json-bench.json";
+
+/// @brief Returns a DHCPv4 server configuration.
+///
+/// Each subnet has a pool, options and host reservations, and is
+/// preceded by a comment line.
+///
+/// @param num_subnets number of subnets.
+std::string
+generateConfig(const size_t num_subnets) {
+    std::ostringstream s;
+    s << "# Generated by json_bench\n"
+      << "{ \"Dhcp4\": {\n"
+      << "    \"interfaces-config\": { \"interfaces\": [ \"*\" ] },\n"
+      << "    \"valid-lifetime\": 4000,\n"
+      << "    \"subnet4\": [\n";
+    for (size_t i = 0; i < num_subnets; ++i) {
+        const size_t b = (i >> 8) & 0xff;
+        const size_t c = i & 0xff;
+        s << "# subnet " << i + 1 << "\n"
+          << "    {\n"
+          << "        \"id\": " << i + 1 << ",\n"
+          << "        \"subnet\": \"10." << b << "." << c << ".0/24\",\n"
+          << "        \"pools\": [ { \"pool\": \"10." << b << "." << c
+          << ".10 - 10." << b << "." << c << ".200\" } ],\n"
+          << "        \"option-data\": [\n"
+          << "            { \"name\": \"routers\", \"data\": \"10." << b
+          << "." << c << ".1\" },\n"
+          << "            { \"name\": \"domain-name\","
+          << " \"data\": \"subnet" << i + 1 << ".example.org\" }\n"
+          << "        ],\n"
+          << "        \"reservations\": [\n";
+        for (size_t j = 0; j < NUM_RESERVATIONS; ++j) {
+            s << "            { \"hw-address\": \"02:00:"
+              << std::hex << std::setfill('0') << std::setw(2) << b << ":"
+              << std::setw(2) << c << ":" << std::setw(2) << j
+              << std::dec << ":01\","
+              << " \"ip-address\": \"10." << b << "." << c << "."
+              << 201 + j << "\","
+              << " \"hostname\": \"host" << j << "-" << i + 1 << "\" }"
+              << (j + 1 < NUM_RESERVATIONS ? ",\n" : "\n");
+        }
+        s << "        ]\n"
+          << "    }" << (i + 1 < num_subnets ? ",\n" : "\n");
+    }
+    s << "    ]\n"
+      << "} }\n";
+    return (s.str());
+}
+
+/// @brief Measures Element::fromJSON parsing an input stream.
+class StreamBench {
+public:
+    StreamBench(const std::string& config, const bool preproc)
+        : config_(config), preproc_(preproc) {
+    }
+    size_t run() {
+        std::istringstream in(config_);
+        Element::fromJSON(in, "json-bench", preproc_);
+        return (1);
+    }
+private:
+    const std::string& config_;
+    bool preproc_;
+};
+
+/// @brief Measures Element::fromJSON parsing a string.
+class StringBench {
+public:
+    StringBench(const std::string& config)
+        : config_(config) {
+    }
+    size_t run() {
+        Element::fromJSON(config_, true);
+        return (1);
+    }
+private:
+    const std::string& config_;
+};
+
+/// @brief Measures Element::fromJSONFile.
+class FileBench {
+public:
+    size_t run() {
+        Element::fromJSONFile(CONFIG_FILE, true);
+        return (1);
+    }
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("json-bench", isc::log::WARN);
+
+    const size_t num_subnets = params.scale(NUM_SUBNETS);
+    const std::string config = generateConfig(num_subnets);
+
+    // The stream parser without preprocessing can't skip comments.
+    std::string no_comments;
+    no_comments.reserve(config.size());
+    std::istringstream lines(config);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.empty() || (line[0] != '#')) {
+            no_comments += line;
+            no_comments += '\n';
+        }
+    }
+
+    {
+        std::ofstream out(CONFIG_FILE);
+        out << config;
+    }
+
+    std::cout << "Configuration with " << num_subnets << " subnets and "
+              << num_subnets * NUM_RESERVATIONS << " reservations ("
+              << config.size() << " bytes)" << std::endl;
+    StreamBench stream_bench(no_comments, false);
+    runBenchMark("fromJSON(istream)", stream_bench, params.iterations_);
+    StreamBench preproc_bench(config, true);
+    runBenchMark("fromJSON(istream, preproc)", preproc_bench,
+                 params.iterations_);
+    StringBench string_bench(config);
+    runBenchMark("fromJSON(string, preproc)", string_bench,
+                 params.iterations_);
+    FileBench file_bench;
+    runBenchMark("fromJSONFile(preproc)", file_bench, params.iterations_);
+
+    static_cast<void>(remove(CONFIG_FILE));
+    return (0);
+}
@@ -0,0 +1,245 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <dhcpsrv/binary_lease_file.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/csv_lease_file6.h>
+#include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <log/logger_support.h>
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief Default number of DHCPv4 leases written and read.
+const size_t NUM_LEASES4 = 200000;
+
+/// @brief Default number of DHCPv6 leases written and read.
+const size_t NUM_LEASES6 = 100000;
+
+/// @brief Number of subnets the leases are spread across.
+const uint32_t NUM_SUBNETS = 64;
+
+/// @brief First address of the synthetic DHCPv4 leases (10.0.0.1).
+const uint32_t FIRST_ADDRESS = 0x0a000001;
+
+/// @brief Returns random bytes.
+///
+/// @param random random number generator
+/// @param size number of bytes
+std::vector<uint8_t>
+makeBytes(BenchRandom& random, const size_t size) {
+    boost::random::uniform_int_distribution<uint32_t> dist(0, 255);
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(dist(random));
+    }
+    return (bytes);
+}
+
+/// @brief Returns the hostname of a client.
+///
+/// Every other client has a hostname, as when half of the clients
+/// request DNS updates.
+///
+/// @param index index of the client
+std::string
+makeHostname(const size_t index) {
+    if (index % 2 != 0) {
+        return ("");
+    }
+    std::ostringstream hostname;
+    hostname << "host-" << index << ".subnet-" << (index % NUM_SUBNETS)
+             << ".example.com";
+    return (hostname.str());
+}
+
+/// @brief Creates the DHCPv4 leases of the workload.
+///
+/// @param size number of leases
+std::vector<Lease4Ptr>
+makeLeases4(const size_t size) {
+    BenchRandom random(BENCH_SEED);
+    std::vector<Lease4Ptr> leases;
+    leases.reserve(size);
+    for (uint32_t i = 0; i < size; ++i) {
+        HWAddrPtr hwaddr(new HWAddr(makeBytes(random, 6), HTYPE_ETHER));
+        ClientIdPtr client_id(new ClientId(makeBytes(random, 7)));
+        const std::string hostname = makeHostname(i);
+        Lease4Ptr lease(new Lease4(IOAddress(FIRST_ADDRESS + i), hwaddr,
+                                   client_id, 3600, 900, 1800,
+                                   1500000000 + i, 1 + (i % NUM_SUBNETS),
+                                   !hostname.empty(), !hostname.empty(),
+                                   hostname));
+        leases.push_back(lease);
+    }
+    return (leases);
+}
+
+/// @brief Creates the DHCPv6 leases of the workload.
+///
+/// @param size number of leases
+std::vector<Lease6Ptr>
+makeLeases6(const size_t size) {
+    BenchRandom random(BENCH_SEED);
+    std::vector<Lease6Ptr> leases;
+    leases.reserve(size);
+    IOAddress address("2001:db8::");
+    for (uint32_t i = 0; i < size; ++i) {
+        address = IOAddress::increase(address);
+        DuidPtr duid(new DUID(makeBytes(random, 14)));
+        HWAddrPtr hwaddr(new HWAddr(makeBytes(random, 6), HTYPE_ETHER));
+        const std::string hostname = makeHostname(i);
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA, address, duid, i, 1800,
+                                   3600, 900, 1200, 1 + (i % NUM_SUBNETS),
+                                   !hostname.empty(), !hostname.empty(),
+                                   hostname, hwaddr));
+        lease->cltt_ = 1500000000 + i;
+        leases.push_back(lease);
+    }
+    return (leases);
+}
+
+/// @brief Returns the size of a file.
+///
+/// @param filename name of the file
+size_t
+getFileSize(const std::string& filename) {
+    std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+    return (file.good() ? static_cast<size_t>(file.tellg()) : 0);
+}
+
+/// @brief Measures appending leases to a lease file.
+///
+/// This is the cost paid by the Memfile backend for each lease update.
+///
+/// @tparam LeaseFileType type of the lease file
+/// @tparam LeasePtrType @c Lease4Ptr or @c Lease6Ptr
+template<typename LeaseFileType, typename LeasePtrType>
+class AppendBench {
+public:
+    AppendBench(const std::string& filename,
+                const std::vector<LeasePtrType>& leases)
+        : filename_(filename), leases_(leases) {
+    }
+    size_t run() {
+        static_cast<void>(remove(filename_.c_str()));
+        LeaseFileType lease_file(filename_);
+        lease_file.open();
+        for (size_t i = 0; i < leases_.size(); ++i) {
+            lease_file.append(*leases_[i]);
+        }
+        lease_file.close();
+        return (leases_.size());
+    }
+private:
+    std::string filename_;
+    const std::vector<LeasePtrType>& leases_;
+};
+
+/// @brief Measures loading the leases from a lease file.
+///
+/// This is the cost paid by the Memfile backend at startup and by the
+/// kea-lfc for each lease record.
+///
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6
+/// @tparam LeaseFileType type of the lease file
+/// @tparam StorageType @c Lease4Storage or @c Lease6Storage
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename StorageType>
+class LoadBench {
+public:
+    explicit LoadBench(const std::string& filename)
+        : filename_(filename) {
+    }
+    size_t run() {
+        StorageType storage;
+        LeaseFileType lease_file(filename_);
+        LeaseFileLoader::load<LeaseObjectType>(lease_file, storage);
+        return (lease_file.getReadLeases());
+    }
+private:
+    std::string filename_;
+};
+
+/// @brief Runs the append and load benchmarks for a lease file type.
+///
+/// @param name name of the lease file format
+/// @param filename name of the lease file
+/// @param leases leases written to the file
+/// @param params benchmark parameters
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6
+/// @tparam LeaseFileType type of the lease file
+/// @tparam StorageType @c Lease4Storage or @c Lease6Storage
+/// @tparam LeasePtrType @c Lease4Ptr or @c Lease6Ptr
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename StorageType, typename LeasePtrType>
+void
+runFileBench(const std::string& name, const std::string& filename,
+             const std::vector<LeasePtrType>& leases,
+             const BenchParams& params) {
+    AppendBench<LeaseFileType, LeasePtrType> append_bench(filename, leases);
+    runBenchMark("append(" + name + ")", append_bench, params.iterations_);
+    LoadBench<LeaseObjectType, LeaseFileType, StorageType> load_bench(filename);
+    runBenchMark("load(" + name + ")", load_bench, params.iterations_);
+    std::cout << std::left << std::setw(32) << ("file size(" + name + ")")
+              << std::right << std::setw(10)
+              << (getFileSize(filename) / leases.size())
+              << " bytes/lease" << std::endl;
+    static_cast<void>(remove(filename.c_str()));
+}
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("lease-file-bench", isc::log::WARN);
+
+    const std::vector<Lease4Ptr> leases4 =
+        makeLeases4(params.scale(NUM_LEASES4));
+    std::cout << "DHCPv4 lease files with " << leases4.size() << " leases"
+              << std::endl;
+    runFileBench<Lease4, CSVLeaseFile4, Lease4Storage>("csv4",
+                                                        "lease-file-bench4.csv",
+                                                        leases4, params);
+    runFileBench<Lease4, BinaryLeaseFile4, Lease4Storage>("binary4",
+                                                           "lease-file-bench4.bin",
+                                                           leases4, params);
+    std::cout << std::endl;
+
+    const std::vector<Lease6Ptr> leases6 =
+        makeLeases6(params.scale(NUM_LEASES6));
+    std::cout << "DHCPv6 lease files with " << leases6.size() << " leases"
+              << std::endl;
+    runFileBench<Lease6, CSVLeaseFile6, Lease6Storage>("csv6",
+                                                        "lease-file-bench6.csv",
+                                                        leases6, params);
+    runFileBench<Lease6, BinaryLeaseFile6, Lease6Storage>("binary6",
+                                                           "lease-file-bench6.bin",
+                                                           leases6, params);
+
+    return (0);
+}
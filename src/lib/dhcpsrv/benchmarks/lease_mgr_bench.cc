@@ -0,0 +1,438 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/alloc_engine.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/host_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/memfile_lease_mgr.h>
+#include <log/logger_support.h>
+
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief Default number of leases in the lease table.
+const size_t NUM_LEASES = 1000000;
+
+/// @brief Number of leases of the largest memory usage report.
+const size_t NUM_LEASES_LARGE = 10000000;
+
+/// @brief Default number of leases allocated by the allocation engine.
+const size_t NUM_ALLOCATIONS = 100000;
+
+/// @brief Number of subnets the leases are spread across.
+const uint32_t NUM_SUBNETS = 64;
+
+/// @brief First address of the synthetic leases (10.0.0.1).
+const uint32_t FIRST_ADDRESS = 0x0a000001;
+
+/// @brief Returns a HW address derived from an index.
+///
+/// @param index index of the client
+HWAddrPtr
+makeHWAddr(const uint32_t index) {
+    std::vector<uint8_t> hwaddr(6, 0);
+    hwaddr[0] = 0x02;
+    hwaddr[2] = static_cast<uint8_t>(index >> 24);
+    hwaddr[3] = static_cast<uint8_t>(index >> 16);
+    hwaddr[4] = static_cast<uint8_t>(index >> 8);
+    hwaddr[5] = static_cast<uint8_t>(index);
+    return (HWAddrPtr(new HWAddr(hwaddr, HTYPE_ETHER)));
+}
+
+/// @brief Returns a client identifier derived from an index.
+///
+/// @param index index of the client
+ClientIdPtr
+makeClientId(const uint32_t index) {
+    std::vector<uint8_t> client_id(7, 0);
+    client_id[0] = 0x01;
+    client_id[1] = 0x02;
+    client_id[3] = static_cast<uint8_t>(index >> 24);
+    client_id[4] = static_cast<uint8_t>(index >> 16);
+    client_id[5] = static_cast<uint8_t>(index >> 8);
+    client_id[6] = static_cast<uint8_t>(index);
+    return (ClientIdPtr(new ClientId(client_id)));
+}
+
+/// @brief Returns the resident memory size of the process.
+///
+/// @return size in bytes, 0 if it can't be determined on this system
+size_t
+getResidentMemory() {
+    std::ifstream statm("/proc/self/statm");
+    size_t size = 0;
+    size_t resident = 0;
+    if (!(statm >> size >> resident)) {
+        return (0);
+    }
+    return (resident * sysconf(_SC_PAGESIZE));
+}
+
+/// @brief Reports the memory used by the Memfile_LeaseMgr per lease.
+///
+/// The leases are inserted into an empty lease manager and the growth of
+/// the resident memory is divided by the number of leases. The leases are
+/// created one at a time, so the measured memory is the one used by the
+/// lease storage. The measurement is made in a child process, so as the
+/// memory freed by the previous measurements is not reused.
+///
+/// @param num_leases number of leases
+void
+reportLeaseMemory(const size_t num_leases) {
+    std::cout << std::flush;
+    const pid_t pid = fork();
+    if (pid < 0) {
+        std::cout << "unable to fork the memory usage report" << std::endl;
+        return;
+    }
+    if (pid > 0) {
+        waitpid(pid, 0, 0);
+        return;
+    }
+
+    DatabaseConnection::ParameterMap params;
+    params["type"] = "memfile";
+    params["universe"] = "4";
+    params["persist"] = "false";
+    Memfile_LeaseMgr lease_mgr(params);
+
+    const time_t now = time(NULL);
+    const size_t before = getResidentMemory();
+    for (uint32_t i = 0; i < num_leases; ++i) {
+        Lease4Ptr lease(new Lease4(IOAddress(FIRST_ADDRESS + i),
+                                   makeHWAddr(i), makeClientId(i),
+                                   3600, 900, 1800, now,
+                                   1 + (i % NUM_SUBNETS)));
+        lease_mgr.addLease(lease);
+    }
+    const size_t after = getResidentMemory();
+
+    std::cout << std::left << std::setw(32) << "memory per lease" << std::right
+              << std::setw(10) << num_leases << " leases ";
+    if ((before > 0) && (after > before)) {
+        std::cout << std::fixed << std::setprecision(1) << std::setw(10)
+                  << (static_cast<double>(after - before) / num_leases)
+                  << " bytes/lease " << std::setw(10)
+                  << ((after - before) >> 20) << " MiB";
+    } else {
+        std::cout << "not available";
+    }
+    std::cout << std::endl;
+    _exit(0);
+}
+
+/// @brief Synthetic lease table shared by the lease manager benchmarks.
+///
+/// The table holds the leases to be inserted into the lease manager and
+/// the order in which they are looked up. The lookup order is shuffled
+/// with the fixed seed so as the lookups don't benefit from the locality
+/// of the insertions.
+class LeaseTable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param size number of leases
+    explicit LeaseTable(const size_t size)
+        : leases_(), hwaddrs_(), client_ids_(), order_(), lease_mgr_() {
+        leases_.reserve(size);
+        hwaddrs_.reserve(size);
+        client_ids_.reserve(size);
+        order_.reserve(size);
+        const time_t now = time(NULL);
+        for (uint32_t i = 0; i < size; ++i) {
+            HWAddrPtr hwaddr = makeHWAddr(i);
+            ClientIdPtr client_id = makeClientId(i);
+            Lease4Ptr lease(new Lease4(IOAddress(FIRST_ADDRESS + i), hwaddr,
+                                       client_id, 3600, 900, 1800, now,
+                                       1 + (i % NUM_SUBNETS)));
+            leases_.push_back(lease);
+            hwaddrs_.push_back(hwaddr);
+            client_ids_.push_back(client_id);
+            order_.push_back(i);
+        }
+        BenchRandom random(BENCH_SEED);
+        for (size_t i = order_.size(); i > 1; --i) {
+            std::swap(order_[i - 1], order_[random() % i]);
+        }
+    }
+
+    /// @brief Replaces the lease manager with an empty one.
+    void resetLeaseMgr() {
+        DatabaseConnection::ParameterMap params;
+        params["type"] = "memfile";
+        params["universe"] = "4";
+        params["persist"] = "false";
+        lease_mgr_.reset(new Memfile_LeaseMgr(params));
+    }
+
+    /// @brief Makes sure the lease manager holds all leases.
+    void populate() {
+        if (!lease_mgr_) {
+            resetLeaseMgr();
+        }
+        for (size_t i = 0; i < leases_.size(); ++i) {
+            if (!lease_mgr_->getLease4(leases_[i]->addr_)) {
+                lease_mgr_->addLease(leases_[i]);
+            }
+        }
+    }
+
+    /// @brief Leases of the table.
+    std::vector<Lease4Ptr> leases_;
+
+    /// @brief HW addresses of the clients owning the leases.
+    std::vector<HWAddrPtr> hwaddrs_;
+
+    /// @brief Client identifiers of the clients owning the leases.
+    std::vector<ClientIdPtr> client_ids_;
+
+    /// @brief Lookup order.
+    std::vector<uint32_t> order_;
+
+    /// @brief Lease manager under test.
+    boost::shared_ptr<Memfile_LeaseMgr> lease_mgr_;
+};
+
+/// @brief Measures insertion of leases into an empty lease table.
+class AddLeaseBench {
+public:
+    AddLeaseBench(LeaseTable& table) : table_(table) {
+    }
+    void prepare() {
+        table_.resetLeaseMgr();
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.leases_.size(); ++i) {
+            table_.lease_mgr_->addLease(table_.leases_[i]);
+        }
+        return (table_.leases_.size());
+    }
+private:
+    LeaseTable& table_;
+};
+
+/// @brief Measures lookups of leases by address.
+class GetLeaseByAddressBench {
+public:
+    GetLeaseByAddressBench(LeaseTable& table) : table_(table) {
+    }
+    void prepare() {
+        table_.populate();
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.order_.size(); ++i) {
+            const Lease4Ptr& lease = table_.leases_[table_.order_[i]];
+            table_.lease_mgr_->getLease4(lease->addr_);
+        }
+        return (table_.order_.size());
+    }
+private:
+    LeaseTable& table_;
+};
+
+/// @brief Measures lookups of leases by HW address and subnet identifier.
+class GetLeaseByHWAddrBench {
+public:
+    GetLeaseByHWAddrBench(LeaseTable& table) : table_(table) {
+    }
+    void prepare() {
+        table_.populate();
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.order_.size(); ++i) {
+            const uint32_t index = table_.order_[i];
+            table_.lease_mgr_->getLease4(*table_.hwaddrs_[index],
+                                         table_.leases_[index]->subnet_id_);
+        }
+        return (table_.order_.size());
+    }
+private:
+    LeaseTable& table_;
+};
+
+/// @brief Measures lookups of leases by client identifier and subnet
+/// identifier.
+class GetLeaseByClientIdBench {
+public:
+    GetLeaseByClientIdBench(LeaseTable& table) : table_(table) {
+    }
+    void prepare() {
+        table_.populate();
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.order_.size(); ++i) {
+            const uint32_t index = table_.order_[i];
+            table_.lease_mgr_->getLease4(*table_.client_ids_[index],
+                                         table_.leases_[index]->subnet_id_);
+        }
+        return (table_.order_.size());
+    }
+private:
+    LeaseTable& table_;
+};
+
+/// @brief Measures updates of existing leases.
+class UpdateLeaseBench {
+public:
+    UpdateLeaseBench(LeaseTable& table) : table_(table) {
+    }
+    void prepare() {
+        table_.populate();
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.order_.size(); ++i) {
+            const Lease4Ptr& lease = table_.leases_[table_.order_[i]];
+            ++lease->cltt_;
+            table_.lease_mgr_->updateLease4(lease);
+        }
+        return (table_.order_.size());
+    }
+private:
+    LeaseTable& table_;
+};
+
+/// @brief Measures deletion of leases.
+class DeleteLeaseBench {
+public:
+    DeleteLeaseBench(LeaseTable& table) : table_(table) {
+    }
+    void prepare() {
+        table_.populate();
+    }
+    size_t run() {
+        for (size_t i = 0; i < table_.order_.size(); ++i) {
+            const Lease4Ptr& lease = table_.leases_[table_.order_[i]];
+            table_.lease_mgr_->deleteLease(lease->addr_);
+        }
+        return (table_.order_.size());
+    }
+private:
+    LeaseTable& table_;
+};
+
+/// @brief Measures allocation of new leases by the allocation engine.
+///
+/// Each run allocates leases for distinct clients from a large pool,
+/// starting with an empty lease database. The leases are stored in the
+/// lease manager instantiated by the @c LeaseMgrFactory, like in the
+/// server.
+class AllocateLease4Bench {
+public:
+    AllocateLease4Bench(const size_t clients)
+        : engine_(AllocEngine::ALLOC_ITERATIVE, 100, false),
+          hwaddrs_(), client_ids_(), subnet_() {
+        for (uint32_t i = 0; i < clients; ++i) {
+            hwaddrs_.push_back(makeHWAddr(i));
+            client_ids_.push_back(makeClientId(i));
+        }
+    }
+    void prepare() {
+        LeaseMgrFactory::create("type=memfile universe=4 persist=false");
+        HostMgr::create();
+        CfgMgr& cfg_mgr = CfgMgr::instance();
+        cfg_mgr.clear();
+        subnet_.reset(new Subnet4(IOAddress("10.0.0.0"), 8, 900, 1800, 3600, 1));
+        subnet_->addPool(Pool4Ptr(new Pool4(IOAddress("10.0.0.1"),
+                                            IOAddress("10.255.255.254"))));
+        cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet_);
+        cfg_mgr.commit();
+    }
+    size_t run() {
+        for (size_t i = 0; i < hwaddrs_.size(); ++i) {
+            AllocEngine::ClientContext4 ctx(subnet_, client_ids_[i], hwaddrs_[i],
+                                            IOAddress::IPV4_ZERO_ADDRESS(),
+                                            false, false, "", false);
+            ctx.query_.reset(new Pkt4(DHCPREQUEST, i));
+            engine_.allocateLease4(ctx);
+        }
+        return (hwaddrs_.size());
+    }
+private:
+    AllocEngine engine_;
+    std::vector<HWAddrPtr> hwaddrs_;
+    std::vector<ClientIdPtr> client_ids_;
+    Subnet4Ptr subnet_;
+};
+
+/// @brief Prepares and runs a benchmark.
+///
+/// @param name benchmark name
+/// @param target benchmark object
+/// @param params benchmark parameters
+template<typename T>
+void
+runLeaseBench(const std::string& name, T& target, const BenchParams& params) {
+    for (unsigned int i = 0; i < params.iterations_; ++i) {
+        target.prepare();
+        runBenchMark(name, target, 1);
+    }
+}
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("lease-mgr-bench", isc::log::WARN);
+
+    const size_t num_leases = params.scale(NUM_LEASES);
+    reportLeaseMemory(num_leases);
+    reportLeaseMemory(params.scale(NUM_LEASES_LARGE));
+
+    std::cout << std::endl << "Memfile_LeaseMgr with " << num_leases
+              << " leases" << std::endl;
+    LeaseTable table(num_leases);
+
+    AddLeaseBench add_bench(table);
+    runLeaseBench("addLease", add_bench, params);
+
+    GetLeaseByAddressBench get_addr_bench(table);
+    runLeaseBench("getLease4(address)", get_addr_bench, params);
+
+    GetLeaseByHWAddrBench get_hwaddr_bench(table);
+    runLeaseBench("getLease4(hwaddr, subnet)", get_hwaddr_bench, params);
+
+    GetLeaseByClientIdBench get_clientid_bench(table);
+    runLeaseBench("getLease4(client-id, subnet)", get_clientid_bench, params);
+
+    UpdateLeaseBench update_bench(table);
+    runLeaseBench("updateLease4", update_bench, params);
+
+    DeleteLeaseBench delete_bench(table);
+    runLeaseBench("deleteLease", delete_bench, params);
+
+    const size_t num_allocations = params.scale(NUM_ALLOCATIONS);
+    std::cout << std::endl << "AllocEngine with " << num_allocations
+              << " clients" << std::endl;
+    AllocateLease4Bench alloc_bench(num_allocations);
+    runLeaseBench("allocateLease4", alloc_bench, params);
+
+    LeaseMgrFactory::destroy();
+    return (0);
+}
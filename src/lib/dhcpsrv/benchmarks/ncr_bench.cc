@@ -0,0 +1,153 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp_ddns/ncr_msg.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <log/logger_support.h>
+#include <util/buffer.h>
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace isc::dhcp_ddns;
+
+namespace {
+
+/// @brief Number of requests processed by a single run.
+const size_t NUM_REQUESTS = 100000;
+
+/// @brief Number of distinct requests the workload is made of.
+const size_t NUM_DISTINCT = 1000;
+
+/// @brief Creates the requests of the workload.
+///
+/// Half of the requests are for IPv4 leases, half for IPv6 leases, with
+/// DHCIDs computed from random DUIDs as kea-dhcp4/6 do.
+std::vector<NameChangeRequestPtr>
+makeRequests() {
+    BenchRandom random(BENCH_SEED);
+    boost::random::uniform_int_distribution<uint32_t> dist;
+    std::vector<NameChangeRequestPtr> ncrs;
+    for (size_t i = 0; i < NUM_DISTINCT; ++i) {
+        std::ostringstream fqdn;
+        fqdn << "host-" << i << ".subnet-" << (i % 64) << ".example.com.";
+        std::vector<uint8_t> duid_bytes(14);
+        for (size_t j = 0; j < duid_bytes.size(); ++j) {
+            duid_bytes[j] = static_cast<uint8_t>(dist(random));
+        }
+        DUID duid(duid_bytes);
+        std::vector<uint8_t> wire_fqdn;
+        wire_fqdn.push_back(0);
+        D2Dhcid dhcid(duid, wire_fqdn);
+        const uint32_t addr = dist(random);
+        std::ostringstream address;
+        if (i % 2 == 0) {
+            address << asiolink::IOAddress(addr).toText();
+        } else {
+            address << "2001:db8:1::" << std::hex << (addr >> 16) << ":"
+                    << (addr & 0xffff);
+        }
+        const NameChangeType change_type = (i % 3 == 0 ? CHG_REMOVE : CHG_ADD);
+        NameChangeRequestPtr ncr(new NameChangeRequest(change_type, true, true,
+                                                       fqdn.str(),
+                                                       address.str(), dhcid,
+                                                       1500000000 + i, 3600));
+        ncrs.push_back(ncr);
+    }
+    return (ncrs);
+}
+
+/// @brief Measures marshalling of requests into the wire format.
+class ToFormatBench {
+public:
+    ToFormatBench(const NameChangeFormat format, const size_t requests)
+        : format_(format), ncrs_(makeRequests()), requests_(requests) {
+    }
+    size_t run() {
+        util::OutputBuffer buffer(1024);
+        for (size_t i = 0; i < requests_; ++i) {
+            buffer.clear();
+            ncrs_[i % ncrs_.size()]->toFormat(format_, buffer);
+        }
+        return (requests_);
+    }
+private:
+    NameChangeFormat format_;
+    std::vector<NameChangeRequestPtr> ncrs_;
+    size_t requests_;
+};
+
+/// @brief Measures creation of requests from the wire format.
+class FromFormatBench {
+public:
+    FromFormatBench(const NameChangeFormat format, const size_t requests)
+        : format_(format), wires_(), wire_size_(0), requests_(requests) {
+        const std::vector<NameChangeRequestPtr> ncrs = makeRequests();
+        for (size_t i = 0; i < ncrs.size(); ++i) {
+            util::OutputBuffer buffer(1024);
+            ncrs[i]->toFormat(format_, buffer);
+            const uint8_t* data =
+                static_cast<const uint8_t*>(buffer.getData());
+            wires_.push_back(std::vector<uint8_t>(data,
+                                                  data + buffer.getLength()));
+            wire_size_ += buffer.getLength();
+        }
+    }
+    size_t run() {
+        for (size_t i = 0; i < requests_; ++i) {
+            const std::vector<uint8_t>& wire = wires_[i % wires_.size()];
+            util::InputBuffer buffer(&wire[0], wire.size());
+            NameChangeRequest::fromFormat(format_, buffer);
+        }
+        return (requests_);
+    }
+    /// @brief Returns the average size of a request on the wire.
+    size_t getAverageSize() const {
+        return (wire_size_ / wires_.size());
+    }
+private:
+    NameChangeFormat format_;
+    std::vector<std::vector<uint8_t> > wires_;
+    size_t wire_size_;
+    size_t requests_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("ncr-bench", isc::log::WARN);
+
+    const size_t num_requests = params.scale(NUM_REQUESTS);
+    const NameChangeFormat formats[] = { FMT_JSON, FMT_BINARY };
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); ++i) {
+        const std::string name = ncrFormatToString(formats[i]);
+        FromFormatBench from_bench(formats[i], num_requests);
+        std::cout << "NameChangeRequest " << name << " with "
+                  << num_requests << " requests, "
+                  << from_bench.getAverageSize() << " bytes on average"
+                  << std::endl;
+        ToFormatBench to_bench(formats[i], num_requests);
+        runBenchMark("toFormat(" + name + ")", to_bench, params.iterations_);
+        runBenchMark("fromFormat(" + name + ")", from_bench,
+                     params.iterations_);
+        std::cout << std::endl;
+    }
+
+    return (0);
+}
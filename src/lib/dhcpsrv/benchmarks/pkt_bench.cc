@@ -0,0 +1,159 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/libdhcp++.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/benchmarks/benchmark.h>
+#include <eval/eval_context.h>
+#include <eval/evaluate.h>
+#include <log/logger_support.h>
+#include <util/encode/hex.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief Number of packets processed by a single run.
+const size_t NUM_PACKETS = 100000;
+
+/// @brief Relayed DHCPDISCOVER sent by a cable modem.
+///
+/// This is packet 1 from the dhcp-val/pcap/docsis-*-CG3000DCR-Registration-
+/// Filtered.cap capture, also used by the libdhcp++ unit tests. It carries
+/// options 53, 55, 60, 125, 43, 61, 57 and 82 with sub-options.
+const char* RELAYED_DISCOVER =
+    "010106015d05478d000000000000000000000000000000000afee20120e52ab8151400"
+    "0000000000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000000000000000000000"
+    "0000000000000000000000000000000000000000000000000000638253633501013707"
+    "0102030407067d3c0a646f63736973332e303a7d7f0000118b7a010102057501010102"
+    "010303010104010105010106010107010f0801100901030a01010b01180c01010d0200"
+    "400e0200100f010110040000000211010014010015013f160101170101180104190104"
+    "1a01041b01201c01021d01081e01201f01102001102101022201012301002401002501"
+    "01260200ff2701012b59020345434d030b45434d3a45524f55544552040d3242523232"
+    "39553430303434430504312e3034060856312e33332e30330707322e332e3052320806"
+    "30303039354209094347333030304443520a074e657467656172fe01083d0fff2ab815"
+    "140003000120e52ab81514390205dc5219010420000002020620e52ab8151409090000"
+    "118b0401020300ff";
+
+/// @brief Client classification expressions evaluated by the benchmark.
+///
+/// They are typical of the expressions used to classify cable modems
+/// and relayed clients.
+const char* EXPRESSIONS[] = {
+    "option[60].text == 'docsis3.0'",
+    "substring(option[60].hex,0,6) == 'docsis'",
+    "relay4[2].hex == 0x20e52ab81514",
+    "pkt4.giaddr == 10.254.226.1 and pkt4.msgtype == 1",
+    "option[61].exists and not option[12].exists",
+    NULL
+};
+
+/// @brief Returns the wire format of the captured packet.
+std::vector<uint8_t>
+getCapture() {
+    std::vector<uint8_t> bin;
+    isc::util::encode::decodeHex(RELAYED_DISCOVER, bin);
+    return (bin);
+}
+
+/// @brief Measures parsing of received packets.
+class Pkt4UnpackBench {
+public:
+    Pkt4UnpackBench(const size_t packets)
+        : wire_(getCapture()), packets_(packets) {
+    }
+    size_t run() {
+        for (size_t i = 0; i < packets_; ++i) {
+            Pkt4 pkt(&wire_[0], wire_.size());
+            pkt.unpack();
+        }
+        return (packets_);
+    }
+private:
+    std::vector<uint8_t> wire_;
+    size_t packets_;
+};
+
+/// @brief Measures rendering of packets into the wire format.
+class Pkt4PackBench {
+public:
+    Pkt4PackBench(const size_t packets)
+        : pkt_(), packets_(packets) {
+        const std::vector<uint8_t> wire = getCapture();
+        pkt_.reset(new Pkt4(&wire[0], wire.size()));
+        pkt_->unpack();
+    }
+    size_t run() {
+        for (size_t i = 0; i < packets_; ++i) {
+            pkt_->pack();
+        }
+        return (packets_);
+    }
+private:
+    Pkt4Ptr pkt_;
+    size_t packets_;
+};
+
+/// @brief Measures evaluation of a classification expression.
+class EvaluateBench {
+public:
+    EvaluateBench(const std::string& expression, const size_t packets)
+        : expression_(), pkt_(), packets_(packets) {
+        EvalContext eval_ctx(Option::V4);
+        eval_ctx.parseString(expression);
+        expression_.reset(new Expression(eval_ctx.expression));
+        const std::vector<uint8_t> wire = getCapture();
+        pkt_.reset(new Pkt4(&wire[0], wire.size()));
+        pkt_->unpack();
+    }
+    size_t run() {
+        for (size_t i = 0; i < packets_; ++i) {
+            evaluate(*expression_, *pkt_);
+        }
+        return (packets_);
+    }
+private:
+    ExpressionPtr expression_;
+    Pkt4Ptr pkt_;
+    size_t packets_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    const BenchParams params = parseBenchArgs(argc, argv);
+    isc::log::initLogger("pkt-bench", isc::log::WARN);
+
+    const size_t num_packets = params.scale(NUM_PACKETS);
+    std::cout << "Pkt4 with " << num_packets << " packets" << std::endl;
+    Pkt4UnpackBench unpack_bench(num_packets);
+    runBenchMark("Pkt4::unpack", unpack_bench, params.iterations_);
+    Pkt4PackBench pack_bench(num_packets);
+    runBenchMark("Pkt4::pack", pack_bench, params.iterations_);
+
+    std::cout << std::endl << "evaluate() with " << num_packets
+              << " packets" << std::endl;
+    for (int i = 0; EXPRESSIONS[i] != NULL; ++i) {
+        EvaluateBench eval_bench(EXPRESSIONS[i], num_packets);
+        runBenchMark(EXPRESSIONS[i], eval_bench, params.iterations_);
+    }
+
+    return (0);
+}
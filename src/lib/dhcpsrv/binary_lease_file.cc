@@ -0,0 +1,633 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/binary_lease_file.h>
+#include <exceptions/exceptions.h>
+#include <util/csv_file.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <cstring>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Magic at the beginning of the binary lease files.
+const char FILE_MAGIC[] = "KEALEASE";
+
+/// @brief Length of the magic.
+const size_t FILE_MAGIC_LEN = 8;
+
+/// @brief Forward DNS update has been performed for the lease.
+const uint8_t FLAG_FQDN_FWD = 0x01;
+
+/// @brief Reverse DNS update has been performed for the lease.
+const uint8_t FLAG_FQDN_REV = 0x02;
+
+/// @brief Lease holds a hardware address (DHCPv6 only).
+const uint8_t FLAG_HWADDR = 0x04;
+
+/// @brief Lookup table of the CRC-32 (IEEE 802.3).
+struct Crc32Table {
+    /// @brief Constructor.
+    ///
+    /// Computes the table.
+    Crc32Table() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+            }
+            values_[i] = c;
+        }
+    }
+
+    /// @brief CRC-32 of each byte value.
+    uint32_t values_[256];
+};
+
+/// @brief Computes the CRC-32 (IEEE 802.3) of a buffer.
+///
+/// @param data buffer
+/// @param length length of the buffer
+uint32_t
+crc32(const uint8_t* data, const size_t length) {
+    static const Crc32Table table;
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < length; ++i) {
+        crc = table.values_[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return (crc ^ 0xffffffff);
+}
+
+/// @brief Writes a 32 bits integer in network byte order.
+///
+/// @param value integer
+/// @param [out] data buffer of at least 4 bytes
+void
+writeUint32At(const uint32_t value, uint8_t* data) {
+    data[0] = static_cast<uint8_t>(value >> 24);
+    data[1] = static_cast<uint8_t>(value >> 16);
+    data[2] = static_cast<uint8_t>(value >> 8);
+    data[3] = static_cast<uint8_t>(value);
+}
+
+/// @brief Reads a 32 bits integer in network byte order.
+///
+/// @param data buffer of at least 4 bytes
+uint32_t
+readUint32At(const uint8_t* data) {
+    return ((static_cast<uint32_t>(data[0]) << 24) |
+            (static_cast<uint32_t>(data[1]) << 16) |
+            (static_cast<uint32_t>(data[2]) << 8) |
+            static_cast<uint32_t>(data[3]));
+}
+
+/// @brief Writes a value preceded by its length on one byte.
+///
+/// @param value value
+/// @param [out] out buffer
+void
+writeShortField(const std::vector<uint8_t>& value, OutputBuffer& out) {
+    if (value.size() > 0xff) {
+        isc_throw(isc::BadValue, "lease field too large to be written: "
+                  << value.size() << " bytes");
+    }
+    out.writeUint8(static_cast<uint8_t>(value.size()));
+    if (!value.empty()) {
+        out.writeData(&value[0], value.size());
+    }
+}
+
+/// @brief Writes the fields common to the IPv4 and IPv6 leases.
+///
+/// @param lease lease
+/// @param flags flags specific to the lease type
+/// @param [out] out buffer
+void
+writeCommon(const isc::dhcp::Lease& lease, uint8_t flags, OutputBuffer& out) {
+    out.writeUint32(lease.valid_lft_);
+    const uint64_t cltt = static_cast<uint64_t>(static_cast<int64_t>(lease.cltt_));
+    out.writeUint32(static_cast<uint32_t>(cltt >> 32));
+    out.writeUint32(static_cast<uint32_t>(cltt));
+    out.writeUint32(lease.subnet_id_);
+    out.writeUint32(lease.state_);
+    if (lease.fqdn_fwd_) {
+        flags |= FLAG_FQDN_FWD;
+    }
+    if (lease.fqdn_rev_) {
+        flags |= FLAG_FQDN_REV;
+    }
+    out.writeUint8(flags);
+}
+
+/// @brief Writes a hardware address.
+///
+/// @param hwaddr hardware address
+/// @param [out] out buffer
+void
+writeHWAddr(const isc::dhcp::HWAddr& hwaddr, OutputBuffer& out) {
+    out.writeUint16(hwaddr.htype_);
+    writeShortField(hwaddr.hwaddr_, out);
+}
+
+/// @brief Writes a hostname.
+///
+/// @param hostname hostname
+/// @param [out] out buffer
+void
+writeHostname(const std::string& hostname, OutputBuffer& out) {
+    if (hostname.size() > 0xffff) {
+        isc_throw(isc::BadValue, "hostname too large to be written: "
+                  << hostname.size() << " bytes");
+    }
+    out.writeUint16(static_cast<uint16_t>(hostname.size()));
+    out.writeData(hostname.data(), hostname.size());
+}
+
+/// @brief Reads the fields common to the IPv4 and IPv6 leases.
+///
+/// @param in buffer
+/// @param [out] lease lease
+/// @return flags of the lease.
+uint8_t
+readCommon(InputBuffer& in, isc::dhcp::Lease& lease) {
+    lease.valid_lft_ = in.readUint32();
+    uint64_t cltt = static_cast<uint64_t>(in.readUint32()) << 32;
+    cltt |= in.readUint32();
+    lease.cltt_ = static_cast<time_t>(static_cast<int64_t>(cltt));
+    lease.subnet_id_ = in.readUint32();
+    lease.state_ = in.readUint32();
+    const uint8_t flags = in.readUint8();
+    lease.fqdn_fwd_ = ((flags & FLAG_FQDN_FWD) != 0);
+    lease.fqdn_rev_ = ((flags & FLAG_FQDN_REV) != 0);
+    return (flags);
+}
+
+/// @brief Reads a hardware address.
+///
+/// @param in buffer
+/// @return the hardware address.
+isc::dhcp::HWAddrPtr
+readHWAddr(InputBuffer& in) {
+    const uint16_t htype = in.readUint16();
+    std::vector<uint8_t> hwaddr;
+    in.readVector(hwaddr, in.readUint8());
+    return (isc::dhcp::HWAddrPtr(new isc::dhcp::HWAddr(hwaddr, htype)));
+}
+
+/// @brief Reads a hostname.
+///
+/// @param in buffer
+/// @return the hostname.
+std::string
+readHostname(InputBuffer& in) {
+    std::vector<uint8_t> hostname;
+    in.readVector(hostname, in.readUint16());
+    return (std::string(hostname.begin(), hostname.end()));
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace dhcp {
+
+const uint16_t BinaryLeaseFile::FILE_VERSION;
+const size_t BinaryLeaseFile::HEADER_SIZE;
+const size_t BinaryLeaseFile::RECORD_HEADER_SIZE;
+const size_t BinaryLeaseFile::MAX_RECORD_SIZE;
+
+BinaryLeaseFile::BinaryLeaseFile(const std::string& filename,
+                                 const uint8_t universe)
+    : filename_(filename), universe_(universe), fs_(), read_msg_(),
+      valid_end_(0), torn_end_(0), truncated_(false) {
+}
+
+BinaryLeaseFile::~BinaryLeaseFile() {
+    try {
+        close();
+    } catch (...) {
+        // Don't throw from the destructor.
+    }
+}
+
+bool
+BinaryLeaseFile::isBinaryFile(const std::string& filename) {
+    std::ifstream fs(filename.c_str(), std::ios::binary);
+    char magic[FILE_MAGIC_LEN];
+    fs.read(magic, sizeof(magic));
+    return (fs.good() && (memcmp(magic, FILE_MAGIC, FILE_MAGIC_LEN) == 0));
+}
+
+void
+BinaryLeaseFile::open(const bool seek_to_end) {
+    close();
+    clearStatistics();
+    read_msg_.clear();
+    torn_end_ = 0;
+    truncated_ = false;
+
+    // If file doesn't exist or is empty, we have to create our own file.
+    struct stat st;
+    if ((stat(filename_.c_str(), &st) != 0) || (st.st_size == 0)) {
+        recreate();
+        return;
+    }
+
+    fs_.reset(new std::fstream(filename_.c_str(), std::ios::in |
+                               std::ios::out | std::ios::binary));
+    if (!fs_->is_open()) {
+        close();
+        isc_throw(CSVFileError, "unable to open '" << filename_ << "'");
+    }
+
+    uint8_t header[HEADER_SIZE];
+    fs_->read(reinterpret_cast<char*>(header), sizeof(header));
+    std::string error;
+    if (!fs_->good()) {
+        error = "file too short";
+
+    } else if (memcmp(header, FILE_MAGIC, FILE_MAGIC_LEN) != 0) {
+        error = "not a binary lease file";
+
+    } else if (readUint32At(header + 12) != crc32(header, 12)) {
+        error = "bad header checksum";
+
+    } else if (((header[8] << 8) | header[9]) != FILE_VERSION) {
+        error = "unsupported version " +
+            boost::lexical_cast<std::string>((header[8] << 8) | header[9]);
+
+    } else if (header[10] != universe_) {
+        error = "file holds DHCPv" +
+            boost::lexical_cast<std::string>(static_cast<int>(header[10])) +
+            " leases";
+    }
+    if (!error.empty()) {
+        close();
+        isc_throw(CSVFileError, "invalid header of the binary lease file '"
+                  << filename_ << "': " << error);
+    }
+
+    valid_end_ = HEADER_SIZE;
+    if (seek_to_end) {
+        fs_->seekg(0, std::ios_base::end);
+        fs_->seekp(0, std::ios_base::end);
+        valid_end_ = fs_->tellg();
+        if (!fs_->good()) {
+            close();
+            isc_throw(CSVFileError, "unable to move to the end of the binary"
+                      " lease file '" << filename_ << "'");
+        }
+    }
+}
+
+void
+BinaryLeaseFile::close() {
+    // It is allowed to close multiple times.
+    if (fs_) {
+        fs_->close();
+        fs_.reset();
+    }
+}
+
+bool
+BinaryLeaseFile::exists() const {
+    std::ifstream fs(filename_.c_str());
+    return (fs.good());
+}
+
+std::string
+BinaryLeaseFile::getSchemaVersion() const {
+    return (boost::lexical_cast<std::string>(FILE_VERSION));
+}
+
+void
+BinaryLeaseFile::recreate() {
+    close();
+    fs_.reset(new std::fstream(filename_.c_str(), std::ios::in |
+                               std::ios::out | std::ios::trunc |
+                               std::ios::binary));
+    if (!fs_->is_open()) {
+        close();
+        isc_throw(CSVFileError, "unable to open '" << filename_ << "'");
+    }
+
+    uint8_t header[HEADER_SIZE];
+    memcpy(header, FILE_MAGIC, FILE_MAGIC_LEN);
+    header[8] = static_cast<uint8_t>(FILE_VERSION >> 8);
+    header[9] = static_cast<uint8_t>(FILE_VERSION);
+    header[10] = universe_;
+    header[11] = 0;
+    writeUint32At(crc32(header, 12), header + 12);
+    fs_->write(reinterpret_cast<const char*>(header), sizeof(header));
+    fs_->flush();
+    if (!fs_->good()) {
+        close();
+        isc_throw(CSVFileError, "unable to write the header of the binary"
+                  " lease file '" << filename_ << "'");
+    }
+    valid_end_ = HEADER_SIZE;
+}
+
+void
+BinaryLeaseFile::appendRecord(const OutputBuffer& data) {
+    if (!fs_) {
+        isc_throw(CSVFileError, "unable to write a lease to the closed file '"
+                  << filename_ << "'");
+    }
+
+    // Discard the incomplete record found when reading the file, so as it
+    // doesn't swallow the appended records. Anything written to the file
+    // since then may be valid: the file is left untouched.
+    if (truncated_) {
+        fs_->flush();
+        struct stat st;
+        if ((stat(filename_.c_str(), &st) != 0) ||
+            (static_cast<std::streamoff>(st.st_size) != torn_end_)) {
+            isc_throw(CSVFileError, "the file '" << filename_ << "' has"
+                      " changed since an incomplete record was found at its"
+                      " end, not discarding it");
+        }
+        if (truncate(filename_.c_str(), valid_end_) != 0) {
+            isc_throw(CSVFileError, "unable to discard the incomplete record"
+                      " at the end of the file '" << filename_ << "'");
+        }
+        truncated_ = false;
+    }
+
+    uint8_t header[RECORD_HEADER_SIZE];
+    writeUint32At(data.getLength(), header);
+    writeUint32At(crc32(static_cast<const uint8_t*>(data.getData()),
+                        data.getLength()), header + 4);
+    writeUint32At(crc32(header, 8), header + 8);
+
+    fs_->seekp(0, std::ios_base::end);
+    fs_->seekg(0, std::ios_base::end);
+    fs_->clear();
+    fs_->write(reinterpret_cast<const char*>(header), sizeof(header));
+    fs_->write(static_cast<const char*>(data.getData()), data.getLength());
+    fs_->flush();
+    if (!fs_->good()) {
+        fs_->clear();
+        isc_throw(CSVFileError, "failed to write a lease to the file '"
+                  << filename_ << "'");
+    }
+}
+
+bool
+BinaryLeaseFile::nextRecord(std::vector<uint8_t>& data) {
+    data.clear();
+    if (!fs_) {
+        setReadMsg("the file is not open");
+        return (false);
+    }
+
+    // Nothing can be read after an incomplete record.
+    if (truncated_) {
+        return (true);
+    }
+
+    uint8_t header[RECORD_HEADER_SIZE];
+    fs_->read(reinterpret_cast<char*>(header), sizeof(header));
+    const std::streamsize header_read = fs_->gcount();
+    if ((header_read == 0) && fs_->eof()) {
+        fs_->clear();
+        return (true);
+    }
+
+    // A short read means that the end of the file has been reached.
+    if (header_read < static_cast<std::streamsize>(sizeof(header))) {
+        fs_->clear();
+        torn_end_ = valid_end_ + header_read;
+        truncated_ = true;
+        setReadMsg("incomplete record at the end of the file, discarding it");
+        return (false);
+    }
+
+    // The length is checked before it is used, so that a corrupted length
+    // is not mistaken for a record cut by the end of the file.
+    const uint32_t length = readUint32At(header);
+    if ((readUint32At(header + 8) != crc32(header, 8)) || (length == 0) ||
+        (length > MAX_RECORD_SIZE)) {
+        fs_->clear();
+        isc_throw(CSVFileError, "invalid record header at offset "
+                  << valid_end_ << " of the file '" << filename_
+                  << "', the following records can't be read");
+    }
+
+    data.resize(length);
+    fs_->read(reinterpret_cast<char*>(&data[0]), length);
+    const std::streamsize data_read = fs_->gcount();
+    if (data_read < static_cast<std::streamsize>(length)) {
+        fs_->clear();
+        data.clear();
+        torn_end_ = valid_end_ + RECORD_HEADER_SIZE + data_read;
+        truncated_ = true;
+        setReadMsg("incomplete record at the end of the file, discarding it");
+        return (false);
+    }
+    valid_end_ += RECORD_HEADER_SIZE + length;
+
+    if (crc32(&data[0], length) != readUint32At(header + 4)) {
+        data.clear();
+        setReadMsg("bad record checksum");
+        return (false);
+    }
+    return (true);
+}
+
+BinaryLeaseFile4::BinaryLeaseFile4(const std::string& filename)
+    : BinaryLeaseFile(filename, 4) {
+}
+
+void
+BinaryLeaseFile4::append(const Lease4& lease) {
+    // Bump the number of write attempts
+    ++writes_;
+
+    try {
+        if (!lease.hwaddr_) {
+            isc_throw(BadValue, "Lease4 must have hardware address specified.");
+        }
+        OutputBuffer out(64);
+        out.writeUint32(lease.addr_.toUint32());
+        writeCommon(lease, 0, out);
+        writeHWAddr(*lease.hwaddr_, out);
+        writeShortField(lease.client_id_ ? lease.client_id_->getClientId() :
+                        std::vector<uint8_t>(), out);
+        writeHostname(lease.hostname_, out);
+        appendRecord(out);
+
+    } catch (const std::exception&) {
+        // Catch any errors so we can bump the error counter than rethrow it
+        ++write_errs_;
+        throw;
+    }
+
+    // Bump the number of leases written
+    ++write_leases_;
+}
+
+bool
+BinaryLeaseFile4::next(Lease4Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        std::vector<uint8_t> data;
+        if (!nextRecord(data)) {
+            isc_throw(BadValue, getReadMsg());
+        }
+        // The empty record signals EOF.
+        if (data.empty()) {
+            lease.reset();
+            return (true);
+        }
+
+        InputBuffer in(&data[0], data.size());
+        lease.reset(new Lease4());
+        lease->addr_ = IOAddress(in.readUint32());
+        readCommon(in, *lease);
+        lease->hwaddr_ = readHWAddr(in);
+        std::vector<uint8_t> client_id;
+        in.readVector(client_id, in.readUint8());
+        if (!client_id.empty()) {
+            lease->client_id_.reset(new ClientId(client_id));
+        }
+        lease->hostname_ = readHostname(in);
+
+    } catch (const CSVFileError& ex) {
+        // The following records can't be read.
+        ++read_errs_;
+        lease.reset();
+        setReadMsg(ex.what());
+        throw;
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+BinaryLeaseFile6::BinaryLeaseFile6(const std::string& filename)
+    : BinaryLeaseFile(filename, 6) {
+}
+
+void
+BinaryLeaseFile6::append(const Lease6& lease) {
+    // Bump the number of write attempts
+    ++writes_;
+
+    try {
+        if (!lease.duid_) {
+            isc_throw(BadValue, "Lease6 must have DUID specified.");
+        }
+        OutputBuffer out(96);
+        out.writeData(&lease.addr_.toBytes()[0], 16);
+        writeCommon(lease, lease.hwaddr_ ? FLAG_HWADDR : 0, out);
+        out.writeUint32(lease.preferred_lft_);
+        out.writeUint8(static_cast<uint8_t>(lease.type_));
+        out.writeUint32(lease.iaid_);
+        out.writeUint8(lease.prefixlen_);
+        writeShortField(lease.duid_->getDuid(), out);
+        writeHostname(lease.hostname_, out);
+        if (lease.hwaddr_) {
+            writeHWAddr(*lease.hwaddr_, out);
+        }
+        appendRecord(out);
+
+    } catch (const std::exception&) {
+        // Catch any errors so we can bump the error counter than rethrow it
+        ++write_errs_;
+        throw;
+    }
+
+    // Bump the number of leases written
+    ++write_leases_;
+}
+
+bool
+BinaryLeaseFile6::next(Lease6Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        std::vector<uint8_t> data;
+        if (!nextRecord(data)) {
+            isc_throw(BadValue, getReadMsg());
+        }
+        // The empty record signals EOF.
+        if (data.empty()) {
+            lease.reset();
+            return (true);
+        }
+
+        InputBuffer in(&data[0], data.size());
+        lease.reset(new Lease6());
+        uint8_t addr[16];
+        in.readData(addr, sizeof(addr));
+        lease->addr_ = IOAddress::fromBytes(AF_INET6, addr);
+        const uint8_t flags = readCommon(in, *lease);
+        lease->preferred_lft_ = in.readUint32();
+        const uint8_t type = in.readUint8();
+        if (type > Lease::TYPE_PD) {
+            isc_throw(BadValue, "invalid lease type " << static_cast<int>(type));
+        }
+        lease->type_ = static_cast<Lease::Type>(type);
+        lease->iaid_ = in.readUint32();
+        lease->prefixlen_ = in.readUint8();
+        std::vector<uint8_t> duid;
+        in.readVector(duid, in.readUint8());
+        lease->duid_.reset(new DUID(duid));
+        lease->hostname_ = readHostname(in);
+        if (flags & FLAG_HWADDR) {
+            lease->hwaddr_ = readHWAddr(in);
+        }
+
+    } catch (const CSVFileError& ex) {
+        // The following records can't be read.
+        ++read_errs_;
+        lease.reset();
+        setReadMsg(ex.what());
+        throw;
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+} // namespace isc::dhcp
+} // namespace isc
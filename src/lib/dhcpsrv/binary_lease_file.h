@@ -0,0 +1,283 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BINARY_LEASE_FILE_H
+#define BINARY_LEASE_FILE_H
+
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_file_stats.h>
+#include <util/buffer.h>
+#include <util/versioned_csv_file.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Base class for the lease files in the binary format.
+///
+/// The binary lease files are an alternative to the CSV lease files
+/// (see @c CSVLeaseFile4 and @c CSVLeaseFile6) which avoids converting
+/// the lease values to and from text when leases are written and read.
+/// They are used by the Memfile backend and the kea-lfc in the same way
+/// as the CSV files: each lease update is appended to the file and the
+/// last record for an address wins when the file is read.
+///
+/// The file begins with a 16 bytes header:
+/// - the "KEALEASE" magic (8 bytes),
+/// - the version of the format (2 bytes),
+/// - the universe, 4 or 6 (1 byte),
+/// - a reserved byte,
+/// - the CRC-32 of the 12 preceding bytes (4 bytes).
+///
+/// It is followed by the records, each made of the length of the record
+/// data (4 bytes), the CRC-32 of the record data (4 bytes), the CRC-32 of
+/// these 8 bytes (4 bytes) and the data itself, which is defined by the
+/// derived classes. All integers are in network byte order.
+///
+/// A record with a bad data CRC is reported as a read error and skipped.
+/// A record cut by the end of the file, e.g. after the server crashed while
+/// writing it, is reported as a read error and discarded when the file is
+/// next written to. A record header with a bad CRC or an invalid length
+/// elsewhere makes the following records impossible to locate: reading
+/// the file fails.
+///
+/// The interface of this class mirrors the one of the CSV lease files, so
+/// as the binary files can be processed by the @c LeaseFileLoader.
+class BinaryLeaseFile : public LeaseFileStats, public boost::noncopyable {
+public:
+
+    /// @brief Version of the file format.
+    static const uint16_t FILE_VERSION = 1;
+
+    /// @brief Size of the file header.
+    static const size_t HEADER_SIZE = 16;
+
+    /// @brief Size of the header of a record.
+    static const size_t RECORD_HEADER_SIZE = 12;
+
+    /// @brief Maximum length of the data of a record.
+    static const size_t MAX_RECORD_SIZE = 4096;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param universe 4 or 6.
+    BinaryLeaseFile(const std::string& filename, const uint8_t universe);
+
+    /// @brief Destructor.
+    ///
+    /// Closes the file.
+    virtual ~BinaryLeaseFile();
+
+    /// @brief Checks if a file is a binary lease file.
+    ///
+    /// @param filename Name of the file.
+    /// @return true if the file exists and begins with the magic of the
+    /// binary lease files.
+    static bool isBinaryFile(const std::string& filename);
+
+    /// @brief Opens or creates the file.
+    ///
+    /// The file is created with its header if it doesn't exist or is empty.
+    /// Otherwise the header is checked and the read pointer is set on the
+    /// first record. The statistics are cleared.
+    ///
+    /// @param seek_to_end Move the read pointer to the end of the file.
+    ///
+    /// @throw isc::util::CSVFileError if the file can't be opened or its
+    /// header is invalid.
+    void open(const bool seek_to_end = false);
+
+    /// @brief Closes the file.
+    ///
+    /// It is allowed to close a closed file.
+    void close();
+
+    /// @brief Checks if the file exists.
+    bool exists() const;
+
+    /// @brief Returns the name of the file.
+    std::string getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Returns the description of the last read error.
+    std::string getReadMsg() const {
+        return (read_msg_);
+    }
+
+    /// @brief Checks if the file needs to be converted.
+    ///
+    /// There is a single version of the binary format, so this always
+    /// returns false.
+    bool needsConversion() const {
+        return (false);
+    }
+
+    /// @brief Returns the state of the file schema.
+    ///
+    /// Provided for compatibility with the CSV lease files.
+    util::VersionedCSVFile::InputSchemaState getInputSchemaState() const {
+        return (util::VersionedCSVFile::CURRENT);
+    }
+
+    /// @brief Returns the version of the file format as text.
+    std::string getSchemaVersion() const;
+
+protected:
+
+    /// @brief Appends a record.
+    ///
+    /// An incomplete record found at the end of the file when reading it
+    /// is discarded first, provided the file has not grown since.
+    ///
+    /// @param data Record data.
+    ///
+    /// @throw isc::util::CSVFileError if the file isn't open or the record
+    /// can't be written.
+    void appendRecord(const util::OutputBuffer& data);
+
+    /// @brief Reads the next record.
+    ///
+    /// @param [out] data Record data, empty at the end of the file.
+    ///
+    /// @return false if the record is invalid or incomplete. The reason is
+    /// returned by @c getReadMsg.
+    ///
+    /// @throw isc::util::CSVFileError if the header of a record which is
+    /// not cut by the end of the file is invalid.
+    bool nextRecord(std::vector<uint8_t>& data);
+
+    /// @brief Sets the description of the last read error.
+    ///
+    /// @param read_msg Description of the error.
+    void setReadMsg(const std::string& read_msg) {
+        read_msg_ = read_msg;
+    }
+
+private:
+
+    /// @brief Creates the file with its header.
+    void recreate();
+
+    /// @brief Name of the file.
+    std::string filename_;
+
+    /// @brief Universe of the leases.
+    uint8_t universe_;
+
+    /// @brief Stream of the open file.
+    boost::scoped_ptr<std::fstream> fs_;
+
+    /// @brief Description of the last read error.
+    std::string read_msg_;
+
+    /// @brief Offset of the end of the last complete record read.
+    std::streamoff valid_end_;
+
+    /// @brief Size of the file when the incomplete record was found.
+    std::streamoff torn_end_;
+
+    /// @brief The file ends with an incomplete record.
+    bool truncated_;
+};
+
+/// @brief Provides methods to access a binary file with DHCPv4 leases.
+///
+/// The record data is made of:
+/// - the address (4 bytes),
+/// - the valid lifetime (4 bytes),
+/// - the client last transmission time (8 bytes),
+/// - the subnet identifier (4 bytes),
+/// - the lease state (4 bytes),
+/// - the flags (1 byte): forward DNS update, reverse DNS update,
+/// - the hardware address type (2 bytes),
+/// - the hardware address length (1 byte) and value,
+/// - the client identifier length (1 byte) and value,
+/// - the hostname length (2 bytes) and value.
+class BinaryLeaseFile4 : public BinaryLeaseFile {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    BinaryLeaseFile4(const std::string& filename);
+
+    /// @brief Appends the lease record to the file.
+    ///
+    /// @param lease Structure representing a DHCPv4 lease.
+    ///
+    /// @throw isc::BadValue if the lease has no hardware address.
+    void append(const Lease4& lease);
+
+    /// @brief Reads next lease from the file.
+    ///
+    /// @param [out] lease Pointer to the lease read from the file or
+    /// NULL pointer if the end of the file has been reached.
+    ///
+    /// @return false if an error occurred, true otherwise.
+    ///
+    /// @throw isc::util::CSVFileError if the following records can't be
+    /// located.
+    bool next(Lease4Ptr& lease);
+};
+
+/// @brief Provides methods to access a binary file with DHCPv6 leases.
+///
+/// The record data is made of:
+/// - the address (16 bytes),
+/// - the valid lifetime (4 bytes),
+/// - the client last transmission time (8 bytes),
+/// - the subnet identifier (4 bytes),
+/// - the lease state (4 bytes),
+/// - the flags (1 byte): forward DNS update, reverse DNS update,
+///   hardware address present,
+/// - the preferred lifetime (4 bytes),
+/// - the lease type (1 byte),
+/// - the IAID (4 bytes),
+/// - the prefix length (1 byte),
+/// - the DUID length (1 byte) and value,
+/// - the hostname length (2 bytes) and value,
+/// - if present, the hardware address type (2 bytes), length (1 byte)
+///   and value.
+class BinaryLeaseFile6 : public BinaryLeaseFile {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    BinaryLeaseFile6(const std::string& filename);
+
+    /// @brief Appends the lease record to the file.
+    ///
+    /// @param lease Structure representing a DHCPv6 lease.
+    ///
+    /// @throw isc::BadValue if the lease has no DUID.
+    void append(const Lease6& lease);
+
+    /// @brief Reads next lease from the file.
+    ///
+    /// @param [out] lease Pointer to the lease read from the file or
+    /// NULL pointer if the end of the file has been reached.
+    ///
+    /// @return false if an error occurred, true otherwise.
+    ///
+    /// @throw isc::util::CSVFileError if the following records can't be
+    /// located.
+    bool next(Lease6Ptr& lease);
+};
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // BINARY_LEASE_FILE_H
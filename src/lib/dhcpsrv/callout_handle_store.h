@@ -22,10 +22,11 @@ namespace dhcp {
 /// The DHCP servers process a single request at a time. At points where the
 /// CalloutHandle is required, the pointer to the current request (packet) is
 /// passed to this function.  If the request is a new one, a pointer to
-/// the request is stored, a new CalloutHandle is allocated (and stored) and
-/// a pointer to the latter object returned to the caller.  If the request
-/// matches the one stored, the pointer to the stored CalloutHandle is
-/// returned.
+/// the request is stored, the stored CalloutHandle is recycled (or a new
+/// one allocated if it can't be, see
+/// isc::hooks::HooksManager::recycleCalloutHandle()) and a pointer to the
+/// latter object returned to the caller.  If the request matches the one
+/// stored, the pointer to the stored CalloutHandle is returned.
 ///
 /// A special case is a null pointer being passed.  This has the effect of
 /// clearing the stored pointers to the packet being processed and
@@ -60,11 +61,11 @@ isc::hooks::CalloutHandlePtr getCalloutHandle(const T& pktptr) {
         // do anything as we will automatically return the stored handle.)
         if (pktptr != stored_pointer) {
 
-            // Not seen before, so store the pointer passed to us and get a new
-            // CalloutHandle.  (The latter operation frees and probably deletes
-            // (depending on other pointers) the stored one.)
+            // Not seen before, so store the pointer passed to us and recycle
+            // the CalloutHandle.  (If the stored one is still referenced
+            // elsewhere, it is replaced by a new one.)
             stored_pointer = pktptr;
-            stored_handle = isc::hooks::HooksManager::createCalloutHandle();
+            isc::hooks::HooksManager::recycleCalloutHandle(stored_handle);
         }
         
     } else {
@@ -9,6 +9,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/daemon.h>
 #include <exceptions/exceptions.h>
+#include <log/logger_manager.h>
 #include <log/logger_name.h>
 #include <log/logger_support.h>
 #include <logging.h>
@@ -39,6 +40,11 @@ Daemon::Daemon()
 }
 
 Daemon::~Daemon() {
+    // Report the suppressed log messages and write the queued ones
+    // before the process exits.
+    isc::log::LoggerManager::flushSuppressedMessages();
+    isc::log::LoggerManager::stopAsync();
+
     if (pid_file_ && am_file_author_) {
         pid_file_->deleteFile();
     }
@@ -62,11 +68,15 @@ void Daemon::configureLogger(const isc::data::ConstElementPtr& log_config,
                              const SrvConfigPtr& storage) {
 
     if (log_config) {
+        LogConfigParser parser(storage);
         isc::data::ConstElementPtr loggers = log_config->get("loggers");
         if (loggers) {
-            LogConfigParser parser(storage);
             parser.parseConfiguration(loggers, CfgMgr::instance().isVerbose());
         }
+        isc::data::ConstElementPtr async = log_config->get("async");
+        if (async) {
+            parser.parseAsyncConfiguration(async);
+        }
     }
 }
 
@@ -205,5 +215,22 @@ Daemon::createPIDFile(int pid) {
     am_file_author_ = true;
 }
 
+void
+Daemon::takeOverPIDFile(const int previous_pid) {
+    if (!pid_file_) {
+        setPIDFileName(makePIDFileName());
+    }
+
+    // The previous process may still be alive.
+    int chk_pid = pid_file_->check();
+    if ((chk_pid > 0) && (chk_pid != previous_pid)) {
+        isc_throw(DaemonPIDExists, "Daemon::takeOverPIDFile: PID: " << chk_pid
+                  << " exists, PID file: " << getPIDFileName());
+    }
+
+    pid_file_->write();
+    am_file_author_ = true;
+}
+
 };
 };
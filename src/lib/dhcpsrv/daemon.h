@@ -91,7 +91,8 @@ public:
     /// configuration file. This structure has a "loggers" array that
     /// contains 0 or more entries, each configuring one logging source
     /// (name, severity, debuglevel), each with zero or more outputs (file,
-    /// maxsize, maximum number of files).
+    /// maxsize, maximum number of files). The optional "async" map
+    /// enables the asynchronous logging.
     ///
     /// @param log_config JSON structures that describe logging
     /// @param storage configuration will be stored here
@@ -181,6 +182,26 @@ public:
     /// PID of the current process is used.
     void createPIDFile(int pid = 0);
 
+    /// @brief Takes over the PID file of the process being replaced
+    ///
+    /// This is used instead of createPIDFile when the process takes over
+    /// from a running process, which may not have exited yet. The method
+    /// throws DaemonPIDExists if the PID file refers to another live
+    /// process. Otherwise the PID of the current process is written to
+    /// the file.
+    ///
+    /// @param previous_pid PID of the process being replaced.
+    void takeOverPIDFile(const int previous_pid);
+
+    /// @brief Gives up the ownership of the PID file
+    ///
+    /// The PID file is not removed when the daemon is destroyed. This is
+    /// used when the process hands off to its successor, which takes over
+    /// the PID file.
+    void releasePIDFile() {
+        am_file_author_ = false;
+    }
+
 protected:
 
     /// @brief Invokes handler for the next received signal.
@@ -0,0 +1,183 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/incremental_config_cache.h>
+#include <boost/foreach.hpp>
+
+using namespace isc::data;
+
+namespace isc {
+namespace dhcp {
+
+IncrementalConfigCache&
+IncrementalConfigCache::instance() {
+    static IncrementalConfigCache cache;
+    return (cache);
+}
+
+IncrementalConfigCache::IncrementalConfigCache()
+    : sequence_(0), dependencies_(), subnets_(), classes_config_(),
+      classes_(), staging_sequence_(0), staging_dependencies_(),
+      staging_subnets_(), staging_classes_config_(), staging_classes_(),
+      reused_subnets_(0), parsed_subnets_(0) {
+}
+
+void
+IncrementalConfigCache::startConfig(const ConstElementPtr& dependencies) {
+    // The objects can only be reused if they belong to the configuration
+    // in use. The staging configuration always has a sequence number
+    // different from the current one, so a configuration which has not
+    // been committed is never reused.
+    if ((sequence_ != CfgMgr::instance().getCurrentCfg()->getSequence()) ||
+        !equalElements(dependencies_, dependencies)) {
+        sequence_ = 0;
+        dependencies_.reset();
+        subnets_.clear();
+        classes_config_.reset();
+        classes_.reset();
+    }
+
+    staging_sequence_ = CfgMgr::instance().getStagingCfg()->getSequence();
+    staging_dependencies_ = dependencies;
+    staging_subnets_.clear();
+    staging_classes_config_.reset();
+    staging_classes_.reset();
+    reused_subnets_ = 0;
+    parsed_subnets_ = 0;
+}
+
+bool
+IncrementalConfigCache::hasSubnet(const ConstElementPtr& subnet_config) const {
+    return (findSubnet(subnet_config) != 0);
+}
+
+SubnetPtr
+IncrementalConfigCache::getSubnet(const ConstElementPtr& subnet_config) {
+    const SubnetEntry* entry = findSubnet(subnet_config);
+    // A duplicated identifier is parsed to report the error.
+    if (!entry || (staging_subnets_.count(entry->subnet_->getID()) > 0)) {
+        ++parsed_subnets_;
+        return (SubnetPtr());
+    }
+
+    CfgHostsPtr cfg_hosts = CfgMgr::instance().getStagingCfg()->getCfgHosts();
+    BOOST_FOREACH(HostPtr host, entry->hosts_) {
+        cfg_hosts->add(host);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CFGMGR_REUSE_SUBNET)
+        .arg(entry->subnet_->toText());
+
+    staging_subnets_[entry->subnet_->getID()] = *entry;
+    ++reused_subnets_;
+    return (entry->subnet_);
+}
+
+void
+IncrementalConfigCache::addSubnet(const ConstElementPtr& subnet_config,
+                                  const SubnetPtr& subnet,
+                                  const HostCollection& hosts) {
+    // Subnets with generated identifiers are not cached.
+    if (getSubnetID(subnet_config) == 0) {
+        return;
+    }
+    SubnetEntry& entry = staging_subnets_[subnet->getID()];
+    entry.config_ = subnet_config;
+    entry.subnet_ = subnet;
+    entry.hosts_ = hosts;
+}
+
+ClientClassDictionaryPtr
+IncrementalConfigCache::getClientClasses(const ConstElementPtr& classes_config) {
+    if (!classes_ || !equalElements(classes_config_, classes_config)) {
+        return (ClientClassDictionaryPtr());
+    }
+    staging_classes_config_ = classes_config_;
+    staging_classes_ = classes_;
+    return (classes_);
+}
+
+void
+IncrementalConfigCache::addClientClasses(const ConstElementPtr& classes_config,
+                                         const ClientClassDictionaryPtr& dictionary) {
+    staging_classes_config_ = classes_config;
+    staging_classes_ = dictionary;
+}
+
+void
+IncrementalConfigCache::commit() {
+    sequence_ = staging_sequence_;
+    dependencies_ = staging_dependencies_;
+    subnets_.swap(staging_subnets_);
+    classes_config_ = staging_classes_config_;
+    classes_ = staging_classes_;
+
+    staging_sequence_ = 0;
+    staging_dependencies_.reset();
+    staging_subnets_.clear();
+    staging_classes_config_.reset();
+    staging_classes_.reset();
+}
+
+void
+IncrementalConfigCache::clear() {
+    sequence_ = 0;
+    dependencies_.reset();
+    subnets_.clear();
+    classes_config_.reset();
+    classes_.reset();
+    staging_sequence_ = 0;
+    staging_dependencies_.reset();
+    staging_subnets_.clear();
+    staging_classes_config_.reset();
+    staging_classes_.reset();
+    reused_subnets_ = 0;
+    parsed_subnets_ = 0;
+}
+
+const IncrementalConfigCache::SubnetEntry*
+IncrementalConfigCache::findSubnet(const ConstElementPtr& subnet_config) const {
+    SubnetID subnet_id = getSubnetID(subnet_config);
+    SubnetEntryMap::const_iterator entry = subnets_.find(subnet_id);
+    if ((subnet_id == 0) || (entry == subnets_.end()) ||
+        !entry->second.config_->equals(*subnet_config)) {
+        return (0);
+    }
+
+    // The parser checks that the interface exists, so the subnet has to
+    // be parsed again if it has disappeared.
+    const std::string iface = entry->second.subnet_->getIface();
+    if (!iface.empty() && !IfaceMgr::instance().getIface(iface)) {
+        return (0);
+    }
+    return (&entry->second);
+}
+
+bool
+IncrementalConfigCache::equalElements(const ConstElementPtr& first,
+                                      const ConstElementPtr& second) {
+    if (!first || !second) {
+        return (!first && !second);
+    }
+    return (first->equals(*second));
+}
+
+SubnetID
+IncrementalConfigCache::getSubnetID(const ConstElementPtr& subnet_config) {
+    ConstElementPtr id = subnet_config->get("id");
+    if (!id || (id->getType() != Element::integer) || (id->intValue() <= 0)) {
+        return (0);
+    }
+    return (static_cast<SubnetID>(id->intValue()));
+}
+
+} // namespace isc::dhcp
+} // namespace isc
@@ -0,0 +1,218 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef INCREMENTAL_CONFIG_CACHE_H
+#define INCREMENTAL_CONFIG_CACHE_H
+
+#include <cc/data.h>
+#include <dhcpsrv/client_class_def.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/subnet_id.h>
+#include <boost/noncopyable.hpp>
+#include <map>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Caches the objects parsed from the current configuration.
+///
+/// The server parses the whole configuration into a new staging
+/// configuration on every reconfiguration. With many subnets and host
+/// reservations most of that time is spent re-creating objects which
+/// have not changed. This class remembers, for the configuration which
+/// is currently in use, the configuration element each subnet, along
+/// with its host reservations, and the client classes have been created
+/// from. When the same element is found in the new configuration, the
+/// objects of the current configuration are used in the staging
+/// configuration instead of being parsed again.
+///
+/// The cached objects are only reused if the current configuration is
+/// the one they have been parsed for and if the parts of the
+/// configuration they depend on, e.g. option definitions, didn't change.
+/// Only the subnets with an explicit subnet identifier are cached, as the
+/// identifiers generated for the other subnets depend on their position.
+///
+/// The configuration parser calls @c startConfig before parsing, then
+/// looks up each subnet with @c getSubnet, records the subnets it had to
+/// parse with @c addSubnet, and calls @c commit when the parsing
+/// succeeded.
+class IncrementalConfigCache : public boost::noncopyable {
+public:
+
+    /// @brief Returns the single instance of the cache.
+    static IncrementalConfigCache& instance();
+
+    /// @brief Starts caching a new staging configuration.
+    ///
+    /// Drops the cached objects if the current configuration is not the
+    /// one they have been parsed for or if the elements they depend on
+    /// have changed.
+    ///
+    /// @param dependencies element holding the parts of the new
+    /// configuration used to parse the cached objects, e.g. the option
+    /// definitions. It may be null.
+    void startConfig(const data::ConstElementPtr& dependencies);
+
+    /// @brief Checks if a subnet of the current configuration has been
+    /// created from the same configuration element.
+    ///
+    /// Unlike @c getSubnet, this method doesn't modify the staging
+    /// configuration. A subnet found by this method may still be parsed
+    /// by @c getSubnet if its identifier is duplicated.
+    ///
+    /// @param subnet_config configuration element of the subnet, after
+    /// the default and derived values have been set.
+    ///
+    /// @return true if the subnet may be reused.
+    bool hasSubnet(const data::ConstElementPtr& subnet_config) const;
+
+    /// @brief Returns the subnet of the current configuration created
+    /// from the same configuration element.
+    ///
+    /// The host reservations of the subnet are added to the staging
+    /// configuration.
+    ///
+    /// @param subnet_config configuration element of the subnet, after
+    /// the default and derived values have been set.
+    ///
+    /// @return pointer to the subnet or null if it must be parsed.
+    SubnetPtr getSubnet(const data::ConstElementPtr& subnet_config);
+
+    /// @brief Records a subnet parsed for the staging configuration.
+    ///
+    /// @param subnet_config configuration element of the subnet.
+    /// @param subnet the parsed subnet.
+    /// @param hosts the host reservations parsed for the subnet.
+    void addSubnet(const data::ConstElementPtr& subnet_config,
+                   const SubnetPtr& subnet, const HostCollection& hosts);
+
+    /// @brief Returns the client classes of the current configuration
+    /// created from the same configuration element.
+    ///
+    /// @param classes_config the client classes list.
+    ///
+    /// @return pointer to the dictionary or null if it must be parsed.
+    ClientClassDictionaryPtr
+    getClientClasses(const data::ConstElementPtr& classes_config);
+
+    /// @brief Records the client classes parsed for the staging
+    /// configuration.
+    ///
+    /// @param classes_config the client classes list.
+    /// @param dictionary the parsed client classes.
+    void addClientClasses(const data::ConstElementPtr& classes_config,
+                          const ClientClassDictionaryPtr& dictionary);
+
+    /// @brief Keeps the objects of the staging configuration.
+    ///
+    /// Called once the staging configuration has been successfully
+    /// parsed. The objects are reused only if this configuration is
+    /// committed.
+    void commit();
+
+    /// @brief Removes all cached objects.
+    void clear();
+
+    /// @brief Returns the number of subnets reused by the last
+    /// configuration.
+    size_t getReusedSubnets() const {
+        return (reused_subnets_);
+    }
+
+    /// @brief Returns the number of subnets parsed by the last
+    /// configuration.
+    size_t getParsedSubnets() const {
+        return (parsed_subnets_);
+    }
+
+    /// @brief Returns the subnet identifier specified in the element.
+    ///
+    /// @param subnet_config configuration element of the subnet.
+    ///
+    /// @return the identifier or 0 if it is not specified.
+    static SubnetID getSubnetID(const data::ConstElementPtr& subnet_config);
+
+private:
+
+    /// @brief Private constructor.
+    IncrementalConfigCache();
+
+    /// @brief Objects created from a subnet configuration element.
+    struct SubnetEntry {
+        /// @brief The configuration element.
+        data::ConstElementPtr config_;
+
+        /// @brief The subnet.
+        SubnetPtr subnet_;
+
+        /// @brief The host reservations of the subnet.
+        HostCollection hosts_;
+    };
+
+    /// @brief Subnet entries by subnet identifier.
+    typedef std::map<SubnetID, SubnetEntry> SubnetEntryMap;
+
+    /// @brief Returns the cached entry created from the same
+    /// configuration element.
+    ///
+    /// @param subnet_config configuration element of the subnet.
+    ///
+    /// @return pointer to the entry or null if there is none or if the
+    /// subnet must be parsed again.
+    const SubnetEntry* findSubnet(const data::ConstElementPtr& subnet_config) const;
+
+    /// @brief Checks if two possibly null elements are equal.
+    ///
+    /// @param first first element.
+    /// @param second second element.
+    ///
+    /// @return true if both elements are null or equal.
+    static bool equalElements(const data::ConstElementPtr& first,
+                              const data::ConstElementPtr& second);
+
+    /// @brief Sequence of the configuration the objects belong to.
+    uint32_t sequence_;
+
+    /// @brief Dependencies of the cached objects.
+    data::ConstElementPtr dependencies_;
+
+    /// @brief Subnets of the current configuration.
+    SubnetEntryMap subnets_;
+
+    /// @brief Client classes list of the current configuration.
+    data::ConstElementPtr classes_config_;
+
+    /// @brief Client classes of the current configuration.
+    ClientClassDictionaryPtr classes_;
+
+    /// @brief Sequence of the staging configuration.
+    uint32_t staging_sequence_;
+
+    /// @brief Dependencies of the staging configuration.
+    data::ConstElementPtr staging_dependencies_;
+
+    /// @brief Subnets of the staging configuration.
+    SubnetEntryMap staging_subnets_;
+
+    /// @brief Client classes list of the staging configuration.
+    data::ConstElementPtr staging_classes_config_;
+
+    /// @brief Client classes of the staging configuration.
+    ClientClassDictionaryPtr staging_classes_;
+
+    /// @brief Number of subnets reused by the last configuration.
+    size_t reused_subnets_;
+
+    /// @brief Number of subnets parsed by the last configuration.
+    size_t parsed_subnets_;
+};
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // INCREMENTAL_CONFIG_CACHE_H
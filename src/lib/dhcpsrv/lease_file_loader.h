@@ -42,8 +42,8 @@ public:
     ///
     /// This method iterates over the entries in the lease file in the
     /// CSV format, creates @c Lease4 or @c Lease6 objects and inserts
-    /// them into the storage to which reference is specified as an
-    /// argument. If there are multiple entries for the particular lease
+    /// their records into the storage to which reference is specified as
+    /// an argument. If there are multiple entries for the particular lease
     /// in the lease file the entries further in the lease file override
     /// the previous entries.
     ///
@@ -123,13 +123,14 @@ public:
                     .arg(lease->toText());
 
                 // Check if this lease exists.
+                typedef typename StorageType::value_type RecordType;
                 typename StorageType::iterator lease_it =
-                    storage.find(lease->addr_);
+                    storage.find(RecordType::addressKey(lease->addr_));
                 // The lease doesn't exist yet. Insert the lease if
                 // it has a positive valid lifetime.
                 if (lease_it == storage.end()) {
                     if (lease->valid_lft_ > 0) {
-                        storage.insert(lease);
+                        storage.insert(RecordType(*lease));
                     }
                 } else {
                     // The lease exists. If the new entry has a valid
@@ -140,7 +141,7 @@ public:
 
                     } else {
                         // Use replace to re-index leases on update.
-                        storage.replace(lease_it, lease);
+                        storage.replace(lease_it, RecordType(*lease));
                     }
                 }
 
@@ -205,7 +206,7 @@ public:
              lease != storage.end();
              ++lease) {
             try {
-                lease_file.append(**lease);
+                lease_file.append(*lease->toLease());
             } catch (const isc::Exception&) {
                 // Close the file
                 lease_file.close();
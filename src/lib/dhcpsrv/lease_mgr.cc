@@ -207,6 +207,16 @@ LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
 }
 
+size_t
+LeaseMgr::wipeLeases4(const SubnetID& /*subnet_id*/) {
+    isc_throw(NotImplemented, "LeaseMgr::wipeLeases4() called");
+}
+
+size_t
+LeaseMgr::wipeLeases6(const SubnetID& /*subnet_id*/) {
+    isc_throw(NotImplemented, "LeaseMgr::wipeLeases6() called");
+}
+
 std::string
 LeaseMgr::getDBVersion() {
     isc_throw(NotImplemented, "LeaseMgr::getDBVersion() called");
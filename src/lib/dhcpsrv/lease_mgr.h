@@ -477,6 +477,28 @@ public:
     /// @return Number of leases deleted.
     virtual uint64_t deleteExpiredReclaimedLeases6(const uint32_t secs) = 0;
 
+    /// @brief Deletes all DHCPv4 leases of a subnet.
+    ///
+    /// The default implementation throws, the backends supporting this
+    /// operation override it.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    ///
+    /// @return Number of leases deleted.
+    /// @throw NotImplemented if the backend doesn't support this operation.
+    virtual size_t wipeLeases4(const SubnetID& subnet_id);
+
+    /// @brief Deletes all DHCPv6 leases of a subnet.
+    ///
+    /// The default implementation throws, the backends supporting this
+    /// operation override it.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    ///
+    /// @return Number of leases deleted.
+    /// @throw NotImplemented if the backend doesn't support this operation.
+    virtual size_t wipeLeases6(const SubnetID& subnet_id);
+
     /// @brief Recalculates per-subnet and global stats for IPv4 leases
     ///
     /// This method recalculates the following statistics:
@@ -9,6 +9,7 @@
 #include <dhcpsrv/logging.h>
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
+#include <limits>
 #include <log/logger_specification.h>
 #include <log/logger_support.h>
 #include <log/logger_manager.h>
@@ -20,6 +21,36 @@ using namespace isc::log;
 namespace isc {
 namespace dhcp {
 
+namespace {
+
+/// @brief Returns an optional value of a rate-limits entry.
+///
+/// @param rate_limit the rate-limits entry
+/// @param name name of the value
+/// @param min minimum allowed value
+/// @param default_value value returned when the entry does not have it
+/// @return the value
+/// @throw BadValue if the value is not an integer in the min-2^32-1 range
+uint32_t
+getLimitValue(ConstElementPtr rate_limit, const std::string& name,
+              const int64_t min, const uint32_t default_value) {
+    ConstElementPtr value = rate_limit->get(name);
+    if (!value) {
+        return (default_value);
+    }
+    if ((value->getType() != Element::integer) ||
+        (value->intValue() < min) ||
+        (value->intValue() > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(BadValue, "Unsupported " << name << " value '"
+                  << value->str() << "' in rate-limits entry, expected "
+                  << min << "-" << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+    return (static_cast<uint32_t>(value->intValue()));
+}
+
+} // end of anonymous namespace
+
 LogConfigParser::LogConfigParser(const SrvConfigPtr& storage)
     :config_(storage), verbose_(false) {
     if (!storage) {
@@ -38,6 +69,47 @@ void LogConfigParser::parseConfiguration(const isc::data::ConstElementPtr& logge
     }
 }
 
+void LogConfigParser::parseAsyncConfiguration(const isc::data::ConstElementPtr& async_config) {
+    if (!async_config || (async_config->getType() != Element::map)) {
+        isc_throw(BadValue, "'async' must be a map");
+    }
+
+    AsyncLoggingInfo info;
+    info.enabled_ = true;
+
+    isc::data::ConstElementPtr queue_size_ptr = async_config->get("queue-size");
+    if (queue_size_ptr) {
+        int64_t queue_size = 0;
+        try {
+            queue_size = queue_size_ptr->intValue();
+        } catch (...) {
+            // Reported below.
+        }
+        if ((queue_size <= 0) ||
+            (queue_size > static_cast<int64_t>(AsyncLoggingInfo::MAX_QUEUE_SIZE))) {
+            isc_throw(BadValue, "Unsupported queue-size value '"
+                      << queue_size_ptr->str() << "', expected 1-"
+                      << AsyncLoggingInfo::MAX_QUEUE_SIZE << " ("
+                      << queue_size_ptr->getPosition() << ")");
+        }
+        info.queue_size_ = static_cast<size_t>(queue_size);
+    }
+
+    isc::data::ConstElementPtr policy_ptr = async_config->get("overflow-policy");
+    if (policy_ptr) {
+        try {
+            info.overflow_policy_ =
+                AsyncLogWriter::policyFromText(policy_ptr->stringValue());
+        } catch (const std::exception&) {
+            isc_throw(BadValue, "Unsupported overflow-policy value '"
+                      << policy_ptr->str() << "', expected block, drop or"
+                      " count (" << policy_ptr->getPosition() << ")");
+        }
+    }
+
+    config_->setAsyncLoggingInfo(info);
+}
+
 void LogConfigParser::parseConfigEntry(isc::data::ConstElementPtr entry) {
     if (!entry) {
         // This should not happen, but let's be on the safe side and check
@@ -108,6 +180,11 @@ void LogConfigParser::parseConfigEntry(isc::data::ConstElementPtr entry) {
     if (output_options) {
         parseOutputOptions(info.destinations_, output_options);
     }
+
+    isc::data::ConstElementPtr rate_limits = entry->get("rate-limits");
+    if (rate_limits) {
+        parseRateLimits(info.limits_, rate_limits);
+    }
     
     config_->addLoggingInfo(info);
 }
@@ -148,5 +225,33 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
     }
 }
 
+void LogConfigParser::parseRateLimits(std::vector<MessageLimit>& limits,
+                                      isc::data::ConstElementPtr rate_limits) {
+    if (rate_limits->getType() != Element::list) {
+        isc_throw(BadValue, "'rate-limits' must be a list ("
+                  << rate_limits->getPosition() << ")");
+    }
+
+    BOOST_FOREACH(ConstElementPtr rate_limit, rate_limits->listValue()) {
+
+        MessageLimit limit;
+
+        isc::data::ConstElementPtr message = rate_limit->get("message");
+        if (!message || message->stringValue().empty()) {
+            isc_throw(BadValue, "rate-limits entry does not have a mandatory "
+                      "'message' element (" << rate_limit->getPosition()
+                      << ")");
+        }
+        limit.message = message->stringValue();
+
+        limit.sample = getLimitValue(rate_limit, "sample", 1, limit.sample);
+        limit.rate = getLimitValue(rate_limit, "rate", 0, limit.rate);
+        limit.interval = getLimitValue(rate_limit, "interval", 1,
+                                       limit.interval);
+
+        limits.push_back(limit);
+    }
+}
+
 } // namespace isc::dhcp
 } // namespace isc
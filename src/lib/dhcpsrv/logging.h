@@ -57,6 +57,20 @@ public:
     void parseConfiguration(const isc::data::ConstElementPtr& log_config,
                             bool verbose = false);
 
+    /// @brief Parses the asynchronous logging configuration
+    ///
+    /// Parses the "Logging/async" map and stores the result in
+    /// config_->async_logging_info_. The asynchronous logging is enabled
+    /// by the presence of the map, the parameters are optional:
+    /// {
+    ///     "queue-size": 65536,
+    ///     "overflow-policy": "block"
+    /// }
+    ///
+    /// @param async_config JSON map to be parsed
+    /// @throw BadValue if the queue size or the overflow policy is invalid
+    void parseAsyncConfiguration(const isc::data::ConstElementPtr& async_config);
+
 private:
 
     /// @brief Parses one JSON structure in Logging/loggers" array
@@ -74,6 +88,15 @@ private:
     void parseOutputOptions(std::vector<LoggingDestination>& destination,
                             isc::data::ConstElementPtr output_options);
 
+    /// @brief Parses rate-limits structure
+    ///
+    /// @ref @c LoggingInfo for an example in JSON format.
+    ///
+    /// @param limits parsed limits will be stored here
+    /// @param rate_limits element to be parsed
+    void parseRateLimits(std::vector<isc::log::MessageLimit>& limits,
+                         isc::data::ConstElementPtr rate_limits);
+
     /// @brief Configuration is stored here
     ///
     /// LogConfigParser class uses only config_->logging_info_ field.
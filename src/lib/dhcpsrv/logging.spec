@@ -3,6 +3,31 @@
     "module_name": "Logging",
     "module_description": "Logging configuration",
     "config_data": [
+      {
+        "item_name": "async",
+        "item_type": "map",
+        "item_optional": true,
+        "item_default": {},
+        "item_description": "Asynchronous logging",
+        "map_item_spec": [
+          {
+            "item_name": "queue-size",
+            "item_type": "integer",
+            "item_optional": true,
+            "item_default": 65536,
+            "item_description": "Number of messages the queue can hold"
+          },
+
+          {
+            "item_name": "overflow-policy",
+            "item_type": "string",
+            "item_optional": true,
+            "item_default": "block",
+            "item_description": "Behavior when the queue is full: block, drop or count"
+          }
+        ]
+      },
+
       {
         "item_name": "loggers",
         "item_type": "list",
@@ -85,6 +110,54 @@
             "item_optional": true,
             "item_default": 0,
             "item_description": "Debug level (for DEBUG severity, 0..99 range)"
+          },
+
+          {
+            "item_name": "rate-limits",
+            "item_type": "list",
+            "item_optional": true,
+            "item_default": [],
+            "list_item_spec":
+            {
+               "item_name": "rate-limit",
+               "item_type": "map",
+               "item_optional": false,
+               "item_default": {},
+               "item_description": "Limit on the output of a message",
+               "map_item_spec": [
+               {
+                 "item_name": "message",
+                 "item_type": "string",
+                 "item_optional": false,
+                 "item_default": "",
+                 "item_description": "Message ID, or message ID prefix followed by *"
+               },
+
+               {
+                 "item_name": "sample",
+                 "item_type": "integer",
+                 "item_optional": true,
+                 "item_default": 1,
+                 "item_description": "Only one message in this number is logged"
+               },
+
+               {
+                 "item_name": "rate",
+                 "item_type": "integer",
+                 "item_optional": true,
+                 "item_default": 0,
+                 "item_description": "Maximum number of messages per interval (0 = unlimited)"
+               },
+
+               {
+                 "item_name": "interval",
+                 "item_type": "integer",
+                 "item_optional": true,
+                 "item_default": 1,
+                 "item_description": "Interval in seconds"
+               }
+               ]
+             }
           }
           ]
         }
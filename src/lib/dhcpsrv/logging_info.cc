@@ -74,10 +74,12 @@ LoggingInfo::equals(const LoggingInfo& other) const {
     }
 
     // Logging destinations are equal. Check the rest of the parameters for
-    // equality.
+    // equality. The order of the limits matters as the first matching
+    // limit applies.
     return (name_ == other.name_ &&
             severity_ == other.severity_ &&
-            debuglevel_ == other.debuglevel_);
+            debuglevel_ == other.debuglevel_ &&
+            limits_ == other.limits_);
 }
 
 LoggerSpecification
@@ -134,8 +136,28 @@ LoggingInfo::toSpec() const {
         spec.addOutputOption(option);
     }
 
+    for (std::vector<MessageLimit>::const_iterator limit = limits_.begin();
+         limit != limits_.end(); ++limit) {
+        spec.addMessageLimit(*limit);
+    }
+
     return (spec);
 }
 
+const size_t AsyncLoggingInfo::DEFAULT_QUEUE_SIZE;
+const size_t AsyncLoggingInfo::MAX_QUEUE_SIZE;
+
+AsyncLoggingInfo::AsyncLoggingInfo()
+    : enabled_(false), queue_size_(DEFAULT_QUEUE_SIZE),
+      overflow_policy_(AsyncLogWriter::BLOCK) {
+}
+
+bool
+AsyncLoggingInfo::equals(const AsyncLoggingInfo& other) const {
+    return (enabled_ == other.enabled_ &&
+            queue_size_ == other.queue_size_ &&
+            overflow_policy_ == other.overflow_policy_);
+}
+
 } // end of namespace isc::dhcp
 } // end of namespace isc
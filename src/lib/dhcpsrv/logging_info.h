@@ -7,8 +7,10 @@
 #ifndef DHCPSRV_LOGGING_INFO_H
 #define DHCPSRV_LOGGING_INFO_H
 
+#include <log/async_log_writer.h>
 #include <log/logger_level.h>
 #include <log/logger_specification.h>
+#include <log/message_limiter.h>
 #include <stdint.h>
 #include <vector>
 
@@ -63,7 +65,15 @@ struct LoggingDestination {
 ///                }
 ///            ],
 ///            "severity": "WARN",
-///            "debuglevel": 99
+///            "debuglevel": 99,
+///            "rate-limits": [
+///                {
+///                    "message": "DHCP4_PACKET_DROP_*",
+///                    "sample": 1,
+///                    "rate": 10,
+///                    "interval": 1
+///                }
+///            ]
 ///        },
 struct LoggingInfo {
 
@@ -81,6 +91,9 @@ struct LoggingInfo {
     /// @brief specific logging destinations
     std::vector<LoggingDestination> destinations_;
 
+    /// @brief sampling and rate limits of the messages
+    std::vector<isc::log::MessageLimit> limits_;
+
     /// @brief Default constructor.
     LoggingInfo();
 
@@ -121,6 +134,63 @@ struct LoggingInfo {
 /// @brief storage for logging information in log4cplus format
 typedef std::vector<isc::dhcp::LoggingInfo> LoggingInfoStorage;
 
+/// @brief structure that describes the asynchronous logging
+///
+/// When enabled, the log messages are queued into a lock-free ring buffer
+/// and written by a background thread. The structure in JSON form has the
+/// following syntax:
+///        "async": {
+///            "queue-size": 65536,
+///            "overflow-policy": "count"
+///        }
+struct AsyncLoggingInfo {
+
+    /// @brief Default size of the ring buffer.
+    static const size_t DEFAULT_QUEUE_SIZE = 65536;
+
+    /// @brief Maximum size of the ring buffer.
+    static const size_t MAX_QUEUE_SIZE = 1 << 24;
+
+    /// @brief true if the asynchronous logging is enabled
+    bool enabled_;
+
+    /// @brief size of the ring buffer (rounded up to a power of 2)
+    size_t queue_size_;
+
+    /// @brief behavior when the ring buffer is full
+    isc::log::AsyncLogWriter::OverflowPolicy overflow_policy_;
+
+    /// @brief Default constructor.
+    ///
+    /// The asynchronous logging is disabled by default.
+    AsyncLoggingInfo();
+
+    /// @brief Compares two objects for equality.
+    ///
+    /// @param other An object to be compared with this object.
+    ///
+    /// @return true if objects are equal, false otherwise.
+    bool equals(const AsyncLoggingInfo& other) const;
+
+    /// @brief Compares two objects for equality.
+    ///
+    /// @param other An object to be compared with this object.
+    ///
+    /// @return true if objects are equal, false otherwise.
+    bool operator==(const AsyncLoggingInfo& other) const {
+        return (equals(other));
+    }
+
+    /// @brief Compares two objects for inequality.
+    ///
+    /// @param other An object to be compared with this object.
+    ///
+    /// @return true if objects are not equal, false otherwise.
+    bool operator!=(const AsyncLoggingInfo& other) const {
+        return (!equals(other));
+    }
+};
+
 }
 }
 
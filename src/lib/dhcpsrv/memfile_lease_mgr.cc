@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <dhcp/iface_mgr.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_file_loader.h>
@@ -15,12 +16,16 @@
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <vector>
 
 namespace {
 
@@ -39,10 +44,412 @@ const char* KEA_LFC_EXECUTABLE_ENV_NAME = "KEA_LFC_EXECUTABLE";
 } // end of anonymous namespace
 
 using namespace isc::util;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace dhcp {
 
+namespace {
+
+/// @brief Checks if a lease file is in the binary format.
+///
+/// @param filename Name of the lease file.
+/// @return true if the file is a binary lease file.
+bool
+hasFormat(const std::string& filename, const BinaryLeaseFile*) {
+    return (BinaryLeaseFile::isBinaryFile(filename));
+}
+
+/// @brief Checks if a lease file is in the CSV format.
+///
+/// @param filename Name of the lease file.
+/// @return true if the file isn't a binary lease file.
+bool
+hasFormat(const std::string& filename, const CSVFile*) {
+    return (!BinaryLeaseFile::isBinaryFile(filename));
+}
+
+/// @brief Loads leases from a lease file in the format it is written in.
+///
+/// @param filename Name of the lease file.
+/// @param storage A storage for leases read from the lease file.
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType Type of the lease file in the configured format.
+/// @tparam OtherFileType Type of the lease file in the other format.
+/// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+///
+/// @return true if the file needs conversion from an older or newer schema.
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename OtherFileType, typename StorageType>
+bool
+loadLeaseFile(const std::string& filename, StorageType& storage) {
+    LeaseFileType lease_file(filename);
+    if (!lease_file.exists()) {
+        return (false);
+    }
+    if (hasFormat(filename, static_cast<LeaseFileType*>(0))) {
+        LeaseFileLoader::load<LeaseObjectType>(lease_file, storage,
+                                               MAX_LEASE_ERRORS);
+        return (lease_file.needsConversion());
+    }
+    OtherFileType other_file(filename);
+    LeaseFileLoader::load<LeaseObjectType>(other_file, storage,
+                                           MAX_LEASE_ERRORS);
+    return (other_file.needsConversion());
+}
+
+/// @brief Updates the numbers of leases of a subnet for a DHCPv4 lease.
+///
+/// @param counts Numbers of leases per subnet.
+/// @param lease The lease added to or removed from the storage.
+/// @param delta 1 if the lease is added, -1 if it is removed.
+void
+countLease(SubnetLeaseCounts& counts, const Lease4Record& lease,
+           const int64_t delta) {
+    if (lease.state_ == Lease::STATE_DEFAULT) {
+        counts[lease.subnet_id_].assigned_ += delta;
+    } else if (lease.state_ == Lease::STATE_DECLINED) {
+        counts[lease.subnet_id_].declined_ += delta;
+    }
+}
+
+/// @brief Updates the numbers of leases of a subnet for a DHCPv6 lease.
+///
+/// @param counts Numbers of leases per subnet.
+/// @param lease The lease added to or removed from the storage.
+/// @param delta 1 if the lease is added, -1 if it is removed.
+void
+countLease(SubnetLeaseCounts& counts, const Lease6Record& lease,
+           const int64_t delta) {
+    if (lease.state_ == Lease::STATE_DEFAULT) {
+        if (lease.type_ == Lease::TYPE_NA) {
+            counts[lease.subnet_id_].assigned_ += delta;
+        } else if (lease.type_ == Lease::TYPE_PD) {
+            counts[lease.subnet_id_].assigned_pds_ += delta;
+        }
+    } else if ((lease.state_ == Lease::STATE_DECLINED) &&
+               (lease.type_ == Lease::TYPE_NA)) {
+        // In theory only NAs can be declined
+        counts[lease.subnet_id_].declined_ += delta;
+    }
+}
+
+/// @brief Counts the leases held in a storage.
+///
+/// @param storage The lease storage.
+/// @param [out] counts Numbers of leases per subnet.
+/// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+template<typename StorageType>
+void
+countLeases(const StorageType& storage, SubnetLeaseCounts& counts) {
+    counts.clear();
+    for (typename StorageType::const_iterator lease = storage.begin();
+         lease != storage.end(); ++lease) {
+        countLease(counts, *lease, 1);
+    }
+}
+
+/// @brief Returns the mutex held during the in-process lease file cleanup.
+///
+/// The lease files are loaded with this mutex held, so as a new instance
+/// of the backend, e.g. created during reconfiguration, doesn't read the
+/// files being rotated by the cleanup of the previous instance. The mutex
+/// is never destroyed, as a detached cleanup may hold it when the process
+/// exits.
+Mutex&
+getCleanupMutex() {
+    static Mutex* mutex = new Mutex();
+    return (*mutex);
+}
+
+/// @brief Number of leases copied from the storage at a time by the
+/// in-process lease file cleanup.
+const size_t LFC_BATCH_SIZE = 1000;
+
+/// @brief Moves the finish file of a lease file cleanup to the previous file.
+///
+/// This is the last step of the cleanup, as performed by the @c kea-lfc:
+/// the finish file holds the leases of the previous and copy files, which
+/// are removed. Nothing is done if the finish file doesn't exist.
+///
+/// @param filename Name of the current lease file.
+/// @throw DbOperationError if the files can't be removed or renamed.
+void
+rotateFinishFile(const std::string& filename) {
+    const std::string finish =
+        Memfile_LeaseMgr::appendSuffix(filename, Memfile_LeaseMgr::FILE_FINISH);
+    if (!CSVFile(finish).exists()) {
+        return;
+    }
+    const std::string previous =
+        Memfile_LeaseMgr::appendSuffix(filename, Memfile_LeaseMgr::FILE_PREVIOUS);
+    const std::string copy =
+        Memfile_LeaseMgr::appendSuffix(filename, Memfile_LeaseMgr::FILE_INPUT);
+    if ((remove(previous.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(DbOperationError, "unable to remove " << previous
+                  << ": " << strerror(errno));
+    }
+    if ((remove(copy.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(DbOperationError, "unable to remove " << copy
+                  << ": " << strerror(errno));
+    }
+    if (rename(finish.c_str(), previous.c_str()) != 0) {
+        isc_throw(DbOperationError, "unable to rename " << finish << " to "
+                  << previous << ": " << strerror(errno));
+    }
+}
+
+/// @brief State of an in-process lease file cleanup.
+///
+/// The job is shared by the thread performing the cleanup and the
+/// @c LFCSetup which started it, so as it outlives the backend: the
+/// backend cancels the cleanup rather than waiting for it when it is
+/// destroyed, e.g. during reconfiguration or shutdown. The thread doesn't
+/// log, as the main thread may be reconfiguring the logging meanwhile.
+/// Instead, it marks the watch socket of the job ready and the outcome is
+/// logged by the main thread, to which the socket is installed as an
+/// external socket of the @c IfaceMgr.
+class LFCJob : public boost::noncopyable {
+public:
+
+    /// @brief Function performing the cleanup.
+    ///
+    /// It returns the number of leases written and signals a failure by
+    /// throwing an exception.
+    typedef boost::function<size_t(const LFCJob&)> Cleanup;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the current lease file.
+    /// @param storage_mutex Mutex protecting the storage of the backend.
+    LFCJob(const std::string& filename,
+           const boost::shared_ptr<Mutex>& storage_mutex)
+        : filename_(filename), storage_mutex_(storage_mutex),
+          cancelled_(false), mutex_(), running_(true),
+          exit_status_(EXIT_SUCCESS), count_(0), error_(), watch_socket_() {
+    }
+
+    /// @brief Body of the thread performing the cleanup.
+    ///
+    /// @param cleanup A function performing the cleanup.
+    void run(const Cleanup& cleanup) {
+        try {
+            Mutex::Locker lock(getCleanupMutex());
+            complete(EXIT_SUCCESS, cleanup(*this), "");
+
+        } catch (const std::exception& ex) {
+            complete(EXIT_FAILURE, 0, ex.what());
+
+        } catch (...) {
+            complete(EXIT_FAILURE, 0, "unknown error");
+        }
+    }
+
+    /// @brief Records the outcome of the cleanup and signals it to the
+    /// main thread.
+    ///
+    /// @param exit_status @c EXIT_SUCCESS or @c EXIT_FAILURE.
+    /// @param count Number of leases written.
+    /// @param error Reason of the failure.
+    void complete(const int exit_status, const size_t count,
+                  const std::string& error) {
+        {
+            Mutex::Locker lock(mutex_);
+            running_ = false;
+            exit_status_ = exit_status;
+            count_ = count;
+            error_ = error;
+        }
+        try {
+            watch_socket_.markReady();
+        } catch (...) {
+            // The outcome is not logged.
+        }
+    }
+
+    /// @brief Logs the outcome of the cleanup.
+    ///
+    /// It is invoked by the @c IfaceMgr in the main thread.
+    void report() {
+        IfaceMgr::instance().deleteExternalSocket(getSelectFd());
+        bool cancelled = false;
+        {
+            Mutex::Locker lock(*storage_mutex_);
+            cancelled = cancelled_;
+        }
+        Mutex::Locker lock(mutex_);
+        if (exit_status_ == EXIT_SUCCESS) {
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_COMPACT_COMPLETE)
+                .arg(count_)
+                .arg(Memfile_LeaseMgr::appendSuffix(filename_,
+                                                    Memfile_LeaseMgr::FILE_PREVIOUS));
+        } else if (cancelled) {
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_COMPACT_CANCELLED)
+                .arg(filename_);
+        } else {
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_COMPACT_FAIL)
+                .arg(error_);
+        }
+    }
+
+    /// @brief Cancels the cleanup.
+    ///
+    /// The storage of the backend is no longer read once this method
+    /// returns.
+    void cancel() {
+        Mutex::Locker lock(*storage_mutex_);
+        cancelled_ = true;
+    }
+
+    /// @brief Checks if the cleanup has been cancelled.
+    ///
+    /// The mutex returned by @c getStorageMutex must be held.
+    bool isCancelled() const {
+        return (cancelled_);
+    }
+
+    /// @brief Returns the mutex protecting the storage of the backend.
+    Mutex& getStorageMutex() const {
+        return (*storage_mutex_);
+    }
+
+    /// @brief Checks if the cleanup is in progress.
+    bool isRunning() const {
+        Mutex::Locker lock(mutex_);
+        return (running_);
+    }
+
+    /// @brief Returns the exit code of the cleanup.
+    int getExitStatus() const {
+        Mutex::Locker lock(mutex_);
+        return (exit_status_);
+    }
+
+    /// @brief Returns the descriptor of the watch socket.
+    int getSelectFd() {
+        return (watch_socket_.getSelectFd());
+    }
+
+private:
+
+    /// @brief Name of the current lease file.
+    std::string filename_;
+
+    /// @brief Mutex protecting the storage of the backend.
+    boost::shared_ptr<Mutex> storage_mutex_;
+
+    /// @brief The backend has been destroyed: protected by the
+    /// @c storage_mutex_.
+    bool cancelled_;
+
+    /// @brief Protects the outcome of the cleanup.
+    mutable Mutex mutex_;
+
+    /// @brief The cleanup is in progress.
+    bool running_;
+
+    /// @brief Exit code of the cleanup.
+    int exit_status_;
+
+    /// @brief Number of leases written.
+    size_t count_;
+
+    /// @brief Reason of the failure.
+    std::string error_;
+
+    /// @brief Socket marked ready when the cleanup has completed.
+    WatchSocket watch_socket_;
+};
+
+/// @brief Pointer to the @c LFCJob.
+typedef boost::shared_ptr<LFCJob> LFCJobPtr;
+
+/// @brief Performs the lease file cleanup from the leases held in memory.
+///
+/// The leases are written to the output file, which is then renamed to
+/// the finish file and moved to the previous file by @c rotateFinishFile.
+/// The storage is read in batches of @c LFC_BATCH_SIZE leases ordered by
+/// address, with the storage mutex held, so as neither the memory nor the
+/// time needed to copy the whole storage are spent. The view of the
+/// storage is not a point in time one: a lease may be written in a state
+/// it has reached after the current file has been moved to the copy file.
+/// This is harmless because such an update is also written to the new
+/// current file, which is read after the previous file when the leases
+/// are loaded. If the server is stopped during the cleanup, the leases
+/// are loaded from the remaining files as usual.
+///
+/// This function is executed by the thread of the @c LFCJob. It doesn't
+/// log.
+///
+/// @param job The cleanup job.
+/// @param filename Name of the current lease file.
+/// @param storage Leases held by the backend.
+/// @return Number of leases written.
+/// @throw DbOperationError if the cleanup has been cancelled or the files
+/// can't be rotated.
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType Type of the lease file in the configured format.
+/// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename StorageType>
+size_t
+compactLeaseFile(const LFCJob& job, const std::string& filename,
+                 const StorageType& storage) {
+    typedef typename StorageType::value_type RecordType;
+    const std::string output =
+        Memfile_LeaseMgr::appendSuffix(filename, Memfile_LeaseMgr::FILE_OUTPUT);
+    const std::string finish =
+        Memfile_LeaseMgr::appendSuffix(filename, Memfile_LeaseMgr::FILE_FINISH);
+
+    // Discard the output of an interrupted cleanup.
+    static_cast<void>(remove(output.c_str()));
+    LeaseFileType output_file(output);
+    output_file.open();
+
+    const typename StorageType::key_from_value key;
+    typename StorageType::key_type last_key = typename StorageType::key_type();
+    std::vector<RecordType> batch;
+    batch.reserve(LFC_BATCH_SIZE);
+    size_t count = 0;
+    for (bool first = true; ; first = false) {
+        batch.clear();
+        {
+            Mutex::Locker lock(job.getStorageMutex());
+            if (job.isCancelled()) {
+                output_file.close();
+                static_cast<void>(remove(output.c_str()));
+                isc_throw(DbOperationError, "the cleanup of " << filename
+                          << " has been cancelled");
+            }
+            for (typename StorageType::const_iterator lease =
+                     (first ? storage.begin() : storage.upper_bound(last_key));
+                 (lease != storage.end()) && (batch.size() < LFC_BATCH_SIZE);
+                 ++lease) {
+                batch.push_back(*lease);
+            }
+        }
+        if (batch.empty()) {
+            break;
+        }
+        last_key = key(batch.back());
+        for (typename std::vector<RecordType>::const_iterator lease =
+                 batch.begin(); lease != batch.end(); ++lease) {
+            output_file.append(*lease->toLease());
+        }
+        count += batch.size();
+    }
+    output_file.close();
+
+    if (rename(output.c_str(), finish.c_str()) != 0) {
+        isc_throw(DbOperationError, "unable to rename " << output << " to "
+                  << finish << ": " << strerror(errno));
+    }
+    rotateFinishFile(filename);
+    return (count);
+}
+
+} // end of anonymous namespace
+
 /// @brief Represents a configuration for Lease File Cleanup.
 ///
 /// This class is solely used by the @c Memfile_LeaseMgr as a configuration
@@ -51,7 +458,8 @@ namespace dhcp {
 /// passed in the constructor), which will be called at the specified
 /// intervals to perform the cleanup. It is also responsible for creating
 /// and maintaining the object which is used to spawn the new process which
-/// executes the @c kea-lfc program.
+/// executes the @c kea-lfc program or, when the cleanup is performed within
+/// the server process, the thread which writes the leases to the new file.
 ///
 /// This functionality is enclosed in a separate class so as the implementation
 /// details are not exposed in the @c Memfile_LeaseMgr header file and
@@ -71,28 +479,46 @@ public:
 
     /// @brief Destructor.
     ///
-    /// Unregisters LFC timer.
+    /// Cancels the in-process cleanup, without waiting for its thread, and
+    /// unregisters LFC timer.
     ~LFCSetup();
 
     /// @brief Sets the new configuration for the %Lease File Cleanup.
     ///
     /// @param lfc_interval An interval in seconds at which the cleanup should
     /// be performed.
-    /// @param lease_file4 A pointer to the DHCPv4 lease file to be cleaned up
-    /// or NULL. If this is NULL, the @c lease_file6 must be non-null.
-    /// @param lease_file6 A pointer to the DHCPv6 lease file to be cleaned up
-    /// or NULL. If this is NULL, the @c lease_file4 must be non-null.
+    /// @param lease_file Name of the lease file to be cleaned up.
+    /// @param u Universe of the lease file (v4 or v6).
     /// @param run_once_now A flag that causes LFC to be invoked immediately,
     /// regardless of the value of lfc_interval.  This is primarily used to
     /// cause lease file schema upgrades upon startup.
+    /// @param in_process A flag that causes the cleanup to be performed
+    /// by a thread of the server process rather than by the @c kea-lfc.
     void setup(const uint32_t lfc_interval,
-               const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
-               const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-               bool run_once_now = false);
+               const std::string& lease_file,
+               const Memfile_LeaseMgr::Universe& u,
+               bool run_once_now = false,
+               bool in_process = false);
 
     /// @brief Spawns a new process.
     void execute();
 
+    /// @brief Performs the cleanup in a new thread.
+    ///
+    /// The thread of the previous cleanup must have terminated.
+    ///
+    /// @param filename Name of the current lease file.
+    /// @param storage_mutex Mutex protecting the storage of the backend.
+    /// @param cleanup A function performing the cleanup.
+    void executeInProcess(const std::string& filename,
+                          const boost::shared_ptr<Mutex>& storage_mutex,
+                          const LFCJob::Cleanup& cleanup);
+
+    /// @brief Checks if the cleanup is performed within the server process.
+    bool isInProcess() const {
+        return (in_process_);
+    }
+
     /// @brief Checks if the lease file cleanup is in progress.
     ///
     /// @return true if the lease file cleanup is being executed.
@@ -113,6 +539,15 @@ private:
     /// @brief A PID of the last executed LFC process.
     pid_t pid_;
 
+    /// @brief The cleanup is performed within the server process.
+    bool in_process_;
+
+    /// @brief The last in-process cleanup.
+    LFCJobPtr job_;
+
+    /// @brief Thread performing the last in-process cleanup.
+    boost::scoped_ptr<Thread> thread_;
+
     /// @brief Pointer to the timer manager.
     ///
     /// We have to hold this pointer here to make sure that the timer
@@ -121,11 +556,20 @@ private:
 };
 
 LFCSetup::LFCSetup(asiolink::IntervalTimer::Callback callback)
-    : process_(), callback_(callback), pid_(0),
-      timer_mgr_(TimerMgr::instance()) {
+    : process_(), callback_(callback), pid_(0), in_process_(false),
+      job_(), thread_(), timer_mgr_(TimerMgr::instance()) {
 }
 
 LFCSetup::~LFCSetup() {
+    // The cleanup reads the storage of the backend being destroyed, so it
+    // is cancelled. The thread is detached: it only uses the job, which it
+    // holds, and it releases the cleanup mutex once it has noticed the
+    // cancellation, i.e. after writing the current batch of leases.
+    if (job_) {
+        job_->cancel();
+    }
+    thread_.reset();
+
     try {
         // If we're here it means that either the process is terminating
         // or we're reconfiguring the server. In both cases the thread has
@@ -156,15 +600,18 @@ LFCSetup::~LFCSetup() {
 
 void
 LFCSetup::setup(const uint32_t lfc_interval,
-                const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
-                const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-                bool run_once_now) {
+                const std::string& lease_file,
+                const Memfile_LeaseMgr::Universe& u,
+                bool run_once_now,
+                bool in_process) {
 
     // If to nothing to do, punt
     if (lfc_interval == 0 && !run_once_now) {
         return;
     }
 
+    in_process_ = in_process;
+
     // Start preparing the command line for kea-lfc.
     std::string executable;
     char* c_executable = getenv(KEA_LFC_EXECUTABLE_ENV_NAME);
@@ -174,14 +621,10 @@ LFCSetup::setup(const uint32_t lfc_interval,
         executable = c_executable;
     }
 
-    // Gather the base file name.
-    std::string lease_file = lease_file4 ? lease_file4->getFilename() :
-                                           lease_file6->getFilename();
-
     // Create the other names by appending suffixes to the base name.
     util::ProcessArgs args;
     // Universe: v4 or v6.
-    args.push_back(lease_file4 ? "-4" : "-6");
+    args.push_back(u == Memfile_LeaseMgr::V4 ? "-4" : "-6");
 
     // Previous file.
     args.push_back("-x");
@@ -230,6 +673,26 @@ LFCSetup::setup(const uint32_t lfc_interval,
     }
 }
 
+void
+LFCSetup::executeInProcess(const std::string& filename,
+                           const boost::shared_ptr<Mutex>& storage_mutex,
+                           const LFCJob::Cleanup& cleanup) {
+    // Release the thread of the previous cleanup.
+    if (thread_) {
+        thread_->wait();
+        thread_.reset();
+    }
+    job_.reset(new LFCJob(filename, storage_mutex));
+    IfaceMgr::instance().addExternalSocket(job_->getSelectFd(),
+        boost::bind(&LFCJob::report, job_));
+    try {
+        thread_.reset(new Thread(boost::bind(&LFCJob::run, job_, cleanup)));
+
+    } catch (const std::exception& ex) {
+        job_->complete(EXIT_FAILURE, 0, ex.what());
+    }
+}
+
 void
 LFCSetup::execute() {
     try {
@@ -244,11 +707,17 @@ LFCSetup::execute() {
 
 bool
 LFCSetup::isRunning() const {
+    if (in_process_) {
+        return (job_ && job_->isRunning());
+    }
     return (process_ && process_->isRunning(pid_));
 }
 
 int
 LFCSetup::getExitStatus() const {
+    if (in_process_) {
+        return (job_ ? job_->getExitStatus() : 0);
+    }
     if (!process_) {
         isc_throw(InvalidOperation, "unable to obtain LFC process exit code: "
                   " the process is NULL");
@@ -309,19 +778,19 @@ protected:
 /// @brief Memfile derivation of the IPv4 statistical lease data query
 ///
 /// This class is used to recalculate IPv4 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  It does so by reading the numbers of leases in each
+/// of the monitored lease states for each subnet, which are maintained
+/// by the backend as the leases are added, updated and deleted.  The
+/// populated result set will contain one entry per monitored state per
+/// subnet.
 ///
 class MemfileLeaseStatsQuery4 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4)
-    : MemfileLeaseStatsQuery(), storage4_(storage4) {
+    /// @param counts4 The numbers of IPv4 leases per subnet.
+    MemfileLeaseStatsQuery4(const SubnetLeaseCounts& counts4)
+    : MemfileLeaseStatsQuery(), counts4_(counts4) {
     };
 
     /// @brief Destructor
@@ -329,64 +798,22 @@ public:
 
     /// @brief Creates the IPv4 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv4 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet. Note that walking the leases by address should
-    /// inherently group them by subnet, and while this does not guarantee
-    /// ascending order of subnet id, it should be sufficient to accumulate
-    /// state counts per subnet.  This avoids introducing an additional
-    /// subnet_id index.
-    /// At the completion of all entries for a given subnet, the counts are
-    /// used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per subnet.
+    /// The result set is populated by iterating over the subnets in
+    /// ascending order of subnet id, so the cost doesn't depend on the
+    /// number of leases.  The process results in a vector containing one
+    /// entry per state per subnet.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     void start() {
-        const Lease4StorageAddressIndex& idx
-            = storage4_.get<AddressIndexTag>();
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        for(Lease4StorageAddressIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                                  assigned));
-                    assigned = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                                  declined));
-                    declined = 0;
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                ++assigned;
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                ++declined;
-            }
-        }
-
-        // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                          assigned));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                          declined));
+        for (SubnetLeaseCounts::const_iterator counts = counts4_.begin();
+             counts != counts4_.end(); ++counts) {
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::STATE_DEFAULT,
+                                          counts->second.assigned_));
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::STATE_DECLINED,
+                                          counts->second.declined_));
         }
 
         // Set the next row position to the beginning of the rows.
@@ -394,27 +821,27 @@ public:
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv4 leases to analyze
-    Lease4Storage& storage4_;
+    /// @brief The numbers of IPv4 leases per subnet to report
+    const SubnetLeaseCounts& counts4_;
 };
 
 
 /// @brief Memfile derivation of the IPv6 statistical lease data query
 ///
 /// This class is used to recalculate IPv6 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  It does so by reading the numbers of leases in each
+/// of the monitored lease states for each subnet, which are maintained
+/// by the backend as the leases are added, updated and deleted.  The
+/// populated result set will contain one entry per monitored state per
+/// subnet.
 ///
 class MemfileLeaseStatsQuery6 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6)
-        : MemfileLeaseStatsQuery(), storage6_(storage6) {
+    /// @param counts6 The numbers of IPv6 leases per subnet.
+    MemfileLeaseStatsQuery6(const SubnetLeaseCounts& counts6)
+        : MemfileLeaseStatsQuery(), counts6_(counts6) {
     };
 
     /// @brief Destructor
@@ -422,91 +849,27 @@ public:
 
     /// @brief Creates the IPv6 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv6 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet. Note that walking the leases by address should
-    /// inherently group them by subnet, and while this does not guarantee
-    /// ascending order of subnet id, it should be sufficient to accumulate
-    /// state counts per subnet.  This avoids introducing an additional
-    /// subnet_id index.
-    /// At the completion of all entries for a given subnet, the counts
-    /// are used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per lease type per subnet.
+    /// The result set is populated by iterating over the subnets in
+    /// ascending order of subnet id, so the cost doesn't depend on the
+    /// number of leases.  The process results in a vector containing one
+    /// entry per state per lease type per subnet.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     virtual void start() {
-        // Get the subnet_id index
-        const Lease6StorageAddressIndex& idx
-            = storage6_.get<AddressIndexTag>();
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        int64_t assigned_pds = 0;
-
-        for(Lease6StorageAddressIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
-
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                  Lease::STATE_DEFAULT,
-                                                  assigned));
-                    assigned = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                  Lease::STATE_DECLINED,
-                                                  declined));
-                    declined = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                                  Lease::STATE_DEFAULT,
-                                                  assigned_pds));
-                    assigned_pds = 0;
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                switch((*lease)->type_) {
-                case Lease::TYPE_NA:
-                    ++assigned;
-                    break;
-                case Lease::TYPE_PD:
-                    ++assigned_pds;
-                    break;
-                default:
-                    break;
-                }
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                // In theory only NAs can be declined
-                if (((*lease)->type_) == Lease::TYPE_NA) {
-                    ++declined;
-                }
-            }
-        }
-
-        // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
+        for (SubnetLeaseCounts::const_iterator counts = counts6_.begin();
+             counts != counts6_.end(); ++counts) {
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::TYPE_NA,
                                           Lease::STATE_DEFAULT,
-                                          assigned));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
+                                          counts->second.assigned_));
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::TYPE_NA,
                                           Lease::STATE_DECLINED,
-                                          declined));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
+                                          counts->second.declined_));
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::TYPE_PD,
                                           Lease::STATE_DEFAULT,
-                                          assigned_pds));
+                                          counts->second.assigned_pds_));
         }
 
         // Set the next row position to the beginning of the rows.
@@ -514,8 +877,8 @@ public:
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv6 leases to analyze
-    Lease6Storage& storage6_;
+    /// @brief The numbers of IPv6 leases per subnet to report
+    const SubnetLeaseCounts& counts6_;
 };
 
 // Explicit definition of class static constants.  Values are given in the
@@ -524,7 +887,8 @@ const int Memfile_LeaseMgr::MAJOR_VERSION;
 const int Memfile_LeaseMgr::MINOR_VERSION;
 
 Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& parameters)
-    : LeaseMgr(), lfc_setup_(), conn_(parameters)
+    : LeaseMgr(), storage_mutex_(new Mutex()), lfc_setup_(),
+      conn_(parameters)
     {
     bool conversion_needed = false;
 
@@ -533,21 +897,47 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
     if (universe == "4") {
         std::string file4 = initLeaseFilePath(V4);
         if (!file4.empty()) {
-            conversion_needed = loadLeasesFromFiles<Lease4,
-                                                 CSVLeaseFile4>(file4,
-                                                                lease_file4_,
-                                                                storage4_);
+            openMappedStore(file4, V4);
+            if (useBinaryFormat()) {
+                conversion_needed =
+                    loadLeasesFromFiles<Lease4, BinaryLeaseFile4,
+                                        CSVLeaseFile4>(file4, binary_file4_,
+                                                       storage4_);
+            } else {
+                conversion_needed =
+                    loadLeasesFromFiles<Lease4, CSVLeaseFile4,
+                                        BinaryLeaseFile4>(file4, lease_file4_,
+                                                          storage4_);
+            }
         }
     } else {
         std::string file6 = initLeaseFilePath(V6);
         if (!file6.empty()) {
-            conversion_needed = loadLeasesFromFiles<Lease6,
-                                                 CSVLeaseFile6>(file6,
-                                                                lease_file6_,
-                                                                storage6_);
+            openMappedStore(file6, V6);
+            if (useBinaryFormat()) {
+                conversion_needed =
+                    loadLeasesFromFiles<Lease6, BinaryLeaseFile6,
+                                        CSVLeaseFile6>(file6, binary_file6_,
+                                                       storage6_);
+            } else {
+                conversion_needed =
+                    loadLeasesFromFiles<Lease6, CSVLeaseFile6,
+                                        BinaryLeaseFile6>(file6, lease_file6_,
+                                                          storage6_);
+            }
         }
     }
 
+    // The numbers of leases are maintained from now on.
+    countLeases(storage4_, lease_counts4_);
+    countLeases(storage6_, lease_counts6_);
+
+    // From now on the store differs from the lease file until it is
+    // synchronized at shutdown.
+    if (store_) {
+        store_->markInUse();
+    }
+
     // If lease persistence have been disabled for both v4 and v6,
     // issue a warning. It is ok not to write leases to disk when
     // doing testing, but it should not be done in normal server
@@ -565,14 +955,38 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
 }
 
 Memfile_LeaseMgr::~Memfile_LeaseMgr() {
+    std::string journal;
     if (lease_file4_) {
+        journal = lease_file4_->getFilename();
         lease_file4_->close();
         lease_file4_.reset();
     }
     if (lease_file6_) {
+        journal = lease_file6_->getFilename();
         lease_file6_->close();
         lease_file6_.reset();
     }
+    if (binary_file4_) {
+        journal = binary_file4_->getFilename();
+        binary_file4_->close();
+        binary_file4_.reset();
+    }
+    if (binary_file6_) {
+        journal = binary_file6_->getFilename();
+        binary_file6_->close();
+        binary_file6_.reset();
+    }
+
+    // The store holds the same leases as the closed lease file: record it
+    // so as the store is used at the next startup.
+    if (store_ && !journal.empty()) {
+        try {
+            store_->sync(journal);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_WRITE_FAIL)
+                .arg(journal + ".store").arg(ex.what());
+        }
+    }
 }
 
 std::string
@@ -597,10 +1011,16 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
     // not be inserted to the memory and the disk and in-memory data will
     // remain consistent.
     if (persistLeases(V4)) {
-        lease_file4_->append(*lease);
+        appendLease(*lease);
     }
 
-    storage4_.insert(lease);
+    Lease4Storage::iterator added;
+    {
+        Mutex::Locker lock(*storage_mutex_);
+        added = storage4_.insert(Lease4Record(*lease)).first;
+    }
+    countLease(lease_counts4_, *added, 1);
+    updateMappedStore(*lease);
     return (true);
 }
 
@@ -618,10 +1038,16 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
     // not be inserted to the memory and the disk and in-memory data will
     // remain consistent.
     if (persistLeases(V6)) {
-        lease_file6_->append(*lease);
+        appendLease(*lease);
     }
 
-    storage6_.insert(lease);
+    Lease6Storage::iterator added;
+    {
+        Mutex::Locker lock(*storage_mutex_);
+        added = storage6_.insert(Lease6Record(*lease)).first;
+    }
+    countLease(lease_counts6_, *added, 1);
+    updateMappedStore(*lease);
     return (true);
 }
 
@@ -630,12 +1056,17 @@ Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
 
+    if (!addr.isV4()) {
+        return (Lease4Ptr());
+    }
+
     const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    Lease4StorageAddressIndex::iterator l = idx.find(addr);
+    Lease4StorageAddressIndex::iterator l =
+        idx.find(Lease4Record::addressKey(addr));
     if (l == idx.end()) {
         return (Lease4Ptr());
     } else {
-        return (Lease4Ptr(new Lease4(**l)));
+        return (l->toLease());
     }
 }
 
@@ -649,8 +1080,11 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr) const {
         lease != idx.end(); ++lease) {
 
         // Every Lease4 has a hardware address, so we can compare it
-        if ( (*(*lease)->hwaddr_) == hwaddr) {
-            collection.push_back((*lease));
+        if (lease->getHWAddrKey() == hwaddr.hwaddr_) {
+            Lease4Ptr lease4 = lease->toLease();
+            if (lease4->hwaddr_ && (*lease4->hwaddr_ == hwaddr)) {
+                collection.push_back(lease4);
+            }
         }
     }
 
@@ -675,7 +1109,7 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
     }
 
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease());
 }
 
 Lease4Collection
@@ -688,9 +1122,9 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id) const {
         lease != idx.end(); ++ lease) {
 
         // client-id is not mandatory in DHCPv4. There can be a lease that does
-        // not have a client-id. Dereferencing null pointer would be a bad thing
-        if((*lease)->client_id_ && *(*lease)->client_id_ == client_id) {
-            collection.push_back((*lease));
+        // not have a client-id, for which the key is empty.
+        if (lease->getClientIdKey() == client_id.getClientId()) {
+            collection.push_back(lease->toLease());
         }
     }
 
@@ -720,7 +1154,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
     }
 
     // Lease was found. Return it to the caller.
-    return (*lease);
+    return (lease->toLease());
 }
 
 Lease4Ptr
@@ -741,7 +1175,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
         return (Lease4Ptr());
     }
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease());
 }
 
 Lease6Ptr
@@ -751,11 +1185,15 @@ Memfile_LeaseMgr::getLease6(Lease::Type type,
               DHCPSRV_MEMFILE_GET_ADDR6)
         .arg(addr.toText())
         .arg(Lease::typeToText(type));
-    Lease6Storage::iterator l = storage6_.find(addr);
-    if (l == storage6_.end() || !(*l) || ((*l)->type_ != type)) {
+    if (!addr.isV6()) {
+        return (Lease6Ptr());
+    }
+
+    Lease6Storage::iterator l = storage6_.find(Lease6Record::addressKey(addr));
+    if (l == storage6_.end() || (l->type_ != type)) {
         return (Lease6Ptr());
     } else {
-        return (Lease6Ptr(new Lease6(**l)));
+        return (l->toLease());
     }
 }
 
@@ -777,7 +1215,7 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
     Lease6Collection collection;
     for(Lease6StorageDuidIaidTypeIndex::const_iterator lease =
             l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(lease->toLease());
     }
 
     return (collection);
@@ -804,8 +1242,8 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
     for(Lease6StorageDuidIaidTypeIndex::const_iterator lease =
             l.first; lease != l.second; ++lease) {
         // Filter out the leases which subnet id doesn't match.
-        if((*lease)->subnet_id_ == subnet_id) {
-            collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        if(lease->subnet_id_ == subnet_id) {
+            collection.push_back(lease->toLease());
         }
     }
 
@@ -833,7 +1271,7 @@ Memfile_LeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
          (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
                                                  max_leases));
          ++lease) {
-        expired_leases.push_back(Lease6Ptr(new Lease6(**lease)));
+        expired_leases.push_back(lease->toLease());
     }
 }
 
@@ -858,7 +1296,7 @@ Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
          (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
                                                  max_leases));
          ++lease) {
-        expired_leases.push_back(Lease4Ptr(new Lease4(**lease)));
+        expired_leases.push_back(lease->toLease());
     }
 }
 
@@ -871,7 +1309,8 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     Lease4StorageAddressIndex& index = storage4_.get<AddressIndexTag>();
 
     // Lease must exist if it is to be updated.
-    Lease4StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+    Lease4StorageAddressIndex::const_iterator lease_it = lease->addr_.isV4() ?
+        index.find(Lease4Record::addressKey(lease->addr_)) : index.end();
     if (lease_it == index.end()) {
         isc_throw(NoSuchLease, "failed to update the lease with address "
                   << lease->addr_ << " - no such lease");
@@ -881,11 +1320,17 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     // not be inserted to the memory and the disk and in-memory data will
     // remain consistent.
     if (persistLeases(V4)) {
-        lease_file4_->append(*lease);
+        appendLease(*lease);
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    countLease(lease_counts4_, *lease_it, -1);
+    {
+        Mutex::Locker lock(*storage_mutex_);
+        index.replace(lease_it, Lease4Record(*lease));
+    }
+    countLease(lease_counts4_, *lease_it, 1);
+    updateMappedStore(*lease);
 }
 
 void
@@ -897,7 +1342,8 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     Lease6StorageAddressIndex& index = storage6_.get<AddressIndexTag>();
 
     // Lease must exist if it is to be updated.
-    Lease6StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+    Lease6StorageAddressIndex::const_iterator lease_it = lease->addr_.isV6() ?
+        index.find(Lease6Record::addressKey(lease->addr_)) : index.end();
     if (lease_it == index.end()) {
         isc_throw(NoSuchLease, "failed to update the lease with address "
                   << lease->addr_ << " - no such lease");
@@ -907,11 +1353,17 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     // not be inserted to the memory and the disk and in-memory data will
     // remain consistent.
     if (persistLeases(V6)) {
-        lease_file6_->append(*lease);
+        appendLease(*lease);
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    countLease(lease_counts6_, *lease_it, -1);
+    {
+        Mutex::Locker lock(*storage_mutex_);
+        index.replace(lease_it, Lease6Record(*lease));
+    }
+    countLease(lease_counts6_, *lease_it, 1);
+    updateMappedStore(*lease);
 }
 
 bool
@@ -920,7 +1372,8 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(addr.toText());
     if (addr.isV4()) {
         // v4 lease
-        Lease4Storage::iterator l = storage4_.find(addr);
+        Lease4Storage::iterator l =
+            storage4_.find(Lease4Record::addressKey(addr));
         if (l == storage4_.end()) {
             // No such lease
             return (false);
@@ -928,19 +1381,25 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
             if (persistLeases(V4)) {
                 // Copy the lease. The valid lifetime needs to be modified and
                 // we don't modify the original lease.
-                Lease4 lease_copy = **l;
+                Lease4 lease_copy = *l->toLease();
                 // Setting valid lifetime to 0 means that lease is being
                 // removed.
                 lease_copy.valid_lft_ = 0;
-                lease_file4_->append(lease_copy);
+                appendLease(lease_copy);
+            }
+            countLease(lease_counts4_, *l, -1);
+            {
+                Mutex::Locker lock(*storage_mutex_);
+                storage4_.erase(l);
             }
-            storage4_.erase(l);
+            removeFromMappedStore(addr);
             return (true);
         }
 
     } else {
         // v6 lease
-        Lease6Storage::iterator l = storage6_.find(addr);
+        Lease6Storage::iterator l =
+            storage6_.find(Lease6Record::addressKey(addr));
         if (l == storage6_.end()) {
             // No such lease
             return (false);
@@ -948,14 +1407,19 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
             if (persistLeases(V6)) {
                 // Copy the lease. The lifetimes need to be modified and we
                 // don't modify the original lease.
-                Lease6 lease_copy = **l;
+                Lease6 lease_copy = *l->toLease();
                 // Setting lifetimes to 0 means that lease is being removed.
                 lease_copy.valid_lft_ = 0;
                 lease_copy.preferred_lft_ = 0;
-                lease_file6_->append(lease_copy);
+                appendLease(lease_copy);
             }
 
-            storage6_.erase(l);
+            countLease(lease_counts6_, *l, -1);
+            {
+                Mutex::Locker lock(*storage_mutex_);
+                storage6_.erase(l);
+            }
+            removeFromMappedStore(addr);
             return (true);
         }
     }
@@ -966,6 +1430,11 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
+    if (binary_file4_) {
+        return (deleteExpiredReclaimedLeases<
+                Lease4StorageExpirationIndex, Lease4
+                >(secs, V4, storage4_, binary_file4_));
+    }
     return (deleteExpiredReclaimedLeases<
             Lease4StorageExpirationIndex, Lease4
             >(secs, V4, storage4_, lease_file4_));
@@ -976,6 +1445,11 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
+    if (binary_file6_) {
+        return (deleteExpiredReclaimedLeases<
+                Lease6StorageExpirationIndex, Lease6
+                >(secs, V6, storage6_, binary_file6_));
+    }
     return (deleteExpiredReclaimedLeases<
             Lease6StorageExpirationIndex, Lease6
             >(secs, V6, storage6_, lease_file6_));
@@ -987,7 +1461,7 @@ uint64_t
 Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
                                                const Universe& universe,
                                                StorageType& storage,
-                                               LeaseFileType& lease_file) const {
+                                               LeaseFileType& lease_file) {
     // Obtain the index which segragates leases by state and time.
     IndexType& index = storage.template get<ExpirationIndexTag>();
 
@@ -1028,24 +1502,103 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
             for (typename IndexType::const_iterator lease = lower_limit;
                  lease != upper_limit; ++lease) {
                 // Copy lease to not affect the lease in the container.
-                LeaseType lease_copy(**lease);
+                LeaseType lease_copy(*lease->toLease());
                 // Set the valid lifetime to 0 to indicate the removal
                 // of the lease.
                 lease_copy.valid_lft_ = 0;
                 lease_file->append(lease_copy);
+                removeFromMappedStore(lease_copy.addr_);
             }
         }
 
-        // Erase leases from memory.
+        // Erase leases from memory. The expired-reclaimed leases are not
+        // counted in the numbers of leases per subnet.
+        Mutex::Locker lock(*storage_mutex_);
         index.erase(lower_limit, upper_limit);
     }
     // Return number of leases deleted.
     return (num_leases);
 }
 
+size_t
+Memfile_LeaseMgr::wipeLeases4(const SubnetID& subnet_id) {
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES4)
+        .arg(subnet_id);
+    size_t num_leases = 0;
+    if (binary_file4_) {
+        num_leases = wipeLeases<Lease4StorageSubnetIdIndex, Lease4
+                                >(subnet_id, V4, storage4_, lease_counts4_,
+                                  binary_file4_);
+    } else {
+        num_leases = wipeLeases<Lease4StorageSubnetIdIndex, Lease4
+                                >(subnet_id, V4, storage4_, lease_counts4_,
+                                  lease_file4_);
+    }
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES4_FINISHED)
+        .arg(subnet_id).arg(num_leases);
+    return (num_leases);
+}
+
+size_t
+Memfile_LeaseMgr::wipeLeases6(const SubnetID& subnet_id) {
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES6)
+        .arg(subnet_id);
+    size_t num_leases = 0;
+    if (binary_file6_) {
+        num_leases = wipeLeases<Lease6StorageSubnetIdIndex, Lease6
+                                >(subnet_id, V6, storage6_, lease_counts6_,
+                                  binary_file6_);
+    } else {
+        num_leases = wipeLeases<Lease6StorageSubnetIdIndex, Lease6
+                                >(subnet_id, V6, storage6_, lease_counts6_,
+                                  lease_file6_);
+    }
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES6_FINISHED)
+        .arg(subnet_id).arg(num_leases);
+    return (num_leases);
+}
+
+template<typename IndexType, typename LeaseType, typename StorageType,
+         typename LeaseFileType>
+size_t
+Memfile_LeaseMgr::wipeLeases(const SubnetID& subnet_id,
+                             const Universe& universe,
+                             StorageType& storage,
+                             SubnetLeaseCounts& counts,
+                             LeaseFileType& lease_file) {
+    // Obtain the index which groups leases by subnet.
+    IndexType& index = storage.template get<SubnetIdIndexTag>();
+    std::pair<typename IndexType::iterator, typename IndexType::iterator>
+        leases = index.equal_range(subnet_id);
+    size_t num_leases = static_cast<size_t>(std::distance(leases.first,
+                                                          leases.second));
+
+    // Mark the leases as deleted in the lease file.
+    if (persistLeases(universe)) {
+        for (typename IndexType::const_iterator lease = leases.first;
+             lease != leases.second; ++lease) {
+            LeaseType lease_copy(*lease->toLease());
+            lease_copy.valid_lft_ = 0;
+            lease_file->append(lease_copy);
+            removeFromMappedStore(lease_copy.addr_);
+        }
+    }
+
+    {
+        Mutex::Locker lock(*storage_mutex_);
+        index.erase(leases.first, leases.second);
+    }
+    counts.erase(subnet_id);
+    return (num_leases);
+}
+
 
 std::string
 Memfile_LeaseMgr::getDescription() const {
+    if (binary_file4_ || binary_file6_) {
+        return (std::string("In memory database with leases stored in a "
+                            "binary file."));
+    }
     return (std::string("In memory database with leases stored in a CSV file."));
 }
 
@@ -1100,9 +1653,15 @@ Memfile_LeaseMgr::getDefaultLeaseFilePath(Universe u) const {
 std::string
 Memfile_LeaseMgr::getLeaseFilePath(Universe u) const {
     if (u == V4) {
+        if (binary_file4_) {
+            return (binary_file4_->getFilename());
+        }
         return (lease_file4_ ? lease_file4_->getFilename() : "");
     }
 
+    if (binary_file6_) {
+        return (binary_file6_->getFilename());
+    }
     return (lease_file6_ ? lease_file6_->getFilename() : "");
 }
 
@@ -1111,11 +1670,11 @@ Memfile_LeaseMgr::persistLeases(Universe u) const {
     // Currently, if the lease file IO is not created, it means that writes to
     // disk have been explicitly disabled by the administrator. At some point,
     // there may be a dedicated ON/OFF flag implemented to control this.
-    if (u == V4 && lease_file4_) {
+    if (u == V4 && (lease_file4_ || binary_file4_)) {
         return (true);
     }
 
-    return (u == V6 && lease_file6_);
+    return (u == V6 && (lease_file6_ || binary_file6_));
 }
 
 std::string
@@ -1147,7 +1706,102 @@ Memfile_LeaseMgr::initLeaseFilePath(Universe u) {
     return (lease_file);
 }
 
-template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+bool
+Memfile_LeaseMgr::useBinaryFormat() const {
+    std::string format_val;
+    try {
+        format_val = conn_.getParameter("file-format");
+    } catch (const Exception&) {
+        // The CSV format is used by default.
+        format_val = "csv";
+    }
+    if (format_val == "csv") {
+        return (false);
+
+    } else if (format_val != "binary") {
+        isc_throw(isc::BadValue, "invalid value 'file-format="
+                  << format_val << "'");
+    }
+    return (true);
+}
+
+void
+Memfile_LeaseMgr::openMappedStore(const std::string& filename, Universe u) {
+    std::string mapped_val;
+    try {
+        mapped_val = conn_.getParameter("mapped-store");
+    } catch (const Exception&) {
+        // The store is disabled by default.
+        mapped_val = "false";
+    }
+    if (mapped_val == "false") {
+        return;
+
+    } else if (mapped_val != "true") {
+        isc_throw(isc::BadValue, "invalid value 'mapped-store="
+                  << mapped_val << "'");
+    }
+
+    try {
+        store_.reset(new MappedLeaseStore(filename + ".store",
+                                          u == V4 ? 4 : 6));
+    } catch (const std::exception& ex) {
+        isc_throw(DbOpenError, "unable to open the mapped lease store for "
+                  << filename << ": " << ex.what());
+    }
+}
+
+template<typename LeaseType>
+void
+Memfile_LeaseMgr::updateMappedStore(const LeaseType& lease) {
+    if (store_) {
+        try {
+            store_->put(lease);
+        } catch (const std::exception& ex) {
+            // The store is left unsynchronized, so as it is rebuilt at the
+            // next startup.
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_WRITE_FAIL)
+                .arg(getLeaseFilePath(lease.addr_.isV4() ? V4 : V6) + ".store")
+                .arg(ex.what());
+            store_.reset();
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::removeFromMappedStore(const isc::asiolink::IOAddress& addr) {
+    if (store_) {
+        try {
+            store_->remove(addr);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_WRITE_FAIL)
+                .arg(getLeaseFilePath(addr.isV4() ? V4 : V6) + ".store")
+                .arg(ex.what());
+            store_.reset();
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::appendLease(const Lease4& lease) {
+    if (binary_file4_) {
+        binary_file4_->append(lease);
+    } else {
+        lease_file4_->append(lease);
+    }
+}
+
+void
+Memfile_LeaseMgr::appendLease(const Lease6& lease) {
+    if (binary_file6_) {
+        binary_file6_->append(lease);
+    } else {
+        lease_file6_->append(lease);
+    }
+}
+
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename OtherFileType, typename StorageType>
 bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
                                            boost::shared_ptr<LeaseFileType>& lease_file,
                                            StorageType& storage) {
@@ -1163,31 +1817,49 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
                   "lease file cleanup is in progress");
     }
 
+    // Likewise, the files are not loaded while the in-process cleanup of
+    // the instance being replaced is in progress. That cleanup has been
+    // cancelled when the instance was destroyed, so this only waits until
+    // it has noticed the cancellation or completed the rotation of the
+    // files.
+    Mutex::Locker lock(getCleanupMutex());
+
     storage.clear();
 
+    // Reading the leases from the mapped store is much faster than parsing
+    // the lease files, but it is only possible when the store holds the
+    // leases of the lease file.
+    const bool has_format = hasFormat(filename,
+                                      static_cast<LeaseFileType*>(0));
+    if (store_ && has_format && store_->isReusable(filename)) {
+        try {
+            store_->load(storage);
+            lease_file.reset(new LeaseFileType(filename));
+            lease_file->open(true);
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_LOAD)
+                .arg(storage.size()).arg(filename + ".store");
+            return (lease_file->needsConversion());
+
+        } catch (const std::exception& ex) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_LOAD_FAIL)
+                .arg(filename + ".store").arg(ex.what());
+            storage.clear();
+        }
+    }
+
     // Load the leasefile.completed, if exists.
     bool conversion_needed = false;
-    lease_file.reset(new LeaseFileType(std::string(filename + ".completed")));
-    if (lease_file->exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                               MAX_LEASE_ERRORS);
-        conversion_needed = conversion_needed || lease_file->needsConversion();
+    if (LeaseFileType(appendSuffix(filename, FILE_FINISH)).exists()) {
+        conversion_needed = loadLeaseFile<LeaseObjectType, LeaseFileType,
+            OtherFileType>(appendSuffix(filename, FILE_FINISH), storage);
     } else {
         // If the leasefile.completed doesn't exist, let's load the leases
         // from leasefile.2 and leasefile.1, if they exist.
-        lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_PREVIOUS)));
-        if (lease_file->exists()) {
-            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   MAX_LEASE_ERRORS);
-            conversion_needed =  conversion_needed || lease_file->needsConversion();
-        }
-
-        lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_INPUT)));
-        if (lease_file->exists()) {
-            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   MAX_LEASE_ERRORS);
-            conversion_needed =  conversion_needed || lease_file->needsConversion();
-        }
+        conversion_needed = loadLeaseFile<LeaseObjectType, LeaseFileType,
+            OtherFileType>(appendSuffix(filename, FILE_PREVIOUS), storage);
+        conversion_needed = loadLeaseFile<LeaseObjectType, LeaseFileType,
+            OtherFileType>(appendSuffix(filename, FILE_INPUT), storage) ||
+            conversion_needed;
     }
 
     // Always load leases from the primary lease file. If the lease file
@@ -1197,9 +1869,52 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
     // it is parsed. This file will be used by the backend to record
     // future lease updates.
     lease_file.reset(new LeaseFileType(filename));
-    LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                           MAX_LEASE_ERRORS, false);
-    conversion_needed =  conversion_needed || lease_file->needsConversion();
+    if (has_format || !lease_file->exists()) {
+        LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
+                                               MAX_LEASE_ERRORS, false);
+        conversion_needed =  conversion_needed || lease_file->needsConversion();
+
+    } else {
+        // The lease file is in the other format. All leases read so far are
+        // written in the configured format to the leasefile.completed,
+        // which takes precedence over the leasefile.2 and leasefile.1, and
+        // the lease file is recreated.
+        OtherFileType other_file(filename);
+        LeaseFileLoader::load<LeaseObjectType>(other_file, storage,
+                                               MAX_LEASE_ERRORS);
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_CONVERT_FORMAT)
+            .arg(filename).arg(useBinaryFormat() ? "binary" : "csv");
+
+        const std::string output = appendSuffix(filename, FILE_OUTPUT);
+        const std::string finish = appendSuffix(filename, FILE_FINISH);
+        LeaseFileType output_file(output);
+        LeaseFileLoader::write<LeaseObjectType>(output_file, storage);
+        if ((rename(output.c_str(), finish.c_str()) != 0) ||
+            (remove(filename.c_str()) != 0)) {
+            isc_throw(DbOpenError, "unable to convert the lease file "
+                      << filename << ": " << strerror(errno));
+        }
+        lease_file->open(true);
+    }
+
+    // Rebuild the store from the leases which have been read.
+    if (store_) {
+        try {
+            store_->clear();
+            for (typename StorageType::const_iterator lease = storage.begin();
+                 lease != storage.end(); ++lease) {
+                store_->put(*lease->toLease());
+            }
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_REBUILD)
+                .arg(filename + ".store").arg(storage.size());
+
+        } catch (const std::exception& ex) {
+            // The server can run without the store.
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_STORE_WRITE_FAIL)
+                .arg(filename + ".store").arg(ex.what());
+            store_.reset();
+        }
+    }
 
     return (conversion_needed);
 }
@@ -1221,10 +1936,16 @@ Memfile_LeaseMgr::lfcCallback() {
 
     // Check if we're in the v4 or v6 space and use the appropriate file.
     if (lease_file4_) {
-        lfcExecute(lease_file4_);
+        lfcExecute<Lease4>(lease_file4_, storage4_);
+
+    } else if (binary_file4_) {
+        lfcExecute<Lease4>(binary_file4_, storage4_);
 
     } else if (lease_file6_) {
-        lfcExecute(lease_file6_);
+        lfcExecute<Lease6>(lease_file6_, storage6_);
+
+    } else if (binary_file6_) {
+        lfcExecute<Lease6>(binary_file6_, storage6_);
     }
 }
 
@@ -1245,16 +1966,63 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
                   << lfc_interval_str << " specified");
     }
 
+    const bool in_process = useInProcessLFC();
+
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(boost::bind(&Memfile_LeaseMgr::lfcCallback, this)));
-        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed);
+        const Universe u = persistLeases(V4) ? V4 : V6;
+        lfc_setup_->setup(lfc_interval, getLeaseFilePath(u), u,
+                          conversion_needed, in_process);
+    }
+}
+
+bool
+Memfile_LeaseMgr::useInProcessLFC() const {
+    std::string mode_val;
+    try {
+        mode_val = conn_.getParameter("lfc-mode");
+    } catch (const Exception&) {
+        // The kea-lfc is used by default.
+        mode_val = "external";
     }
+    if (mode_val == "external") {
+        return (false);
+
+    } else if (mode_val != "in-process") {
+        isc_throw(isc::BadValue, "invalid value 'lfc-mode="
+                  << mode_val << "'");
+    }
+    return (true);
 }
 
-template<typename LeaseFileType>
-void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file) {
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename StorageType>
+void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file,
+                                  const StorageType& storage) {
     bool do_lfc = true;
 
+    const bool in_process = lfc_setup_->isInProcess();
+    if (in_process) {
+        // Unlike the kea-lfc, which exits when another instance is
+        // running, the thread doesn't check the state of the files.
+        if (lfc_setup_->isRunning()) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_COMPACT_BUSY)
+                .arg(lease_file->getFilename());
+            return;
+        }
+
+        // Complete an interrupted cleanup, so as the finish file doesn't
+        // prevent the rotation of the current file.
+        try {
+            rotateFinishFile(lease_file->getFilename());
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_COMPACT_FAIL)
+                .arg(ex.what());
+            return;
+        }
+    }
+
     // Check the status of the LFC instance.
     // If the finish file exists or the copy of the lease file exists it
     // is an indication that another LFC instance may be in progress or
@@ -1306,21 +2074,31 @@ void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file)
     }
     // Once the files have been rotated, or untouched if another LFC had
     // not finished, a new process is started.
-    if (do_lfc) {
+    if (do_lfc && !in_process) {
         lfc_setup_->execute();
+
+    } else if (do_lfc) {
+        // The leases in memory are those of the previous, copy and current
+        // files: the new current file only receives the later updates.
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_COMPACT_START)
+            .arg(lease_file->getFilename()).arg(storage.size());
+        lfc_setup_->executeInProcess(lease_file->getFilename(), storage_mutex_,
+            boost::bind(&compactLeaseFile<LeaseObjectType, LeaseFileType,
+                                          StorageType>,
+                        _1, lease_file->getFilename(), boost::cref(storage)));
     }
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(lease_counts4_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(lease_counts6_));
     query->start();
     return(query);
 }
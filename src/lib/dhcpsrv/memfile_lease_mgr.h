@@ -9,12 +9,15 @@
 
 #include <asiolink/interval_timer.h>
 #include <dhcp/hwaddr.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/csv_lease_file4.h>
 #include <dhcpsrv/csv_lease_file6.h>
 #include <dhcpsrv/memfile_lease_storage.h>
+#include <dhcpsrv/memfile_mapped_store.h>
 #include <dhcpsrv/database_connection.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <util/process_spawn.h>
+#include <util/threads/sync.h>
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
@@ -73,6 +76,32 @@ class LFCSetup;
 /// is not specified, the default location in the installation
 /// directory is used: var/kea/kea-leases4.csv and
 /// var/kea/kea-leases6.csv.
+///
+/// Reading a large lease file slows down the startup of the server. The
+/// "mapped-store=true" parameter enables a @c MappedLeaseStore, held in
+/// the file [path].store, to which all lease updates are also written.
+/// When the server has been shut down cleanly and the lease file hasn't
+/// been modified since then, the leases are read from this store at the
+/// next startup rather than parsed from the lease files. Otherwise the
+/// lease files are read as usual and the store is rebuilt from them.
+///
+/// The "file-format=binary" parameter selects the binary lease file format
+/// (see @c BinaryLeaseFile4 and @c BinaryLeaseFile6) rather than the
+/// default "csv" one. The format of each lease file is detected when it is
+/// read, so the files written in the other format are still loaded. If the
+/// current lease file is in the other format, its leases are written with
+/// the leases read from the other files to the <filename>.completed file in
+/// the configured format and a new lease file is created.
+///
+/// The "lfc-mode=in-process" parameter causes the cleanup to be performed
+/// by a thread of the server process rather than by the @c kea-lfc (the
+/// default "external" mode). The current lease file is moved to the copy
+/// file as usual and the leases held in memory, which are those of the
+/// previous, copy and current files, are written by the thread to the
+/// finish file, which then replaces the previous and copy files. This
+/// avoids parsing the lease files again and spawning a process. The
+/// cleanup is cancelled when the backend is destroyed and its outcome is
+/// logged by the main thread.
 class Memfile_LeaseMgr : public LeaseMgr {
 public:
 
@@ -332,8 +361,57 @@ public:
     /// @return Number of leases deleted.
     virtual uint64_t deleteExpiredReclaimedLeases6(const uint32_t secs);
 
+    /// @brief Deletes all DHCPv4 leases of a subnet.
+    ///
+    /// The leases are found using the subnet identifier index and are
+    /// marked as deleted in the lease file.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    ///
+    /// @return Number of leases deleted.
+    virtual size_t wipeLeases4(const SubnetID& subnet_id);
+
+    /// @brief Deletes all DHCPv6 leases of a subnet.
+    ///
+    /// The leases are found using the subnet identifier index and are
+    /// marked as deleted in the lease file.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    ///
+    /// @return Number of leases deleted.
+    virtual size_t wipeLeases6(const SubnetID& subnet_id);
+
 private:
 
+    /// @brief Deletes all leases of a subnet.
+    ///
+    /// This private method is called by both of the public methods:
+    /// @c wipeLeases4 and @c wipeLeases6.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param universe V4 or V6.
+    /// @param storage Reference to the container where leases are held.
+    /// @param counts Numbers of leases per subnet held in the container.
+    /// @param lease_file Reference to a DHCPv4 or DHCPv6 lease file
+    /// instance, in the CSV or binary format, where leases should be
+    /// marked as deleted.
+    ///
+    /// @return Number of leases deleted.
+    ///
+    /// @tparam IndexType Index type to be used to search for the leases
+    /// of the subnet, i.e. @c Lease4StorageSubnetIdIndex or
+    /// @c Lease6StorageSubnetIdIndex.
+    /// @tparam LeaseType Lease type, i.e. @c Lease4 or @c Lease6.
+    /// @tparam StorageType Type of storage where leases are held, i.e.
+    /// @c Lease4Storage or @c Lease6Storage.
+    /// @tparam LeaseFileType Type of the lease file, i.e. DHCPv4 or
+    /// DHCPv6 lease file type.
+    template<typename IndexType, typename LeaseType, typename StorageType,
+             typename LeaseFileType>
+    size_t wipeLeases(const SubnetID& subnet_id, const Universe& universe,
+                      StorageType& storage, SubnetLeaseCounts& counts,
+                      LeaseFileType& lease_file);
+
     /// @brief Deletes all expired-reclaimed leases.
     ///
     /// This private method is called by both of the public methods:
@@ -348,7 +426,8 @@ private:
     /// @param storage Reference to the container where leases are held.
     /// Some expired-reclaimed leases will be removed from this container.
     /// @param lease_file Reference to a DHCPv4 or DHCPv6 lease file
-    /// instance where leases should be marked as deleted.
+    /// instance, in the CSV or binary format, where leases should be
+    /// marked as deleted.
     ///
     /// @return Number of leases deleted.
     ///
@@ -365,7 +444,7 @@ private:
     uint64_t deleteExpiredReclaimedLeases(const uint32_t secs,
                                           const Universe& universe,
                                           StorageType& storage,
-                                          LeaseFileType& lease_file) const;
+                                          LeaseFileType& lease_file);
 
 public:
 
@@ -506,6 +585,22 @@ private:
     /// argument to this function.
     std::string initLeaseFilePath(Universe u);
 
+    /// @brief Checks if the binary lease file format is configured.
+    ///
+    /// The format is selected by the "file-format" parameter.
+    ///
+    /// @return true if the format is "binary", false if it is "csv".
+    /// @throw BadValue if the value of the parameter is invalid.
+    bool useBinaryFormat() const;
+
+    /// @brief Checks if the lease file cleanup is performed in-process.
+    ///
+    /// The mode is selected by the "lfc-mode" parameter.
+    ///
+    /// @return true if the mode is "in-process", false if it is "external".
+    /// @throw BadValue if the value of the parameter is invalid.
+    bool useInProcessLFC() const;
+
     /// @brief Load leases from the persistent storage.
     ///
     /// This method loads DHCPv4 or DHCPv6 leases from lease files in the
@@ -522,6 +617,11 @@ private:
     /// leases from the subsequent file. If the <filename> doesn't exist
     /// it is created.
     ///
+    /// Each file is read in the format it has been written in. If the
+    /// <filename> isn't in the format of the @c LeaseFileType, all leases
+    /// read are written to the <filename>.completed file in this format
+    /// and the <filename> is recreated.
+    ///
     /// When the method successfully reads leases from the files, it leaves
     /// the file <filename> open and its internal pointer is set to the
     /// end of file. The server will append lease entries to this file as
@@ -541,7 +641,11 @@ private:
     /// is an LFC in progress, it throws an exception which will result
     /// in the server refuse to start or reconfigure. When the administrator
     /// retries starting up or reconfiguring the server it will most likely
-    /// be successful as the LFC should be complete by that time.
+    /// be successful as the LFC should be complete by that time. The
+    /// in-process cleanup of the instance being replaced during the
+    /// reconfiguration is cancelled instead and the files are loaded once
+    /// it has stopped, which takes at most the time to write a batch of
+    /// leases or to rotate the files.
     ///
     /// @todo Consider implementing delaying the lease files loading when
     /// the LFC is in progress by the specified amount of time.
@@ -551,32 +655,94 @@ private:
     /// the server will store lease updates.
     /// @param storage A storage for leases read from the lease file.
     /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
-    /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam LeaseFileType Type of the lease file in the configured
+    /// format, e.g. @c CSVLeaseFile4 or @c BinaryLeaseFile4.
+    /// @tparam OtherFileType Type of the lease file in the other format.
     /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
     ///
     /// @return Returns true if any of the files loaded need conversion from
     /// an older or newer schema.
     ///
     /// @throw CSVFileError when parsing any of the lease files fails.
-    /// @throw DbOpenError when it is found that the LFC is in progress.
+    /// @throw DbOpenError when it is found that the LFC is in progress or
+    /// the lease file can't be converted to the configured format.
     template<typename LeaseObjectType, typename LeaseFileType,
-             typename StorageType>
+             typename OtherFileType, typename StorageType>
     bool loadLeasesFromFiles(const std::string& filename,
                              boost::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
 
+    /// @brief Opens the mapped lease store if it is enabled.
+    ///
+    /// The mapped lease store is enabled by the "mapped-store" parameter.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param u Universe (v4 or v6)
+    ///
+    /// @throw BadValue if the value of the parameter is invalid.
+    /// @throw DbOpenError if the store can't be opened.
+    void openMappedStore(const std::string& filename, Universe u);
+
+    /// @brief Writes a lease to the mapped lease store, if it is enabled.
+    ///
+    /// If the write fails, the store is no longer used.
+    ///
+    /// @param lease Lease which has been added or updated.
+    /// @tparam LeaseType @c Lease4 or @c Lease6.
+    template<typename LeaseType>
+    void updateMappedStore(const LeaseType& lease);
+
+    /// @brief Removes a lease from the mapped lease store, if it is enabled.
+    ///
+    /// @param addr Address of the lease which has been deleted.
+    void removeFromMappedStore(const asiolink::IOAddress& addr);
+
+    /// @brief Appends a DHCPv4 lease to the lease file.
+    ///
+    /// @param lease Lease to be written.
+    void appendLease(const Lease4& lease);
+
+    /// @brief Appends a DHCPv6 lease to the lease file.
+    ///
+    /// @param lease Lease to be written.
+    void appendLease(const Lease6& lease);
+
     /// @brief stores IPv4 leases
     Lease4Storage storage4_;
 
     /// @brief stores IPv6 leases
     Lease6Storage storage6_;
 
+    /// @brief Protects the storages against the in-process lease file
+    /// cleanup, which reads them in a thread.
+    ///
+    /// It is held when the leases are inserted, replaced or erased, and
+    /// shared with the cleanup, which may outlive the backend.
+    boost::shared_ptr<util::thread::Mutex> storage_mutex_;
+
+    /// @brief Numbers of IPv4 leases per subnet, reported by the lease
+    /// statistics queries.
+    SubnetLeaseCounts lease_counts4_;
+
+    /// @brief Numbers of IPv6 leases per subnet, reported by the lease
+    /// statistics queries.
+    SubnetLeaseCounts lease_counts6_;
+
     /// @brief Holds the pointer to the DHCPv4 lease file IO.
     boost::shared_ptr<CSVLeaseFile4> lease_file4_;
 
     /// @brief Holds the pointer to the DHCPv6 lease file IO.
     boost::shared_ptr<CSVLeaseFile6> lease_file6_;
 
+    /// @brief Holds the pointer to the DHCPv4 binary lease file IO.
+    boost::shared_ptr<BinaryLeaseFile4> binary_file4_;
+
+    /// @brief Holds the pointer to the DHCPv6 binary lease file IO.
+    boost::shared_ptr<BinaryLeaseFile6> binary_file6_;
+
+    /// @brief Mapped lease store, null when it is not enabled.
+    boost::scoped_ptr<MappedLeaseStore> store_;
+
 public:
 
     /// @name Public methods to retrieve information about the LFC process state.
@@ -650,7 +816,8 @@ private:
     /// the unit tests need to override this path (with the path in the
     /// Kea build directory, the @c KEA_LFC_EXECUTABLE environmental
     /// variable should be set to hold an absolute path to the kea-lfc
-    /// executable.
+    /// executable. If the "lfc-mode" parameter is "in-process", the cleanup
+    /// is performed by a thread and the kea-lfc isn't used.
     /// @param conversion_needed flag that indicates input lease file(s) are
     /// schema do not match the current schema (older or newer), and need
     /// conversion. This value is passed through to LFCSetup::setup() via its
@@ -675,12 +842,25 @@ private:
     /// any lease entries. If the file has been successfully moved, it runs
     /// the @c kea-lfc application.
     ///
+    /// When the cleanup is performed in-process, the method first completes
+    /// the cleanup interrupted after the %Lease File Finish was written, if
+    /// any, and it does nothing while the previous cleanup is in progress.
+    /// Rather than running the @c kea-lfc, it starts a thread writing the
+    /// leases held in memory to the new %Lease File Finish. The thread
+    /// reads the storage in batches, with the @c storage_mutex_ held.
+    ///
     /// @param lease_file A pointer to the object representing the Current
     /// %Lease File (DHCPv4 or DHCPv6 lease file).
+    /// @param storage The leases held in memory.
     ///
-    /// @tparam LeaseFileType One of @c CSVLeaseFile4 or @c CSVLeaseFile6.
-    template<typename LeaseFileType>
-    void lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file);
+    /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType One of @c CSVLeaseFile4, @c CSVLeaseFile6,
+    /// @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+    /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    void lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file,
+                    const StorageType& storage);
 
     /// @brief A pointer to the Lease File Cleanup configuration.
     boost::scoped_ptr<LFCSetup> lfc_setup_;
@@ -0,0 +1,318 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/address_value.h>
+#include <dhcp/duid.h>
+#include <dhcpsrv/memfile_lease_record.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+
+#include <boost/unordered_map.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace isc::asiolink;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace dhcp {
+
+bool
+BinaryKey::operator<(const BinaryKey& other) const {
+    return (std::lexicographical_compare(data_, data_ + size_, other.data_,
+                                         other.data_ + other.size_));
+}
+
+bool
+BinaryKey::operator==(const BinaryKey& other) const {
+    return ((size_ == other.size_) &&
+            ((size_ == 0) || (memcmp(data_, other.data_, size_) == 0)));
+}
+
+InlineIdentifier::InlineIdentifier(const uint8_t* data, const size_t size)
+    : size_(0) {
+    if (size > MAX_SIZE) {
+        isc_throw(BadValue, "identifier too large to be stored in a lease"
+                  " record: " << size << " bytes");
+    }
+    assign(data, size);
+}
+
+InlineIdentifier::InlineIdentifier(const InlineIdentifier& other)
+    : size_(0) {
+    assign(other.getData(), other.size_);
+}
+
+InlineIdentifier::~InlineIdentifier() {
+    release();
+}
+
+InlineIdentifier&
+InlineIdentifier::operator=(const InlineIdentifier& other) {
+    if (this != &other) {
+        release();
+        assign(other.getData(), other.size_);
+    }
+    return (*this);
+}
+
+const uint8_t*
+InlineIdentifier::getData() const {
+    if (size_ <= INLINE_SIZE) {
+        return (data_);
+    }
+    // The pointer may be unaligned in the array, so it is copied out.
+    uint8_t* heap;
+    memcpy(&heap, data_, sizeof(heap));
+    return (heap);
+}
+
+std::vector<uint8_t>
+InlineIdentifier::toVector() const {
+    const uint8_t* data = getData();
+    return (std::vector<uint8_t>(data, data + size_));
+}
+
+void
+InlineIdentifier::assign(const uint8_t* data, const size_t size) {
+    if (size <= INLINE_SIZE) {
+        if (size > 0) {
+            memcpy(data_, data, size);
+        }
+    } else {
+        uint8_t* heap = new uint8_t[size];
+        memcpy(heap, data, size);
+        memcpy(data_, &heap, sizeof(heap));
+    }
+    size_ = static_cast<uint8_t>(size);
+}
+
+void
+InlineIdentifier::release() {
+    if (size_ > INLINE_SIZE) {
+        delete[] getData();
+    }
+    size_ = 0;
+}
+
+namespace {
+
+/// @brief Pool of the interned strings.
+///
+/// The pool is never destroyed, so as the lease records held in static
+/// objects can be safely destroyed at exit.
+struct InternedStringPool {
+    /// @brief Type of the container holding the strings.
+    typedef boost::unordered_map<std::string, std::atomic<size_t> > Map;
+
+    /// @brief Protects the container and the release of the last
+    /// reference to a string.
+    Mutex mutex_;
+
+    /// @brief Strings with their reference counts.
+    Map map_;
+};
+
+/// @brief Returns the pool of the interned strings.
+InternedStringPool&
+getPool() {
+    static InternedStringPool* pool = new InternedStringPool();
+    return (*pool);
+}
+
+/// @brief Increments the reference count of a string.
+///
+/// The string is held by the caller, so its count can't drop to 0
+/// meanwhile and the pool doesn't have to be locked.
+///
+/// @param entry pooled string, may be null
+void
+acquire(InternedString::Entry* entry) {
+    if (entry) {
+        entry->second.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/// @brief Decrements the reference count of a string and removes it from
+/// the pool when it is no longer used.
+///
+/// Only the release of what may be the last reference locks the pool, so
+/// as the string can't be found by the constructor while it is removed.
+///
+/// @param entry pooled string, may be null
+void
+release(InternedString::Entry* entry) {
+    if (!entry) {
+        return;
+    }
+    size_t count = entry->second.load(std::memory_order_relaxed);
+    while (count > 1) {
+        if (entry->second.compare_exchange_weak(count, count - 1,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+            return;
+        }
+    }
+    InternedStringPool& pool = getPool();
+    Mutex::Locker lock(pool.mutex_);
+    if (entry->second.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        pool.map_.erase(entry->first);
+    }
+}
+
+}
+
+InternedString::InternedString(const std::string& str)
+    : entry_(0) {
+    if (!str.empty()) {
+        InternedStringPool& pool = getPool();
+        Mutex::Locker lock(pool.mutex_);
+        entry_ = &*pool.map_.emplace(str, 0).first;
+        entry_->second.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+InternedString::InternedString(const InternedString& other)
+    : entry_(other.entry_) {
+    acquire(entry_);
+}
+
+InternedString::~InternedString() {
+    release(entry_);
+}
+
+InternedString&
+InternedString::operator=(const InternedString& other) {
+    if (entry_ != other.entry_) {
+        acquire(other.entry_);
+        release(entry_);
+        entry_ = other.entry_;
+    }
+    return (*this);
+}
+
+const std::string&
+InternedString::get() const {
+    if (!entry_) {
+        static const std::string empty;
+        return (empty);
+    }
+    return (entry_->first);
+}
+
+size_t
+InternedString::getPoolSize() {
+    InternedStringPool& pool = getPool();
+    Mutex::Locker lock(pool.mutex_);
+    return (pool.map_.size());
+}
+
+LeaseRecord::LeaseRecord(const Lease& lease)
+    : subnet_id_(lease.subnet_id_), state_(lease.state_), t1_(lease.t1_),
+      t2_(lease.t2_), valid_lft_(lease.valid_lft_), hwaddr_source_(0),
+      cltt_(lease.cltt_), hostname_(lease.hostname_), htype_(0),
+      hwaddr_len_(0), flags_(0) {
+    if (lease.fqdn_fwd_) {
+        flags_ |= FLAG_FQDN_FWD;
+    }
+    if (lease.fqdn_rev_) {
+        flags_ |= FLAG_FQDN_REV;
+    }
+    if (lease.hwaddr_) {
+        const std::vector<uint8_t>& hwaddr = lease.hwaddr_->hwaddr_;
+        if (hwaddr.size() > HWAddr::MAX_HWADDR_LEN) {
+            isc_throw(BadValue, "HW address too large to be stored in a lease"
+                      " record: " << hwaddr.size() << " bytes");
+        }
+        if (!hwaddr.empty()) {
+            memcpy(hwaddr_, &hwaddr[0], hwaddr.size());
+        }
+        hwaddr_len_ = static_cast<uint8_t>(hwaddr.size());
+        htype_ = lease.hwaddr_->htype_;
+        hwaddr_source_ = lease.hwaddr_->source_;
+        flags_ |= FLAG_HWADDR;
+    }
+}
+
+void
+LeaseRecord::toLease(Lease& lease) const {
+    lease.t1_ = t1_;
+    lease.t2_ = t2_;
+    lease.valid_lft_ = valid_lft_;
+    lease.cltt_ = static_cast<time_t>(cltt_);
+    lease.subnet_id_ = subnet_id_;
+    lease.hostname_ = hostname_.get();
+    lease.fqdn_fwd_ = ((flags_ & FLAG_FQDN_FWD) != 0);
+    lease.fqdn_rev_ = ((flags_ & FLAG_FQDN_REV) != 0);
+    lease.state_ = state_;
+    if (flags_ & FLAG_HWADDR) {
+        lease.hwaddr_.reset(new HWAddr(hwaddr_, hwaddr_len_, htype_));
+        lease.hwaddr_->source_ = hwaddr_source_;
+    } else {
+        lease.hwaddr_.reset();
+    }
+}
+
+Lease4Record::Lease4Record(const Lease4& lease)
+    : LeaseRecord(lease), addr_(addressKey(lease.addr_)), client_id_() {
+    if (lease.client_id_) {
+        const std::vector<uint8_t>& client_id = lease.client_id_->getClientId();
+        client_id_ = InlineIdentifier(&client_id[0], client_id.size());
+    }
+}
+
+Lease4Ptr
+Lease4Record::toLease() const {
+    Lease4Ptr lease(new Lease4());
+    lease->addr_ = IOAddress(addr_);
+    LeaseRecord::toLease(*lease);
+    if (!client_id_.empty()) {
+        lease->client_id_.reset(new ClientId(client_id_.getData(),
+                                             client_id_.getSize()));
+    }
+    return (lease);
+}
+
+Lease6Record::Lease6Record(const Lease6& lease)
+    : LeaseRecord(lease), addr_(addressKey(lease.addr_)), iaid_(lease.iaid_),
+      type_(lease.type_), preferred_lft_(lease.preferred_lft_),
+      prefixlen_(lease.prefixlen_), duid_() {
+    if (lease.duid_) {
+        const std::vector<uint8_t>& duid = lease.duid_->getDuid();
+        duid_ = InlineIdentifier(&duid[0], duid.size());
+    }
+}
+
+Lease6Ptr
+Lease6Record::toLease() const {
+    Lease6Ptr lease(new Lease6());
+    lease->addr_ = AddressValue::fromBytes(AF_INET6, &addr_[0]).toIOAddress();
+    LeaseRecord::toLease(*lease);
+    lease->type_ = type_;
+    lease->prefixlen_ = prefixlen_;
+    lease->iaid_ = iaid_;
+    lease->preferred_lft_ = preferred_lft_;
+    if (!duid_.empty()) {
+        lease->duid_.reset(new DUID(duid_.getData(), duid_.getSize()));
+    }
+    return (lease);
+}
+
+Lease6Record::Address
+Lease6Record::addressKey(const IOAddress& addr) {
+    if (!addr.isV6()) {
+        isc_throw(BadValue, "address " << addr << " is not an IPv6 address");
+    }
+    Address key;
+    AddressValue(addr).toBytes(&key[0]);
+    return (key);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,391 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMFILE_LEASE_RECORD_H
+#define MEMFILE_LEASE_RECORD_H
+
+#include <asiolink/io_address.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/subnet_id.h>
+
+#include <boost/array.hpp>
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Non-owning view of a binary identifier.
+///
+/// It is returned by the key extractors of the lease records for the
+/// HW address, client identifier and DUID. It is implicitly constructed
+/// from a vector, so as the indexes can be searched using the vectors
+/// held in @c HWAddr and @c DUID objects. The views are ordered like
+/// the vectors they are created from.
+class BinaryKey {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param data pointer to the identifier
+    /// @param size size of the identifier
+    BinaryKey(const uint8_t* data, const size_t size)
+        : data_(data), size_(size) {
+    }
+
+    /// @brief Constructor from a vector.
+    ///
+    /// @param vec vector holding the identifier. It must outlive the view.
+    BinaryKey(const std::vector<uint8_t>& vec)
+        : data_(vec.empty() ? 0 : &vec[0]), size_(vec.size()) {
+    }
+
+    /// @brief Returns pointer to the identifier.
+    const uint8_t* getData() const {
+        return (data_);
+    }
+
+    /// @brief Returns size of the identifier.
+    size_t getSize() const {
+        return (size_);
+    }
+
+    /// @brief Compares two identifiers lexicographically.
+    ///
+    /// @param other identifier to compare to
+    bool operator<(const BinaryKey& other) const;
+
+    /// @brief Compares two identifiers for equality.
+    ///
+    /// @param other identifier to compare to
+    bool operator==(const BinaryKey& other) const;
+
+private:
+    /// @brief Pointer to the identifier.
+    const uint8_t* data_;
+
+    /// @brief Size of the identifier.
+    size_t size_;
+};
+
+/// @brief Binary identifier stored inline when it is small.
+///
+/// Client identifiers and DUIDs are most of the time shorter than 16
+/// bytes (e.g. a client identifier made of the HW address, a DUID-LL or
+/// a DUID-LLT). They are held in the object itself, without additional
+/// memory allocation. Longer identifiers are copied to the heap.
+class InlineIdentifier {
+public:
+
+    /// @brief Maximum size of an identifier stored inline.
+    static const size_t INLINE_SIZE = 15;
+
+    /// @brief Maximum size of an identifier.
+    static const size_t MAX_SIZE = 255;
+
+    /// @brief Constructor of an empty identifier.
+    InlineIdentifier() : size_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param data pointer to the identifier
+    /// @param size size of the identifier
+    ///
+    /// @throw BadValue if the identifier is longer than @c MAX_SIZE.
+    InlineIdentifier(const uint8_t* data, const size_t size);
+
+    /// @brief Copy constructor.
+    ///
+    /// @param other identifier to copy
+    InlineIdentifier(const InlineIdentifier& other);
+
+    /// @brief Destructor.
+    ~InlineIdentifier();
+
+    /// @brief Assignment operator.
+    ///
+    /// @param other identifier to copy
+    InlineIdentifier& operator=(const InlineIdentifier& other);
+
+    /// @brief Returns pointer to the identifier.
+    const uint8_t* getData() const;
+
+    /// @brief Returns size of the identifier.
+    size_t getSize() const {
+        return (size_);
+    }
+
+    /// @brief Checks if the identifier is empty.
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns the view of the identifier used as an index key.
+    BinaryKey getKey() const {
+        return (BinaryKey(getData(), size_));
+    }
+
+    /// @brief Returns a copy of the identifier as a vector.
+    std::vector<uint8_t> toVector() const;
+
+private:
+
+    /// @brief Copies an identifier into this object.
+    ///
+    /// @param data pointer to the identifier
+    /// @param size size of the identifier
+    void assign(const uint8_t* data, const size_t size);
+
+    /// @brief Releases the heap storage, if any.
+    void release();
+
+    /// @brief Size of the identifier.
+    uint8_t size_;
+
+    /// @brief Identifier, or the pointer to the heap storage when it is
+    /// longer than @c INLINE_SIZE.
+    uint8_t data_[INLINE_SIZE];
+};
+
+/// @brief String shared by all the lease records holding the same value.
+///
+/// Many leases share the same hostname (or have none), so the hostnames
+/// are interned in a process wide pool and the records only hold a
+/// pointer to the pooled string. The strings are reference counted and
+/// removed from the pool when the last record using them is destroyed.
+/// An empty string doesn't use the pool.
+///
+/// The reference counts are atomic: copying a string, e.g. to take a
+/// snapshot of the leases, or destroying a copy while other copies remain
+/// doesn't lock the pool. The pool is only locked to add a string and to
+/// release its last reference.
+class InternedString {
+public:
+
+    /// @brief Constructor of an empty string.
+    InternedString() : entry_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param str string to be interned
+    explicit InternedString(const std::string& str);
+
+    /// @brief Copy constructor.
+    ///
+    /// @param other string to copy
+    InternedString(const InternedString& other);
+
+    /// @brief Destructor.
+    ~InternedString();
+
+    /// @brief Assignment operator.
+    ///
+    /// @param other string to copy
+    InternedString& operator=(const InternedString& other);
+
+    /// @brief Returns the string.
+    const std::string& get() const;
+
+    /// @brief Returns the number of distinct strings in the pool.
+    static size_t getPoolSize();
+
+    /// @brief Pooled string with its reference count.
+    typedef std::pair<const std::string, std::atomic<size_t> > Entry;
+
+private:
+
+    /// @brief Pointer to the pooled string, null for an empty string.
+    Entry* entry_;
+};
+
+/// @brief Compact representation of the data common to the DHCPv4 and
+/// DHCPv6 leases held by the Memfile backend.
+///
+/// The Memfile backend holds its leases in memory. In large deployments
+/// the size of the lease objects dominates the memory used by the server:
+/// a @c Lease4 holds an @c IOAddress and pointers to the separately
+/// allocated HW address and client identifier. The lease records hold the
+/// same data in fixed width fields: the HW address is stored inline, the
+/// client identifier or DUID is stored inline when it is small and the
+/// hostname is interned.
+///
+/// The lease objects are only created at the @c LeaseMgr API boundary,
+/// when a lease is returned to the caller.
+class LeaseRecord {
+public:
+
+    /// @brief Checks if the lease is in the "expired-reclaimed" state.
+    bool stateExpiredReclaimed() const {
+        return (state_ == Lease::STATE_EXPIRED_RECLAIMED);
+    }
+
+    /// @brief Returns the lease expiration time.
+    int64_t getExpirationTime() const {
+        return (cltt_ + valid_lft_);
+    }
+
+    /// @brief Returns the view of the HW address used as an index key.
+    ///
+    /// The key is empty when the lease has no HW address.
+    BinaryKey getHWAddrKey() const {
+        return (BinaryKey(hwaddr_, hwaddr_len_));
+    }
+
+    /// @brief Subnet identifier.
+    SubnetID subnet_id_;
+
+    /// @brief Lease state.
+    uint32_t state_;
+
+protected:
+
+    /// @brief Constructor.
+    ///
+    /// @param lease lease to be represented
+    explicit LeaseRecord(const Lease& lease);
+
+    /// @brief Copies the common data into a lease object.
+    ///
+    /// @param [out] lease lease object to be filled
+    void toLease(Lease& lease) const;
+
+    /// @brief Flag set when the lease has a HW address.
+    static const uint8_t FLAG_HWADDR = 0x01;
+
+    /// @brief Flag set when forward DNS update is performed for the lease.
+    static const uint8_t FLAG_FQDN_FWD = 0x02;
+
+    /// @brief Flag set when reverse DNS update is performed for the lease.
+    static const uint8_t FLAG_FQDN_REV = 0x04;
+
+    /// @brief Renewal time.
+    uint32_t t1_;
+
+    /// @brief Rebinding time.
+    uint32_t t2_;
+
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+
+    /// @brief Source of the HW address.
+    uint32_t hwaddr_source_;
+
+    /// @brief Client last transmission time.
+    int64_t cltt_;
+
+    /// @brief Hostname.
+    InternedString hostname_;
+
+    /// @brief Hardware type.
+    uint16_t htype_;
+
+    /// @brief Length of the HW address.
+    uint8_t hwaddr_len_;
+
+    /// @brief Combination of the FLAG_* values.
+    uint8_t flags_;
+
+    /// @brief HW address.
+    uint8_t hwaddr_[HWAddr::MAX_HWADDR_LEN];
+};
+
+/// @brief Compact representation of a DHCPv4 lease.
+class Lease4Record : public LeaseRecord {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param lease lease to be represented
+    explicit Lease4Record(const Lease4& lease);
+
+    /// @brief Creates a lease object holding the data of the record.
+    Lease4Ptr toLease() const;
+
+    /// @brief Returns the key of an address in the address index.
+    ///
+    /// @param addr IPv4 address
+    /// @throw BadValue if the address is not an IPv4 address.
+    static uint32_t addressKey(const asiolink::IOAddress& addr) {
+        return (addr.toUint32());
+    }
+
+    /// @brief Returns the view of the client identifier used as an index
+    /// key.
+    ///
+    /// The key is empty when the lease has no client identifier.
+    BinaryKey getClientIdKey() const {
+        return (client_id_.getKey());
+    }
+
+    /// @brief IPv4 address in host byte order.
+    uint32_t addr_;
+
+private:
+
+    /// @brief Client identifier, empty if the lease has none.
+    InlineIdentifier client_id_;
+};
+
+/// @brief Compact representation of a DHCPv6 lease.
+class Lease6Record : public LeaseRecord {
+public:
+
+    /// @brief Type of the IPv6 address held in the record.
+    typedef boost::array<uint8_t, 16> Address;
+
+    /// @brief Constructor.
+    ///
+    /// @param lease lease to be represented
+    explicit Lease6Record(const Lease6& lease);
+
+    /// @brief Creates a lease object holding the data of the record.
+    Lease6Ptr toLease() const;
+
+    /// @brief Returns the key of an address in the address index.
+    ///
+    /// @param addr IPv6 address
+    /// @throw BadValue if the address is not an IPv6 address.
+    static Address addressKey(const asiolink::IOAddress& addr);
+
+    /// @brief Returns the view of the DUID used as an index key.
+    ///
+    /// The key is empty when the lease has no DUID.
+    BinaryKey getDuidKey() const {
+        return (duid_.getKey());
+    }
+
+    /// @brief IPv6 address or prefix in network byte order.
+    Address addr_;
+
+    /// @brief IAID.
+    uint32_t iaid_;
+
+    /// @brief Lease type.
+    Lease::Type type_;
+
+private:
+
+    /// @brief Preferred lifetime.
+    uint32_t preferred_lft_;
+
+    /// @brief Prefix length.
+    uint8_t prefixlen_;
+
+    /// @brief DUID, empty if the lease has none.
+    InlineIdentifier duid_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // MEMFILE_LEASE_RECORD_H
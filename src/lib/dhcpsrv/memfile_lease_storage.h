@@ -9,6 +9,7 @@
 
 #include <asiolink/io_address.h>
 #include <dhcpsrv/lease.h>
+#include <dhcpsrv/memfile_lease_record.h>
 #include <dhcpsrv/subnet_id.h>
 
 #include <boost/multi_index/indexed_by.hpp>
@@ -18,6 +19,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/composite_key.hpp>
 
+#include <map>
 #include <vector>
 
 namespace isc {
@@ -42,31 +44,39 @@ struct ClientIdSubnetIdIndexTag { };
 /// @brief Tag for indexes by client id, HW address and subnet id.
 struct ClientIdHWAddressSubnetIdIndexTag { };
 
+/// @brief Tag for indexes by subnet identifier.
+struct SubnetIdIndexTag { };
+
 /// @name Multi index containers holding DHCPv4 and DHCPv6 leases.
 ///
 //@{
 
 /// @brief A multi index container holding DHCPv6 leases.
 ///
+/// The leases are held as @c Lease6Record objects, which are converted
+/// to @c Lease6 objects when they are returned by the lease manager.
+///
 /// The leases in the container may be accessed using different indexes:
 /// - using an IPv6 address,
 /// - using a composite index: DUID, IAID and lease type.
 /// - using a composite index: boolean flag indicating if the state is
 ///   "expired-reclaimed" and expiration time.
+/// - using a subnet identifier.
 ///
-/// Indexes can be accessed using the index number (from 0 to 2) or a
+/// Indexes can be accessed using the index number (from 0 to 3) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
 typedef boost::multi_index_container<
-    // It holds pointers to Lease6 objects.
-    Lease6Ptr,
+    // It holds compact records of the DHCPv6 leases.
+    Lease6Record,
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
         // This index sorts leases by IPv6 addresses represented as
-        // IOAddress objects.
+        // arrays of bytes, which are ordered like the IOAddress objects.
         boost::multi_index::ordered_unique<
             boost::multi_index::tag<AddressIndexTag>,
-            boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
+            boost::multi_index::member<Lease6Record, Lease6Record::Address,
+                                       &Lease6Record::addr_>
         >,
 
         // Specification of the second index starts here.
@@ -75,15 +85,18 @@ typedef boost::multi_index_container<
             // This is a composite index that will be used to search for
             // the lease using three attributes: DUID, IAID and lease type.
             boost::multi_index::composite_key<
-                Lease6,
-                // The DUID can be retrieved from the Lease6 object using
-                // a getDuidVector const function.
-                boost::multi_index::const_mem_fun<Lease6, const std::vector<uint8_t>&,
-                                                  &Lease6::getDuidVector>,
+                Lease6Record,
+                // The DUID can be retrieved from the record using a
+                // getDuidKey const function. The key can be compared with
+                // the vector held in a DUID object.
+                boost::multi_index::const_mem_fun<Lease6Record, BinaryKey,
+                                                  &Lease6Record::getDuidKey>,
                 // The two other ingredients of this index are IAID and
                 // lease type.
-                boost::multi_index::member<Lease6, uint32_t, &Lease6::iaid_>,
-                boost::multi_index::member<Lease6, Lease::Type, &Lease6::type_>
+                boost::multi_index::member<Lease6Record, uint32_t,
+                                           &Lease6Record::iaid_>,
+                boost::multi_index::member<Lease6Record, Lease::Type,
+                                           &Lease6Record::type_>
             >
         >,
 
@@ -95,20 +108,31 @@ typedef boost::multi_index_container<
             // of the search key, the reclaimed or not reclaimed leases will can
             // be searched.
             boost::multi_index::composite_key<
-                Lease6,
+                Lease6Record,
                 // The boolean value specifying if lease is reclaimed or not.
-                boost::multi_index::const_mem_fun<Lease, bool,
-                                                  &Lease::stateExpiredReclaimed>,
+                boost::multi_index::const_mem_fun<LeaseRecord, bool,
+                                                  &LeaseRecord::stateExpiredReclaimed>,
                 // Lease expiration time.
-                boost::multi_index::const_mem_fun<Lease, int64_t,
-                                                  &Lease::getExpirationTime>
+                boost::multi_index::const_mem_fun<LeaseRecord, int64_t,
+                                                  &LeaseRecord::getExpirationTime>
             >
+        >,
+
+        // Specification of the fourth index starts here.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<SubnetIdIndexTag>,
+            // This index is used to search for the leases of a subnet.
+            boost::multi_index::member<LeaseRecord, SubnetID,
+                                       &LeaseRecord::subnet_id_>
         >
      >
 > Lease6Storage; // Specify the type name of this container.
 
 /// @brief A multi index container holding DHCPv4 leases.
 ///
+/// The leases are held as @c Lease4Record objects, which are converted
+/// to @c Lease4 objects when they are returned by the lease manager.
+///
 /// The leases in the container may be accessed using different indexes:
 /// - IPv6 address,
 /// - composite index: HW address and subnet id,
@@ -116,43 +140,44 @@ typedef boost::multi_index_container<
 /// - composite index: HW address, client id and subnet id
 /// - using a composite index: boolean flag indicating if the state is
 ///   "expired-reclaimed" and expiration time.
+/// - using a subnet identifier.
 ///
-/// Indexes can be accessed using the index number (from 0 to 4) or a
+/// Indexes can be accessed using the index number (from 0 to 5) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
 typedef boost::multi_index_container<
-    // It holds pointers to Lease4 objects.
-    Lease4Ptr,
+    // It holds compact records of the DHCPv4 leases.
+    Lease4Record,
     // Specification of search indexes starts here.
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
         // This index sorts leases by IPv4 addresses represented as
-        // IOAddress objects.
+        // integers in host byte order.
         boost::multi_index::ordered_unique<
             boost::multi_index::tag<AddressIndexTag>,
-            // The IPv4 address are held in addr_ members that belong to
-            // Lease class.
-            boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
+            // The IPv4 address are held in addr_ members of the records.
+            boost::multi_index::member<Lease4Record, uint32_t,
+                                       &Lease4Record::addr_>
         >,
 
         // Specification of the second index starts here.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
             // This is a composite index that combines two attributes of the
-            // Lease4 object: hardware address and subnet id.
+            // lease: hardware address and subnet id.
             boost::multi_index::composite_key<
-                Lease4,
-                // The hardware address is held in the hwaddr_ member of the
-                // Lease4 object, which is a HWAddr object. Boost does not
-                // provide a key extractor for getting a member of a member,
-                // so we need a simple method for that.
-                boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
-                                                  &Lease::getHWAddrVector>,
-                // The subnet id is held in the subnet_id_ member of Lease4
-                // class. Note that the subnet_id_ is defined in the base
-                // class (Lease) so we have to point to this class rather
-                // than derived class: Lease4.
-                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
+                Lease4Record,
+                // The hardware address is held inline in the record. The
+                // key returned by getHWAddrKey can be compared with the
+                // vector held in a HWAddr object.
+                boost::multi_index::const_mem_fun<LeaseRecord, BinaryKey,
+                                                  &LeaseRecord::getHWAddrKey>,
+                // The subnet id is held in the subnet_id_ member. Note that
+                // the subnet_id_ is defined in the base class (LeaseRecord)
+                // so we have to point to this class rather than derived
+                // class: Lease4Record.
+                boost::multi_index::member<LeaseRecord, SubnetID,
+                                           &LeaseRecord::subnet_id_>
             >
         >,
 
@@ -162,13 +187,14 @@ typedef boost::multi_index_container<
             // This is a composite index that uses two values to search for a
             // lease: client id and subnet id.
             boost::multi_index::composite_key<
-                Lease4,
-                // The client id can be retrieved from the Lease4 object by
-                // calling getClientIdVector const function.
-                boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
-                                                  &Lease4::getClientIdVector>,
+                Lease4Record,
+                // The client id can be retrieved from the record by
+                // calling getClientIdKey const function.
+                boost::multi_index::const_mem_fun<Lease4Record, BinaryKey,
+                                                  &Lease4Record::getClientIdKey>,
                 // The subnet id is accessed through the subnet_id_ member.
-                boost::multi_index::member<Lease, uint32_t, &Lease::subnet_id_>
+                boost::multi_index::member<LeaseRecord, SubnetID,
+                                           &LeaseRecord::subnet_id_>
             >
         >,
 
@@ -178,19 +204,18 @@ typedef boost::multi_index_container<
             // This is a composite index that uses three values to search for a
             // lease: client id, HW address and subnet id.
             boost::multi_index::composite_key<
-                Lease4,
-                // The client id can be retrieved from the Lease4 object by
-                // calling getClientIdVector const function.
-                boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
-                                                  &Lease4::getClientIdVector>,
-                // The hardware address is held in the hwaddr_ object. We can
-                // access the raw data using lease->hwaddr_->hwaddr_, but Boost
-                // doesn't seem to provide a way to use member of a member for this,
-                // so we need a simple key extractor method (getHWAddrVector).
-                boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
-                                                  &Lease::getHWAddrVector>,
+                Lease4Record,
+                // The client id can be retrieved from the record by
+                // calling getClientIdKey const function.
+                boost::multi_index::const_mem_fun<Lease4Record, BinaryKey,
+                                                  &Lease4Record::getClientIdKey>,
+                // The hardware address is held inline in the record and
+                // retrieved by calling getHWAddrKey const function.
+                boost::multi_index::const_mem_fun<LeaseRecord, BinaryKey,
+                                                  &LeaseRecord::getHWAddrKey>,
                 // The subnet id is accessed through the subnet_id_ member.
-                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
+                boost::multi_index::member<LeaseRecord, SubnetID,
+                                           &LeaseRecord::subnet_id_>
             >
         >,
 
@@ -202,14 +227,22 @@ typedef boost::multi_index_container<
             // of the search key, the reclaimed or not reclaimed leases will can
             // be searched.
             boost::multi_index::composite_key<
-                Lease4,
+                Lease4Record,
                 // The boolean value specifying if lease is reclaimed or not.
-                boost::multi_index::const_mem_fun<Lease, bool,
-                                                  &Lease::stateExpiredReclaimed>,
+                boost::multi_index::const_mem_fun<LeaseRecord, bool,
+                                                  &LeaseRecord::stateExpiredReclaimed>,
                 // Lease expiration time.
-                boost::multi_index::const_mem_fun<Lease, int64_t,
-                                                  &Lease::getExpirationTime>
+                boost::multi_index::const_mem_fun<LeaseRecord, int64_t,
+                                                  &LeaseRecord::getExpirationTime>
             >
+        >,
+
+        // Specification of the sixth index starts here.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<SubnetIdIndexTag>,
+            // This index is used to search for the leases of a subnet.
+            boost::multi_index::member<LeaseRecord, SubnetID,
+                                       &LeaseRecord::subnet_id_>
         >
     >
 > Lease4Storage; // Specify the type name for this container.
@@ -229,12 +262,18 @@ typedef Lease6Storage::index<DuidIaidTypeIndexTag>::type Lease6StorageDuidIaidTy
 /// @brief DHCPv6 lease storage index by expiration time.
 typedef Lease6Storage::index<ExpirationIndexTag>::type Lease6StorageExpirationIndex;
 
+/// @brief DHCPv6 lease storage index by subnet identifier.
+typedef Lease6Storage::index<SubnetIdIndexTag>::type Lease6StorageSubnetIdIndex;
+
 /// @brief DHCPv4 lease storage index by address.
 typedef Lease4Storage::index<AddressIndexTag>::type Lease4StorageAddressIndex;
 
 /// @brief DHCPv4 lease storage index by expiration time.
 typedef Lease4Storage::index<ExpirationIndexTag>::type Lease4StorageExpirationIndex;
 
+/// @brief DHCPv4 lease storage index by subnet identifier.
+typedef Lease4Storage::index<SubnetIdIndexTag>::type Lease4StorageSubnetIdIndex;
+
 /// @brief DHCPv4 lease storage index by HW address and subnet identifier.
 typedef Lease4Storage::index<HWAddressSubnetIdIndexTag>::type
 Lease4StorageHWAddressSubnetIdIndex;
@@ -248,6 +287,32 @@ typedef Lease4Storage::index<ClientIdHWAddressSubnetIdIndexTag>::type
 Lease4StorageClientIdHWAddressSubnetIdIndex;
 
 //@}
+
+/// @brief Numbers of leases of a subnet in the states reported by the
+/// lease statistics.
+///
+/// The Memfile backend maintains these numbers as the leases are added,
+/// updated and deleted, so as the statistics are recounted without
+/// iterating over the leases.
+struct LeaseStateCounts {
+    /// @brief Constructor.
+    LeaseStateCounts()
+        : assigned_(0), declined_(0), assigned_pds_(0) {
+    }
+
+    /// @brief Number of addresses in the default state.
+    int64_t assigned_;
+
+    /// @brief Number of declined addresses.
+    int64_t declined_;
+
+    /// @brief Number of prefixes in the default state (DHCPv6 only).
+    int64_t assigned_pds_;
+};
+
+/// @brief Numbers of leases in the counted states by subnet identifier.
+typedef std::map<SubnetID, LeaseStateCounts> SubnetLeaseCounts;
+
 } // end of isc::dhcp namespace
 } // end of isc namespace
 
@@ -0,0 +1,499 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/address_value.h>
+#include <dhcpsrv/memfile_mapped_store.h>
+#include <exceptions/exceptions.h>
+#include <util/buffer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <sys/stat.h>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Value of an empty bucket.
+const uint64_t BUCKET_EMPTY = 0;
+
+/// @brief Value of a bucket whose lease has been removed.
+const uint64_t BUCKET_DELETED = 1;
+
+/// @brief Minimal number of buckets.
+const uint64_t MIN_BUCKETS = 1024;
+
+/// @brief Lease holds a hardware address.
+const uint8_t FLAG_HWADDR = 0x01;
+
+/// @brief Forward DNS update has been performed for the lease.
+const uint8_t FLAG_FQDN_FWD = 0x02;
+
+/// @brief Reverse DNS update has been performed for the lease.
+const uint8_t FLAG_FQDN_REV = 0x04;
+
+/// @brief Returns the identity of a file.
+///
+/// @param filename name of the file
+/// @param [out] identity size, modification time and inode of the file
+/// @return false if the file doesn't exist.
+bool
+getFileIdentity(const std::string& filename, uint64_t* identity) {
+    struct stat st;
+    if (stat(filename.c_str(), &st) != 0) {
+        return (false);
+    }
+    identity[0] = static_cast<uint64_t>(st.st_size);
+    identity[1] = static_cast<uint64_t>(st.st_mtime);
+    identity[2] = static_cast<uint64_t>(st.st_ino);
+    return (true);
+}
+
+/// @brief Returns the hash of a lease address.
+///
+/// @param key lease address
+uint64_t
+hashKey(const uint8_t* key) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (int i = 0; i < 16; ++i) {
+        hash = (hash ^ key[i]) * 1099511628211ULL;
+    }
+    return (hash);
+}
+
+/// @brief Writes a variable length field with its length.
+///
+/// @param data field
+/// @param size length of the field
+/// @param [out] out buffer
+void
+writeField(const uint8_t* data, const size_t size, OutputBuffer& out) {
+    if (size > 0xffff) {
+        isc_throw(isc::BadValue, "lease field too large to be stored: "
+                  << size << " bytes");
+    }
+    out.writeUint16(static_cast<uint16_t>(size));
+    if (size > 0) {
+        out.writeData(data, size);
+    }
+}
+
+/// @brief Reads a variable length field with its length.
+///
+/// @param in buffer
+/// @param [out] data field
+void
+readField(InputBuffer& in, std::vector<uint8_t>& data) {
+    const uint16_t size = in.readUint16();
+    in.readVector(data, size);
+}
+
+/// @brief Serializes the fields common to the IPv4 and IPv6 leases.
+///
+/// @param lease lease
+/// @param [out] out buffer
+void
+writeLease(const isc::dhcp::Lease& lease, OutputBuffer& out) {
+    out.writeUint32(lease.subnet_id_);
+    out.writeUint32(lease.state_);
+    out.writeUint32(lease.t1_);
+    out.writeUint32(lease.t2_);
+    out.writeUint32(lease.valid_lft_);
+    const uint64_t cltt = static_cast<uint64_t>(lease.cltt_);
+    out.writeUint32(static_cast<uint32_t>(cltt >> 32));
+    out.writeUint32(static_cast<uint32_t>(cltt));
+    uint8_t flags = 0;
+    if (lease.hwaddr_) {
+        flags |= FLAG_HWADDR;
+    }
+    if (lease.fqdn_fwd_) {
+        flags |= FLAG_FQDN_FWD;
+    }
+    if (lease.fqdn_rev_) {
+        flags |= FLAG_FQDN_REV;
+    }
+    out.writeUint8(flags);
+    if (lease.hwaddr_) {
+        const std::vector<uint8_t>& hwaddr = lease.hwaddr_->hwaddr_;
+        out.writeUint16(lease.hwaddr_->htype_);
+        out.writeUint32(lease.hwaddr_->source_);
+        writeField(hwaddr.empty() ? NULL : &hwaddr[0], hwaddr.size(), out);
+    }
+    writeField(reinterpret_cast<const uint8_t*>(lease.hostname_.data()),
+               lease.hostname_.size(), out);
+}
+
+/// @brief Deserializes the fields common to the IPv4 and IPv6 leases.
+///
+/// @param in buffer
+/// @param [out] lease lease
+void
+readLease(InputBuffer& in, isc::dhcp::Lease& lease) {
+    lease.subnet_id_ = in.readUint32();
+    lease.state_ = in.readUint32();
+    lease.t1_ = in.readUint32();
+    lease.t2_ = in.readUint32();
+    lease.valid_lft_ = in.readUint32();
+    uint64_t cltt = static_cast<uint64_t>(in.readUint32()) << 32;
+    cltt |= in.readUint32();
+    lease.cltt_ = static_cast<time_t>(static_cast<int64_t>(cltt));
+    const uint8_t flags = in.readUint8();
+    lease.fqdn_fwd_ = ((flags & FLAG_FQDN_FWD) != 0);
+    lease.fqdn_rev_ = ((flags & FLAG_FQDN_REV) != 0);
+    std::vector<uint8_t> data;
+    if (flags & FLAG_HWADDR) {
+        const uint16_t htype = in.readUint16();
+        const uint32_t source = in.readUint32();
+        readField(in, data);
+        lease.hwaddr_.reset(new isc::dhcp::HWAddr(data, htype));
+        lease.hwaddr_->source_ = source;
+    }
+    readField(in, data);
+    lease.hostname_.assign(data.begin(), data.end());
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const char* MappedLeaseStore::STORE_NAME = "lease-store";
+const uint32_t MappedLeaseStore::STORE_VERSION;
+
+/// @brief Header of the store.
+struct MappedLeaseStore::StoreHeader {
+    /// @brief Version of the store format.
+    uint32_t version_;
+
+    /// @brief Universe of the leases.
+    uint32_t universe_;
+
+    /// @brief Non zero when the store is synchronized with the lease file.
+    uint32_t synced_;
+
+    /// @brief Unused.
+    uint32_t reserved_;
+
+    /// @brief Identity of the lease file when the store was synchronized.
+    uint64_t journal_[3];
+
+    /// @brief Number of leases.
+    uint64_t count_;
+
+    /// @brief Number of buckets holding a lease or a removed lease.
+    uint64_t used_;
+
+    /// @brief Number of buckets (a power of two).
+    uint64_t bucket_count_;
+
+    /// @brief Offset of the buckets.
+    uint64_t buckets_;
+};
+
+/// @brief Entry of the hash table.
+struct MappedLeaseStore::Bucket {
+    /// @brief Address of the lease.
+    Key key_;
+
+    /// @brief Offset of the serialized lease, @c BUCKET_EMPTY or
+    /// @c BUCKET_DELETED.
+    uint64_t lease_;
+};
+
+MappedLeaseStore::MappedLeaseStore(const std::string& filename,
+                                   const uint32_t universe)
+    : segment_(new MemorySegmentMapped(filename)), universe_(universe) {
+    const StoreHeader* header = getHeader();
+    if (!header || (header->version_ != STORE_VERSION) ||
+        (header->universe_ != universe_)) {
+        clear();
+    }
+}
+
+bool
+MappedLeaseStore::isReusable(const std::string& journal) const {
+    const StoreHeader* header = getHeader();
+    uint64_t identity[3];
+    return ((header->synced_ != 0) && getFileIdentity(journal, identity) &&
+            std::equal(identity, identity + 3, header->journal_));
+}
+
+void
+MappedLeaseStore::clear() {
+    // Starting from an empty file is faster than releasing the leases.
+    const std::string filename = segment_->getFileName();
+    segment_.reset();
+    segment_.reset(new MemorySegmentMapped(filename,
+                                           MemorySegmentMapped::CREATE_ONLY));
+    init();
+}
+
+void
+MappedLeaseStore::markInUse() {
+    getHeader()->synced_ = 0;
+    segment_->flush();
+}
+
+void
+MappedLeaseStore::sync(const std::string& journal) {
+    StoreHeader* header = getHeader();
+    if (getFileIdentity(journal, header->journal_)) {
+        header->synced_ = 1;
+    }
+    segment_->flush();
+}
+
+void
+MappedLeaseStore::put(const Lease4& lease) {
+    Key key = { 0 };
+    AddressValue(lease.addr_).toBytes(key);
+    OutputBuffer out(128);
+    writeLease(lease, out);
+    if (lease.client_id_) {
+        const std::vector<uint8_t>& client_id = lease.client_id_->getClientId();
+        writeField(&client_id[0], client_id.size(), out);
+    } else {
+        writeField(NULL, 0, out);
+    }
+    put(key, out.getData(), out.getLength());
+}
+
+void
+MappedLeaseStore::put(const Lease6& lease) {
+    Key key = { 0 };
+    AddressValue(lease.addr_).toBytes(key);
+    OutputBuffer out(128);
+    writeLease(lease, out);
+    out.writeUint8(static_cast<uint8_t>(lease.type_));
+    out.writeUint8(lease.prefixlen_);
+    out.writeUint32(lease.iaid_);
+    out.writeUint32(lease.preferred_lft_);
+    if (lease.duid_) {
+        const std::vector<uint8_t>& duid = lease.duid_->getDuid();
+        writeField(&duid[0], duid.size(), out);
+    } else {
+        writeField(NULL, 0, out);
+    }
+    put(key, out.getData(), out.getLength());
+}
+
+bool
+MappedLeaseStore::remove(const IOAddress& addr) {
+    StoreHeader* header = getHeader();
+    if (header->bucket_count_ == 0) {
+        return (false);
+    }
+
+    Key key = { 0 };
+    AddressValue(addr).toBytes(key);
+    Bucket* buckets = getBuckets();
+    const uint64_t mask = header->bucket_count_ - 1;
+    for (uint64_t i = hashKey(key) & mask; ; i = (i + 1) & mask) {
+        Bucket& bucket = buckets[i];
+        if (bucket.lease_ == BUCKET_EMPTY) {
+            return (false);
+
+        } else if ((bucket.lease_ != BUCKET_DELETED) &&
+                   (memcmp(bucket.key_, key, sizeof(key)) == 0)) {
+            release(bucket.lease_);
+            bucket.lease_ = BUCKET_DELETED;
+            --header->count_;
+            return (true);
+        }
+    }
+}
+
+uint64_t
+MappedLeaseStore::size() const {
+    return (getHeader()->count_);
+}
+
+void
+MappedLeaseStore::load(Lease4Storage& storage) const {
+    const StoreHeader* header = getHeader();
+    const Bucket* buckets = getBuckets();
+    std::vector<uint8_t> data;
+    for (uint64_t i = 0; i < header->bucket_count_; ++i) {
+        if (buckets[i].lease_ <= BUCKET_DELETED) {
+            continue;
+        }
+        const uint8_t* blob =
+            static_cast<const uint8_t*>(segment_->getAddress(buckets[i].lease_));
+        uint32_t length;
+        memcpy(&length, blob, sizeof(length));
+        InputBuffer in(blob + sizeof(length), length);
+
+        Lease4 lease;
+        lease.addr_ = AddressValue::fromBytes(AF_INET,
+                                              buckets[i].key_).toIOAddress();
+        readLease(in, lease);
+        readField(in, data);
+        if (!data.empty()) {
+            lease.client_id_.reset(new ClientId(data));
+        }
+        storage.insert(Lease4Record(lease));
+    }
+}
+
+void
+MappedLeaseStore::load(Lease6Storage& storage) const {
+    const StoreHeader* header = getHeader();
+    const Bucket* buckets = getBuckets();
+    std::vector<uint8_t> data;
+    for (uint64_t i = 0; i < header->bucket_count_; ++i) {
+        if (buckets[i].lease_ <= BUCKET_DELETED) {
+            continue;
+        }
+        const uint8_t* blob =
+            static_cast<const uint8_t*>(segment_->getAddress(buckets[i].lease_));
+        uint32_t length;
+        memcpy(&length, blob, sizeof(length));
+        InputBuffer in(blob + sizeof(length), length);
+
+        Lease6 lease;
+        lease.addr_ = AddressValue::fromBytes(AF_INET6,
+                                              buckets[i].key_).toIOAddress();
+        readLease(in, lease);
+        lease.type_ = static_cast<Lease::Type>(in.readUint8());
+        lease.prefixlen_ = in.readUint8();
+        lease.iaid_ = in.readUint32();
+        lease.preferred_lft_ = in.readUint32();
+        readField(in, data);
+        if (!data.empty()) {
+            lease.duid_.reset(new DUID(data));
+        }
+        storage.insert(Lease6Record(lease));
+    }
+}
+
+void
+MappedLeaseStore::init() {
+    const uint64_t offset = allocate(sizeof(StoreHeader));
+    StoreHeader* header = static_cast<StoreHeader*>(segment_->getAddress(offset));
+    memset(header, 0, sizeof(StoreHeader));
+    header->version_ = STORE_VERSION;
+    header->universe_ = universe_;
+    segment_->setNamedAddress(STORE_NAME, header);
+}
+
+uint64_t
+MappedLeaseStore::allocate(const size_t size) {
+    for (;;) {
+        try {
+            return (segment_->getOffset(segment_->allocate(size)));
+        } catch (const MemorySegmentGrown&) {
+            // The segment has been mapped again: retry.
+        }
+    }
+}
+
+void
+MappedLeaseStore::put(const Key& key, const void* data, const size_t length) {
+    // The blocks are allocated first, as the addresses in the segment
+    // change when it grows.
+    const uint64_t offset = allocate(sizeof(uint32_t) + length);
+    if ((getHeader()->used_ + 1) * 2 > getHeader()->bucket_count_) {
+        rehash();
+    }
+
+    uint8_t* blob = static_cast<uint8_t*>(segment_->getAddress(offset));
+    const uint32_t blob_length = static_cast<uint32_t>(length);
+    memcpy(blob, &blob_length, sizeof(blob_length));
+    memcpy(blob + sizeof(blob_length), data, length);
+
+    // Replace the existing lease, or use the first removed or empty
+    // bucket of the probe sequence.
+    StoreHeader* header = getHeader();
+    Bucket* buckets = getBuckets();
+    const uint64_t mask = header->bucket_count_ - 1;
+    Bucket* target = NULL;
+    for (uint64_t i = hashKey(key) & mask; ; i = (i + 1) & mask) {
+        Bucket& bucket = buckets[i];
+        if (bucket.lease_ == BUCKET_EMPTY) {
+            if (!target) {
+                target = &bucket;
+                ++header->used_;
+            }
+            break;
+
+        } else if (bucket.lease_ == BUCKET_DELETED) {
+            if (!target) {
+                target = &bucket;
+            }
+
+        } else if (memcmp(bucket.key_, key, sizeof(Key)) == 0) {
+            release(bucket.lease_);
+            bucket.lease_ = offset;
+            return;
+        }
+    }
+    memcpy(target->key_, key, sizeof(Key));
+    target->lease_ = offset;
+    ++header->count_;
+}
+
+void
+MappedLeaseStore::rehash() {
+    // Grow the table unless there are mostly removed leases.
+    const StoreHeader* header = getHeader();
+    uint64_t bucket_count = std::max(MIN_BUCKETS, header->bucket_count_);
+    if ((header->count_ + 1) * 4 > bucket_count) {
+        bucket_count *= 2;
+    }
+    const size_t size = bucket_count * sizeof(Bucket);
+    const uint64_t offset = allocate(size);
+
+    // Fetch the addresses after the allocation.
+    StoreHeader* new_header = getHeader();
+    Bucket* buckets = static_cast<Bucket*>(segment_->getAddress(offset));
+    memset(buckets, 0, size);
+    const uint64_t mask = bucket_count - 1;
+    if (new_header->bucket_count_ > 0) {
+        const Bucket* old_buckets = getBuckets();
+        for (uint64_t i = 0; i < new_header->bucket_count_; ++i) {
+            if (old_buckets[i].lease_ <= BUCKET_DELETED) {
+                continue;
+            }
+            uint64_t j = hashKey(old_buckets[i].key_) & mask;
+            while (buckets[j].lease_ != BUCKET_EMPTY) {
+                j = (j + 1) & mask;
+            }
+            buckets[j] = old_buckets[i];
+        }
+        segment_->deallocate(const_cast<Bucket*>(old_buckets),
+                             new_header->bucket_count_ * sizeof(Bucket));
+    }
+    new_header->bucket_count_ = bucket_count;
+    new_header->buckets_ = offset;
+    new_header->used_ = new_header->count_;
+}
+
+void
+MappedLeaseStore::release(const uint64_t offset) {
+    void* blob = segment_->getAddress(offset);
+    uint32_t length;
+    memcpy(&length, blob, sizeof(length));
+    segment_->deallocate(blob, sizeof(length) + length);
+}
+
+MappedLeaseStore::StoreHeader*
+MappedLeaseStore::getHeader() const {
+    return (static_cast<StoreHeader*>(segment_->getNamedAddress(STORE_NAME).second));
+}
+
+MappedLeaseStore::Bucket*
+MappedLeaseStore::getBuckets() const {
+    return (static_cast<Bucket*>(segment_->getAddress(getHeader()->buckets_)));
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
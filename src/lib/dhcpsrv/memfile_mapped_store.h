@@ -0,0 +1,170 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMFILE_MAPPED_STORE_H
+#define MEMFILE_MAPPED_STORE_H
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <util/memory_segment_mapped.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Image of the Memfile lease storage in a memory mapped file.
+///
+/// The Memfile backend keeps all leases in memory and appends every
+/// change to the lease file, which is read again when the server
+/// restarts. Parsing the lease file takes a long time when it holds
+/// millions of leases, so the restart of the server can optionally be
+/// sped up using this store.
+///
+/// The store holds a binary copy of each lease in a
+/// @c isc::util::MemorySegmentMapped, indexed by a hash table of the
+/// lease addresses. The backend writes through every change to the
+/// store, after it has been appended to the lease file. At the next
+/// startup the leases are read from the store, without parsing the
+/// lease file.
+///
+/// The lease file remains the reference and is used as a journal. The
+/// store is marked as synchronized when the backend is destroyed and it
+/// records the identity (size, modification time and inode) of the
+/// lease file at that time. The store is only used at startup if it is
+/// synchronized and the lease file hasn't been modified since then.
+/// Otherwise, e.g. after a crash, the leases are read from the lease
+/// files and the store is rebuilt from them.
+class MappedLeaseStore : public boost::noncopyable {
+public:
+
+    /// @brief Name of the store in the memory segment.
+    static const char* STORE_NAME;
+
+    /// @brief Version of the store format.
+    static const uint32_t STORE_VERSION = 1;
+
+    /// @brief Constructor.
+    ///
+    /// Opens the store, creating an empty store if the file doesn't exist
+    /// or doesn't hold a store for the given universe.
+    ///
+    /// @param filename name of the store file
+    /// @param universe 4 or 6
+    ///
+    /// @throw isc::util::MemorySegmentOpenError if the file can't be
+    /// opened, e.g. because it is used by another server.
+    MappedLeaseStore(const std::string& filename, const uint32_t universe);
+
+    /// @brief Checks if the store can be used in place of the lease files.
+    ///
+    /// @param journal name of the lease file
+    /// @return true if the store has been synchronized with the lease file
+    /// and the lease file hasn't been modified since then.
+    bool isReusable(const std::string& journal) const;
+
+    /// @brief Removes all leases from the store.
+    void clear();
+
+    /// @brief Marks the store as being modified.
+    ///
+    /// This must be called before the first lease is written, so as the
+    /// store is not used after a crash.
+    void markInUse();
+
+    /// @brief Marks the store as synchronized with the lease file.
+    ///
+    /// This must be called after the lease file has been closed.
+    ///
+    /// @param journal name of the lease file
+    void sync(const std::string& journal);
+
+    /// @brief Adds or replaces a lease.
+    ///
+    /// @param lease lease to be stored
+    void put(const Lease4& lease);
+
+    /// @brief Adds or replaces a lease.
+    ///
+    /// @param lease lease to be stored
+    void put(const Lease6& lease);
+
+    /// @brief Removes a lease.
+    ///
+    /// @param addr address of the lease
+    /// @return true if the lease was found.
+    bool remove(const asiolink::IOAddress& addr);
+
+    /// @brief Returns the number of leases.
+    uint64_t size() const;
+
+    /// @brief Loads the leases into the Memfile storage.
+    ///
+    /// @param [out] storage storage to which the leases are added
+    void load(Lease4Storage& storage) const;
+
+    /// @brief Loads the leases into the Memfile storage.
+    ///
+    /// @param [out] storage storage to which the leases are added
+    void load(Lease6Storage& storage) const;
+
+private:
+
+    /// @brief Header of the store, defined in the implementation.
+    struct StoreHeader;
+
+    /// @brief Entry of the hash table, defined in the implementation.
+    struct Bucket;
+
+    /// @brief Lease address used as the key of the hash table.
+    typedef uint8_t Key[16];
+
+    /// @brief Creates an empty store in the segment.
+    void init();
+
+    /// @brief Allocates a block, retrying when the segment has grown.
+    ///
+    /// @param size size of the block
+    /// @return offset of the block in the segment.
+    uint64_t allocate(const size_t size);
+
+    /// @brief Stores a serialized lease.
+    ///
+    /// @param key address of the lease
+    /// @param data serialized lease
+    /// @param length length of the serialized lease
+    void put(const Key& key, const void* data, const size_t length);
+
+    /// @brief Rebuilds the hash table, doubling its size when needed.
+    void rehash();
+
+    /// @brief Frees a serialized lease.
+    ///
+    /// @param offset offset of the serialized lease
+    void release(const uint64_t offset);
+
+    /// @brief Returns the header of the store.
+    StoreHeader* getHeader() const;
+
+    /// @brief Returns the hash table.
+    Bucket* getBuckets() const;
+
+    /// @brief Memory segment holding the store.
+    boost::scoped_ptr<util::MemorySegmentMapped> segment_;
+
+    /// @brief Universe of the leases.
+    uint32_t universe_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // MEMFILE_MAPPED_STORE_H
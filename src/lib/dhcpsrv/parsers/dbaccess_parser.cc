@@ -58,7 +58,8 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
     // 2. Update the copy with the passed keywords.
     BOOST_FOREACH(ConfigPair param, database_config->mapValue()) {
         try {
-            if ((param.first == "persist") || (param.first == "readonly")) {
+            if ((param.first == "persist") || (param.first == "readonly") ||
+                (param.first == "mapped-store")) {
                 values_copy[param.first] = (param.second->boolValue() ?
                                             "true" : "false");
 
@@ -163,6 +163,9 @@ HostReservationParser::parseInternal(const SubnetID&,
 
 void
 HostReservationParser::addHost(isc::data::ConstElementPtr reservation_data) {
+    if (!add_host_) {
+        return;
+    }
     try {
         CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(host_);
 
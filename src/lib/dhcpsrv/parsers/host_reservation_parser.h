@@ -18,6 +18,11 @@ namespace dhcp {
 class HostReservationParser : public isc::data::SimpleParser {
 public:
 
+    /// @brief Constructor.
+    HostReservationParser()
+        : add_host_(true) {
+    }
+
     /// @brief Destructor.
     virtual ~HostReservationParser() { }
 
@@ -32,6 +37,23 @@ public:
     void parse(const SubnetID& subnet_id,
                isc::data::ConstElementPtr reservation_data);
 
+    /// @brief Returns the host created by the last call to @ref parse.
+    HostPtr getHost() const {
+        return (host_);
+    }
+
+    /// @brief Sets whether the parsed host is added to the staging
+    /// configuration.
+    ///
+    /// The host is not added when the reservation is parsed outside
+    /// of the thread applying the configuration. The caller adds it
+    /// afterwards.
+    ///
+    /// @param add_host true (default) if the host should be added.
+    void setAddHost(const bool add_host) {
+        add_host_ = add_host;
+    }
+
 protected:
 
     /// @brief Parses a single entry for host reservation.
@@ -51,7 +73,8 @@ protected:
     /// @brief Inserts @c host_ object to the staging configuration.
     ///
     /// This method should be called by derived classes to insert the fully
-    /// parsed host reservation configuration to the @c CfgMgr.
+    /// parsed host reservation configuration to the @c CfgMgr. It does
+    /// nothing if the host should not be added (see @ref setAddHost).
     ///
     /// @param reservation_data Data element holding host reservation. It
     /// used by this method to append the line number to the error string.
@@ -88,6 +111,10 @@ protected:
     /// host reservation configuration.
     HostPtr host_;
 
+    /// @brief Indicates whether @c addHost adds the host to the staging
+    /// configuration.
+    bool add_host_;
+
 };
 
 /// @brief Parser for a single host reservation for DHCPv4.
@@ -9,6 +9,7 @@
 
 #include <cc/data.h>
 #include <cc/simple_parser.h>
+#include <dhcpsrv/host.h>
 #include <dhcpsrv/subnet_id.h>
 #include <boost/foreach.hpp>
 
@@ -30,13 +31,23 @@ public:
     /// belong.
     /// @param hr_list Data element holding a list of host reservations.
     /// Each host reservation is described by a map object.
+    /// @param [out] hosts Optional collection to which the parsed hosts
+    /// are appended.
+    /// @param add_hosts Indicates whether the parsed hosts are added to
+    /// the staging configuration (see
+    /// @ref HostReservationParser::setAddHost).
     ///
     /// @throw DhcpConfigError If the configuration if any of the reservations
     /// is invalid.
-    void parse(const SubnetID& subnet_id, isc::data::ConstElementPtr hr_list) {
+    void parse(const SubnetID& subnet_id, isc::data::ConstElementPtr hr_list,
+               HostCollection* hosts = 0, const bool add_hosts = true) {
         BOOST_FOREACH(data::ConstElementPtr reservation, hr_list->listValue()) {
             HostReservationParserType parser;
+            parser.setAddHost(add_hosts);
             parser.parse(subnet_id, reservation);
+            if (hosts) {
+                hosts->push_back(parser.getHost());
+            }
         }
     }
 };
@@ -0,0 +1,183 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/docsis3_option_defs.h>
+#include <dhcp/libdhcp++.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/incremental_config_cache.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/parallel_subnets_parser.h>
+#include <util/threads/thread.h>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <unistd.h>
+
+using namespace isc::data;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Assigns new Pool-IDs to the pools of a subnet.
+///
+/// @param subnet subnet parsed ahead.
+void
+renumberPools(const SubnetPtr& subnet) {
+    std::vector<Lease::Type> types;
+    if (boost::dynamic_pointer_cast<Subnet4>(subnet)) {
+        types.push_back(Lease::TYPE_V4);
+    } else {
+        types.push_back(Lease::TYPE_NA);
+        types.push_back(Lease::TYPE_TA);
+        types.push_back(Lease::TYPE_PD);
+    }
+    for (size_t i = 0; i < types.size(); ++i) {
+        const PoolCollection& pools = subnet->getPools(types[i]);
+        for (PoolCollection::const_iterator pool = pools.begin();
+             pool != pools.end(); ++pool) {
+            (*pool)->renewId();
+        }
+    }
+}
+
+}
+
+size_t ParallelSubnetsParser::max_threads_ = 0;
+
+size_t ParallelSubnetsParser::min_subnets_per_thread_ = 32;
+
+ParallelSubnetsParser::ParallelSubnetsParser(const SubnetParser& parser)
+    : parser_(parser), configs_(), indexes_(), entries_(), thread_count_(0) {
+}
+
+void
+ParallelSubnetsParser::parse(const ConstElementPtr& subnets_list) {
+    const std::vector<ElementPtr>& configs = subnets_list->listValue();
+    configs_.assign(configs.begin(), configs.end());
+    indexes_.clear();
+    entries_.clear();
+    entries_.resize(configs_.size());
+    thread_count_ = 0;
+
+    // The identifiers of the subnets which don't specify them are
+    // generated in the order of the list, and the reused subnets are
+    // not parsed at all.
+    IncrementalConfigCache& cache = IncrementalConfigCache::instance();
+    for (size_t i = 0; i < configs_.size(); ++i) {
+        if ((IncrementalConfigCache::getSubnetID(configs_[i]) != 0) &&
+            !cache.hasSubnet(configs_[i])) {
+            indexes_.push_back(i);
+        }
+    }
+
+    const size_t thread_count = getThreadCount(indexes_.size());
+    if (thread_count < 2) {
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_PARALLEL_SUBNETS)
+        .arg(indexes_.size())
+        .arg(thread_count);
+
+    // The standard option definitions are created on first use. Make
+    // sure this happens before the threads look them up.
+    LibDHCP::getOptionDefs(DHCP4_OPTION_SPACE);
+    LibDHCP::getVendorOption4Defs(VENDOR_ID_CABLE_LABS);
+    LibDHCP::getVendorOption6Defs(VENDOR_ID_CABLE_LABS);
+    LibDHCP::getVendorOption6Defs(ENTERPRISE_ID_ISC);
+
+    // The calling thread parses its share of the subnets too. If a
+    // thread can't be created, its share is parsed by the server.
+    std::vector<boost::shared_ptr<Thread> > threads;
+    try {
+        for (size_t i = 1; i < thread_count; ++i) {
+            threads.push_back(boost::shared_ptr<Thread>(new Thread(
+                boost::bind(&ParallelSubnetsParser::parseSubnets,
+                            this, i, thread_count))));
+        }
+    } catch (...) {
+        // Continue with the threads created so far.
+    }
+    parseSubnets(0, thread_count);
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+        try {
+            threads[i]->wait();
+        } catch (...) {
+            // The subnets of this thread are parsed by the server.
+        }
+    }
+    thread_count_ = thread_count;
+}
+
+SubnetPtr
+ParallelSubnetsParser::getSubnet(const size_t index,
+                                 HostCollection& hosts) const {
+    if ((index >= entries_.size()) || !entries_[index].subnet_) {
+        return (SubnetPtr());
+    }
+
+    // Add the host reservations in the order of the configuration, as
+    // the host reservations parser would do.
+    const Entry& entry = entries_[index];
+    ConstElementPtr reservations = configs_[index]->get("reservations");
+    CfgHostsPtr cfg_hosts = CfgMgr::instance().getStagingCfg()->getCfgHosts();
+    for (size_t i = 0; i < entry.hosts_.size(); ++i) {
+        try {
+            cfg_hosts->add(entry.hosts_[i]);
+
+        } catch (const std::exception& ex) {
+            // Append line number to the exception string.
+            isc_throw(DhcpConfigError, ex.what() << " ("
+                      << reservations->get(i)->getPosition() << ")");
+        }
+    }
+
+    // The Pool-IDs are assigned in the order of the configuration, as
+    // if the subnets were parsed sequentially.
+    renumberPools(entry.subnet_);
+
+    hosts = entry.hosts_;
+    return (entry.subnet_);
+}
+
+size_t
+ParallelSubnetsParser::getThreadCount(const size_t num_subnets) {
+    size_t max_threads = max_threads_;
+    if (max_threads == 0) {
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        max_threads = (processors > 0 ? static_cast<size_t>(processors) : 1);
+    }
+    const size_t min_subnets = (min_subnets_per_thread_ > 0 ?
+                                min_subnets_per_thread_ : 1);
+    return (std::max(static_cast<size_t>(1),
+                     std::min(max_threads, num_subnets / min_subnets)));
+}
+
+void
+ParallelSubnetsParser::parseSubnets(const size_t first, const size_t step) {
+    for (size_t i = first; i < indexes_.size(); i += step) {
+        Entry& entry = entries_[indexes_[i]];
+        try {
+            entry.subnet_ = parser_(configs_[indexes_[i]], entry.hosts_);
+
+        } catch (...) {
+            // The server parses the subnet again to report the error.
+            entry.subnet_.reset();
+            entry.hosts_.clear();
+        }
+    }
+}
+
+} // namespace isc::dhcp
+} // namespace isc
@@ -0,0 +1,156 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PARALLEL_SUBNETS_PARSER_H
+#define PARALLEL_SUBNETS_PARSER_H
+
+#include <cc/data.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/subnet.h>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Parses the subnets of a configuration list on several threads.
+///
+/// The subnets and their host reservations are independent from each
+/// other until they are added to the staging configuration. Before the
+/// server walks the list of subnets, this class parses on a number of
+/// threads the subnets which have an explicit identifier and can't be
+/// reused from the @c IncrementalConfigCache. The host reservations of
+/// these subnets are kept aside instead of being added to the staging
+/// configuration.
+///
+/// The server then walks the list in order and calls @c getSubnet for
+/// each subnet it has to parse, which adds the host reservations of the
+/// subnet to the staging configuration and returns the subnet. The
+/// subnets without identifier, whose identifiers are generated in the
+/// order of the list, and the subnets which failed to parse are not
+/// returned: the server parses them itself. Hence the resulting
+/// configuration and the reported error are the same as if the subnets
+/// were parsed sequentially.
+///
+/// The subnets are parsed on the calling thread only if the list is too
+/// short to benefit from additional threads.
+class ParallelSubnetsParser : public boost::noncopyable {
+public:
+
+    /// @brief Function parsing a subnet.
+    ///
+    /// The function must not add the host reservations of the subnet to
+    /// the staging configuration but append them to the collection. It
+    /// must not log the new subnet either: the caller logs the subnets it
+    /// gets from @c getSubnet in the main thread.
+    typedef boost::function<SubnetPtr(const data::ConstElementPtr&,
+                                      HostCollection&)> SubnetParser;
+
+    /// @brief Constructor.
+    ///
+    /// @param parser function parsing a subnet.
+    explicit ParallelSubnetsParser(const SubnetParser& parser);
+
+    /// @brief Parses the subnets of the list which can be parsed ahead.
+    ///
+    /// Errors are not reported: the subnets which failed to parse are
+    /// parsed again by the server.
+    ///
+    /// @param subnets_list list of the subnet configurations, after the
+    /// default and derived values have been set.
+    void parse(const data::ConstElementPtr& subnets_list);
+
+    /// @brief Returns the subnet parsed ahead for an entry of the list.
+    ///
+    /// The host reservations of the subnet are added to the staging
+    /// configuration. The pools of the subnet are given new identifiers,
+    /// so as they follow the order of the list as if the subnet was
+    /// parsed by the caller.
+    ///
+    /// @param index position of the subnet in the list.
+    /// @param [out] hosts collection receiving the host reservations of
+    /// the subnet.
+    ///
+    /// @return pointer to the subnet or null if the subnet must be
+    /// parsed by the caller.
+    /// @throw DhcpConfigError if a host reservation can't be added.
+    SubnetPtr getSubnet(const size_t index, HostCollection& hosts) const;
+
+    /// @brief Returns the number of threads used by the last call to
+    /// @c parse, or 0 if the subnets were not parsed ahead.
+    size_t getThreadCount() const {
+        return (thread_count_);
+    }
+
+    /// @brief Returns the number of threads used to parse a number of
+    /// subnets.
+    ///
+    /// @param num_subnets number of subnets to parse.
+    static size_t getThreadCount(const size_t num_subnets);
+
+    /// @brief Sets the maximum number of threads.
+    ///
+    /// @param max_threads maximum number of threads, including the
+    /// calling one. The value of 0 (default) stands for the number of
+    /// processors, 1 disables the parsing ahead.
+    static void setMaxThreads(const size_t max_threads) {
+        max_threads_ = max_threads;
+    }
+
+    /// @brief Sets the minimum number of subnets parsed by a thread.
+    ///
+    /// @param min_subnets minimum number of subnets (default 32).
+    static void setMinSubnetsPerThread(const size_t min_subnets) {
+        min_subnets_per_thread_ = min_subnets;
+    }
+
+private:
+
+    /// @brief Subnet parsed ahead.
+    struct Entry {
+        /// @brief The subnet or null if it must be parsed by the caller.
+        SubnetPtr subnet_;
+
+        /// @brief Host reservations of the subnet.
+        HostCollection hosts_;
+    };
+
+    /// @brief Body of a thread.
+    ///
+    /// Parses the subnets to be parsed ahead starting from the given one
+    /// and then every given number of subnets.
+    ///
+    /// @param first position of the first subnet in @c indexes_.
+    /// @param step number of threads.
+    void parseSubnets(const size_t first, const size_t step);
+
+    /// @brief Function parsing a subnet.
+    SubnetParser parser_;
+
+    /// @brief Configurations of the subnets, in the order of the list.
+    std::vector<data::ConstElementPtr> configs_;
+
+    /// @brief Positions in the list of the subnets parsed ahead.
+    std::vector<size_t> indexes_;
+
+    /// @brief Subnets parsed ahead, in the order of the list.
+    std::vector<Entry> entries_;
+
+    /// @brief Number of threads used by the last parsing.
+    size_t thread_count_;
+
+    /// @brief Maximum number of threads.
+    static size_t max_threads_;
+
+    /// @brief Minimum number of subnets parsed by a thread.
+    static size_t min_subnets_per_thread_;
+};
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // PARALLEL_SUBNETS_PARSER_H
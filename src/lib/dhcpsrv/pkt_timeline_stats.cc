@@ -0,0 +1,69 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/pkt_timeline_stats.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+
+using namespace isc::stats;
+
+namespace isc {
+namespace dhcp {
+
+PktTimelineStats::PktTimelineStats(const std::string& prefix)
+    : names_(), total_name_(prefix + "-latency-total"), histograms_(),
+      total_(), generation_(0) {
+    for (int i = 0; i < Pkt::EVENT_NUM; ++i) {
+        names_.push_back(prefix + "-latency-" +
+                         Pkt::getStageName(static_cast<Pkt::TimelineEvent>(i)));
+    }
+    getHistograms();
+}
+
+void
+PktTimelineStats::record(const Pkt& pkt) {
+    if (pkt.getEventTime(Pkt::EVENT_RECEIVED) == 0) {
+        return;
+    }
+
+    if (generation_ != StatsMgr::instance().getHistogramsGeneration()) {
+        getHistograms();
+    }
+
+    for (int i = Pkt::EVENT_PARSED; i < Pkt::EVENT_NUM; ++i) {
+        const Pkt::TimelineEvent event = static_cast<Pkt::TimelineEvent>(i);
+        if (pkt.getEventTime(event) != 0) {
+            histograms_[i]->addSample(pkt.getStageDuration(event));
+        }
+    }
+    total_->addSample(pkt.getTotalDuration());
+}
+
+const std::string&
+PktTimelineStats::getStageStatName(const Pkt::TimelineEvent event) const {
+    if (event >= Pkt::EVENT_NUM) {
+        isc_throw(BadValue, "invalid packet timeline event " << event);
+    }
+    return (names_[event]);
+}
+
+void
+PktTimelineStats::getHistograms() {
+    // The histogram of the reception is never used but this keeps the
+    // indexes of the events.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    histograms_.clear();
+    for (int i = 0; i < Pkt::EVENT_NUM; ++i) {
+        histograms_.push_back(i == Pkt::EVENT_RECEIVED ? HistogramPtr() :
+                              stats_mgr.addHistogram(names_[i]));
+    }
+    total_ = stats_mgr.addHistogram(total_name_);
+    generation_ = stats_mgr.getHistogramsGeneration();
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,88 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PKT_TIMELINE_STATS_H
+#define PKT_TIMELINE_STATS_H
+
+#include <dhcp/pkt.h>
+#include <stats/histogram.h>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Aggregates packet processing timelines into latency histograms.
+///
+/// The DHCP servers record the timestamps of the processing events
+/// (see @ref Pkt::TimelineEvent) on each received packet. When the
+/// processing is finished, the server passes the packet to this class,
+/// which adds the duration of each recorded stage to the respective
+/// histogram maintained by the @c isc::stats::StatsMgr. The histograms
+/// are named "<prefix>-latency-<stage>", e.g. "pkt4-latency-host-lookup".
+/// The total processing time (from reception to the last recorded event)
+/// is recorded in the "<prefix>-latency-total" histogram.
+///
+/// The histograms are looked up once, when this object is created, so
+/// recording a timeline doesn't involve any lookup by name. They are
+/// looked up again only after they have been removed from the
+/// @c isc::stats::StatsMgr, e.g. by the statistic-remove-all command.
+class PktTimelineStats {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param prefix Prefix of the histogram names, e.g. "pkt4".
+    explicit PktTimelineStats(const std::string& prefix);
+
+    /// @brief Records the timeline of the packet.
+    ///
+    /// Stages which haven't been recorded on the packet are skipped.
+    /// Nothing is recorded if the reception of the packet hasn't been
+    /// recorded.
+    ///
+    /// @param pkt Packet for which the processing has finished.
+    void record(const Pkt& pkt);
+
+    /// @brief Returns the name of the histogram for the stage.
+    ///
+    /// @param event Event ending the stage.
+    const std::string& getStageStatName(const Pkt::TimelineEvent event) const;
+
+    /// @brief Returns the name of the histogram for the total time.
+    const std::string& getTotalStatName() const {
+        return (total_name_);
+    }
+
+private:
+
+    /// @brief Gets the histograms from the @c isc::stats::StatsMgr.
+    void getHistograms();
+
+    /// @brief Histogram names indexed by @c Pkt::TimelineEvent.
+    std::vector<std::string> names_;
+
+    /// @brief Name of the histogram for the total processing time.
+    std::string total_name_;
+
+    /// @brief Histograms indexed by @c Pkt::TimelineEvent.
+    std::vector<stats::HistogramPtr> histograms_;
+
+    /// @brief Histogram for the total processing time.
+    stats::HistogramPtr total_;
+
+    /// @brief Generation of the histograms held by this object.
+    uint64_t generation_;
+};
+
+/// @brief Pointer to the @c PktTimelineStats.
+typedef boost::shared_ptr<PktTimelineStats> PktTimelineStatsPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // PKT_TIMELINE_STATS_H
@@ -16,12 +16,13 @@ namespace dhcp {
 
 Pool::Pool(Lease::Type type, const isc::asiolink::IOAddress& first,
            const isc::asiolink::IOAddress& last)
-    :id_(getNextID()), first_(first), last_(last), type_(type),
-     capacity_(0), cfg_option_(new CfgOption()) {
+    :id_(getNextID()), first_(first), last_(last), first_value_(first),
+     last_value_(last), type_(type), capacity_(0),
+     cfg_option_(new CfgOption()) {
 }
 
 bool Pool::inRange(const isc::asiolink::IOAddress& addr) const {
-    return (first_.smallerEqual(addr) && addr.smallerEqual(last_));
+    return (AddressValue(addr).inRange(first_value_, last_value_));
 }
 
 std::string
@@ -66,6 +67,7 @@ Pool4::Pool4( const isc::asiolink::IOAddress& prefix, uint8_t prefix_len)
 
     // Let's now calculate the last address in defined pool
     last_ = lastAddrInPrefix(prefix, prefix_len);
+    last_value_ = AddressValue(last_);
 
     // This is IPv4 pool, which only has one type. We can calculate
     // the number of theoretically possible leases in it. As there's 2^32
@@ -220,6 +222,7 @@ Pool6::init(const Lease::Type& type,
 
     // Let's now calculate the last address in defined pool
     last_ = lastAddrInPrefix(prefix, prefix_len);
+    last_value_ = AddressValue(last_);
 
     // Let's calculate the theoretical number of leases in this pool.
     // For addresses, we could use addrsInRange(prefix, last_), but it's
@@ -7,6 +7,7 @@
 #ifndef POOL_H
 #define POOL_H
 
+#include <asiolink/address_value.h>
 #include <asiolink/io_address.h>
 #include <dhcp/option6_pdexclude.h>
 #include <boost/shared_ptr.hpp>
@@ -15,6 +16,7 @@
 #include <dhcpsrv/lease.h>
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <vector>
 
 namespace isc {
@@ -38,6 +40,15 @@ public:
         return (id_);
     }
 
+    /// @brief Assigns the next unique Pool-ID to the pool.
+    ///
+    /// The pools parsed ahead by the @c ParallelSubnetsParser are
+    /// renumbered when their subnet is retrieved, so as the Pool-IDs
+    /// follow the order of the configuration.
+    void renewId() {
+        id_ = getNextID();
+    }
+
     /// @brief Returns the first address in a pool.
     ///
     /// @return first address in a pool
@@ -123,9 +134,12 @@ protected:
 
     /// @brief returns the next unique Pool-ID
     ///
+    /// The pools may be created by several threads during the parsing of
+    /// the configuration.
+    ///
     /// @return the next unique Pool-ID
     static uint32_t getNextID() {
-        static uint32_t id = 0;
+        static std::atomic<uint32_t> id(0);
         return (id++);
     }
 
@@ -140,6 +154,12 @@ protected:
     /// @brief The last address in a pool
     isc::asiolink::IOAddress last_;
 
+    /// @brief Numeric value of the first address, used by @c inRange.
+    isc::asiolink::AddressValue first_value_;
+
+    /// @brief Numeric value of the last address, used by @c inRange.
+    isc::asiolink::AddressValue last_value_;
+
     /// @brief Comments field
     ///
     /// @todo: This field is currently not used.
@@ -0,0 +1,759 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <config/command_mgr.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/socket_handoff.h>
+#include <util/io/fd_share.h>
+
+#include <boost/bind.hpp>
+#include <boost/foreach.hpp>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace isc::asiolink;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Maximum length of a handoff message.
+const uint32_t MAX_MESSAGE_SIZE = 1048576;
+
+/// @brief Description of a DHCP socket received from the running process.
+struct SocketDescription {
+    /// @brief Name of the interface.
+    std::string iface_name_;
+
+    /// @brief Address the socket is bound to.
+    std::string address_;
+
+    /// @brief Port the socket is bound to.
+    uint16_t port_;
+
+    /// @brief The socket has a fallback socket.
+    bool fallback_;
+};
+
+/// @brief Fills the address of a UNIX socket.
+///
+/// @param socket_name path of the socket.
+/// @param [out] addr address of the socket.
+void
+setSocketAddress(const std::string& socket_name, struct sockaddr_un& addr) {
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_name.c_str(), sizeof(addr.sun_path) - 1);
+}
+
+/// @brief Returns a string parameter of a message.
+///
+/// @param message the message.
+/// @param name name of the parameter.
+std::string
+getString(const ConstElementPtr& message, const std::string& name) {
+    ConstElementPtr value = message->get(name);
+    if (!value || (value->getType() != Element::string)) {
+        isc_throw(isc::dhcp::SocketHandoffError, "missing or invalid '"
+                  << name << "' in the handoff message " << message->str());
+    }
+    return (value->stringValue());
+}
+
+/// @brief Returns an integer parameter of a message.
+///
+/// @param message the message.
+/// @param name name of the parameter.
+int64_t
+getInteger(const ConstElementPtr& message, const std::string& name) {
+    ConstElementPtr value = message->get(name);
+    if (!value || (value->getType() != Element::integer)) {
+        isc_throw(isc::dhcp::SocketHandoffError, "missing or invalid '"
+                  << name << "' in the handoff message " << message->str());
+    }
+    return (value->intValue());
+}
+
+/// @brief Returns a boolean parameter of a message.
+///
+/// @param message the message.
+/// @param name name of the parameter.
+bool
+getBoolean(const ConstElementPtr& message, const std::string& name) {
+    ConstElementPtr value = message->get(name);
+    if (!value || (value->getType() != Element::boolean)) {
+        isc_throw(isc::dhcp::SocketHandoffError, "missing or invalid '"
+                  << name << "' in the handoff message " << message->str());
+    }
+    return (value->boolValue());
+}
+
+/// @brief Parses the text of a handoff message.
+///
+/// @param text the text of the message.
+/// @return the message.
+ConstElementPtr
+parseMessage(const std::string& text) {
+    ConstElementPtr message;
+    try {
+        message = Element::fromJSON(text);
+    } catch (const std::exception& ex) {
+        isc_throw(isc::dhcp::SocketHandoffError, "invalid handoff message: "
+                  << ex.what());
+    }
+    if (message->getType() != Element::map) {
+        isc_throw(isc::dhcp::SocketHandoffError, "invalid handoff message "
+                  << message->str());
+    }
+    return (message);
+}
+
+/// @brief Creates a message with the state of the handoff.
+///
+/// @param state "ready" or "done".
+ConstElementPtr
+createStateMessage(const std::string& state) {
+    ElementPtr message = Element::createMap();
+    message->set("state", Element::create(state));
+    return (message);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+SocketHandoff::SocketHandoff(const std::string& socket_name,
+                             const uint16_t family, const long timeout,
+                             const long ready_timeout)
+    : socket_name_(socket_name), family_(family), timeout_(timeout),
+      ready_timeout_(ready_timeout), listen_fd_(-1), conn_fd_(-1),
+      peer_pid_(0), ready_data_(), deadline_service_(), deadline_timer_(),
+      deadline_socket_(), deadline_thread_(), handed_off_(false),
+      ready_callback_() {
+    if ((family != AF_INET) && (family != AF_INET6)) {
+        isc_throw(BadValue, "invalid family " << family
+                  << " of the sockets to hand off");
+    }
+    if ((timeout <= 0) || (ready_timeout <= 0)) {
+        isc_throw(BadValue, "invalid handoff timeouts " << timeout << " and "
+                  << ready_timeout << ": they must be positive");
+    }
+    struct sockaddr_un addr;
+    if (socket_name_.empty() ||
+        (socket_name_.size() > sizeof(addr.sun_path) - 1)) {
+        isc_throw(BadValue, "invalid handoff socket path '" << socket_name_
+                  << "': it must be between 1 and "
+                  << (sizeof(addr.sun_path) - 1) << " characters long");
+    }
+}
+
+SocketHandoff::~SocketHandoff() {
+    close();
+}
+
+int
+SocketHandoff::takeOver() {
+    if ((conn_fd_ >= 0) || (listen_fd_ >= 0)) {
+        isc_throw(InvalidOperation, "the handoff socket " << socket_name_
+                  << " is already in use");
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        isc_throw(SocketHandoffError, "failed to create the handoff socket: "
+                  << strerror(errno));
+    }
+    static_cast<void>(fcntl(fd, F_SETFD, FD_CLOEXEC));
+
+    struct sockaddr_un addr;
+    setSocketAddress(socket_name_, addr);
+    if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+                sizeof(addr)) < 0) {
+        const int error = errno;
+        ::close(fd);
+        // There is no running server.
+        if ((error == ENOENT) || (error == ECONNREFUSED)) {
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_HANDOFF_NO_PEER)
+                .arg(socket_name_);
+            return (0);
+        }
+        isc_throw(SocketHandoffError, "failed to connect to the handoff socket "
+                  << socket_name_ << ": " << strerror(error));
+    }
+
+    std::vector<SocketDescription> sockets;
+    int pid = 0;
+    try {
+        // Receive and check the description of the sockets.
+        ConstElementPtr description = receiveMessage(fd);
+        pid = static_cast<int>(getInteger(description, "pid"));
+        if (pid <= 0) {
+            isc_throw(SocketHandoffError, "invalid pid " << pid
+                      << " in the handoff message");
+        }
+        const bool direct_response = getBoolean(description, "direct-response");
+        ConstElementPtr list = description->get("sockets");
+        if (!list || (list->getType() != Element::list)) {
+            isc_throw(SocketHandoffError, "missing or invalid 'sockets' in"
+                      " the handoff message " << description->str());
+        }
+        BOOST_FOREACH(ConstElementPtr socket, list->listValue()) {
+            if (socket->getType() != Element::map) {
+                isc_throw(SocketHandoffError, "invalid socket "
+                          << socket->str() << " in the handoff message");
+            }
+            SocketDescription desc;
+            desc.iface_name_ = getString(socket, "interface");
+            desc.address_ = getString(socket, "address");
+            desc.port_ = static_cast<uint16_t>(getInteger(socket, "port"));
+            desc.fallback_ = getBoolean(socket, "fallback");
+            sockets.push_back(desc);
+        }
+        std::string control_socket;
+        if (description->contains("control-socket")) {
+            control_socket = getString(description, "control-socket");
+        }
+
+        // The descriptors follow in the order of the description.
+        for (std::vector<SocketDescription>::const_iterator desc =
+                 sockets.begin(); desc != sockets.end(); ++desc) {
+            const int sockfd = receiveDescriptor(fd);
+            int fallbackfd = -1;
+            if (desc->fallback_) {
+                try {
+                    fallbackfd = receiveDescriptor(fd);
+                } catch (...) {
+                    ::close(sockfd);
+                    throw;
+                }
+            }
+            IfaceMgr::instance().addInheritedSocket(desc->iface_name_,
+                SocketInfo(IOAddress(desc->address_), desc->port_, sockfd,
+                           fallbackfd), direct_response);
+        }
+        if (!control_socket.empty()) {
+            CommandMgr::instance().inheritCommandSocket(control_socket,
+                                                        receiveDescriptor(fd));
+        }
+
+    } catch (...) {
+        // The running process goes on when the connection is closed.
+        ::close(fd);
+        IfaceMgr::instance().closeInheritedSockets();
+        throw;
+    }
+
+    conn_fd_ = fd;
+    peer_pid_ = pid;
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_HANDOFF_SOCKETS_RECEIVED)
+        .arg(sockets.size()).arg(peer_pid_).arg(socket_name_);
+
+    return (peer_pid_);
+}
+
+void
+SocketHandoff::complete() {
+    if (!isTakingOver()) {
+        isc_throw(InvalidOperation, "the sockets are not being taken over"
+                  " through " << socket_name_);
+    }
+
+    const int pid = peer_pid_;
+    try {
+        // Signal that this process is ready and wait for the previous
+        // process to stop.
+        sendMessage(conn_fd_, createStateMessage("ready"));
+        ConstElementPtr message = receiveMessage(conn_fd_);
+        if (getString(message, "state") != "done") {
+            isc_throw(SocketHandoffError, "unexpected handoff message "
+                      << message->str());
+        }
+
+    } catch (...) {
+        closeConnection();
+        peer_pid_ = 0;
+        throw;
+    }
+
+    closeConnection();
+    peer_pid_ = 0;
+
+    // Close the sockets which are not used by the configuration.
+    IfaceMgr::instance().closeInheritedSockets();
+    CommandMgr::instance().closeInheritedCommandSocket();
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_HANDOFF_TAKEOVER_COMPLETE).arg(pid);
+}
+
+void
+SocketHandoff::listen(const ReadyCallback& callback) {
+    if ((listen_fd_ >= 0) || (conn_fd_ >= 0)) {
+        isc_throw(InvalidOperation, "the handoff socket " << socket_name_
+                  << " is already in use");
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        isc_throw(SocketHandoffError, "failed to create the handoff socket: "
+                  << strerror(errno));
+    }
+
+    if ((fcntl(fd, F_SETFD, FD_CLOEXEC) != 0) ||
+        (fcntl(fd, F_SETFL, O_NONBLOCK) != 0)) {
+        const char* errmsg = strerror(errno);
+        ::close(fd);
+        isc_throw(SocketHandoffError, "failed to set the options of the"
+                  " handoff socket: " << errmsg);
+    }
+
+    // The file of the previous process or a stale file is replaced.
+    static_cast<void>(remove(socket_name_.c_str()));
+
+    // The sockets are only handed off to the same user. No connection
+    // can be made before the permissions are set, as the socket doesn't
+    // listen yet.
+    struct sockaddr_un addr;
+    setSocketAddress(socket_name_, addr);
+    if (bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) ||
+        chmod(socket_name_.c_str(), S_IRUSR | S_IWUSR) ||
+        ::listen(fd, 1)) {
+        const char* errmsg = strerror(errno);
+        ::close(fd);
+        static_cast<void>(remove(socket_name_.c_str()));
+        isc_throw(SocketHandoffError, "failed to listen on the handoff socket "
+                  << socket_name_ << ": " << errmsg);
+    }
+
+    listen_fd_ = fd;
+    handed_off_ = false;
+    ready_callback_ = callback;
+    IfaceMgr::instance().addExternalSocket(listen_fd_,
+        boost::bind(&SocketHandoff::acceptHandler, this));
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_HANDOFF_LISTEN).arg(socket_name_);
+}
+
+void
+SocketHandoff::close() {
+    closeConnection();
+    if (listen_fd_ >= 0) {
+        IfaceMgr::instance().deleteExternalSocket(listen_fd_);
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        // The successor listens on the same path.
+        if (!handed_off_) {
+            static_cast<void>(remove(socket_name_.c_str()));
+        }
+    }
+}
+
+void
+SocketHandoff::acceptHandler() {
+    const int fd = accept(listen_fd_, NULL, NULL);
+    if (fd < 0) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_HANDOFF_ACCEPT_FAIL)
+            .arg(socket_name_).arg(strerror(errno));
+        return;
+    }
+
+    if (!checkPeer(fd)) {
+        ::close(fd);
+        return;
+    }
+
+    // The previous successor may have given up while its end of the
+    // connection has not been processed yet. A stalled successor is
+    // dropped by its readiness deadline.
+    if (conn_fd_ >= 0) {
+        char c;
+        if (recv(conn_fd_, &c, sizeof(c), MSG_PEEK | MSG_DONTWAIT) == 0) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_HANDOFF_ABORTED)
+                .arg(socket_name_).arg("the handoff connection has been"
+                                       " closed");
+            closeConnection();
+        }
+    }
+
+    // There is at most one successor at a time.
+    if (conn_fd_ >= 0) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_HANDOFF_BUSY).arg(socket_name_);
+        ::close(fd);
+        return;
+    }
+    static_cast<void>(fcntl(fd, F_SETFD, FD_CLOEXEC));
+
+    size_t count = 0;
+    try {
+        count = sendSockets(fd);
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_HANDOFF_SEND_FAIL)
+            .arg(socket_name_).arg(ex.what());
+        ::close(fd);
+        return;
+    }
+
+    // This process keeps serving until the successor is ready.
+    conn_fd_ = fd;
+    IfaceMgr::instance().addExternalSocket(conn_fd_,
+        boost::bind(&SocketHandoff::readyHandler, this));
+    try {
+        startDeadline();
+    } catch (const std::exception& ex) {
+        // A successor which could stall forever is not accepted.
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_HANDOFF_ACCEPT_FAIL)
+            .arg(socket_name_).arg(ex.what());
+        closeConnection();
+        return;
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_HANDOFF_SOCKETS_SENT)
+        .arg(count).arg(socket_name_);
+}
+
+void
+SocketHandoff::readyHandler() {
+    try {
+        // This process keeps serving while the message is incomplete.
+        ConstElementPtr message = readReadyMessage();
+        if (!message) {
+            return;
+        }
+        if (getString(message, "state") != "ready") {
+            isc_throw(SocketHandoffError, "unexpected handoff message "
+                      << message->str());
+        }
+
+    } catch (const std::exception& ex) {
+        // The successor failed, e.g. its configuration is invalid.
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_HANDOFF_ABORTED)
+            .arg(socket_name_).arg(ex.what());
+        closeConnection();
+        return;
+    }
+
+    // Stop serving and release the resources used by the successor.
+    if (ready_callback_) {
+        ready_callback_();
+    }
+    handed_off_ = true;
+
+    try {
+        sendMessage(conn_fd_, createStateMessage("done"));
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_HANDOFF_COMPLETE).arg(socket_name_);
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_HANDOFF_SEND_FAIL)
+            .arg(socket_name_).arg(ex.what());
+    }
+
+    close();
+}
+
+ConstElementPtr
+SocketHandoff::readReadyMessage() {
+    bool closed = false;
+    while (ready_data_.size() < sizeof(uint32_t) + MAX_MESSAGE_SIZE) {
+        uint8_t buf[1024];
+        const ssize_t cc = recv(conn_fd_, buf, sizeof(buf), MSG_DONTWAIT);
+        if (cc < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            isc_throw(SocketHandoffError, "failed to read the handoff"
+                      " message: " << strerror(errno));
+
+        } else if (cc == 0) {
+            closed = true;
+            break;
+        }
+        ready_data_.insert(ready_data_.end(), buf, buf + cc);
+    }
+
+    if (ready_data_.size() >= sizeof(uint32_t)) {
+        const uint32_t length = (static_cast<uint32_t>(ready_data_[0]) << 24) |
+            (static_cast<uint32_t>(ready_data_[1]) << 16) |
+            (static_cast<uint32_t>(ready_data_[2]) << 8) |
+            static_cast<uint32_t>(ready_data_[3]);
+        if ((length == 0) || (length > MAX_MESSAGE_SIZE)) {
+            isc_throw(SocketHandoffError, "invalid handoff message length "
+                      << length);
+        }
+        if (ready_data_.size() >= sizeof(uint32_t) + length) {
+            const std::string text(ready_data_.begin() + sizeof(uint32_t),
+                                   ready_data_.begin() + sizeof(uint32_t) +
+                                   length);
+            ready_data_.clear();
+            return (parseMessage(text));
+        }
+    }
+
+    if (closed) {
+        isc_throw(SocketHandoffError, "the handoff connection has been"
+                  " closed");
+    }
+    return (ConstElementPtr());
+}
+
+void
+SocketHandoff::startDeadline() {
+    deadline_service_.reset(new IOService());
+    deadline_socket_.reset(new WatchSocket());
+    deadline_timer_.reset(new IntervalTimer(*deadline_service_));
+    deadline_timer_->setup(boost::bind(&WatchSocket::markReady,
+                                       deadline_socket_.get()),
+                           ready_timeout_, IntervalTimer::ONE_SHOT);
+    IfaceMgr::instance().addExternalSocket(deadline_socket_->getSelectFd(),
+        boost::bind(&SocketHandoff::deadlineHandler, this));
+    // The service returns when the timer has expired or it is stopped.
+    deadline_thread_.reset(new Thread(boost::bind(&IOService::run,
+                                                  deadline_service_.get())));
+}
+
+void
+SocketHandoff::stopDeadline() {
+    if (deadline_thread_) {
+        deadline_service_->stop();
+        try {
+            deadline_thread_->wait();
+        } catch (...) {
+            // The expiration couldn't be signalled: the connection is
+            // being closed anyway.
+        }
+        deadline_thread_.reset();
+    }
+    deadline_timer_.reset();
+    if (deadline_socket_) {
+        IfaceMgr::instance().
+            deleteExternalSocket(deadline_socket_->getSelectFd());
+        deadline_socket_.reset();
+    }
+    deadline_service_.reset();
+}
+
+void
+SocketHandoff::deadlineHandler() {
+    LOG_WARN(dhcpsrv_logger, DHCPSRV_HANDOFF_ABORTED)
+        .arg(socket_name_).arg("the successor was not ready within "
+                               "the timeout");
+    closeConnection();
+}
+
+bool
+SocketHandoff::checkPeer(const int fd) {
+    uid_t uid = 0;
+#ifdef SO_PEERCRED
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    const int result = getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len);
+    uid = cred.uid;
+#else
+    gid_t gid = 0;
+    const int result = getpeereid(fd, &uid, &gid);
+#endif
+    if (result != 0) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_HANDOFF_ACCEPT_FAIL)
+            .arg(socket_name_).arg(strerror(errno));
+        return (false);
+    }
+
+    if (uid != geteuid()) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_HANDOFF_PEER_REJECTED)
+            .arg(socket_name_).arg(uid);
+        return (false);
+    }
+    return (true);
+}
+
+size_t
+SocketHandoff::sendSockets(const int fd) {
+    ElementPtr sockets = Element::createList();
+    std::vector<int> fds;
+    BOOST_FOREACH(IfacePtr iface, IfaceMgr::instance().getIfaces()) {
+        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
+            if (s.family_ != family_) {
+                continue;
+            }
+            ElementPtr socket = Element::createMap();
+            socket->set("interface", Element::create(iface->getName()));
+            socket->set("address", Element::create(s.addr_.toText()));
+            socket->set("port", Element::create(static_cast<int>(s.port_)));
+            socket->set("fallback", Element::create(s.fallbackfd_ >= 0));
+            sockets->add(socket);
+            fds.push_back(s.sockfd_);
+            if (s.fallbackfd_ >= 0) {
+                fds.push_back(s.fallbackfd_);
+            }
+        }
+    }
+
+    ElementPtr description = Element::createMap();
+    description->set("pid", Element::create(static_cast<int>(getpid())));
+    description->set("direct-response",
+                     Element::create((family_ == AF_INET) &&
+                                     IfaceMgr::instance().
+                                     isDirectResponseSupported()));
+    description->set("sockets", sockets);
+
+    // The control socket is handed off with the DHCP sockets.
+    const int control_fd = CommandMgr::instance().getControlSocketFD();
+    ConstElementPtr control =
+        CfgMgr::instance().getCurrentCfg()->getControlSocketInfo();
+    if ((control_fd >= 0) && control && (control->getType() == Element::map)) {
+        ConstElementPtr name = control->get("socket-name");
+        if (name && (name->getType() == Element::string)) {
+            description->set("control-socket", name);
+            fds.push_back(control_fd);
+        }
+    }
+
+    sendMessage(fd, description);
+    for (std::vector<int>::const_iterator it = fds.begin(); it != fds.end();
+         ++it) {
+        if (util::io::send_fd(fd, *it) != 0) {
+            isc_throw(SocketHandoffError, "failed to send the socket "
+                      << *it << ": " << strerror(errno));
+        }
+    }
+
+    return (sockets->size());
+}
+
+void
+SocketHandoff::closeConnection() {
+    stopDeadline();
+    if (conn_fd_ >= 0) {
+        IfaceMgr::instance().deleteExternalSocket(conn_fd_);
+        ::close(conn_fd_);
+        conn_fd_ = -1;
+    }
+    ready_data_.clear();
+}
+
+void
+SocketHandoff::sendMessage(const int fd, const ConstElementPtr& message) {
+    const std::string text = message->str();
+    const uint32_t length = htonl(static_cast<uint32_t>(text.size()));
+    std::string data(reinterpret_cast<const char*>(&length), sizeof(length));
+    data += text;
+
+    size_t sent = 0;
+    while (sent < data.size()) {
+        const ssize_t cc = send(fd, data.c_str() + sent, data.size() - sent,
+                                MSG_NOSIGNAL);
+        if (cc < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            isc_throw(SocketHandoffError, "failed to send the handoff"
+                      " message: " << strerror(errno));
+        }
+        sent += cc;
+    }
+}
+
+ConstElementPtr
+SocketHandoff::receiveMessage(const int fd) {
+    uint32_t length = 0;
+    readData(fd, &length, sizeof(length));
+    length = ntohl(length);
+    if ((length == 0) || (length > MAX_MESSAGE_SIZE)) {
+        isc_throw(SocketHandoffError, "invalid handoff message length "
+                  << length);
+    }
+
+    std::vector<char> text(length);
+    readData(fd, &text[0], length);
+    return (parseMessage(std::string(text.begin(), text.end())));
+}
+
+void
+SocketHandoff::readData(const int fd, void* data, const size_t size) {
+    uint8_t* ptr = static_cast<uint8_t*>(data);
+    size_t received = 0;
+    while (received < size) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        struct timeval tv;
+        tv.tv_sec = timeout_ / 1000;
+        tv.tv_usec = (timeout_ % 1000) * 1000;
+        const int result = select(fd + 1, &fds, NULL, NULL, &tv);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            isc_throw(SocketHandoffError, "failed to wait for the handoff"
+                      " message: " << strerror(errno));
+
+        } else if (result == 0) {
+            isc_throw(SocketHandoffError, "timeout waiting for the handoff"
+                      " message");
+        }
+
+        const ssize_t cc = read(fd, ptr + received, size - received);
+        if (cc < 0) {
+            if ((errno == EINTR) || (errno == EAGAIN)) {
+                continue;
+            }
+            isc_throw(SocketHandoffError, "failed to read the handoff"
+                      " message: " << strerror(errno));
+
+        } else if (cc == 0) {
+            isc_throw(SocketHandoffError, "the handoff connection has been"
+                      " closed");
+        }
+        received += cc;
+    }
+}
+
+int
+SocketHandoff::receiveDescriptor(const int fd) {
+    // The descriptor comes with one byte of data.
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(fd, &fds);
+    struct timeval tv;
+    tv.tv_sec = timeout_ / 1000;
+    tv.tv_usec = (timeout_ % 1000) * 1000;
+    if (select(fd + 1, &fds, NULL, NULL, &tv) <= 0) {
+        isc_throw(SocketHandoffError, "timeout waiting for a socket"
+                  " descriptor");
+    }
+
+    const int received = util::io::recv_fd(fd);
+    if (received < 0) {
+        isc_throw(SocketHandoffError, "failed to receive a socket"
+                  " descriptor: " << strerror(errno));
+    }
+    static_cast<void>(fcntl(received, F_SETFD, FD_CLOEXEC));
+    return (received);
+}
+
+} // namespace isc::dhcp
+} // namespace isc
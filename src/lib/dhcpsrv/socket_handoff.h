@@ -0,0 +1,298 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SOCKET_HANDOFF_H
+#define SOCKET_HANDOFF_H
+
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+#include <cc/data.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Exception thrown when the sockets can't be handed off.
+class SocketHandoffError : public Exception {
+public:
+    SocketHandoffError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Hands off the open sockets of a server to its successor.
+///
+/// This class allows a new server process to replace a running one, e.g.
+/// during an upgrade, without losing the DHCP packets sent while the new
+/// process loads its configuration. The running process listens on a
+/// UNIX socket, the handoff socket, and passes its open DHCP sockets and
+/// its control socket to the new process connecting to it. The packets
+/// queued in the DHCP sockets are received by the process which reads
+/// them, so the running process keeps serving the clients while the new
+/// process is configured. The exchange is as follows:
+///
+/// - the new process connects to the handoff socket (@c takeOver),
+/// - the running process sends a description of its sockets followed by
+///   their descriptors, which the new process stores as inherited sockets
+///   in the @c IfaceMgr and the @c CommandMgr,
+/// - the new process is configured and opens its sockets, the inherited
+///   ones being used instead of new sockets,
+/// - the new process signals that it is ready (@c complete),
+/// - the running process stops serving, releases its resources (control
+///   socket, PID file, lease database) and confirms it is done,
+/// - the new process starts serving and listens on the handoff socket for
+///   its own successor (@c listen).
+///
+/// The messages are JSON maps preceded by their length as a 32 bits
+/// integer in network byte order. The socket descriptors are transferred
+/// using the @c isc::util::io::send_fd and @c isc::util::io::recv_fd.
+///
+/// If the new process closes the connection before it is ready, e.g. it
+/// fails to load its configuration, the running process goes on as if
+/// nothing happened.
+///
+/// The handoff socket is only accessible to the user running the server
+/// and the connections from the processes of other users are rejected.
+/// The running process never blocks waiting for the new process: the
+/// readiness message is read as it arrives and the connection is dropped
+/// if the new process isn't ready within the readiness timeout. This
+/// deadline is run by a timer started when the connection is accepted,
+/// so as a stalled new process doesn't hold the handoff socket.
+class SocketHandoff : public boost::noncopyable {
+public:
+
+    /// @brief Callback invoked when the successor is ready.
+    ///
+    /// The callback is expected to stop the server and release the
+    /// resources to be used by the successor.
+    typedef boost::function<void()> ReadyCallback;
+
+    /// @brief Default timeout for the handoff messages in milliseconds.
+    static const long DEFAULT_TIMEOUT = 30000;
+
+    /// @brief Default time given to a successor to be ready in
+    /// milliseconds.
+    ///
+    /// It includes the time the successor takes to load its configuration.
+    static const long DEFAULT_READY_TIMEOUT = 300000;
+
+    /// @brief Constructor.
+    ///
+    /// @param socket_name path of the handoff socket.
+    /// @param family family of the DHCP sockets handed off, i.e. AF_INET
+    /// or AF_INET6.
+    /// @param timeout maximum time to wait for a message in milliseconds.
+    /// @param ready_timeout maximum time between the connection of a
+    /// successor and its readiness in milliseconds.
+    ///
+    /// @throw BadValue if the family or a timeout is invalid, or the
+    /// socket name is too long.
+    SocketHandoff(const std::string& socket_name, const uint16_t family,
+                  const long timeout = DEFAULT_TIMEOUT,
+                  const long ready_timeout = DEFAULT_READY_TIMEOUT);
+
+    /// @brief Destructor.
+    ///
+    /// Closes the handoff socket and the connection, if any.
+    ~SocketHandoff();
+
+    /// @brief Takes over the sockets of the running process.
+    ///
+    /// Connects to the handoff socket and receives the sockets of the
+    /// running process, if there is one. The DHCP sockets are added to
+    /// the inherited sockets of the @c IfaceMgr and the control socket to
+    /// the @c CommandMgr.
+    ///
+    /// @return PID of the running process or 0 if there is no process
+    /// listening on the handoff socket.
+    ///
+    /// @throw SocketHandoffError if the sockets can't be received.
+    int takeOver();
+
+    /// @brief Checks if the sockets are being taken over.
+    ///
+    /// @return true between the successful @c takeOver and @c complete.
+    bool isTakingOver() const {
+        return (peer_pid_ != 0);
+    }
+
+    /// @brief Completes the takeover.
+    ///
+    /// Signals to the previous process that this process is ready and
+    /// waits until it has stopped serving. The inherited sockets which
+    /// haven't been used by the configuration are closed.
+    ///
+    /// @throw SocketHandoffError if the previous process didn't confirm
+    /// that it has stopped in time.
+    void complete();
+
+    /// @brief Listens on the handoff socket for a successor.
+    ///
+    /// The handoff socket is installed as an external socket of the
+    /// @c IfaceMgr, so as the connections are accepted and processed
+    /// when the server receives packets. Its permissions are set to 0600.
+    ///
+    /// @param callback function invoked when the successor is ready.
+    ///
+    /// @throw SocketHandoffError if the socket can't be created.
+    void listen(const ReadyCallback& callback);
+
+    /// @brief Closes the handoff socket and the connection.
+    ///
+    /// The socket file is removed unless the sockets have been handed off
+    /// to the successor, which listens on the same path.
+    void close();
+
+    /// @brief Returns the path of the handoff socket.
+    std::string getSocketName() const {
+        return (socket_name_);
+    }
+
+    /// @brief Returns the descriptor of the listening socket or -1.
+    int getListenFD() const {
+        return (listen_fd_);
+    }
+
+private:
+
+    /// @brief Accepts a connection from a successor.
+    ///
+    /// Sends the sockets to the successor and waits for its readiness.
+    void acceptHandler();
+
+    /// @brief Receives the readiness of the successor.
+    ///
+    /// Reads the available data without blocking.
+    void readyHandler();
+
+    /// @brief Reads the available data of the readiness message.
+    ///
+    /// @return the message or a null pointer if it is not complete.
+    ///
+    /// @throw SocketHandoffError if the connection is closed or the message
+    /// is invalid.
+    data::ConstElementPtr readReadyMessage();
+
+    /// @brief Starts the readiness deadline of the connection.
+    ///
+    /// The timer runs in a thread and marks a watch socket ready when it
+    /// expires, which is handled by @c deadlineHandler in the main thread.
+    void startDeadline();
+
+    /// @brief Stops the readiness deadline of the connection, if any.
+    void stopDeadline();
+
+    /// @brief Drops the connection when the successor is not ready in time.
+    void deadlineHandler();
+
+    /// @brief Checks that the peer runs as the same user as this process.
+    ///
+    /// @param fd descriptor of the connection.
+    ///
+    /// @return true if the peer is accepted. A rejection is logged.
+    bool checkPeer(const int fd);
+
+    /// @brief Sends the description and descriptors of the sockets.
+    ///
+    /// @param fd descriptor of the connection.
+    ///
+    /// @return number of DHCP sockets sent.
+    size_t sendSockets(const int fd);
+
+    /// @brief Closes the connection with the peer.
+    ///
+    /// Stops its readiness deadline too.
+    void closeConnection();
+
+    /// @brief Sends a message.
+    ///
+    /// @param fd descriptor of the connection.
+    /// @param message message to send.
+    void sendMessage(const int fd, const data::ConstElementPtr& message);
+
+    /// @brief Receives a message.
+    ///
+    /// @param fd descriptor of the connection.
+    ///
+    /// @return the message.
+    ///
+    /// @throw SocketHandoffError if the connection is closed, no message
+    /// is received within the timeout or the message is invalid.
+    data::ConstElementPtr receiveMessage(const int fd);
+
+    /// @brief Reads data from the connection within the timeout.
+    ///
+    /// @param fd descriptor of the connection.
+    /// @param data buffer receiving the data.
+    /// @param size number of bytes to read.
+    void readData(const int fd, void* data, const size_t size);
+
+    /// @brief Receives a descriptor over the connection.
+    ///
+    /// @param fd descriptor of the connection.
+    ///
+    /// @return the received descriptor.
+    int receiveDescriptor(const int fd);
+
+    /// @brief Path of the handoff socket.
+    std::string socket_name_;
+
+    /// @brief Family of the DHCP sockets.
+    uint16_t family_;
+
+    /// @brief Timeout in milliseconds.
+    long timeout_;
+
+    /// @brief Readiness timeout of a successor in milliseconds.
+    long ready_timeout_;
+
+    /// @brief Descriptor of the listening socket or -1.
+    int listen_fd_;
+
+    /// @brief Descriptor of the connection with the peer or -1.
+    int conn_fd_;
+
+    /// @brief PID of the process being replaced while taking over, or 0.
+    int peer_pid_;
+
+    /// @brief Data of the readiness message received so far.
+    std::vector<uint8_t> ready_data_;
+
+    /// @brief IO service running the readiness deadline timer.
+    asiolink::IOServicePtr deadline_service_;
+
+    /// @brief Readiness deadline timer of the connection.
+    boost::shared_ptr<asiolink::IntervalTimer> deadline_timer_;
+
+    /// @brief Watch socket marked ready when the deadline expires.
+    boost::shared_ptr<util::WatchSocket> deadline_socket_;
+
+    /// @brief Thread running the deadline timer.
+    boost::shared_ptr<util::thread::Thread> deadline_thread_;
+
+    /// @brief The sockets have been handed off to a successor.
+    bool handed_off_;
+
+    /// @brief Callback invoked when the successor is ready.
+    ReadyCallback ready_callback_;
+};
+
+/// @brief Pointer to the @c SocketHandoff.
+typedef boost::shared_ptr<SocketHandoff> SocketHandoffPtr;
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // SOCKET_HANDOFF_H
@@ -8,17 +8,42 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/srv_config.h>
 #include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/timer_mgr.h>
 #include <log/logger_manager.h>
 #include <log/logger_specification.h>
 #include <dhcp/pkt.h> // Needed for HWADDR_SOURCE_*
+#include <stats/stats_mgr.h>
 #include <list>
 #include <sstream>
 
 using namespace isc::log;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Name of the statistic counting the dropped log messages.
+const char* LOG_MESSAGES_DROPPED = "log-messages-dropped";
+
+/// @brief Interval of the timer publishing the dropped log messages (ms).
+const long DROPPED_LOG_TIMER_INTERVAL = 1000;
+
+/// @brief Number of the messages dropped by the current asynchronous log
+/// writer which have been added to the statistic.
+///
+/// Only used by the main thread.
+uint64_t dropped_log_messages_published = 0;
+
+}
 
 namespace isc {
 namespace dhcp {
 
+const std::string SrvConfig::SUPPRESSED_LOG_TIMER_NAME =
+    "report-suppressed-log-messages";
+
+const std::string SrvConfig::DROPPED_LOG_TIMER_NAME =
+    "report-dropped-log-messages";
+
 SrvConfig::SrvConfig()
     : sequence_(0), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
@@ -29,7 +54,7 @@ SrvConfig::SrvConfig()
       cfg_host_operations4_(CfgHostOperations::createConfig4()),
       cfg_host_operations6_(CfgHostOperations::createConfig6()),
       class_dictionary_(new ClientClassDictionary()),
-      decline_timer_(0), dhcp4o6_port_(0),
+      decline_timer_(0), dhcp4o6_port_(0), packet_timeline_(true),
       d2_client_config_(new D2ClientConfig()) {
 }
 
@@ -43,7 +68,7 @@ SrvConfig::SrvConfig(const uint32_t sequence)
       cfg_host_operations4_(CfgHostOperations::createConfig4()),
       cfg_host_operations6_(CfgHostOperations::createConfig6()),
       class_dictionary_(new ClientClassDictionary()),
-      decline_timer_(0), dhcp4o6_port_(0),
+      decline_timer_(0), dhcp4o6_port_(0), packet_timeline_(true),
       d2_client_config_(new D2ClientConfig()) {
 }
 
@@ -101,6 +126,7 @@ SrvConfig::copy(SrvConfig& new_config) const {
          it != logging_info_.end(); ++it) {
         new_config.addLoggingInfo(*it);
     }
+    new_config.setAsyncLoggingInfo(async_logging_info_);
     // Replace interface configuration.
     new_config.cfg_iface_.reset(new CfgIface(*cfg_iface_));
     // Replace option definitions.
@@ -114,6 +140,16 @@ SrvConfig::copy(SrvConfig& new_config) const {
 
 void
 SrvConfig::applyLoggingCfg() const {
+    // The messages dropped by the current writer are counted before it
+    // is replaced.
+    publishDroppedLogMessages();
+    dropped_log_messages_published = 0;
+
+    // The messages queued so far are written with the current configuration
+    // before it is replaced.
+    if (!async_logging_info_.enabled_) {
+        LoggerManager::stopAsync();
+    }
 
     std::list<LoggerSpecification> specs;
     for (LoggingInfoStorage::const_iterator it = logging_info_.begin();
@@ -122,6 +158,62 @@ SrvConfig::applyLoggingCfg() const {
     }
     LoggerManager manager;
     manager.process(specs.begin(), specs.end());
+
+    if (async_logging_info_.enabled_) {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        if (!stats_mgr.getObservation(LOG_MESSAGES_DROPPED)) {
+            stats_mgr.setValue(LOG_MESSAGES_DROPPED, static_cast<int64_t>(0));
+        }
+        LoggerManager::startAsync(async_logging_info_.queue_size_,
+                                  async_logging_info_.overflow_policy_);
+    }
+}
+
+void
+SrvConfig::setupLogTimers() const {
+    TimerMgrPtr timer_mgr = TimerMgr::instance();
+    if (async_logging_info_.enabled_) {
+        timer_mgr->registerTimer(DROPPED_LOG_TIMER_NAME,
+                                 &SrvConfig::publishDroppedLogMessages,
+                                 DROPPED_LOG_TIMER_INTERVAL,
+                                 asiolink::IntervalTimer::REPEATING);
+        timer_mgr->setup(DROPPED_LOG_TIMER_NAME);
+    }
+
+    uint32_t interval = 0;
+    for (LoggingInfoStorage::const_iterator it = logging_info_.begin();
+         it != logging_info_.end(); ++it) {
+        for (std::vector<MessageLimit>::const_iterator limit =
+                 it->limits_.begin(); limit != it->limits_.end(); ++limit) {
+            if ((interval == 0) || (limit->interval < interval)) {
+                interval = limit->interval;
+            }
+        }
+    }
+    if (interval == 0) {
+        return;
+    }
+
+    timer_mgr->registerTimer(SUPPRESSED_LOG_TIMER_NAME,
+                             &LoggerManager::flushSuppressedMessages,
+                             1000 * static_cast<long>(interval),
+                             asiolink::IntervalTimer::REPEATING);
+    timer_mgr->setup(SUPPRESSED_LOG_TIMER_NAME);
+}
+
+void
+SrvConfig::publishDroppedLogMessages() {
+    AsyncLogWriterPtr writer = LoggerManager::getAsyncWriter();
+    if (!writer) {
+        return;
+    }
+    const uint64_t dropped = writer->getDroppedNum();
+    if (dropped > dropped_log_messages_published) {
+        StatsMgr::instance().addValue(LOG_MESSAGES_DROPPED,
+                                      static_cast<int64_t>(dropped -
+                                          dropped_log_messages_published));
+        dropped_log_messages_published = dropped;
+    }
 }
 
 bool
@@ -151,7 +243,8 @@ SrvConfig::equals(const SrvConfig& other) const {
         }
     }
     // Logging information is equal between objects, so check other values.
-    return ((*cfg_iface_ == *other.cfg_iface_) &&
+    return ((async_logging_info_ == other.async_logging_info_) &&
+            (*cfg_iface_ == *other.cfg_iface_) &&
             (*cfg_option_def_ == *other.cfg_option_def_) &&
             (*cfg_option_ == *other.cfg_option_) &&
             (*class_dictionary_ == *other.class_dictionary_) &&
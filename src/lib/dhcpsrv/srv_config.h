@@ -129,6 +129,18 @@ public:
         logging_info_.push_back(logging_info);
     }
 
+    /// @brief Returns the asynchronous logging configuration.
+    const AsyncLoggingInfo& getAsyncLoggingInfo() const {
+        return (async_logging_info_);
+    }
+
+    /// @brief Sets the asynchronous logging configuration.
+    ///
+    /// @param async_logging_info New asynchronous logging configuration.
+    void setAsyncLoggingInfo(const AsyncLoggingInfo& async_logging_info) {
+        async_logging_info_ = async_logging_info;
+    }
+
     /// @brief Returns non-const pointer to interface configuration.
     ///
     /// This function returns a non-const pointer to the interface
@@ -384,8 +396,40 @@ public:
     void copy(SrvConfig& new_config) const;
 
     /// @brief Apply logging configuration to log4cplus.
+    ///
+    /// It also enables or disables the asynchronous logging. When the
+    /// asynchronous logging is enabled the dropped messages are counted
+    /// in the "log-messages-dropped" statistic.
     void applyLoggingCfg() const;
 
+    /// @brief Name of the timer reporting the suppressed log messages.
+    static const std::string SUPPRESSED_LOG_TIMER_NAME;
+
+    /// @brief Name of the timer publishing the dropped log messages.
+    static const std::string DROPPED_LOG_TIMER_NAME;
+
+    /// @brief Installs the timers reporting the suppressed and dropped log
+    /// messages.
+    ///
+    /// The messages suppressed by the "rate-limits" of the loggers are
+    /// otherwise only reported when a message matching the same limit is
+    /// logged. The timer is not installed when no limit is configured,
+    /// and its interval is the shortest interval of the limits.
+    ///
+    /// When the asynchronous logging is enabled a second timer publishes
+    /// the number of dropped messages every second.
+    ///
+    /// The existing timers must have been unregistered.
+    void setupLogTimers() const;
+
+    /// @brief Publishes the log messages dropped by the asynchronous logging.
+    ///
+    /// Adds the messages dropped since the last call to the
+    /// "log-messages-dropped" statistic. The writer only counts the dropped
+    /// messages, so the statistics are never updated by the threads which
+    /// are logging. This function must be called from the main thread.
+    static void publishDroppedLogMessages();
+
     /// @name Methods and operators used to compare configurations.
     ///
     //@{
@@ -489,6 +533,22 @@ public:
         return (dhcp4o6_port_);
     }
 
+    /// @brief Sets whether the packet processing timeline is recorded
+    ///
+    /// @param enabled true if the latency histograms should be updated
+    /// for each processed packet
+    void setPacketTimeline(const bool enabled) {
+        packet_timeline_ = enabled;
+    }
+
+    /// @brief Returns whether the packet processing timeline is recorded
+    ///
+    /// See @ref setPacketTimeline for brief discussion.
+    /// @return true if the latency histograms are updated
+    bool getPacketTimeline() const {
+        return (packet_timeline_);
+    }
+
     /// @brief Returns pointer to the D2 client configuration
     D2ClientConfigPtr getD2ClientConfig() {
         return (d2_client_config_);
@@ -513,6 +573,9 @@ private:
     /// @brief Logging specific information.
     LoggingInfoStorage logging_info_;
 
+    /// @brief Asynchronous logging configuration.
+    AsyncLoggingInfo async_logging_info_;
+
     /// @brief Interface configuration.
     ///
     /// Used to select interfaces on which the DHCP server will listen to
@@ -589,6 +652,11 @@ private:
     /// this socket is bound and connected to this port and port + 1
     uint32_t dhcp4o6_port_;
 
+    /// @brief Packet processing timeline recording
+    ///
+    /// Enables updating the latency histograms for each processed packet.
+    bool packet_timeline_;
+
     D2ClientConfigPtr d2_client_config_;
 };
 
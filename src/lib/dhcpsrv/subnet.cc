@@ -66,6 +66,10 @@ Subnet::Subnet(const isc::asiolink::IOAddress& prefix, uint8_t len,
         isc_throw(BadValue,
                   "Invalid prefix length specified for subnet: " << len);
     }
+
+    const AddressValue prefix_value(prefix);
+    first_value_ = prefix_value.firstInPrefix(len);
+    last_value_ = prefix_value.lastInPrefix(len);
 }
 
 Subnet::RelayInfo::RelayInfo(const isc::asiolink::IOAddress& addr)
@@ -74,10 +78,7 @@ Subnet::RelayInfo::RelayInfo(const isc::asiolink::IOAddress& addr)
 
 bool
 Subnet::inRange(const isc::asiolink::IOAddress& addr) const {
-    IOAddress first = firstAddrInPrefix(prefix_, prefix_len_);
-    IOAddress last = lastAddrInPrefix(prefix_, prefix_len_);
-
-    return ((first <= addr) && (addr <= last));
+    return (AddressValue(addr).inRange(first_value_, last_value_));
 }
 
 void
@@ -7,6 +7,7 @@
 #ifndef SUBNET_H
 #define SUBNET_H
 
+#include <asiolink/address_value.h>
 #include <asiolink/io_address.h>
 #include <dhcp/option.h>
 #include <dhcp/classify.h>
@@ -439,6 +440,15 @@ protected:
     /// @brief a prefix length of the subnet
     uint8_t prefix_len_;
 
+    /// @brief numeric value of the first address in the subnet
+    ///
+    /// It is computed once in the constructor so as @c inRange doesn't
+    /// compute it for each checked address.
+    isc::asiolink::AddressValue first_value_;
+
+    /// @brief numeric value of the last address in the subnet
+    isc::asiolink::AddressValue last_value_;
+
     /// @brief a tripet (min/default/max) holding allowed renew timer values
     Triplet<uint32_t> t1_;
 
@@ -0,0 +1,306 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcpsrv/binary_lease_file.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/tests/lease_file_io.h>
+#include <dhcpsrv/tests/test_utils.h>
+#include <util/csv_file.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+using namespace isc::util;
+
+namespace {
+
+// HWADDR values used by unit tests.
+const uint8_t HWADDR0[] = { 0, 1, 2, 3, 4, 5 };
+const uint8_t HWADDR1[] = { 0xd, 0xe, 0xa, 0xd, 0xb, 0xe, 0xe, 0xf };
+
+const uint8_t CLIENTID[] = { 1, 2, 3, 4 };
+
+const uint8_t DUID0[] = { 0, 1, 2, 3, 4, 5, 6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf };
+
+/// @brief Test fixture class for the binary lease files.
+class BinaryLeaseFileTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Initializes IO for lease file used by unit tests.
+    BinaryLeaseFileTest()
+        : filename_(absolutePath("leases.bin")), io_(filename_) {
+        hwaddr0_.reset(new HWAddr(HWADDR0, sizeof(HWADDR0), HTYPE_ETHER));
+        hwaddr1_.reset(new HWAddr(HWADDR1, sizeof(HWADDR1), 32));
+    }
+
+    /// @brief Prepends the absolute path to the file specified
+    /// as an argument.
+    ///
+    /// @param filename Name of the file.
+    /// @return Absolute path to the test file.
+    static std::string absolutePath(const std::string& filename) {
+        std::ostringstream s;
+        s << DHCP_DATA_DIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Writes two DHCPv4 leases to the lease file.
+    void writeLeases4() {
+        BinaryLeaseFile4 lf(filename_);
+        ASSERT_NO_THROW(lf.open());
+        ASSERT_NO_THROW(lf.append(*lease4_[0]));
+        ASSERT_NO_THROW(lf.append(*lease4_[1]));
+        EXPECT_EQ(2, lf.getWriteLeases());
+    }
+
+    /// @brief Reads the DHCPv4 leases from the lease file.
+    ///
+    /// @param lf Lease file.
+    /// @param [out] leases Leases read.
+    /// @return Number of read errors.
+    uint32_t readLeases4(BinaryLeaseFile4& lf, Lease4Collection& leases) {
+        Lease4Ptr lease;
+        uint32_t errors = 0;
+        while (true) {
+            if (!lf.next(lease)) {
+                ++errors;
+            } else if (!lease) {
+                break;
+            } else {
+                leases.push_back(lease);
+            }
+        }
+        return (errors);
+    }
+
+    /// @brief Creates the leases used by the tests.
+    virtual void SetUp() {
+        Lease4Ptr lease(new Lease4(IOAddress("192.0.3.2"), hwaddr0_, NULL, 0,
+                                   200, 0, 0, 1500000000, 8, true, true,
+                                   "host.example.com"));
+        lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        lease4_.push_back(lease);
+        lease.reset(new Lease4(IOAddress("192.0.3.10"), hwaddr1_, CLIENTID,
+                               sizeof(CLIENTID), 100, 0, 0, -5, 7));
+        lease4_.push_back(lease);
+    }
+
+    /// @brief Name of the test lease file.
+    std::string filename_;
+
+    /// @brief Object providing access to lease file IO.
+    LeaseFileIO io_;
+
+    /// @brief hardware address 0 (corresponds to HWADDR0 const)
+    HWAddrPtr hwaddr0_;
+
+    /// @brief hardware address 1 (corresponds to HWADDR1 const)
+    HWAddrPtr hwaddr1_;
+
+    /// @brief DHCPv4 leases used by the tests.
+    Lease4Collection lease4_;
+};
+
+// This test checks that the DHCPv4 leases are written and read back.
+TEST_F(BinaryLeaseFileTest, readWrite4) {
+    EXPECT_FALSE(BinaryLeaseFile::isBinaryFile(filename_));
+    writeLeases4();
+    EXPECT_TRUE(BinaryLeaseFile::isBinaryFile(filename_));
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease4Collection leases;
+    EXPECT_EQ(0, readLeases4(lf, leases));
+    ASSERT_EQ(2, leases.size());
+    detailCompareLease(lease4_[0], leases[0]);
+    detailCompareLease(lease4_[1], leases[1]);
+    EXPECT_EQ(3, lf.getReads());
+    EXPECT_EQ(2, lf.getReadLeases());
+
+    // A lease without hardware address can't be written.
+    Lease4 lease(*lease4_[0]);
+    lease.hwaddr_.reset();
+    EXPECT_THROW(lf.append(lease), BadValue);
+    EXPECT_EQ(1, lf.getWriteErrs());
+
+    // Leases are appended after the existing ones.
+    lease4_[0]->valid_lft_ = 0;
+    ASSERT_NO_THROW(lf.append(*lease4_[0]));
+    lf.close();
+    ASSERT_NO_THROW(lf.open());
+    leases.clear();
+    EXPECT_EQ(0, readLeases4(lf, leases));
+    ASSERT_EQ(3, leases.size());
+    detailCompareLease(lease4_[0], leases[2]);
+}
+
+// This test checks that the DHCPv6 leases are written and read back.
+TEST_F(BinaryLeaseFileTest, readWrite6) {
+    DuidPtr duid(new DUID(DUID0, sizeof(DUID0)));
+    Lease6Ptr lease_na(new Lease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1"),
+                                  duid, 7, 150, 300, 0, 0, 8, true, true,
+                                  "host.example.com", hwaddr1_));
+    lease_na->cltt_ = 1500000000;
+    Lease6Ptr lease_pd(new Lease6(Lease::TYPE_PD, IOAddress("3000:1:1::"),
+                                  duid, 8, 150, 300, 0, 0, 6, false, false,
+                                  "", HWAddrPtr(), 64));
+    lease_pd->state_ = Lease::STATE_DECLINED;
+    {
+        BinaryLeaseFile6 lf(filename_);
+        ASSERT_NO_THROW(lf.open());
+        ASSERT_NO_THROW(lf.append(*lease_na));
+        ASSERT_NO_THROW(lf.append(*lease_pd));
+    }
+
+    BinaryLeaseFile6 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease6Ptr lease;
+    ASSERT_TRUE(lf.next(lease));
+    ASSERT_TRUE(lease);
+    detailCompareLease(lease_na, lease);
+    ASSERT_TRUE(lf.next(lease));
+    ASSERT_TRUE(lease);
+    detailCompareLease(lease_pd, lease);
+    EXPECT_FALSE(lease->hwaddr_);
+    ASSERT_TRUE(lf.next(lease));
+    EXPECT_FALSE(lease);
+
+    // The file of DHCPv6 leases can't be opened as a file of DHCPv4 leases.
+    BinaryLeaseFile4 lf4(filename_);
+    EXPECT_THROW(lf4.open(), CSVFileError);
+}
+
+// This test checks that a record with a bad checksum is skipped.
+TEST_F(BinaryLeaseFileTest, badChecksum) {
+    writeLeases4();
+    std::string contents = io_.readFile();
+    // Corrupt the last byte of the first record.
+    const size_t first_end = contents.find("host.example.com") +
+        strlen("host.example.com");
+    contents[first_end - 1] ^= 0x20;
+    io_.writeFile(contents);
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease4Collection leases;
+    EXPECT_EQ(1, readLeases4(lf, leases));
+    EXPECT_EQ("bad record checksum", lf.getReadMsg());
+    ASSERT_EQ(1, leases.size());
+    detailCompareLease(lease4_[1], leases[0]);
+    EXPECT_EQ(1, lf.getReadErrs());
+}
+
+// This test checks that an incomplete record at the end of the file is
+// discarded before new leases are appended.
+TEST_F(BinaryLeaseFileTest, incompleteRecord) {
+    writeLeases4();
+    std::string contents = io_.readFile();
+    io_.writeFile(contents.substr(0, contents.size() - 3));
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease4Collection leases;
+    EXPECT_EQ(1, readLeases4(lf, leases));
+    ASSERT_EQ(1, leases.size());
+
+    ASSERT_NO_THROW(lf.append(*lease4_[1]));
+    lf.close();
+
+    ASSERT_NO_THROW(lf.open());
+    leases.clear();
+    EXPECT_EQ(0, readLeases4(lf, leases));
+    ASSERT_EQ(2, leases.size());
+    detailCompareLease(lease4_[0], leases[0]);
+    detailCompareLease(lease4_[1], leases[1]);
+}
+
+// This test checks that a record cut within its header at the end of the
+// file is discarded, and only when new leases are appended.
+TEST_F(BinaryLeaseFileTest, incompleteHeader) {
+    writeLeases4();
+    std::string contents = io_.readFile();
+    const size_t first_end = contents.find("host.example.com") +
+        strlen("host.example.com");
+    const std::string torn = contents.substr(0, first_end + 5);
+    io_.writeFile(torn);
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease4Collection leases;
+    EXPECT_EQ(1, readLeases4(lf, leases));
+    ASSERT_EQ(1, leases.size());
+
+    // Closing the file leaves it untouched.
+    lf.close();
+    EXPECT_EQ(torn, io_.readFile());
+
+    ASSERT_NO_THROW(lf.open());
+    leases.clear();
+    EXPECT_EQ(1, readLeases4(lf, leases));
+    ASSERT_NO_THROW(lf.append(*lease4_[1]));
+    lf.close();
+    EXPECT_EQ(contents, io_.readFile());
+}
+
+// This test checks that the incomplete record is not discarded if the
+// file has grown since it was read.
+TEST_F(BinaryLeaseFileTest, incompleteRecordGrown) {
+    writeLeases4();
+    std::string contents = io_.readFile();
+    io_.writeFile(contents.substr(0, contents.size() - 3));
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease4Collection leases;
+    EXPECT_EQ(1, readLeases4(lf, leases));
+
+    // Another writer completes the record.
+    io_.writeFile(contents);
+    EXPECT_THROW(lf.append(*lease4_[0]), CSVFileError);
+    lf.close();
+    EXPECT_EQ(contents, io_.readFile());
+}
+
+// This test checks that a corrupted record length makes the read fail,
+// rather than the following records being taken for an incomplete record.
+TEST_F(BinaryLeaseFileTest, corruptedLength) {
+    writeLeases4();
+    std::string contents = io_.readFile();
+    // Make the length of the first record larger than the file.
+    contents[BinaryLeaseFile::HEADER_SIZE + 2] ^= 0x01;
+    io_.writeFile(contents);
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease4Ptr lease;
+    EXPECT_THROW(lf.next(lease), CSVFileError);
+    EXPECT_FALSE(lease);
+    EXPECT_EQ(1, lf.getReadErrs());
+
+    // The file is left untouched.
+    lf.close();
+    EXPECT_EQ(contents, io_.readFile());
+}
+
+// This test checks that a file which isn't a binary lease file is
+// rejected.
+TEST_F(BinaryLeaseFileTest, invalidHeader) {
+    io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state\n");
+    EXPECT_FALSE(BinaryLeaseFile::isBinaryFile(filename_));
+    BinaryLeaseFile4 lf(filename_);
+    EXPECT_THROW(lf.open(), CSVFileError);
+}
+
+} // end of anonymous namespace
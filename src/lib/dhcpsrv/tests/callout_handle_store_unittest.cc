@@ -94,6 +94,37 @@ TEST(CalloutHandleStoreTest, StoreRetrieve) {
     EXPECT_EQ(1, pktptr_2.use_count());
 }
 
+// Check that the CalloutHandle is recycled for a new packet when nothing else
+// refers to it, and that it is then cleared.
+
+TEST(CalloutHandleStoreTest, RecycleHandle) {
+
+    Pkt4Ptr pktptr_1(new Pkt4(DHCPDISCOVER, 1234));
+    Pkt4Ptr pktptr_2(new Pkt4(DHCPDISCOVER, 5678));
+
+    // Get the CalloutHandle for the first packet and pass the packet as an
+    // argument, as the server does.
+    CalloutHandlePtr chptr = getCalloutHandle(pktptr_1);
+    ASSERT_TRUE(chptr);
+    CalloutHandle* handle = chptr.get();
+    chptr->setArgument("query4", pktptr_1);
+    chptr->setStatus(CalloutHandle::NEXT_STEP_SKIP);
+    EXPECT_EQ(3, pktptr_1.use_count());
+    chptr.reset();
+
+    // The handle for the second packet is the same object, but it no longer
+    // holds the first packet.
+    chptr = getCalloutHandle(pktptr_2);
+    EXPECT_EQ(handle, chptr.get());
+    EXPECT_EQ(1, pktptr_1.use_count());
+    EXPECT_TRUE(chptr->getArgumentNames().empty());
+    EXPECT_EQ(CalloutHandle::NEXT_STEP_CONTINUE, chptr->getStatus());
+
+    // Clear the stored pointers.
+    chptr.reset();
+    EXPECT_FALSE(getCalloutHandle(Pkt4Ptr()));
+}
+
 // The followings is a trival test to check that if the template function
 // is referred to in a separate compilation unit, only one copy of the static
 // objects stored in it are returned.  (For a change, we'll use a Pkt6 as the
@@ -261,6 +261,39 @@ TEST_F(DaemonTest, PIDFileCleanup) {
     EXPECT_EQ(errno, ENOENT);
 }
 
+// Verifies that the PID file of the replaced process is taken over and
+// that the released PID file is not deleted.
+TEST_F(DaemonTest, takeOverPIDFile) {
+    boost::shared_ptr<DaemonImpl> previous(new DaemonImpl);
+    previous->setConfigFile("test.conf");
+    previous->setProcName("daemon_test");
+    previous->setPIDFileDir(TEST_DATA_BUILDDIR);
+    ASSERT_NO_THROW(previous->createPIDFile());
+
+    boost::shared_ptr<DaemonImpl> instance(new DaemonImpl);
+    instance->setConfigFile("test.conf");
+    instance->setProcName("daemon_test");
+    instance->setPIDFileDir(TEST_DATA_BUILDDIR);
+
+    // The PID file refers to a live process which is not the replaced one.
+    EXPECT_THROW(instance->takeOverPIDFile(getpid() + 1), DaemonPIDExists);
+
+    // Both instances run in this process, so the replaced process is this
+    // one.
+    EXPECT_NO_THROW(instance->takeOverPIDFile(getpid()));
+
+    // The replaced process releases the PID file.
+    std::string pid_file_name = instance->getPIDFileName();
+    previous->releasePIDFile();
+    previous.reset();
+    struct stat stat_buf;
+    EXPECT_EQ(0, stat(pid_file_name.c_str(), &stat_buf));
+
+    instance.reset();
+    ASSERT_EQ(-1, stat(pid_file_name.c_str(), &stat_buf));
+    EXPECT_EQ(errno, ENOENT);
+}
+
 // Checks that configureLogger method is behaving properly.
 // More dedicated tests are available for LogConfigParser class.
 // See logger_unittest.cc
@@ -0,0 +1,189 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/incremental_config_cache.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for the @c IncrementalConfigCache.
+class IncrementalConfigCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Resets the configuration and the cache.
+    IncrementalConfigCacheTest()
+        : cache_(IncrementalConfigCache::instance()) {
+        CfgMgr::instance().clear();
+        cache_.clear();
+    }
+
+    /// @brief Destructor.
+    virtual ~IncrementalConfigCacheTest() {
+        CfgMgr::instance().clear();
+        cache_.clear();
+    }
+
+    /// @brief Returns the configuration of a subnet.
+    ///
+    /// @param id subnet identifier.
+    /// @param prefix subnet prefix.
+    ElementPtr subnetConfig(const int id, const std::string& prefix) {
+        std::ostringstream s;
+        s << "{ \"id\": " << id << ", \"subnet\": \"" << prefix << "\","
+          " \"reservations\": [ { \"hw-address\": \"01:02:03:04:05:06\","
+          " \"hostname\": \"foo\" } ] }";
+        return (Element::fromJSON(s.str()));
+    }
+
+    /// @brief Parses a configuration as the server would do.
+    ///
+    /// Subnets which are not found in the cache are created and
+    /// recorded with a host reservation, unless they have no identifier.
+    ///
+    /// @param subnets list of the subnet configurations.
+    /// @param option_defs option definitions.
+    /// @param commit commit the configuration.
+    void configure(const std::vector<ConstElementPtr>& subnets,
+                   const ConstElementPtr& option_defs, const bool commit) {
+        CfgMgr::instance().rollback();
+        cache_.startConfig(option_defs);
+        for (size_t i = 0; i < subnets.size(); ++i) {
+            SubnetPtr subnet = cache_.getSubnet(subnets[i]);
+            if (!subnet) {
+                subnet.reset(new Subnet4(IOAddress(subnets[i]->get("subnet")->
+                                                   stringValue()),
+                                         24, 1, 2, 3,
+                                         subnets[i]->get("id")->intValue()));
+                HostCollection hosts;
+                if (subnets[i]->get("id")->intValue() != 0) {
+                    HostPtr host(new Host("01:02:03:04:05:06", "hw-address",
+                                          subnet->getID(), SubnetID(0),
+                                          IOAddress("0.0.0.0"), "foo"));
+                    CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(host);
+                    hosts.push_back(host);
+                }
+                cache_.addSubnet(subnets[i], subnet, hosts);
+            }
+            subnets_.push_back(subnet);
+        }
+        if (commit) {
+            cache_.commit();
+            CfgMgr::instance().commit();
+        }
+    }
+
+    /// @brief Checks that the staging configuration holds the host
+    /// reservation of a subnet.
+    ///
+    /// @param id subnet identifier.
+    bool hasHost(const SubnetID& id) {
+        HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06")));
+        return (static_cast<bool>(CfgMgr::instance().getStagingCfg()->
+                                  getCfgHosts()->get4(id, hwaddr)));
+    }
+
+    /// @brief The cache.
+    IncrementalConfigCache& cache_;
+
+    /// @brief Subnets returned by the cache or created by @c configure.
+    std::vector<SubnetPtr> subnets_;
+};
+
+// This test checks that unchanged subnets are reused with their
+// reservations.
+TEST_F(IncrementalConfigCacheTest, reuseSubnets) {
+    std::vector<ConstElementPtr> subnets;
+    subnets.push_back(subnetConfig(1, "192.0.2.0"));
+    subnets.push_back(subnetConfig(2, "192.0.3.0"));
+    subnets.push_back(subnetConfig(0, "192.0.4.0"));
+    ASSERT_NO_FATAL_FAILURE(configure(subnets, ConstElementPtr(), true));
+    EXPECT_EQ(0, cache_.getReusedSubnets());
+    EXPECT_EQ(3, cache_.getParsedSubnets());
+    std::vector<SubnetPtr> current;
+    current.swap(subnets_);
+
+    // The second subnet changes and the third has no identifier.
+    std::vector<ConstElementPtr> new_subnets;
+    new_subnets.push_back(subnetConfig(1, "192.0.2.0"));
+    new_subnets.push_back(subnetConfig(2, "192.0.5.0"));
+    new_subnets.push_back(subnetConfig(0, "192.0.4.0"));
+    ASSERT_NO_FATAL_FAILURE(configure(new_subnets, ConstElementPtr(), false));
+    EXPECT_EQ(1, cache_.getReusedSubnets());
+    EXPECT_EQ(2, cache_.getParsedSubnets());
+    EXPECT_TRUE(subnets_[0] == current[0]);
+    EXPECT_FALSE(subnets_[1] == current[1]);
+    EXPECT_FALSE(subnets_[2] == current[2]);
+    EXPECT_TRUE(hasHost(1));
+    EXPECT_TRUE(hasHost(2));
+
+    // The configuration hasn't been committed so the subnets of the
+    // configuration in use are reused.
+    subnets_.clear();
+    ASSERT_NO_FATAL_FAILURE(configure(subnets, ConstElementPtr(), true));
+    EXPECT_EQ(2, cache_.getReusedSubnets());
+    EXPECT_EQ(1, cache_.getParsedSubnets());
+    EXPECT_TRUE(subnets_[0] == current[0]);
+    EXPECT_TRUE(subnets_[1] == current[1]);
+    EXPECT_FALSE(subnets_[2] == current[2]);
+}
+
+// This test checks that nothing is reused when the dependencies change
+// or when the configuration in use is not the one cached.
+TEST_F(IncrementalConfigCacheTest, invalidate) {
+    std::vector<ConstElementPtr> subnets;
+    subnets.push_back(subnetConfig(1, "192.0.2.0"));
+    ConstElementPtr option_defs = Element::fromJSON("[ { \"code\": 100 } ]");
+    ASSERT_NO_FATAL_FAILURE(configure(subnets, option_defs, true));
+
+    // Same dependencies: the subnet is reused.
+    ASSERT_NO_FATAL_FAILURE(configure(subnets, option_defs, true));
+    EXPECT_EQ(1, cache_.getReusedSubnets());
+
+    // Other dependencies: the subnet is parsed.
+    ASSERT_NO_FATAL_FAILURE(configure(subnets, ConstElementPtr(), true));
+    EXPECT_EQ(0, cache_.getReusedSubnets());
+    EXPECT_EQ(1, cache_.getParsedSubnets());
+
+    // The configuration in use has been replaced.
+    CfgMgr::instance().clear();
+    ASSERT_NO_FATAL_FAILURE(configure(subnets, ConstElementPtr(), true));
+    EXPECT_EQ(0, cache_.getReusedSubnets());
+
+    // A duplicated subnet is not reused twice.
+    subnets.push_back(subnetConfig(1, "192.0.2.0"));
+    cache_.startConfig(ConstElementPtr());
+    EXPECT_TRUE(cache_.getSubnet(subnets[0]));
+    EXPECT_FALSE(cache_.getSubnet(subnets[1]));
+}
+
+// This test checks that unchanged client classes are reused.
+TEST_F(IncrementalConfigCacheTest, reuseClientClasses) {
+    ConstElementPtr classes = Element::fromJSON("[ { \"name\": \"foo\" } ]");
+    cache_.startConfig(ConstElementPtr());
+    EXPECT_FALSE(cache_.getClientClasses(classes));
+    ClientClassDictionaryPtr dictionary(new ClientClassDictionary());
+    cache_.addClientClasses(classes, dictionary);
+    cache_.commit();
+    CfgMgr::instance().commit();
+
+    cache_.startConfig(ConstElementPtr());
+    EXPECT_TRUE(cache_.getClientClasses(classes) == dictionary);
+    EXPECT_FALSE(cache_.getClientClasses(Element::fromJSON("[ ]")));
+}
+
+} // end of anonymous namespace
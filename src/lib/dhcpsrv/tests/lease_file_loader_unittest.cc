@@ -43,7 +43,7 @@ public:
     /// @brief Retrieves the lease from the storage using an IP address.
     ///
     /// This method returns the pointer to the @c Lease4 or @c Lease6
-    /// object representing the lease in the container. This is used to
+    /// object created from the lease record in the container. This is used to
     /// check if the lease was parsed in the lease file and added to the
     /// container by the @c LeaseFileLoader::load method.
     ///
@@ -62,10 +62,11 @@ public:
         // Both Lease4Storage and Lease6Storage use index 0 to retrieve the
         // lease using an IP address.
         const SearchIndex& idx = storage.template get<0>();
-        typename SearchIndex::iterator lease = idx.find(IOAddress(address));
+        typename SearchIndex::iterator lease =
+            idx.find(LeaseStorage::value_type::addressKey(IOAddress(address)));
         // Lease found. Return it.
         if (lease != idx.end()) {
-            return (*lease);
+            return (lease->toLease());
         }
         // No lease found.
         return (LeasePtrType());
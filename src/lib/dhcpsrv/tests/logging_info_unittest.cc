@@ -147,6 +147,32 @@ TEST_F(LoggingInfoTest, equalityOperators) {
     EXPECT_FALSE(info1 == info2);
     EXPECT_TRUE(info1 != info2);
 
+    // Make the destinations equal again.
+    info2.destinations_[2] = dest1;
+    ASSERT_TRUE(info1 == info2);
+
+    // Differ by rate limits.
+    isc::log::MessageLimit limit1;
+    limit1.message = "FOO";
+    limit1.rate = 10;
+    isc::log::MessageLimit limit2 = limit1;
+    limit2.message = "BAR";
+    info1.limits_.push_back(limit1);
+    info1.limits_.push_back(limit2);
+    info2.limits_.push_back(limit2);
+    EXPECT_FALSE(info1 == info2);
+    EXPECT_TRUE(info1 != info2);
+
+    // The order of the limits matters.
+    info2.limits_.push_back(limit1);
+    EXPECT_FALSE(info1 == info2);
+    EXPECT_TRUE(info1 != info2);
+
+    // Rate limits equal.
+    info2.limits_[0] = limit1;
+    info2.limits_[1] = limit2;
+    EXPECT_TRUE(info1 == info2);
+    EXPECT_FALSE(info1 != info2);
 }
 
 } // end of anonymous namespace
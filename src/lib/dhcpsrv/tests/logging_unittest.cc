@@ -244,6 +244,107 @@ TEST_F(LoggingTest, multipleLoggingDestinations) {
     EXPECT_TRUE(storage->getLoggingInfo()[0].destinations_[1].flush_);
 }
 
+// Checks that the asynchronous logging configuration is parsed and that
+// invalid values are rejected.
+TEST_F(LoggingTest, parsingAsync) {
+    SrvConfigPtr storage(new SrvConfig());
+    LogConfigParser parser(storage);
+
+    // The asynchronous logging is disabled by default.
+    EXPECT_FALSE(storage->getAsyncLoggingInfo().enabled_);
+
+    // An empty map enables it with the default parameters.
+    ASSERT_NO_THROW(parser.parseAsyncConfiguration(Element::fromJSON("{ }")));
+    EXPECT_TRUE(storage->getAsyncLoggingInfo().enabled_);
+    EXPECT_EQ(AsyncLoggingInfo::DEFAULT_QUEUE_SIZE,
+              storage->getAsyncLoggingInfo().queue_size_);
+    EXPECT_EQ(isc::log::AsyncLogWriter::BLOCK,
+              storage->getAsyncLoggingInfo().overflow_policy_);
+
+    ASSERT_NO_THROW(parser.parseAsyncConfiguration(Element::fromJSON(
+        "{ \"queue-size\": 1000, \"overflow-policy\": \"count\" }")));
+    EXPECT_TRUE(storage->getAsyncLoggingInfo().enabled_);
+    EXPECT_EQ(1000, storage->getAsyncLoggingInfo().queue_size_);
+    EXPECT_EQ(isc::log::AsyncLogWriter::COUNT,
+              storage->getAsyncLoggingInfo().overflow_policy_);
+
+    EXPECT_THROW(parser.parseAsyncConfiguration(Element::fromJSON(
+        "{ \"queue-size\": 0 }")), BadValue);
+    EXPECT_THROW(parser.parseAsyncConfiguration(Element::fromJSON(
+        "{ \"queue-size\": \"large\" }")), BadValue);
+    EXPECT_THROW(parser.parseAsyncConfiguration(Element::fromJSON(
+        "{ \"overflow-policy\": \"wait\" }")), BadValue);
+    EXPECT_THROW(parser.parseAsyncConfiguration(Element::fromJSON("[ ]")),
+                 BadValue);
+}
+
+// Checks that the rate limits of the loggers are parsed and that invalid
+// values are rejected.
+TEST_F(LoggingTest, parsingRateLimits) {
+
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"severity\": \"INFO\","
+    "        \"rate-limits\": ["
+    "            {"
+    "                \"message\": \"DHCP4_PACKET_DROP_*\","
+    "                \"rate\": 10,"
+    "                \"interval\": 5"
+    "            },"
+    "            {"
+    "                \"message\": \"DHCP4_LEASE_ALLOC\","
+    "                \"sample\": 100"
+    "            }"
+    "        ]"
+    "    }"
+    "]}";
+
+    SrvConfigPtr storage(new SrvConfig());
+    LogConfigParser parser(storage);
+
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    ASSERT_NO_THROW(parser.parseConfiguration(config->get("loggers")));
+
+    ASSERT_EQ(1, storage->getLoggingInfo().size());
+    const std::vector<isc::log::MessageLimit>& limits =
+        storage->getLoggingInfo()[0].limits_;
+    ASSERT_EQ(2, limits.size());
+    EXPECT_EQ("DHCP4_PACKET_DROP_*", limits[0].message);
+    EXPECT_EQ(1, limits[0].sample);
+    EXPECT_EQ(10, limits[0].rate);
+    EXPECT_EQ(5, limits[0].interval);
+    EXPECT_EQ("DHCP4_LEASE_ALLOC", limits[1].message);
+    EXPECT_EQ(100, limits[1].sample);
+    EXPECT_EQ(0, limits[1].rate);
+    EXPECT_EQ(1, limits[1].interval);
+
+    // The limits are passed to the logger specification.
+    isc::log::LoggerSpecification spec =
+        storage->getLoggingInfo()[0].toSpec();
+    ASSERT_EQ(2, spec.getMessageLimits().size());
+    EXPECT_TRUE(spec.getMessageLimits()[0] == limits[0]);
+
+    // Invalid entries.
+    const char* invalid[] = {
+        "{ \"rate\": 10 }",
+        "{ \"message\": \"\" }",
+        "{ \"message\": \"FOO\", \"sample\": 0 }",
+        "{ \"message\": \"FOO\", \"interval\": 0 }",
+        "{ \"message\": \"FOO\", \"rate\": -1 }",
+        "{ \"message\": \"FOO\", \"rate\": \"10\" }",
+        "{ \"message\": \"FOO\", \"rate\": 4294967296 }"
+    };
+    for (int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        SCOPED_TRACE(invalid[i]);
+        config = Element::fromJSON(std::string("[ { \"name\": \"kea\", "
+                                               "\"rate-limits\": [ ") +
+                                   invalid[i] + " ] } ]");
+        EXPECT_THROW(parser.parseConfiguration(config), BadValue);
+    }
+}
+
 /// @todo Add tests for malformed logging configuration
 
 /// @todo There is no easy way to test applyConfiguration() and defaultLogging().
@@ -9,6 +9,7 @@
 #include <asiolink/io_address.h>
 #include <dhcp/duid.h>
 #include <dhcp/iface_mgr.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
@@ -40,6 +41,21 @@ using namespace isc::util;
 
 namespace {
 
+/// @brief Returns the rows of a lease statistics query as text.
+///
+/// @param query The query started by the lease manager.
+/// @return One "subnet/type/state=count" line per row.
+std::string
+getStatsRows(const LeaseStatsQueryPtr& query) {
+    std::ostringstream s;
+    LeaseStatsRow row;
+    while (query && query->getNextRow(row)) {
+        s << row.subnet_id_ << "/" << row.lease_type_ << "/"
+          << row.lease_state_ << "=" << row.state_count_ << "\n";
+    }
+    return (s.str());
+}
+
 /// @brief Class derived from @c Memfile_LeaseMgr to test LFC timer.
 ///
 /// This class provides a custom callback function which is invoked
@@ -157,6 +173,8 @@ public:
             LeaseFileIO io(Memfile_LeaseMgr::appendSuffix(base_name, type));
             io.removeFile();
         }
+        // Remove the mapped lease store.
+        static_cast<void>(remove(std::string(base_name + ".store").c_str()));
     }
 
     /// @brief Return path to the lease file used by unit tests.
@@ -1895,4 +1913,497 @@ TEST_F(MemfileLeaseMgrTest, recountLeaseStats6) {
     testRecountLeaseStats6();
 }
 
+// Checks that the leases are read from the mapped lease store after a
+// clean shutdown and that the store is rebuilt when the lease file has
+// been modified.
+TEST_F(MemfileLeaseMgrTest, mappedStore4) {
+    const std::string lease_file = getLeaseFilePath("leasefile4_0.csv");
+    const std::string config = getConfigString(V4) + " mapped-store=true";
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    // Add, update and delete leases.
+    std::vector<Lease4Ptr> leases = createLeases4();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+    leases[1]->hostname_ = "updated.example.org";
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases[1]));
+    ASSERT_TRUE(lmptr_->deleteLease(leases[2]->addr_));
+    LeaseMgrFactory::destroy();
+
+    // The store has been synchronized with the lease file.
+    {
+        MappedLeaseStore store(lease_file + ".store", 4);
+        EXPECT_TRUE(store.isReusable(lease_file));
+        EXPECT_EQ(2, store.size());
+    }
+
+    // Restart: the leases are read from the store.
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    Lease4Ptr lease = lmptr_->getLease4(leases[0]->addr_);
+    ASSERT_TRUE(lease);
+    detailCompareLease(leases[0], lease);
+    lease = lmptr_->getLease4(leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    detailCompareLease(leases[1], lease);
+    EXPECT_FALSE(lmptr_->getLease4(leases[2]->addr_));
+
+    // The store is in use and can't be opened by another instance.
+    EXPECT_THROW(MappedLeaseStore store(lease_file + ".store", 4),
+                 isc::util::MemorySegmentOpenError);
+    LeaseMgrFactory::destroy();
+
+    // Modify the lease file while the server is not running: the leases
+    // are read from the lease file and the store is rebuilt.
+    {
+        std::ofstream file(lease_file.c_str(), std::ios::app);
+        file << "192.0.2.250,0a:0a:0a:0a:0a:0a,,200,200,8,1,1,,0" << std::endl;
+    }
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.250")));
+    lease = lmptr_->getLease4(leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    detailCompareLease(leases[1], lease);
+    LeaseMgrFactory::destroy();
+
+    MappedLeaseStore store(lease_file + ".store", 4);
+    EXPECT_TRUE(store.isReusable(lease_file));
+    EXPECT_EQ(3, store.size());
+}
+
+// Checks that the DHCPv6 leases are read from the mapped lease store.
+TEST_F(MemfileLeaseMgrTest, mappedStore6) {
+    const std::string config = getConfigString(V6) + " mapped-store=true";
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    std::vector<Lease6Ptr> leases = createLeases6();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+    ASSERT_TRUE(lmptr_->deleteLease(leases[2]->addr_));
+    LeaseMgrFactory::destroy();
+
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    for (int i = 0; i < 2; ++i) {
+        Lease6Ptr lease = lmptr_->getLease6(leases[i]->type_, leases[i]->addr_);
+        ASSERT_TRUE(lease);
+        detailCompareLease(leases[i], lease);
+    }
+    EXPECT_FALSE(lmptr_->getLease6(leases[2]->type_, leases[2]->addr_));
+}
+
+// Checks the validation of the mapped-store parameter.
+TEST_F(MemfileLeaseMgrTest, mappedStoreParameter) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["mapped-store"] = "bogus";
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr;
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The store is not used when the leases are not persisted.
+    pmap["mapped-store"] = "true";
+    pmap["persist"] = "false";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    std::ifstream store(std::string(pmap["name"] + ".store").c_str());
+    EXPECT_FALSE(store.good());
+}
+
+// Checks that the leases are written to and read from a lease file in
+// the binary format.
+TEST_F(MemfileLeaseMgrTest, binaryFormat4) {
+    const std::string lease_file = getLeaseFilePath("leasefile4_0.csv");
+    const std::string config = getConfigString(V4) + " file-format=binary";
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    EXPECT_TRUE(BinaryLeaseFile::isBinaryFile(lease_file));
+
+    // Add, update and delete leases.
+    std::vector<Lease4Ptr> leases = createLeases4();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+    leases[1]->hostname_ = "updated.example.org";
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases[1]));
+    ASSERT_TRUE(lmptr_->deleteLease(leases[2]->addr_));
+
+    // Restart: the leases are read from the lease file.
+    LeaseMgrFactory::destroy();
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    Lease4Ptr lease = lmptr_->getLease4(leases[0]->addr_);
+    ASSERT_TRUE(lease);
+    detailCompareLease(leases[0], lease);
+    lease = lmptr_->getLease4(leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    detailCompareLease(leases[1], lease);
+    EXPECT_FALSE(lmptr_->getLease4(leases[2]->addr_));
+}
+
+// Checks that the DHCPv6 leases are written to and read from a lease file
+// in the binary format.
+TEST_F(MemfileLeaseMgrTest, binaryFormat6) {
+    const std::string config = getConfigString(V6) + " file-format=binary";
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    std::vector<Lease6Ptr> leases = createLeases6();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+    ASSERT_TRUE(lmptr_->deleteLease(leases[2]->addr_));
+    LeaseMgrFactory::destroy();
+
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    for (int i = 0; i < 2; ++i) {
+        Lease6Ptr lease = lmptr_->getLease6(leases[i]->type_, leases[i]->addr_);
+        ASSERT_TRUE(lease);
+        detailCompareLease(leases[i], lease);
+    }
+    EXPECT_FALSE(lmptr_->getLease6(leases[2]->type_, leases[2]->addr_));
+}
+
+// Checks that the lease files are converted when the configured format
+// differs from the format of the current lease file.
+TEST_F(MemfileLeaseMgrTest, convertFileFormat4) {
+    const std::string lease_file = getLeaseFilePath("leasefile4_0.csv");
+    LeaseFileIO io2(Memfile_LeaseMgr::appendSuffix(lease_file,
+                    Memfile_LeaseMgr::FILE_PREVIOUS));
+    io2.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state\n"
+                  "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n"
+                  "192.0.2.11,bb:bb:bb:bb:bb:bb,,200,200,8,1,1,,1\n");
+
+    io4_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                   "fqdn_fwd,fqdn_rev,hostname,state\n"
+                   "192.0.2.10,0a:0a:0a:0a:0a:0a,,200,200,8,1,1,,1\n"
+                   "192.0.2.11,bb:bb:bb:bb:bb:bb,,200,400,8,1,1,,1\n");
+
+    // The leases read from the CSV files are written to the completed
+    // file in the binary format.
+    const std::string finish =
+        Memfile_LeaseMgr::appendSuffix(lease_file, Memfile_LeaseMgr::FILE_FINISH);
+    const std::string binary_config = getConfigString(V4) + " file-format=binary";
+    LeaseMgrFactory::create(binary_config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    EXPECT_TRUE(BinaryLeaseFile::isBinaryFile(finish));
+    EXPECT_TRUE(BinaryLeaseFile::isBinaryFile(lease_file));
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.2.11"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(200, lease->cltt_);
+    ASSERT_TRUE(lmptr_->deleteLease(IOAddress("192.0.2.2")));
+    LeaseMgrFactory::destroy();
+
+    // Converting back to the CSV format.
+    LeaseMgrFactory::create(getConfigString(V4));
+    lmptr_ = &(LeaseMgrFactory::instance());
+    EXPECT_FALSE(BinaryLeaseFile::isBinaryFile(finish));
+    EXPECT_FALSE(BinaryLeaseFile::isBinaryFile(lease_file));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.10")));
+    lease = lmptr_->getLease4(IOAddress("192.0.2.11"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(200, lease->cltt_);
+}
+
+// Checks the validation of the file-format parameter.
+TEST_F(MemfileLeaseMgrTest, fileFormatParameter) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["file-format"] = "bogus";
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr;
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    pmap["file-format"] = "csv";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_FALSE(BinaryLeaseFile::isBinaryFile(pmap["name"]));
+}
+
+// This test checks that the lease file cleanup performed within the server
+// process writes the leases held in memory to the previous file.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess4) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n";
+
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1\n"
+        "192.0.2.4,04:04:04:04:04:04,,200,800,8,1,1,,1\n"
+        "192.0.2.4,04:04:04:04:04:04,,0,800,8,1,1,,1\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"), false);
+    previous_file.writeFile(previous_file_contents);
+
+    // The output of an interrupted cleanup is discarded.
+    LeaseFileIO output_file(getLeaseFilePath("leasefile4_0.csv.output"));
+    output_file.writeFile(new_file_contents +
+                          "192.0.2.5,05:05:05:05:05:05,,200,800,8,1,1,,1\n");
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-mode"] = "in-process";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+
+    // The new lease file is created at once and the leases added while
+    // the cleanup is in progress are written to it.
+    ASSERT_TRUE(current_file.exists());
+    std::vector<uint8_t> hwaddr_vec(6);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    Lease4Ptr new_lease(new Lease4(IOAddress("192.0.2.45"), hwaddr, 0, 0,
+                                   100, 50, 60, 0, 1));
+    ASSERT_NO_THROW(lease_mgr->addLease(new_lease));
+    EXPECT_EQ(new_file_contents +
+              "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0\n",
+              current_file.readFile());
+
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // The previous file holds the leases present when the cleanup started
+    // and the other files have been removed. The storage is read while the
+    // leases are added, so the new lease may be written too, which is
+    // harmless as it is also in the new lease file.
+    std::string result_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1\n";
+    ASSERT_TRUE(previous_file.exists());
+    std::string previous_file_result = previous_file.readFile();
+    const std::string new_lease_line =
+        "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0\n";
+    if ((previous_file_result.size() > new_lease_line.size()) &&
+        (previous_file_result.compare(previous_file_result.size() -
+                                      new_lease_line.size(),
+                                      new_lease_line.size(),
+                                      new_lease_line) == 0)) {
+        previous_file_result.resize(previous_file_result.size() -
+                                    new_lease_line.size());
+    }
+    EXPECT_EQ(result_file_contents, previous_file_result);
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.1"),
+                             false).exists());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.completed"),
+                             false).exists());
+    EXPECT_FALSE(output_file.exists());
+
+    // All leases are loaded after a restart.
+    lease_mgr.reset();
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.3")));
+    EXPECT_FALSE(lease_mgr->getLease4(IOAddress("192.0.2.4")));
+    EXPECT_FALSE(lease_mgr->getLease4(IOAddress("192.0.2.5")));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.45")));
+}
+
+// This test checks that the in-process cleanup reading the leases in
+// several batches is cancelled when the backend is destroyed, without
+// waiting for it, and that the leases are loaded by the new instance.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcessCancel4) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-mode"] = "in-process";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    std::vector<uint8_t> hwaddr_vec(6);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    const uint32_t lease_count = 2500;
+    for (uint32_t i = 0; i < lease_count; ++i) {
+        Lease4Ptr lease(new Lease4(IOAddress(0xc0000000 + i), hwaddr, 0, 0,
+                                   100, 50, 60, 0, 1));
+        ASSERT_TRUE(lease_mgr->addLease(lease));
+    }
+
+    // The first cleanup completes.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 5));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // The second one is cancelled or completed by the time the leases
+    // are loaded again.
+    ASSERT_TRUE(lease_mgr->deleteLease(IOAddress(0xc0000000)));
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    lease_mgr.reset();
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+    EXPECT_FALSE(lease_mgr->getLease4(IOAddress(0xc0000000)));
+    for (uint32_t i = 1; i < lease_count; ++i) {
+        ASSERT_TRUE(lease_mgr->getLease4(IOAddress(0xc0000000 + i)));
+    }
+}
+
+// This test checks that the in-process cleanup of DHCPv6 binary lease
+// files first completes the cleanup interrupted after the finish file
+// has been written.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcessFinish6) {
+    const std::string config = getConfigString(V6) +
+        " file-format=binary lfc-interval=1 lfc-mode=in-process";
+    LeaseMgrFactory::create(config);
+    lmptr_ = &(LeaseMgrFactory::instance());
+    std::vector<Lease6Ptr> leases = createLeases6();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+    LeaseMgrFactory::destroy();
+
+    // Leave a finish file holding a lease which is deleted later.
+    const std::string lease_file = getLeaseFilePath("leasefile6_0.csv");
+    const std::string finish =
+        Memfile_LeaseMgr::appendSuffix(lease_file, Memfile_LeaseMgr::FILE_FINISH);
+    ASSERT_EQ(0, rename(lease_file.c_str(), finish.c_str()));
+
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr;
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "6";
+    pmap["name"] = lease_file;
+    pmap["file-format"] = "binary";
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-mode"] = "in-process";
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+    ASSERT_TRUE(lease_mgr->deleteLease(leases[2]->addr_));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+    EXPECT_FALSE(LeaseFileIO(finish, false).exists());
+
+    // The previous file holds the remaining leases in the binary format.
+    const std::string previous =
+        Memfile_LeaseMgr::appendSuffix(lease_file, Memfile_LeaseMgr::FILE_PREVIOUS);
+    EXPECT_TRUE(BinaryLeaseFile::isBinaryFile(previous));
+    lease_mgr.reset();
+    ASSERT_EQ(0, remove(lease_file.c_str()));
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+    for (int i = 0; i < 2; ++i) {
+        Lease6Ptr lease = lease_mgr->getLease6(leases[i]->type_,
+                                               leases[i]->addr_);
+        ASSERT_TRUE(lease);
+        detailCompareLease(leases[i], lease);
+    }
+    EXPECT_FALSE(lease_mgr->getLease6(leases[2]->type_, leases[2]->addr_));
+}
+
+// Checks the validation of the lfc-mode parameter.
+TEST_F(MemfileLeaseMgrTest, lfcModeParameter) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-mode"] = "bogus";
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr;
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    pmap["lfc-mode"] = "external";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    pmap["lfc-mode"] = "in-process";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+}
+
+// Checks that the numbers of leases per subnet reported by the lease
+// statistics queries are maintained as the leases are added, updated and
+// deleted, and restored when the leases are loaded.
+TEST_F(MemfileLeaseMgrTest, leaseStatsCounts4) {
+    startBackend(V4);
+
+    // The leases of the subnets are interleaved in the address space.
+    makeLease4("192.0.2.1", 2);
+    makeLease4("192.0.2.2", 1);
+    makeLease4("192.0.2.3", 2, Lease::STATE_DECLINED);
+    makeLease4("192.0.2.4", 1, Lease::STATE_EXPIRED_RECLAIMED);
+    makeLease4("192.0.2.5", 1);
+    EXPECT_EQ("1/0/0=2\n1/0/1=0\n2/0/0=1\n2/0/1=1\n",
+              getStatsRows(lmptr_->startLeaseStatsQuery4()));
+
+    // Move a lease to another subnet and change the state of another.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(lease);
+    lease->subnet_id_ = 1;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+    lease = lmptr_->getLease4(IOAddress("192.0.2.4"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_DEFAULT;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("192.0.2.5")));
+    const std::string expected = "1/0/0=3\n1/0/1=0\n2/0/0=0\n2/0/1=1\n";
+    EXPECT_EQ(expected, getStatsRows(lmptr_->startLeaseStatsQuery4()));
+
+    // The leases are counted when they are loaded.
+    LeaseMgrFactory::destroy();
+    startBackend(V4);
+    EXPECT_EQ(expected, getStatsRows(lmptr_->startLeaseStatsQuery4()));
+}
+
+// Checks that the IPv6 leases per subnet are counted by lease type.
+TEST_F(MemfileLeaseMgrTest, leaseStatsCounts6) {
+    startBackend(V6);
+    makeLease6(Lease::TYPE_NA, "2001:db8:1::1", 0, 1);
+    makeLease6(Lease::TYPE_PD, "2001:db8:1::", 48, 2);
+    makeLease6(Lease::TYPE_NA, "2001:db8:1::2", 0, 2, Lease::STATE_DECLINED);
+    makeLease6(Lease::TYPE_TA, "2001:db8:1::3", 0, 1);
+    EXPECT_EQ("1/0/0=1\n1/0/1=0\n1/2/0=0\n2/0/0=0\n2/0/1=1\n2/2/0=1\n",
+              getStatsRows(lmptr_->startLeaseStatsQuery6()));
+
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("2001:db8:1::")));
+    EXPECT_EQ("1/0/0=1\n1/0/1=0\n1/2/0=0\n2/0/0=0\n2/0/1=1\n2/2/0=0\n",
+              getStatsRows(lmptr_->startLeaseStatsQuery6()));
+}
+
+// Checks that all leases of an IPv4 subnet can be deleted.
+TEST_F(MemfileLeaseMgrTest, wipeLeases4) {
+    startBackend(V4);
+    makeLease4("192.0.2.1", 1);
+    makeLease4("192.0.2.2", 2);
+    makeLease4("192.0.2.3", 1, Lease::STATE_DECLINED);
+
+    EXPECT_EQ(2, lmptr_->wipeLeases4(1));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.3")));
+    EXPECT_EQ("2/0/0=1\n2/0/1=0\n",
+              getStatsRows(lmptr_->startLeaseStatsQuery4()));
+    EXPECT_EQ(0, lmptr_->wipeLeases4(1));
+
+    // The leases have been marked as deleted in the lease file.
+    LeaseMgrFactory::destroy();
+    startBackend(V4);
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.3")));
+}
+
+// Checks that all leases of an IPv6 subnet can be deleted.
+TEST_F(MemfileLeaseMgrTest, wipeLeases6) {
+    startBackend(V6);
+    makeLease6(Lease::TYPE_NA, "2001:db8:1::1", 0, 1);
+    makeLease6(Lease::TYPE_PD, "2001:db8:1::", 48, 1);
+    makeLease6(Lease::TYPE_NA, "2001:db8:1::2", 0, 2);
+
+    EXPECT_EQ(2, lmptr_->wipeLeases6(1));
+    EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1")));
+    EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_PD, IOAddress("2001:db8:1::")));
+    EXPECT_TRUE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2")));
+
+    LeaseMgrFactory::destroy();
+    startBackend(V6);
+    EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1")));
+    EXPECT_TRUE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2")));
+}
+
 }; // end of anonymous namespace
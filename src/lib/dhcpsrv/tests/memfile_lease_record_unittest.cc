@@ -0,0 +1,299 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/memfile_lease_record.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/thread.h>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Returns a vector of consecutive bytes.
+///
+/// @param size size of the vector
+/// @param first value of the first byte
+std::vector<uint8_t>
+makeBytes(const size_t size, const uint8_t first = 1) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i < size; ++i) {
+        bytes.push_back(static_cast<uint8_t>(first + i));
+    }
+    return (bytes);
+}
+
+/// @brief Creates a DHCPv4 lease with all fields set.
+///
+/// @param address leased address
+/// @param client_id_size size of the client identifier, 0 for none
+Lease4Ptr
+createLease4(const std::string& address, const size_t client_id_size) {
+    HWAddrPtr hwaddr(new HWAddr(makeBytes(6), HTYPE_ETHER));
+    hwaddr->source_ = HWAddr::HWADDR_SOURCE_RAW;
+    ClientIdPtr client_id;
+    if (client_id_size > 0) {
+        client_id.reset(new ClientId(makeBytes(client_id_size, 0x10)));
+    }
+    Lease4Ptr lease(new Lease4(IOAddress(address), hwaddr, client_id, 3600,
+                               900, 1800, 1500000000, 42, true, false,
+                               "host.example.org"));
+    lease->state_ = Lease::STATE_DECLINED;
+    return (lease);
+}
+
+/// @brief Creates a DHCPv6 lease with all fields set.
+///
+/// @param address leased address or prefix
+/// @param duid_size size of the DUID
+Lease6Ptr
+createLease6(const std::string& address, const size_t duid_size) {
+    DuidPtr duid(new DUID(makeBytes(duid_size, 0x20)));
+    HWAddrPtr hwaddr(new HWAddr(makeBytes(6), HTYPE_ETHER));
+    Lease6Ptr lease(new Lease6(Lease::TYPE_PD, IOAddress(address), duid, 77,
+                               1800, 3600, 900, 1200, 42, false, true,
+                               "host6.example.org", hwaddr, 56));
+    lease->cltt_ = 1500000000;
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    return (lease);
+}
+
+// Checks the ordering and the equality of the binary keys, which must be
+// the ones of the vectors they are created from.
+TEST(BinaryKeyTest, compare) {
+    const std::vector<uint8_t> empty;
+    const std::vector<uint8_t> short_key = makeBytes(3);
+    const std::vector<uint8_t> long_key = makeBytes(4);
+    const std::vector<uint8_t> greater_key = makeBytes(2, 5);
+
+    EXPECT_TRUE(BinaryKey(empty) < BinaryKey(short_key));
+    EXPECT_TRUE(BinaryKey(short_key) < BinaryKey(long_key));
+    EXPECT_TRUE(BinaryKey(long_key) < BinaryKey(greater_key));
+    EXPECT_FALSE(BinaryKey(greater_key) < BinaryKey(long_key));
+    EXPECT_FALSE(BinaryKey(short_key) < BinaryKey(short_key));
+
+    EXPECT_TRUE(BinaryKey(empty) == BinaryKey(empty));
+    EXPECT_TRUE(BinaryKey(short_key) == BinaryKey(makeBytes(3)));
+    EXPECT_FALSE(BinaryKey(short_key) == BinaryKey(long_key));
+    EXPECT_FALSE(BinaryKey(empty) == BinaryKey(short_key));
+}
+
+// Checks that the identifiers are stored inline or on the heap depending
+// on their size and survive copies.
+TEST(InlineIdentifierTest, storage) {
+    InlineIdentifier empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(0, empty.getSize());
+
+    const std::vector<uint8_t> small = makeBytes(InlineIdentifier::INLINE_SIZE);
+    const std::vector<uint8_t> large = makeBytes(128);
+
+    InlineIdentifier small_id(&small[0], small.size());
+    InlineIdentifier large_id(&large[0], large.size());
+    EXPECT_TRUE(small == small_id.toVector());
+    EXPECT_TRUE(large == large_id.toVector());
+
+    // The inline identifier is held in the object itself.
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(&small_id);
+    EXPECT_GE(small_id.getData(), begin);
+    EXPECT_LT(small_id.getData(), begin + sizeof(small_id));
+
+    // Copies are deep.
+    InlineIdentifier copy(large_id);
+    EXPECT_NE(large_id.getData(), copy.getData());
+    EXPECT_TRUE(large == copy.toVector());
+
+    copy = small_id;
+    EXPECT_TRUE(small == copy.toVector());
+    copy = large_id;
+    EXPECT_TRUE(large == copy.toVector());
+    copy = empty;
+    EXPECT_TRUE(copy.empty());
+
+    const std::vector<uint8_t> too_large(InlineIdentifier::MAX_SIZE + 1);
+    EXPECT_THROW(InlineIdentifier(&too_large[0], too_large.size()),
+                 BadValue);
+}
+
+// Checks that the strings are shared and removed from the pool when
+// they are no longer used.
+TEST(InternedStringTest, pool) {
+    const size_t pool_size = InternedString::getPoolSize();
+
+    InternedString empty;
+    EXPECT_TRUE(empty.get().empty());
+    InternedString empty_too("");
+    EXPECT_TRUE(empty_too.get().empty());
+    EXPECT_EQ(pool_size, InternedString::getPoolSize());
+
+    {
+        InternedString first("interned.example.org");
+        InternedString second("interned.example.org");
+        EXPECT_EQ("interned.example.org", first.get());
+        EXPECT_EQ(&first.get(), &second.get());
+        EXPECT_EQ(pool_size + 1, InternedString::getPoolSize());
+
+        InternedString other("other.example.org");
+        EXPECT_EQ(pool_size + 2, InternedString::getPoolSize());
+        other = first;
+        EXPECT_EQ(&first.get(), &other.get());
+        EXPECT_EQ(pool_size + 1, InternedString::getPoolSize());
+
+        empty = other;
+        EXPECT_EQ("interned.example.org", empty.get());
+    }
+
+    // The string is still used by one object.
+    EXPECT_EQ(pool_size + 1, InternedString::getPoolSize());
+    empty = InternedString();
+    EXPECT_EQ(pool_size, InternedString::getPoolSize());
+}
+
+/// @brief Copies and releases a string many times.
+///
+/// The last copy is released and the string created again from time to
+/// time, so as the string is removed from the pool and added again while
+/// other threads hold copies of it or not.
+///
+/// @param str string to be copied
+void
+copyStrings(const InternedString& str) {
+    for (int i = 0; i < 10000; ++i) {
+        std::vector<InternedString> copies(8, str);
+        InternedString created(str.get());
+        copies.assign(4, created);
+        copies.clear();
+        InternedString other("other-" + str.get());
+    }
+}
+
+// Checks that the strings can be copied and released by several threads
+// and that the pool remains consistent.
+TEST(InternedStringTest, threads) {
+    const size_t pool_size = InternedString::getPoolSize();
+    {
+        InternedString shared("shared.example.org");
+        std::vector<boost::shared_ptr<Thread> > threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.push_back(boost::shared_ptr<Thread>(
+                new Thread(boost::bind(&copyStrings, shared))));
+        }
+        for (size_t i = 0; i < threads.size(); ++i) {
+            threads[i]->wait();
+        }
+        EXPECT_EQ("shared.example.org", shared.get());
+        EXPECT_EQ(pool_size + 1, InternedString::getPoolSize());
+    }
+    EXPECT_EQ(pool_size, InternedString::getPoolSize());
+}
+
+// Checks that a DHCPv4 lease is restored from its record.
+TEST(Lease4RecordTest, toLease) {
+    // Client identifiers stored inline and on the heap.
+    const size_t sizes[] = { 7, 64 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        Lease4Ptr lease = createLease4("192.0.2.3", sizes[i]);
+        Lease4Record record(*lease);
+        EXPECT_EQ(0xc0000203, record.addr_);
+
+        Lease4Ptr restored = record.toLease();
+        ASSERT_TRUE(restored);
+        EXPECT_TRUE(*lease == *restored);
+        ASSERT_TRUE(restored->hwaddr_);
+        EXPECT_EQ(HWAddr::HWADDR_SOURCE_RAW, restored->hwaddr_->source_);
+    }
+
+    // A lease without HW address and client identifier.
+    Lease4Ptr lease = createLease4("192.0.2.4", 0);
+    lease->hwaddr_.reset();
+    Lease4Record record(*lease);
+    EXPECT_TRUE(record.getHWAddrKey() == std::vector<uint8_t>());
+    EXPECT_TRUE(record.getClientIdKey() == std::vector<uint8_t>());
+    Lease4Ptr restored = record.toLease();
+    EXPECT_FALSE(restored->hwaddr_);
+    EXPECT_FALSE(restored->client_id_);
+    EXPECT_TRUE(*lease == *restored);
+
+    // The record is only created for an IPv4 address.
+    lease->addr_ = IOAddress("2001:db8::1");
+    EXPECT_THROW(Lease4Record record6(*lease), BadValue);
+}
+
+// Checks that a DHCPv6 lease is restored from its record.
+TEST(Lease6RecordTest, toLease) {
+    // DUIDs stored inline and on the heap.
+    const size_t sizes[] = { 14, 18, 128 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        Lease6Ptr lease = createLease6("2001:db8:1:100::", sizes[i]);
+        Lease6Record record(*lease);
+        Lease6Ptr restored = record.toLease();
+        ASSERT_TRUE(restored);
+        EXPECT_TRUE(*lease == *restored);
+        EXPECT_EQ(56, restored->prefixlen_);
+        EXPECT_EQ(1800, restored->preferred_lft_);
+    }
+
+    // The record is only created for an IPv6 address.
+    Lease6Ptr lease = createLease6("2001:db8:1:100::", 14);
+    lease->addr_ = IOAddress("192.0.2.1");
+    EXPECT_THROW(Lease6Record record(*lease), BadValue);
+}
+
+// Checks that the storage is searched using the keys held by the lease
+// objects.
+TEST(Lease4RecordTest, storage) {
+    Lease4Storage storage;
+    Lease4Ptr lease1 = createLease4("192.0.2.1", 7);
+    Lease4Ptr lease2 = createLease4("192.0.2.2", 7);
+    lease2->hwaddr_.reset(new HWAddr(makeBytes(6, 0x30), HTYPE_ETHER));
+    lease2->client_id_.reset(new ClientId(makeBytes(7, 0x40)));
+    ASSERT_TRUE(storage.insert(Lease4Record(*lease1)).second);
+    ASSERT_TRUE(storage.insert(Lease4Record(*lease2)).second);
+    // The address is unique.
+    EXPECT_FALSE(storage.insert(Lease4Record(*lease1)).second);
+
+    // Leases are ordered by address.
+    Lease4Storage::const_iterator it = storage.begin();
+    ASSERT_TRUE(it != storage.end());
+    EXPECT_TRUE(*lease1 == *it->toLease());
+
+    const Lease4StorageHWAddressSubnetIdIndex& hw_idx =
+        storage.get<HWAddressSubnetIdIndexTag>();
+    Lease4StorageHWAddressSubnetIdIndex::const_iterator hw_it =
+        hw_idx.find(boost::make_tuple(lease2->hwaddr_->hwaddr_,
+                                      lease2->subnet_id_));
+    ASSERT_TRUE(hw_it != hw_idx.end());
+    EXPECT_TRUE(*lease2 == *hw_it->toLease());
+
+    const Lease4StorageClientIdHWAddressSubnetIdIndex& id_idx =
+        storage.get<ClientIdHWAddressSubnetIdIndexTag>();
+    Lease4StorageClientIdHWAddressSubnetIdIndex::const_iterator id_it =
+        id_idx.find(boost::make_tuple(lease1->client_id_->getClientId(),
+                                      lease1->hwaddr_->hwaddr_,
+                                      lease1->subnet_id_));
+    ASSERT_TRUE(id_it != id_idx.end());
+    EXPECT_TRUE(*lease1 == *id_it->toLease());
+
+    // There is no lease with this client identifier in the subnet.
+    const Lease4StorageClientIdSubnetIdIndex& cid_idx =
+        storage.get<ClientIdSubnetIdIndexTag>();
+    EXPECT_TRUE(cid_idx.find(boost::make_tuple(makeBytes(7, 0x50),
+                                               lease1->subnet_id_)) ==
+                cid_idx.end());
+}
+
+}
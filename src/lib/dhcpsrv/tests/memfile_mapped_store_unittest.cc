@@ -0,0 +1,251 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/memfile_mapped_store.h>
+#include <dhcpsrv/tests/test_utils.h>
+#include <util/memory_segment.h>
+#include <gtest/gtest.h>
+
+#include <boost/scoped_ptr.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Returns a vector of consecutive bytes.
+///
+/// @param size size of the vector
+/// @param first value of the first byte
+std::vector<uint8_t>
+makeBytes(const size_t size, const uint8_t first = 1) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i < size; ++i) {
+        bytes.push_back(static_cast<uint8_t>(first + i));
+    }
+    return (bytes);
+}
+
+/// @brief Creates a DHCPv4 lease with all fields set.
+///
+/// @param address leased address
+/// @param client_id_size size of the client identifier, 0 for none
+Lease4Ptr
+createLease4(const IOAddress& address, const size_t client_id_size) {
+    HWAddrPtr hwaddr(new HWAddr(makeBytes(6), HTYPE_ETHER));
+    hwaddr->source_ = HWAddr::HWADDR_SOURCE_RAW;
+    ClientIdPtr client_id;
+    if (client_id_size > 0) {
+        client_id.reset(new ClientId(makeBytes(client_id_size, 0x10)));
+    }
+    Lease4Ptr lease(new Lease4(address, hwaddr, client_id, 3600, 900, 1800,
+                               1500000000, 42, true, false,
+                               "host.example.org"));
+    lease->state_ = Lease::STATE_DECLINED;
+    return (lease);
+}
+
+/// @brief Creates a DHCPv6 lease with all fields set.
+///
+/// @param address leased address or prefix
+/// @param duid_size size of the DUID
+Lease6Ptr
+createLease6(const IOAddress& address, const size_t duid_size) {
+    DuidPtr duid(new DUID(makeBytes(duid_size, 0x20)));
+    HWAddrPtr hwaddr(new HWAddr(makeBytes(6), HTYPE_ETHER));
+    Lease6Ptr lease(new Lease6(Lease::TYPE_PD, address, duid, 77, 1800, 3600,
+                               900, 1200, 42, false, true, "host6.example.org",
+                               hwaddr, 56));
+    lease->cltt_ = 1500000000;
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    return (lease);
+}
+
+/// @brief Test fixture removing the store and journal files.
+class MappedLeaseStoreTest : public ::testing::Test {
+public:
+    /// @brief Constructor.
+    MappedLeaseStoreTest()
+        : filename_(TEST_DATA_BUILDDIR "/leases.store"),
+          journal_(TEST_DATA_BUILDDIR "/leases.journal") {
+        removeFiles();
+    }
+
+    /// @brief Destructor.
+    virtual ~MappedLeaseStoreTest() {
+        removeFiles();
+    }
+
+    /// @brief Removes the store and journal files.
+    void removeFiles() {
+        static_cast<void>(remove(filename_.c_str()));
+        static_cast<void>(remove(journal_.c_str()));
+    }
+
+    /// @brief Appends a line to the journal file.
+    ///
+    /// @param line text to append
+    void appendJournal(const std::string& line) {
+        std::ofstream file(journal_.c_str(), std::ios::app);
+        file << line << std::endl;
+    }
+
+    /// @brief Name of the store file.
+    std::string filename_;
+
+    /// @brief Name of the journal file.
+    std::string journal_;
+};
+
+// Checks that all the fields of the DHCPv4 leases are stored.
+TEST_F(MappedLeaseStoreTest, lease4) {
+    MappedLeaseStore store(filename_, 4);
+    EXPECT_EQ(0, store.size());
+
+    Lease4Ptr lease = createLease4(IOAddress("192.0.2.1"), 7);
+    Lease4Ptr bare(new Lease4(IOAddress("192.0.2.2"), HWAddrPtr(), 0, 0,
+                              60, 0, 0, 0, 1));
+    bare->cltt_ = -10;
+    store.put(*lease);
+    store.put(*bare);
+    EXPECT_EQ(2, store.size());
+
+    Lease4Storage storage;
+    store.load(storage);
+    ASSERT_EQ(2, storage.size());
+    Lease4Storage::iterator it =
+        storage.find(Lease4Record::addressKey(IOAddress("192.0.2.1")));
+    ASSERT_TRUE(it != storage.end());
+    detailCompareLease(lease, it->toLease());
+    it = storage.find(Lease4Record::addressKey(IOAddress("192.0.2.2")));
+    ASSERT_TRUE(it != storage.end());
+    Lease4Ptr loaded = it->toLease();
+    EXPECT_FALSE(loaded->hwaddr_);
+    EXPECT_FALSE(loaded->client_id_);
+    EXPECT_EQ(bare->cltt_, loaded->cltt_);
+    EXPECT_EQ(bare->subnet_id_, loaded->subnet_id_);
+    EXPECT_TRUE(loaded->hostname_.empty());
+}
+
+// Checks that all the fields of the DHCPv6 leases are stored.
+TEST_F(MappedLeaseStoreTest, lease6) {
+    MappedLeaseStore store(filename_, 6);
+    Lease6Ptr lease = createLease6(IOAddress("2001:db8:1::"), 14);
+    store.put(*lease);
+
+    Lease6Storage storage;
+    store.load(storage);
+    ASSERT_EQ(1, storage.size());
+    detailCompareLease(lease, storage.begin()->toLease());
+}
+
+// Checks the update and the removal of the leases.
+TEST_F(MappedLeaseStoreTest, updateRemove) {
+    MappedLeaseStore store(filename_, 4);
+    Lease4Ptr lease = createLease4(IOAddress("192.0.2.1"), 7);
+    store.put(*lease);
+    lease->hostname_ = "other.example.org";
+    lease->valid_lft_ = 7200;
+    store.put(*lease);
+    EXPECT_EQ(1, store.size());
+
+    EXPECT_TRUE(store.remove(IOAddress("192.0.2.1")));
+    EXPECT_FALSE(store.remove(IOAddress("192.0.2.1")));
+    EXPECT_FALSE(store.remove(IOAddress("192.0.2.3")));
+    EXPECT_EQ(0, store.size());
+
+    // A removed lease can be added again.
+    store.put(*lease);
+    Lease4Storage storage;
+    store.load(storage);
+    ASSERT_EQ(1, storage.size());
+    detailCompareLease(lease, storage.begin()->toLease());
+}
+
+// Checks that many leases can be stored, the store growing as needed,
+// and that they are found after the store is opened again.
+TEST_F(MappedLeaseStoreTest, reopen) {
+    const size_t count = 20000;
+    {
+        MappedLeaseStore store(filename_, 6);
+        Lease6Ptr lease = createLease6(IOAddress("2001:db8::"), 14);
+        for (size_t i = 0; i < count; ++i) {
+            lease->addr_ = IOAddress::increase(lease->addr_);
+            lease->iaid_ = i;
+            store.put(*lease);
+        }
+        // Remove every other lease.
+        lease->addr_ = IOAddress("2001:db8::");
+        for (size_t i = 0; i < count; i += 2) {
+            lease->addr_ = IOAddress::increase(lease->addr_);
+            EXPECT_TRUE(store.remove(lease->addr_));
+            lease->addr_ = IOAddress::increase(lease->addr_);
+        }
+        EXPECT_EQ(count / 2, store.size());
+    }
+
+    boost::scoped_ptr<MappedLeaseStore>
+        store(new MappedLeaseStore(filename_, 6));
+    EXPECT_EQ(count / 2, store->size());
+    Lease6Storage storage;
+    store->load(storage);
+    ASSERT_EQ(count / 2, storage.size());
+    for (Lease6Storage::const_iterator it = storage.begin();
+         it != storage.end(); ++it) {
+        Lease6Ptr lease = it->toLease();
+        EXPECT_EQ(1, lease->iaid_ % 2) << lease->addr_;
+    }
+
+    // A store of another universe is discarded.
+    store.reset();
+    store.reset(new MappedLeaseStore(filename_, 4));
+    EXPECT_EQ(0, store->size());
+}
+
+// Checks the synchronization with the journal.
+TEST_F(MappedLeaseStoreTest, sync) {
+    appendJournal("address,hwaddr");
+    {
+        MappedLeaseStore store(filename_, 4);
+        EXPECT_FALSE(store.isReusable(journal_));
+        store.put(*createLease4(IOAddress("192.0.2.1"), 7));
+        store.sync(journal_);
+        EXPECT_TRUE(store.isReusable(journal_));
+    }
+
+    {
+        MappedLeaseStore store(filename_, 4);
+        EXPECT_TRUE(store.isReusable(journal_));
+        EXPECT_FALSE(store.isReusable(journal_ + ".other"));
+
+        // The store is no longer synchronized when it is used.
+        store.markInUse();
+        EXPECT_FALSE(store.isReusable(journal_));
+        store.sync(journal_);
+    }
+
+    // The store is not used when the journal has been modified.
+    appendJournal("192.0.2.2,01:01:01:01:01:01");
+    MappedLeaseStore store(filename_, 4);
+    EXPECT_FALSE(store.isReusable(journal_));
+
+    // The store can't be opened twice.
+    EXPECT_THROW(MappedLeaseStore other(filename_, 4),
+                 isc::util::MemorySegmentOpenError);
+}
+
+}
@@ -0,0 +1,185 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/incremental_config_cache.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/parallel_subnets_parser.h>
+#include <dhcpsrv/pool.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Parses a subnet without adding its host to the staging
+/// configuration.
+///
+/// The subnet has a pool and a reservation for a hardware address derived
+/// from the subnet identifier. The subnets with the identifier 13 are
+/// invalid.
+///
+/// @param subnet_config configuration of the subnet.
+/// @param [out] hosts collection receiving the host reservation.
+SubnetPtr
+parseSubnet(const ConstElementPtr& subnet_config, HostCollection& hosts) {
+    const int64_t id = subnet_config->get("id")->intValue();
+    if (id == 13) {
+        isc_throw(DhcpConfigError, "invalid subnet");
+    }
+    SubnetPtr subnet(new Subnet4(IOAddress(subnet_config->get("subnet")->
+                                           stringValue()),
+                                 24, 1, 2, 3, id));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress(subnet_config->get("subnet")->
+                                                stringValue()), 28)));
+    std::ostringstream hwaddr;
+    hwaddr << "01:02:03:04:05:" << std::hex << (id & 0xff);
+    hosts.push_back(HostPtr(new Host(hwaddr.str(), "hw-address",
+                                     subnet->getID(), SubnetID(0),
+                                     IOAddress("0.0.0.0"), "foo")));
+    return (subnet);
+}
+
+/// @brief Test fixture class for the @c ParallelSubnetsParser.
+class ParallelSubnetsParserTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Resets the configuration and uses 4 threads for 1 subnet or more.
+    ParallelSubnetsParserTest() {
+        CfgMgr::instance().clear();
+        IncrementalConfigCache::instance().clear();
+        ParallelSubnetsParser::setMaxThreads(4);
+        ParallelSubnetsParser::setMinSubnetsPerThread(1);
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Restores the default settings.
+    virtual ~ParallelSubnetsParserTest() {
+        CfgMgr::instance().clear();
+        IncrementalConfigCache::instance().clear();
+        ParallelSubnetsParser::setMaxThreads(0);
+        ParallelSubnetsParser::setMinSubnetsPerThread(32);
+    }
+
+    /// @brief Returns a list of subnet configurations.
+    ///
+    /// @param count number of subnets, identified from 1. Every tenth
+    /// subnet has no identifier.
+    ConstElementPtr subnetsConfig(const int count) {
+        std::ostringstream s;
+        s << "[ ";
+        for (int i = 1; i <= count; ++i) {
+            s << (i > 1 ? ", " : "") << "{ \"id\": " << (i % 10 ? i : 0)
+              << ", \"subnet\": \"10.0." << i << ".0\","
+              << " \"reservations\": [ { } ] }";
+        }
+        s << " ]";
+        return (Element::fromJSON(s.str()));
+    }
+
+    /// @brief Checks that the staging configuration holds the host
+    /// reservation of a subnet.
+    ///
+    /// @param id subnet identifier.
+    bool hasHost(const SubnetID& id) {
+        std::ostringstream hwaddr;
+        hwaddr << "01:02:03:04:05:" << std::hex << (id & 0xff);
+        HWAddrPtr addr(new HWAddr(HWAddr::fromText(hwaddr.str())));
+        return (static_cast<bool>(CfgMgr::instance().getStagingCfg()->
+                                  getCfgHosts()->get4(id, addr)));
+    }
+};
+
+// This test checks the number of threads.
+TEST_F(ParallelSubnetsParserTest, getThreadCount) {
+    ParallelSubnetsParser::setMinSubnetsPerThread(10);
+    EXPECT_EQ(1, ParallelSubnetsParser::getThreadCount(0));
+    EXPECT_EQ(1, ParallelSubnetsParser::getThreadCount(19));
+    EXPECT_EQ(2, ParallelSubnetsParser::getThreadCount(20));
+    EXPECT_EQ(4, ParallelSubnetsParser::getThreadCount(1000));
+    ParallelSubnetsParser::setMaxThreads(1);
+    EXPECT_EQ(1, ParallelSubnetsParser::getThreadCount(1000));
+    ParallelSubnetsParser::setMaxThreads(0);
+    EXPECT_LE(1, ParallelSubnetsParser::getThreadCount(1000));
+}
+
+// This test checks that the subnets with an identifier are parsed ahead
+// and that their reservations are added to the staging configuration
+// when they are retrieved.
+TEST_F(ParallelSubnetsParserTest, parse) {
+    ConstElementPtr subnets = subnetsConfig(100);
+    ParallelSubnetsParser parser(parseSubnet);
+    ASSERT_NO_THROW(parser.parse(subnets));
+    EXPECT_EQ(4, parser.getThreadCount());
+
+    uint32_t last_pool_id = 0;
+    for (int i = 1; i <= 100; ++i) {
+        SCOPED_TRACE(i);
+        HostCollection hosts;
+        SubnetPtr subnet;
+        ASSERT_NO_THROW(subnet = parser.getSubnet(i - 1, hosts));
+        if ((i % 10 == 0) || (i == 13)) {
+            // No identifier or invalid subnet.
+            EXPECT_FALSE(subnet);
+            EXPECT_TRUE(hosts.empty());
+            continue;
+        }
+        ASSERT_TRUE(subnet);
+        EXPECT_EQ(i, subnet->getID());
+        ASSERT_EQ(1, hosts.size());
+        EXPECT_TRUE(hasHost(i));
+
+        // The pools are numbered in the order of the list.
+        const PoolCollection& pools = subnet->getPools(Lease::TYPE_V4);
+        ASSERT_EQ(1, pools.size());
+        if (i > 1) {
+            EXPECT_LT(last_pool_id, pools[0]->getId());
+        }
+        last_pool_id = pools[0]->getId();
+    }
+
+    // Out of range.
+    HostCollection hosts;
+    EXPECT_FALSE(parser.getSubnet(100, hosts));
+}
+
+// This test checks that nothing is parsed ahead for short lists.
+TEST_F(ParallelSubnetsParserTest, shortList) {
+    ParallelSubnetsParser::setMinSubnetsPerThread(10);
+    ParallelSubnetsParser parser(parseSubnet);
+    ASSERT_NO_THROW(parser.parse(subnetsConfig(15)));
+    EXPECT_EQ(0, parser.getThreadCount());
+    HostCollection hosts;
+    EXPECT_FALSE(parser.getSubnet(0, hosts));
+    EXPECT_FALSE(hasHost(1));
+}
+
+// This test checks that an error is reported when a reservation can't
+// be added to the staging configuration.
+TEST_F(ParallelSubnetsParserTest, duplicateHost) {
+    ParallelSubnetsParser parser(parseSubnet);
+    ASSERT_NO_THROW(parser.parse(subnetsConfig(8)));
+    HostCollection hosts;
+    ASSERT_TRUE(parser.getSubnet(1, hosts));
+    ASSERT_EQ(1, hosts.size());
+    EXPECT_TRUE(hasHost(2));
+
+    // The same subnet has been parsed again.
+    EXPECT_THROW(parser.getSubnet(1, hosts), DhcpConfigError);
+}
+
+} // end of anonymous namespace
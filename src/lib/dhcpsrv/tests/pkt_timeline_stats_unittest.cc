@@ -0,0 +1,102 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/pkt_timeline_stats.h>
+#include <stats/stats_mgr.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Test fixture class for @c PktTimelineStats.
+class PktTimelineStatsTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes all statistics.
+    PktTimelineStatsTest() {
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes all statistics.
+    virtual ~PktTimelineStatsTest() {
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Returns number of samples in a histogram.
+    ///
+    /// @param name Histogram name.
+    /// @return Number of samples or 0 if the histogram doesn't exist.
+    uint64_t getCount(const std::string& name) const {
+        HistogramPtr histogram = StatsMgr::instance().getHistogram(name);
+        return (histogram ? histogram->getCount() : 0);
+    }
+};
+
+// Checks that histogram names are generated correctly.
+TEST_F(PktTimelineStatsTest, names) {
+    PktTimelineStats stats("pkt4");
+    EXPECT_EQ("pkt4-latency-parse", stats.getStageStatName(Pkt::EVENT_PARSED));
+    EXPECT_EQ("pkt4-latency-host-lookup",
+              stats.getStageStatName(Pkt::EVENT_HOST_LOOKUP));
+    EXPECT_EQ("pkt4-latency-total", stats.getTotalStatName());
+    EXPECT_THROW(stats.getStageStatName(Pkt::EVENT_NUM), BadValue);
+}
+
+// Checks that only the recorded stages are added to the histograms.
+TEST_F(PktTimelineStatsTest, record) {
+    PktTimelineStats stats("pkt4");
+    Pkt4 pkt(DHCPDISCOVER, 1234);
+
+    // The histograms are created up front.
+    EXPECT_EQ(Pkt::EVENT_NUM, StatsMgr::instance().getAllHistograms()->size());
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("pkt4-latency-receive"));
+
+    // Nothing is recorded for a packet which reception wasn't recorded.
+    stats.record(pkt);
+    EXPECT_EQ(0, getCount("pkt4-latency-total"));
+
+    pkt.markEvent(Pkt::EVENT_RECEIVED);
+    pkt.markEvent(Pkt::EVENT_PARSED);
+    pkt.markEvent(Pkt::EVENT_CLASSIFIED);
+    pkt.markEvent(Pkt::EVENT_SENT);
+    stats.record(pkt);
+    stats.record(pkt);
+
+    EXPECT_EQ(2, getCount("pkt4-latency-parse"));
+    EXPECT_EQ(2, getCount("pkt4-latency-classify"));
+    EXPECT_EQ(2, getCount("pkt4-latency-send"));
+    EXPECT_EQ(2, getCount("pkt4-latency-total"));
+    EXPECT_EQ(0, getCount("pkt4-latency-lease-alloc"));
+}
+
+// Checks that the histograms are created again after they were removed.
+TEST_F(PktTimelineStatsTest, removeAll) {
+    PktTimelineStats stats("pkt4");
+    Pkt4 pkt(DHCPDISCOVER, 1234);
+    pkt.markEvent(Pkt::EVENT_RECEIVED);
+    pkt.markEvent(Pkt::EVENT_PARSED);
+    stats.record(pkt);
+    EXPECT_EQ(1, getCount("pkt4-latency-parse"));
+
+    StatsMgr::instance().removeAll();
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("pkt4-latency-parse"));
+
+    stats.record(pkt);
+    EXPECT_EQ(1, getCount("pkt4-latency-parse"));
+    EXPECT_EQ(1, getCount("pkt4-latency-total"));
+}
+
+};
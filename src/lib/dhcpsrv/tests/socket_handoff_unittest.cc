@@ -0,0 +1,320 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/tests/iface_mgr_test_config.h>
+#include <dhcpsrv/socket_handoff.h>
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Timeout of the handoff messages used by the tests.
+const long TEST_TIMEOUT = 5000;
+
+/// @brief Test fixture class for the @c SocketHandoff.
+class SocketHandoffTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the fake interfaces lo, eth0 and eth1.
+    SocketHandoffTest()
+        : iface_mgr_test_config_(true),
+          socket_name_(std::string(TEST_DATA_BUILDDIR) + "/handoff.sock"),
+          sockfd_(-1), port_(0), child_pid_(0), ready_(false) {
+        static_cast<void>(remove(socket_name_.c_str()));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Kills the process holding the sockets, if any.
+    virtual ~SocketHandoffTest() {
+        if (child_pid_ > 0) {
+            kill(child_pid_, SIGKILL);
+            waitpid(child_pid_, NULL, 0);
+        }
+        if (sockfd_ >= 0) {
+            close(sockfd_);
+        }
+        IfaceMgr::instance().closeInheritedSockets();
+        static_cast<void>(remove(socket_name_.c_str()));
+    }
+
+    /// @brief Opens an UDP socket bound to the loopback address.
+    ///
+    /// The socket stands for the socket opened on eth0 by the running
+    /// server.
+    void openSocket() {
+        sockfd_ = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(sockfd_, 0);
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_EQ(0, bind(sockfd_, reinterpret_cast<struct sockaddr*>(&addr),
+                          sizeof(addr)));
+        socklen_t len = sizeof(addr);
+        ASSERT_EQ(0, getsockname(sockfd_,
+                                 reinterpret_cast<struct sockaddr*>(&addr),
+                                 &len));
+        port_ = ntohs(addr.sin_port);
+    }
+
+    /// @brief Starts the process handing off its sockets.
+    ///
+    /// The child process adds the socket to eth0, listens on the handoff
+    /// socket and receives packets until its successor is ready. It exits
+    /// with the status 0 if the handoff completed.
+    ///
+    /// @param ready_timeout readiness timeout of the successor in the
+    /// server.
+    void startServer(const long ready_timeout = TEST_TIMEOUT) {
+        ASSERT_NO_FATAL_FAILURE(openSocket());
+        child_pid_ = fork();
+        ASSERT_GE(child_pid_, 0);
+        if (child_pid_ > 0) {
+            // The socket belongs to the child process.
+            close(sockfd_);
+            sockfd_ = -1;
+            return;
+        }
+
+        int status = 1;
+        try {
+            IfaceMgr::instance().getIface("eth0")->
+                addSocket(SocketInfo(IOAddress("10.0.0.1"), port_, sockfd_));
+            SocketHandoff handoff(socket_name_, AF_INET, TEST_TIMEOUT,
+                                  ready_timeout);
+            handoff.listen(boost::bind(&SocketHandoffTest::readyCallback,
+                                       this));
+            const time_t deadline = time(NULL) + 10;
+            while (!ready_ && (time(NULL) < deadline)) {
+                IfaceMgr::instance().receive4(0, 100000);
+            }
+            if (ready_ && (handoff.getListenFD() < 0)) {
+                status = 0;
+            }
+        } catch (...) {
+        }
+        _exit(status);
+    }
+
+    /// @brief Takes over the sockets, waiting for the server to listen.
+    ///
+    /// @param handoff the handoff object.
+    /// @return PID returned by the @c SocketHandoff::takeOver.
+    int takeOver(SocketHandoff& handoff) {
+        for (int i = 0; i < 100; ++i) {
+            const int pid = handoff.takeOver();
+            if (pid != 0) {
+                return (pid);
+            }
+            usleep(50000);
+        }
+        return (0);
+    }
+
+    /// @brief Waits for the server process to exit.
+    ///
+    /// @return exit status of the server process or -1.
+    int waitServer() {
+        int status = 0;
+        if (waitpid(child_pid_, &status, 0) != child_pid_) {
+            return (-1);
+        }
+        child_pid_ = 0;
+        return (WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    }
+
+    /// @brief Connects to the handoff socket, waiting for the server to
+    /// listen.
+    ///
+    /// @return descriptor of the connection or -1.
+    int connectServer() {
+        for (int i = 0; i < 100; ++i) {
+            const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) {
+                return (-1);
+            }
+            struct sockaddr_un addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            strcpy(addr.sun_path, socket_name_.c_str());
+            if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+                        sizeof(addr)) == 0) {
+                return (fd);
+            }
+            close(fd);
+            usleep(50000);
+        }
+        return (-1);
+    }
+
+    /// @brief Invoked in the server process when the successor is ready.
+    void readyCallback() {
+        ready_ = true;
+    }
+
+    /// @brief Holds a fake configuration of the interfaces.
+    IfaceMgrTestConfig iface_mgr_test_config_;
+
+    /// @brief Path of the handoff socket.
+    std::string socket_name_;
+
+    /// @brief Socket handed off.
+    int sockfd_;
+
+    /// @brief Port the socket is bound to.
+    uint16_t port_;
+
+    /// @brief PID of the server process.
+    pid_t child_pid_;
+
+    /// @brief The successor is ready.
+    bool ready_;
+};
+
+// This test checks that the parameters of the handoff are validated.
+TEST_F(SocketHandoffTest, constructor) {
+    EXPECT_THROW(SocketHandoff(socket_name_, AF_UNIX), BadValue);
+    EXPECT_THROW(SocketHandoff("", AF_INET), BadValue);
+    EXPECT_THROW(SocketHandoff(std::string(200, 'a'), AF_INET6), BadValue);
+    EXPECT_THROW(SocketHandoff(socket_name_, AF_INET, 0), BadValue);
+    EXPECT_THROW(SocketHandoff(socket_name_, AF_INET, 1000, -1), BadValue);
+    EXPECT_NO_THROW(SocketHandoff(socket_name_, AF_INET6));
+}
+
+// This test checks that nothing is taken over when no server listens on
+// the handoff socket.
+TEST_F(SocketHandoffTest, noPeer) {
+    SocketHandoff handoff(socket_name_, AF_INET, TEST_TIMEOUT);
+    EXPECT_EQ(0, handoff.takeOver());
+    EXPECT_FALSE(handoff.isTakingOver());
+    EXPECT_EQ(0, IfaceMgr::instance().countInheritedSockets());
+    EXPECT_THROW(handoff.complete(), InvalidOperation);
+}
+
+// This test checks that the sockets of a running server are taken over
+// and that the server goes on when its successor aborts.
+TEST_F(SocketHandoffTest, takeOver) {
+    ASSERT_NO_FATAL_FAILURE(startServer());
+
+    // The first successor gives up: the server keeps its sockets.
+    {
+        SocketHandoff handoff(socket_name_, AF_INET, TEST_TIMEOUT);
+        ASSERT_EQ(child_pid_, takeOver(handoff));
+        EXPECT_EQ(1, IfaceMgr::instance().countInheritedSockets());
+        IfaceMgr::instance().closeInheritedSockets();
+    }
+
+    SocketHandoff handoff(socket_name_, AF_INET, TEST_TIMEOUT);
+    ASSERT_EQ(child_pid_, takeOver(handoff));
+    EXPECT_TRUE(handoff.isTakingOver());
+    EXPECT_EQ(1, IfaceMgr::instance().countInheritedSockets());
+
+    // The inherited socket is used instead of opening a new one.
+    ASSERT_NO_THROW(IfaceMgr::instance().openSockets4(port_));
+    IfacePtr eth0 = IfaceMgr::instance().getIface("eth0");
+    ASSERT_TRUE(eth0);
+    ASSERT_EQ(1, eth0->getSockets().size());
+    const int sockfd = eth0->getSockets().front().sockfd_;
+    EXPECT_EQ(0, IfaceMgr::instance().countInheritedSockets());
+
+    ASSERT_NO_THROW(handoff.complete());
+    EXPECT_FALSE(handoff.isTakingOver());
+    EXPECT_EQ(0, waitServer());
+
+    // The packets sent to the server are received by this process.
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(fd, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port_);
+    EXPECT_EQ(4, sendto(fd, "test", 4, 0,
+                        reinterpret_cast<struct sockaddr*>(&addr),
+                        sizeof(addr)));
+    close(fd);
+    char buf[8];
+    EXPECT_EQ(4, recv(sockfd, buf, sizeof(buf), MSG_DONTWAIT));
+
+    // This process can be replaced in turn. Only its user can connect.
+    ASSERT_NO_THROW(handoff.listen(SocketHandoff::ReadyCallback()));
+    EXPECT_GE(handoff.getListenFD(), 0);
+    struct stat st;
+    ASSERT_EQ(0, stat(socket_name_.c_str(), &st));
+    EXPECT_EQ(S_IRUSR | S_IWUSR, st.st_mode & 0777);
+    handoff.close();
+    EXPECT_NE(0, access(socket_name_.c_str(), F_OK));
+}
+
+// This test checks that a successor stalled in the middle of its
+// readiness message doesn't block the server and is dropped after the
+// timeout.
+TEST_F(SocketHandoffTest, stalledSuccessor) {
+    ASSERT_NO_FATAL_FAILURE(startServer(200));
+
+    const int fd = connectServer();
+    ASSERT_GE(fd, 0);
+
+    // Only a part of the length of the message is sent.
+    EXPECT_EQ(2, send(fd, "\0\0", 2, 0));
+    usleep(500000);
+
+    SocketHandoff handoff(socket_name_, AF_INET, TEST_TIMEOUT);
+    EXPECT_EQ(child_pid_, takeOver(handoff));
+    close(fd);
+    ASSERT_TRUE(handoff.isTakingOver());
+    ASSERT_NO_THROW(handoff.complete());
+    EXPECT_EQ(0, waitServer());
+}
+
+// This test checks that the server closes the connection of a successor
+// which is not ready within the timeout, without waiting for another
+// connection.
+TEST_F(SocketHandoffTest, readyTimeout) {
+    ASSERT_NO_FATAL_FAILURE(startServer(200));
+
+    const int fd = connectServer();
+    ASSERT_GE(fd, 0);
+    struct timeval tv;
+    tv.tv_sec = 5;
+    tv.tv_usec = 0;
+    ASSERT_EQ(0, setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)));
+
+    // The sockets sent by the server are discarded until the connection
+    // is closed.
+    char buf[1024];
+    ssize_t cc = 0;
+    while ((cc = recv(fd, buf, sizeof(buf), 0)) > 0) {
+    }
+    EXPECT_EQ(0, cc);
+    close(fd);
+}
+
+} // end of anonymous namespace
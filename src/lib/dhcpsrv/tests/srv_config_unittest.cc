@@ -10,6 +10,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/srv_config.h>
 #include <dhcpsrv/subnet.h>
+#include <dhcpsrv/timer_mgr.h>
 #include <gtest/gtest.h>
 
 using namespace isc::asiolink;
@@ -177,6 +178,42 @@ TEST_F(SrvConfigTest, loggingInfo) {
     EXPECT_EQ(2097152, conf_.getLoggingInfo()[0].destinations_[0].maxsize_);
 }
 
+// Check that the timer reporting the suppressed log messages is only
+// installed when a message limit is configured, and the timer publishing
+// the dropped messages when the asynchronous logging is enabled.
+TEST_F(SrvConfigTest, setupLogTimers) {
+    TimerMgrPtr timer_mgr = TimerMgr::instance();
+    timer_mgr->unregisterTimers();
+
+    LoggingInfo log1;
+    log1.name_ = "foo";
+    conf_.addLoggingInfo(log1);
+    ASSERT_NO_THROW(conf_.setupLogTimers());
+    EXPECT_EQ(0, timer_mgr->timersCount());
+
+    LoggingInfo log2;
+    log2.name_ = "bar";
+    isc::log::MessageLimit limit;
+    limit.message = "BAR_*";
+    limit.rate = 10;
+    limit.interval = 5;
+    log2.limits_.push_back(limit);
+    conf_.addLoggingInfo(log2);
+    ASSERT_NO_THROW(conf_.setupLogTimers());
+    EXPECT_EQ(1, timer_mgr->timersCount());
+    timer_mgr->unregisterTimers();
+
+    // The asynchronous logging adds the timer publishing the dropped
+    // messages.
+    AsyncLoggingInfo async_info;
+    async_info.enabled_ = true;
+    conf_.setAsyncLoggingInfo(async_info);
+    ASSERT_NO_THROW(conf_.setupLogTimers());
+    EXPECT_EQ(2, timer_mgr->timersCount());
+
+    timer_mgr->unregisterTimers();
+}
+
 // Check that the configuration summary including information about the status
 // of DDNS is returned.
 TEST_F(SrvConfigTest, summaryDDNS) {
@@ -279,6 +316,12 @@ TEST_F(SrvConfigTest, copy) {
     conf1.getCfgIface()->use(AF_INET, "eth0");
     conf1.addLoggingInfo(info);
 
+    // Enable the asynchronous logging for conf1.
+    AsyncLoggingInfo async_info;
+    async_info.enabled_ = true;
+    async_info.overflow_policy_ = isc::log::AsyncLogWriter::COUNT;
+    conf1.setAsyncLoggingInfo(async_info);
+
     // Add option definition.
     OptionDefinitionPtr def(new OptionDefinition("option-foo", 5, "string"));
     conf1.getCfgOptionDef()->add(def, "isc");
@@ -331,6 +374,19 @@ TEST_F(SrvConfigTest, equality) {
     EXPECT_TRUE(conf1 == conf2);
     EXPECT_FALSE(conf1 != conf2);
 
+    // Differ by asynchronous logging configuration.
+    AsyncLoggingInfo async_info;
+    async_info.enabled_ = true;
+    conf1.setAsyncLoggingInfo(async_info);
+
+    EXPECT_FALSE(conf1 == conf2);
+    EXPECT_TRUE(conf1 != conf2);
+
+    conf2.setAsyncLoggingInfo(async_info);
+
+    EXPECT_TRUE(conf1 == conf2);
+    EXPECT_FALSE(conf1 != conf2);
+
     // Differ by interface configuration.
     conf1.getCfgIface()->use(AF_INET, "eth0");
 
@@ -21,8 +21,8 @@ namespace hooks {
 // Constructor.
 CalloutHandle::CalloutHandle(const boost::shared_ptr<CalloutManager>& manager,
                     const boost::shared_ptr<LibraryManagerCollection>& lmcoll)
-    : lm_collection_(lmcoll), arguments_(), context_collection_(),
-      manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
+    : lm_collection_(lmcoll), arguments_(), argument_slots_(),
+      context_collection_(), manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
       next_step_(NEXT_STEP_CONTINUE) {
 
     // Call the "context_create" hook.  We should be OK doing this - although
@@ -42,6 +42,7 @@ CalloutHandle::~CalloutHandle() {
     // Explicitly clear the argument and context objects.  This should free up
     // all memory that could have been allocated by libraries that were loaded.
     arguments_.clear();
+    argument_slots_.clear();
     context_collection_.clear();
 
     // Normal destruction of the remaining variables will include the
@@ -58,12 +59,93 @@ CalloutHandle::~CalloutHandle() {
     // scope of this framework and is not addressed by it.
 }
 
+// Recycle the handle.  This does what the destructor and the constructor
+// do, but keeps the handle and the storage of the argument slots.
+
+void
+CalloutHandle::recycle() {
+    manager_->callCallouts(ServerHooks::CONTEXT_DESTROY, *this);
+
+    deleteAllArguments();
+    context_collection_.clear();
+    next_step_ = NEXT_STEP_CONTINUE;
+
+    manager_->callCallouts(ServerHooks::CONTEXT_CREATE, *this);
+}
+
+// Return the argument to set, using the slot of the argument if its name is
+// registered.
+
+boost::any&
+CalloutHandle::getArgumentForSet(const std::string& name) {
+    int index = server_hooks_.getArgumentIndex(name);
+    if (index < 0) {
+        return (arguments_[name]);
+    }
+
+    if (static_cast<size_t>(index) >= argument_slots_.size()) {
+        argument_slots_.resize(index + 1);
+    }
+    return (argument_slots_[index]);
+}
+
+// The "const" version of the above, throwing an exception if the argument
+// is not set.
+
+const boost::any&
+CalloutHandle::getArgumentForGet(const std::string& name) const {
+    int index = server_hooks_.getArgumentIndex(name);
+    if (index < 0) {
+        ElementCollection::const_iterator element_ptr = arguments_.find(name);
+        if (element_ptr != arguments_.end()) {
+            return (element_ptr->second);
+        }
+
+    } else if ((static_cast<size_t>(index) < argument_slots_.size()) &&
+               !argument_slots_[index].empty()) {
+        return (argument_slots_[index]);
+    }
+
+    isc_throw(NoSuchArgument, "unable to find argument with name " << name);
+}
+
+// Delete an argument.
+
+void
+CalloutHandle::deleteArgument(const std::string& name) {
+    int index = server_hooks_.getArgumentIndex(name);
+    if (index < 0) {
+        static_cast<void>(arguments_.erase(name));
+    } else {
+        deleteArgument(index);
+    }
+}
+
+// Delete all arguments.  The argument slots are emptied but not freed so
+// they are reused by the next packet.
+
+void
+CalloutHandle::deleteAllArguments() {
+    arguments_.clear();
+    for (ArgumentSlots::iterator i = argument_slots_.begin();
+         i != argument_slots_.end(); ++i) {
+        if (!i->empty()) {
+            *i = boost::any();
+        }
+    }
+}
+
 // Return the name of all argument items.
 
 vector<string>
 CalloutHandle::getArgumentNames() const {
 
     vector<string> names;
+    for (size_t i = 0; i < argument_slots_.size(); ++i) {
+        if (!argument_slots_[i].empty()) {
+            names.push_back(server_hooks_.getArgumentName(i));
+        }
+    }
     for (ElementCollection::const_iterator i = arguments_.begin();
          i != arguments_.end(); ++i) {
         names.push_back(i->first);
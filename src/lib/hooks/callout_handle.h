@@ -47,6 +47,7 @@ public:
 // Forward declaration of the library handle and related collection classes.
 
 class CalloutManager;
+class HooksManager;
 class LibraryHandle;
 class LibraryManagerCollection;
 
@@ -62,6 +63,10 @@ class LibraryManagerCollection;
 ///   are passed information by the server (and can return information to it)
 ///   through name/value pairs.  Each of these pairs is an argument and the
 ///   information is accessed through the {get,set}Argument() methods.
+///   The server code should access the arguments through the indexes
+///   assigned to their names by ServerHooks::registerArgument(), which
+///   avoids looking up the names.  Arguments set by index can be accessed
+///   by name and vice versa.
 ///
 /// - Per-packet context.  Each packet has a context associated with it, this
 ///   context being  on a per-library basis.  In other words, As a packet passes
@@ -112,6 +117,12 @@ public:
     /// need to be set when the CalloutHandle is constructed.
     typedef std::map<int, ElementCollection> ContextCollection;
 
+    /// Typedef for the collection of arguments whose names have been
+    /// registered with ServerHooks::registerArgument().  The vector is
+    /// indexed by the argument index, an empty "boost::any" meaning that the
+    /// argument is not set.
+    typedef std::vector<boost::any> ArgumentSlots;
+
     /// @brief Constructor
     ///
     /// Creates the object and calls the callouts on the "context_create"
@@ -149,7 +160,27 @@ public:
     /// @param value Value to set.  That can be of any data type.
     template <typename T>
     void setArgument(const std::string& name, T value) {
-        arguments_[name] = value;
+        getArgumentForSet(name) = value;
+    }
+
+    /// @brief Set argument by index
+    ///
+    /// Sets the value of an argument given the index assigned to its name by
+    /// ServerHooks::registerArgument().
+    ///
+    /// @param index Index of the argument.
+    /// @param value Value to set.  That can be of any data type.
+    ///
+    /// @throw NoSuchArgument The index is negative.
+    template <typename T>
+    void setArgument(const int index, T value) {
+        if (index < 0) {
+            isc_throw(NoSuchArgument, "invalid argument index " << index);
+        }
+        if (static_cast<size_t>(index) >= argument_slots_.size()) {
+            argument_slots_.resize(index + 1);
+        }
+        argument_slots_[index] = value;
     }
 
     /// @brief Get argument
@@ -166,13 +197,32 @@ public:
     ///        the variable provided to receive the value.
     template <typename T>
     void getArgument(const std::string& name, T& value) const {
-        ElementCollection::const_iterator element_ptr = arguments_.find(name);
-        if (element_ptr == arguments_.end()) {
-            isc_throw(NoSuchArgument, "unable to find argument with name " <<
-                      name);
+        value = boost::any_cast<T>(getArgumentForGet(name));
+    }
+
+    /// @brief Get argument by index
+    ///
+    /// Gets the value of an argument given the index assigned to its name by
+    /// ServerHooks::registerArgument().
+    ///
+    /// @param index Index of the argument.
+    /// @param value [out] Value to set.  The type of "value" is important:
+    ///        it must match the type of the value set.
+    ///
+    /// @throw NoSuchArgument The argument is not present.
+    /// @throw boost::bad_any_cast The argument is present, but the data type
+    ///        of the value is not the same as the type of the variable
+    ///        provided to receive the value.
+    template <typename T>
+    void getArgument(const int index, T& value) const {
+        if ((index < 0) ||
+            (static_cast<size_t>(index) >= argument_slots_.size()) ||
+            argument_slots_[index].empty()) {
+            isc_throw(NoSuchArgument, "unable to find argument with index " <<
+                      index);
         }
 
-        value = boost::any_cast<T>(element_ptr->second);
+        value = boost::any_cast<T>(argument_slots_[index]);
     }
 
     /// @brief Get argument names
@@ -192,19 +242,46 @@ public:
     /// by this method.
     ///
     /// @param name Name of the element in the argument list to set.
-    void deleteArgument(const std::string& name) {
-        static_cast<void>(arguments_.erase(name));
+    void deleteArgument(const std::string& name);
+
+    /// @brief Delete argument by index
+    ///
+    /// Deletes an argument given the index assigned to its name by
+    /// ServerHooks::registerArgument().  If the argument is not set, the
+    /// method is a no-op.
+    ///
+    /// N.B. If the element is a raw pointer, the pointed-to data is NOT deleted
+    /// by this method.
+    ///
+    /// @param index Index of the argument.
+    void deleteArgument(const int index) {
+        if ((index >= 0) &&
+            (static_cast<size_t>(index) < argument_slots_.size())) {
+            argument_slots_[index] = boost::any();
+        }
     }
 
     /// @brief Delete all arguments
     ///
-    /// Deletes all arguments associated with this context.
+    /// Deletes all arguments associated with this context.  The storage of
+    /// the arguments set by index is kept for reuse.
     ///
     /// N.B. If any elements are raw pointers, the pointed-to data is NOT
     /// deleted by this method.
-    void deleteAllArguments() {
-        arguments_.clear();
-    }
+    void deleteAllArguments();
+
+    /// @brief Recycle the handle
+    ///
+    /// Prepares the handle to be associated with another packet: calls the
+    /// "context_destroy" callouts, deletes all arguments and per-library
+    /// context, resets the next step to NEXT_STEP_CONTINUE and calls the
+    /// "context_create" callouts, as if the handle had been destroyed and
+    /// created again but without the cost of the allocations.
+    ///
+    /// The server code should not call it directly but use
+    /// HooksManager::recycleCalloutHandle(), which checks that the handle
+    /// is still associated with the loaded libraries.
+    void recycle();
 
     /// @brief Sets the next processing step.
     ///
@@ -338,6 +415,30 @@ public:
     std::string getHookName() const;
 
 private:
+    /// HooksManager::recycleCalloutHandle() checks the callout manager and
+    /// library manager collection of the handle.
+    friend class HooksManager;
+
+    /// @brief Return reference to argument to set
+    ///
+    /// Returns a reference to the value of the argument with the given
+    /// name, creating the argument if it does not exist.  The value is held
+    /// by the argument slots if the name is registered.
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Reference to the value of the argument.
+    boost::any& getArgumentForSet(const std::string& name);
+
+    /// @brief Return reference to argument to get
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Reference to the value of the argument.
+    ///
+    /// @throw NoSuchArgument No argument with the given name is present.
+    const boost::any& getArgumentForGet(const std::string& name) const;
+
     /// @brief Check index
     ///
     /// Gets the current library index, throwing an exception if it is not set
@@ -381,9 +482,14 @@ private:
     /// created.
     boost::shared_ptr<LibraryManagerCollection> lm_collection_;
 
-    /// Collection of arguments passed to the callouts
+    /// Collection of arguments passed to the callouts whose names are not
+    /// registered.
     ElementCollection arguments_;
 
+    /// Collection of arguments passed to the callouts whose names are
+    /// registered.
+    ArgumentSlots argument_slots_;
+
     /// Context collection - there is one entry per library context.
     ContextCollection context_collection_;
 
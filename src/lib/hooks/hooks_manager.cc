@@ -123,6 +123,27 @@ HooksManager::createCalloutHandle() {
     return (getHooksManager().createCalloutHandleInternal());
 }
 
+// Recycle a callout handle.  The handle is only recycled if nothing else
+// refers to it and the libraries have not been reloaded since its creation.
+
+void
+HooksManager::recycleCalloutHandleInternal(boost::shared_ptr<CalloutHandle>&
+                                           handle) {
+    conditionallyInitialize();
+    if (handle && handle.unique() &&
+        (handle->manager_ == callout_manager_) &&
+        (handle->lm_collection_ == lm_collection_)) {
+        handle->recycle();
+    } else {
+        handle = createCalloutHandleInternal();
+    }
+}
+
+void
+HooksManager::recycleCalloutHandle(boost::shared_ptr<CalloutHandle>& handle) {
+    getHooksManager().recycleCalloutHandleInternal(handle);
+}
+
 // Get the list of the names of loaded libraries.
 
 std::vector<std::string>
@@ -168,6 +189,13 @@ HooksManager::registerHook(const std::string& name) {
     return (ServerHooks::getServerHooks().registerHook(name));
 }
 
+// Shell around ServerHooks::registerArgument()
+
+int
+HooksManager::registerArgument(const std::string& name) {
+    return (ServerHooks::getServerHooks().registerArgument(name));
+}
+
 // Return pre- and post- library handles.
 
 isc::hooks::LibraryHandle&
@@ -146,6 +146,18 @@ public:
     /// @return Shared pointer to a CalloutHandle object.
     static boost::shared_ptr<CalloutHandle> createCalloutHandle();
 
+    /// @brief Recycle callout handle
+    ///
+    /// Prepares a callout handle to be associated with a new request.  If
+    /// the handle is not shared and was created for the currently loaded
+    /// libraries, it is recycled (see CalloutHandle::recycle()), otherwise
+    /// it is replaced by a new handle.  This saves the allocation of a
+    /// handle for each request.
+    ///
+    /// @param handle [in,out] Handle to recycle.  It may be null, in which
+    ///        case a new handle is created.
+    static void recycleCalloutHandle(boost::shared_ptr<CalloutHandle>& handle);
+
     /// @brief Register Hook
     ///
     /// This is just a convenience shell around the ServerHooks::registerHook()
@@ -164,6 +176,18 @@ public:
     ///         registered.
     static int registerHook(const std::string& name);
 
+    /// @brief Register Argument
+    ///
+    /// This is just a convenience shell around the
+    /// ServerHooks::registerArgument() method.
+    ///
+    /// @param name Name of the argument
+    ///
+    /// @return Index of the argument, to be used in the CalloutHandle
+    ///         argument-related calls.  This will be greater than or equal
+    ///         to zero.
+    static int registerArgument(const std::string& name);
+
     /// @brief Return list of loaded libraries
     ///
     /// Returns the names of the loaded libraries.
@@ -265,6 +289,11 @@ private:
     /// @return Shared pointer to a CalloutHandle object.
     boost::shared_ptr<CalloutHandle> createCalloutHandleInternal();
 
+    /// @brief Recycle callout handle
+    ///
+    /// @param handle [in,out] Handle to recycle.
+    void recycleCalloutHandleInternal(boost::shared_ptr<CalloutHandle>& handle);
+
     /// @brief Return pre-callouts library handle
     ///
     /// @return Reference to library handle associated with pre-library callout
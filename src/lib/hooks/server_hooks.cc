@@ -138,6 +138,36 @@ ServerHooks::getHookNames() const {
     return (names);
 }
 
+// Register an argument name.  As for the hooks, the index assigned to the
+// name is the current number of entries in the collection.
+
+int
+ServerHooks::registerArgument(const string& name) {
+
+    int index = arguments_.size();
+    pair<HookCollection::iterator, bool> result =
+        arguments_.insert(make_pair(name, index));
+
+    if (result.second) {
+        argument_names_.push_back(name);
+    }
+
+    // If the name was already registered, return its index.
+    return (result.first->second);
+}
+
+// Find the name associated with an argument index.
+
+const string&
+ServerHooks::getArgumentName(int index) const {
+    if ((index < 0) || (index >= getArgumentCount())) {
+        isc_throw(OutOfRange, "argument index " << index
+                  << " is not recognized");
+    }
+
+    return (argument_names_[index]);
+}
+
 // Return global ServerHooks object
 
 ServerHooks&
@@ -52,6 +52,11 @@ public:
 /// will speed up the time taken to locate the callouts, which may make a
 /// difference in a frequently-executed piece of code.)
 ///
+/// In the same way, the class assigns unique index numbers to the names of
+/// the arguments passed to the callouts.  The server code uses these numbers
+/// to set and get the arguments of a CalloutHandle without string lookups,
+/// while the callouts may still access them by name.
+///
 /// ServerHooks is a singleton object and is only accessible by the static
 /// method getServerHooks().
 
@@ -69,6 +74,9 @@ public:
     /// testing to reset the global ServerHooks object; it should never be
     /// used in production.
     ///
+    /// The argument names are kept, as their indexes are usually held in
+    /// static objects of the server code.
+    ///
     /// @throws isc::Unexpected if the registration of the pre-defined hooks
     ///         fails in some way.
     void reset();
@@ -126,6 +134,51 @@ public:
     /// @return Vector of strings holding hook names.
     std::vector<std::string> getHookNames() const;
 
+    /// @brief Register an argument name
+    ///
+    /// Registers the name of an argument passed to the callouts and returns
+    /// the argument index.  As the same argument is usually passed to the
+    /// callouts of several hooks, registering a name which is already
+    /// registered is not an error: the index previously assigned to the name
+    /// is returned.
+    ///
+    /// @param name Name of the argument
+    ///
+    /// @return Index of the argument, to be used in the CalloutHandle
+    ///         argument-related calls.  This will be greater than or equal
+    ///         to zero.
+    int registerArgument(const std::string& name);
+
+    /// @brief Get argument index
+    ///
+    /// Returns the index of an argument name.
+    ///
+    /// @param name Name of the argument
+    ///
+    /// @return Index of the argument or -1 if the name is not registered.
+    int getArgumentIndex(const std::string& name) const {
+        HookCollection::const_iterator i = arguments_.find(name);
+        return (i == arguments_.end() ? -1 : i->second);
+    }
+
+    /// @brief Get argument name
+    ///
+    /// Returns the name of an argument given the index.
+    ///
+    /// @param index Index of the argument
+    ///
+    /// @return Name of the argument.
+    ///
+    /// @throw isc::OutOfRange if the argument index is invalid.
+    const std::string& getArgumentName(int index) const;
+
+    /// @brief Return number of argument names
+    ///
+    /// @return Number of argument names registered.
+    int getArgumentCount() const {
+        return (argument_names_.size());
+    }
+
     /// @brief Return ServerHooks object
     ///
     /// Returns the global ServerHooks object.
@@ -167,6 +220,12 @@ private:
     /// simpler than using a multi-indexed container.)
     HookCollection  hooks_;                 ///< Hook name/index collection
     InverseHookCollection inverse_hooks_;   ///< Hook index/name collection
+
+    /// Argument name/index collection
+    HookCollection arguments_;
+
+    /// Argument names, by index
+    std::vector<std::string> argument_names_;
 };
 
 } // namespace util
@@ -316,6 +316,92 @@ TEST_F(CalloutHandleTest, StatusField) {
     EXPECT_EQ(CalloutHandle::NEXT_STEP_CONTINUE, handle.getStatus());
 }
 
+// Test that arguments can be accessed by the index assigned to their name,
+// and that arguments set by index can be accessed by name and vice versa.
+
+TEST_F(CalloutHandleTest, ArgumentIndex) {
+    CalloutHandle handle(getCalloutManager());
+
+    int one = ServerHooks::getServerHooks().registerArgument("index_one");
+    int two = ServerHooks::getServerHooks().registerArgument("index_two");
+    int value = 0;
+
+    // Set by index, get by index and by name.
+    handle.setArgument(one, 1);
+    handle.getArgument(one, value);
+    EXPECT_EQ(1, value);
+    handle.getArgument("index_one", value);
+    EXPECT_EQ(1, value);
+
+    // Set by name, get by index.
+    handle.setArgument("index_two", 2);
+    handle.getArgument(two, value);
+    EXPECT_EQ(2, value);
+
+    // Replace by index, get by name.
+    handle.setArgument(two, 22);
+    handle.getArgument("index_two", value);
+    EXPECT_EQ(22, value);
+
+    // An argument with a name which is not registered lives alongside.
+    handle.setArgument("index_three", 3);
+
+    vector<string> expected_names;
+    expected_names.push_back("index_one");
+    expected_names.push_back("index_two");
+    expected_names.push_back("index_three");
+    vector<string> actual_names = handle.getArgumentNames();
+    sort(actual_names.begin(), actual_names.end());
+    sort(expected_names.begin(), expected_names.end());
+    EXPECT_TRUE(expected_names == actual_names);
+
+    // Check type checking and invalid indexes.
+    string str;
+    EXPECT_THROW(handle.getArgument(one, str), boost::bad_any_cast);
+    EXPECT_THROW(handle.getArgument(-1, value), NoSuchArgument);
+    EXPECT_THROW(handle.getArgument(two + 1000, value), NoSuchArgument);
+    EXPECT_THROW(handle.setArgument(-1, value), NoSuchArgument);
+
+    // Delete by index and by name.
+    handle.deleteArgument(one);
+    EXPECT_THROW(handle.getArgument(one, value), NoSuchArgument);
+    EXPECT_THROW(handle.getArgument("index_one", value), NoSuchArgument);
+    handle.deleteArgument("index_two");
+    EXPECT_THROW(handle.getArgument(two, value), NoSuchArgument);
+    handle.getArgument("index_three", value);
+    EXPECT_EQ(3, value);
+
+    // Delete all arguments.
+    handle.setArgument(one, 1);
+    handle.deleteAllArguments();
+    EXPECT_THROW(handle.getArgument(one, value), NoSuchArgument);
+    EXPECT_THROW(handle.getArgument("index_three", value), NoSuchArgument);
+    EXPECT_TRUE(handle.getArgumentNames().empty());
+}
+
+// Test that a recycled handle is cleared.
+
+TEST_F(CalloutHandleTest, Recycle) {
+    CalloutHandle handle(getCalloutManager());
+
+    int one = ServerHooks::getServerHooks().registerArgument("index_one");
+    handle.setArgument(one, 1);
+    handle.setArgument("unregistered", 2);
+    handle.setStatus(CalloutHandle::NEXT_STEP_DROP);
+
+    handle.recycle();
+
+    int value;
+    EXPECT_THROW(handle.getArgument(one, value), NoSuchArgument);
+    EXPECT_THROW(handle.getArgument("unregistered", value), NoSuchArgument);
+    EXPECT_EQ(CalloutHandle::NEXT_STEP_CONTINUE, handle.getStatus());
+
+    // The handle can be used again.
+    handle.setArgument(one, 3);
+    handle.getArgument(one, value);
+    EXPECT_EQ(3, value);
+}
+
 // Further tests of the "skip" flag and tests of getting the name of the
 // hook to which the current callout is attached is in the "handles_unittest"
 // module.
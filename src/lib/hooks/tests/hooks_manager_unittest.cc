@@ -252,6 +252,44 @@ TEST_F(HooksManagerTest, CalloutHandleLoadLibrary) {
     handle.reset();
 }
 
+// Test that a callout handle is recycled only when it is not shared and the
+// libraries have not been reloaded since its creation.
+
+TEST_F(HooksManagerTest, RecycleCalloutHandle) {
+
+    // A null handle is replaced by a new one.
+    CalloutHandlePtr handle;
+    HooksManager::recycleCalloutHandle(handle);
+    ASSERT_TRUE(handle);
+    CalloutHandle* first = handle.get();
+
+    // A handle which is not shared is recycled.
+    handle->setArgument("data_1", 42);
+    HooksManager::recycleCalloutHandle(handle);
+    EXPECT_EQ(first, handle.get());
+    EXPECT_TRUE(handle->getArgumentNames().empty());
+
+    // A shared handle is replaced.
+    CalloutHandlePtr copy = handle;
+    HooksManager::recycleCalloutHandle(handle);
+    ASSERT_TRUE(handle);
+    EXPECT_NE(first, handle.get());
+    copy.reset();
+
+    // A handle created before the libraries are loaded is replaced.
+    CalloutHandle* second = handle.get();
+    HookLibsCollection library_names;
+    library_names.push_back(make_pair(std::string(FULL_CALLOUT_LIBRARY),
+                                      data::ConstElementPtr()));
+    EXPECT_TRUE(HooksManager::loadLibraries(library_names));
+    HooksManager::recycleCalloutHandle(handle);
+    ASSERT_TRUE(handle);
+    EXPECT_NE(second, handle.get());
+
+    // Release the handle before the libraries are unloaded.
+    handle.reset();
+}
+
 // This is effectively the same test as the LoadLibraries test.
 
 TEST_F(HooksManagerTest, ReloadSameLibraries) {
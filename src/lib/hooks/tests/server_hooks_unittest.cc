@@ -171,4 +171,38 @@ TEST(ServerHooksTest, HookCount) {
     EXPECT_EQ(6, hooks.getCount());
 }
 
+// Check the registration of argument names.
+
+TEST(ServerHooksTest, RegisterArguments) {
+    ServerHooks& hooks = ServerHooks::getServerHooks();
+    const int count = hooks.getArgumentCount();
+
+    // Register argument names, which are assigned consecutive indexes.
+    int alpha = hooks.registerArgument("argument_alpha");
+    int beta = hooks.registerArgument("argument_beta");
+    EXPECT_EQ(count, alpha);
+    EXPECT_EQ(count + 1, beta);
+    EXPECT_EQ(count + 2, hooks.getArgumentCount());
+
+    // Registering a name again returns the same index.
+    EXPECT_EQ(alpha, hooks.registerArgument("argument_alpha"));
+    EXPECT_EQ(count + 2, hooks.getArgumentCount());
+
+    // Check the mapping between names and indexes.
+    EXPECT_EQ(alpha, hooks.getArgumentIndex("argument_alpha"));
+    EXPECT_EQ(beta, hooks.getArgumentIndex("argument_beta"));
+    EXPECT_EQ(std::string("argument_alpha"), hooks.getArgumentName(alpha));
+    EXPECT_EQ(std::string("argument_beta"), hooks.getArgumentName(beta));
+
+    // Unknown names and invalid indexes are detected.
+    EXPECT_EQ(-1, hooks.getArgumentIndex("argument_unknown"));
+    EXPECT_THROW(hooks.getArgumentName(-1), isc::OutOfRange);
+    EXPECT_THROW(hooks.getArgumentName(count + 2), isc::OutOfRange);
+
+    // The argument names are kept across a reset.
+    hooks.reset();
+    EXPECT_EQ(beta, hooks.getArgumentIndex("argument_beta"));
+    EXPECT_EQ(count + 2, hooks.getArgumentCount());
+}
+
 } // Anonymous namespace
@@ -0,0 +1,209 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_log_writer.h>
+#include <log/log_formatter.h>
+#include <log/log_messages.h>
+#include <log/logger_name.h>
+#include <log/message_dictionary.h>
+
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <sched.h>
+
+using namespace isc::util::thread;
+
+namespace isc {
+namespace log {
+
+const size_t AsyncLogWriter::MAX_BATCH_SIZE;
+
+AsyncLogWriter::AsyncLogWriter(const size_t capacity,
+                               const OverflowPolicy& policy,
+                               const Sink& sink)
+    : policy_(policy), sink_(sink), drop_handler_(), queue_(capacity),
+      queued_num_(0), written_num_(0), dropped_num_(0), reported_num_(0),
+      sleeping_(false), stopping_(false), mutex_(), cond_(), thread_() {
+    if (!sink_) {
+        isc_throw(InvalidParameter, "asynchronous log writer requires"
+                  " a sink");
+    }
+    thread_.reset(new Thread(boost::bind(&AsyncLogWriter::run, this)));
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    stopping_.store(true);
+    {
+        Mutex::Locker lock(mutex_);
+        cond_.signal();
+    }
+    try {
+        thread_->wait();
+    } catch (...) {
+        // The writer thread does not throw, but a destructor must not
+        // either.
+    }
+}
+
+bool
+AsyncLogWriter::enqueue(const std::string& logger, const Severity& severity,
+                        const std::string& message) {
+    Record record(logger, severity, message,
+                  boost::posix_time::microsec_clock::universal_time());
+    for (;;) {
+        if (queue_.push(record)) {
+            ++queued_num_;
+            wakeUp();
+            return (true);
+        }
+        if ((policy_ != BLOCK) || stopping_.load()) {
+            break;
+        }
+        // The writer is behind: make sure it runs and try again.
+        wakeUp();
+        sched_yield();
+    }
+
+    const uint64_t dropped = ++dropped_num_;
+    if (drop_handler_) {
+        try {
+            drop_handler_(dropped);
+        } catch (...) {
+            // Logging must not fail because of the statistics.
+        }
+    }
+    return (false);
+}
+
+void
+AsyncLogWriter::flush() {
+    while (written_num_.load() < queued_num_.load()) {
+        wakeUp();
+        sched_yield();
+    }
+}
+
+AsyncLogWriter::OverflowPolicy
+AsyncLogWriter::policyFromText(const std::string& policy) {
+    if (policy == "block") {
+        return (BLOCK);
+    } else if (policy == "drop") {
+        return (DROP);
+    } else if (policy == "count") {
+        return (COUNT);
+    }
+    isc_throw(BadValue, "unsupported overflow policy '" << policy
+              << "', expected one of 'block', 'drop' or 'count'");
+}
+
+std::string
+AsyncLogWriter::policyToText(const OverflowPolicy& policy) {
+    switch (policy) {
+    case BLOCK:
+        return ("block");
+    case DROP:
+        return ("drop");
+    case COUNT:
+        return ("count");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
+void
+AsyncLogWriter::run() {
+    RecordCollection batch;
+    batch.reserve(MAX_BATCH_SIZE + 1);
+    for (;;) {
+        if (drain(batch)) {
+            continue;
+        }
+        // The queue is empty: the writer may only terminate now so no
+        // message queued before the destructor was called is lost.
+        if (stopping_.load()) {
+            break;
+        }
+
+        // Wait for messages. The producers check the sleeping flag after
+        // appending to the queue, and the queue is checked again after
+        // setting the flag, so a wakeup can't be missed.
+        Mutex::Locker lock(mutex_);
+        sleeping_.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (queue_.empty() && !stopping_.load()) {
+            cond_.wait(mutex_);
+        }
+        sleeping_.store(false);
+    }
+}
+
+bool
+AsyncLogWriter::drain(RecordCollection& batch) {
+    bool written = false;
+    for (;;) {
+        batch.clear();
+        Record record;
+        while ((batch.size() < MAX_BATCH_SIZE) && queue_.pop(record)) {
+            batch.push_back(std::move(record));
+        }
+        const size_t count = batch.size();
+        if (policy_ == COUNT) {
+            reportDropped(batch);
+        }
+        if (batch.empty()) {
+            return (written);
+        }
+        write(batch);
+        written_num_ += count;
+        written = true;
+        if (count < MAX_BATCH_SIZE) {
+            return (written);
+        }
+    }
+}
+
+void
+AsyncLogWriter::write(const RecordCollection& batch) {
+    try {
+        sink_(batch);
+    } catch (...) {
+        // Nowhere to report the error.
+    }
+}
+
+void
+AsyncLogWriter::reportDropped(RecordCollection& batch) {
+    const uint64_t dropped = dropped_num_.load();
+    if (dropped == reported_num_) {
+        return;
+    }
+    std::string text = MessageDictionary::globalDictionary()->
+        getText(LOG_ASYNC_MESSAGES_DROPPED);
+    replacePlaceholder(&text, boost::lexical_cast<std::string>(dropped -
+                                                               reported_num_),
+                       1);
+    batch.push_back(Record(getRootLoggerName(), WARN,
+                           std::string(LOG_ASYNC_MESSAGES_DROPPED) + " " +
+                           text,
+                           boost::posix_time::microsec_clock::universal_time()));
+    reported_num_ = dropped;
+}
+
+void
+AsyncLogWriter::wakeUp() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load()) {
+        Mutex::Locker lock(mutex_);
+        cond_.signal();
+    }
+}
+
+} // namespace log
+} // namespace isc
@@ -0,0 +1,267 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASYNC_LOG_WRITER_H
+#define ASYNC_LOG_WRITER_H
+
+#include <log/logger_level.h>
+#include <util/threads/lockfree_queue.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Asynchronous log writer.
+///
+/// In the synchronous mode every log message is written by the thread
+/// which produced it, while holding the process wide logging mutex and
+/// the interprocess lock on the logger lockfile. The asynchronous writer
+/// moves that cost out of the producing threads: the formatted messages
+/// are appended to a lock-free ring buffer which is drained by a
+/// background thread. The background thread hands the messages in
+/// batches to a sink, so the locks are taken once per batch rather than
+/// once per message.
+///
+/// When the ring buffer is full the behavior is selected by the overflow
+/// policy:
+/// - \c BLOCK - the producer waits until the writer makes room, no
+///   message is lost,
+/// - \c DROP - the message is discarded and counted,
+/// - \c COUNT - the message is discarded and counted, and the writer
+///   reports the number of discarded messages with a warning
+///   (LOG_ASYNC_MESSAGES_DROPPED) as soon as the buffer has room again.
+///
+/// The sink is only called from the writer thread.
+class AsyncLogWriter : public boost::noncopyable {
+public:
+
+    /// \brief Overflow policies.
+    enum OverflowPolicy {
+        BLOCK,
+        DROP,
+        COUNT
+    };
+
+    /// \brief A queued log message.
+    struct Record {
+        /// \brief Default constructor.
+        Record() : logger_(), severity_(NONE), message_(), timestamp_() {
+        }
+
+        /// \brief Constructor.
+        ///
+        /// \param logger full name of the logger.
+        /// \param severity severity of the message.
+        /// \param message formatted message.
+        /// \param timestamp time the message was produced (UTC).
+        Record(const std::string& logger, const Severity& severity,
+               const std::string& message,
+               const boost::posix_time::ptime& timestamp)
+            : logger_(logger), severity_(severity), message_(message),
+              timestamp_(timestamp) {
+        }
+
+        /// \brief Full name of the logger.
+        std::string logger_;
+
+        /// \brief Severity of the message.
+        Severity severity_;
+
+        /// \brief Formatted message.
+        std::string message_;
+
+        /// \brief Time the message was produced (UTC).
+        ///
+        /// The message is written later by the writer thread, so the
+        /// time is taken when the message is queued.
+        boost::posix_time::ptime timestamp_;
+    };
+
+    /// \brief Collection of records.
+    typedef std::vector<Record> RecordCollection;
+
+    /// \brief Type of the function writing a batch of records.
+    typedef boost::function<void(const RecordCollection&)> Sink;
+
+    /// \brief Type of the function called when a message is dropped.
+    ///
+    /// It receives the total number of dropped messages and is called by
+    /// the producing thread.
+    typedef boost::function<void(uint64_t)> DropHandler;
+
+    /// \brief Maximum number of records handed to the sink in one call.
+    static const size_t MAX_BATCH_SIZE = 256;
+
+    /// \brief Constructor.
+    ///
+    /// Starts the writer thread.
+    ///
+    /// \param capacity capacity of the ring buffer, rounded up to the
+    /// next power of 2.
+    /// \param policy overflow policy.
+    /// \param sink function writing the messages.
+    /// \throw isc::InvalidParameter if the capacity is 0 or the sink is
+    /// empty.
+    AsyncLogWriter(const size_t capacity, const OverflowPolicy& policy,
+                   const Sink& sink);
+
+    /// \brief Destructor.
+    ///
+    /// Stops the writer thread after it has written all queued messages.
+    ~AsyncLogWriter();
+
+    /// \brief Queues a message.
+    ///
+    /// This function is lock-free unless the writer thread is waiting
+    /// for messages and must be woken up, or the buffer is full and the
+    /// overflow policy is \c BLOCK.
+    ///
+    /// \param logger full name of the logger.
+    /// \param severity severity of the message.
+    /// \param message formatted message.
+    /// \return true if the message was queued, false if it was dropped.
+    bool enqueue(const std::string& logger, const Severity& severity,
+                 const std::string& message);
+
+    /// \brief Waits until all the queued messages have been written.
+    void flush();
+
+    /// \brief Installs the function called when a message is dropped.
+    ///
+    /// It must be called before the writer is used by other threads.
+    ///
+    /// \param handler function to call, an empty function disables the
+    /// notifications.
+    void setDropHandler(const DropHandler& handler) {
+        drop_handler_ = handler;
+    }
+
+    /// \brief Returns the overflow policy.
+    OverflowPolicy getPolicy() const {
+        return (policy_);
+    }
+
+    /// \brief Returns the capacity of the ring buffer.
+    size_t getCapacity() const {
+        return (queue_.getCapacity());
+    }
+
+    /// \brief Returns the number of queued messages.
+    uint64_t getQueuedNum() const {
+        return (queued_num_.load());
+    }
+
+    /// \brief Returns the number of written messages.
+    ///
+    /// The drop reports are not included.
+    uint64_t getWrittenNum() const {
+        return (written_num_.load());
+    }
+
+    /// \brief Returns the number of dropped messages.
+    uint64_t getDroppedNum() const {
+        return (dropped_num_.load());
+    }
+
+    /// \brief Converts the textual form of an overflow policy.
+    ///
+    /// \param policy "block", "drop" or "count".
+    /// \throw isc::BadValue if the policy is not recognized.
+    static OverflowPolicy policyFromText(const std::string& policy);
+
+    /// \brief Returns the textual form of an overflow policy.
+    ///
+    /// \param policy overflow policy.
+    static std::string policyToText(const OverflowPolicy& policy);
+
+private:
+
+    /// \brief Body of the writer thread.
+    void run();
+
+    /// \brief Writes the queued messages.
+    ///
+    /// \param batch storage for the batches, to avoid reallocating it.
+    /// \return true if at least one message was written.
+    bool drain(RecordCollection& batch);
+
+    /// \brief Hands a batch to the sink.
+    ///
+    /// The exceptions thrown by the sink are ignored: there is no one
+    /// to report them to.
+    ///
+    /// \param batch records to write.
+    void write(const RecordCollection& batch);
+
+    /// \brief Appends the report of the dropped messages to a batch.
+    ///
+    /// \param [out] batch batch to append the report to.
+    void reportDropped(RecordCollection& batch);
+
+    /// \brief Wakes the writer thread up if it is waiting.
+    void wakeUp();
+
+    /// \brief Overflow policy.
+    const OverflowPolicy policy_;
+
+    /// \brief Function writing the messages.
+    Sink sink_;
+
+    /// \brief Function called when a message is dropped.
+    DropHandler drop_handler_;
+
+    /// \brief Ring buffer.
+    isc::util::thread::LockFreeQueue<Record> queue_;
+
+    /// \brief Number of queued messages.
+    std::atomic<uint64_t> queued_num_;
+
+    /// \brief Number of written messages.
+    std::atomic<uint64_t> written_num_;
+
+    /// \brief Number of dropped messages.
+    std::atomic<uint64_t> dropped_num_;
+
+    /// \brief Number of dropped messages already reported.
+    ///
+    /// Only used by the writer thread.
+    uint64_t reported_num_;
+
+    /// \brief Indicates that the writer thread waits for messages.
+    std::atomic<bool> sleeping_;
+
+    /// \brief Indicates that the writer thread must terminate.
+    std::atomic<bool> stopping_;
+
+    /// \brief Mutex protecting the waits of the writer thread.
+    isc::util::thread::Mutex mutex_;
+
+    /// \brief Condition variable the writer thread waits on.
+    isc::util::thread::CondVar cond_;
+
+    /// \brief Writer thread.
+    boost::scoped_ptr<isc::util::thread::Thread> thread_;
+};
+
+/// \brief Pointer to the asynchronous log writer.
+typedef boost::shared_ptr<AsyncLogWriter> AsyncLogWriterPtr;
+
+} // namespace log
+} // namespace isc
+
+#endif // ASYNC_LOG_WRITER_H
@@ -418,11 +418,21 @@ writeProgramFile(const string& file, const vector<string>& ns_components,
          "\n" <<
          "const char* values[] = {\n";
 
-    // Output the identifiers and the associated text.
+    // Output the identifiers and the associated text. The identifiers are
+    // the constants declared above, so the dictionary can index the
+    // messages by the address of the identifier string.
+    string qualifier;
+    for (vector<string>::const_iterator k = ns_components.begin();
+         k != ns_components.end(); ++k) {
+        qualifier += *k + "::";
+    }
+    if (qualifier.empty()) {
+        qualifier = "::";
+    }
     idents = sortedIdentifiers(dictionary);
     for (vector<string>::const_iterator i = idents.begin();
         i != idents.end(); ++i) {
-            ccfile << "    \"" << *i << "\", \"" <<
+            ccfile << "    " << qualifier << *i << ", \"" <<
                 quoteString(dictionary.getText(*i)) << "\",\n";
     }
 
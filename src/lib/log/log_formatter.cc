@@ -65,5 +65,40 @@ checkExcessPlaceholders(string* message, unsigned int placeholder) {
     }
 }
 
+void
+checkPlaceholder(const MessageTemplate& message, const string& arg,
+                 const unsigned placeholder, string& complaints)
+{
+    if (message.hasPlaceholder(placeholder)) {
+        return;
+    }
+#ifdef ENABLE_LOGGER_CHECKS
+    // We're missing the placeholder, so throw an exception
+    isc_throw(MismatchedPlaceholders,
+              "Missing logger placeholder in message: " << message.getText());
+#else
+    // We're missing the placeholder, so add some complain
+    complaints.append(" @@Missing placeholder %" +
+                      lexical_cast<string>(placeholder) + " for '" + arg +
+                      "'@@");
+#endif /* ENABLE_LOGGER_CHECKS */
+}
+
+void
+checkExcessPlaceholders(const MessageTemplate& message,
+                        const unsigned placeholder, string& output)
+{
+    if (message.hasPlaceholder(placeholder)) {
+        // Excess placeholders were found. As above, this is called from the
+        // Formatter's destructor so it does not throw.
+#ifdef ENABLE_LOGGER_CHECKS
+        cerr << "Message " << output << endl;
+        assert("Excess logger placeholders still exist in message" == NULL);
+#else
+        output.append(" @@Excess logger placeholders still exist@@");
+#endif /* ENABLE_LOGGER_CHECKS */
+    }
+}
+
 }
 }
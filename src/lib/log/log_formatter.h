@@ -10,10 +10,12 @@
 #include <cstddef>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include <exceptions/exceptions.h>
 #include <boost/lexical_cast.hpp>
 #include <log/logger_level.h>
+#include <log/message_template.h>
 
 namespace isc {
 namespace log {
@@ -62,6 +64,35 @@ void
 replacePlaceholder(std::string* message, const std::string& replacement,
                    const unsigned placeholder);
 
+///
+/// \brief Internal missing placeholder checker
+///
+/// This is used internally by the Formatter when an argument is added. If
+/// the message has no placeholder for the argument, it throws (with
+/// logger checks enabled) or adds a complaint to be appended to the
+/// message.
+///
+/// \param message The message template
+/// \param arg The argument
+/// \param placeholder The placeholder number of the argument
+/// \param complaints Complaints appended to the message
+void
+checkPlaceholder(const MessageTemplate& message, const std::string& arg,
+                 const unsigned placeholder, std::string& complaints);
+
+///
+/// \brief Internal excess placeholder checker
+///
+/// This is used internally by the Formatter to check for excess
+/// placeholders (and fewer arguments) in a message template.
+///
+/// \param message The message template
+/// \param placeholder The first placeholder without an argument
+/// \param output The formatted message, a complaint is appended to it
+void
+checkExcessPlaceholders(const MessageTemplate& message,
+                        const unsigned placeholder, std::string& output);
+
 ///
 /// \brief The log message formatter
 ///
@@ -81,6 +112,10 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// .arg can be called on it. After the last .arg call is done, the object is
 /// destroyed and, again, we can produce the output.
 ///
+/// The message is a pre-parsed \c MessageTemplate shared with the message
+/// dictionary. The arguments are collected by the .arg calls and the
+/// output is built in a single pass when the object is destroyed.
+///
 /// Of course, if the logging is turned off, we don't bother with any replacing
 /// and just return.
 ///
@@ -109,12 +144,17 @@ private:
     /// \brief Message severity
     Severity severity_;
 
-    /// \brief The messages with %1, %2... placeholders
-    std::string* message_;
+    /// \brief The message with %1, %2... placeholders
+    MessageTemplatePtr message_;
 
     /// \brief Which will be the next placeholder to replace
     unsigned nextPlaceholder_;
 
+    /// \brief The arguments, in order
+    mutable std::vector<std::string> args_;
+
+    /// \brief Complaints about missing placeholders
+    mutable std::string complaints_;
 
 public:
     /// \brief Constructor of "active" formatter
@@ -127,14 +167,35 @@ public:
     ///
     /// \param severity The severity of the message (DEBUG, ERROR etc.)
     /// \param message The message with placeholders. We take ownership of
-    ///     it and we will modify the string. Must not be NULL unless
-    ///     logger is also NULL, but it's not checked.
+    ///     it. Must not be NULL unless logger is also NULL, but it's not
+    ///     checked.
     /// \param logger The logger where the final output will go, or NULL
     ///     if no output is wanted.
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
               Logger* logger = NULL) :
+        logger_(logger), severity_(severity), message_(),
+        nextPlaceholder_(0), args_(), complaints_()
+    {
+        if (message) {
+            message_.reset(new MessageTemplate(*message));
+            delete message;
+        }
+    }
+
+    /// \brief Constructor of "active" formatter from a message template
+    ///
+    /// This is the constructor used by the logger, the template comes
+    /// from the message dictionary.
+    ///
+    /// \param severity The severity of the message (DEBUG, ERROR etc.)
+    /// \param message The message template. Must not be NULL unless
+    ///     logger is also NULL, but it's not checked.
+    /// \param logger The logger where the final output will go, or NULL
+    ///     if no output is wanted.
+    Formatter(const Severity& severity, const MessageTemplatePtr& message,
+              Logger* logger) :
         logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        nextPlaceholder_(0), args_(), complaints_()
     {
     }
 
@@ -145,8 +206,11 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_),
+        args_(), complaints_()
     {
+        args_.swap(other.args_);
+        complaints_.swap(other.complaints_);
         other.logger_ = NULL;
     }
 
@@ -156,12 +220,15 @@ public:
     ~ Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(message_, ++nextPlaceholder_);
-                logger_->output(severity_, *message_);
+                std::string output;
+                message_->format(args_, output);
+                output.append(complaints_);
+                checkExcessPlaceholders(*message_, ++nextPlaceholder_,
+                                        output);
+                logger_->output(severity_, output);
             } catch (...) {
                 // Catch and ignore all exceptions here.
             }
-            delete message_;
         }
     }
 
@@ -175,6 +242,8 @@ public:
             severity_ = other.severity_;
             message_ = other.message_;
             nextPlaceholder_ = other.nextPlaceholder_;
+            args_.swap(other.args_);
+            complaints_.swap(other.complaints_);
             other.logger_ = NULL;
         }
 
@@ -217,18 +286,14 @@ public:
     /// \param arg The text to place into the placeholder.
     Formatter& arg(const std::string& arg) {
         if (logger_) {
-            // Note that this method does a replacement and returns the
-            // modified string. If there are multiple invocations of arg() (e.g.
-            // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
-            // operates on the string returned by the previous one. This
-            // sequential operation means that if we had a message like "%1 %2",
-            // and called .arg("%2").arg(42), we would get "42 42"; the first
-            // call replaces the %1" with "%2" and the second replaces all
-            // occurrences of "%2" with 42. (Conversely, the sequence
-            // .arg(42).arg("%1") would return "42 %1" - there are no recursive
-            // replacements).
+            // The arguments are only stored here, the placeholders are
+            // replaced in a single pass when the message is output. The
+            // arguments are never searched for placeholders, so with a
+            // message like "%1 %2", .arg("%2").arg(42) gives "%2 42".
             try {
-                replacePlaceholder(message_, arg, ++nextPlaceholder_ );
+                checkPlaceholder(*message_, arg, ++nextPlaceholder_,
+                                 complaints_);
+                args_.push_back(arg);
             }
             catch (...) {
                 // Something went wrong here, the log message is broken, so
@@ -251,8 +316,9 @@ public:
     /// the arguments for the message.
     void deactivate() {
         if (logger_) {
-            delete message_;
-            message_ = NULL;
+            message_.reset();
+            args_.clear();
+            complaints_.clear();
             logger_ = NULL;
         }
     }
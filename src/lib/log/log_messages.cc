@@ -7,6 +7,7 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_MESSAGES_DROPPED = "LOG_ASYNC_MESSAGES_DROPPED";
 extern const isc::log::MessageID LOG_BAD_DESTINATION = "LOG_BAD_DESTINATION";
 extern const isc::log::MessageID LOG_BAD_SEVERITY = "LOG_BAD_SEVERITY";
 extern const isc::log::MessageID LOG_BAD_STREAM = "LOG_BAD_STREAM";
@@ -14,6 +15,7 @@ extern const isc::log::MessageID LOG_DUPLICATE_MESSAGE_ID = "LOG_DUPLICATE_MESSA
 extern const isc::log::MessageID LOG_DUPLICATE_NAMESPACE = "LOG_DUPLICATE_NAMESPACE";
 extern const isc::log::MessageID LOG_INPUT_OPEN_FAIL = "LOG_INPUT_OPEN_FAIL";
 extern const isc::log::MessageID LOG_INVALID_MESSAGE_ID = "LOG_INVALID_MESSAGE_ID";
+extern const isc::log::MessageID LOG_MESSAGES_SUPPRESSED = "LOG_MESSAGES_SUPPRESSED";
 extern const isc::log::MessageID LOG_NAMESPACE_EXTRA_ARGS = "LOG_NAMESPACE_EXTRA_ARGS";
 extern const isc::log::MessageID LOG_NAMESPACE_INVALID_ARG = "LOG_NAMESPACE_INVALID_ARG";
 extern const isc::log::MessageID LOG_NAMESPACE_NO_ARGS = "LOG_NAMESPACE_NO_ARGS";
@@ -34,26 +36,28 @@ extern const isc::log::MessageID LOG_WRITE_ERROR = "LOG_WRITE_ERROR";
 namespace {
 
 const char* values[] = {
-    "LOG_BAD_DESTINATION", "unrecognized log destination: %1",
-    "LOG_BAD_SEVERITY", "unrecognized log severity: %1",
-    "LOG_BAD_STREAM", "bad log console output stream: %1",
-    "LOG_DUPLICATE_MESSAGE_ID", "duplicate message ID (%1) in compiled code",
-    "LOG_DUPLICATE_NAMESPACE", "line %1: duplicate $NAMESPACE directive found",
-    "LOG_INPUT_OPEN_FAIL", "unable to open message file %1 for input: %2",
-    "LOG_INVALID_MESSAGE_ID", "line %1: invalid message identification '%2'",
-    "LOG_NAMESPACE_EXTRA_ARGS", "line %1: $NAMESPACE directive has too many arguments",
-    "LOG_NAMESPACE_INVALID_ARG", "line %1: $NAMESPACE directive has an invalid argument ('%2')",
-    "LOG_NAMESPACE_NO_ARGS", "line %1: no arguments were given to the $NAMESPACE directive",
-    "LOG_NO_MESSAGE_ID", "line %1: message definition line found without a message ID",
-    "LOG_NO_MESSAGE_TEXT", "line %1: line found containing a message ID ('%2') and no text",
-    "LOG_NO_SUCH_MESSAGE", "could not replace message text for '%1': no such message",
-    "LOG_OPEN_OUTPUT_FAIL", "unable to open %1 for output: %2",
-    "LOG_PREFIX_EXTRA_ARGS", "line %1: $PREFIX directive has too many arguments",
-    "LOG_PREFIX_INVALID_ARG", "line %1: $PREFIX directive has an invalid argument ('%2')",
-    "LOG_READING_LOCAL_FILE", "reading local message file %1",
-    "LOG_READ_ERROR", "error reading from message file %1: %2",
-    "LOG_UNRECOGNIZED_DIRECTIVE", "line %1: unrecognized directive '%2'",
-    "LOG_WRITE_ERROR", "error writing to %1: %2",
+    isc::log::LOG_ASYNC_MESSAGES_DROPPED, "%1 log messages were dropped because the asynchronous logging queue was full",
+    isc::log::LOG_BAD_DESTINATION, "unrecognized log destination: %1",
+    isc::log::LOG_BAD_SEVERITY, "unrecognized log severity: %1",
+    isc::log::LOG_BAD_STREAM, "bad log console output stream: %1",
+    isc::log::LOG_DUPLICATE_MESSAGE_ID, "duplicate message ID (%1) in compiled code",
+    isc::log::LOG_DUPLICATE_NAMESPACE, "line %1: duplicate $NAMESPACE directive found",
+    isc::log::LOG_INPUT_OPEN_FAIL, "unable to open message file %1 for input: %2",
+    isc::log::LOG_INVALID_MESSAGE_ID, "line %1: invalid message identification '%2'",
+    isc::log::LOG_MESSAGES_SUPPRESSED, "%1 %2 messages were suppressed by the message limits in the last %3 seconds",
+    isc::log::LOG_NAMESPACE_EXTRA_ARGS, "line %1: $NAMESPACE directive has too many arguments",
+    isc::log::LOG_NAMESPACE_INVALID_ARG, "line %1: $NAMESPACE directive has an invalid argument ('%2')",
+    isc::log::LOG_NAMESPACE_NO_ARGS, "line %1: no arguments were given to the $NAMESPACE directive",
+    isc::log::LOG_NO_MESSAGE_ID, "line %1: message definition line found without a message ID",
+    isc::log::LOG_NO_MESSAGE_TEXT, "line %1: line found containing a message ID ('%2') and no text",
+    isc::log::LOG_NO_SUCH_MESSAGE, "could not replace message text for '%1': no such message",
+    isc::log::LOG_OPEN_OUTPUT_FAIL, "unable to open %1 for output: %2",
+    isc::log::LOG_PREFIX_EXTRA_ARGS, "line %1: $PREFIX directive has too many arguments",
+    isc::log::LOG_PREFIX_INVALID_ARG, "line %1: $PREFIX directive has an invalid argument ('%2')",
+    isc::log::LOG_READING_LOCAL_FILE, "reading local message file %1",
+    isc::log::LOG_READ_ERROR, "error reading from message file %1: %2",
+    isc::log::LOG_UNRECOGNIZED_DIRECTIVE, "line %1: unrecognized directive '%2'",
+    isc::log::LOG_WRITE_ERROR, "error writing to %1: %2",
     NULL
 };
 
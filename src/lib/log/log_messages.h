@@ -8,6 +8,7 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_MESSAGES_DROPPED;
 extern const isc::log::MessageID LOG_BAD_DESTINATION;
 extern const isc::log::MessageID LOG_BAD_SEVERITY;
 extern const isc::log::MessageID LOG_BAD_STREAM;
@@ -15,6 +16,7 @@ extern const isc::log::MessageID LOG_DUPLICATE_MESSAGE_ID;
 extern const isc::log::MessageID LOG_DUPLICATE_NAMESPACE;
 extern const isc::log::MessageID LOG_INPUT_OPEN_FAIL;
 extern const isc::log::MessageID LOG_INVALID_MESSAGE_ID;
+extern const isc::log::MessageID LOG_MESSAGES_SUPPRESSED;
 extern const isc::log::MessageID LOG_NAMESPACE_EXTRA_ARGS;
 extern const isc::log::MessageID LOG_NAMESPACE_INVALID_ARG;
 extern const isc::log::MessageID LOG_NAMESPACE_NO_ARGS;
@@ -11,7 +11,9 @@
 #include <log/logger_impl.h>
 #include <log/logger_name.h>
 #include <log/logger_support.h>
+#include <log/log_messages.h>
 #include <log/message_dictionary.h>
+#include <log/message_limiter.h>
 #include <log/message_types.h>
 
 #include <util/strutil.h>
@@ -132,9 +134,28 @@ Logger::output(const Severity& severity, const std::string& message) {
     getLoggerPtr()->outputRaw(severity, message);
 }
 
+bool
+Logger::checkLimits(const Severity& severity, const MessageID& ident) {
+    MessageLimiter& limiter = MessageLimiter::instance();
+    if (limiter.empty()) {
+        return (true);
+    }
+
+    uint64_t suppressed = 0;
+    uint32_t elapsed = 0;
+    const bool allowed = limiter.check(getLoggerPtr()->getName(), ident,
+                                       suppressed, elapsed);
+    if (suppressed > 0) {
+        Formatter(severity,
+                  getLoggerPtr()->lookupMessage(LOG_MESSAGES_SUPPRESSED),
+                  this).arg(suppressed).arg(ident).arg(elapsed);
+    }
+    return (allowed);
+}
+
 Logger::Formatter
 Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
-    if (isDebugEnabled(dbglevel)) {
+    if (isDebugEnabled(dbglevel) && checkLimits(DEBUG, ident)) {
         return (Formatter(DEBUG, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -144,7 +165,7 @@ Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::info(const isc::log::MessageID& ident) {
-    if (isInfoEnabled()) {
+    if (isInfoEnabled() && checkLimits(INFO, ident)) {
         return (Formatter(INFO, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -154,7 +175,7 @@ Logger::info(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::warn(const isc::log::MessageID& ident) {
-    if (isWarnEnabled()) {
+    if (isWarnEnabled() && checkLimits(WARN, ident)) {
         return (Formatter(WARN, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -164,7 +185,7 @@ Logger::warn(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::error(const isc::log::MessageID& ident) {
-    if (isErrorEnabled()) {
+    if (isErrorEnabled() && checkLimits(ERROR, ident)) {
         return (Formatter(ERROR, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -174,7 +195,7 @@ Logger::error(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::fatal(const isc::log::MessageID& ident) {
-    if (isFatalEnabled()) {
+    if (isFatalEnabled() && checkLimits(FATAL, ident)) {
         return (Formatter(FATAL, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
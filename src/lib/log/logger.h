@@ -320,6 +320,19 @@ private:
     /// \param message Text of the message to be output.
     void output(const Severity& severity, const std::string& message);
 
+    /// \brief Checks the message limits
+    ///
+    /// Checks whether the message is suppressed by a limit configured in
+    /// the \c MessageLimiter. This is done before the message is looked
+    /// up and formatted. When the limit reports suppressed messages, a
+    /// LOG_MESSAGES_SUPPRESSED summary is output with the severity of the
+    /// message.
+    ///
+    /// \param severity Severity of the message.
+    /// \param ident Message identification.
+    /// \return true if the message may be output.
+    bool checkLimits(const Severity& severity, const MessageID& ident);
+
     /// \brief Copy Constructor
     ///
     /// Disabled (marked private) as it makes no sense to copy the logger -
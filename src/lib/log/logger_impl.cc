@@ -12,13 +12,17 @@
 #include <stdio.h>
 #include <cstring>
 #include <sstream>
+#include <boost/bind.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <log4cplus/version.h>
 #include <log4cplus/configurator.h>
+#include <log4cplus/helpers/timehelper.h>
 #include <log4cplus/loggingmacros.h>
+#include <log4cplus/spi/loggingevent.h>
 
 #include <log/logger.h>
 #include <log/logger_impl.h>
@@ -42,6 +46,52 @@ using namespace std;
 namespace isc {
 namespace log {
 
+namespace {
+
+/// @brief Converts a time to the log4cplus representation.
+///
+/// @param time time to convert (UTC).
+/// @return log4cplus time.
+log4cplus::helpers::Time
+toLog4cplusTime(const boost::posix_time::ptime& time) {
+    const boost::posix_time::time_duration since_epoch =
+        time - boost::posix_time::from_time_t(0);
+#if LOG4CPLUS_VERSION < LOG4CPLUS_MAKE_VERSION(2, 0, 0)
+    return (log4cplus::helpers::Time(since_epoch.total_seconds(),
+                                     since_epoch.total_microseconds() %
+                                     1000000));
+#else
+    return (log4cplus::helpers::Time(std::chrono::duration_cast<
+        log4cplus::helpers::Time::duration>(std::chrono::microseconds(
+            since_epoch.total_microseconds()))));
+#endif
+}
+
+/// @brief Logging event stamped with the time the message was produced.
+///
+/// The log4cplus macros stamp the events with the current time, which
+/// in the asynchronous mode is the time the batch is written.
+class TimedLoggingEvent : public log4cplus::spi::InternalLoggingEvent {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param logger name of the logger.
+    /// @param level log4cplus level of the message.
+    /// @param message text of the message.
+    /// @param time time the message was produced (UTC).
+    TimedLoggingEvent(const string& logger, const log4cplus::LogLevel& level,
+                      const string& message,
+                      const boost::posix_time::ptime& time)
+        : log4cplus::spi::InternalLoggingEvent(logger, level, message,
+                                               __FILE__, __LINE__) {
+        if (!time.is_special()) {
+            timestamp = toLog4cplusTime(time);
+        }
+    }
+};
+
+} // end of anonymous namespace
+
 /// @brief detects whether file locking is enabled or disabled
 ///
 /// The lockfile is enabled by default. The only way to disable it is to
@@ -125,11 +175,15 @@ LoggerImpl::getEffectiveDebugLevel() {
 }
 
 
-// Output a general message
-string*
+// Look up the text of a message
+MessageTemplatePtr
 LoggerImpl::lookupMessage(const MessageID& ident) {
-    return (new string(string(ident) + " " +
-                       MessageDictionary::globalDictionary()->getText(ident)));
+    MessageTemplatePtr message =
+        MessageDictionary::globalDictionary()->getTemplate(ident);
+    if (!message) {
+        message.reset(new MessageTemplate(string(ident) + " "));
+    }
+    return (message);
 }
 
 // Replace the interprocess synchronization object
@@ -148,6 +202,14 @@ LoggerImpl::setInterprocessSync(isc::log::interprocess::InterprocessSync* sync)
 
 void
 LoggerImpl::outputRaw(const Severity& severity, const string& message) {
+    // In the asynchronous mode the message is written by the background
+    // writer, which takes the locks below once per batch of messages.
+    AsyncLogWriterPtr writer = LoggerManager::getAsyncWriter();
+    if (writer) {
+        writer->enqueue(name_, severity, message);
+        return;
+    }
+
     // Use a mutex locker for mutual exclusion from other threads in
     // this process.
     isc::util::thread::Mutex::Locker mutex_locker(LoggerManager::getMutex());
@@ -160,38 +222,96 @@ LoggerImpl::outputRaw(const Severity& severity, const string& message) {
         LOG4CPLUS_ERROR(logger_, "Unable to lock logger lockfile");
     }
 
+    output(logger_, severity, message);
+
+    if (!locker.unlock()) {
+        LOG4CPLUS_ERROR(logger_, "Unable to unlock logger lockfile");
+    }
+}
+
+AsyncLogWriter::Sink
+LoggerImpl::createAsyncSink() {
+    boost::shared_ptr<interprocess::InterprocessSync> sync;
+    if (lockfileEnabled()) {
+        sync.reset(new interprocess::InterprocessSyncFile("logger"));
+    } else {
+        sync.reset(new interprocess::InterprocessSyncNull("logger"));
+    }
+    return (boost::bind(&LoggerImpl::outputBatch, sync, _1));
+}
+
+void
+LoggerImpl::output(log4cplus::Logger& logger, const Severity& severity,
+                   const string& message) {
     switch (severity) {
         case DEBUG:
-            LOG4CPLUS_DEBUG(logger_, message);
+            LOG4CPLUS_DEBUG(logger, message);
             break;
 
         case INFO:
-            LOG4CPLUS_INFO(logger_, message);
+            LOG4CPLUS_INFO(logger, message);
             break;
 
         case WARN:
-            LOG4CPLUS_WARN(logger_, message);
+            LOG4CPLUS_WARN(logger, message);
             break;
 
         case ERROR:
-            LOG4CPLUS_ERROR(logger_, message);
+            LOG4CPLUS_ERROR(logger, message);
             break;
 
         case FATAL:
-            LOG4CPLUS_FATAL(logger_, message);
+            LOG4CPLUS_FATAL(logger, message);
             break;
 
         case NONE:
              break;
 
         default:
-            LOG4CPLUS_ERROR(logger_,
+            LOG4CPLUS_ERROR(logger,
                             "Unsupported severity in LoggerImpl::outputRaw(): "
                             << severity);
     }
+}
+
+void
+LoggerImpl::outputBatch(const boost::shared_ptr<
+                        interprocess::InterprocessSync>& sync,
+                        const AsyncLogWriter::RecordCollection& batch) {
+    isc::util::thread::Mutex::Locker mutex_locker(LoggerManager::getMutex());
+    interprocess::InterprocessSyncLocker locker(*sync);
+
+    if (!locker.lock()) {
+        LOG4CPLUS_ERROR(log4cplus::Logger::getRoot(),
+                        "Unable to lock logger lockfile");
+    }
+
+    // Consecutive messages are usually logged by the same logger.
+    log4cplus::Logger logger = log4cplus::Logger::getRoot();
+    string name;
+    for (AsyncLogWriter::RecordCollection::const_iterator record =
+             batch.begin(); record != batch.end(); ++record) {
+        if ((record == batch.begin()) || (record->logger_ != name)) {
+            name = record->logger_;
+            logger = log4cplus::Logger::getInstance(name);
+        }
+        // The events are built here rather than with the log4cplus
+        // macros so they carry the time the message was queued.
+        if (record->severity_ == NONE) {
+            continue;
+        }
+        const log4cplus::LogLevel level =
+            LoggerLevelImpl::convertFromBindLevel(Level(record->severity_));
+        if (logger.isEnabledFor(level)) {
+            logger.callAppenders(TimedLoggingEvent(name, level,
+                                                   record->message_,
+                                                   record->timestamp_));
+        }
+    }
 
     if (!locker.unlock()) {
-        LOG4CPLUS_ERROR(logger_, "Unable to unlock logger lockfile");
+        LOG4CPLUS_ERROR(log4cplus::Logger::getRoot(),
+                        "Unable to unlock logger lockfile");
     }
 }
 
@@ -16,13 +16,16 @@
 #include <map>
 #include <utility>
 #include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
 
 
 // log4cplus logger header file
 #include <log4cplus/logger.h>
 
 // Kea logger files
+#include <log/async_log_writer.h>
 #include <log/logger_level_impl.h>
+#include <log/message_template.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync.h>
 
@@ -153,17 +156,26 @@ public:
     /// \brief Raw output
     ///
     /// Writes the message with time into the log. Used by the Formatter
-    /// to produce output.
+    /// to produce output. When the asynchronous logging is enabled the
+    /// message is only queued for the background writer.
     ///
     /// \param severity Severity of the message. (This controls the prefix
     ///        label output with the message text.)
     /// \param message Text of the message.
     void outputRaw(const Severity& severity, const std::string& message);
 
+    /// \brief Creates the sink of the asynchronous writer.
+    ///
+    /// The returned function writes a batch of messages to the underlying
+    /// loggers, taking the logging mutex and the interprocess lock once
+    /// for the whole batch.
+    static AsyncLogWriter::Sink createAsyncSink();
+
     /// \brief Look up message text in dictionary
     ///
-    /// This gets you the unformatted text of message for given ID.
-    std::string* lookupMessage(const MessageID& id);
+    /// This gets you the pre-parsed text of message for given ID, prefixed
+    /// by the ID. An unknown ID gives the ID alone.
+    MessageTemplatePtr lookupMessage(const MessageID& id);
 
     /// \brief Replace the interprocess synchronization object
     ///
@@ -187,6 +199,22 @@ public:
     }
 
 private:
+    /// \brief Writes a message to a log4cplus logger.
+    ///
+    /// \param logger log4cplus logger.
+    /// \param severity Severity of the message.
+    /// \param message Text of the message.
+    static void output(log4cplus::Logger& logger, const Severity& severity,
+                       const std::string& message);
+
+    /// \brief Writes a batch of messages queued by the asynchronous writer.
+    ///
+    /// \param sync Interprocess synchronization object.
+    /// \param batch Messages to write.
+    static void outputBatch(const boost::shared_ptr<
+                            isc::log::interprocess::InterprocessSync>& sync,
+                            const AsyncLogWriter::RecordCollection& batch);
+
     std::string                  name_;   ///< Full name of this logger
     log4cplus::Logger            logger_; ///< Underlying log4cplus logger
     isc::log::interprocess::InterprocessSync* sync_;
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <log/logger.h>
+#include <log/logger_impl.h>
 #include <log/logger_manager.h>
 #include <log/logger_manager_impl.h>
 #include <log/logger_name.h>
@@ -18,6 +19,7 @@
 #include <log/message_exception.h>
 #include <log/message_initializer.h>
 #include <log/message_initializer.h>
+#include <log/message_limiter.h>
 #include <log/message_reader.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync_null.h>
@@ -47,6 +49,13 @@ std::string& initRootName() {
     return (root);
 }
 
+// Asynchronous writer, empty when the asynchronous logging is disabled.
+// It is only accessed with the atomic shared pointer functions. A thread
+// logging a message holds its own copy, so the writer is destroyed by the
+// last thread to release it. The pointer is constant initialized so it is
+// safe to use from static constructors.
+isc::log::AsyncLogWriterPtr async_writer;
+
 } // Anonymous namespace
 
 
@@ -66,6 +75,12 @@ LoggerManager::~LoggerManager() {
 // Initialize processing
 void
 LoggerManager::processInit() {
+    // The limits are about to be replaced.
+    flushSuppressedMessages();
+    AsyncLogWriterPtr writer = getAsyncWriter();
+    if (writer) {
+        writer->flush();
+    }
     impl_->processInit();
 }
 
@@ -140,6 +155,17 @@ LoggerManager::logDuplicatedMessages() {
     }
 }
 
+void
+LoggerManager::flushSuppressedMessages() {
+    MessageLimiter::ReportCollection reports;
+    MessageLimiter::instance().flush(reports);
+    for (MessageLimiter::ReportCollection::const_iterator report =
+             reports.begin(); report != reports.end(); ++report) {
+        Logger limited(report->logger_.c_str());
+        LOG_WARN(limited, LOG_MESSAGES_SUPPRESSED).arg(report->suppressed_)
+            .arg(report->message_).arg(report->elapsed_);
+    }
+}
 
 // Read local message file
 // TODO This should be done after the configuration has been read so that
@@ -200,5 +226,32 @@ LoggerManager::getMutex() {
     return (mutex);
 }
 
+void
+LoggerManager::startAsync(const size_t queue_size,
+                          const AsyncLogWriter::OverflowPolicy& policy,
+                          const AsyncLogWriter::DropHandler& drop_handler) {
+    // Create the new writer first so the current mode is kept if this
+    // fails.
+    AsyncLogWriterPtr writer(new AsyncLogWriter(queue_size, policy,
+                                                LoggerImpl::createAsyncSink()));
+    writer->setDropHandler(drop_handler);
+    stopAsync();
+    boost::atomic_store(&async_writer, writer);
+}
+
+void
+LoggerManager::stopAsync() {
+    // The destructor writes the queued messages. It runs here unless
+    // a thread is still logging with this writer, in which case that
+    // thread destroys the writer when it is done.
+    AsyncLogWriterPtr writer = boost::atomic_exchange(&async_writer,
+                                                      AsyncLogWriterPtr());
+}
+
+AsyncLogWriterPtr
+LoggerManager::getAsyncWriter() {
+    return (boost::atomic_load(&async_writer));
+}
+
 } // namespace log
 } // namespace isc
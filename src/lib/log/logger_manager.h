@@ -9,6 +9,7 @@
 
 #include <exceptions/exceptions.h>
 #include <util/threads/sync.h>
+#include <log/async_log_writer.h>
 #include <log/logger_specification.h>
 
 #include <boost/noncopyable.hpp>
@@ -120,6 +121,15 @@ public:
     /// hooks library is loaded.
     static void logDuplicatedMessages();
 
+    /// \brief Reports the messages suppressed by the message limits.
+    ///
+    /// The messages suppressed since the last report are otherwise only
+    /// reported when a message matching the same limit is logged. This
+    /// function reports them with a warning (LOG_MESSAGES_SUPPRESSED).
+    /// It is called when the logging configuration is replaced and it
+    /// should be called periodically and before the process exits.
+    static void flushSuppressedMessages();
+
     /// \brief Reset logging
     ///
     /// Resets logging to whatever was set in the call to init(), expect for
@@ -140,13 +150,53 @@ public:
     /// calls.
     static isc::util::thread::Mutex& getMutex();
 
+    /// \brief Enables the asynchronous logging.
+    ///
+    /// From now on the log messages are queued into a lock-free ring
+    /// buffer and written by a background thread. If the asynchronous
+    /// logging is already enabled the previous writer is first stopped,
+    /// after it has written the messages it holds.
+    ///
+    /// It is safe to call this function while other threads are logging:
+    /// their messages go to either the previous or the new writer.
+    ///
+    /// \param queue_size Capacity of the ring buffer, rounded up to the
+    ///        next power of 2.
+    /// \param policy Behavior when the ring buffer is full.
+    /// \param drop_handler Function called with the total number of
+    ///        dropped messages each time a message is dropped.
+    /// \throw isc::InvalidParameter if the queue size is 0.
+    static void startAsync(const size_t queue_size,
+                           const AsyncLogWriter::OverflowPolicy& policy,
+                           const AsyncLogWriter::DropHandler& drop_handler =
+                           AsyncLogWriter::DropHandler());
+
+    /// \brief Disables the asynchronous logging.
+    ///
+    /// Waits for the queued messages to be written, stops the background
+    /// thread and reverts to the synchronous logging. It does nothing when
+    /// the asynchronous logging is not enabled.
+    ///
+    /// It is safe to call this function while other threads are logging.
+    /// A thread which is queuing a message when the writer is stopped
+    /// keeps the writer alive until the message is queued, and then
+    /// destroys the writer which writes the message.
+    static void stopAsync();
+
+    /// \brief Returns the asynchronous writer.
+    ///
+    /// \return Pointer to the writer or null pointer if the asynchronous
+    ///         logging is not enabled.
+    static AsyncLogWriterPtr getAsyncWriter();
+
 private:
     /// \brief Initialize Processing
     ///
     /// Initializes the processing of a list of specifications by resetting all
     /// loggers to their defaults, which is to pass the message to their
     /// parent logger.  (Except for the root logger, where the default action is
-    /// to output the message.)
+    /// to output the message.) The messages queued for the asynchronous
+    /// writer are first written with the current configuration.
     void processInit();
 
     /// \brief Process Logging Specification
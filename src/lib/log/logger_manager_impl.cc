@@ -26,6 +26,7 @@
 #include <log/log_messages.h>
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
+#include <log/message_limiter.h>
 #include <log/buffer_appender_impl.h>
 
 #include <boost/lexical_cast.hpp>
@@ -69,6 +70,14 @@ LoggerManagerImpl::processSpecification(const LoggerSpecification& spec) {
     // Set the additive flag.
     logger.setAdditivity(spec.getAdditive());
 
+    // Install the message limits.
+    const std::vector<MessageLimit>& limits = spec.getMessageLimits();
+    for (std::vector<MessageLimit>::const_iterator limit = limits.begin();
+         limit != limits.end(); ++limit) {
+        MessageLimiter::instance().add(expandLoggerName(spec.getName()),
+                                       *limit);
+    }
+
     // Output options given?
     if (spec.optionCount() > 0) {
         // Replace all appenders for this logger.
@@ -206,6 +215,7 @@ void LoggerManagerImpl::initRootLogger(isc::log::Severity severity,
                                        int dbglevel, bool buffer)
 {
     log4cplus::Logger::getDefaultHierarchy().resetConfiguration();
+    MessageLimiter::instance().clear();
 
     // Disable log4cplus' own logging, unless --enable-debug was
     // specified to configure. Note that this does not change
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include <log/logger_level.h>
+#include <log/message_limiter.h>
 #include <log/output_option.h>
 
 /// \brief Logger Specification
@@ -125,6 +126,18 @@ public:
         return options_.size();
     }
 
+    /// \brief Add message limit.
+    ///
+    /// \param limit Limit to add to the list.
+    void addMessageLimit(const MessageLimit& limit) {
+        limits_.push_back(limit);
+    }
+
+    /// \return Message limits.
+    const std::vector<MessageLimit>& getMessageLimits() const {
+        return limits_;
+    }
+
     /// \brief Reset back to defaults.
     void reset() {
         name_ = "";
@@ -132,6 +145,7 @@ public:
         dbglevel_ = 0;
         additive_ = false;
         options_.clear();
+        limits_.clear();
     }
 
 private:
@@ -140,6 +154,7 @@ private:
     int                         dbglevel_;      ///< Debug level
     bool                        additive_;      ///< Chaining output
     std::vector<OutputOption>   options_;       ///< Logger options
+    std::vector<MessageLimit>   limits_;        ///< Message limits
 };
 
 } // namespace log
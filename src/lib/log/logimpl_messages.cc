@@ -17,9 +17,9 @@ extern const isc::log::MessageID LOGIMPL_BELOW_MIN_DEBUG = "LOGIMPL_BELOW_MIN_DE
 namespace {
 
 const char* values[] = {
-    "LOGIMPL_ABOVE_MAX_DEBUG", "debug level of %1 is too high and will be set to the maximum of %2",
-    "LOGIMPL_BAD_DEBUG_STRING", "debug string '%1' has invalid format",
-    "LOGIMPL_BELOW_MIN_DEBUG", "debug level of %1 is too low and will be set to the minimum of %2",
+    isc::log::LOGIMPL_ABOVE_MAX_DEBUG, "debug level of %1 is too high and will be set to the maximum of %2",
+    isc::log::LOGIMPL_BAD_DEBUG_STRING, "debug string '%1' has invalid format",
+    isc::log::LOGIMPL_BELOW_MIN_DEBUG, "debug level of %1 is too low and will be set to the minimum of %2",
     NULL
 };
 
@@ -15,7 +15,8 @@ namespace log {
 
 // Constructor
 
-MessageDictionary::MessageDictionary() : dictionary_(), empty_("") {
+MessageDictionary::MessageDictionary()
+    : dictionary_(), empty_(""), templates_(), slots_(), compiled_() {
 }
 
 // (Virtual) Destructor
@@ -33,6 +34,7 @@ MessageDictionary::add(const std::string& ident, const std::string& text) {
 
         // Message not already in the dictionary, so add it.
         dictionary_[ident] = text;
+        setTemplate(ident, text);
     }
 
     return (not_found);
@@ -48,6 +50,7 @@ MessageDictionary::replace(const std::string& ident, const std::string& text) {
 
         // Exists, so replace it.
         dictionary_[ident] = text;
+        setTemplate(ident, text);
     }
 
     return (found);
@@ -56,10 +59,27 @@ MessageDictionary::replace(const std::string& ident, const std::string& text) {
 bool
 MessageDictionary::erase(const std::string& ident, const std::string& text) {
     Dictionary::iterator mes = dictionary_.find(ident);
+    if (mes == dictionary_.end()) {
+        return (false);
+    }
+
+    // The ID may belong to a library which is being unloaded, so its
+    // address must not be used anymore. The lookups by name still work.
+    const size_t slot = slots_[ident];
+    for (CompiledIndex::iterator it = compiled_.begin();
+         it != compiled_.end(); ) {
+        if (it->second == slot) {
+            it = compiled_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
     // Both the ID and the text must match.
-    bool found = (mes != dictionary_.end() && (mes->second == text));
+    bool found = (mes->second == text);
     if (found) {
         dictionary_.erase(mes);
+        setTemplate(ident, "");
     }
     return (found);
 }
@@ -84,6 +104,13 @@ MessageDictionary::load(const char* messages[]) {
             bool added = add(ident, text);
             if (!added) {
                 duplicates.push_back(boost::lexical_cast<string>(ident));
+            } else {
+                // Index the slot by the address of the ID too, which is
+                // the address of the generated message ID constant.
+                SlotIndex::const_iterator slot = slots_.find(ident);
+                if (slot != slots_.end()) {
+                    compiled_[ident] = slot->second;
+                }
             }
         }
     }
@@ -105,6 +132,43 @@ MessageDictionary::getText(const std::string& ident) const {
     }
 }
 
+MessageTemplatePtr
+MessageDictionary::getTemplate(const MessageID& ident) const {
+    // Compiled message IDs are found by address.
+    CompiledIndex::const_iterator compiled = compiled_.find(ident);
+    if (compiled != compiled_.end()) {
+        return (templates_[compiled->second]);
+    }
+
+    // Other IDs (e.g. from a local message file or built at run time)
+    // are found by name.
+    SlotIndex::const_iterator slot = slots_.find(ident);
+    if (slot == slots_.end()) {
+        return (MessageTemplatePtr());
+    }
+    return (templates_[slot->second]);
+}
+
+size_t
+MessageDictionary::setTemplate(const std::string& ident,
+                               const std::string& text) {
+    size_t slot = templates_.size();
+    SlotIndex::const_iterator it = slots_.find(ident);
+    if (it != slots_.end()) {
+        slot = it->second;
+    } else {
+        slots_[ident] = slot;
+        templates_.push_back(MessageTemplatePtr());
+    }
+
+    if (text.empty()) {
+        templates_[slot].reset();
+    } else {
+        templates_[slot].reset(new MessageTemplate(ident + " " + text));
+    }
+    return (slot);
+}
+
 // Return global dictionary
 
 const MessageDictionaryPtr&
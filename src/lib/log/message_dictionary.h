@@ -14,7 +14,9 @@
 
 #include <boost/lexical_cast.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
 
+#include <log/message_template.h>
 #include <log/message_types.h>
 
 namespace isc {
@@ -43,6 +45,12 @@ typedef boost::shared_ptr<MessageDictionary> MessageDictionaryPtr;
 ///
 /// Although the class can be used stand-alone, it does supply a static method
 /// to return a particular instance - the "global" dictionary.
+///
+/// Each message also gets a slot holding its pre-parsed text, used by the
+/// loggers. The message IDs loaded with "load" are the constants generated
+/// by the message compiler, so the slot of such an ID is also indexed by
+/// the address of the ID string: looking up a compiled message ID is a
+/// pointer hash and an array index, without any string comparison.
 
 class MessageDictionary {
 public:
@@ -169,6 +177,17 @@ public:
     /// string.)
     virtual const std::string& getText(const std::string& ident) const;
 
+    /// \brief Get Message Template
+    ///
+    /// Given an ID, retrieve the pre-parsed message text prefixed by the
+    /// ID, i.e. the text output by the loggers.
+    ///
+    /// \param ident Message identification
+    ///
+    /// \return Template of the message or null pointer if the ID is not
+    /// recognized.
+    MessageTemplatePtr getTemplate(const MessageID& ident) const;
+
 
     /// \brief Number of Items in Dictionary
     ///
@@ -198,8 +217,33 @@ public:
     static const MessageDictionaryPtr& globalDictionary();
 
 private:
+    /// \brief Sets the template of a message.
+    ///
+    /// \param ident Identification of the message
+    /// \param text Message text, or empty to clear the template
+    /// \return Slot of the message
+    size_t setTemplate(const std::string& ident, const std::string& text);
+
+    /// \brief Map of the IDs to the slots
+    typedef std::map<std::string, size_t> SlotIndex;
+
+    /// \brief Map of the compiled ID addresses to the slots
+    typedef boost::unordered_map<const char*, size_t> CompiledIndex;
+
     Dictionary       dictionary_;   ///< Holds the ID to text lookups
     const std::string empty_;       ///< Empty string
+
+    /// \brief Templates of the messages, indexed by slot
+    ///
+    /// The slots are never reused: a removed message leaves an empty slot
+    /// which is used again if a message with the same ID is added.
+    std::vector<MessageTemplatePtr> templates_;
+
+    /// \brief Slots of the message IDs
+    SlotIndex slots_;
+
+    /// \brief Slots of the loaded (compiled) message IDs
+    CompiledIndex compiled_;
 };
 
 } // namespace log
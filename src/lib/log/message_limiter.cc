@@ -0,0 +1,190 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <log/message_limiter.h>
+
+#include <chrono>
+#include <cstring>
+
+namespace isc {
+namespace log {
+
+MessageLimiter&
+MessageLimiter::instance() {
+    static MessageLimiter limiter;
+    return (limiter);
+}
+
+MessageLimiter::MessageLimiter()
+    : rules_(), enabled_(false) {
+}
+
+void
+MessageLimiter::add(const std::string& logger, const MessageLimit& limit) {
+    if (limit.message.empty()) {
+        isc_throw(BadValue, "message limit of logger '" << logger
+                  << "' has no message ID");
+    }
+    if (limit.sample == 0) {
+        isc_throw(BadValue, "sample of the limit of message '"
+                  << limit.message << "' must be greater than 0");
+    }
+    if (limit.interval == 0) {
+        isc_throw(BadValue, "interval of the limit of message '"
+                  << limit.message << "' must be greater than 0");
+    }
+    // The rules added so far keep their state in the new collection.
+    boost::shared_ptr<RuleCollection> rules(new RuleCollection());
+    RuleCollectionPtr current = getRules();
+    if (current) {
+        *rules = *current;
+    }
+    rules->push_back(RulePtr(new Rule(logger, limit)));
+    boost::atomic_store(&rules_, RuleCollectionPtr(rules));
+    enabled_.store(true);
+}
+
+void
+MessageLimiter::clear() {
+    enabled_.store(false);
+    boost::atomic_store(&rules_, RuleCollectionPtr());
+}
+
+bool
+MessageLimiter::check(const std::string& logger, const MessageID& ident,
+                      uint64_t& suppressed, uint32_t& elapsed) {
+    return (check(logger, ident, currentTime(), suppressed, elapsed));
+}
+
+bool
+MessageLimiter::check(const std::string& logger, const MessageID& ident,
+                      const int64_t now, uint64_t& suppressed,
+                      uint32_t& elapsed) {
+    suppressed = 0;
+    elapsed = 0;
+
+    RuleCollectionPtr rules = getRules();
+    if (!rules) {
+        return (true);
+    }
+
+    // The first matching rule applies.
+    Rule* rule = NULL;
+    for (RuleCollection::const_iterator it = rules->begin();
+         it != rules->end(); ++it) {
+        if ((*it)->matches(logger, ident)) {
+            rule = it->get();
+            break;
+        }
+    }
+    if (!rule) {
+        return (true);
+    }
+    const MessageLimit& limit = rule->limit_;
+
+    // Start a new interval, reporting what was suppressed in the previous
+    // one. Only the thread which moves the start reports.
+    int64_t start = rule->start_.load();
+    if ((now - start >= limit.interval) &&
+        rule->start_.compare_exchange_strong(start, now)) {
+        rule->output_.store(0);
+        suppressed = rule->suppressed_.exchange(0);
+        const int64_t reported = rule->reported_.exchange(now);
+        if (suppressed > 0) {
+            elapsed = static_cast<uint32_t>(now - reported);
+        }
+    }
+
+    if ((limit.sample > 1) && ((rule->seen_++ % limit.sample) != 0)) {
+        ++rule->suppressed_;
+        return (false);
+    }
+    if ((limit.rate > 0) && (++rule->output_ > limit.rate)) {
+        ++rule->suppressed_;
+        return (false);
+    }
+    return (true);
+}
+
+uint32_t
+MessageLimiter::getMinInterval() const {
+    uint32_t interval = 0;
+    RuleCollectionPtr rules = getRules();
+    if (!rules) {
+        return (interval);
+    }
+    for (RuleCollection::const_iterator it = rules->begin();
+         it != rules->end(); ++it) {
+        if ((interval == 0) || ((*it)->limit_.interval < interval)) {
+            interval = (*it)->limit_.interval;
+        }
+    }
+    return (interval);
+}
+
+void
+MessageLimiter::flush(ReportCollection& reports) {
+    flush(currentTime(), reports);
+}
+
+void
+MessageLimiter::flush(const int64_t now, ReportCollection& reports) {
+    RuleCollectionPtr rules = getRules();
+    if (!rules) {
+        return;
+    }
+    for (RuleCollection::const_iterator it = rules->begin();
+         it != rules->end(); ++it) {
+        // The counts taken by check() and by this function are disjoint.
+        const uint64_t suppressed = (*it)->suppressed_.exchange(0);
+        if (suppressed == 0) {
+            continue;
+        }
+        Report report;
+        report.logger_ = (*it)->logger_;
+        report.message_ = (*it)->limit_.message;
+        report.suppressed_ = suppressed;
+        report.elapsed_ =
+            static_cast<uint32_t>(now - (*it)->reported_.exchange(now));
+        reports.push_back(report);
+    }
+}
+
+int64_t
+MessageLimiter::currentTime() {
+    return (std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+MessageLimiter::Rule::Rule(const std::string& logger,
+                           const MessageLimit& limit)
+    : logger_(logger), limit_(limit),
+      prefix_(limit.message[limit.message.size() - 1] == '*'),
+      seen_(0), start_(0), output_(0), suppressed_(0), reported_(0) {
+}
+
+bool
+MessageLimiter::Rule::matches(const std::string& logger,
+                              const char* ident) const {
+    // The logger must be the configured one or one of its children.
+    if (logger.compare(0, logger_.size(), logger_) != 0) {
+        return (false);
+    }
+    if ((logger.size() > logger_.size()) && (logger[logger_.size()] != '.')) {
+        return (false);
+    }
+    if (prefix_) {
+        return (std::strncmp(ident, limit_.message.c_str(),
+                             limit_.message.size() - 1) == 0);
+    }
+    return (std::strcmp(ident, limit_.message.c_str()) == 0);
+}
+
+} // namespace log
+} // namespace isc
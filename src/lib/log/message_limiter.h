@@ -0,0 +1,242 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MESSAGE_LIMITER_H
+#define MESSAGE_LIMITER_H
+
+#include <log/message_types.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Limit on the output of a log message
+///
+/// Describes how often the messages with a given ID (or with IDs starting
+/// with a given prefix) may be output by a logger and its children. The
+/// messages are first sampled (only one in \c sample is kept) and the
+/// kept messages are then rate limited (no more than \c rate per
+/// \c interval seconds).
+struct MessageLimit {
+    /// \brief Constructor
+    ///
+    /// The default limit lets every message through.
+    MessageLimit() : message(), sample(1), rate(0), interval(1)
+    {}
+
+    /// \brief Message ID, or a prefix of message IDs followed by "*"
+    std::string message;
+
+    /// \brief Only one message in this number is output (1 = all)
+    uint32_t sample;
+
+    /// \brief Maximum number of messages per interval (0 = unlimited)
+    uint32_t rate;
+
+    /// \brief Length of the rate limiting interval in seconds
+    ///
+    /// This is also the minimum delay between two reports of the number
+    /// of suppressed messages.
+    uint32_t interval;
+
+    /// \brief Compare two limits for equality.
+    bool operator==(const MessageLimit& other) const {
+        return ((message == other.message) && (sample == other.sample) &&
+                (rate == other.rate) && (interval == other.interval));
+    }
+};
+
+/// \brief Enforces the message limits
+///
+/// The limits are checked by the \c Logger before the message is looked
+/// up and formatted, so a suppressed message costs a few comparisons
+/// and atomic operations. When no limit is configured the check is a
+/// single load.
+///
+/// The suppressed messages are counted per limit. When a message is
+/// checked after the interval of its limit has elapsed, the number of
+/// messages suppressed since the previous report is returned so the
+/// logger can output a summary (LOG_MESSAGES_SUPPRESSED).
+///
+/// The messages suppressed since the last report are also reported by
+/// \c flush(), which is called periodically and before the limits are
+/// replaced or the process exits, so the counts are not lost when no
+/// matching message is logged anymore.
+///
+/// The limits are replaced by \c LoggerManager when the logging
+/// configuration is processed, possibly while other threads are
+/// logging. The rules are published as an immutable collection which
+/// is atomically swapped when a limit is added or the limits are
+/// cleared, so a check uses either the old or the new rules. The
+/// limits must only be modified by one thread at a time.
+class MessageLimiter : public boost::noncopyable {
+public:
+    /// \brief Number of messages suppressed by a limit.
+    struct Report {
+        /// \brief Full name of the logger of the limit.
+        std::string logger_;
+
+        /// \brief Message ID, or prefix of message IDs, of the limit.
+        std::string message_;
+
+        /// \brief Number of suppressed messages.
+        uint64_t suppressed_;
+
+        /// \brief Number of seconds covered by the report.
+        uint32_t elapsed_;
+    };
+
+    /// \brief Collection of reports.
+    typedef std::vector<Report> ReportCollection;
+
+    /// \brief Returns the process-wide limiter.
+    static MessageLimiter& instance();
+
+    /// \brief Constructor
+    MessageLimiter();
+
+    /// \brief Adds a limit.
+    ///
+    /// \param logger Full name of the logger the limit applies to. The
+    ///        limit applies to its children too.
+    /// \param limit The limit.
+    /// \throw isc::BadValue if the limit is invalid.
+    void add(const std::string& logger, const MessageLimit& limit);
+
+    /// \brief Removes all the limits.
+    void clear();
+
+    /// \brief Checks if there is no limit.
+    bool empty() const {
+        return (!enabled_.load(std::memory_order_relaxed));
+    }
+
+    /// \brief Checks whether a message may be output.
+    ///
+    /// \param logger Full name of the logger.
+    /// \param ident Message ID.
+    /// \param [out] suppressed Number of messages to report as suppressed
+    ///        (0 when no report is due).
+    /// \param [out] elapsed Number of seconds covered by the report.
+    /// \return true if the message may be output.
+    bool check(const std::string& logger, const MessageID& ident,
+               uint64_t& suppressed, uint32_t& elapsed);
+
+    /// \brief Checks whether a message may be output at a given time.
+    ///
+    /// This variant is used by the variant above and by the tests.
+    ///
+    /// \param logger Full name of the logger.
+    /// \param ident Message ID.
+    /// \param now Current time in seconds, from a monotonic clock.
+    /// \param [out] suppressed Number of messages to report as suppressed.
+    /// \param [out] elapsed Number of seconds covered by the report.
+    /// \return true if the message may be output.
+    bool check(const std::string& logger, const MessageID& ident,
+               const int64_t now, uint64_t& suppressed, uint32_t& elapsed);
+
+    /// \brief Returns the shortest interval of the limits.
+    ///
+    /// \return Interval in seconds, 0 if there is no limit.
+    uint32_t getMinInterval() const;
+
+    /// \brief Collects the messages suppressed since the last report.
+    ///
+    /// \param [out] reports Receives one report per limit which
+    ///        suppressed messages since its last report.
+    void flush(ReportCollection& reports);
+
+    /// \brief Collects the suppressed messages at a given time.
+    ///
+    /// This variant is used by the variant above and by the tests.
+    ///
+    /// \param now Current time in seconds, from a monotonic clock.
+    /// \param [out] reports Receives the reports.
+    void flush(const int64_t now, ReportCollection& reports);
+
+private:
+    /// \brief Returns the current time in seconds, from a monotonic clock.
+    static int64_t currentTime();
+
+    /// \brief A limit with its state.
+    struct Rule {
+        /// \brief Constructor
+        ///
+        /// \param logger Full name of the logger.
+        /// \param limit The limit.
+        Rule(const std::string& logger, const MessageLimit& limit);
+
+        /// \brief Checks if the rule applies to a message.
+        ///
+        /// \param logger Full name of the logger.
+        /// \param ident Message ID.
+        bool matches(const std::string& logger, const char* ident) const;
+
+        /// \brief Full name of the logger.
+        const std::string logger_;
+
+        /// \brief The limit.
+        const MessageLimit limit_;
+
+        /// \brief true if limit_.message is a prefix.
+        const bool prefix_;
+
+        /// \brief Number of messages seen, used for sampling.
+        std::atomic<uint64_t> seen_;
+
+        /// \brief Start of the current interval, in seconds.
+        std::atomic<int64_t> start_;
+
+        /// \brief Number of messages output in the current interval.
+        std::atomic<uint32_t> output_;
+
+        /// \brief Number of messages suppressed since the last report.
+        std::atomic<uint64_t> suppressed_;
+
+        /// \brief Time of the last report, in seconds.
+        ///
+        /// The reports are made when an interval starts or by flush().
+        std::atomic<int64_t> reported_;
+    };
+
+    /// \brief Pointer to a rule.
+    typedef boost::shared_ptr<Rule> RulePtr;
+
+    /// \brief Collection of rules.
+    typedef std::vector<RulePtr> RuleCollection;
+
+    /// \brief Pointer to an immutable collection of rules.
+    typedef boost::shared_ptr<const RuleCollection> RuleCollectionPtr;
+
+    /// \brief Returns the current rules.
+    ///
+    /// \return Pointer to the rules, null if there is no rule.
+    RuleCollectionPtr getRules() const {
+        return (boost::atomic_load(&rules_));
+    }
+
+    /// \brief The rules, in the order they were added.
+    ///
+    /// There are usually only a few rules so they are simply scanned.
+    /// The collection is never modified once published: it is replaced
+    /// with the atomic shared pointer functions.
+    RuleCollectionPtr rules_;
+
+    /// \brief true if there is at least one rule.
+    std::atomic<bool> enabled_;
+};
+
+} // namespace log
+} // namespace isc
+
+#endif // MESSAGE_LIMITER_H
@@ -0,0 +1,97 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <log/message_template.h>
+
+#include <cctype>
+
+using namespace std;
+
+namespace {
+
+/// \brief Highest placeholder number.
+///
+/// Digits which would make the number higher are literal text.
+const unsigned MAX_PLACEHOLDER = 999;
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace log {
+
+MessageTemplate::MessageTemplate(const string& text)
+    : text_(text), segments_(), placeholders_() {
+    size_t begin = 0;
+    size_t pos = 0;
+    while ((pos = text_.find('%', pos)) != string::npos) {
+        // Parse the number following the '%'.
+        size_t end = pos + 1;
+        unsigned placeholder = 0;
+        while ((end < text_.size()) &&
+               isdigit(static_cast<unsigned char>(text_[end])) &&
+               (placeholder * 10 + (text_[end] - '0') <= MAX_PLACEHOLDER)) {
+            placeholder = placeholder * 10 + (text_[end] - '0');
+            ++end;
+        }
+        if (placeholder == 0) {
+            // Not a placeholder, the '%' is literal text.
+            ++pos;
+            continue;
+        }
+
+        Segment segment;
+        segment.begin_ = begin;
+        segment.length_ = pos - begin;
+        segment.placeholder_ = placeholder;
+        segment.placeholder_length_ = end - pos;
+        segments_.push_back(segment);
+
+        if (placeholders_.size() <= placeholder) {
+            placeholders_.resize(placeholder + 1, false);
+        }
+        placeholders_[placeholder] = true;
+
+        begin = pos = end;
+    }
+
+    // Trailing literal text.
+    if (begin < text_.size()) {
+        Segment segment;
+        segment.begin_ = begin;
+        segment.length_ = text_.size() - begin;
+        segment.placeholder_ = 0;
+        segment.placeholder_length_ = 0;
+        segments_.push_back(segment);
+    }
+}
+
+void
+MessageTemplate::format(const vector<string>& args, string& output) const {
+    size_t size = output.size() + text_.size();
+    for (vector<string>::const_iterator arg = args.begin();
+         arg != args.end(); ++arg) {
+        size += arg->size();
+    }
+    output.reserve(size);
+
+    for (vector<Segment>::const_iterator segment = segments_.begin();
+         segment != segments_.end(); ++segment) {
+        output.append(text_, segment->begin_, segment->length_);
+        if (segment->placeholder_ == 0) {
+            continue;
+        }
+        if (segment->placeholder_ <= args.size()) {
+            output.append(args[segment->placeholder_ - 1]);
+        } else {
+            // No argument for this placeholder: keep it.
+            output.append(text_, segment->begin_ + segment->length_,
+                          segment->placeholder_length_);
+        }
+    }
+}
+
+} // namespace log
+} // namespace isc
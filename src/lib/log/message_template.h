@@ -0,0 +1,92 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MESSAGE_TEMPLATE_H
+#define MESSAGE_TEMPLATE_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Pre-parsed message text
+///
+/// The text of a message is split once, when the message is loaded into
+/// the dictionary, into literal segments and %1, %2... placeholders. The
+/// formatted message is then built in a single pass over the segments,
+/// instead of searching the text for each placeholder in turn.
+///
+/// A placeholder is a '%' followed by a decimal number greater than 0.
+/// Any other '%' is part of the literal text.
+class MessageTemplate {
+public:
+    /// \brief Constructor
+    ///
+    /// \param text Message text with placeholders.
+    explicit MessageTemplate(const std::string& text);
+
+    /// \brief Returns the message text.
+    const std::string& getText() const {
+        return (text_);
+    }
+
+    /// \brief Checks if the text contains a placeholder.
+    ///
+    /// \param placeholder Placeholder number (1 for %1).
+    /// \return true if the text contains the placeholder at least once.
+    bool hasPlaceholder(const unsigned placeholder) const {
+        return ((placeholder < placeholders_.size()) &&
+                placeholders_[placeholder]);
+    }
+
+    /// \brief Formats the message.
+    ///
+    /// The placeholders are replaced by the arguments. The arguments are
+    /// not scanned for placeholders. A placeholder without an argument is
+    /// output as is.
+    ///
+    /// \param args Arguments, args[0] replacing %1.
+    /// \param [out] output Formatted message is appended to this string.
+    void format(const std::vector<std::string>& args,
+                std::string& output) const;
+
+private:
+    /// \brief Literal text followed by an optional placeholder.
+    struct Segment {
+        /// \brief Position of the literal text.
+        size_t begin_;
+
+        /// \brief Length of the literal text.
+        size_t length_;
+
+        /// \brief Placeholder number, 0 if none.
+        unsigned placeholder_;
+
+        /// \brief Length of the placeholder text (e.g. 2 for %1).
+        size_t placeholder_length_;
+    };
+
+    /// \brief Message text.
+    std::string text_;
+
+    /// \brief Segments of the text, in order.
+    std::vector<Segment> segments_;
+
+    /// \brief Placeholders present in the text, indexed by number.
+    std::vector<bool> placeholders_;
+};
+
+/// \brief Pointer to a message template.
+typedef boost::shared_ptr<const MessageTemplate> MessageTemplatePtr;
+
+} // namespace log
+} // namespace isc
+
+#endif // MESSAGE_TEMPLATE_H
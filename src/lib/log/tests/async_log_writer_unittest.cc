@@ -0,0 +1,272 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_log_writer.h>
+#include <log/log_messages.h>
+#include <log/logger_name.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sched.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::log;
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Test fixture class for the \ref AsyncLogWriter.
+///
+/// It provides a sink collecting the written records, which can be
+/// held to simulate a slow destination.
+class AsyncLogWriterTest : public ::testing::Test {
+public:
+
+    /// \brief Constructor.
+    AsyncLogWriterTest()
+        : held_(false), batches_(0), dropped_(0) {
+    }
+
+    /// \brief Returns a sink writing to this fixture.
+    AsyncLogWriter::Sink getSink() {
+        return (boost::bind(&AsyncLogWriterTest::write, this, _1));
+    }
+
+    /// \brief Sink collecting the records.
+    ///
+    /// It waits while the sink is held.
+    ///
+    /// \param batch written records.
+    void write(const AsyncLogWriter::RecordCollection& batch) {
+        while (held_.load()) {
+            sched_yield();
+        }
+        Mutex::Locker lock(mutex_);
+        records_.insert(records_.end(), batch.begin(), batch.end());
+        ++batches_;
+    }
+
+    /// \brief Drop handler recording the number of dropped messages.
+    ///
+    /// \param dropped total number of dropped messages.
+    void dropped(const uint64_t dropped) {
+        dropped_ = dropped;
+    }
+
+    /// \brief Queues messages until the queue is full.
+    ///
+    /// The sink must be held.
+    ///
+    /// \param writer writer to fill.
+    /// \return number of queued messages.
+    int fill(AsyncLogWriter& writer) {
+        int queued = 0;
+        while (writer.enqueue("kea.test", INFO, "message " +
+                              boost::lexical_cast<std::string>(queued))) {
+            ++queued;
+        }
+        return (queued);
+    }
+
+    /// \brief Indicates that the sink must wait.
+    std::atomic<bool> held_;
+
+    /// \brief Protects the written records.
+    Mutex mutex_;
+
+    /// \brief Written records.
+    AsyncLogWriter::RecordCollection records_;
+
+    /// \brief Number of calls to the sink.
+    int batches_;
+
+    /// \brief Last value passed to the drop handler.
+    uint64_t dropped_;
+};
+
+// Test the conversions of the overflow policies.
+TEST_F(AsyncLogWriterTest, policy) {
+    EXPECT_EQ(AsyncLogWriter::BLOCK, AsyncLogWriter::policyFromText("block"));
+    EXPECT_EQ(AsyncLogWriter::DROP, AsyncLogWriter::policyFromText("drop"));
+    EXPECT_EQ(AsyncLogWriter::COUNT, AsyncLogWriter::policyFromText("count"));
+    EXPECT_THROW(AsyncLogWriter::policyFromText("wait"), isc::BadValue);
+    EXPECT_EQ("block", AsyncLogWriter::policyToText(AsyncLogWriter::BLOCK));
+    EXPECT_EQ("drop", AsyncLogWriter::policyToText(AsyncLogWriter::DROP));
+    EXPECT_EQ("count", AsyncLogWriter::policyToText(AsyncLogWriter::COUNT));
+
+    EXPECT_THROW(AsyncLogWriter(0, AsyncLogWriter::DROP, getSink()),
+                 isc::InvalidParameter);
+    EXPECT_THROW(AsyncLogWriter(16, AsyncLogWriter::DROP,
+                                AsyncLogWriter::Sink()),
+                 isc::InvalidParameter);
+}
+
+// Test that the messages are written in order and that flush() waits
+// for them.
+TEST_F(AsyncLogWriterTest, write) {
+    AsyncLogWriter writer(16, AsyncLogWriter::BLOCK, getSink());
+    EXPECT_EQ(16, writer.getCapacity());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(writer.enqueue("kea.test", (i % 2 ? DEBUG : ERROR),
+                                   boost::lexical_cast<std::string>(i)));
+    }
+    writer.flush();
+    EXPECT_EQ(1000, writer.getQueuedNum());
+    EXPECT_EQ(1000, writer.getWrittenNum());
+    EXPECT_EQ(0, writer.getDroppedNum());
+
+    Mutex::Locker lock(mutex_);
+    ASSERT_EQ(1000, records_.size());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ("kea.test", records_[i].logger_);
+        EXPECT_EQ((i % 2 ? DEBUG : ERROR), records_[i].severity_);
+        EXPECT_EQ(boost::lexical_cast<std::string>(i), records_[i].message_);
+    }
+    // The messages were written in batches.
+    EXPECT_LE(batches_, 1000);
+}
+
+// Test that the messages carry the time they were queued, not the time
+// they were written.
+TEST_F(AsyncLogWriterTest, timestamp) {
+    using namespace boost::posix_time;
+    held_ = true;
+    AsyncLogWriter writer(16, AsyncLogWriter::BLOCK, getSink());
+    const ptime before = microsec_clock::universal_time();
+    ASSERT_TRUE(writer.enqueue("kea.test", INFO, "message"));
+    const ptime after = microsec_clock::universal_time();
+
+    // Hold the sink long enough to tell the two times apart.
+    usleep(100000);
+    held_ = false;
+    writer.flush();
+
+    Mutex::Locker lock(mutex_);
+    ASSERT_EQ(1, records_.size());
+    EXPECT_LE(before, records_[0].timestamp_);
+    EXPECT_GE(after, records_[0].timestamp_);
+}
+
+// Test that the destructor writes the queued messages.
+TEST_F(AsyncLogWriterTest, destructor) {
+    {
+        AsyncLogWriter writer(1024, AsyncLogWriter::DROP, getSink());
+        for (int i = 0; i < 500; ++i) {
+            ASSERT_TRUE(writer.enqueue("kea.test", WARN, "message"));
+        }
+    }
+    EXPECT_EQ(500, records_.size());
+}
+
+// Test that the messages are dropped and counted when the queue is full
+// with the drop policy.
+TEST_F(AsyncLogWriterTest, drop) {
+    held_ = true;
+    AsyncLogWriter writer(4, AsyncLogWriter::DROP, getSink());
+    writer.setDropHandler(boost::bind(&AsyncLogWriterTest::dropped, this, _1));
+    const int queued = fill(writer);
+    EXPECT_GE(queued, 4);
+    EXPECT_EQ(1, writer.getDroppedNum());
+    EXPECT_EQ(1, dropped_);
+    EXPECT_FALSE(writer.enqueue("kea.test", INFO, "dropped"));
+    EXPECT_EQ(2, writer.getDroppedNum());
+    EXPECT_EQ(2, dropped_);
+
+    held_ = false;
+    writer.flush();
+    EXPECT_EQ(queued, writer.getWrittenNum());
+    Mutex::Locker lock(mutex_);
+    // No report is written with the drop policy.
+    ASSERT_EQ(queued, records_.size());
+    for (int i = 0; i < queued; ++i) {
+        EXPECT_EQ("message " + boost::lexical_cast<std::string>(i),
+                  records_[i].message_);
+    }
+}
+
+// Test that the number of dropped messages is reported with the count
+// policy.
+TEST_F(AsyncLogWriterTest, count) {
+    held_ = true;
+    AsyncLogWriter writer(4, AsyncLogWriter::COUNT, getSink());
+    const int queued = fill(writer);
+    EXPECT_FALSE(writer.enqueue("kea.test", INFO, "dropped"));
+    EXPECT_FALSE(writer.enqueue("kea.test", INFO, "dropped"));
+    EXPECT_EQ(3, writer.getDroppedNum());
+
+    held_ = false;
+    writer.flush();
+    // The report may be written after the messages.
+    for (int i = 0; i < 1000; ++i) {
+        {
+            Mutex::Locker lock(mutex_);
+            if (records_.size() > queued) {
+                break;
+            }
+        }
+        writer.enqueue("kea.test", INFO, "wake up");
+        writer.flush();
+    }
+
+    Mutex::Locker lock(mutex_);
+    bool found = false;
+    for (int i = 0; i < records_.size(); ++i) {
+        if (records_[i].message_.find(LOG_ASYNC_MESSAGES_DROPPED) == 0) {
+            EXPECT_FALSE(found);
+            found = true;
+            EXPECT_EQ(getRootLoggerName(), records_[i].logger_);
+            EXPECT_EQ(WARN, records_[i].severity_);
+            EXPECT_NE(std::string::npos,
+                      records_[i].message_.find(" 3 log messages"));
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
+/// \brief Queues messages from a thread.
+///
+/// \param writer writer to use.
+/// \param count number of messages.
+void
+produce(AsyncLogWriter* writer, const int count) {
+    for (int i = 0; i < count; ++i) {
+        writer->enqueue("kea.test", INFO, "message");
+    }
+}
+
+// Test that no message is lost with the block policy when several threads
+// log concurrently.
+TEST_F(AsyncLogWriterTest, block) {
+    AsyncLogWriter writer(8, AsyncLogWriter::BLOCK, getSink());
+    std::vector<boost::shared_ptr<Thread> > threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.push_back(boost::shared_ptr<Thread>(
+            new Thread(boost::bind(&produce, &writer, 5000))));
+    }
+    for (int i = 0; i < threads.size(); ++i) {
+        threads[i]->wait();
+    }
+    writer.flush();
+    EXPECT_EQ(20000, writer.getWrittenNum());
+    EXPECT_EQ(0, writer.getDroppedNum());
+    Mutex::Locker lock(mutex_);
+    EXPECT_EQ(20000, records_.size());
+}
+
+} // end of anonymous namespace
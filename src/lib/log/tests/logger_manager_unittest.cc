@@ -240,6 +240,40 @@ TEST_F(LoggerManagerTest, FileLogger) {
     checkFileContents(file_spec.getFileName(), ids.begin(), ids.end());
 }
 
+// Check that the messages logged in the asynchronous mode reach the file
+// in order.
+TEST_F(LoggerManagerTest, AsyncFileLogger) {
+    SpecificationForFileLogger file_spec;
+    LoggerManager manager;
+    manager.process(file_spec.getSpecification());
+
+    EXPECT_FALSE(LoggerManager::getAsyncWriter());
+    ASSERT_NO_THROW(LoggerManager::startAsync(4, AsyncLogWriter::BLOCK));
+    AsyncLogWriterPtr writer = LoggerManager::getAsyncWriter();
+    ASSERT_TRUE(writer);
+    EXPECT_EQ(AsyncLogWriter::BLOCK, writer->getPolicy());
+
+    vector<MessageID> ids;
+    {
+        Logger logger(file_spec.getLoggerName().c_str());
+        for (int i = 0; i < 10; ++i) {
+            LOG_FATAL(logger, LOG_DUPLICATE_MESSAGE_ID).arg(i);
+            ids.push_back(LOG_DUPLICATE_MESSAGE_ID);
+            LOG_FATAL(logger, LOG_NO_MESSAGE_ID).arg(i);
+            ids.push_back(LOG_NO_MESSAGE_ID);
+        }
+        EXPECT_EQ(20, writer->getQueuedNum());
+    }
+
+    // Stopping the asynchronous mode writes the queued messages once
+    // the last reference to the writer is released.
+    writer.reset();
+    LoggerManager::stopAsync();
+    EXPECT_FALSE(LoggerManager::getAsyncWriter());
+    LoggerManager::reset();
+    checkFileContents(file_spec.getFileName(), ids.begin(), ids.end());
+}
+
 // Check if the file rolls over when it gets above a certain size.
 TEST_F(LoggerManagerTest, FileSizeRollover) {
     // Set to a suitable minimum that log4cplus can copy with
@@ -197,6 +197,51 @@ TEST_F(MessageDictionaryTest, Lookups) {
     EXPECT_EQ(string(""), dictionary.getText("\n\n\n"));
 }
 
+// Check the message templates and their lookups by address and by name.
+
+TEST_F(MessageDictionaryTest, Templates) {
+    static const char alpha[] = "ALPHA";
+    static const char* data[] = {
+        alpha, "This is %1",
+        "BETA", "This is beta",
+        NULL
+    };
+
+    MessageDictionary dictionary;
+    EXPECT_FALSE(dictionary.getTemplate(alpha));
+    vector<string> duplicates = dictionary.load(data);
+    EXPECT_EQ(0, duplicates.size());
+
+    // The template holds the ID and the text.
+    MessageTemplatePtr message = dictionary.getTemplate(alpha);
+    ASSERT_TRUE(message);
+    EXPECT_EQ("ALPHA This is %1", message->getText());
+    EXPECT_TRUE(message->hasPlaceholder(1));
+
+    // The messages are found by name too.
+    const string beta("BETA");
+    message = dictionary.getTemplate(beta.c_str());
+    ASSERT_TRUE(message);
+    EXPECT_EQ("BETA This is beta", message->getText());
+    EXPECT_FALSE(dictionary.getTemplate("XYZZY"));
+
+    // Replacing the text replaces the template.
+    EXPECT_TRUE(dictionary.replace(string("ALPHA"), "Alpha is %1"));
+    message = dictionary.getTemplate(alpha);
+    ASSERT_TRUE(message);
+    EXPECT_EQ("ALPHA Alpha is %1", message->getText());
+
+    // Removed messages are not found anymore.
+    EXPECT_TRUE(dictionary.erase("ALPHA", "Alpha is %1"));
+    EXPECT_FALSE(dictionary.getTemplate(alpha));
+
+    // ... until they are added again.
+    EXPECT_TRUE(dictionary.add(string("ALPHA"), "Alpha again"));
+    message = dictionary.getTemplate(alpha);
+    ASSERT_TRUE(message);
+    EXPECT_EQ("ALPHA Alpha again", message->getText());
+}
+
 // Check that the global dictionary is a singleton.
 
 TEST_F(MessageDictionaryTest, GlobalTest) {
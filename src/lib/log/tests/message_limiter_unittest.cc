@@ -0,0 +1,222 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <log/message_limiter.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace isc;
+using namespace isc::log;
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Creates a limit.
+///
+/// \param message Message ID or prefix.
+/// \param sample Sampling ratio.
+/// \param rate Maximum number of messages per interval.
+/// \param interval Interval in seconds.
+MessageLimit
+createLimit(const std::string& message, const uint32_t sample,
+            const uint32_t rate, const uint32_t interval) {
+    MessageLimit limit;
+    limit.message = message;
+    limit.sample = sample;
+    limit.rate = rate;
+    limit.interval = interval;
+    return (limit);
+}
+
+/// \brief Counts the messages output out of a number of attempts.
+///
+/// \param limiter Limiter to use.
+/// \param logger Logger name.
+/// \param ident Message ID.
+/// \param now Current time.
+/// \param count Number of attempts.
+int
+countOutput(MessageLimiter& limiter, const std::string& logger,
+            const char* ident, const int64_t now, const int count) {
+    int output = 0;
+    for (int i = 0; i < count; ++i) {
+        uint64_t suppressed = 0;
+        uint32_t elapsed = 0;
+        if (limiter.check(logger, ident, now, suppressed, elapsed)) {
+            ++output;
+        }
+    }
+    return (output);
+}
+
+// Checks that invalid limits are rejected and that the limiter is empty
+// without limits.
+TEST(MessageLimiterTest, add) {
+    MessageLimiter limiter;
+    EXPECT_TRUE(limiter.empty());
+    EXPECT_THROW(limiter.add("kea", createLimit("", 1, 1, 1)), BadValue);
+    EXPECT_THROW(limiter.add("kea", createLimit("FOO", 0, 1, 1)), BadValue);
+    EXPECT_THROW(limiter.add("kea", createLimit("FOO", 1, 1, 0)), BadValue);
+    EXPECT_TRUE(limiter.empty());
+
+    EXPECT_NO_THROW(limiter.add("kea", createLimit("FOO", 1, 1, 1)));
+    EXPECT_FALSE(limiter.empty());
+    limiter.clear();
+    EXPECT_TRUE(limiter.empty());
+}
+
+// Checks that one message in N is output with sampling.
+TEST(MessageLimiterTest, sample) {
+    MessageLimiter limiter;
+    limiter.add("kea", createLimit("FOO", 10, 0, 60));
+    EXPECT_EQ(10, countOutput(limiter, "kea", "FOO", 100, 100));
+    // Other messages are not limited.
+    EXPECT_EQ(100, countOutput(limiter, "kea", "BAR", 100, 100));
+}
+
+// Checks the rate limit and the reports of suppressed messages.
+TEST(MessageLimiterTest, rate) {
+    MessageLimiter limiter;
+    limiter.add("kea", createLimit("FOO", 1, 5, 2));
+
+    // Only 5 messages are output in the interval.
+    EXPECT_EQ(5, countOutput(limiter, "kea", "FOO", 100, 20));
+    EXPECT_EQ(0, countOutput(limiter, "kea", "FOO", 101, 10));
+
+    // The next interval reports the 25 suppressed messages.
+    uint64_t suppressed = 0;
+    uint32_t elapsed = 0;
+    EXPECT_TRUE(limiter.check("kea", "FOO", 102, suppressed, elapsed));
+    EXPECT_EQ(25, suppressed);
+    EXPECT_EQ(2, elapsed);
+    EXPECT_EQ(4, countOutput(limiter, "kea", "FOO", 102, 10));
+
+    // Only one report is made per interval.
+    EXPECT_TRUE(limiter.check("kea", "FOO", 110, suppressed, elapsed));
+    EXPECT_EQ(6, suppressed);
+    EXPECT_EQ(8, elapsed);
+    EXPECT_TRUE(limiter.check("kea", "FOO", 110, suppressed, elapsed));
+    EXPECT_EQ(0, suppressed);
+
+    // Nothing is reported when nothing was suppressed.
+    EXPECT_TRUE(limiter.check("kea", "FOO", 120, suppressed, elapsed));
+    EXPECT_EQ(0, suppressed);
+}
+
+// Checks that the suppressed messages are reported by flush() when no
+// matching message is logged anymore.
+TEST(MessageLimiterTest, flush) {
+    MessageLimiter limiter;
+    EXPECT_EQ(0, limiter.getMinInterval());
+    limiter.add("kea", createLimit("FOO", 1, 5, 10));
+    limiter.add("kea", createLimit("BAR_*", 1, 1, 3));
+    EXPECT_EQ(3, limiter.getMinInterval());
+
+    // Nothing to report.
+    MessageLimiter::ReportCollection reports;
+    limiter.flush(100, reports);
+    EXPECT_TRUE(reports.empty());
+
+    EXPECT_EQ(5, countOutput(limiter, "kea", "FOO", 100, 20));
+    EXPECT_EQ(1, countOutput(limiter, "kea.child", "BAR_1", 100, 4));
+    limiter.flush(104, reports);
+    ASSERT_EQ(2, reports.size());
+    EXPECT_EQ("kea", reports[0].logger_);
+    EXPECT_EQ("FOO", reports[0].message_);
+    EXPECT_EQ(15, reports[0].suppressed_);
+    EXPECT_EQ(4, reports[0].elapsed_);
+    EXPECT_EQ("BAR_*", reports[1].message_);
+    EXPECT_EQ(3, reports[1].suppressed_);
+
+    // The flushed messages are not reported again, and the next report
+    // covers the time since the flush.
+    reports.clear();
+    limiter.flush(105, reports);
+    EXPECT_TRUE(reports.empty());
+    EXPECT_EQ(0, countOutput(limiter, "kea", "FOO", 106, 2));
+    uint64_t suppressed = 0;
+    uint32_t elapsed = 0;
+    EXPECT_TRUE(limiter.check("kea", "FOO", 110, suppressed, elapsed));
+    EXPECT_EQ(2, suppressed);
+    EXPECT_EQ(6, elapsed);
+}
+
+// Checks that the limits apply to the logger and its children, and that
+// prefixes match several messages.
+TEST(MessageLimiterTest, match) {
+    MessageLimiter limiter;
+    limiter.add("kea-dhcp4.packets", createLimit("DHCP4_PACKET_DROP_*", 1, 3,
+                                                 1));
+    limiter.add("kea-dhcp4", createLimit("DHCP4_LEASE_ALLOC", 2, 0, 1));
+
+    // The prefix rule counts the matching messages together.
+    EXPECT_EQ(3, countOutput(limiter, "kea-dhcp4.packets",
+                             "DHCP4_PACKET_DROP_0001", 10, 5));
+    EXPECT_EQ(0, countOutput(limiter, "kea-dhcp4.packets",
+                             "DHCP4_PACKET_DROP_0002", 10, 5));
+    // The parent and other loggers are not limited.
+    EXPECT_EQ(5, countOutput(limiter, "kea-dhcp4",
+                             "DHCP4_PACKET_DROP_0001", 10, 5));
+    EXPECT_EQ(5, countOutput(limiter, "kea-dhcp4.packetsx",
+                             "DHCP4_PACKET_DROP_0001", 10, 5));
+
+    // Children loggers are limited.
+    EXPECT_EQ(5, countOutput(limiter, "kea-dhcp4.leases",
+                             "DHCP4_LEASE_ALLOC", 10, 10));
+    EXPECT_EQ(10, countOutput(limiter, "kea-dhcp4.leases",
+                              "DHCP4_LEASE_ALLOCATED", 10, 10));
+}
+
+/// \brief Checks messages until told to stop.
+///
+/// \param limiter Limiter to use.
+/// \param stop Set to true when the checks must stop.
+/// \param [out] checked Number of checks done.
+void
+checkUntilStopped(MessageLimiter* limiter, std::atomic<bool>* stop,
+                       std::atomic<uint64_t>* checked) {
+    uint64_t suppressed = 0;
+    uint32_t elapsed = 0;
+    while (!stop->load()) {
+        limiter->check("kea-dhcp4.packets", "DHCP4_PACKET_DROP_0001",
+                       suppressed, elapsed);
+        ++(*checked);
+    }
+}
+
+// Checks that the limits may be replaced while other threads check the
+// messages.
+TEST(MessageLimiterTest, replaceWhileChecking) {
+    MessageLimiter limiter;
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> checked(0);
+    Thread thread1(boost::bind(&checkUntilStopped, &limiter, &stop,
+                               &checked));
+    Thread thread2(boost::bind(&checkUntilStopped, &limiter, &stop,
+                               &checked));
+
+    for (int i = 0; i < 1000; ++i) {
+        limiter.clear();
+        limiter.add("kea-dhcp4.packets",
+                    createLimit("DHCP4_PACKET_DROP_*", 1, 3, 1));
+        limiter.add("kea-dhcp4", createLimit("DHCP4_LEASE_ALLOC", 2, 0, 1));
+    }
+    EXPECT_EQ(1, limiter.getMinInterval());
+
+    stop.store(true);
+    thread1.wait();
+    thread2.wait();
+    EXPECT_LT(0, checked.load());
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,85 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/message_template.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace isc::log;
+using namespace std;
+
+namespace {
+
+/// \brief Formats a message.
+///
+/// \param text Message text.
+/// \param args Arguments separated by commas, empty for none.
+string
+format(const string& text, const string& args) {
+    vector<string> values;
+    size_t begin = 0;
+    while (begin < args.size()) {
+        size_t end = args.find(',', begin);
+        if (end == string::npos) {
+            end = args.size();
+        }
+        values.push_back(args.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    string output;
+    MessageTemplate(text).format(values, output);
+    return (output);
+}
+
+// Checks that the placeholders are found.
+TEST(MessageTemplateTest, placeholders) {
+    MessageTemplate message("ID %2 and %1, then %2 again at 100% or %0 %10");
+    EXPECT_EQ("ID %2 and %1, then %2 again at 100% or %0 %10",
+              message.getText());
+    EXPECT_FALSE(message.hasPlaceholder(0));
+    EXPECT_TRUE(message.hasPlaceholder(1));
+    EXPECT_TRUE(message.hasPlaceholder(2));
+    EXPECT_FALSE(message.hasPlaceholder(3));
+    EXPECT_TRUE(message.hasPlaceholder(10));
+    EXPECT_FALSE(message.hasPlaceholder(11));
+
+    EXPECT_FALSE(MessageTemplate("").hasPlaceholder(1));
+    EXPECT_FALSE(MessageTemplate("%").hasPlaceholder(1));
+    EXPECT_TRUE(MessageTemplate("%1").hasPlaceholder(1));
+}
+
+// Checks the formatting.
+TEST(MessageTemplateTest, format) {
+    EXPECT_EQ("", format("", ""));
+    EXPECT_EQ("no placeholder", format("no placeholder", ""));
+    EXPECT_EQ("A b", format("A %1", "b"));
+    EXPECT_EQ("b a b", format("%2 %1 %2", "a,b"));
+    EXPECT_EQ("100% of a", format("100% of %1", "a"));
+    EXPECT_EQ("x%", format("%1%", "x"));
+
+    // Placeholders without arguments are kept.
+    EXPECT_EQ("a %2", format("%1 %2", "a"));
+    EXPECT_EQ("%1 %2", format("%1 %2", ""));
+
+    // Arguments are not searched for placeholders.
+    EXPECT_EQ("%2 b", format("%1 %2", "%2,b"));
+
+    // Two digit placeholders.
+    EXPECT_EQ("1 10 1", format("%1 %10 %1", "1,2,3,4,5,6,7,8,9,10"));
+
+    // The output is appended.
+    string output("prefix ");
+    vector<string> args(1, "b");
+    MessageTemplate("a %1 c").format(args, output);
+    EXPECT_EQ("prefix a b c", output);
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,135 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <stats/histogram.h>
+#include <exceptions/exceptions.h>
+#include <cc/data.h>
+
+using namespace isc::data;
+
+namespace isc {
+namespace stats {
+
+Histogram::Histogram(const std::string& name)
+    :name_(name) {
+    reset();
+}
+
+void
+Histogram::addSample(const uint64_t value) {
+    ++buckets_[getBucketIndex(value)];
+    if ((count_ == 0) || (value < min_)) {
+        min_ = value;
+    }
+    if (value > max_) {
+        max_ = value;
+    }
+    ++count_;
+    sum_ += value;
+}
+
+void
+Histogram::reset() {
+    count_ = 0;
+    sum_ = 0;
+    min_ = 0;
+    max_ = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        buckets_[i] = 0;
+    }
+}
+
+uint64_t
+Histogram::getBucketCount(const size_t bucket) const {
+    if (bucket >= NUM_BUCKETS) {
+        isc_throw(OutOfRange, "histogram bucket index " << bucket
+                  << " is out of range");
+    }
+    return (buckets_[bucket]);
+}
+
+uint64_t
+Histogram::getBucketUpperBound(const size_t bucket) {
+    if (bucket >= NUM_BUCKETS) {
+        isc_throw(OutOfRange, "histogram bucket index " << bucket
+                  << " is out of range");
+    }
+    if (bucket == NUM_BUCKETS - 1) {
+        return (0);
+    }
+    return (static_cast<uint64_t>(1) << bucket);
+}
+
+size_t
+Histogram::getBucketIndex(const uint64_t value) {
+    // The bucket index is the number of significant bits of the value,
+    // i.e. 0 for 0, 1 for 1, 2 for 2-3, 3 for 4-7 etc.
+    size_t index = 0;
+    for (uint64_t v = value; (v != 0) && (index < NUM_BUCKETS - 1); v >>= 1) {
+        ++index;
+    }
+    return (index);
+}
+
+uint64_t
+Histogram::getPercentile(const double percentile) const {
+    if ((percentile <= 0.0) || (percentile > 100.0)) {
+        isc_throw(OutOfRange, "percentile " << percentile
+                  << " is out of range (0, 100]");
+    }
+    if (count_ == 0) {
+        return (0);
+    }
+
+    // Number of samples which must be lower or equal to the percentile.
+    uint64_t rank = static_cast<uint64_t>(percentile * count_ / 100.0);
+    if (rank * 100.0 < percentile * count_) {
+        ++rank;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        seen += buckets_[i];
+        if ((seen >= rank) && (seen > 0)) {
+            uint64_t bound = getBucketUpperBound(i);
+            // The upper bound is exclusive, so the highest value in the
+            // bucket is one less. It can't be higher than the maximum.
+            if ((bound == 0) || (bound - 1 > max_)) {
+                return (max_);
+            }
+            return (bound - 1);
+        }
+    }
+    return (max_);
+}
+
+ConstElementPtr
+Histogram::getJSON() const {
+    ElementPtr map = Element::createMap();
+    map->set("count", Element::create(static_cast<int64_t>(count_)));
+    map->set("sum", Element::create(static_cast<int64_t>(sum_)));
+    map->set("min", Element::create(static_cast<int64_t>(getMin())));
+    map->set("max", Element::create(static_cast<int64_t>(max_)));
+    map->set("p50", Element::create(static_cast<int64_t>(count_ > 0 ?
+                                                         getPercentile(50) : 0)));
+    map->set("p99", Element::create(static_cast<int64_t>(count_ > 0 ?
+                                                         getPercentile(99) : 0)));
+
+    ElementPtr buckets = Element::createList();
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        if (buckets_[i] == 0) {
+            continue;
+        }
+        ElementPtr bucket = Element::createList();
+        bucket->add(Element::create(static_cast<int64_t>(getBucketUpperBound(i))));
+        bucket->add(Element::create(static_cast<int64_t>(buckets_[i])));
+        buckets->add(bucket);
+    }
+    map->set("buckets", buckets);
+    return (map);
+}
+
+};
+};
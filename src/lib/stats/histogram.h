@@ -0,0 +1,142 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cc/data.h>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace stats {
+
+/// @brief Fixed-bucket histogram of latency samples.
+///
+/// The histogram is meant to aggregate large numbers of latency samples
+/// (e.g. time spent by a packet in a given processing stage) at a very
+/// low cost, so it can be left enabled in production. It uses a fixed
+/// number of buckets with exponentially growing bounds: the bucket 0
+/// holds samples lower than 1, the bucket N holds samples in the
+/// range of [2^(N-1), 2^N) and the last bucket holds all samples
+/// greater or equal to 2^(NUM_BUCKETS-2). With samples expressed in
+/// microseconds, the last bucket starts at about 4.8 hours, which is
+/// well beyond any sensible packet processing time.
+///
+/// Recording a sample doesn't allocate memory. Besides the bucket
+/// counters the histogram maintains the number of samples, their sum
+/// as well as the minimum and maximum value.
+class Histogram {
+public:
+
+    /// @brief Number of buckets.
+    static const size_t NUM_BUCKETS = 36;
+
+    /// @brief Constructor.
+    ///
+    /// @param name histogram name
+    explicit Histogram(const std::string& name);
+
+    /// @brief Records a sample.
+    ///
+    /// @param value sample value (typically in microseconds)
+    void addSample(const uint64_t value);
+
+    /// @brief Resets all counters to zero.
+    void reset();
+
+    /// @brief Returns histogram name.
+    std::string getName() const {
+        return (name_);
+    }
+
+    /// @brief Returns number of recorded samples.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// @brief Returns sum of recorded samples.
+    uint64_t getSum() const {
+        return (sum_);
+    }
+
+    /// @brief Returns the lowest recorded sample or 0 if there are none.
+    uint64_t getMin() const {
+        return (count_ > 0 ? min_ : 0);
+    }
+
+    /// @brief Returns the highest recorded sample.
+    uint64_t getMax() const {
+        return (max_);
+    }
+
+    /// @brief Returns number of samples recorded in a bucket.
+    ///
+    /// @param bucket bucket index
+    /// @throw isc::OutOfRange if the index is out of range
+    uint64_t getBucketCount(const size_t bucket) const;
+
+    /// @brief Returns the (exclusive) upper bound of a bucket.
+    ///
+    /// @param bucket bucket index
+    /// @return upper bound or 0 for the last (unbounded) bucket
+    /// @throw isc::OutOfRange if the index is out of range
+    static uint64_t getBucketUpperBound(const size_t bucket);
+
+    /// @brief Returns the index of the bucket a value falls into.
+    ///
+    /// @param value sample value
+    static size_t getBucketIndex(const uint64_t value);
+
+    /// @brief Returns an estimate of the specified percentile.
+    ///
+    /// The returned value is the highest value falling into the bucket
+    /// holding the percentile, capped at the maximum recorded value.
+    ///
+    /// @param percentile percentile in the range of (0, 100]
+    /// @return estimated percentile or 0 if there are no samples
+    /// @throw isc::OutOfRange if the percentile is out of range
+    uint64_t getPercentile(const double percentile) const;
+
+    /// @brief Returns the histogram as a JSON structure.
+    ///
+    /// The returned map contains "count", "sum", "min", "max", "p50",
+    /// "p99" and "buckets". The latter is a list of the non-empty buckets,
+    /// each represented as a list of the bucket upper bound (0 for
+    /// unbounded) and the number of samples in the bucket.
+    ///
+    /// @return JSON structure representing the histogram
+    isc::data::ConstElementPtr getJSON() const;
+
+private:
+
+    /// @brief Histogram name.
+    std::string name_;
+
+    /// @brief Number of recorded samples.
+    uint64_t count_;
+
+    /// @brief Sum of recorded samples.
+    uint64_t sum_;
+
+    /// @brief Lowest recorded sample.
+    uint64_t min_;
+
+    /// @brief Highest recorded sample.
+    uint64_t max_;
+
+    /// @brief Bucket counters.
+    uint64_t buckets_[NUM_BUCKETS];
+};
+
+/// @brief Histogram pointer
+typedef boost::shared_ptr<Histogram> HistogramPtr;
+
+};
+};
+
+#endif // HISTOGRAM_H
@@ -22,7 +22,7 @@ StatsMgr& StatsMgr::instance() {
 }
 
 StatsMgr::StatsMgr()
-    :global_(new StatContext()) {
+    :global_(new StatContext()), histograms_(), histograms_generation_(0) {
 
 }
 
@@ -100,6 +100,8 @@ bool StatsMgr::del(const std::string& name) {
 
 void StatsMgr::removeAll() {
     global_->stats_.clear();
+    histograms_.clear();
+    ++histograms_generation_;
 }
 
 isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
@@ -132,12 +134,58 @@ void StatsMgr::resetAll() {
         // ... and reset each statistic.
         s->second->reset();
     }
+
+    for (std::map<std::string, HistogramPtr>::iterator h = histograms_.begin();
+         h != histograms_.end(); ++h) {
+        h->second->reset();
+    }
 }
 
 size_t StatsMgr::count() const {
     return (global_->stats_.size());
 }
 
+void StatsMgr::addHistogramSample(const std::string& name,
+                                  const uint64_t value) {
+    addHistogram(name)->addSample(value);
+}
+
+HistogramPtr StatsMgr::addHistogram(const std::string& name) {
+    std::map<std::string, HistogramPtr>::iterator h = histograms_.find(name);
+    if (h == histograms_.end()) {
+        h = histograms_.insert(std::make_pair(name,
+                                              HistogramPtr(new Histogram(name)))).first;
+    }
+    return (h->second);
+}
+
+HistogramPtr StatsMgr::getHistogram(const std::string& name) const {
+    std::map<std::string, HistogramPtr>::const_iterator h = histograms_.find(name);
+    if (h == histograms_.end()) {
+        return (HistogramPtr());
+    }
+    return (h->second);
+}
+
+isc::data::ConstElementPtr
+StatsMgr::getHistogramJSON(const std::string& name) const {
+    isc::data::ElementPtr response = isc::data::Element::createMap();
+    HistogramPtr histogram = getHistogram(name);
+    if (histogram) {
+        response->set(name, histogram->getJSON());
+    }
+    return (response);
+}
+
+isc::data::ConstElementPtr StatsMgr::getAllHistograms() const {
+    isc::data::ElementPtr map = isc::data::Element::createMap();
+    for (std::map<std::string, HistogramPtr>::const_iterator h = histograms_.begin();
+         h != histograms_.end(); ++h) {
+        map->set(h->first, h->second->getJSON());
+    }
+    return (map);
+}
+
 isc::data::ConstElementPtr
 StatsMgr::statisticGetHandler(const std::string& /*name*/,
                               const isc::data::ConstElementPtr& params) {
@@ -206,6 +254,24 @@ StatsMgr::statisticResetAllHandler(const std::string& /*name*/,
                          "All statistics reset to neutral values."));
 }
 
+isc::data::ConstElementPtr
+StatsMgr::statisticHistogramGetHandler(const std::string& /*name*/,
+                                       const isc::data::ConstElementPtr& params) {
+    std::string name, error;
+    if (!getStatName(params, name, error)) {
+        return (createAnswer(CONTROL_RESULT_ERROR, error));
+    }
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         instance().getHistogramJSON(name)));
+}
+
+isc::data::ConstElementPtr
+StatsMgr::statisticHistogramGetAllHandler(const std::string& /*name*/,
+                                          const isc::data::ConstElementPtr& /*params*/) {
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         instance().getAllHistograms()));
+}
+
 bool
 StatsMgr::getStatName(const isc::data::ConstElementPtr& params,
                       std::string& name,
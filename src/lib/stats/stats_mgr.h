@@ -9,6 +9,7 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <stats/histogram.h>
 #include <boost/noncopyable.hpp>
 
 #include <map>
@@ -200,6 +201,65 @@ class StatsMgr : public boost::noncopyable {
 
     /// @}
 
+    /// @defgroup histogram_methods Methods are used to record latencies.
+    ///
+    /// @brief The following methods are used to maintain histograms.
+    ///
+    /// Histograms are kept separately from the observations, so they
+    /// are not returned by @ref get and @ref getAll and aren't counted
+    /// by @ref count. They are reset by @ref resetAll and removed by
+    /// @ref removeAll.
+    ///
+    /// @{
+
+    /// @brief Records a sample in a histogram.
+    ///
+    /// The histogram is created if it doesn't exist.
+    ///
+    /// @param name name of the histogram
+    /// @param value sample value (typically latency in microseconds)
+    void addHistogramSample(const std::string& name, const uint64_t value);
+
+    /// @brief Returns a histogram, creating it if it doesn't exist.
+    ///
+    /// The returned pointer can be kept to record samples without looking
+    /// up the histogram by name. It is valid until the histograms are
+    /// removed, which is reported by @ref getHistogramsGeneration.
+    ///
+    /// @param name name of the histogram
+    /// @return Pointer to the histogram
+    HistogramPtr addHistogram(const std::string& name);
+
+    /// @brief Returns the number of times the histograms were removed.
+    ///
+    /// The holders of the pointers returned by @ref addHistogram compare
+    /// this value with the one at the time they got the pointers to know
+    /// whether they must get them again.
+    ///
+    /// @return Counter incremented by @ref removeAll
+    uint64_t getHistogramsGeneration() const {
+        return (histograms_generation_);
+    }
+
+    /// @brief Returns a histogram.
+    ///
+    /// @param name name of the histogram
+    /// @return Pointer to the histogram or NULL if there is no such histogram
+    HistogramPtr getHistogram(const std::string& name) const;
+
+    /// @brief Returns a single histogram as a JSON structure.
+    ///
+    /// @param name name of the histogram
+    /// @return JSON map with the histogram (empty if not found)
+    isc::data::ConstElementPtr getHistogramJSON(const std::string& name) const;
+
+    /// @brief Returns all histograms as a JSON structure.
+    ///
+    /// @return JSON map with all histograms
+    isc::data::ConstElementPtr getAllHistograms() const;
+
+    /// @}
+
     /// @brief Returns an observation.
     ///
     /// Used in testing only. Production code should use @ref get() method.
@@ -325,6 +385,38 @@ class StatsMgr : public boost::noncopyable {
     statisticRemoveAllHandler(const std::string& name,
                               const isc::data::ConstElementPtr& params);
 
+    /// @brief Handles statistic-histogram-get command
+    ///
+    /// This method handles statistic-histogram-get command, which returns
+    /// a given latency histogram. It expects one parameter stored in params
+    /// map: name: name-of-the-histogram
+    ///
+    /// Example params structure:
+    /// {
+    ///     "name": "pkt4-latency-total"
+    /// }
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-histogram-get")
+    /// @param params structure containing a map that contains "name"
+    /// @return answer containing details of specified histogram
+    static isc::data::ConstElementPtr
+    statisticHistogramGetHandler(const std::string& name,
+                                 const isc::data::ConstElementPtr& params);
+
+    /// @brief Handles statistic-histogram-get-all command
+    ///
+    /// This method handles statistic-histogram-get-all command, which
+    /// returns all latency histograms. Params parameter is ignored.
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-histogram-get-all")
+    /// @param params ignored
+    /// @return answer containing all histograms
+    static isc::data::ConstElementPtr
+    statisticHistogramGetAllHandler(const std::string& name,
+                                    const isc::data::ConstElementPtr& params);
+
     /// @}
 
  private:
@@ -424,6 +516,12 @@ class StatsMgr : public boost::noncopyable {
 
     // This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
+
+    /// @brief Latency histograms indexed by name.
+    std::map<std::string, HistogramPtr> histograms_;
+
+    /// @brief Number of times the histograms were removed.
+    uint64_t histograms_generation_;
 };
 
 };
@@ -0,0 +1,95 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/histogram.h>
+#include <exceptions/exceptions.h>
+#include <cc/data.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::data;
+using namespace isc::stats;
+
+namespace {
+
+// Checks that the values are assigned to the correct buckets.
+TEST(HistogramTest, bucketIndex) {
+    EXPECT_EQ(0, Histogram::getBucketIndex(0));
+    EXPECT_EQ(1, Histogram::getBucketIndex(1));
+    EXPECT_EQ(2, Histogram::getBucketIndex(2));
+    EXPECT_EQ(2, Histogram::getBucketIndex(3));
+    EXPECT_EQ(3, Histogram::getBucketIndex(4));
+    EXPECT_EQ(10, Histogram::getBucketIndex(1023));
+    EXPECT_EQ(11, Histogram::getBucketIndex(1024));
+    EXPECT_EQ(Histogram::NUM_BUCKETS - 1,
+              Histogram::getBucketIndex(0xFFFFFFFFFFFFFFFFull));
+
+    EXPECT_EQ(1, Histogram::getBucketUpperBound(0));
+    EXPECT_EQ(1024, Histogram::getBucketUpperBound(10));
+    EXPECT_EQ(0, Histogram::getBucketUpperBound(Histogram::NUM_BUCKETS - 1));
+    EXPECT_THROW(Histogram::getBucketUpperBound(Histogram::NUM_BUCKETS),
+                 OutOfRange);
+}
+
+// Checks that samples are recorded and summarized properly.
+TEST(HistogramTest, addSample) {
+    Histogram h("alpha");
+    EXPECT_EQ("alpha", h.getName());
+    EXPECT_EQ(0, h.getCount());
+    EXPECT_EQ(0, h.getMin());
+    EXPECT_EQ(0, h.getPercentile(50));
+
+    h.addSample(5);
+    h.addSample(7);
+    h.addSample(100);
+    EXPECT_EQ(3, h.getCount());
+    EXPECT_EQ(112, h.getSum());
+    EXPECT_EQ(5, h.getMin());
+    EXPECT_EQ(100, h.getMax());
+    EXPECT_EQ(2, h.getBucketCount(3));
+    EXPECT_EQ(1, h.getBucketCount(7));
+    EXPECT_THROW(h.getBucketCount(Histogram::NUM_BUCKETS), OutOfRange);
+
+    h.reset();
+    EXPECT_EQ(0, h.getCount());
+    EXPECT_EQ(0, h.getSum());
+    EXPECT_EQ(0, h.getMax());
+    EXPECT_EQ(0, h.getBucketCount(3));
+}
+
+// Checks percentile estimation.
+TEST(HistogramTest, percentile) {
+    Histogram h("alpha");
+    for (uint64_t i = 1; i <= 100; ++i) {
+        h.addSample(i);
+    }
+    // The 50th sample (50) falls into the [32, 64) bucket.
+    EXPECT_EQ(63, h.getPercentile(50));
+    // The 99th and 100th samples fall into the [64, 128) bucket, but
+    // the estimate must not exceed the maximum.
+    EXPECT_EQ(100, h.getPercentile(99));
+    EXPECT_EQ(100, h.getPercentile(100));
+    EXPECT_EQ(1, h.getPercentile(1));
+
+    EXPECT_THROW(h.getPercentile(0), OutOfRange);
+    EXPECT_THROW(h.getPercentile(100.1), OutOfRange);
+}
+
+// Checks JSON representation of the histogram.
+TEST(HistogramTest, getJSON) {
+    Histogram h("alpha");
+    h.addSample(0);
+    h.addSample(3);
+    h.addSample(3);
+
+    std::string exp = "{ \"buckets\": [ [ 1, 1 ], [ 4, 2 ] ], \"count\": 3, "
+        "\"max\": 3, \"min\": 0, \"p50\": 3, \"p99\": 3, \"sum\": 6 }";
+    EXPECT_EQ(exp, h.getJSON()->str());
+}
+
+};
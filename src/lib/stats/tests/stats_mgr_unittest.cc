@@ -678,4 +678,82 @@ TEST_F(StatsMgrTest, commandRemoveAll) {
     EXPECT_FALSE(StatsMgr::instance().getObservation("delta"));
 }
 
+// Checks that samples can be recorded in histograms and reported.
+TEST_F(StatsMgrTest, histograms) {
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("alpha"));
+
+    StatsMgr::instance().addHistogramSample("alpha", 5);
+    StatsMgr::instance().addHistogramSample("alpha", 7);
+    StatsMgr::instance().addHistogramSample("beta", 100);
+
+    HistogramPtr alpha = StatsMgr::instance().getHistogram("alpha");
+    ASSERT_TRUE(alpha);
+    EXPECT_EQ(2, alpha->getCount());
+    EXPECT_EQ(12, alpha->getSum());
+
+    // Histograms are not observations.
+    EXPECT_EQ(0, StatsMgr::instance().count());
+    EXPECT_FALSE(StatsMgr::instance().getObservation("alpha"));
+
+    // Resetting all statistics resets the histograms.
+    StatsMgr::instance().resetAll();
+    ASSERT_TRUE(StatsMgr::instance().getHistogram("alpha"));
+    EXPECT_EQ(0, StatsMgr::instance().getHistogram("alpha")->getCount());
+
+    // Removing all statistics removes the histograms.
+    const uint64_t generation = StatsMgr::instance().getHistogramsGeneration();
+    StatsMgr::instance().removeAll();
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("alpha"));
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("beta"));
+    EXPECT_EQ(generation + 1, StatsMgr::instance().getHistogramsGeneration());
+}
+
+// Checks that a histogram can be retrieved once to record samples.
+TEST_F(StatsMgrTest, addHistogram) {
+    HistogramPtr alpha = StatsMgr::instance().addHistogram("alpha");
+    ASSERT_TRUE(alpha);
+    EXPECT_EQ(alpha, StatsMgr::instance().getHistogram("alpha"));
+    EXPECT_EQ(alpha, StatsMgr::instance().addHistogram("alpha"));
+
+    alpha->addSample(3);
+    StatsMgr::instance().addHistogramSample("alpha", 4);
+    EXPECT_EQ(2, alpha->getCount());
+}
+
+// Test checks if statistic-histogram-get and statistic-histogram-get-all
+// handlers return histograms.
+TEST_F(StatsMgrTest, commandStatisticHistogramGet) {
+    StatsMgr::instance().addHistogramSample("alpha", 3);
+    StatsMgr::instance().addHistogramSample("beta", 1);
+
+    ElementPtr params = Element::createMap();
+    params->set("name", Element::create("alpha"));
+    ConstElementPtr rsp = StatsMgr::instance().
+        statisticHistogramGetHandler("statistic-histogram-get", params);
+    int status_code;
+    ConstElementPtr rep = parseAnswer(status_code, rsp);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(rep);
+    ConstElementPtr alpha = rep->get("alpha");
+    ASSERT_TRUE(alpha);
+    EXPECT_EQ(1, alpha->get("count")->intValue());
+    EXPECT_FALSE(rep->get("beta"));
+
+    // Missing name.
+    rsp = StatsMgr::instance().
+        statisticHistogramGetHandler("statistic-histogram-get", ElementPtr());
+    ASSERT_NO_THROW(parseAnswer(status_code, rsp));
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status_code);
+
+    rsp = StatsMgr::instance().
+        statisticHistogramGetAllHandler("statistic-histogram-get-all",
+                                        ElementPtr());
+    rep = parseAnswer(status_code, rsp);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(rep);
+    EXPECT_EQ(2, rep->size());
+    EXPECT_TRUE(rep->get("alpha"));
+    EXPECT_TRUE(rep->get("beta"));
+}
+
 };
@@ -0,0 +1,387 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <util/memory_segment_mapped.h>
+#include <exceptions/exceptions.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+/// \brief Identifies the files holding a mapped memory segment.
+const char SEGMENT_MAGIC[8] = { 'K', 'E', 'A', 'M', 'S', 'E', 'G', '1' };
+
+/// \brief Size class of the smallest blocks (16 bytes).
+const unsigned int MIN_SIZE_CLASS = 4;
+
+/// \brief Number of size classes.
+const unsigned int NUM_SIZE_CLASSES = 48;
+
+/// \brief Flag set in the size class of the free blocks.
+const uint64_t FREE_BLOCK = static_cast<uint64_t>(1) << 63;
+
+/// \brief Header of an allocated or free block.
+struct BlockHeader {
+    /// \brief Size class of the block, with \c FREE_BLOCK when it is free.
+    uint64_t size_class_;
+
+    /// \brief Requested size when the block is allocated, offset of the
+    /// next free block of the same size class when it is free.
+    uint64_t value_;
+};
+
+/// \brief Returns the size class of a block.
+///
+/// \param size requested size
+/// \return the smallest size class such as 2^class >= size.
+unsigned int
+getSizeClass(const size_t size) {
+    unsigned int size_class = MIN_SIZE_CLASS;
+    while ((size_class < NUM_SIZE_CLASSES) &&
+           ((static_cast<uint64_t>(1) << size_class) < size)) {
+        ++size_class;
+    }
+    return (size_class);
+}
+
+/// \brief Rounds a size up to a multiple of the page size.
+///
+/// \param size size to round up
+size_t
+roundToPage(const size_t size) {
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (((size + page - 1) / page) * page);
+}
+
+}
+
+namespace isc {
+namespace util {
+
+const size_t MemorySegmentMapped::INITIAL_SIZE;
+const size_t MemorySegmentMapped::MAX_NAMES;
+const size_t MemorySegmentMapped::MAX_NAME_LENGTH;
+
+/// \brief Header of the mapped file.
+struct MemorySegmentMapped::Header {
+    /// \brief Named address.
+    struct Name {
+        /// \brief Name, empty when the entry is not used.
+        char name_[MAX_NAME_LENGTH + 1];
+
+        /// \brief Offset of the address, 0 for NULL.
+        uint64_t offset_;
+    };
+
+    /// \brief Identifies the file format.
+    char magic_[sizeof(SEGMENT_MAGIC)];
+
+    /// \brief Size of the file.
+    uint64_t size_;
+
+    /// \brief Offset of the free space following the last block.
+    uint64_t top_;
+
+    /// \brief Number of allocated blocks.
+    uint64_t blocks_;
+
+    /// \brief Offsets of the first free block of each size class.
+    uint64_t free_[NUM_SIZE_CLASSES];
+
+    /// \brief Named addresses.
+    Name names_[MAX_NAMES];
+};
+
+MemorySegmentMapped::MemorySegmentMapped(const std::string& filename,
+                                         const OpenMode mode,
+                                         const size_t initial_size)
+    : filename_(filename), fd_(-1), base_(NULL), size_(0), created_(false) {
+    fd_ = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        isc_throw(MemorySegmentOpenError, "unable to open memory segment file "
+                  << filename << ": " << strerror(errno));
+    }
+
+    // The file is locked before it is emptied, so as the content used by
+    // another instance is not discarded.
+    if (flock(fd_, LOCK_EX | LOCK_NB) != 0) {
+        close();
+        isc_throw(MemorySegmentOpenError, "memory segment file " << filename
+                  << " is in use by another process");
+    }
+
+    struct stat st;
+    if (((mode == CREATE_ONLY) && (ftruncate(fd_, 0) != 0)) ||
+        (fstat(fd_, &st) != 0)) {
+        const int error = errno;
+        close();
+        isc_throw(MemorySegmentOpenError, "unable to access memory segment"
+                  " file " << filename << ": " << strerror(error));
+    }
+
+    if (st.st_size == 0) {
+        // The file is new: the extended file is filled with zeros, so only
+        // the non zero fields of the header need to be set.
+        const size_t size = roundToPage(std::max(initial_size,
+                                                 sizeof(Header)));
+        if ((ftruncate(fd_, size) != 0) || !map(size)) {
+            const int error = errno;
+            close();
+            isc_throw(MemorySegmentOpenError, "unable to create memory segment"
+                      " file " << filename << ": " << strerror(error));
+        }
+        Header* header = getHeader();
+        memcpy(header->magic_, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+        header->size_ = size;
+        header->top_ = (sizeof(Header) + 15) & ~static_cast<uint64_t>(15);
+        created_ = true;
+
+    } else {
+        if ((static_cast<size_t>(st.st_size) < sizeof(Header)) ||
+            !map(st.st_size)) {
+            close();
+            isc_throw(MemorySegmentOpenError, "unable to map memory segment"
+                      " file " << filename);
+        }
+        const Header* header = getHeader();
+        if ((memcmp(header->magic_, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) != 0) ||
+            (header->size_ != size_) || (header->top_ > size_)) {
+            close();
+            isc_throw(MemorySegmentOpenError, "file " << filename
+                      << " doesn't hold a valid memory segment");
+        }
+    }
+}
+
+MemorySegmentMapped::~MemorySegmentMapped() {
+    close();
+}
+
+void*
+MemorySegmentMapped::allocate(size_t size) {
+    const unsigned int size_class = getSizeClass(size);
+    if (size_class >= NUM_SIZE_CLASSES) {
+        throw std::bad_alloc();
+    }
+
+    Header* header = getHeader();
+    uint64_t offset = header->free_[size_class];
+    BlockHeader* block = NULL;
+    if (offset != 0) {
+        // Reuse a free block.
+        block = reinterpret_cast<BlockHeader*>(base_ + offset);
+        header->free_[size_class] = block->value_;
+
+    } else {
+        // Carve a new block from the free space.
+        const uint64_t block_size = sizeof(BlockHeader) +
+            (static_cast<uint64_t>(1) << size_class);
+        if (header->top_ + block_size > size_) {
+            grow(header->top_ + block_size);
+            isc_throw(MemorySegmentGrown, "memory segment file " << filename_
+                      << " has grown to " << size_ << " bytes");
+        }
+        offset = header->top_;
+        header->top_ += block_size;
+        block = reinterpret_cast<BlockHeader*>(base_ + offset);
+    }
+
+    block->size_class_ = size_class;
+    block->value_ = size;
+    ++header->blocks_;
+    return (base_ + offset + sizeof(BlockHeader));
+}
+
+void
+MemorySegmentMapped::deallocate(void* ptr, size_t size) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    const uint64_t offset = getOffset(ptr);
+    Header* header = getHeader();
+    if (offset < sizeof(Header) + sizeof(BlockHeader)) {
+        isc_throw(MemorySegmentError, "address " << ptr << " has not been"
+                  " allocated from the memory segment " << filename_);
+    }
+
+    BlockHeader* block = reinterpret_cast<BlockHeader*>(base_ + offset -
+                                                        sizeof(BlockHeader));
+    if ((block->size_class_ & FREE_BLOCK) != 0) {
+        isc_throw(MemorySegmentError, "address " << ptr << " has already been"
+                  " deallocated from the memory segment " << filename_);
+    }
+    if (block->value_ != size) {
+        isc_throw(OutOfRange, "Invalid size to deallocate: " << size
+                  << "; allocated size: " << block->value_);
+    }
+
+    const uint64_t size_class = block->size_class_;
+    block->size_class_ |= FREE_BLOCK;
+    block->value_ = header->free_[size_class];
+    header->free_[size_class] = offset - sizeof(BlockHeader);
+    --header->blocks_;
+}
+
+bool
+MemorySegmentMapped::allMemoryDeallocated() const {
+    const Header* header = getHeader();
+    if (header->blocks_ != 0) {
+        return (false);
+    }
+    for (size_t i = 0; i < MAX_NAMES; ++i) {
+        if (header->names_[i].name_[0] != '\0') {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+void
+MemorySegmentMapped::flush() {
+    if (msync(base_, size_, MS_SYNC) != 0) {
+        isc_throw(MemorySegmentError, "unable to write memory segment file "
+                  << filename_ << ": " << strerror(errno));
+    }
+}
+
+uint64_t
+MemorySegmentMapped::getOffset(const void* addr) const {
+    if (addr == NULL) {
+        return (0);
+    }
+    const uint8_t* ptr = static_cast<const uint8_t*>(addr);
+    if ((ptr < base_) || (ptr >= base_ + size_)) {
+        isc_throw(MemorySegmentError, "address " << addr << " doesn't belong"
+                  " to the memory segment " << filename_);
+    }
+    return (ptr - base_);
+}
+
+void*
+MemorySegmentMapped::getAddress(const uint64_t offset) const {
+    if (offset == 0) {
+        return (NULL);
+    }
+    if (offset >= size_) {
+        isc_throw(MemorySegmentError, "offset " << offset << " is beyond"
+                  " the end of the memory segment " << filename_);
+    }
+    return (base_ + offset);
+}
+
+MemorySegment::NamedAddressResult
+MemorySegmentMapped::getNamedAddressImpl(const char* name) const {
+    const Header* header = getHeader();
+    for (size_t i = 0; i < MAX_NAMES; ++i) {
+        if (strcmp(header->names_[i].name_, name) == 0) {
+            return (NamedAddressResult(true,
+                                       getAddress(header->names_[i].offset_)));
+        }
+    }
+    return (NamedAddressResult(false, static_cast<void*>(0)));
+}
+
+bool
+MemorySegmentMapped::setNamedAddressImpl(const char* name, void* addr) {
+    if (strlen(name) > MAX_NAME_LENGTH) {
+        isc_throw(MemorySegmentError, "name " << name << " is too long for"
+                  " the memory segment " << filename_);
+    }
+    const uint64_t offset = getOffset(addr);
+
+    // Replace the existing entry or use the first free one.
+    Header* header = getHeader();
+    Header::Name* entry = NULL;
+    for (size_t i = 0; i < MAX_NAMES; ++i) {
+        if (strcmp(header->names_[i].name_, name) == 0) {
+            entry = &header->names_[i];
+            break;
+        } else if (!entry && (header->names_[i].name_[0] == '\0')) {
+            entry = &header->names_[i];
+        }
+    }
+    if (!entry) {
+        isc_throw(MemorySegmentError, "too many named addresses in the"
+                  " memory segment " << filename_);
+    }
+    strcpy(entry->name_, name);
+    entry->offset_ = offset;
+    return (false);
+}
+
+bool
+MemorySegmentMapped::clearNamedAddressImpl(const char* name) {
+    Header* header = getHeader();
+    for (size_t i = 0; i < MAX_NAMES; ++i) {
+        if (strcmp(header->names_[i].name_, name) == 0) {
+            memset(&header->names_[i], 0, sizeof(header->names_[i]));
+            return (true);
+        }
+    }
+    return (false);
+}
+
+bool
+MemorySegmentMapped::map(const size_t size) {
+    void* base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (base == MAP_FAILED) {
+        return (false);
+    }
+    base_ = static_cast<uint8_t*>(base);
+    size_ = size;
+    return (true);
+}
+
+void
+MemorySegmentMapped::close() {
+    if (base_) {
+        munmap(base_, size_);
+        base_ = NULL;
+    }
+    if (fd_ >= 0) {
+        // This also releases the lock.
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+void
+MemorySegmentMapped::grow(const size_t min_size) {
+    const size_t old_size = size_;
+    const size_t new_size = std::max(old_size * 2, roundToPage(min_size));
+    if (ftruncate(fd_, new_size) != 0) {
+        throw std::bad_alloc();
+    }
+    munmap(base_, old_size);
+    base_ = NULL;
+    if (!map(new_size)) {
+        // Keep the segment usable with its former size.
+        if (!map(old_size)) {
+            isc_throw(MemorySegmentError, "unable to map memory segment file "
+                      << filename_ << " again");
+        }
+        throw std::bad_alloc();
+    }
+    getHeader()->size_ = new_size;
+}
+
+MemorySegmentMapped::Header*
+MemorySegmentMapped::getHeader() const {
+    return (reinterpret_cast<Header*>(base_));
+}
+
+} // namespace util
+} // namespace isc
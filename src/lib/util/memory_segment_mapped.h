@@ -0,0 +1,207 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMORY_SEGMENT_MAPPED_H
+#define MEMORY_SEGMENT_MAPPED_H
+
+#include <util/memory_segment.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace util {
+
+/// \brief Memory Segment backed by a memory mapped file.
+///
+/// The memory allocated from this segment lives in a file mapped with
+/// \c mmap(MAP_SHARED), so its content survives the process and is
+/// found again when the same file is opened by a subsequent instance.
+/// This allows for keeping large data sets which would otherwise have
+/// to be rebuilt at startup.
+///
+/// The file holds a header followed by the allocated blocks. The blocks
+/// are referenced within the file by their offsets, as the file may be
+/// mapped at a different address by each process (and after the segment
+/// has grown). The named addresses are stored in the header as offsets
+/// and should be used to find the data structures again after opening
+/// an existing file.
+///
+/// The allocator rounds the requested sizes up to a power of two and
+/// keeps a free list for each size. It is intended for data sets made of
+/// many objects of similar size, rather than as a general purpose heap.
+///
+/// When the segment runs out of space, the file is extended and mapped
+/// again and \c allocate() throws \c MemorySegmentGrown, as specified
+/// by the \c MemorySegment interface.
+///
+/// The file format depends on the architecture of the host (sizes and
+/// byte order). The file is locked while it is mapped, so as it can't
+/// be used by two instances at the same time.
+class MemorySegmentMapped : public MemorySegment, public boost::noncopyable {
+public:
+
+    /// \brief Specifies how the file is opened.
+    enum OpenMode {
+        OPEN_OR_CREATE, ///< Open the existing content or create a file.
+        CREATE_ONLY     ///< Discard the existing content, if any.
+    };
+
+    /// \brief Default initial size of a new segment.
+    static const size_t INITIAL_SIZE = 1 << 20;
+
+    /// \brief Maximum number of named addresses.
+    static const size_t MAX_NAMES = 16;
+
+    /// \brief Maximum length of a name.
+    static const size_t MAX_NAME_LENGTH = 55;
+
+    /// \brief Constructor.
+    ///
+    /// \param filename name of the file backing the segment
+    /// \param mode specifies if the existing content is kept
+    /// \param initial_size size of the file when it is created
+    ///
+    /// \throw MemorySegmentOpenError if the file can't be opened, mapped
+    /// or locked, or if it doesn't hold a valid segment.
+    MemorySegmentMapped(const std::string& filename,
+                        const OpenMode mode = OPEN_OR_CREATE,
+                        const size_t initial_size = INITIAL_SIZE);
+
+    /// \brief Destructor.
+    ///
+    /// Unmaps and closes the file. The content is not explicitly flushed
+    /// to the disk, see \c flush().
+    virtual ~MemorySegmentMapped();
+
+    /// \brief Allocate a block of memory in the mapped file.
+    ///
+    /// \throw MemorySegmentGrown the file has been extended and mapped
+    /// again: the addresses in the segment must be fetched again.
+    /// \throw std::bad_alloc the file can't be extended.
+    ///
+    /// \param size The size of the memory requested in bytes.
+    /// \return Returns pointer to the memory allocated.
+    virtual void* allocate(size_t size);
+
+    /// \brief Free a block of memory.
+    ///
+    /// \throw MemorySegmentError the address doesn't belong to the segment.
+    /// \throw OutOfRange the size is not the size of the allocated block.
+    ///
+    /// \param ptr Pointer to the block of memory to free/release. This
+    /// should be equal to a value returned by <code>allocate()</code>.
+    /// \param size The size of the memory to be freed in bytes. This
+    /// should be equal to the number of bytes originally allocated.
+    virtual void deallocate(void* ptr, size_t size);
+
+    /// \brief Check if all allocated memory was deallocated.
+    virtual bool allMemoryDeallocated() const;
+
+    /// \brief Writes the content of the segment to the disk.
+    ///
+    /// This method blocks until the modified pages have been written.
+    ///
+    /// \throw MemorySegmentError if the content can't be written.
+    void flush();
+
+    /// \brief Checks if the file was created (or emptied) by this object.
+    ///
+    /// \return false if the content of an existing file was kept.
+    bool isCreated() const {
+        return (created_);
+    }
+
+    /// \brief Returns the current size of the file.
+    size_t getSize() const {
+        return (size_);
+    }
+
+    /// \brief Returns the name of the file.
+    const std::string& getFileName() const {
+        return (filename_);
+    }
+
+    /// \brief Returns the offset of an address in the file.
+    ///
+    /// The data structures held in the segment must reference each other
+    /// by offset, as the segment is mapped at another address when it
+    /// grows or is opened again.
+    ///
+    /// \param addr address in the segment, NULL is converted to 0
+    /// \throw MemorySegmentError the address doesn't belong to the segment.
+    uint64_t getOffset(const void* addr) const;
+
+    /// \brief Returns the address of an offset in the file.
+    ///
+    /// \param offset offset returned by \c getOffset()
+    /// \return address in the segment, NULL for 0
+    /// \throw MemorySegmentError the offset is beyond the end of the file.
+    void* getAddress(const uint64_t offset) const;
+
+protected:
+
+    /// \brief Mapped segment version of getNamedAddress.
+    virtual NamedAddressResult getNamedAddressImpl(const char* name) const;
+
+    /// \brief Mapped segment version of setNamedAddress.
+    ///
+    /// \throw MemorySegmentError the address doesn't belong to the
+    /// segment, the name is too long or there is no room for a new name.
+    virtual bool setNamedAddressImpl(const char* name, void* addr);
+
+    /// \brief Mapped segment version of clearNamedAddress.
+    virtual bool clearNamedAddressImpl(const char* name);
+
+private:
+
+    /// \brief Header of the file, defined in the implementation.
+    struct Header;
+
+    /// \brief Maps the file.
+    ///
+    /// \param size size of the file
+    /// \return true on success.
+    bool map(const size_t size);
+
+    /// \brief Unmaps and closes the file.
+    void close();
+
+    /// \brief Extends the file and maps it again.
+    ///
+    /// \param min_size minimal size of the file
+    /// \throw std::bad_alloc if the file can't be extended.
+    void grow(const size_t min_size);
+
+    /// \brief Returns the header of the file.
+    Header* getHeader() const;
+
+    /// \brief Name of the file.
+    std::string filename_;
+
+    /// \brief Descriptor of the file.
+    int fd_;
+
+    /// \brief Address at which the file is mapped.
+    uint8_t* base_;
+
+    /// \brief Size of the mapped file.
+    size_t size_;
+
+    /// \brief True if the file was created (or emptied) by this object.
+    bool created_;
+};
+
+} // namespace util
+} // namespace isc
+
+#endif // MEMORY_SEGMENT_MAPPED_H
+
+// Local Variables:
+// mode: c++
+// End:
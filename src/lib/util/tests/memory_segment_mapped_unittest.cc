@@ -0,0 +1,233 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <util/tests/memory_segment_common_unittest.h>
+
+#include <util/memory_segment_mapped.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+#include <boost/lexical_cast.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace isc;
+using namespace isc::util;
+
+namespace {
+
+/// \brief Test fixture removing the segment file before and after the tests.
+class MemorySegmentMappedTest : public ::testing::Test {
+public:
+    /// \brief Constructor.
+    MemorySegmentMappedTest()
+        : filename_(TEST_DATA_BUILDDIR "/test_segment.mapped") {
+        static_cast<void>(remove(filename_.c_str()));
+    }
+
+    /// \brief Destructor.
+    virtual ~MemorySegmentMappedTest() {
+        static_cast<void>(remove(filename_.c_str()));
+    }
+
+    /// \brief Allocates from a segment, retrying when the segment grows.
+    ///
+    /// \param segment memory segment
+    /// \param size size to allocate
+    void* allocate(MemorySegment& segment, const size_t size) {
+        for (;;) {
+            try {
+                return (segment.allocate(size));
+            } catch (const MemorySegmentGrown&) {
+            }
+        }
+    }
+
+    /// \brief Name of the segment file.
+    string filename_;
+};
+
+// Checks the allocation and deallocation of blocks.
+TEST_F(MemorySegmentMappedTest, allocate) {
+    MemorySegmentMapped segment(filename_);
+    EXPECT_TRUE(segment.isCreated());
+    EXPECT_EQ(filename_, segment.getFileName());
+    EXPECT_EQ(MemorySegmentMapped::INITIAL_SIZE, segment.getSize());
+    EXPECT_TRUE(segment.allMemoryDeallocated());
+
+    void* ptr = segment.allocate(1024);
+    void* ptr2 = segment.allocate(42);
+    EXPECT_FALSE(segment.allMemoryDeallocated());
+    EXPECT_NE(ptr, ptr2);
+    memset(ptr, 0xff, 1024);
+    memset(ptr2, 0xff, 42);
+
+    segment.deallocate(ptr, 1024);
+    EXPECT_FALSE(segment.allMemoryDeallocated());
+
+    // The freed block is reused by an allocation of the same size class.
+    void* ptr3 = segment.allocate(1000);
+    EXPECT_EQ(ptr, ptr3);
+
+    segment.deallocate(ptr2, 42);
+    segment.deallocate(ptr3, 1000);
+    EXPECT_TRUE(segment.allMemoryDeallocated());
+
+    // Deallocating NULL does nothing.
+    EXPECT_NO_THROW(segment.deallocate(NULL, 0));
+}
+
+// Checks the errors when deallocating blocks.
+TEST_F(MemorySegmentMappedTest, badDeallocate) {
+    MemorySegmentMapped segment(filename_);
+    void* ptr = segment.allocate(1024);
+
+    // The size must be the size of the allocated block.
+    EXPECT_THROW(segment.deallocate(ptr, 2048), OutOfRange);
+
+    // The address must belong to the segment.
+    uint8_t ch = 'A';
+    EXPECT_THROW(segment.deallocate(&ch, 1), MemorySegmentError);
+
+    EXPECT_NO_THROW(segment.deallocate(ptr, 1024));
+    EXPECT_TRUE(segment.allMemoryDeallocated());
+
+    // A block can't be freed twice.
+    EXPECT_THROW(segment.deallocate(ptr, 1024), MemorySegmentError);
+}
+
+// Checks the named addresses.
+TEST_F(MemorySegmentMappedTest, namedAddress) {
+    MemorySegmentMapped segment(filename_);
+    isc::util::test::checkSegmentNamedAddress(segment, false);
+
+    // The names are limited in length and number.
+    void* ptr = segment.allocate(16);
+    const string long_name(MemorySegmentMapped::MAX_NAME_LENGTH + 1, 'a');
+    EXPECT_THROW(segment.setNamedAddress(long_name.c_str(), ptr),
+                 MemorySegmentError);
+    for (size_t i = 0; i < MemorySegmentMapped::MAX_NAMES; ++i) {
+        const string name = "name" + boost::lexical_cast<string>(i);
+        EXPECT_FALSE(segment.setNamedAddress(name.c_str(), ptr));
+    }
+    EXPECT_THROW(segment.setNamedAddress("one too many", ptr),
+                 MemorySegmentError);
+    // An existing name can still be updated.
+    EXPECT_NO_THROW(segment.setNamedAddress("name0", NULL));
+}
+
+// Checks that the segment grows and that the content is kept.
+TEST_F(MemorySegmentMappedTest, grow) {
+    MemorySegmentMapped segment(filename_, MemorySegmentMapped::CREATE_ONLY,
+                                4096);
+    EXPECT_EQ(4096, segment.getSize());
+
+    // Fill the segment with blocks referenced by their offsets.
+    vector<uint64_t> offsets;
+    bool grown = false;
+    for (int i = 0; !grown || (i < 1000); ++i) {
+        void* ptr = NULL;
+        try {
+            ptr = segment.allocate(sizeof(uint32_t));
+        } catch (const MemorySegmentGrown&) {
+            grown = true;
+            ptr = segment.allocate(sizeof(uint32_t));
+        }
+        *static_cast<uint32_t*>(ptr) = i;
+        offsets.push_back(segment.getOffset(ptr));
+    }
+    EXPECT_LT(4096, segment.getSize());
+
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(i, *static_cast<uint32_t*>(segment.getAddress(offsets[i])));
+    }
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        segment.deallocate(segment.getAddress(offsets[i]), sizeof(uint32_t));
+    }
+    EXPECT_TRUE(segment.allMemoryDeallocated());
+
+    // Too large allocations are rejected.
+    EXPECT_THROW(segment.allocate(static_cast<size_t>(1) << 62),
+                 std::bad_alloc);
+}
+
+// Checks the conversions between addresses and offsets.
+TEST_F(MemorySegmentMappedTest, offsets) {
+    MemorySegmentMapped segment(filename_);
+    void* ptr = segment.allocate(64);
+    const uint64_t offset = segment.getOffset(ptr);
+    EXPECT_NE(0, offset);
+    EXPECT_EQ(ptr, segment.getAddress(offset));
+
+    EXPECT_EQ(0, segment.getOffset(NULL));
+    EXPECT_FALSE(segment.getAddress(0));
+
+    uint8_t ch = 'A';
+    EXPECT_THROW(segment.getOffset(&ch), MemorySegmentError);
+    EXPECT_THROW(segment.getAddress(segment.getSize()), MemorySegmentError);
+}
+
+// Checks that the content is found again when the file is opened again.
+TEST_F(MemorySegmentMappedTest, reopen) {
+    {
+        MemorySegmentMapped segment(filename_);
+        char* data = static_cast<char*>(allocate(segment, 1 << 21));
+        strcpy(data, "persistent data");
+        segment.setNamedAddress("data", data);
+        segment.flush();
+    }
+
+    {
+        MemorySegmentMapped segment(filename_);
+        EXPECT_FALSE(segment.isCreated());
+        EXPECT_LT(1 << 21, segment.getSize());
+        MemorySegment::NamedAddressResult result =
+            segment.getNamedAddress("data");
+        ASSERT_TRUE(result.first);
+        EXPECT_EQ(string("persistent data"),
+                  static_cast<const char*>(result.second));
+        segment.deallocate(result.second, 1 << 21);
+        segment.clearNamedAddress("data");
+        EXPECT_TRUE(segment.allMemoryDeallocated());
+    }
+
+    // The content is discarded in the create only mode.
+    MemorySegmentMapped segment(filename_, MemorySegmentMapped::CREATE_ONLY);
+    EXPECT_TRUE(segment.isCreated());
+    EXPECT_FALSE(segment.getNamedAddress("data").first);
+}
+
+// Checks that a file can't be mapped twice.
+TEST_F(MemorySegmentMappedTest, locked) {
+    boost::scoped_ptr<MemorySegmentMapped>
+        segment(new MemorySegmentMapped(filename_));
+    EXPECT_THROW(MemorySegmentMapped other(filename_), MemorySegmentOpenError);
+    EXPECT_THROW(MemorySegmentMapped other(filename_,
+                                           MemorySegmentMapped::CREATE_ONLY),
+                 MemorySegmentOpenError);
+
+    // The lock is released when the segment is destroyed.
+    segment.reset();
+    EXPECT_NO_THROW(MemorySegmentMapped other(filename_));
+}
+
+// Checks that a file which doesn't hold a segment is rejected.
+TEST_F(MemorySegmentMappedTest, invalidFile) {
+    {
+        ofstream file(filename_.c_str());
+        file << string(8192, 'x');
+    }
+    EXPECT_THROW(MemorySegmentMapped other(filename_), MemorySegmentOpenError);
+    EXPECT_THROW(MemorySegmentMapped other("/no/such/directory/segment"),
+                 MemorySegmentOpenError);
+}
+
+}
@@ -0,0 +1,192 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef KEA_THREAD_LOCKFREE_QUEUE_H
+#define KEA_THREAD_LOCKFREE_QUEUE_H
+
+#include <exceptions/exceptions.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_array.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace isc {
+namespace util {
+namespace thread {
+
+/// \brief Bounded lock-free queue.
+///
+/// This is a fixed size ring buffer which can be used concurrently by
+/// several producer and consumer threads without locking: each slot
+/// carries a sequence number telling whether it is ready to be written
+/// or read in the current lap, and the producers (resp. consumers) claim
+/// slots by advancing the write (resp. read) position with a
+/// compare-and-swap. This is the algorithm described by Dmitry Vyukov
+/// for bounded MPMC queues.
+///
+/// The queue never blocks: \ref push fails when the queue is full and
+/// \ref pop fails when it is empty, it is up to the caller to decide
+/// whether to retry, wait or give up.
+///
+/// \tparam T type of the queued elements. It must be default
+/// constructible and movable.
+template <typename T>
+class LockFreeQueue : boost::noncopyable {
+public:
+
+    /// \brief Constructor.
+    ///
+    /// \param capacity maximum number of elements in the queue. It is
+    /// rounded up to the next power of 2.
+    /// \throw isc::InvalidParameter if the capacity is 0.
+    explicit LockFreeQueue(size_t capacity)
+        : capacity_(roundCapacity(capacity)), mask_(capacity_ - 1),
+          cells_(new Cell[capacity_]), enqueue_pos_(0), dequeue_pos_(0) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// \brief Returns the maximum number of elements in the queue.
+    size_t getCapacity() const {
+        return (capacity_);
+    }
+
+    /// \brief Returns the approximate number of elements in the queue.
+    ///
+    /// The value is exact only when no other thread uses the queue.
+    size_t size() const {
+        const size_t enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+        const size_t dequeue_pos = dequeue_pos_.load(std::memory_order_relaxed);
+        return (enqueue_pos >= dequeue_pos ? enqueue_pos - dequeue_pos : 0);
+    }
+
+    /// \brief Checks if the queue is empty.
+    ///
+    /// The result is exact only when no other thread uses the queue.
+    bool empty() const {
+        return (size() == 0);
+    }
+
+    /// \brief Appends an element to the queue.
+    ///
+    /// \param value element to append. It is moved into the queue when
+    /// the call succeeds and left untouched otherwise.
+    /// \return true if the element was appended, false if the queue
+    /// was full.
+    bool push(T& value) {
+        Cell* cell = NULL;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t seq = cell->sequence_.load(std::memory_order_acquire);
+            const ptrdiff_t diff = static_cast<ptrdiff_t>(seq) -
+                static_cast<ptrdiff_t>(pos);
+            if (diff == 0) {
+                // The slot is free in this lap: try to claim it.
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot still holds the element of the previous lap.
+                return (false);
+            } else {
+                // Another producer claimed the slot.
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data_ = std::move(value);
+        cell->sequence_.store(pos + 1, std::memory_order_release);
+        return (true);
+    }
+
+    /// \brief Removes the oldest element from the queue.
+    ///
+    /// \param [out] value removed element.
+    /// \return true if an element was removed, false if the queue was
+    /// empty.
+    bool pop(T& value) {
+        Cell* cell = NULL;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t seq = cell->sequence_.load(std::memory_order_acquire);
+            const ptrdiff_t diff = static_cast<ptrdiff_t>(seq) -
+                static_cast<ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                // The slot has been written in this lap: try to claim it.
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot has not been written yet.
+                return (false);
+            } else {
+                // Another consumer claimed the slot.
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data_);
+        // Release the slot for the next lap.
+        cell->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+        return (true);
+    }
+
+private:
+
+    /// \brief Rounds the capacity up to the next power of 2.
+    ///
+    /// \param capacity requested capacity.
+    /// \throw isc::InvalidParameter if the capacity is 0.
+    static size_t roundCapacity(const size_t capacity) {
+        if (capacity == 0) {
+            isc_throw(InvalidParameter, "lock-free queue capacity must be"
+                      " greater than 0");
+        }
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        return (rounded);
+    }
+
+    /// \brief A slot of the ring buffer.
+    struct Cell {
+        /// \brief Sequence number of the slot.
+        std::atomic<size_t> sequence_;
+        /// \brief Stored element.
+        T data_;
+    };
+
+    /// \brief Size of the cache lines, used to keep the positions apart.
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    /// \brief Number of slots.
+    const size_t capacity_;
+
+    /// \brief Mask applied to the positions to get slot indexes.
+    const size_t mask_;
+
+    /// \brief Slots.
+    boost::scoped_array<Cell> cells_;
+
+    /// \brief Position of the next element to be appended.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_;
+
+    /// \brief Position of the next element to be removed.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_;
+};
+
+} // namespace thread
+} // namespace util
+} // namespace isc
+
+#endif // KEA_THREAD_LOCKFREE_QUEUE_H
@@ -247,6 +247,14 @@ CondVar::signal() {
     assert(result == 0);
 }
 
+void
+CondVar::broadcast() {
+    const int result = pthread_cond_broadcast(&impl_->cond_);
+
+    // pthread_cond_broadcast() can only fail when cond_ is invalid.
+    assert(result == 0);
+}
+
 }
 }
 }
@@ -241,6 +241,12 @@ public:
     /// This method never throws; if some unexpected low level error happens
     /// it terminates the program.
     void signal();
+
+    /// \brief Unblock all threads waiting for the condition variable.
+    ///
+    /// This method works like \c pthread_cond_broadcast().  Like \c signal()
+    /// it never throws.
+    void broadcast();
 private:
     class Impl;
     Impl* impl_;
@@ -0,0 +1,107 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/threads/lockfree_queue.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace isc::util::thread;
+
+namespace {
+
+// Test that the capacity is rounded up to a power of 2.
+TEST(LockFreeQueueTest, capacity) {
+    EXPECT_THROW(LockFreeQueue<int>(0), isc::InvalidParameter);
+    EXPECT_EQ(1, LockFreeQueue<int>(1).getCapacity());
+    EXPECT_EQ(8, LockFreeQueue<int>(5).getCapacity());
+    EXPECT_EQ(1024, LockFreeQueue<int>(1024).getCapacity());
+}
+
+// Test that the elements are removed in order and that the queue
+// refuses elements when full.
+TEST(LockFreeQueueTest, fifo) {
+    LockFreeQueue<std::string> queue(4);
+    std::string value;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+
+    // Fill and drain the queue several times to wrap around.
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i) {
+            value = std::string(1, 'a' + i);
+            ASSERT_TRUE(queue.push(value));
+        }
+        EXPECT_EQ(4, queue.size());
+        value = "overflow";
+        EXPECT_FALSE(queue.push(value));
+        // A refused element is left untouched.
+        EXPECT_EQ("overflow", value);
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.pop(value));
+            EXPECT_EQ(std::string(1, 'a' + i), value);
+        }
+        EXPECT_FALSE(queue.pop(value));
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+/// \brief Pushes a range of values, retrying while the queue is full.
+void
+produce(LockFreeQueue<int>* queue, const int first, const int count) {
+    for (int i = first; i < first + count; ++i) {
+        int value = i;
+        while (!queue->push(value)) {
+            // The consumer is behind.
+        }
+    }
+}
+
+// Test that no element is lost or duplicated when several threads
+// append elements concurrently.
+TEST(LockFreeQueueTest, multipleProducers) {
+    const int producers = 4;
+    const int count = 20000;
+    LockFreeQueue<int> queue(64);
+    std::vector<boost::shared_ptr<Thread> > threads;
+    for (int i = 0; i < producers; ++i) {
+        threads.push_back(boost::shared_ptr<Thread>(
+            new Thread(boost::bind(&produce, &queue, i * count, count))));
+    }
+
+    // Each producer's values must be received in order.
+    std::vector<int> last(producers, -1);
+    std::vector<bool> seen(producers * count, false);
+    for (int received = 0; received < producers * count; ) {
+        int value = 0;
+        if (!queue.pop(value)) {
+            continue;
+        }
+        ASSERT_GE(value, 0);
+        ASSERT_LT(value, producers * count);
+        ASSERT_FALSE(seen[value]);
+        seen[value] = true;
+        const int producer = value / count;
+        EXPECT_GT(value, last[producer]);
+        last[producer] = value;
+        ++received;
+    }
+    for (int i = 0; i < producers; ++i) {
+        threads[i]->wait();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+} // end of anonymous namespace